@@ -7,23 +7,26 @@
  */
 
 #include "plssvm/data_set.hpp"
-#include "plssvm/detail/type_list.hpp"  // plssvm::detail::real_type_label_type_combination_list
+#include "plssvm/detail/io/data_set_cache.hpp"  // plssvm::data_set_cache_options, plssvm::data_set_cache, plssvm::detail::io::data_set_cache_directory
+#include "plssvm/detail/type_list.hpp"          // plssvm::detail::real_type_label_type_combination_list
+#include "plssvm/file_format_types.hpp"         // plssvm::csv_options, plssvm::subset_options
 
-#include "utility.hpp"                  // check_kwargs_for_correctness, assemble_unique_class_name,
-                                        // pyarray_to_vector, pyarray_to_string_vector, pylist_to_string_vector, pyarray_to_matrix
+#include "utility.hpp"                          // check_kwargs_for_correctness, assemble_unique_class_name,
+                                                // pyarray_to_vector, pyarray_to_string_vector, pylist_to_string_vector, pyarray_to_matrix
 
-#include "fmt/core.h"                   // fmt::format
-#include "fmt/format.h"                 // fmt::join
-#include "pybind11/numpy.h"             // py::array_t
-#include "pybind11/pybind11.h"          // py::module_, py::class_, py::init, py::return_value_policy, py::arg, py::kwargs, py::value_error, py::pos_only, py::list
-#include "pybind11/stl.h"               // support for STL types
+#include "fmt/core.h"                           // fmt::format
+#include "fmt/format.h"                         // fmt::join
+#include "pybind11/numpy.h"                     // py::array_t
+#include "pybind11/pybind11.h"                  // py::module_, py::class_, py::init, py::return_value_policy, py::arg, py::kwargs, py::value_error, py::pos_only, py::list
+#include "pybind11/stl.h"                       // support for STL types
 
-#include <array>                        // std::array
-#include <cstddef>                      // std::size_t
-#include <string>                       // std::string
-#include <tuple>                        // std::tuple_element_t, std::tuple_size_v
-#include <type_traits>                  // std::is_same_v
-#include <utility>                      // std::move, std::integer_sequence, std::make_integer_sequence
+#include <array>                                // std::array
+#include <cstddef>                              // std::size_t
+#include <cstdint>                              // std::uintmax_t
+#include <string>                               // std::string
+#include <tuple>                                // std::tuple_element_t, std::tuple_size_v
+#include <type_traits>                          // std::is_same_v
+#include <utility>                              // std::move, std::integer_sequence, std::make_integer_sequence
 
 namespace py = pybind11;
 
@@ -106,17 +109,30 @@ void instantiate_data_set_bindings(py::module_ &m, plssvm::detail::real_type_lab
     // bind constructor taking a data set file
     py_data_set.def(py::init([](const std::string &file_name, py::kwargs args) {
                         // check for valid keys
-                        check_kwargs_for_correctness(args, { "file_format", "scaling" });
+                        check_kwargs_for_correctness(args, { "file_format", "scaling", "csv_options", "subset" });
+
+                        // the subset of the features and data points to read; by default, the whole file is read
+                        const plssvm::subset_options subset = args.contains("subset") ? args["subset"].cast<plssvm::subset_options>() : plssvm::subset_options{};
 
                         // call the constructor corresponding to the provided keyword arguments
-                        if (args.contains("file_format") && args.contains("scaling")) {
-                            return data_set_type{ file_name, args["file_format"].cast<plssvm::file_format_type>(), create_scaling_object<data_set_type>(args) };
+                        if (args.contains("csv_options")) {
+                            if (args.contains("file_format")) {
+                                throw py::value_error{ "The keyword arguments 'file_format' and 'csv_options' are mutually exclusive; the file format is derived from the file extension!" };
+                            }
+                            const auto options = args["csv_options"].cast<plssvm::csv_options>();
+                            if (args.contains("scaling")) {
+                                return data_set_type{ file_name, options, subset, create_scaling_object<data_set_type>(args) };
+                            } else {
+                                return data_set_type{ file_name, options, subset };
+                            }
+                        } else if (args.contains("file_format") && args.contains("scaling")) {
+                            return data_set_type{ file_name, args["file_format"].cast<plssvm::file_format_type>(), subset, create_scaling_object<data_set_type>(args) };
                         } else if (args.contains("file_format")) {
-                            return data_set_type{ file_name, args["file_format"].cast<plssvm::file_format_type>() };
+                            return data_set_type{ file_name, args["file_format"].cast<plssvm::file_format_type>(), subset };
                         } else if (args.contains("scaling")) {
-                            return data_set_type{ file_name, create_scaling_object<data_set_type>(args) };
+                            return data_set_type{ file_name, plssvm::csv_options{}, subset, create_scaling_object<data_set_type>(args) };
                         } else {
-                            return data_set_type{ file_name };
+                            return data_set_type{ file_name, plssvm::csv_options{}, subset };
                         }
                     }),
                     "create a new data set from the provided file and additional optional parameters");
@@ -250,6 +266,35 @@ void instantiate_data_set_bindings(py::module_ &m) {
 }
 
 void init_data_set(py::module_ &m) {
+    // bind the settings of the cache storing the parsed content of text data set files
+    py::class_<plssvm::data_set_cache_options>(m, "DataSetCacheOptions")
+        .def(py::init([](const bool enabled, const std::string &directory, const std::uintmax_t max_size, const bool fingerprint) {
+                 return plssvm::data_set_cache_options{ enabled, directory, max_size, fingerprint };
+             }),
+             "create new data set cache options; an empty directory means the per-user directory '$XDG_CACHE_HOME/plssvm/data_set_cache' (or '~/.cache/plssvm/data_set_cache')",
+             py::arg("enabled") = true,
+             py::arg("directory") = std::string{},
+             py::arg("max_size") = plssvm::data_set_cache_options{}.max_size,
+             py::arg("fingerprint") = false)
+        .def_readwrite("enabled", &plssvm::data_set_cache_options::enabled, "true if the data set cache should be used")
+        .def_property(
+            "directory", [](const plssvm::data_set_cache_options &self) { return self.directory.string(); }, [](plssvm::data_set_cache_options &self, const std::string &directory) { self.directory = directory; }, "the directory containing the cached binary images")
+        .def_readwrite("max_size", &plssvm::data_set_cache_options::max_size, "the maximum total size (in bytes) of all cached binary images, 0 means no limit")
+        .def_readwrite("fingerprint", &plssvm::data_set_cache_options::fingerprint, "true if a sampled sha256 fingerprint of the file content should additionally identify a cache entry")
+        .def("__repr__", [](const plssvm::data_set_cache_options &self) {
+            return fmt::format("<plssvm.DataSetCacheOptions with {{ enabled: {}, directory: '{}', max_size: {}, fingerprint: {} }}>",
+                               self.enabled,
+                               plssvm::detail::io::data_set_cache_directory(self).string(),
+                               self.max_size,
+                               self.fingerprint);
+        });
+
+    // get or set the data set cache used when reading data sets from files
+    m.def(
+        "get_data_set_cache", []() { return plssvm::data_set_cache; }, "get the currently used data set cache settings");
+    m.def(
+        "set_data_set_cache", [](const plssvm::data_set_cache_options &options) { plssvm::data_set_cache = options; }, "set the data set cache settings used when reading text data set files");
+
     // bind all data_set classes
     instantiate_data_set_bindings<plssvm::detail::real_type_label_type_combination_list>(m);
 
@@ -18,6 +18,7 @@ void init_exceptions(py::module_ &m, const py::exception<plssvm::exception> &bas
     // register all basic PLSSVM exceptions
     register_py_exception<plssvm::invalid_parameter_exception>(m, "InvalidParameterError", base_exception);
     register_py_exception<plssvm::file_reader_exception>(m, "FileReaderError", base_exception);
+    register_py_exception<plssvm::file_exception>(m, "FileError", base_exception);
     register_py_exception<plssvm::data_set_exception>(m, "DataSetError", base_exception);
     register_py_exception<plssvm::file_not_found_exception>(m, "FileNotFoundError", base_exception);
     register_py_exception<plssvm::invalid_file_format_exception>(m, "InvalidFileFormatError", base_exception);
@@ -8,7 +8,19 @@
 
 #include "plssvm/file_format_types.hpp"
 
-#include "pybind11/pybind11.h"  // py::module_, py::enum_
+#include "plssvm/detail/io/data_set_subset.hpp"  // plssvm::detail::io::format_feature_selection
+#include "plssvm/sampling_types.hpp"             // plssvm::sampling_type
+
+#include "fmt/core.h"                            // fmt::format
+#include "fmt/ostream.h"                         // directly output objects with operator<< overload via fmt
+#include "pybind11/pybind11.h"                   // py::module_, py::enum_, py::class_, py::init, py::arg
+#include "pybind11/stl.h"                        // support for STL types (std::optional, std::vector)
+
+#include <cstddef>                               // std::size_t
+#include <optional>                              // std::optional
+#include <string>                                // std::string, std::to_string
+#include <utility>                               // std::move
+#include <vector>                                // std::vector
 
 namespace py = pybind11;
 
@@ -16,5 +28,51 @@ void init_file_format_types(py::module_ &m) {
     // bind enum class
     py::enum_<plssvm::file_format_type>(m, "FileFormatType")
         .value("LIBSVM", plssvm::file_format_type::libsvm, "the LIBSVM file format (default); for the file format specification see: https://www.csie.ntu.edu.tw/~cjlin/libsvm/faq.html")
-        .value("ARFF", plssvm::file_format_type::arff, "the ARFF file format; for the file format specification see: https://www.cs.waikato.ac.nz/~ml/weka/arff.html");
-}
\ No newline at end of file
+        .value("ARFF", plssvm::file_format_type::arff, "the ARFF file format; for the file format specification see: https://www.cs.waikato.ac.nz/~ml/weka/arff.html")
+        .value("BINARY", plssvm::file_format_type::binary, "the memory-mappable PLSSVM binary file format; loading it doesn't require any text parsing")
+        .value("CSV", plssvm::file_format_type::csv, "the dense CSV file format; the last column contains the labels by default")
+        .value("NPY", plssvm::file_format_type::npy, "the NumPy .npy file format storing a two-dimensional array; loading it doesn't require any text parsing");
+
+    // bind the options used to read CSV (and NumPy) files
+    py::class_<plssvm::csv_options>(m, "CSVOptions")
+        .def(py::init([](const char delimiter, const bool has_header, const std::optional<long long> label_column) {
+                 return plssvm::csv_options{ delimiter, has_header, label_column };
+             }),
+             "create new CSV options; a label_column of None means that the file contains no labels",
+             py::arg("delimiter") = ',',
+             py::arg("has_header") = false,
+             py::arg("label_column") = std::optional<long long>{ -1 })
+        .def_readwrite("delimiter", &plssvm::csv_options::delimiter, "the character separating two values in a line")
+        .def_readwrite("has_header", &plssvm::csv_options::has_header, "true if the first line of the file is a header that must be skipped")
+        .def_readwrite("label_column", &plssvm::csv_options::label_column, "the column containing the labels (negative values count from the back), None if the file contains no labels")
+        .def("__repr__", [](const plssvm::csv_options &self) {
+            return fmt::format("<plssvm.CSVOptions with {{ delimiter: '{}', has_header: {}, label_column: {} }}>",
+                               self.delimiter,
+                               self.has_header,
+                               self.label_column.has_value() ? std::to_string(self.label_column.value()) : std::string{ "None" });
+        });
+
+    // bind the sampling strategies used to read only a subset of the data points
+    py::enum_<plssvm::sampling_type>(m, "SamplingType")
+        .value("UNIFORM", plssvm::sampling_type::uniform, "draw the data points uniformly at random (default)")
+        .value("STRATIFIED", plssvm::sampling_type::stratified, "draw the data points per class such that the sample has the same class distribution as the whole data set");
+
+    // bind the options used to read only a subset of the features and data points
+    py::class_<plssvm::subset_options>(m, "SubsetOptions")
+        .def(py::init([](std::vector<std::size_t> features, const std::size_t num_samples, const plssvm::sampling_type sampling) {
+                 return plssvm::subset_options{ std::move(features), num_samples, sampling };
+             }),
+             "create new subset options; an empty list of features keeps all features and a num_samples of 0 keeps all data points",
+             py::arg("features") = std::vector<std::size_t>{},
+             py::arg("num_samples") = std::size_t{ 0 },
+             py::arg("sampling") = plssvm::sampling_type::uniform)
+        .def_readwrite("features", &plssvm::subset_options::features, "the zero-based indices of the features to keep, e.g., list(range(10)); empty to keep all features")
+        .def_readwrite("num_samples", &plssvm::subset_options::num_samples, "the number of randomly sampled data points to keep; 0 to keep all data points")
+        .def_readwrite("sampling", &plssvm::subset_options::sampling, "the strategy used to draw the sample of the data points")
+        .def("__repr__", [](const plssvm::subset_options &self) {
+            return fmt::format("<plssvm.SubsetOptions with {{ features: [{}], num_samples: {}, sampling: {} }}>",
+                               plssvm::detail::io::format_feature_selection(self.features),
+                               self.num_samples,
+                               self.sampling);
+        });
+}
@@ -0,0 +1,48 @@
+## Authors: Alexander Van Craen, Marcel Breyer
+## Copyright (C): 2018-today The PLSSVM project - All Rights Reserved
+## License: This file is part of the PLSSVM project which is released under the MIT license.
+##          See the LICENSE.md file in the project root for full license information.
+##
+## Finds the zstd library and creates the imported target zstd::zstd.
+## Also installed together with the plssvm config files such that the exported targets can link against zstd::zstd.
+########################################################################################################################
+
+# check if the include directory or library is given using an environment variable
+if (DEFINED ENV{zstd_INCLUDE_DIR} AND NOT EXISTS "${zstd_INCLUDE_DIR}")
+    set(zstd_INCLUDE_DIR $ENV{zstd_INCLUDE_DIR})
+endif ()
+if (DEFINED ENV{zstd_LIBRARY} AND NOT EXISTS "${zstd_LIBRARY}")
+    set(zstd_LIBRARY $ENV{zstd_LIBRARY})
+endif ()
+
+# try to automatically find the header files and library in the standard directories
+find_path(zstd_INCLUDE_DIR
+        NAMES zstd.h
+        DOC "zstd header files"
+        )
+find_library(zstd_LIBRARY
+        NAMES zstd
+        DOC "zstd library"
+        )
+
+# extract the version from the header file
+if (EXISTS "${zstd_INCLUDE_DIR}/zstd.h")
+    file(STRINGS "${zstd_INCLUDE_DIR}/zstd.h" zstd_VERSION_DEFINES REGEX "^#define ZSTD_VERSION_(MAJOR|MINOR|RELEASE) +[0-9]+")
+    foreach (zstd_VERSION_PART MAJOR MINOR RELEASE)
+        string(REGEX REPLACE ".*ZSTD_VERSION_${zstd_VERSION_PART} +([0-9]+).*" "\\1" zstd_VERSION_${zstd_VERSION_PART} "${zstd_VERSION_DEFINES}")
+    endforeach ()
+    set(zstd_VERSION "${zstd_VERSION_MAJOR}.${zstd_VERSION_MINOR}.${zstd_VERSION_RELEASE}")
+endif ()
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(zstd REQUIRED_VARS zstd_LIBRARY zstd_INCLUDE_DIR VERSION_VAR zstd_VERSION)
+mark_as_advanced(zstd_INCLUDE_DIR zstd_LIBRARY)
+
+# create the imported target
+if (zstd_FOUND AND NOT TARGET zstd::zstd)
+    add_library(zstd::zstd UNKNOWN IMPORTED)
+    set_target_properties(zstd::zstd PROPERTIES
+            IMPORTED_LOCATION "${zstd_LIBRARY}"
+            INTERFACE_INCLUDE_DIRECTORIES "${zstd_INCLUDE_DIR}"
+            )
+endif ()
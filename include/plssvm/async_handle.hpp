@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a future-like handle to a training or prediction running in the background.
+ */
+
+#ifndef PLSSVM_ASYNC_HANDLE_HPP_
+#define PLSSVM_ASYNC_HANDLE_HPP_
+#pragma once
+
+#include "plssvm/cancellation_token.hpp"  // plssvm::cancellation_token
+
+#include <chrono>                          // std::chrono::{duration, seconds}
+#include <future>                          // std::future, std::future_status
+#include <utility>                         // std::move
+
+namespace plssvm {
+
+/**
+ * @brief A handle to an operation running in the background (returned by plssvm::csvm::fit_async and plssvm::csvm::predict_async).
+ * @details Behaves like a [`std::future`](https://en.cppreference.com/w/cpp/thread/future) that can additionally be cancelled.
+ *          As with a future created by `std::async`, the destructor blocks until the operation has finished.
+ * @tparam T the type of the result
+ */
+template <typename T>
+class async_handle {
+  public:
+    /// The type of the result.
+    using value_type = T;
+
+    /**
+     * @brief Create a handle to the operation whose result is provided by @p future and that observes the cancellation @p token.
+     * @param[in] future the future providing the result of the operation
+     * @param[in] token the token observed by the operation
+     */
+    async_handle(std::future<value_type> future, cancellation_token token) :
+        future_{ std::move(future) },
+        token_{ std::move(token) } {}
+
+    /**
+     * @brief Request the cancellation of the operation.
+     * @details Returns immediately. How fast and with which result the operation stops depends on the operation, e.g.,
+     *          a training stops after the current CG iteration and returns a model using the current iterate.
+     */
+    void cancel() const noexcept { token_.request_cancellation(); }
+    /**
+     * @brief Check whether the cancellation of the operation has been requested.
+     * @return `true` if the cancellation has been requested, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool cancellation_requested() const noexcept { return token_.cancellation_requested(); }
+    /**
+     * @brief Return the cancellation token observed by the operation, e.g., to cancel it together with other operations.
+     * @return the cancellation token (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const cancellation_token &token() const noexcept { return token_; }
+
+    /**
+     * @brief Check whether the handle still refers to a result, i.e., plssvm::async_handle::get hasn't been called yet.
+     * @return `true` if the handle refers to a result, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool valid() const noexcept { return future_.valid(); }
+    /**
+     * @brief Check whether the operation has finished without blocking.
+     * @return `true` if the result is available, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool ready() const { return future_.wait_for(std::chrono::seconds{ 0 }) == std::future_status::ready; }
+    /**
+     * @brief Block until the operation has finished.
+     */
+    void wait() const { future_.wait(); }
+    /**
+     * @brief Block until the operation has finished or @p timeout has elapsed.
+     * @tparam Rep the arithmetic type representing the number of ticks
+     * @tparam Period the tick period
+     * @param[in] timeout the maximum time to block
+     * @return the status of the operation (`[[nodiscard]]`)
+     */
+    template <typename Rep, typename Period>
+    [[nodiscard]] std::future_status wait_for(const std::chrono::duration<Rep, Period> &timeout) const { return future_.wait_for(timeout); }
+    /**
+     * @brief Block until the operation has finished and return its result.
+     * @details Rethrows the exception thrown by the operation (if any). Afterward, the handle is no longer valid.
+     * @return the result of the operation (`[[nodiscard]]`)
+     */
+    [[nodiscard]] value_type get() { return future_.get(); }
+
+  private:
+    /// The future providing the result of the operation.
+    std::future<value_type> future_;
+    /// The token observed by the operation.
+    cancellation_token token_;
+};
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_ASYNC_HANDLE_HPP_
@@ -39,7 +39,7 @@ enum class backend_type {
     /** [OpenCL](https://www.khronos.org/opencl/) to target CPUs and GPUs from different vendors. */
     opencl,
     /** [SYCL](https://www.khronos.org/sycl/) to target CPUs and GPUs from different vendors. Currently tested SYCL implementations are [DPC++](https://github.com/intel/llvm) and [hipSYCL](https://github.com/illuhad/hipSYCL). */
-    sycl
+    sycl,
     /** [HPX](https://hpx.stellar-group.org/) to target CPUs only (currently no HPX gpu backend support). */
     hpx,
 };
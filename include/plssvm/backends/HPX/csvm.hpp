@@ -13,14 +13,15 @@
 #define PLSSVM_BACKENDS_HPX_CSVM_HPP_
 #pragma once
 
-#include "plssvm/csvm.hpp"                // plssvm::csvm
-#include "plssvm/detail/type_traits.hpp"  // PLSSVM_REQUIRES
-#include "plssvm/parameter.hpp"           // plssvm::parameter, plssvm::detail::{parameter, has_only_parameter_named_args_v}
-#include "plssvm/target_platforms.hpp"    // plssvm::target_platform
+#include "plssvm/csvm.hpp"                  // plssvm::csvm
+#include "plssvm/detail/solve_options.hpp"  // plssvm::detail::solve_options
+#include "plssvm/detail/type_traits.hpp"    // PLSSVM_REQUIRES
+#include "plssvm/parameter.hpp"             // plssvm::parameter, plssvm::detail::{parameter, has_only_parameter_named_args_v}
+#include "plssvm/target_platforms.hpp"      // plssvm::target_platform
 
-#include <type_traits>                    // std::true_type
-#include <utility>                        // std::forward, std::pair
-#include <vector>                         // std::vector
+#include <type_traits>                      // std::true_type
+#include <utility>                          // std::forward, std::pair
+#include <vector>                           // std::vector
 
 namespace plssvm {
 
@@ -101,16 +102,16 @@ class csvm : public ::plssvm::csvm {
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const detail::solve_options<float> &options) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter, options); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const detail::solve_options<double> &options) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter, options); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
     template <typename real_type>
-    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter) const;
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter, const detail::solve_options<real_type> &options) const;
 
     /**
      * @copydoc plssvm::csvm::predict_values
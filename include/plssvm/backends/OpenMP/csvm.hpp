@@ -13,14 +13,19 @@
 #define PLSSVM_BACKENDS_OPENMP_CSVM_HPP_
 #pragma once
 
-#include "plssvm/csvm.hpp"                // plssvm::csvm
-#include "plssvm/detail/type_traits.hpp"  // PLSSVM_REQUIRES
-#include "plssvm/parameter.hpp"           // plssvm::parameter, plssvm::detail::{parameter, has_only_parameter_named_args_v}
-#include "plssvm/target_platforms.hpp"    // plssvm::target_platform
+#include "plssvm/backends/OpenMP/hodlr_matrix.hpp"          // plssvm::openmp::hodlr_matrix
+#include "plssvm/backends/OpenMP/sparse_kernel_matrix.hpp"  // plssvm::openmp::sparse_kernel_matrix
+#include "plssvm/csvm.hpp"                                  // plssvm::csvm
+#include "plssvm/detail/solve_options.hpp"                  // plssvm::detail::solve_options
+#include "plssvm/detail/type_traits.hpp"                    // PLSSVM_REQUIRES
+#include "plssvm/parameter.hpp"                             // plssvm::parameter, plssvm::hodlr_tolerance, plssvm::rbf_cutoff, plssvm::detail::{parameter, has_only_openmp_parameter_named_args_v, get_value_from_named_parameter}
+#include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
 
-#include <type_traits>                    // std::true_type
-#include <utility>                        // std::forward, std::pair
-#include <vector>                         // std::vector
+#include "igor/igor.hpp"                                    // igor::parser
+
+#include <type_traits>                                      // std::true_type
+#include <utility>                                          // std::forward, std::pair
+#include <vector>                                           // std::vector
 
 namespace plssvm {
 
@@ -55,13 +60,13 @@ class csvm : public ::plssvm::csvm {
      * @throws plssvm::exception all exceptions thrown in the base class constructor
      * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
      * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::invalid_parameter_exception if the provided `hodlr_tolerance` is negative
+     * @throws plssvm::invalid_parameter_exception if the provided `rbf_cutoff` isn't in the range [0.0, 1.0)
+     * @throws plssvm::invalid_parameter_exception if both, `hodlr_tolerance` and `rbf_cutoff`, are enabled
      */
-    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_parameter_named_args_v<Args...>)>
+    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_openmp_parameter_named_args_v<Args...>)>
     explicit csvm(Args &&...named_args) :
-        ::plssvm::csvm{ std::forward<Args>(named_args)... } {
-        // the default target is the automatic one
-        this->init(plssvm::target_platform::automatic);
-    }
+        csvm{ plssvm::target_platform::automatic, std::forward<Args>(named_args)... } {}
     /**
      * @brief Construct a new C-SVM using the OpenMP backend on the @p target platform and the optionally provided @p named_args.
      * @param[in] target the target platform used for this C-SVM
@@ -69,10 +74,52 @@ class csvm : public ::plssvm::csvm {
      * @throws plssvm::exception all exceptions thrown in the base class constructor
      * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
      * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::invalid_parameter_exception if the provided `hodlr_tolerance` is negative
+     * @throws plssvm::invalid_parameter_exception if the provided `rbf_cutoff` isn't in the range [0.0, 1.0)
+     * @throws plssvm::invalid_parameter_exception if both, `hodlr_tolerance` and `rbf_cutoff`, are enabled
      */
-    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_parameter_named_args_v<Args...>)>
+    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_openmp_parameter_named_args_v<Args...>)>
     explicit csvm(const target_platform target, Args &&...named_args) :
-        ::plssvm::csvm{ std::forward<Args>(named_args)... } {
+        ::plssvm::csvm{ named_args... } {
+        // check igor parameter
+        igor::parser parser{ std::forward<Args>(named_args)... };
+
+        // check whether the kernel matrix should be compressed using a HODLR approximation
+        if constexpr (parser.has(hodlr_tolerance)) {
+            hodlr_tolerance_ = detail::get_value_from_named_parameter<double>(parser, hodlr_tolerance);
+        }
+        // check whether the rbf kernel matrix should be truncated
+        if constexpr (parser.has(rbf_cutoff)) {
+            rbf_cutoff_ = detail::get_value_from_named_parameter<double>(parser, rbf_cutoff);
+        }
+        this->init(target);
+    }
+    /**
+     * @brief Construct a new C-SVM using the OpenMP backend on the @p target platform with the parameters given through @p params and the OpenMP specific @p named_args.
+     * @param[in] target the target platform used for this C-SVM
+     * @param[in] params struct encapsulating all possible SVM parameters
+     * @param[in] named_args the OpenMP specific named-parameters, i.e., `hodlr_tolerance` and `rbf_cutoff`
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::invalid_parameter_exception if the provided `hodlr_tolerance` is negative
+     * @throws plssvm::invalid_parameter_exception if the provided `rbf_cutoff` isn't in the range [0.0, 1.0)
+     * @throws plssvm::invalid_parameter_exception if both, `hodlr_tolerance` and `rbf_cutoff`, are enabled
+     */
+    template <typename... Args, PLSSVM_REQUIRES((sizeof...(Args) > 0 && !igor::has_other_than<Args...>(plssvm::hodlr_tolerance, plssvm::rbf_cutoff)))>
+    csvm(const target_platform target, parameter params, Args &&...named_args) :
+        ::plssvm::csvm{ params } {
+        // check igor parameter
+        igor::parser parser{ std::forward<Args>(named_args)... };
+
+        // check whether the kernel matrix should be compressed using a HODLR approximation
+        if constexpr (parser.has(hodlr_tolerance)) {
+            hodlr_tolerance_ = detail::get_value_from_named_parameter<double>(parser, hodlr_tolerance);
+        }
+        // check whether the rbf kernel matrix should be truncated
+        if constexpr (parser.has(rbf_cutoff)) {
+            rbf_cutoff_ = detail::get_value_from_named_parameter<double>(parser, rbf_cutoff);
+        }
         this->init(target);
     }
 
@@ -97,20 +144,53 @@ class csvm : public ::plssvm::csvm {
      */
      ~csvm() override = default;
 
+    /**
+     * @brief Return the relative tolerance used to compress the kernel matrix in the CG algorithm using a HODLR approximation.
+     * @details A tolerance of `0.0` means that the dense kernel matrix is used.
+     * @return the HODLR tolerance (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double get_hodlr_tolerance() const noexcept { return hodlr_tolerance_; }
+    /**
+     * @brief Return the value below which the rbf kernel matrix entries are truncated in the CG algorithm.
+     * @details A cutoff of `0.0` means that the dense kernel matrix is used.
+     * @return the rbf cutoff (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double get_rbf_cutoff() const noexcept { return rbf_cutoff_; }
+
   protected:
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const detail::solve_options<float> &options) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter, options); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const detail::solve_options<double> &options) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter, options); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
     template <typename real_type>
-    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter) const;
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter, const detail::solve_options<real_type> &options) const;
+
+    /**
+     * @copydoc plssvm::csvm::solve_system_of_linear_equations_cost_path
+     */
+    [[nodiscard]] std::vector<std::pair<std::vector<float>, float>> solve_system_of_linear_equations_cost_path(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, const std::vector<float> &b, const std::vector<float> &cost_values, float eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_cost_path_impl(params, A, b, cost_values, eps, max_iter); }
+    /**
+     * @copydoc plssvm::csvm::solve_system_of_linear_equations_cost_path
+     */
+    [[nodiscard]] std::vector<std::pair<std::vector<double>, double>> solve_system_of_linear_equations_cost_path(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, const std::vector<double> &b, const std::vector<double> &cost_values, double eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_cost_path_impl(params, A, b, cost_values, eps, max_iter); }
+    /**
+     * @brief Solves the equations \f$(A + \frac{1}{C_i} M)x_i = b\f$ for all `cost` values \f$C_i\f$ in @p cost_values using a multi-shift preconditioned CG algorithm.
+     * @details Since \f$M\f$ is the same for all `cost` values, the preconditioned systems only differ by a multiple of the identity matrix and, therefore, share the same Krylov subspace.
+     *          Only the system with the largest `cost` value (the slowest converging one) is explicitly iterated; the solutions of all other systems are updated
+     *          using scalar recurrences (see [Jegerlehner](https://arxiv.org/abs/hep-lat/9612014)). As a result, only a single matrix-vector multiplication per iteration is necessary
+     *          regardless of the number of `cost` values. All systems start with \f$x_i = 0\f$. The dense kernel matrix is always used.
+     * @copydetails plssvm::csvm::solve_system_of_linear_equations_cost_path
+     * @throws plssvm::invalid_parameter_exception if a HODLR tolerance or a rbf cutoff has been set
+     */
+    template <typename real_type>
+    [[nodiscard]] std::vector<std::pair<std::vector<real_type>, real_type>> solve_system_of_linear_equations_cost_path_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const std::vector<real_type> &cost_values, real_type eps, unsigned long long max_iter) const;
 
     /**
      * @copydoc plssvm::csvm::predict_values
@@ -155,9 +235,11 @@ class csvm : public ::plssvm::csvm {
      * @param[in] data the data points
      * @param[in] QA_cost a value used in the dimensional reduction
      * @param[in] add denotes whether the values are added or subtracted from the result vector
+     * @param[in] compressed if not `nullptr`, the HODLR approximation of the kernel matrix used instead of the dense kernel matrix
+     * @param[in] truncated if not `nullptr`, the truncated rbf kernel matrix used instead of the dense kernel matrix
      */
     template <typename real_type>
-    void run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type add) const;
+    void run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type add, const hodlr_matrix<real_type> *compressed = nullptr, const sparse_kernel_matrix<real_type> *truncated = nullptr) const;
 
   private:
     /**
@@ -165,8 +247,16 @@ class csvm : public ::plssvm::csvm {
      * @param[in] target the target platform to use
      * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
      * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::invalid_parameter_exception if the HODLR tolerance is negative
+     * @throws plssvm::invalid_parameter_exception if the rbf cutoff isn't in the range [0.0, 1.0)
+     * @throws plssvm::invalid_parameter_exception if both, the HODLR approximation and the rbf truncation, are enabled
      */
     void init(target_platform target);
+
+    /// The relative tolerance used to compress the kernel matrix using a HODLR approximation; `0.0` means that the dense kernel matrix is used.
+    double hodlr_tolerance_{ 0.0 };
+    /// The value below which rbf kernel matrix entries are truncated; `0.0` means that the dense kernel matrix is used.
+    double rbf_cutoff_{ 0.0 };
 };
 
 }  // namespace openmp
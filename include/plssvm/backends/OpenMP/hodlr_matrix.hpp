@@ -0,0 +1,147 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a hierarchically off-diagonal low-rank (HODLR) approximation of the kernel matrix used in the OpenMP backend.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_HODLR_MATRIX_HPP_
+#define PLSSVM_BACKENDS_OPENMP_HODLR_MATRIX_HPP_
+#pragma once
+
+#include "plssvm/parameter.hpp"  // plssvm::detail::parameter
+
+#include <cstddef>               // std::size_t
+#include <type_traits>           // std::is_same_v
+#include <vector>                // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief A hierarchically off-diagonal low-rank (HODLR) approximation of the kernel matrix \f$K_{ij} = k(x_i, x_j)\f$ of the first `num_data_points - 1` data points.
+ * @details The data points are recursively bisected at the median of the feature with the largest spread, resulting in a binary cluster tree.
+ *          The off-diagonal blocks between two sibling clusters are compressed using an adaptive cross approximation (ACA) with partial pivoting
+ *          up to the requested relative tolerance, whereas the diagonal blocks of the leaf clusters are stored densely.
+ *          If any off-diagonal block can't be compressed to at most half of its full rank, the approximation is discarded and
+ *          plssvm::openmp::hodlr_matrix::is_compressed() returns `false`, i.e., the dense kernel matrix should be used instead.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class hodlr_matrix {
+    // only float and doubles are allowed
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Build the HODLR approximation of the kernel matrix given by @p params and the first `data.size() - 1` data points in @p data.
+     * @param[in] params the SVM parameter (e.g., the kernel function)
+     * @param[in] data the data points
+     * @param[in] tolerance the relative tolerance used to compress the off-diagonal blocks
+     * @param[in] leaf_size the maximum number of data points in a leaf cluster
+     */
+    hodlr_matrix(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, real_type tolerance, size_type leaf_size = 256);
+
+    /**
+     * @brief Calculate `ret += add * A * d` where `A` is the reduced kernel matrix used in the CG algorithm (see plssvm::openmp::device_kernel_rbf).
+     * @details The kernel matrix part is approximated using the HODLR representation, the dimensional reduction terms are added exactly.
+     * @param[in] q the `q` vector
+     * @param[in,out] ret the result vector
+     * @param[in] d the right-hand side of the equation
+     * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+     * @param[in] cost 1 / the cost parameter in the C-SVM
+     * @param[in] add denotes whether the values are added or subtracted from the result vector
+     */
+    void multiply(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, real_type QA_cost, real_type cost, real_type add) const;
+
+    /**
+     * @brief Return whether all off-diagonal blocks could be compressed, i.e., whether this approximation should be used instead of the dense kernel matrix.
+     * @return `true` if the kernel matrix has been compressed, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool is_compressed() const noexcept { return compressed_; }
+    /**
+     * @brief Return the number of rows (and columns) of the approximated kernel matrix.
+     * @return the number of rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_rows() const noexcept { return permutation_.size(); }
+    /**
+     * @brief Return the largest rank of all compressed off-diagonal blocks.
+     * @return the maximum rank (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type max_rank() const noexcept { return max_rank_; }
+    /**
+     * @brief Return the number of matrix entries stored in the HODLR representation compared to the number of entries of the dense kernel matrix.
+     * @return the memory ratio (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double memory_ratio() const noexcept;
+
+  private:
+    /**
+     * @brief A node in the cluster tree representing the data points `permutation_[begin, end)`.
+     */
+    struct node {
+        /// The first index (in the permuted order) belonging to this cluster.
+        size_type begin{ 0 };
+        /// One past the last index (in the permuted order) belonging to this cluster.
+        size_type end{ 0 };
+        /// The index of the left child (0 for leaf clusters since the root can never be a child).
+        size_type left{ 0 };
+        /// The index of the right child (0 for leaf clusters since the root can never be a child).
+        size_type right{ 0 };
+        /// The rank of the off-diagonal block between the left and right child.
+        size_type rank{ 0 };
+        /// For leaves the dense diagonal block, otherwise the column-wise stored low-rank factor \f$U\f$ of the off-diagonal block \f$K_{LR} \approx U V^T\f$.
+        std::vector<real_type> u{};
+        /// The column-wise stored low-rank factor \f$V\f$ of the off-diagonal block \f$K_{LR} \approx U V^T\f$ (empty for leaves).
+        std::vector<real_type> v{};
+
+        /**
+         * @brief Check whether this node is a leaf cluster.
+         * @return `true` if the node is a leaf, otherwise `false` (`[[nodiscard]]`)
+         */
+        [[nodiscard]] bool is_leaf() const noexcept { return left == 0; }
+    };
+
+    /**
+     * @brief Recursively bisect the data points of the cluster @p node_idx until each leaf contains at most @p leaf_size data points.
+     * @param[in] data the data points
+     * @param[in] node_idx the cluster to split
+     * @param[in] level the level of the cluster in the tree
+     * @param[in] leaf_size the maximum number of data points in a leaf cluster
+     */
+    void build_cluster_tree(const std::vector<std::vector<real_type>> &data, size_type node_idx, size_type level, size_type leaf_size);
+    /**
+     * @brief Compress the off-diagonal block between the children of @p n using an adaptive cross approximation with partial pivoting.
+     * @param[in] data the data points
+     * @param[in,out] n the cluster whose off-diagonal block should be compressed
+     * @return `true` if the block could be compressed to the requested tolerance, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool compress(const std::vector<std::vector<real_type>> &data, node &n) const;
+
+    /// The SVM parameter used to evaluate the kernel function.
+    detail::parameter<real_type> params_;
+    /// The relative tolerance of the off-diagonal blocks.
+    real_type tolerance_;
+    /// The permutation of the data points induced by the cluster tree.
+    std::vector<size_type> permutation_{};
+    /// All nodes of the cluster tree; the root is always the first node.
+    std::vector<node> nodes_{};
+    /// The node indices grouped by their level in the cluster tree; all nodes on the same level represent disjoint clusters.
+    std::vector<std::vector<size_type>> levels_{};
+    /// `true` if the kernel matrix could be compressed.
+    bool compressed_{ false };
+    /// The largest rank of all off-diagonal blocks.
+    size_type max_rank_{ 0 };
+};
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_HODLR_MATRIX_HPP_
@@ -0,0 +1,141 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a truncated, block sparse representation of the rbf kernel matrix used in the OpenMP backend.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_SPARSE_KERNEL_MATRIX_HPP_
+#define PLSSVM_BACKENDS_OPENMP_SPARSE_KERNEL_MATRIX_HPP_
+#pragma once
+
+#include "plssvm/parameter.hpp"  // plssvm::detail::parameter
+
+#include <cstddef>               // std::size_t
+#include <type_traits>           // std::is_same_v
+#include <vector>                // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief A block sparse representation of the truncated rbf kernel matrix \f$K_{ij} = e^{-\gamma \cdot ||x_i - x_j||^2}\f$ of the first `num_data_points - 1` data points.
+ * @details The data points are reordered using a k-d tree, i.e., they are recursively bisected at the median of the feature with the largest spread until each tile
+ *          contains at most `tile_size` data points. A tile pair is only evaluated (and stored densely) if the distance between the bounding boxes of both tiles is
+ *          at most \f$r_c = \sqrt{-\ln(cutoff) / \gamma}\f$. Therefore, each dropped kernel matrix entry is guaranteed to be smaller than `cutoff`, i.e., the
+ *          error of each row of the matrix-vector product is bounded by `(num_data_points - 1) * cutoff * max|d_i|`.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class sparse_kernel_matrix {
+    // only float and doubles are allowed
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+  public:
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Build the truncated rbf kernel matrix given by @p params and the first `data.size() - 1` data points in @p data.
+     * @param[in] params the SVM parameter (the kernel function must be plssvm::kernel_function_type::rbf)
+     * @param[in] data the data points
+     * @param[in] cutoff the value below which kernel matrix entries may be dropped
+     * @param[in] tile_size the maximum number of data points in a tile
+     */
+    sparse_kernel_matrix(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, real_type cutoff, size_type tile_size = 64);
+
+    /**
+     * @brief Calculate `ret += add * A * d` where `A` is the reduced kernel matrix used in the CG algorithm (see plssvm::openmp::device_kernel_rbf).
+     * @details The kernel matrix part is calculated using the stored tiles only, the dimensional reduction terms are added exactly.
+     * @param[in] q the `q` vector
+     * @param[in,out] ret the result vector
+     * @param[in] d the right-hand side of the equation
+     * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+     * @param[in] cost 1 / the cost parameter in the C-SVM
+     * @param[in] add denotes whether the values are added or subtracted from the result vector
+     */
+    void multiply(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, real_type QA_cost, real_type cost, real_type add) const;
+
+    /**
+     * @brief Return the number of rows (and columns) of the truncated kernel matrix.
+     * @return the number of rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_rows() const noexcept { return permutation_.size(); }
+    /**
+     * @brief Return the number of tiles the data points have been split into.
+     * @return the number of tiles (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_tiles() const noexcept { return tiles_.size(); }
+    /**
+     * @brief Return the number of stored (i.e., not dropped) tile pairs.
+     * @return the number of stored tile pairs (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_blocks() const noexcept;
+    /**
+     * @brief Return the number of stored matrix entries compared to the number of entries of the dense kernel matrix.
+     * @return the density (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double density() const noexcept;
+    /**
+     * @brief Return an upper bound of the sum of all dropped kernel matrix entries for each row tile.
+     * @details The tiles are given in the order of the k-d tree.
+     * @return the dropped mass per tile (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<real_type> &dropped_mass() const noexcept { return dropped_mass_; }
+    /**
+     * @brief Return an upper bound of the sum of the dropped kernel matrix entries of a single row, i.e., the largest dropped mass of a tile divided by its number of rows.
+     * @return the largest dropped mass per row (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type max_dropped_row_mass() const noexcept;
+
+  private:
+    /**
+     * @brief A tile representing the data points `permutation_[begin, end)` and their bounding box.
+     */
+    struct tile {
+        /// The first index (in the permuted order) belonging to this tile.
+        size_type begin{ 0 };
+        /// One past the last index (in the permuted order) belonging to this tile.
+        size_type end{ 0 };
+        /// The smallest value of each feature of the data points in this tile.
+        std::vector<real_type> lower{};
+        /// The largest value of each feature of the data points in this tile.
+        std::vector<real_type> upper{};
+    };
+    /**
+     * @brief A densely stored kernel matrix block between a row and a column tile.
+     */
+    struct block {
+        /// The index of the column tile.
+        size_type col_tile{ 0 };
+        /// The row-wise stored kernel matrix entries.
+        std::vector<real_type> values{};
+    };
+
+    /**
+     * @brief Recursively bisect the data points `permutation_[begin, end)` until each tile contains at most @p tile_size data points.
+     * @param[in] data the data points
+     * @param[in] begin the first index of the current cluster
+     * @param[in] end one past the last index of the current cluster
+     * @param[in] tile_size the maximum number of data points in a tile
+     */
+    void build_tiles(const std::vector<std::vector<real_type>> &data, size_type begin, size_type end, size_type tile_size);
+
+    /// The permutation of the data points induced by the k-d tree.
+    std::vector<size_type> permutation_{};
+    /// All tiles in the order of the k-d tree.
+    std::vector<tile> tiles_{};
+    /// The stored kernel matrix blocks of each row tile.
+    std::vector<std::vector<block>> blocks_{};
+    /// An upper bound of the sum of all dropped kernel matrix entries per row tile.
+    std::vector<real_type> dropped_mass_{};
+};
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_SPARSE_KERNEL_MATRIX_HPP_
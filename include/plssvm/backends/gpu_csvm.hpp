@@ -15,22 +15,27 @@
 
 #include "plssvm/constants.hpp"                   // plssvm::{THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE}
 #include "plssvm/csvm.hpp"                        // plssvm::csvm
+#include "plssvm/detail/cg_checkpoint.hpp"        // plssvm::detail::cg_checkpoint
+#include "plssvm/detail/deflated_cg.hpp"          // plssvm::detail::deflated_cg
 #include "plssvm/detail/execution_range.hpp"      // plssvm::detail::execution_range
 #include "plssvm/detail/layout.hpp"               // plssvm::detail::{transform_to_layout, layout_type}
 #include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
 #include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
+#include "plssvm/detail/solve_options.hpp"        // plssvm::detail::solve_options
 #include "plssvm/parameter.hpp"                   // plssvm::parameter
+#include "plssvm/solver_types.hpp"                // plssvm::solver_type
 
 #include "fmt/chrono.h"                           // output std::chrono times using {fmt}
 #include "fmt/core.h"                             // fmt::format
 
-#include <algorithm>                              // std::min, std::all_of, std::adjacent_find
+#include <algorithm>                              // std::min, std::max, std::all_of, std::adjacent_find
 #include <chrono>                                 // std::chrono::{milliseconds, steady_clock, duration_cast}
 #include <cmath>                                  // std::ceil
 #include <cstddef>                                // std::size_t
 #include <functional>                             // std::less_equal
 #include <iostream>                               // std::clog, std::cout, std::endl
-#include <tuple>                                  // std::tuple, std::make_tuple
+#include <limits>                                 // std::numeric_limits
+#include <tuple>                                  // std::tuple, std::make_tuple, std::tie
 #include <utility>                                // std::forward, std::pair, std::move, std::make_pair
 #include <vector>                                 // std::vector
 
@@ -98,16 +103,16 @@ class gpu_csvm : public ::plssvm::csvm {
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const detail::solve_options<float> &options) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter, options); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const detail::solve_options<double> &options) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter, options); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
     template <typename real_type>
-    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter) const;
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter, const detail::solve_options<real_type> &options) const;
 
     /**
      * @copydoc plssvm::csvm::predict_values
@@ -480,7 +485,8 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
                                                                                                                     const std::vector<std::vector<real_type>> &A,
                                                                                                                     std::vector<real_type> b,
                                                                                                                     const real_type eps,
-                                                                                                                    const unsigned long long max_iter) const {
+                                                                                                                    const unsigned long long max_iter,
+                                                                                                                    const detail::solve_options<real_type> &options) const {
     PLSSVM_ASSERT(!A.empty(), "The data must not be empty!");
     PLSSVM_ASSERT(!A.front().empty(), "The data points must contain at least one feature!");
     PLSSVM_ASSERT(std::all_of(A.cbegin(), A.cend(), [&A](const std::vector<real_type> &data_point) { return data_point.size() == A.front().size(); }), "All data points must have the same number of features!");
@@ -512,7 +518,9 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
     b.pop_back();
     b -= b_back_value;
 
-    std::vector<real_type> x(dept, 1.0);
+    // start with the initial guess if provided, otherwise with all ones
+    PLSSVM_ASSERT(options.initial_guess.empty() || options.initial_guess.size() == dept, "The initial guess must contain {} values, but contains {}!", dept, options.initial_guess.size());
+    std::vector<real_type> x = options.initial_guess.empty() ? std::vector<real_type>(dept, real_type{ 1.0 }) : options.initial_guess;
     std::vector<device_ptr_type<real_type>> x_d(num_used_devices);
 
     std::vector<real_type> r(dept, 0.0);
@@ -543,7 +551,7 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
 
     // delta = r.T * r
     real_type delta = transposed{ r } * r;
-    const real_type delta0 = delta;
+    real_type delta0 = delta;
     std::vector<real_type> Ad(dept);
 
     std::vector<device_ptr_type<real_type>> Ad_d(num_used_devices);
@@ -564,37 +572,175 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
         average_iteration_time += iteration_duration;
     };
 
-    unsigned long long iter = 0;
-    for (; iter < max_iter; ++iter) {
-        detail::log(verbosity_level::full | verbosity_level::timing,
-                    "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
-        iteration_start_time = std::chrono::steady_clock::now();
-
-        // Ad = A * r (q = A * d)
-        #pragma omp parallel for default(none) shared(num_used_devices, devices_, Ad_d, r_d, q_d, data_d, feature_ranges, params) firstprivate(dept, QA_cost, boundary_size, num_features)
+    // result = A * vec (uses r_d as device buffer for vec)
+    const auto device_matrix_vector_product = [&](const std::vector<real_type> &vec, std::vector<real_type> &result) {
+        #pragma omp parallel for
         for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
             Ad_d[device].memset(0);
+            r_d[device].copy_to_device(vec, 0, dept);
             r_d[device].memset(0, dept);
 
             run_device_kernel(device, params, q_d[device], Ad_d[device], r_d[device], data_d[device], feature_ranges, QA_cost, real_type{ 1.0 }, dept, boundary_size);
         }
-        // update Ad (q)
-        device_reduction(Ad_d, Ad);
-
-        // (alpha = delta_new / (d^T * q))
-        const real_type alpha_cd = delta / (transposed{ d } * Ad);
+        device_reduction(Ad_d, result);
+    };
 
-        // (x = x + alpha * d)
-        x += alpha_cd * d;
+    if (!options.initial_guess.empty()) {
+        // measure the convergence of a warm start relative to the initial residual of a cold start, i.e., reach the same accuracy as a full training
+        std::vector<real_type> A_ones(dept);
+        device_matrix_vector_product(std::vector<real_type>(dept, real_type{ 1.0 }), A_ones);
+        const std::vector<real_type> r_cold = b - A_ones;
+        delta0 = transposed{ r_cold } * r_cold;
 
-        #pragma omp parallel for default(none) shared(num_used_devices, devices_, x, x_d) firstprivate(dept)
+        // r_d = d (r_d has been used as device buffer for the cold start residual)
+        #pragma omp parallel for default(none) shared(num_used_devices, devices_, r_d, d) firstprivate(dept)
         for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
-            x_d[device].copy_to_device(x, 0, dept);
+            r_d[device].copy_to_device(d, 0, dept);
+        }
+    }
+
+    unsigned long long iter = 0;
+    unsigned long long num_residual_replacements = 0;
+    if (options.solver == solver_type::cg) {
+        // optionally deflate the CG using the recycled deflation vectors of the solver state
+        detail::deflated_cg<real_type> deflation{ options.state, dept, device_matrix_vector_product };
+        if (deflation.is_deflated()) {
+            // x = x + W * (W^T * A * W)^-1 * W^T * r and update r accordingly
+            deflation.initial_guess(x, r);
+            delta = transposed{ r } * r;
+            d = r;
+            deflation.project(d, r);
+
+            // x_d = x and r_d = d (r_d has been used as device buffer while setting up the deflation)
+            #pragma omp parallel for default(none) shared(num_used_devices, devices_, x, x_d, r_d, d) firstprivate(dept)
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                x_d[device].copy_to_device(x, 0, dept);
+                r_d[device].copy_to_device(d, 0, dept);
+            }
         }
+        // optionally continue the CG from a previously written checkpoint
+        detail::cg_checkpoint<real_type> checkpointer{ options.checkpoint, params, A, b };
+        if (checkpointer.restore(x, r, d, delta, delta0, iter)) {
+            // x_d = x and r_d = d
+            #pragma omp parallel for default(none) shared(num_used_devices, devices_, x, x_d, r_d, d) firstprivate(dept)
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                x_d[device].copy_to_device(x, 0, dept);
+                r_d[device].copy_to_device(d, 0, dept);
+            }
+        }
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+
+            // Ad = A * r (q = A * d)
+            #pragma omp parallel for default(none) shared(num_used_devices, devices_, Ad_d, r_d, q_d, data_d, feature_ranges, params) firstprivate(dept, QA_cost, boundary_size, num_features)
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                Ad_d[device].memset(0);
+                r_d[device].memset(0, dept);
+
+                run_device_kernel(device, params, q_d[device], Ad_d[device], r_d[device], data_d[device], feature_ranges, QA_cost, real_type{ 1.0 }, dept, boundary_size);
+            }
+            // update Ad (q)
+            device_reduction(Ad_d, Ad);
+            deflation.record(d, Ad);
+
+            // (alpha = delta_new / (d^T * q))
+            const real_type alpha_cd = delta / (transposed{ d } * Ad);
+
+            // (x = x + alpha * d)
+            x += alpha_cd * d;
+
+            #pragma omp parallel for default(none) shared(num_used_devices, devices_, x, x_d) firstprivate(dept)
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                x_d[device].copy_to_device(x, 0, dept);
+            }
+
+            if (iter % 50 == 49) {
+                #pragma omp parallel for default(none) shared(devices_, r_d, b, q_d, x_d, params, data_d, feature_ranges) firstprivate(QA_cost, dept)
+                for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+                    if (device == 0) {
+                        // r = b
+                        r_d[device].copy_to_device(b, 0, dept);
+                    } else {
+                        // set r to 0
+                        r_d[device].memset(0);
+                    }
+                    // r -= A * x
+                    run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], feature_ranges, QA_cost, real_type{ -1.0 }, dept, boundary_size);
+                }
 
-        if (iter % 50 == 49) {
-            #pragma omp parallel for default(none) shared(devices_, r_d, b, q_d, x_d, params, data_d, feature_ranges) firstprivate(QA_cost, dept)
-            for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
+                device_reduction(r_d, r);
+            } else {
+                // r -= alpha_cd * Ad (r = r - alpha * q)
+                r -= alpha_cd * Ad;
+            }
+
+            // (delta = r^T * r)
+            const real_type delta_old = delta;
+            delta = transposed{ r } * r;
+            // report the progress and stop with the current iterate if the CG has been cancelled
+            if (options.monitor.report(iter + 1, max_iter, delta, delta0, eps)) {
+                output_iteration_duration();
+                break;
+            }
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                output_iteration_duration();
+                break;
+            }
+
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta / delta_old;
+            // d = beta * d + r
+            d = beta * d + r;
+            // d = d - W * (W^T * A * W)^-1 * (A * W)^T * r
+            deflation.project(d, r);
+            // asynchronously write a checkpoint every checkpoint interval iterations
+            checkpointer.write(iter + 1, x, r, d, delta, delta0);
+
+            // r_d = d
+            #pragma omp parallel for default(none) shared(num_used_devices, devices_, r_d, d) firstprivate(dept)
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                r_d[device].copy_to_device(d, 0, dept);
+            }
+
+            output_iteration_duration();
+        }
+        // update the deflation vectors for the next solve
+        deflation.update_state(std::min(iter + 1, max_iter));
+        // wait until the last checkpoint has been written
+        checkpointer.finish();
+    } else {
+        // single reduction CG (Chronopoulos and Gear): additionally carry w = A * r and s = A * d, such that each iteration
+        // needs only one matrix-vector product and the two inner products can be fused into a single reduction
+        const auto fused_inner_products = [dept](const std::vector<real_type> &r_vec, const std::vector<real_type> &w_vec) {
+            real_type rr{ 0.0 };
+            real_type wr{ 0.0 };
+            #pragma omp parallel for default(none) shared(r_vec, w_vec) firstprivate(dept) reduction(+ : rr, wr)
+            for (std::size_t i = 0; i < dept; ++i) {
+                rr += r_vec[i] * r_vec[i];
+                wr += w_vec[i] * r_vec[i];
+            }
+            return std::make_pair(rr, wr);
+        };
+
+        // w = A * r and s = A * d (with d = r)
+        std::vector<real_type> w(dept);
+        device_matrix_vector_product(r, w);
+        std::vector<real_type> s(w);
+        real_type mu{ 0.0 };
+        std::tie(delta, mu) = fused_inner_products(r, w);
+        real_type alpha_cd = delta / mu;
+
+        // the largest residual since the last residual replacement
+        real_type max_delta = delta;
+        // recompute r = b - A * x, s = A * d, and w = A * r to remove the rounding errors accumulated by the recurrences
+        const auto replace_residual = [&]() {
+            #pragma omp parallel for
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                x_d[device].copy_to_device(x, 0, dept);
                 if (device == 0) {
                     // r = b
                     r_d[device].copy_to_device(b, 0, dept);
@@ -605,34 +751,65 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
                 // r -= A * x
                 run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], feature_ranges, QA_cost, real_type{ -1.0 }, dept, boundary_size);
             }
-
             device_reduction(r_d, r);
-        } else {
-            // r -= alpha_cd * Ad (r = r - alpha * q)
-            r -= alpha_cd * Ad;
-        }
 
-        // (delta = r^T * r)
-        const real_type delta_old = delta;
-        delta = transposed{ r } * r;
-        // if we are exact enough stop CG iterations
-        if (delta <= eps * eps * delta0) {
-            output_iteration_duration();
-            break;
-        }
+            device_matrix_vector_product(d, s);
+            device_matrix_vector_product(r, w);
+            std::tie(delta, mu) = fused_inner_products(r, w);
+            max_delta = delta;
+            ++num_residual_replacements;
+        };
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+
+            // (x = x + alpha * d)
+            x += alpha_cd * d;
+            // (r = r - alpha * s)
+            r -= alpha_cd * s;
+
+            // w = A * r
+            device_matrix_vector_product(r, w);
+
+            // (delta = r^T * r, mu = w^T * r) in a single reduction
+            const real_type delta_old = delta;
+            std::tie(delta, mu) = fused_inner_products(r, w);
+
+            bool replaced = false;
+            if (delta <= eps * eps * delta0) {
+                // the recursively updated residual may have drifted from the true residual -> verify it before stopping
+                replace_residual();
+                replaced = true;
+                // if we are exact enough stop CG iterations
+                if (delta <= eps * eps * delta0) {
+                    output_iteration_duration();
+                    break;
+                }
+            } else if (delta < std::numeric_limits<real_type>::epsilon() * max_delta) {
+                // the residual norm decreased by more than sqrt(machine epsilon) since the last replacement
+                replace_residual();
+                replaced = true;
+            }
+            max_delta = std::max(max_delta, delta);
+            // report the progress and stop with the current iterate if the CG has been cancelled
+            if (options.monitor.report(iter + 1, max_iter, delta, delta0, eps)) {
+                output_iteration_duration();
+                break;
+            }
 
-        // (beta = delta_new / delta_old)
-        const real_type beta = delta / delta_old;
-        // d = beta * d + r
-        d = beta * d + r;
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta / delta_old;
+            // d = beta * d + r
+            d = beta * d + r;
+            // s = beta * s + w
+            s = beta * s + w;
+            // (alpha = delta_new / (d^T * A * d)); after a residual replacement the recurrence isn't valid, so calculate it explicitly
+            alpha_cd = replaced ? delta / (transposed{ d } * s) : delta / (mu - beta * delta / alpha_cd);
 
-        // r_d = d
-        #pragma omp parallel for default(none) shared(num_used_devices, devices_, r_d, d) firstprivate(dept)
-        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
-            r_d[device].copy_to_device(d, 0, dept);
+            output_iteration_duration();
         }
-
-        output_iteration_duration();
     }
     detail::log(verbosity_level::full | verbosity_level::timing,
                 "Finished after {}/{} iterations with a residuum of {} (target: {}) and an average iteration time of {}.\n",
@@ -641,7 +818,13 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
                 detail::tracking_entry{ "cg", "residuum", delta },
                 detail::tracking_entry{ "cg", "target_residuum", eps * eps * delta0 },
                 detail::tracking_entry{ "cg", "avg_iteration_time", average_iteration_time / std::min(iter + 1, max_iter) });
+    if (options.solver == solver_type::single_reduction_cg) {
+        detail::log(verbosity_level::full,
+                    "Replaced the recursively updated residual {} times.\n",
+                    detail::tracking_entry{ "cg", "residual_replacements", num_residual_replacements });
+    }
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "epsilon", eps }));
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "solver", options.solver }));
     detail::log(verbosity_level::libsvm,
                 "optimization finished, #iter = {}\n", std::min(iter + 1, max_iter));
 
@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a thread-safe token used to cancel a running training or prediction.
+ */
+
+#ifndef PLSSVM_CANCELLATION_TOKEN_HPP_
+#define PLSSVM_CANCELLATION_TOKEN_HPP_
+#pragma once
+
+#include <atomic>  // std::atomic
+#include <memory>  // std::shared_ptr, std::make_shared
+
+namespace plssvm {
+
+/**
+ * @brief A token used to request the cancellation of a running training (e.g., passed to plssvm::csvm::fit using the `cancellation` named parameter).
+ * @details All copies of a token share the same state, i.e., requesting the cancellation using one copy cancels all operations observing any copy.
+ *          Requesting and querying the cancellation is thread-safe.
+ */
+class cancellation_token {
+  public:
+    /**
+     * @brief Create a new token for which **no** cancellation has been requested yet.
+     */
+    cancellation_token() :
+        cancelled_{ std::make_shared<std::atomic<bool>>(false) } {}
+
+    /**
+     * @brief Request the cancellation of all operations observing this token.
+     */
+    void request_cancellation() const noexcept { cancelled_->store(true, std::memory_order_relaxed); }
+    /**
+     * @brief Check whether the cancellation has been requested.
+     * @return `true` if the cancellation has been requested, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool cancellation_requested() const noexcept { return cancelled_->load(std::memory_order_relaxed); }
+
+  private:
+    /// The cancellation state shared between all copies of this token.
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_CANCELLATION_TOKEN_HPP_
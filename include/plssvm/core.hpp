@@ -21,9 +21,19 @@
 
 #include "plssvm/data_set.hpp"                              // a data set used for training a C-SVM
 #include "plssvm/model.hpp"                                 // the model as a result of training a C-SVM
+#include "plssvm/grid_search.hpp"                           // a grid search over the gamma and cost SVM parameters
+#include "plssvm/cross_validation.hpp"                      // a k-fold cross-validation sharing the kernel matrix between all folds
+#include "plssvm/fixed_size_lssvm.hpp"                      // an approximate fixed-size LS-SVM using the Nyström method for very large data sets
+#include "plssvm/support_vector_reduction.hpp"              // a post-training reduction of the number of support vectors for a faster prediction
+#include "plssvm/solver_state.hpp"                          // a solver state to recycle Krylov subspace information across related fits
+#include "plssvm/solver_progress.hpp"                       // the progress reported after each CG iteration
+#include "plssvm/cancellation_token.hpp"                    // a token to cancel a running training
+#include "plssvm/async_handle.hpp"                          // a cancellable handle to a training or prediction running in the background
 
 #include "plssvm/backend_types.hpp"                         // all supported backend types
 #include "plssvm/kernel_function_types.hpp"                 // all supported kernel function types
+#include "plssvm/landmark_selection_types.hpp"              // all supported landmark selection strategies of the fixed-size LS-SVM
+#include "plssvm/solver_types.hpp"                          // all supported solvers for the system of linear equations
 #include "plssvm/target_platforms.hpp"                      // all supported target platforms
 
 #include "plssvm/backends/SYCL/implementation_type.hpp"     // the SYCL implementation type
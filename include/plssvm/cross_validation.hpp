@@ -0,0 +1,418 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a k-fold cross-validation sharing the parsed data and the kernel matrix between all folds.
+ */
+
+#ifndef PLSSVM_CROSS_VALIDATION_HPP_
+#define PLSSVM_CROSS_VALIDATION_HPP_
+#pragma once
+
+#include "plssvm/data_set.hpp"                     // plssvm::data_set
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/kernel_matrix.hpp"         // plssvm::detail::{compute_base_matrix, apply_kernel_function, solve_reduced_system_of_linear_equations, calculate_reduced_rho}
+#include "plssvm/detail/logger.hpp"                // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/operators.hpp"             // plssvm::operators::{sign, sum}
+#include "plssvm/detail/performance_tracker.hpp"   // plssvm::detail::tracking_entry
+#include "plssvm/detail/termination_criteria.hpp"  // plssvm::detail::parse_termination_criteria
+#include "plssvm/detail/type_traits.hpp"           // PLSSVM_REQUIRES
+#include "plssvm/detail/utility.hpp"               // plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::{epsilon, max_iter}, plssvm::detail::has_only_named_args_v
+
+#include "fmt/chrono.h"                            // directly print std::chrono literals with fmt
+#include "fmt/core.h"                              // fmt::format
+#include "fmt/ostream.h"                           // can use fmt using operator<< overloads
+#include "fmt/ranges.h"                            // directly print std::vector with fmt
+#include "igor/igor.hpp"                           // igor::has_other_than
+
+#ifdef _OPENMP
+    #include <omp.h>                               // omp_get_max_threads
+#endif
+
+#include <algorithm>                               // std::shuffle
+#include <chrono>                                  // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
+#include <cmath>                                   // std::fma
+#include <cstddef>                                 // std::size_t
+#include <ostream>                                 // std::ostream
+#include <random>                                  // std::mt19937
+#include <type_traits>                             // std::enable_if_t
+#include <utility>                                 // std::move, std::forward, std::pair
+#include <vector>                                  // std::vector
+
+namespace plssvm {
+
+/**
+ * @brief One fold of a plssvm::cross_validation, i.e., the size of the training and test data together with the achieved accuracy.
+ * @tparam T the floating point type of the data (must either be `float` or `double`)
+ */
+template <typename T>
+struct cross_validation_fold {
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+
+    /// The number of data points used to fit the model of this fold.
+    std::size_t num_training_points{ 0 };
+    /// The number of held out data points used to score the model of this fold.
+    std::size_t num_test_points{ 0 };
+    /// The accuracy achieved on the held out data points.
+    real_type accuracy{ 0.0 };
+    /// The number of CG iterations necessary to fit the model.
+    unsigned long long num_iterations{ 0 };
+    /// The time necessary to fit and score the model (excluding the shared kernel matrix computation).
+    std::chrono::milliseconds runtime{};
+};
+
+/**
+ * @brief The result of a plssvm::cross_validation: the results of all folds together with the overall accuracy.
+ * @tparam T the floating point type of the data (must either be `float` or `double`)
+ */
+template <typename T>
+class cross_validation_result {
+    // plssvm::cross_validation needs the private constructor
+    friend class cross_validation;
+
+  public:
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Return the results of all folds.
+     * @return the fold results (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<cross_validation_fold<real_type>> &folds() const noexcept { return folds_; }
+    /**
+     * @brief Return the cross-validation accuracy, i.e., the fraction of all data points that have been predicted correctly while being held out.
+     * @return the cross-validation accuracy (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type accuracy() const noexcept { return accuracy_; }
+
+  private:
+    /**
+     * @brief Create a new cross-validation result.
+     * @param[in] folds the results of all folds
+     * @param[in] accuracy the overall cross-validation accuracy
+     */
+    cross_validation_result(std::vector<cross_validation_fold<real_type>> folds, const real_type accuracy) :
+        folds_{ std::move(folds) }, accuracy_{ accuracy } {}
+
+    /// The results of all folds.
+    std::vector<cross_validation_fold<real_type>> folds_{};
+    /// The overall cross-validation accuracy.
+    real_type accuracy_{ 0.0 };
+};
+
+/**
+ * @brief Output the results of all folds stored in @p result as table to the given output-stream @p out.
+ * @tparam T the floating point type of the data
+ * @param[in,out] out the output-stream to write the fold results to
+ * @param[in] result the cross-validation result
+ * @return the output-stream
+ */
+template <typename T>
+std::ostream &operator<<(std::ostream &out, const cross_validation_result<T> &result) {
+    out << fmt::format("{:>5} {:>10} {:>10} {:>10} {:>10} {:>10}\n", "fold", "#train", "#test", "accuracy", "iter", "time");
+    for (typename std::vector<cross_validation_fold<T>>::size_type i = 0; i < result.folds().size(); ++i) {
+        const cross_validation_fold<T> &fold = result.folds()[i];
+        out << fmt::format("{:>5} {:>10} {:>10} {:>9.2f}% {:>10} {:>10}\n",
+                           i + 1,
+                           fold.num_training_points,
+                           fold.num_test_points,
+                           fold.accuracy * 100,
+                           fold.num_iterations,
+                           fold.runtime);
+    }
+    return out;
+}
+
+/**
+ * @brief Performs a k-fold cross-validation, i.e., fits a model on all but one fold and scores it on the held out fold for each fold.
+ * @details The data points are split into folds containing (nearly) the same number of data points of each class. The folds are only represented
+ *          as index lists into the original data set, i.e., the data points are never copied. The pairwise distances (rbf kernel) or inner products
+ *          (linear and polynomial kernel) and the resulting kernel matrix are computed exactly once and shared by all folds.
+ *          If there are at least as many folds as threads, the folds are processed concurrently; otherwise, each fold is parallelized on its own.
+ * @note The kernel matrix is stored explicitly, i.e., the memory consumption is quadratic in the number of data points.
+ */
+class cross_validation {
+  public:
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Create a new k-fold cross-validation.
+     * @param[in] params the SVM parameter used to fit the model of each fold
+     * @param[in] num_folds the number of folds
+     * @throws plssvm::invalid_parameter_exception if the kernel function is invalid
+     * @throws plssvm::invalid_parameter_exception if @p num_folds is less than two
+     */
+    explicit cross_validation(parameter params = {}, size_type num_folds = 5);
+
+    /**
+     * @brief Return the SVM parameter used to fit the model of each fold.
+     * @return the SVM parameter (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const parameter &get_params() const noexcept { return params_; }
+    /**
+     * @brief Return the number of folds.
+     * @return the number of folds (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_folds() const noexcept { return num_folds_; }
+
+    /**
+     * @brief Perform the k-fold cross-validation on the @p data.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the data to split into folds
+     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided maximum number of iterations is zero
+     * @throws plssvm::invalid_parameter_exception if the @p data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if the @p data contains less data points than twice the number of folds
+     * @return the results of all folds together with the overall accuracy (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args, PLSSVM_REQUIRES(detail::has_only_named_args_v<Args...>)>
+    [[nodiscard]] cross_validation_result<real_type> evaluate(const data_set<real_type, label_type> &data, Args &&...named_args) const;
+
+  private:
+    /**
+     * @brief Parse the named parameters @p named_args and return the values for `epsilon` and `max_iter`.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] num_data_points the number of training data points used as default value for `max_iter`
+     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided maximum number of iterations is zero
+     * @return the `epsilon` and `max_iter` values (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename... Args>
+    [[nodiscard]] static std::pair<real_type, unsigned long long> parse_named_args(std::size_t num_data_points, Args &&...named_args);
+
+    /**
+     * @brief Randomly split the indices of the data points into @p num_folds folds such that each fold contains (nearly) the same number of data points per class.
+     * @details A fixed seed is used such that the folds are reproducible.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @param[in] y the mapped labels (-1 or 1) of all data points
+     * @param[in] num_folds the number of folds
+     * @return the indices of the data points in each fold (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] static std::vector<std::vector<size_type>> create_folds(const std::vector<real_type> &y, size_type num_folds);
+
+    /**
+     * @brief Fit a model using the data points given by @p training_indices and score it on the data points given by @p test_indices.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @param[in] kernel_matrix the explicit kernel matrix of **all** data points
+     * @param[in] y the mapped labels (-1 or 1) of **all** data points
+     * @param[in] training_indices the indices of the data points used to fit the model
+     * @param[in] test_indices the indices of the data points used to score the model
+     * @param[in] cost the `cost` SVM parameter
+     * @param[in] eps the relative error tolerance of the CG algorithm
+     * @param[in] max_iter the maximum number of CG iterations
+     * @return the fold result (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] static cross_validation_fold<real_type> evaluate_fold(const std::vector<real_type> &kernel_matrix, const std::vector<real_type> &y, const std::vector<size_type> &training_indices, const std::vector<size_type> &test_indices, real_type cost, real_type eps, unsigned long long max_iter);
+
+    /// The SVM parameter used to fit the model of each fold.
+    parameter params_{};
+    /// The number of folds.
+    size_type num_folds_{ 5 };
+};
+
+inline cross_validation::cross_validation(parameter params, const size_type num_folds) :
+    params_{ params }, num_folds_{ num_folds } {
+    // kernel: valid kernel function
+    if (params_.kernel_type != kernel_function_type::linear && params_.kernel_type != kernel_function_type::polynomial && params_.kernel_type != kernel_function_type::rbf) {
+        throw invalid_parameter_exception{ fmt::format("Invalid kernel function {} given!", detail::to_underlying(params_.kernel_type)) };
+    }
+    // num_folds: at least two folds are necessary
+    if (num_folds_ < 2) {
+        throw invalid_parameter_exception{ fmt::format("The number of folds must be at least 2, but is {}!", num_folds_) };
+    }
+}
+
+template <typename real_type, typename label_type, typename... Args, std::enable_if_t<detail::has_only_named_args_v<Args...>, bool>>
+cross_validation_result<real_type> cross_validation::evaluate(const data_set<real_type, label_type> &data, Args &&...named_args) const {
+    // note: no structured bindings since they can't be used in OpenMP clauses
+    const std::pair<real_type, unsigned long long> cg_params = parse_named_args<real_type>(data.num_data_points(), std::forward<Args>(named_args)...);
+    const real_type eps = cg_params.first;
+    const unsigned long long max_iter = cg_params.second;
+
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    }
+    // each training set must contain at least two data points
+    if (data.num_data_points() < 2 * num_folds_) {
+        throw invalid_parameter_exception{ fmt::format("At least {} data points are necessary for a {}-fold cross-validation, but only {} are given!", 2 * num_folds_, num_folds_, data.num_data_points()) };
+    }
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    parameter params{ params_ };
+    if (params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        params.gamma = 1.0 / data.num_features();
+    }
+    const auto real_params = static_cast<detail::parameter<real_type>>(params);
+    const std::vector<real_type> &y = *data.y_ptr_;
+    const size_type num_data_points = data.num_data_points();
+
+    // compute the kernel matrix of all data points exactly once; the base values are transformed in-place to save memory
+    std::vector<real_type> kernel_matrix = detail::compute_base_matrix(params.kernel_type, data.data(), data.data());
+    detail::apply_kernel_function(real_params, kernel_matrix, kernel_matrix);
+
+    const std::chrono::time_point kernel_end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Computed the {}x{} kernel matrix shared by all {} folds in {}.\n",
+                num_data_points,
+                num_data_points,
+                detail::tracking_entry{ "cross_validation", "num_folds", num_folds_ },
+                detail::tracking_entry{ "cross_validation", "kernel_matrix_time", std::chrono::duration_cast<std::chrono::milliseconds>(kernel_end_time - start_time) });
+
+    // split the data points into folds; the folds only store indices into the original data set
+    const std::vector<std::vector<size_type>> folds = create_folds(y, num_folds_);
+
+#ifdef _OPENMP
+    // run the folds concurrently if there are enough folds to occupy all threads; otherwise, the folds are parallelized on their own
+    [[maybe_unused]] const bool concurrent_folds = num_folds_ >= static_cast<size_type>(omp_get_max_threads());
+#else
+    [[maybe_unused]] const bool concurrent_folds = false;
+#endif
+
+    const auto cost = static_cast<real_type>(params.cost.value());
+    const size_type num_folds = num_folds_;
+    std::vector<cross_validation_fold<real_type>> fold_results(num_folds);
+
+    #pragma omp parallel for schedule(dynamic) if (concurrent_folds) default(none) shared(kernel_matrix, y, folds, fold_results) firstprivate(num_folds, num_data_points, cost, eps, max_iter)
+    for (size_type fold = 0; fold < num_folds; ++fold) {
+        // the training data points are all data points not contained in the current fold
+        std::vector<size_type> training_indices;
+        training_indices.reserve(num_data_points - folds[fold].size());
+        for (size_type other = 0; other < num_folds; ++other) {
+            if (other != fold) {
+                training_indices.insert(training_indices.end(), folds[other].cbegin(), folds[other].cend());
+            }
+        }
+        fold_results[fold] = evaluate_fold(kernel_matrix, y, training_indices, folds[fold], cost, eps, max_iter);
+    }
+
+    // gather the results of all folds
+    std::vector<real_type> fold_accuracies(num_folds);
+    std::vector<std::chrono::milliseconds> fold_runtimes(num_folds);
+    real_type num_correct{ 0.0 };
+    for (size_type fold = 0; fold < num_folds; ++fold) {
+        const cross_validation_fold<real_type> &result = fold_results[fold];
+        detail::log(verbosity_level::full,
+                    "Fold {}/{}: accuracy = {:.2f}% on {} test points after {} CG iterations in {}.\n",
+                    fold + 1,
+                    num_folds,
+                    result.accuracy * 100,
+                    result.num_test_points,
+                    result.num_iterations,
+                    result.runtime);
+        fold_accuracies[fold] = result.accuracy;
+        fold_runtimes[fold] = result.runtime;
+        num_correct += result.accuracy * static_cast<real_type>(result.num_test_points);
+    }
+    const real_type accuracy = num_correct / static_cast<real_type>(num_data_points);
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Cross-validation accuracy: {} (fold accuracies: {}; fold runtimes: {}). Total cross-validation time: {}.\n\n",
+                detail::tracking_entry{ "cross_validation", "accuracy", accuracy },
+                detail::tracking_entry{ "cross_validation", "fold_accuracies", fold_accuracies },
+                detail::tracking_entry{ "cross_validation", "fold_runtimes", fold_runtimes },
+                detail::tracking_entry{ "cross_validation", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return cross_validation_result<real_type>{ std::move(fold_results), accuracy };
+}
+
+template <typename real_type, typename... Args>
+std::pair<real_type, unsigned long long> cross_validation::parse_named_args(const std::size_t num_data_points, Args &&...named_args) {
+    // compile time check: only some named parameters are allowed
+    static_assert(!igor::has_other_than<Args...>(epsilon, max_iter), "An illegal named parameter has been passed!");
+
+    return detail::parse_termination_criteria<real_type>(num_data_points, std::forward<Args>(named_args)...);
+}
+
+template <typename real_type>
+std::vector<std::vector<cross_validation::size_type>> cross_validation::create_folds(const std::vector<real_type> &y, const size_type num_folds) {
+    PLSSVM_ASSERT(num_folds <= y.size(), "Can't split {} data points into {} folds!", y.size(), num_folds);
+
+    // group the data point indices by their class
+    std::vector<size_type> positive_indices;
+    std::vector<size_type> negative_indices;
+    for (size_type i = 0; i < y.size(); ++i) {
+        (y[i] > real_type{ 0.0 } ? positive_indices : negative_indices).push_back(i);
+    }
+
+    // shuffle the data points of each class using a fixed seed
+    std::mt19937 generator{ 42 };
+    std::shuffle(positive_indices.begin(), positive_indices.end(), generator);
+    std::shuffle(negative_indices.begin(), negative_indices.end(), generator);
+
+    // distribute the data points round-robin over all folds; since the data points are sorted by class, each fold contains (nearly) the same number of data points per class
+    positive_indices.insert(positive_indices.end(), negative_indices.cbegin(), negative_indices.cend());
+    std::vector<std::vector<size_type>> folds(num_folds);
+    for (size_type i = 0; i < positive_indices.size(); ++i) {
+        folds[i % num_folds].push_back(positive_indices[i]);
+    }
+    return folds;
+}
+
+template <typename real_type>
+cross_validation_fold<real_type> cross_validation::evaluate_fold(const std::vector<real_type> &kernel_matrix, const std::vector<real_type> &y, const std::vector<size_type> &training_indices, const std::vector<size_type> &test_indices, const real_type cost, const real_type eps, const unsigned long long max_iter) {
+    PLSSVM_ASSERT(kernel_matrix.size() == y.size() * y.size(), "Sizes mismatch!: {} != {}", kernel_matrix.size(), y.size() * y.size());
+    PLSSVM_ASSERT(training_indices.size() >= 2, "At least two training data points are necessary, but only {} are given!", training_indices.size());
+
+    using namespace plssvm::operators;
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    const size_type num_data_points = y.size();
+    const size_type dept = training_indices.size() - 1;
+    const size_type last = training_indices.back();
+
+    // solve the reduced system using the CG algorithm starting with all ones (identical to the backend implementations)
+    std::vector<real_type> alpha(dept, real_type{ 1.0 });
+    const unsigned long long num_iterations = detail::solve_reduced_system_of_linear_equations(kernel_matrix, y, training_indices, cost, eps, max_iter, alpha);
+
+    // calculate the bias (identical to the backend implementations)
+    const real_type alpha_sum = sum(alpha);
+    const real_type rho = detail::calculate_reduced_rho(kernel_matrix, y, training_indices, cost, alpha);
+
+    // score the model on the held out data points
+    size_type correct{ 0 };
+    #pragma omp parallel for reduction(+ : correct) default(none) shared(kernel_matrix, y, training_indices, test_indices, alpha) firstprivate(num_data_points, dept, last, alpha_sum, rho)
+    for (size_type i = 0; i < test_indices.size(); ++i) {
+        const real_type *row = kernel_matrix.data() + test_indices[i] * num_data_points;
+        real_type temp{ -rho };
+        for (size_type sv = 0; sv < dept; ++sv) {
+            temp = std::fma(alpha[sv], row[training_indices[sv]], temp);
+        }
+        temp = std::fma(-alpha_sum, row[last], temp);
+        if (plssvm::operators::sign(temp) == y[test_indices[i]]) {
+            ++correct;
+        }
+    }
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    return cross_validation_fold<real_type>{ training_indices.size(),
+                                             test_indices.size(),
+                                             static_cast<real_type>(correct) / static_cast<real_type>(test_indices.size()),
+                                             num_iterations,
+                                             std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) };
+}
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_CROSS_VALIDATION_HPP_
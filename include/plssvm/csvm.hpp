@@ -13,28 +13,49 @@
 #define PLSSVM_CSVM_HPP_
 #pragma once
 
-#include "plssvm/data_set.hpp"                    // plssvm::data_set
-#include "plssvm/default_value.hpp"               // plssvm::default_value, plssvm::default_init
-#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
-#include "plssvm/detail/operators.hpp"            // plssvm::operators::sign
-#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::performance_tracker
-#include "plssvm/detail/type_traits.hpp"          // PLSSVM_REQUIRES, plssvm::detail::remove_cvref_t
-#include "plssvm/detail/utility.hpp"              // plssvm::detail::to_underlying
-#include "plssvm/exceptions/exceptions.hpp"       // plssvm::invalid_parameter_exception
-#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
-#include "plssvm/model.hpp"                       // plssvm::model
-#include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::{get_value_from_named_parameter, has_only_parameter_named_args_v}
-#include "plssvm/target_platforms.hpp"            // plssvm::target_platform
-
-#include "fmt/core.h"                             // fmt::format
-#include "igor/igor.hpp"                          // igor::parser
-
-#include <chrono>                                 // std::chrono::{time_point, steady_clock, duration_cast}
-#include <iostream>                               // std::cout, std::endl
-#include <tuple>                                  // std::tie
-#include <type_traits>                            // std::enable_if_t, std::is_same_v, std::is_convertible_v, std::false_type
-#include <utility>                                // std::pair, std::forward
-#include <vector>                                 // std::vector
+#include "plssvm/async_handle.hpp"                 // plssvm::async_handle
+#include "plssvm/cancellation_token.hpp"           // plssvm::cancellation_token
+#include "plssvm/data_set.hpp"                     // plssvm::data_set
+#include "plssvm/default_value.hpp"                // plssvm::default_value, plssvm::default_init
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/cg_checkpoint.hpp"         // plssvm::detail::checkpoint_config
+#include "plssvm/detail/cg_monitor.hpp"            // plssvm::detail::cg_monitor
+#include "plssvm/detail/cholesky.hpp"              // plssvm::detail::solve_cholesky
+#include "plssvm/detail/logger.hpp"                // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/operators.hpp"             // plssvm::operators::{sign, operator+=, operator*, operator/=}
+#include "plssvm/detail/performance_tracker.hpp"   // plssvm::detail::performance_tracker
+#include "plssvm/detail/solve_options.hpp"         // plssvm::detail::solve_options
+#include "plssvm/detail/termination_criteria.hpp"  // plssvm::detail::parse_termination_criteria
+#include "plssvm/detail/type_traits.hpp"           // PLSSVM_REQUIRES, plssvm::detail::remove_cvref_t
+#include "plssvm/detail/utility.hpp"               // plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::{invalid_parameter_exception, operation_cancelled_exception}
+#include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
+#include "plssvm/model.hpp"                        // plssvm::model
+#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::detail::{get_value_from_named_parameter, has_only_parameter_named_args_v, has_only_named_args_v}
+#include "plssvm/solver_progress.hpp"              // plssvm::progress_callback_type
+#include "plssvm/solver_state.hpp"                 // plssvm::solver_state
+#include "plssvm/solver_types.hpp"                 // plssvm::solver_type
+#include "plssvm/target_platforms.hpp"             // plssvm::target_platform
+
+#include "fmt/core.h"                              // fmt::format
+#include "fmt/format.h"                            // fmt::join
+#include "fmt/ostream.h"                           // can use fmt using operator<< overloads
+#include "igor/igor.hpp"                           // igor::parser
+
+#include <algorithm>                               // std::shuffle, std::stable_partition, std::stable_sort, std::fill, std::copy, std::count_if, std::min, std::max, std::move, std::find
+#include <chrono>                                  // std::chrono::{time_point, steady_clock, duration_cast}
+#include <cmath>                                   // std::abs
+#include <cstddef>                                 // std::size_t
+#include <future>                                  // std::future, std::async, std::launch
+#include <iostream>                                // std::cout, std::endl
+#include <iterator>                                // std::back_inserter
+#include <numeric>                                 // std::iota
+#include <random>                                  // std::mt19937, std::bernoulli_distribution
+#include <string>                                  // std::string
+#include <tuple>                                   // std::tuple, std::tie, std::ignore, std::make_tuple, std::apply, std::get
+#include <type_traits>                             // std::enable_if_t, std::is_same_v, std::is_convertible_v, std::false_type
+#include <utility>                                 // std::pair, std::forward, std::make_pair, std::move
+#include <vector>                                  // std::vector
 
 namespace plssvm {
 
@@ -115,19 +136,142 @@ class csvm {
     //*************************************************************************************************************************************//
     /**
      * @brief Fit a model using the current SVM on the @p data.
+     * @details If `num_partitions` is greater than one, a cascade training is performed (see plssvm::csvm::solve_system_of_linear_equations_cascade):
+     *          the data set is split into `num_partitions` disjoint partitions, one sub-model is trained per partition, and the sub-models are
+     *          merged using a small global correction solve. This replaces one `n`-dimensional system by `num_partitions` systems of size `n / num_partitions`.
+     *          The `solver` (default: plssvm::solver_type::cg) selects the CG variant used to solve the system(s) of linear equations.
+     *          If a pointer to a plssvm::solver_state is passed as `recycle`, the CG is deflated using its deflation vectors, which are updated afterward.
+     *          Passing the same solver state to a sequence of related fits (e.g., on slowly changing data) reduces the number of CG iterations.
+     *          If a `checkpoint_file` and a `checkpoint_interval` are passed, the CG state is written to the checkpoint file every `checkpoint_interval` iterations.
+     *          If `resume` is `true`, the CG continues from the state in the checkpoint file (if the file exists).
+     *          The `progress_callback` is invoked with a plssvm::solver_progress after each CG iteration.
+     *          If the cancellation of the plssvm::cancellation_token passed as `cancellation` is requested, the CG stops after the current iteration
+     *          and the model is created using the current iterate.
      * @tparam real_type the type of the data (`float` or `double`)
      * @tparam label_type the type of the label (an arithmetic type or `std::string`)
      * @tparam Args the type of the potential additional parameters
      * @param[in] data the data used to train the SVM model
-     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
-     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is greater or equal than zero
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `num_partitions`, `solver`, `recycle`, `checkpoint_file`, `checkpoint_interval`, `resume`, `progress_callback`, and/or `cancellation`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
      * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided number of partitions is zero
+     * @throws plssvm::invalid_parameter_exception if a solver state to `recycle` is combined with the cascade training or another `solver` than plssvm::solver_type::cg
+     * @throws plssvm::invalid_parameter_exception if checkpoints are requested without a `checkpoint_file`
+     * @throws plssvm::invalid_parameter_exception if checkpoints are combined with the cascade training, another `solver` than plssvm::solver_type::cg, or a solver state to `recycle`
+     * @throws plssvm::invalid_file_format_exception if the checkpoint file to `resume` from has been written for another data set or other SVM parameters
      * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if the training @p data contains less than two data points per partition
+     * @throws plssvm::invalid_parameter_exception if a label of the training @p data occurs less often than the number of partitions
      * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
      * @return the learned model (`[[nodiscard]]`)
      */
-    template <typename real_type, typename label_type, typename... Args>
+    template <typename real_type, typename label_type, typename... Args, PLSSVM_REQUIRES(detail::has_only_named_args_v<Args...>)>
     [[nodiscard]] model<real_type, label_type> fit(const data_set<real_type, label_type> &data, Args &&...named_args) const;
+    /**
+     * @brief Asynchronously fit a model using the current SVM on the @p data, i.e., the training runs in the background.
+     * @details The named parameters are the same as for plssvm::csvm::fit and are validated **before** the training is started.
+     *          Calling plssvm::async_handle::cancel stops the CG after the current iteration, the returned model then uses the current iterate.
+     *          If a plssvm::cancellation_token is passed as `cancellation`, the returned handle observes the same token, otherwise a new token is created.
+     *          This C-SVM, the @p data, and a solver state passed as `recycle` must outlive the returned handle.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the data used to train the SVM model
+     * @param[in] named_args the potential additional parameters (see plssvm::csvm::fit)
+     * @throws plssvm::invalid_parameter_exception all exceptions thrown while validating the named parameters (see plssvm::csvm::fit)
+     * @return a handle to the learned model; plssvm::async_handle::get rethrows all exceptions thrown during the training (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args, PLSSVM_REQUIRES(detail::has_only_named_args_v<Args...>)>
+    [[nodiscard]] async_handle<model<real_type, label_type>> fit_async(const data_set<real_type, label_type> &data, Args &&...named_args) const;
+    /**
+     * @brief Fit a model on the support vectors of the @p old_model extended by the @p new_data without starting the training from scratch.
+     * @details The last support vector of the @p old_model stays the last data point, i.e., the data point eliminated in the reduced system of linear equations.
+     *          Therefore, the old block of the reduced system doesn't change and the CG is warm started using the weights of the @p old_model padded with zeros
+     *          for the new data points. The SVM parameters of the @p old_model are used instead of the ones of this C-SVM.
+     *          The @p old_model must have been learned using the exact LS-SVM (i.e., **not** using the cascade training or a fixed-size LS-SVM) and
+     *          the @p new_data must be scaled in the same way as the data the @p old_model has been learned on.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] old_model the previously learned model
+     * @param[in] new_data the data points (including labels) to add to the model
+     * @param[in] named_args the potential additional parameters (see plssvm::csvm::fit; `num_partitions` is **not** supported)
+     * @throws plssvm::invalid_parameter_exception all exceptions thrown while validating the named parameters (see plssvm::csvm::fit)
+     * @throws plssvm::invalid_parameter_exception if `num_partitions` is greater than one
+     * @throws plssvm::invalid_parameter_exception if the @p new_data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if the number of features of the @p new_data and the @p old_model mismatch
+     * @throws plssvm::invalid_parameter_exception if the @p new_data contains a label the @p old_model doesn't know
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
+     * @return the learned model containing the support vectors of the @p old_model and the @p new_data (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args, PLSSVM_REQUIRES(detail::has_only_named_args_v<Args...>)>
+    [[nodiscard]] model<real_type, label_type> fit_incremental(const model<real_type, label_type> &old_model, const data_set<real_type, label_type> &new_data, Args &&...named_args) const;
+    /**
+     * @brief Fit a model on the support vectors of the @p old_model extended by the @p new_points with the @p new_labels without starting the training from scratch.
+     * @details Same as the plssvm::data_set overload, but the new data points may contain only a subset of the labels of the @p old_model, e.g.,
+     *          a batch of data points of a single class (a plssvm::data_set always needs exactly two different labels).
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] old_model the previously learned model
+     * @param[in] new_points the data points to add to the model
+     * @param[in] new_labels the labels of the @p new_points; each label must be one of the labels of the @p old_model
+     * @param[in] named_args the potential additional parameters (see plssvm::csvm::fit; `num_partitions` is **not** supported)
+     * @throws plssvm::invalid_parameter_exception all exceptions thrown while validating the named parameters (see plssvm::csvm::fit)
+     * @throws plssvm::invalid_parameter_exception if `num_partitions` is greater than one
+     * @throws plssvm::invalid_parameter_exception if no @p new_points are given or their number doesn't match the number of @p new_labels
+     * @throws plssvm::invalid_parameter_exception if the number of features of a new data point and the @p old_model mismatch
+     * @throws plssvm::invalid_parameter_exception if the @p new_labels contain a label the @p old_model doesn't know
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
+     * @return the learned model containing the support vectors of the @p old_model and the @p new_points (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args, PLSSVM_REQUIRES(detail::has_only_named_args_v<Args...>)>
+    [[nodiscard]] model<real_type, label_type> fit_incremental(const model<real_type, label_type> &old_model, const std::vector<std::vector<real_type>> &new_points, const std::vector<label_type> &new_labels, Args &&...named_args) const;
+    /**
+     * @brief Fit a sparse model with at most @p num_support_vectors support vectors using the current SVM on the @p data by iteratively pruning data points.
+     * @details Starting with the full LS-SVM, each round removes the `prune_fraction` (default: 0.05) of the remaining data points with the smallest
+     *          absolute weights and solves the smaller system of linear equations again. The CG is warm started using the weights of the remaining data points.
+     *          The training stops if only @p num_support_vectors data points remain or if the accuracy on the training @p data dropped by more than
+     *          `max_accuracy_drop` (default: 1.0, i.e., no limit) compared to the full LS-SVM. In the latter case, the model of the previous round is returned.
+     *          Note that the stop criterion uses the accuracy on the training @p data itself and **not** on held-out data, i.e., it only limits how much the
+     *          sparse model deviates from the full LS-SVM and is no estimate of the generalization accuracy. At least one data point per label is always kept.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the data used to train the SVM model
+     * @param[in] num_support_vectors the target number of support vectors
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `solver`, `prune_fraction`, and/or `max_accuracy_drop`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided `prune_fraction` is **not** in the range (0.0, 1.0)
+     * @throws plssvm::invalid_parameter_exception if the provided `max_accuracy_drop` is **not** in the range [0.0, 1.0]
+     * @throws plssvm::invalid_parameter_exception if @p num_support_vectors is less than two
+     * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
+     * @return the learned sparse model (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] model<real_type, label_type> fit_sparse(const data_set<real_type, label_type> &data, std::size_t num_support_vectors, Args &&...named_args) const;
+    /**
+     * @brief Fit one model per `cost` value in @p cost_values using the current SVM on the @p data.
+     * @details Since the `cost` value only changes the diagonal of the reduced system of linear equations, backends may solve all systems
+     *          using a single shared sequence of matrix-vector multiplications (see plssvm::csvm::solve_system_of_linear_equations_cost_path).
+     *          The `cost` value of the current SVM parameter is ignored.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the data used to train the SVM models
+     * @param[in] cost_values the `cost` values to fit a model for
+     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if no @p cost_values are provided or any of them is **not** greater than zero
+     * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations_cost_path`
+     * @return the learned models in the same order as the @p cost_values (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] std::vector<model<real_type, label_type>> fit(const data_set<real_type, label_type> &data, const std::vector<double> &cost_values, Args &&...named_args) const;
 
     //*************************************************************************************************************************************//
     //                                                          predict and score                                                          //
@@ -144,6 +288,19 @@ class csvm {
      */
     template <typename real_type, typename label_type>
     [[nodiscard]] std::vector<label_type> predict(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data) const;
+    /**
+     * @brief Asynchronously predict the labels for the @p data set using the @p model, i.e., the prediction runs in the background.
+     * @details A running prediction can't be interrupted. Therefore, a cancellation only has an effect if it is requested before the prediction starts,
+     *          e.g., if all threads are busy. This C-SVM, the @p model, and the @p data must outlive the returned handle.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @param[in] model a previously learned model
+     * @param[in] data the data to predict the labels for
+     * @return a handle to the predicted labels; plssvm::async_handle::get rethrows all exceptions thrown by plssvm::csvm::predict and
+     *         throws a plssvm::operation_cancelled_exception if the prediction has been cancelled before it started (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type>
+    [[nodiscard]] async_handle<std::vector<label_type>> predict_async(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data) const;
 
     /**
      * @brief Calculate the accuracy of the @p model.
@@ -168,6 +325,30 @@ class csvm {
      */
     template <typename real_type, typename label_type>
     [[nodiscard]] real_type score(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data) const;
+    /**
+     * @brief Calculate the leave-one-out (LOO) accuracy of the current SVM on the labeled @p data without training @p data.num_data_points() models.
+     * @details The exact LOO residual of the i-th data point is \f$\alpha_i / (H^{-1})_{ii}\f$ where \f$H\f$ is the full LS-SVM system matrix.
+     *          Therefore, only a single training is necessary to obtain the \f$\alpha_i\f$. The diagonal of \f$H^{-1}\f$ is estimated using
+     *          `num_probes` (default: 10) random Rademacher probing vectors, each costing one additional CG solve.
+     *          The probing vectors are generated using a fixed seed to make the result reproducible. The variance of the i-th estimated diagonal
+     *          entry is \f$\sum_{j \neq i} (H^{-1})_{ij}^2 / \text{num\_probes}\f$, i.e., its error only decreases with the square root of `num_probes`.
+     *          Since a non-positive estimate would flip the sign of the LOO residual, an exception is thrown if any estimate is non-positive.
+     *          If the @p data set has at most `num_probes` data points, the exact diagonal is computed instead using one CG solve per unit vector.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the labeled data set used to calculate the LOO accuracy
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `num_probes`, and/or `solver`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided number of probing vectors is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the @p data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if any estimated diagonal entry of \f$H^{-1}\f$ is non-positive, i.e., `num_probes` is too small
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
+     * @return the estimated LOO accuracy (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] real_type loo_score(const data_set<real_type, label_type> &data, Args &&...named_args) const;
 
   protected:
     //*************************************************************************************************************************************//
@@ -182,14 +363,33 @@ class csvm {
      * @param[in] b the right-hand side of the equation \f$Ax = b\f$
      * @param[in] eps the error tolerance
      * @param[in] max_iter the maximum number of CG iterations
+     * @param[in,out] options the CG variant, the solver state used to deflate the CG, the checkpoint settings, the progress monitor, and the initial guess
      * @throws plssvm::exception any exception thrown by the backend's implementation
      * @return a pair of [the result vector x, the resulting bias] (`[[nodiscard]]`)
      */
-    [[nodiscard]] virtual std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter) const = 0;
+    [[nodiscard]] virtual std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const detail::solve_options<float> &options) const = 0;
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] virtual std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter) const = 0;
+    [[nodiscard]] virtual std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const detail::solve_options<double> &options) const = 0;
+    /**
+     * @brief Solves the equations \f$(A + \frac{1}{C_i} M)x_i = b\f$ for all `cost` values \f$C_i\f$ in @p cost_values.
+     * @details The default implementation solves the systems one after another using plssvm::csvm::solve_system_of_linear_equations.
+     *          Backends may override this function to solve all systems at once, e.g., using a multi-shift CG algorithm.
+     * @param[in] params the SVM parameters used in the respective kernel functions (the `cost` value is ignored)
+     * @param[in] A the matrix of the equation \f$Ax = b\f$ (symmetric positive definite)
+     * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] cost_values the `cost` values to solve the system of linear equations for
+     * @param[in] eps the error tolerance
+     * @param[in] max_iter the maximum number of CG iterations
+     * @throws plssvm::exception any exception thrown by the backend's implementation
+     * @return a pair of [the result vector x, the resulting bias] for each value in @p cost_values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] virtual std::vector<std::pair<std::vector<float>, float>> solve_system_of_linear_equations_cost_path(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, const std::vector<float> &b, const std::vector<float> &cost_values, float eps, unsigned long long max_iter) const;
+    /**
+     * @copydoc plssvm::csvm::solve_system_of_linear_equations_cost_path
+     */
+    [[nodiscard]] virtual std::vector<std::pair<std::vector<double>, double>> solve_system_of_linear_equations_cost_path(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, const std::vector<double> &b, const std::vector<double> &cost_values, double eps, unsigned long long max_iter) const;
     /**
      * @brief Uses the already learned model to predict the class of multiple (new) data points.
      * @param[in] params the SVM parameters used in the respective kernel functions
@@ -210,6 +410,73 @@ class csvm {
     /// The target platform of this SVM.
     target_platform target_{ plssvm::target_platform::automatic };
   private:
+    /**
+     * @brief Parse the named parameters @p named_args and return the values for `epsilon`, `max_iter`, `num_partitions`, and the remaining options of the solve.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] num_data_points the number of training data points used as default value for `max_iter`
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `num_partitions`, `solver`, `recycle`, `checkpoint_file`, `checkpoint_interval`, `resume`, `progress_callback`, and/or `cancellation`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided number of partitions is zero
+     * @throws plssvm::invalid_parameter_exception if a solver state to `recycle` is combined with the cascade training or another `solver` than plssvm::solver_type::cg
+     * @throws plssvm::invalid_parameter_exception if checkpoints are requested without a `checkpoint_file`
+     * @throws plssvm::invalid_parameter_exception if checkpoints are combined with the cascade training, another `solver` than plssvm::solver_type::cg, or a solver state to `recycle`
+     * @return the `epsilon`, `max_iter`, and `num_partitions` values and the `solver`, `recycle`, checkpoint, and monitor values as solve options (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename... Args>
+    [[nodiscard]] static std::tuple<real_type, unsigned long long, std::size_t, detail::solve_options<real_type>> parse_fit_named_args(std::size_t num_data_points, Args &&...named_args);
+    /**
+     * @brief Parse the named parameters @p named_args like plssvm::csvm::parse_fit_named_args, but ignore all other named parameters.
+     * @details Used by the training variants that accept additional named parameters; these must check the allowed named parameters themselves.
+     * @copydetails plssvm::csvm::parse_fit_named_args
+     */
+    template <typename real_type, typename... Args>
+    [[nodiscard]] static std::tuple<real_type, unsigned long long, std::size_t, detail::solve_options<real_type>> parse_solve_named_args(std::size_t num_data_points, Args &&...named_args);
+    /**
+     * @brief Fit a model using the current SVM on the @p data using the already parsed and validated named parameters.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @param[in] data the data used to train the SVM model
+     * @param[in] eps the termination criterion for the CG algorithm
+     * @param[in] max_iter the maximum number of CG iterations
+     * @param[in] num_partitions the number of partitions used in the cascade training
+     * @param[in,out] options the CG variant, the solver state used to deflate the CG, the checkpoint settings, and the progress monitor
+     * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if the training @p data contains less than two data points per partition
+     * @throws plssvm::invalid_parameter_exception if a label of the training @p data occurs less often than the number of partitions
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
+     * @return the learned model (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type>
+    [[nodiscard]] model<real_type, label_type> fit_impl(const data_set<real_type, label_type> &data, real_type eps, unsigned long long max_iter, std::size_t num_partitions, const detail::solve_options<real_type> &options) const;
+    /**
+     * @brief Solve the system of linear equations @p A * x = @p b by splitting it into @p num_partitions independent sub-systems (cascade training).
+     * @details The data points are distributed to the partitions in a stratified random manner (using a fixed seed). Afterward, the
+     *          sub-systems are solved one after another using the backend's plssvm::csvm::solve_system_of_linear_equations, i.e., each sub-system
+     *          still uses all available compute resources. The resulting sub-models `f_k` are merged to `f(x) = sum_k w_k * f_k(x) + b`, where the
+     *          `num_partitions + 1` weights are determined by a coarse global correction solve, i.e., the regularized least-squares problem
+     *          `min ||y - F * w - b||^2 + ||w||^2 / C` with `F_ik = f_k(x_i)`.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @param[in] params the SVM parameters used in the respective kernel functions
+     * @param[in] A the data points
+     * @param[in] b the right-hand side of the equation (the mapped labels)
+     * @param[in] num_partitions the number of partitions
+     * @param[in] eps the termination criterion for the CG algorithm of each sub-system
+     * @param[in] max_iter the maximum number of CG iterations of each sub-system
+     * @param[in] options the CG variant and the progress monitor used to solve each sub-system (the monitor stops the CGs early if they have been cancelled)
+     * @return the weights for all data points and the bias of the merged model (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_cascade(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b, std::size_t num_partitions, real_type eps, unsigned long long max_iter, const detail::solve_options<real_type> &options) const;
+    /**
+     * @brief Solve the systems of linear equations for all @p cost_values one after another.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @copydetails plssvm::csvm::solve_system_of_linear_equations_cost_path
+     */
+    template <typename real_type>
+    [[nodiscard]] std::vector<std::pair<std::vector<real_type>, real_type>> solve_system_of_linear_equations_cost_path_sequential(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b, const std::vector<real_type> &cost_values, real_type eps, unsigned long long max_iter) const;
+
     /**
      * @brief Perform some sanity checks on the passed SVM parameters.
      * @throws plssvm::invalid_parameter_exception if the kernel function is invalid
@@ -260,44 +527,299 @@ void csvm::set_params(Args &&...named_args) {
     this->sanity_check_parameter();
 }
 
-template <typename real_type, typename label_type, typename... Args>
+template <typename real_type, typename label_type, typename... Args, std::enable_if_t<detail::has_only_named_args_v<Args...>, bool>>
 model<real_type, label_type> csvm::fit(const data_set<real_type, label_type> &data, Args &&...named_args) const {
-    igor::parser parser{ std::forward<Args>(named_args)... };
+    const auto [eps, max_iter_val, num_partitions_val, options] = parse_fit_named_args<real_type>(data.num_data_points(), std::forward<Args>(named_args)...);
 
-    // set default values
-    default_value epsilon_val{ default_init<real_type>{ 0.001 } };
-    default_value max_iter_val{ default_init<unsigned long long>{ data.num_data_points() } };
+    return this->fit_impl(data, eps, max_iter_val, num_partitions_val, options);
+}
+
+template <typename real_type, typename label_type, typename... Args, std::enable_if_t<detail::has_only_named_args_v<Args...>, bool>>
+async_handle<model<real_type, label_type>> csvm::fit_async(const data_set<real_type, label_type> &data, Args &&...named_args) const {
+    // parse and validate the named parameters before starting the training in the background
+    auto fit_args = parse_fit_named_args<real_type>(data.num_data_points(), std::forward<Args>(named_args)...);
+    cancellation_token token = std::get<detail::solve_options<real_type>>(fit_args).monitor.token();
+
+    std::future<model<real_type, label_type>> future = std::async(std::launch::async, [this, &data, fit_args = std::move(fit_args)]() {
+        return std::apply([&](const auto &...args) { return this->fit_impl(data, args...); }, fit_args);
+    });
+    return async_handle<model<real_type, label_type>>{ std::move(future), std::move(token) };
+}
+
+template <typename real_type, typename label_type, typename... Args, std::enable_if_t<detail::has_only_named_args_v<Args...>, bool>>
+model<real_type, label_type> csvm::fit_incremental(const model<real_type, label_type> &old_model, const data_set<real_type, label_type> &new_data, Args &&...named_args) const {
+    if (!new_data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for the new data points! Maybe the data is only usable for prediction?" };
+    }
+
+    return this->fit_incremental(old_model, new_data.data(), new_data.labels()->get(), std::forward<Args>(named_args)...);
+}
+
+template <typename real_type, typename label_type, typename... Args, std::enable_if_t<detail::has_only_named_args_v<Args...>, bool>>
+model<real_type, label_type> csvm::fit_incremental(const model<real_type, label_type> &old_model, const std::vector<std::vector<real_type>> &new_points, const std::vector<label_type> &new_labels, Args &&...named_args) const {
+    using size_type = typename data_set<real_type, label_type>::size_type;
+
+    const size_type num_old_data_points = old_model.num_support_vectors();
+    auto [eps, max_iter_val, num_partitions_val, options] = parse_fit_named_args<real_type>(num_old_data_points + new_points.size(), std::forward<Args>(named_args)...);
+
+    // the warm start is only possible for a single system of linear equations
+    if (num_partitions_val > 1) {
+        throw invalid_parameter_exception{ "The incremental training can't be combined with the cascade training!" };
+    }
+    if (new_points.empty()) {
+        throw invalid_parameter_exception{ "At least one new data point must be given!" };
+    }
+    if (new_points.size() != new_labels.size()) {
+        throw invalid_parameter_exception{ fmt::format("Number of new data points ({}) and number of labels ({}) must match!", new_points.size(), new_labels.size()) };
+    }
+    for (const std::vector<real_type> &point : new_points) {
+        if (point.size() != old_model.num_features()) {
+            throw invalid_parameter_exception{ fmt::format("Number of features per data point ({}) must match the number of features per support vector of the provided model ({})!", point.size(), old_model.num_features()) };
+        }
+    }
+    // the labels must be mapped to the same values, otherwise the old weights are meaningless
+    // note: since the old support vectors contain all labels of the model, the extended data set uses the same mapping as long as no new label is added
+    const std::vector<label_type> model_labels = old_model.different_labels();
+    for (const label_type &label : new_labels) {
+        if (std::find(model_labels.cbegin(), model_labels.cend(), label) == model_labels.cend()) {
+            throw invalid_parameter_exception{ fmt::format("The new data points must only have labels of the provided model, but {} isn't one of [{}]!", label, fmt::join(model_labels, ", ")) };
+        }
+    }
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // append the new data points but keep the last old one last: it is eliminated in the reduced system of linear equations
+    const std::vector<std::vector<real_type>> &old_points = old_model.support_vectors();
+    const std::vector<label_type> &old_labels = old_model.labels();
+    std::vector<std::vector<real_type>> points;
+    points.reserve(num_old_data_points + new_points.size());
+    points.insert(points.end(), old_points.cbegin(), old_points.cend() - 1);
+    points.insert(points.end(), new_points.cbegin(), new_points.cend());
+    points.push_back(old_points.back());
+    std::vector<label_type> labels;
+    labels.reserve(points.size());
+    labels.insert(labels.end(), old_labels.cbegin(), old_labels.cend() - 1);
+    labels.insert(labels.end(), new_labels.cbegin(), new_labels.cend());
+    labels.push_back(old_labels.back());
+    const data_set<real_type, label_type> data{ std::move(points), std::move(labels) };
+
+    // warm start the CG using the old weights (without the eliminated last one) padded with zeros for the new data points
+    options.initial_guess.assign(data.num_data_points() - 1, real_type{ 0.0 });
+    std::copy(old_model.weights().cbegin(), old_model.weights().cend() - 1, options.initial_guess.begin());
+
+    detail::log(verbosity_level::full,
+                "Appending {} new data points to the {} support vectors of the provided model.\n",
+                detail::tracking_entry{ "incremental", "num_new_data_points", new_points.size() },
+                detail::tracking_entry{ "incremental", "num_old_data_points", num_old_data_points });
+
+    // create model using the SVM parameter of the old model
+    model<real_type, label_type> csvm_model{ old_model.get_params(), data };
+
+    // solve the extended minimization problem
+    std::tie(*csvm_model.alpha_ptr_, csvm_model.rho_) = solve_system_of_linear_equations(static_cast<detail::parameter<real_type>>(csvm_model.get_params()), data.data(), *data.y_ptr_, eps, max_iter_val, options);
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Solved the extended minimization problem (r = b - Ax) using the warm started Conjugate Gradient (CG) methode in {}.\n\n",
+                detail::tracking_entry{ "cg", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return csvm_model;
+}
+
+template <typename real_type, typename label_type, typename... Args>
+model<real_type, label_type> csvm::fit_sparse(const data_set<real_type, label_type> &data, const std::size_t num_support_vectors, Args &&...named_args) const {
+    using size_type = typename data_set<real_type, label_type>::size_type;
 
-    // compile time check: only named parameter are permitted
-    static_assert(!parser.has_unnamed_arguments(), "Can only use named parameter!");
-    // compile time check: each named parameter must only be passed once
-    static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
     // compile time check: only some named parameters are allowed
-    static_assert(!parser.has_other_than(epsilon, max_iter), "An illegal named parameter has been passed!");
+    static_assert(!igor::has_other_than<Args...>(epsilon, max_iter, solver, prune_fraction, max_accuracy_drop), "An illegal named parameter has been passed!");
+    // parse the named parameters shared with all other training variants
+    real_type eps{};
+    unsigned long long max_iter_val{};
+    detail::solve_options<real_type> options{};
+    std::tie(eps, max_iter_val, std::ignore, options) = parse_solve_named_args<real_type>(data.num_data_points(), named_args...);
+
+    igor::parser parser{ std::forward<Args>(named_args)... };
+
+    // set default values
+    default_value prune_fraction_val{ default_init<double>{ 0.05 } };
+    default_value max_accuracy_drop_val{ default_init<double>{ 1.0 } };
 
     // compile time/runtime check: the values must have the correct types
-    if constexpr (parser.has(epsilon)) {
+    if constexpr (parser.has(prune_fraction)) {
         // get the value of the provided named parameter
-        epsilon_val = detail::get_value_from_named_parameter<typename decltype(epsilon_val)::value_type>(parser, epsilon);
+        prune_fraction_val = detail::get_value_from_named_parameter<typename decltype(prune_fraction_val)::value_type>(parser, prune_fraction);
         // check if value makes sense
-        if (epsilon_val <= static_cast<typename decltype(epsilon_val)::value_type>(0)) {
-            throw invalid_parameter_exception{ fmt::format("epsilon must be less than 0.0, but is {}!", epsilon_val) };
+        if (prune_fraction_val.value() <= 0.0 || prune_fraction_val.value() >= 1.0) {
+            throw invalid_parameter_exception{ fmt::format("prune_fraction must be in the range (0.0, 1.0), but is {}!", prune_fraction_val) };
         }
     }
-    if constexpr (parser.has(max_iter)) {
+    if constexpr (parser.has(max_accuracy_drop)) {
         // get the value of the provided named parameter
-        max_iter_val = detail::get_value_from_named_parameter<typename decltype(max_iter_val)::value_type>(parser, max_iter);
+        max_accuracy_drop_val = detail::get_value_from_named_parameter<typename decltype(max_accuracy_drop_val)::value_type>(parser, max_accuracy_drop);
         // check if value makes sense
-        if (max_iter_val == static_cast<typename decltype(max_iter_val)::value_type>(0)) {
-            throw invalid_parameter_exception{ fmt::format("max_iter must be greater than 0, but is {}!", max_iter_val) };
+        if (max_accuracy_drop_val.value() < 0.0 || max_accuracy_drop_val.value() > 1.0) {
+            throw invalid_parameter_exception{ fmt::format("max_accuracy_drop must be in the range [0.0, 1.0], but is {}!", max_accuracy_drop_val) };
         }
     }
 
+    if (num_support_vectors < 2) {
+        throw invalid_parameter_exception{ fmt::format("The number of support vectors must be at least 2, but is {}!", num_support_vectors) };
+    }
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    }
+
+    // copy parameter and set gamma if necessary
+    parameter params{ params_ };
+    if (params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        params.gamma = 1.0 / data.num_features();
+    }
+    const auto real_params = static_cast<detail::parameter<real_type>>(params);
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // the remaining data points; compacted in place after each round
+    std::vector<std::vector<real_type>> points = data.data();
+    std::vector<label_type> labels = data.labels()->get();
+    std::vector<real_type> y = *data.y_ptr_;
+
+    // the accuracy of the current (sparse) model on all training data points
+    const auto accuracy = [&](const std::vector<real_type> &alpha, const real_type rho) {
+        std::vector<real_type> w{};
+        const std::vector<real_type> predicted_values = predict_values(real_params, points, alpha, rho, w, data.data());
+        size_type correct{ 0 };
+        for (size_type i = 0; i < predicted_values.size(); ++i) {
+            if (plssvm::operators::sign(predicted_values[i]) == (*data.y_ptr_)[i]) {
+                ++correct;
+            }
+        }
+        return static_cast<double>(correct) / static_cast<double>(predicted_values.size());
+    };
+    // the accuracy is only needed if it can stop the pruning
+    const bool check_accuracy = max_accuracy_drop_val.value() < 1.0;
+
+    // solve the full minimization problem
+    std::vector<real_type> alpha{};
+    real_type rho{};
+    std::tie(alpha, rho) = solve_system_of_linear_equations(real_params, points, y, eps, max_iter_val, options);
+    const double full_accuracy = check_accuracy ? accuracy(alpha, rho) : 1.0;
+
+    std::size_t num_rounds{ 0 };
+    while (points.size() > num_support_vectors) {
+        const size_type num_points = points.size();
+
+        // the number of data points per label: the last data point is eliminated in the reduced system of linear equations and always kept
+        size_type num_positive = static_cast<size_type>(std::count_if(y.cbegin(), y.cend(), [](const real_type y_i) { return y_i > real_type{ 0.0 }; }));
+        size_type num_negative = num_points - num_positive;
+
+        // remove the data points with the smallest absolute weights, but keep at least one data point per label
+        const size_type num_to_prune = std::min(std::max(static_cast<size_type>(static_cast<double>(num_points) * prune_fraction_val.value()), size_type{ 1 }), num_points - num_support_vectors);
+        std::vector<size_type> indices(num_points - 1);
+        std::iota(indices.begin(), indices.end(), size_type{ 0 });
+        std::stable_sort(indices.begin(), indices.end(), [&alpha](const size_type lhs, const size_type rhs) { return std::abs(alpha[lhs]) < std::abs(alpha[rhs]); });
+        std::vector<bool> pruned(num_points, false);
+        size_type num_pruned{ 0 };
+        for (const size_type idx : indices) {
+            if (num_pruned == num_to_prune) {
+                break;
+            }
+            size_type &num_same_label = y[idx] > real_type{ 0.0 } ? num_positive : num_negative;
+            if (num_same_label > 1) {
+                pruned[idx] = true;
+                --num_same_label;
+                ++num_pruned;
+            }
+        }
+        if (num_pruned == 0) {
+            break;
+        }
+
+        // compact the remaining data points in place; the pruned ones are kept to be able to restore the model of the previous round
+        std::vector<std::vector<real_type>> pruned_points;
+        std::vector<label_type> pruned_labels;
+        std::vector<real_type> pruned_alpha;
+        pruned_points.reserve(num_pruned);
+        pruned_labels.reserve(num_pruned);
+        pruned_alpha.reserve(num_pruned);
+        size_type num_kept{ 0 };
+        for (size_type i = 0; i < num_points; ++i) {
+            if (pruned[i]) {
+                pruned_points.push_back(std::move(points[i]));
+                pruned_labels.push_back(std::move(labels[i]));
+                pruned_alpha.push_back(alpha[i]);
+            } else {
+                if (num_kept != i) {
+                    points[num_kept] = std::move(points[i]);
+                    labels[num_kept] = std::move(labels[i]);
+                    y[num_kept] = y[i];
+                    alpha[num_kept] = alpha[i];
+                }
+                ++num_kept;
+            }
+        }
+        points.resize(num_kept);
+        labels.resize(num_kept);
+        y.resize(num_kept);
+        alpha.resize(num_kept);
+
+        // solve the smaller minimization problem warm started using the weights of the remaining data points (without the eliminated last one)
+        options.initial_guess.assign(alpha.cbegin(), alpha.cend() - 1);
+        auto [pruned_model_alpha, pruned_model_rho] = solve_system_of_linear_equations(real_params, points, y, eps, max_iter_val, options);
+
+        if (check_accuracy && full_accuracy - accuracy(pruned_model_alpha, pruned_model_rho) > max_accuracy_drop_val.value()) {
+            // the accuracy dropped too much -> restore the model of the previous round
+            std::move(pruned_points.begin(), pruned_points.end(), std::back_inserter(points));
+            std::move(pruned_labels.begin(), pruned_labels.end(), std::back_inserter(labels));
+            alpha.insert(alpha.end(), pruned_alpha.cbegin(), pruned_alpha.cend());
+            break;
+        }
+        alpha = std::move(pruned_model_alpha);
+        rho = pruned_model_rho;
+        ++num_rounds;
+    }
+
+    // create the sparse model containing only the remaining data points
+    model<real_type, label_type> csvm_model{ params, data_set<real_type, label_type>{ std::move(points), std::move(labels) } };
+    *csvm_model.alpha_ptr_ = std::move(alpha);
+    csvm_model.rho_ = rho;
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Pruned the {} data points to {} support vectors in {} rounds in {}.\n\n",
+                data.num_data_points(),
+                detail::tracking_entry{ "sparse", "num_support_vectors", csvm_model.num_support_vectors() },
+                detail::tracking_entry{ "sparse", "num_rounds", num_rounds },
+                detail::tracking_entry{ "sparse", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return csvm_model;
+}
+
+template <typename real_type, typename label_type>
+model<real_type, label_type> csvm::fit_impl(const data_set<real_type, label_type> &data, const real_type eps, const unsigned long long max_iter_val, const std::size_t num_partitions_val, const detail::solve_options<real_type> &options) const {
     // start fitting the data set using a C-SVM
 
     if (!data.has_labels()) {
         throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
     }
+    // each partition must contain at least two data points in order to create the reduced system of linear equations
+    if (num_partitions_val > 1 && data.num_data_points() < 2 * num_partitions_val) {
+        throw invalid_parameter_exception{ fmt::format("At least {} data points are necessary to train using {} partitions, but only {} are given!", 2 * num_partitions_val, num_partitions_val, data.num_data_points()) };
+    }
+    // the partitions are stratified, i.e., each partition must contain at least one data point per label, otherwise its sub-model can't separate the classes
+    if (num_partitions_val > 1) {
+        const std::vector<real_type> &y = *data.y_ptr_;
+        const auto num_positive = static_cast<std::size_t>(std::count_if(y.cbegin(), y.cend(), [](const real_type y_i) { return y_i > real_type{ 0.0 }; }));
+        const std::size_t num_negative = y.size() - num_positive;
+        if (std::min(num_positive, num_negative) < num_partitions_val) {
+            const std::vector<label_type> labels = data.different_labels().value();
+            throw invalid_parameter_exception{ fmt::format("Each label must occur at least {} times to train using {} partitions, but label {} only occurs {} times!",
+                                                           num_partitions_val,
+                                                           num_partitions_val,
+                                                           num_positive < num_negative ? labels.back() : labels.front(),
+                                                           std::min(num_positive, num_negative)) };
+        }
+    }
 
     // copy parameter and set gamma if necessary
     parameter params{ params_ };
@@ -312,7 +834,11 @@ model<real_type, label_type> csvm::fit(const data_set<real_type, label_type> &da
     model<real_type, label_type> csvm_model{ params, data };
 
     // solve the minimization problem
-    std::tie(*csvm_model.alpha_ptr_, csvm_model.rho_) = solve_system_of_linear_equations(static_cast<detail::parameter<real_type>>(params), data.data(), *data.y_ptr_, epsilon_val.value(), max_iter_val.value());
+    if (num_partitions_val > 1) {
+        std::tie(*csvm_model.alpha_ptr_, csvm_model.rho_) = solve_system_of_linear_equations_cascade(static_cast<detail::parameter<real_type>>(params), data.data(), *data.y_ptr_, num_partitions_val, eps, max_iter_val, options);
+    } else {
+        std::tie(*csvm_model.alpha_ptr_, csvm_model.rho_) = solve_system_of_linear_equations(static_cast<detail::parameter<real_type>>(params), data.data(), *data.y_ptr_, eps, max_iter_val, options);
+    }
 
     const std::chrono::time_point end_time = std::chrono::steady_clock::now();
     detail::log(verbosity_level::full | verbosity_level::timing,
@@ -322,6 +848,62 @@ model<real_type, label_type> csvm::fit(const data_set<real_type, label_type> &da
     return csvm_model;
 }
 
+template <typename real_type, typename label_type, typename... Args>
+std::vector<model<real_type, label_type>> csvm::fit(const data_set<real_type, label_type> &data, const std::vector<double> &cost_values, Args &&...named_args) const {
+    // compile time check: the cascade training can't be combined with the cost path
+    static_assert(!igor::has_other_than<Args...>(epsilon, max_iter), "An illegal named parameter has been passed!");
+    real_type eps{};
+    unsigned long long max_iter_val{};
+    std::tie(eps, max_iter_val, std::ignore, std::ignore) = parse_fit_named_args<real_type>(data.num_data_points(), std::forward<Args>(named_args)...);
+
+    // cost: at least one value must be given and all values must be greater than 0
+    if (cost_values.empty()) {
+        throw invalid_parameter_exception{ "At least one cost value must be given!" };
+    }
+    for (const double cost_value : cost_values) {
+        if (cost_value <= 0.0) {
+            throw invalid_parameter_exception{ fmt::format("All cost values must be greater than 0.0, but {} is not!", cost_value) };
+        }
+    }
+
+    // start fitting the data set using a C-SVM
+
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    }
+
+    // copy parameter and set gamma if necessary
+    parameter params{ params_ };
+    if (params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        params.gamma = 1.0 / data.num_features();
+    }
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // solve all minimization problems at once
+    const std::vector<real_type> real_cost_values(cost_values.cbegin(), cost_values.cend());
+    std::vector<std::pair<std::vector<real_type>, real_type>> solutions = solve_system_of_linear_equations_cost_path(static_cast<detail::parameter<real_type>>(params), data.data(), *data.y_ptr_, real_cost_values, eps, max_iter_val);
+
+    // create the models
+    std::vector<model<real_type, label_type>> csvm_models;
+    csvm_models.reserve(cost_values.size());
+    for (typename std::vector<double>::size_type i = 0; i < cost_values.size(); ++i) {
+        params.cost = cost_values[i];
+        model<real_type, label_type> &csvm_model = csvm_models.emplace_back(model<real_type, label_type>{ params, data });
+        *csvm_model.alpha_ptr_ = std::move(solutions[i].first);
+        csvm_model.rho_ = solutions[i].second;
+    }
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Solved {} minimization problems (r = b - Ax) for different cost values using the Conjugate Gradient (CG) methode in {}.\n\n",
+                detail::tracking_entry{ "cg", "num_cost_values", cost_values.size() },
+                detail::tracking_entry{ "cg", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return csvm_models;
+}
+
 template <typename real_type, typename label_type>
 std::vector<label_type> csvm::predict(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data) const {
     if (model.num_features() != data.num_features()) {
@@ -342,6 +924,20 @@ std::vector<label_type> csvm::predict(const model<real_type, label_type> &model,
     return predicted_labels;
 }
 
+template <typename real_type, typename label_type>
+async_handle<std::vector<label_type>> csvm::predict_async(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data) const {
+    cancellation_token token{};
+
+    std::future<std::vector<label_type>> future = std::async(std::launch::async, [this, &model, &data, token]() {
+        // a running prediction can't be interrupted -> only check for a cancellation before starting it
+        if (token.cancellation_requested()) {
+            throw operation_cancelled_exception{ "The prediction has been cancelled before it has been started!" };
+        }
+        return this->predict(model, data);
+    });
+    return async_handle<std::vector<label_type>>{ std::move(future), std::move(token) };
+}
+
 template <typename real_type, typename label_type>
 real_type csvm::score(const model<real_type, label_type> &model) const {
     return this->score(model, model.data_);
@@ -374,6 +970,320 @@ real_type csvm::score(const model<real_type, label_type> &model, const data_set<
     return static_cast<real_type>(correct) / static_cast<real_type>(predicted_labels.size());
 }
 
+template <typename real_type, typename label_type, typename... Args>
+real_type csvm::loo_score(const data_set<real_type, label_type> &data, Args &&...named_args) const {
+    // compile time check: only some named parameters are allowed
+    static_assert(!igor::has_other_than<Args...>(epsilon, max_iter, num_probes, solver), "An illegal named parameter has been passed!");
+    // parse the named parameters shared with all other training variants
+    real_type eps{};
+    unsigned long long max_iter_val{};
+    detail::solve_options<real_type> options{};
+    std::tie(eps, max_iter_val, std::ignore, options) = parse_solve_named_args<real_type>(data.num_data_points(), named_args...);
+
+    igor::parser parser{ std::forward<Args>(named_args)... };
+
+    // set default values
+    default_value num_probes_val{ default_init<std::size_t>{ 10 } };
+
+    // compile time/runtime check: the values must have the correct types
+    if constexpr (parser.has(num_probes)) {
+        // get the value of the provided named parameter
+        num_probes_val = detail::get_value_from_named_parameter<typename decltype(num_probes_val)::value_type>(parser, num_probes);
+        // check if value makes sense
+        if (num_probes_val == static_cast<typename decltype(num_probes_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("num_probes must be greater than 0, but is {}!", num_probes_val) };
+        }
+    }
+
+    // the data set must contain labels in order to calculate the leave-one-out accuracy
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    }
+
+    // copy parameter and set gamma if necessary
+    parameter params{ params_ };
+    if (params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        params.gamma = 1.0 / data.num_features();
+    }
+    const auto real_params = static_cast<detail::parameter<real_type>>(params);
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    using namespace plssvm::operators;
+    const std::vector<real_type> &y = *data.y_ptr_;
+
+    // solve the full minimization problem exactly once
+    const std::vector<real_type> alpha = solve_system_of_linear_equations(real_params, data.data(), y, eps, max_iter_val, options).first;
+
+    // note: solving with the right-hand side v automatically respects the equality constraint of the LS-SVM system
+    std::vector<real_type> H_inv_diagonal(y.size(), real_type{ 0.0 });
+    std::vector<real_type> probe(y.size());
+    std::size_t num_solves{ 0 };
+    if (y.size() <= num_probes_val.value()) {
+        // the exact diagonal of H^-1 needs at most as many solves as the estimation: (H^-1)_ii = (H^-1 e_i)_i
+        for (std::size_t i = 0; i < y.size(); ++i) {
+            std::fill(probe.begin(), probe.end(), real_type{ 0.0 });
+            probe[i] = real_type{ 1.0 };
+            H_inv_diagonal[i] = solve_system_of_linear_equations(real_params, data.data(), probe, eps, max_iter_val, options).first[i];
+        }
+        num_solves = y.size();
+    } else {
+        // estimate the diagonal of H^-1 using Rademacher probing vectors: diag(H^-1) ~ sum_k v_k * (H^-1 v_k) / num_probes
+        std::mt19937 generator{ 42 };
+        std::bernoulli_distribution distribution{ 0.5 };
+        for (std::size_t i = 0; i < num_probes_val.value(); ++i) {
+            for (real_type &value : probe) {
+                value = distribution(generator) ? real_type{ 1.0 } : real_type{ -1.0 };
+            }
+            H_inv_diagonal += probe * solve_system_of_linear_equations(real_params, data.data(), probe, eps, max_iter_val, options).first;
+        }
+        H_inv_diagonal /= static_cast<real_type>(num_probes_val.value());
+        num_solves = num_probes_val.value();
+
+        // the diagonal of H^-1 is positive, but a single estimate may not be, which would flip the sign of the LOO residual
+        const auto num_non_positive = static_cast<std::size_t>(std::count_if(H_inv_diagonal.cbegin(), H_inv_diagonal.cend(), [](const real_type value) { return value <= real_type{ 0.0 }; }));
+        if (num_non_positive > 0) {
+            throw invalid_parameter_exception{ fmt::format("{} of the {} estimated diagonal entries of the inverse system matrix are non-positive! Increase num_probes (currently {}) to reduce the variance of the estimation.", num_non_positive, H_inv_diagonal.size(), num_probes_val.value()) };
+        }
+    }
+
+    // the prediction of the i-th data point of the model trained without it is y_i - alpha_i / (H^-1)_ii
+    typename std::vector<real_type>::size_type correct{ 0 };
+    #pragma omp parallel for reduction(+ : correct) default(none) shared(y, alpha, H_inv_diagonal)
+    for (typename std::vector<real_type>::size_type i = 0; i < y.size(); ++i) {
+        if (plssvm::operators::sign(y[i] - alpha[i] / H_inv_diagonal[i]) == y[i]) {
+            ++correct;
+        }
+    }
+    const real_type accuracy = static_cast<real_type>(correct) / static_cast<real_type>(y.size());
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Estimated the leave-one-out accuracy of {} using {} additional solves in {}.\n\n",
+                detail::tracking_entry{ "loo", "accuracy", accuracy },
+                detail::tracking_entry{ "loo", "num_solves", num_solves },
+                detail::tracking_entry{ "loo", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return accuracy;
+}
+
+inline std::vector<std::pair<std::vector<float>, float>> csvm::solve_system_of_linear_equations_cost_path(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, const std::vector<float> &b, const std::vector<float> &cost_values, const float eps, const unsigned long long max_iterations) const {
+    return this->solve_system_of_linear_equations_cost_path_sequential(params, A, b, cost_values, eps, max_iterations);
+}
+
+inline std::vector<std::pair<std::vector<double>, double>> csvm::solve_system_of_linear_equations_cost_path(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, const std::vector<double> &b, const std::vector<double> &cost_values, const double eps, const unsigned long long max_iterations) const {
+    return this->solve_system_of_linear_equations_cost_path_sequential(params, A, b, cost_values, eps, max_iterations);
+}
+
+template <typename real_type, typename... Args>
+std::tuple<real_type, unsigned long long, std::size_t, detail::solve_options<real_type>> csvm::parse_fit_named_args(const std::size_t num_data_points, Args &&...named_args) {
+    // compile time check: only some named parameters are allowed
+    static_assert(!igor::has_other_than<Args...>(epsilon, max_iter, num_partitions, solver, recycle, checkpoint_file, checkpoint_interval, resume, progress_callback, cancellation), "An illegal named parameter has been passed!");
+
+    return parse_solve_named_args<real_type>(num_data_points, std::forward<Args>(named_args)...);
+}
+
+template <typename real_type, typename... Args>
+std::tuple<real_type, unsigned long long, std::size_t, detail::solve_options<real_type>> csvm::parse_solve_named_args(const std::size_t num_data_points, Args &&...named_args) {
+    // parse the termination criteria of the CG algorithm
+    const auto [epsilon_val, max_iter_val] = detail::parse_termination_criteria<real_type>(num_data_points, named_args...);
+
+    igor::parser parser{ std::forward<Args>(named_args)... };
+
+    // set default values
+    default_value num_partitions_val{ default_init<std::size_t>{ 1 } };
+    default_value solver_val{ default_init<solver_type>{ solver_type::cg } };
+    default_value recycle_val{ default_init<solver_state<real_type> *>{ nullptr } };
+    default_value checkpoint_file_val{ default_init<std::string>{} };
+    default_value checkpoint_interval_val{ default_init<unsigned long long>{ 0 } };
+    default_value resume_val{ default_init<bool>{ false } };
+    progress_callback_type progress_callback_val{};
+    cancellation_token cancellation_val{};
+
+    // compile time check: only named parameter are permitted
+    static_assert(!parser.has_unnamed_arguments(), "Can only use named parameter!");
+    // compile time check: each named parameter must only be passed once
+    static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
+
+    // compile time/runtime check: the values must have the correct types
+    if constexpr (parser.has(num_partitions)) {
+        // get the value of the provided named parameter
+        num_partitions_val = detail::get_value_from_named_parameter<typename decltype(num_partitions_val)::value_type>(parser, num_partitions);
+        // check if value makes sense
+        if (num_partitions_val == static_cast<typename decltype(num_partitions_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("num_partitions must be greater than 0, but is {}!", num_partitions_val) };
+        }
+    }
+    if constexpr (parser.has(solver)) {
+        // get the value of the provided named parameter
+        solver_val = detail::get_value_from_named_parameter<typename decltype(solver_val)::value_type>(parser, solver);
+    }
+    if constexpr (parser.has(recycle)) {
+        // get the value of the provided named parameter
+        recycle_val = detail::get_value_from_named_parameter<typename decltype(recycle_val)::value_type>(parser, recycle);
+        // check if value makes sense
+        if (recycle_val.value() != nullptr && num_partitions_val.value() > 1) {
+            throw invalid_parameter_exception{ "A solver state can't be recycled in the cascade training!" };
+        }
+        if (recycle_val.value() != nullptr && solver_val.value() != solver_type::cg) {
+            throw invalid_parameter_exception{ fmt::format("A solver state can only be recycled using the {} solver, but {} was provided!", solver_type::cg, solver_val.value()) };
+        }
+    }
+    if constexpr (parser.has(checkpoint_file)) {
+        // get the value of the provided named parameter
+        checkpoint_file_val = detail::get_value_from_named_parameter<typename decltype(checkpoint_file_val)::value_type>(parser, checkpoint_file);
+    }
+    if constexpr (parser.has(checkpoint_interval)) {
+        // get the value of the provided named parameter
+        checkpoint_interval_val = detail::get_value_from_named_parameter<typename decltype(checkpoint_interval_val)::value_type>(parser, checkpoint_interval);
+    }
+    if constexpr (parser.has(resume)) {
+        // get the value of the provided named parameter
+        resume_val = detail::get_value_from_named_parameter<typename decltype(resume_val)::value_type>(parser, resume);
+    }
+    if constexpr (parser.has(progress_callback)) {
+        // get the value of the provided named parameter
+        progress_callback_val = detail::get_value_from_named_parameter<progress_callback_type>(parser, progress_callback);
+    }
+    if constexpr (parser.has(cancellation)) {
+        // get the value of the provided named parameter
+        cancellation_val = detail::get_value_from_named_parameter<cancellation_token>(parser, cancellation);
+    }
+    // check if the checkpoint values make sense
+    if (checkpoint_interval_val.value() > 0 || resume_val.value()) {
+        if (checkpoint_file_val.value().empty()) {
+            throw invalid_parameter_exception{ "A checkpoint_file must be provided to write or resume from CG checkpoints!" };
+        }
+        if (num_partitions_val.value() > 1) {
+            throw invalid_parameter_exception{ "CG checkpoints can't be used in the cascade training!" };
+        }
+        if (solver_val.value() != solver_type::cg) {
+            throw invalid_parameter_exception{ fmt::format("CG checkpoints can only be used with the {} solver, but {} was provided!", solver_type::cg, solver_val.value()) };
+        }
+        if (recycle_val.value() != nullptr) {
+            throw invalid_parameter_exception{ "CG checkpoints can't be combined with recycling a solver state!" };
+        }
+    }
+
+    detail::solve_options<real_type> options{};
+    options.solver = solver_val.value();
+    options.state = recycle_val.value();
+    options.checkpoint = detail::checkpoint_config{ checkpoint_file_val.value(), checkpoint_interval_val.value(), resume_val.value() };
+    options.monitor = detail::cg_monitor{ std::move(progress_callback_val), std::move(cancellation_val) };
+    return std::make_tuple(epsilon_val, max_iter_val, num_partitions_val.value(), std::move(options));
+}
+
+template <typename real_type>
+std::vector<std::pair<std::vector<real_type>, real_type>> csvm::solve_system_of_linear_equations_cost_path_sequential(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b, const std::vector<real_type> &cost_values, const real_type eps, const unsigned long long max_iterations) const {
+    std::vector<std::pair<std::vector<real_type>, real_type>> solutions;
+    solutions.reserve(cost_values.size());
+
+    detail::parameter<real_type> cost_params{ params };
+    for (const real_type cost_value : cost_values) {
+        cost_params.cost = cost_value;
+        solutions.push_back(solve_system_of_linear_equations(cost_params, A, b, eps, max_iterations, detail::solve_options<real_type>{}));
+    }
+    return solutions;
+}
+
+template <typename real_type>
+std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_cascade(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b, const std::size_t num_parts, const real_type eps, const unsigned long long max_iterations, const detail::solve_options<real_type> &options) const {
+    PLSSVM_ASSERT(num_parts > 1, "At least two partitions must be used, but only {} are given!", num_parts);
+    PLSSVM_ASSERT(A.size() >= 2 * num_parts, "Each partition must contain at least two data points!");
+    PLSSVM_ASSERT(A.size() == b.size(), "Sizes mismatch!: {} != {}", A.size(), b.size());
+    PLSSVM_ASSERT(options.state == nullptr && options.initial_guess.empty(), "The cascade training can't recycle a solver state or use an initial guess!");
+
+    using size_type = std::size_t;
+
+    const size_type num_data_points = A.size();
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // distribute the data points in a stratified manner to the partitions: shuffle the indices and assign them round-robin per class
+    std::vector<size_type> indices(num_data_points);
+    std::iota(indices.begin(), indices.end(), size_type{ 0 });
+    std::shuffle(indices.begin(), indices.end(), std::mt19937{ 42 });
+    std::stable_partition(indices.begin(), indices.end(), [&b](const size_type idx) { return b[idx] > real_type{ 0.0 }; });
+    std::vector<std::vector<size_type>> partitions(num_parts);
+    for (size_type i = 0; i < num_data_points; ++i) {
+        partitions[i % num_parts].push_back(indices[i]);
+    }
+
+    // train one sub-model per partition and evaluate it on ALL data points: F_ik = f_k(x_i)
+    // note: the partitions are solved one after another, since the backends' solves aren't thread-safe (e.g., the OpenCL kernel arguments and the
+    //       performance tracker are shared); instead, each solve is parallelized on its own
+    std::vector<std::pair<std::vector<real_type>, real_type>> sub_models(num_parts);
+    std::vector<std::vector<real_type>> F(num_parts);
+    for (size_type k = 0; k < num_parts; ++k) {
+        std::vector<std::vector<real_type>> A_k;
+        std::vector<real_type> b_k;
+        A_k.reserve(partitions[k].size());
+        b_k.reserve(partitions[k].size());
+        for (const size_type idx : partitions[k]) {
+            A_k.push_back(A[idx]);
+            b_k.push_back(b[idx]);
+        }
+        sub_models[k] = solve_system_of_linear_equations(params, A_k, std::move(b_k), eps, max_iterations, options);
+        PLSSVM_ASSERT(sub_models[k].first.size() == partitions[k].size(), "Sizes mismatch!: {} != {}", sub_models[k].first.size(), partitions[k].size());
+        std::vector<real_type> w{};
+        F[k] = predict_values(params, A_k, sub_models[k].first, sub_models[k].second, w, A);
+    }
+
+    const std::chrono::time_point partition_end_time = std::chrono::steady_clock::now();
+
+    // coarse global correction: [F^T F + I / C, F^T 1; 1^T F, n] * [w; b] = [F^T y; 1^T y]
+    const size_type dim = num_parts + 1;
+    std::vector<double> G(dim * dim, 0.0);
+    std::vector<double> rhs(dim, 0.0);
+    for (size_type k = 0; k < num_parts; ++k) {
+        for (size_type l = k; l < num_parts; ++l) {
+            double value{ 0.0 };
+            for (size_type i = 0; i < num_data_points; ++i) {
+                value += static_cast<double>(F[k][i]) * static_cast<double>(F[l][i]);
+            }
+            G[k * dim + l] = value;
+            G[l * dim + k] = value;
+        }
+        G[k * dim + k] += 1.0 / static_cast<double>(params.cost.value());
+        double column_sum{ 0.0 };
+        for (size_type i = 0; i < num_data_points; ++i) {
+            column_sum += static_cast<double>(F[k][i]);
+            rhs[k] += static_cast<double>(F[k][i]) * static_cast<double>(b[i]);
+        }
+        G[k * dim + num_parts] = column_sum;
+        G[num_parts * dim + k] = column_sum;
+    }
+    G[num_parts * dim + num_parts] = static_cast<double>(num_data_points);
+    for (const real_type b_i : b) {
+        rhs[num_parts] += static_cast<double>(b_i);
+    }
+    if (!detail::solve_cholesky(G, rhs)) {
+        // fall back to averaging the sub-models
+        std::fill(rhs.begin(), rhs.end() - 1, 1.0 / static_cast<double>(num_parts));
+        rhs.back() = 0.0;
+    }
+
+    // merge the sub-models: f(x) = sum_k w_k * (sum_j alpha_kj * k(x_kj, x) - rho_k) + b
+    std::vector<real_type> alpha(num_data_points);
+    double rho{ -rhs.back() };
+    for (size_type k = 0; k < num_parts; ++k) {
+        const auto w_k = static_cast<real_type>(rhs[k]);
+        for (size_type j = 0; j < partitions[k].size(); ++j) {
+            alpha[partitions[k][j]] = w_k * sub_models[k].first[j];
+        }
+        rho += rhs[k] * static_cast<double>(sub_models[k].second);
+    }
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Trained {} sub-models in {} and merged them using a global correction in {}.\n",
+                detail::tracking_entry{ "cascade", "num_partitions", num_parts },
+                detail::tracking_entry{ "cascade", "partition_time", std::chrono::duration_cast<std::chrono::milliseconds>(partition_end_time - start_time) },
+                detail::tracking_entry{ "cascade", "correction_time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - partition_end_time) });
+
+    return std::make_pair(std::move(alpha), static_cast<real_type>(rho));
+}
+
 inline void csvm::sanity_check_parameter() const {
     // kernel: valid kernel function
     if (params_.kernel_type != kernel_function_type::linear && params_.kernel_type != kernel_function_type::polynomial && params_.kernel_type != kernel_function_type::rbf) {
@@ -43,6 +43,9 @@
         #include "plssvm/backends/SYCL/hipSYCL/csvm.hpp"  // plssvm::hipsycl::csvm, plssvm::csvm_backend_exists_v
     #endif
 #endif
+#if defined(PLSSVM_HAS_HPX_BACKEND)
+    #include "plssvm/backends/HPX/csvm.hpp"  // plssvm::hpx::csvm, plssvm::csvm_backend_exists_v
+#endif
 
 #include "fmt/core.h"     // fmt::format
 #include "igor/igor.hpp"  // igor::parser, igor::has_unnamed_arguments
@@ -135,6 +138,8 @@ template <typename... Args>
             return make_csvm_default_impl<opencl::csvm>(std::forward<Args>(args)...);
         case backend_type::sycl:
             return make_csvm_sycl_impl(std::forward<Args>(args)...);
+        case backend_type::hpx:
+            return make_csvm_default_impl<hpx::csvm>(std::forward<Args>(args)...);
     }
     throw unsupported_backend_exception{ "Unrecognized backend provided!" };
 }
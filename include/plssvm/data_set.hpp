@@ -13,17 +13,25 @@
 #define PLSSVM_DATA_SET_HPP_
 #pragma once
 
+#include "plssvm/detail/arithmetic_type_name.hpp"        // plssvm::detail::arithmetic_type_name
 #include "plssvm/detail/io/arff_parsing.hpp"             // plssvm::detail::io::{read_libsvm_data, write_libsvm_data}
-#include "plssvm/detail/io/file_reader.hpp"              // plssvm::detail::io::file_reader
-#include "plssvm/detail/io/libsvm_parsing.hpp"           // plssvm::detail::io::{read_arff_data, write_arff_data}
+#include "plssvm/detail/io/binary_parsing.hpp"           // plssvm::detail::io::{parse_binary_data, write_binary_data}
+#include "plssvm/detail/io/compression.hpp"              // plssvm::detail::io::{remove_compression_extension, determine_compression_type, compression_type, decompressing_streambuf}
+#include "plssvm/detail/io/csv_parsing.hpp"              // plssvm::detail::io::{parse_csv_data, write_csv_data}
+#include "plssvm/detail/io/data_set_cache.hpp"           // plssvm::data_set_cache, plssvm::detail::io::{data_set_cache_entry, create_data_set_cache_file, commit_data_set_cache_entry}
+#include "plssvm/detail/io/data_set_subset.hpp"          // plssvm::detail::io::{select_subset, format_feature_selection}
+#include "plssvm/detail/io/file_reader.hpp"              // plssvm::detail::io::{file_reader, is_standard_input}
+#include "plssvm/detail/io/libsvm_parsing.hpp"           // plssvm::detail::io::{parse_libsvm_data_chunked, parse_libsvm_data_stream, write_libsvm_data}
+#include "plssvm/detail/io/npy_parsing.hpp"              // plssvm::detail::io::{parse_npy_data, write_npy_data}
 #include "plssvm/detail/io/scaling_factors_parsing.hpp"  // plssvm::detail::io::{parse_scaling_factors, read_scaling_factors}
 #include "plssvm/detail/logger.hpp"                      // plssvm::detail::log, plssvm::verbosity_level
-#include "plssvm/detail/performance_tracker.hpp"         // plssvm::detail::tracking_entry
+#include "plssvm/detail/performance_tracker.hpp"         // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
 #include "plssvm/detail/string_utility.hpp"              // plssvm::detail::ends_with
 #include "plssvm/detail/type_list.hpp"                   // plssvm::detail::{real_type_list, label_type_list, type_list_contains_v}
+#include "plssvm/detail/type_traits.hpp"                 // PLSSVM_REQUIRES, plssvm::detail::remove_cvref_t
 #include "plssvm/detail/utility.hpp"                     // plssvm::detail::contains
-#include "plssvm/exceptions/exceptions.hpp"              // plssvm::data_set_exception
-#include "plssvm/file_format_types.hpp"                  // plssvm::file_format_type
+#include "plssvm/exceptions/exceptions.hpp"              // plssvm::{data_set_exception, file_exception}
+#include "plssvm/file_format_types.hpp"                  // plssvm::file_format_type, plssvm::csv_options, plssvm::subset_options
 
 #include "fmt/chrono.h"                                  // directly output std::chrono times via fmt
 #include "fmt/core.h"                                    // fmt::format
@@ -32,15 +40,21 @@
 #include <algorithm>                                     // std::all_of, std::max, std::min, std::sort, std::adjacent_find
 #include <chrono>                                        // std::chrono::{time_point, steady_clock, duration_cast, millisecond}
 #include <cstddef>                                       // std::size_t
+#include <exception>                                     // std::exception
+#include <filesystem>                                    // std::filesystem::path
 #include <functional>                                    // std::reference_wrapper, std::cref
-#include <iostream>                                      // std::cout, std::endl
+#include <ios>                                           // std::ios::badbit
+#include <iostream>                                      // std::cin, std::cout, std::clog, std::endl
+#include <istream>                                       // std::istream
 #include <limits>                                        // std::numeric_limits::{max, lowest}
 #include <map>                                           // std::map
 #include <memory>                                        // std::shared_ptr, std::make_shared
 #include <optional>                                      // std::optional, std::make_optional, std::nullopt
 #include <set>                                           // std::set
 #include <string>                                        // std::string
+#include <string_view>                                   // std::string_view
 #include <tuple>                                         // std::tie
+#include <type_traits>                                   // std::is_same_v
 #include <utility>                                       // std::move, std::pair, std::make_pair
 #include <vector>                                        // std::vector
 
@@ -76,6 +90,12 @@ class data_set {
     friend class model;
     // plssvm::csvm needs the label mapping
     friend class csvm;
+    // plssvm::grid_search needs the label mapping
+    friend class grid_search;
+    // plssvm::cross_validation needs the mapped labels
+    friend class cross_validation;
+    // plssvm::fixed_size_lssvm needs the mapped labels
+    friend class fixed_size_lssvm;
 
   public:
     /// The type of the data points: either `float` or `double`.
@@ -93,7 +113,10 @@ class data_set {
     /**
      * @brief Read the data points from the file @p filename.
      *        Automatically determines the plssvm::file_format_type based on the file extension.
-     * @details If @p filename ends with `.arff` it uses the ARFF parser, otherwise the LIBSVM parser is used.
+     * @details If @p filename ends with `.arff` it uses the ARFF parser, if it ends with `.bin` the binary format, if it ends with `.csv` the CSV parser,
+     *          if it ends with `.npy` the NumPy format, otherwise the LIBSVM parser is used.
+     *          A trailing `.gz` or `.zst` extension denotes a compressed file, which is decompressed transparently (e.g., `data.arff.gz` is a gzip compressed ARFF file).
+     *          If @p filename is `-` or `/dev/stdin`, the data points are read from the standard input using the LIBSVM parser.
      * @param[in] filename the file to read the data points from
      * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
      */
@@ -105,10 +128,41 @@ class data_set {
      * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
      */
     data_set(const std::string &filename, file_format_type format);
+    /**
+     * @brief Read the data points from the file @p filename using the @p options to read CSV (and NumPy) files.
+     *        Automatically determines the plssvm::file_format_type based on the file extension (see plssvm::data_set::data_set(const std::string &)).
+     * @details Only participates in overload resolution if @p options is a plssvm::csv_options, otherwise `data_set{ filename, { -1, 1 } }` would be ambiguous.
+     * @tparam Options the type of the options (must be plssvm::csv_options)
+     * @param[in] filename the file to read the data points from
+     * @param[in] options the delimiter, header, and label column used if @p filename is a CSV file; only the label column is used for NumPy files
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
+     */
+    template <typename Options, PLSSVM_REQUIRES(std::is_same_v<detail::remove_cvref_t<Options>, csv_options>)>
+    data_set(const std::string &filename, Options &&options);
+    /**
+     * @brief Read only the @p subset of the data points and features from the file @p filename using the @p options to read CSV (and NumPy) files.
+     *        Automatically determines the plssvm::file_format_type based on the file extension (see plssvm::data_set::data_set(const std::string &)).
+     * @param[in] filename the file to read the data points from
+     * @param[in] options the delimiter, header, and label column used if @p filename is a CSV file; only the label column is used for NumPy files
+     * @param[in] subset the zero-based features to keep and the number of data points to sample
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
+     */
+    data_set(const std::string &filename, const csv_options &options, const subset_options &subset);
+    /**
+     * @brief Read only the @p subset of the data points and features from the file @p filename assuming that the file is given in the @p plssvm::file_format_type.
+     * @param[in] filename the file to read the data points from
+     * @param[in] format the assumed file format used to parse the data points
+     * @param[in] subset the zero-based features to keep and the number of data points to sample
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
+     */
+    data_set(const std::string &filename, file_format_type format, const subset_options &subset);
     /**
      * @brief Read the data points from the file @p filename and scale it using the provided @p scale_parameter.
      *        Automatically determines the plssvm::file_format_type based on the file extension.
-     * @details If @p filename ends with `.arff` it uses the ARFF parser, otherwise the LIBSVM parser is used.
+     * @details If @p filename ends with `.arff` it uses the ARFF parser, if it ends with `.bin` the binary format, if it ends with `.csv` the CSV parser,
+     *          if it ends with `.npy` the NumPy format, otherwise the LIBSVM parser is used.
+     *          A trailing `.gz` or `.zst` extension denotes a compressed file, which is decompressed transparently (e.g., `data.arff.gz` is a gzip compressed ARFF file).
+     *          If @p filename is `-` or `/dev/stdin`, the data points are read from the standard input using the LIBSVM parser.
      * @param[in] filename the file to read the data points from
      * @param[in] scale_parameter the parameters used to scale the data set feature values to a given range
      * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
@@ -125,6 +179,39 @@ class data_set {
      * @throws plssvm::data_set_exception all exceptions thrown by plssvm::data_set::scale
      */
     data_set(const std::string &filename, file_format_type format, scaling scale_parameter);
+    /**
+     * @brief Read the data points from the file @p filename using the @p options to read CSV (and NumPy) files and scale it using the provided @p scale_parameter.
+     *        Automatically determines the plssvm::file_format_type based on the file extension (see plssvm::data_set::data_set(const std::string &)).
+     * @param[in] filename the file to read the data points from
+     * @param[in] options the delimiter, header, and label column used if @p filename is a CSV file; only the label column is used for NumPy files
+     * @param[in] scale_parameter the parameters used to scale the data set feature values to a given range
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
+     * @throws plssvm::data_set_exception all exceptions thrown by plssvm::data_set::scale
+     */
+    data_set(const std::string &filename, const csv_options &options, scaling scale_parameter);
+    /**
+     * @brief Read only the @p subset of the data points and features from the file @p filename using the @p options to read CSV (and NumPy) files
+     *        and scale it using the provided @p scale_parameter.
+     *        Automatically determines the plssvm::file_format_type based on the file extension (see plssvm::data_set::data_set(const std::string &)).
+     * @param[in] filename the file to read the data points from
+     * @param[in] options the delimiter, header, and label column used if @p filename is a CSV file; only the label column is used for NumPy files
+     * @param[in] subset the zero-based features to keep and the number of data points to sample
+     * @param[in] scale_parameter the parameters used to scale the data set feature values to a given range
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
+     * @throws plssvm::data_set_exception all exceptions thrown by plssvm::data_set::scale
+     */
+    data_set(const std::string &filename, const csv_options &options, const subset_options &subset, scaling scale_parameter);
+    /**
+     * @brief Read only the @p subset of the data points and features from the file @p filename assuming that the file is given in the plssvm::file_format_type @p format and
+     *        scale it using the provided @p scale_parameter.
+     * @param[in] filename the file to read the data points from
+     * @param[in] format the assumed file format used to parse the data points
+     * @param[in] subset the zero-based features to keep and the number of data points to sample
+     * @param[in] scale_parameter the parameters used to scale the data set feature values to a given range
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::data_set::read_file
+     * @throws plssvm::data_set_exception all exceptions thrown by plssvm::data_set::scale
+     */
+    data_set(const std::string &filename, file_format_type format, const subset_options &subset, scaling scale_parameter);
 
     /**
      * @brief Create a new data set using the provided @p data_points.
@@ -178,7 +265,7 @@ class data_set {
      * @brief Save the data points and potential labels of this data set to the file @p filename.
      *        Automatically determines the plssvm::file_format_type based on the file extension.
      * @param[in] filename the file to save the data points and labels to
-     * @throws plssvm::data_set_exception if the file extension isn't one of `libsvm` or `arff`
+     * @throws plssvm::data_set_exception if the file extension isn't one of `libsvm`, `arff`, `bin`, `csv`, or `npy`
      */
     void save(const std::string &filename) const;
 
@@ -262,12 +349,31 @@ class data_set {
     void scale();
     /**
      * @brief Read the data points and potential labels from the file @p filename assuming the plssvm::file_format_type @p format.
+     * @details If @p filename denotes the standard input (`-` or `/dev/stdin`) and @p format is plssvm::file_format_type::libsvm, the data points are parsed
+     *          while the standard input is still being read (see plssvm::detail::io::parse_libsvm_data_stream).
+     *          Compressed LIBSVM files are parsed the same way while being decompressed on-the-fly using bounded buffers (see plssvm::detail::io::decompressing_streambuf),
+     *          i.e., the decompressed file is never materialized. All other compressed formats (ARFF, CSV, binary, and NumPy) are decompressed as a whole before parsing
+     *          (see plssvm::detail::io::decompress) since their parsers need random access to the file content.
+     *          If the plssvm::data_set_cache is enabled, text files (LIBSVM, ARFF, and CSV) are read from their cached binary image if available,
+     *          otherwise the binary image is stored in the cache after parsing the text.
+     *          The feature projection and row sampling of the @p subset are applied while parsing LIBSVM and ARFF files, i.e., unwanted feature values are never converted and
+     *          unsampled data points are never materialized. For all other formats (and the data points sampled from the standard input or a compressed LIBSVM file) the subset is selected after parsing.
      * @param[in] filename the filename to read the data from
      * @param[in] format the assumed file format type
+     * @param[in] options the options used to read CSV and NumPy files
+     * @param[in] subset the zero-based features to keep and the number of data points to sample
      * @throws plssvm::invalid_file_format_exception all exceptions thrown by the respective functions in the plssvm::detail::io namespace
      * @throws plssvm::data_set_exception if labels are present in @p filename, all exceptions thrown by plssvm::data_set::create_mapping
      */
-    void read_file(const std::string &filename, file_format_type format);
+    void read_file(const std::string &filename, file_format_type format, const csv_options &options = {}, const subset_options &subset = {});
+    /**
+     * @brief Store the binary image of the parsed @p data and @p label as the data set cache @p entry.
+     * @details Failing to store the binary image is only logged and never results in an exception, since the data set itself has been read successfully.
+     * @param[in] entry the data set cache entry
+     * @param[in] data the parsed data points
+     * @param[in] label the parsed labels; may be empty if the data set has no labels
+     */
+    void store_in_data_set_cache(const std::filesystem::path &entry, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) const;
 
     /// A pointer to the two-dimensional data points.
     std::shared_ptr<std::vector<std::vector<real_type>>> X_ptr_{ nullptr };
@@ -491,16 +597,40 @@ auto data_set<T, U>::label_mapper::labels() const -> std::vector<label_type> {
 //*************************************************************************************************************************************//
 
 template <typename T, typename U>
-data_set<T, U>::data_set(const std::string &filename) {
+data_set<T, U>::data_set(const std::string &filename) :
+    data_set{ filename, csv_options{} } {}
+
+template <typename T, typename U>
+template <typename Options, std::enable_if_t<std::is_same_v<detail::remove_cvref_t<Options>, csv_options>, bool>>
+data_set<T, U>::data_set(const std::string &filename, Options &&options) :
+    data_set{ filename, static_cast<const csv_options &>(options), subset_options{} } {}
+
+template <typename T, typename U>
+data_set<T, U>::data_set(const std::string &filename, const csv_options &options, const subset_options &subset) {
     // read data set from file
-    // if the file doesn't end with .arff, assume a LIBSVM file
-    this->read_file(filename, detail::ends_with(filename, ".arff") ? file_format_type::arff : file_format_type::libsvm);
+    // if the file doesn't end with .arff, .bin, .csv, or .npy (ignoring a compression file extension), assume a LIBSVM file
+    const std::string_view uncompressed_filename = detail::io::remove_compression_extension(filename);
+    if (detail::ends_with(uncompressed_filename, ".arff")) {
+        this->read_file(filename, file_format_type::arff, csv_options{}, subset);
+    } else if (detail::ends_with(uncompressed_filename, ".bin")) {
+        this->read_file(filename, file_format_type::binary, csv_options{}, subset);
+    } else if (detail::ends_with(uncompressed_filename, ".csv")) {
+        this->read_file(filename, file_format_type::csv, options, subset);
+    } else if (detail::ends_with(uncompressed_filename, ".npy")) {
+        this->read_file(filename, file_format_type::npy, options, subset);
+    } else {
+        this->read_file(filename, file_format_type::libsvm, csv_options{}, subset);
+    }
 }
 
 template <typename T, typename U>
-data_set<T, U>::data_set(const std::string &filename, const file_format_type format) {
+data_set<T, U>::data_set(const std::string &filename, const file_format_type format) :
+    data_set{ filename, format, subset_options{} } {}
+
+template <typename T, typename U>
+data_set<T, U>::data_set(const std::string &filename, const file_format_type format, const subset_options &subset) {
     // read data set from file
-    this->read_file(filename, format);
+    this->read_file(filename, format, csv_options{}, subset);
 }
 
 template <typename T, typename U>
@@ -521,6 +651,33 @@ data_set<T, U>::data_set(const std::string &filename, file_format_type format, s
     this->scale();
 }
 
+template <typename T, typename U>
+data_set<T, U>::data_set(const std::string &filename, const csv_options &options, scaling scale_parameter) :
+    data_set{ filename, options } {
+    // initialize scaling
+    scale_parameters_ = std::make_shared<scaling>(std::move(scale_parameter));
+    // scale data set
+    this->scale();
+}
+
+template <typename T, typename U>
+data_set<T, U>::data_set(const std::string &filename, const csv_options &options, const subset_options &subset, scaling scale_parameter) :
+    data_set{ filename, options, subset } {
+    // initialize scaling
+    scale_parameters_ = std::make_shared<scaling>(std::move(scale_parameter));
+    // scale data set
+    this->scale();
+}
+
+template <typename T, typename U>
+data_set<T, U>::data_set(const std::string &filename, file_format_type format, const subset_options &subset, scaling scale_parameter) :
+    data_set{ filename, format, subset } {
+    // initialize scaling
+    scale_parameters_ = std::make_shared<scaling>(std::move(scale_parameter));
+    // scale data set
+    this->scale();
+}
+
 template <typename T, typename U>
 data_set<T, U>::data_set(std::vector<std::vector<real_type>> data_points) :
     X_ptr_{ std::make_shared<std::vector<std::vector<real_type>>>(std::move(data_points)) } {
@@ -587,6 +744,15 @@ void data_set<T, U>::save(const std::string &filename, const file_format_type fo
             case file_format_type::arff:
                 detail::io::write_arff_data(filename, *X_ptr_, *labels_ptr_);
                 break;
+            case file_format_type::binary:
+                detail::io::write_binary_data(filename, *X_ptr_, *labels_ptr_);
+                break;
+            case file_format_type::csv:
+                detail::io::write_csv_data(filename, *X_ptr_, *labels_ptr_);
+                break;
+            case file_format_type::npy:
+                detail::io::write_npy_data(filename, *X_ptr_, *labels_ptr_);
+                break;
         }
     } else {
         // save data without labels
@@ -597,6 +763,15 @@ void data_set<T, U>::save(const std::string &filename, const file_format_type fo
             case file_format_type::arff:
                 detail::io::write_arff_data(filename, *X_ptr_);
                 break;
+            case file_format_type::binary:
+                detail::io::write_binary_data(filename, *X_ptr_);
+                break;
+            case file_format_type::csv:
+                detail::io::write_csv_data(filename, *X_ptr_);
+                break;
+            case file_format_type::npy:
+                detail::io::write_npy_data(filename, *X_ptr_);
+                break;
         }
     }
 
@@ -616,8 +791,14 @@ void data_set<T, U>::save(const std::string &filename) const {
         this->save(filename, file_format_type::libsvm);
     } else if (detail::ends_with(filename, ".arff")) {
         this->save(filename, file_format_type::arff);
+    } else if (detail::ends_with(filename, ".bin")) {
+        this->save(filename, file_format_type::binary);
+    } else if (detail::ends_with(filename, ".csv")) {
+        this->save(filename, file_format_type::csv);
+    } else if (detail::ends_with(filename, ".npy")) {
+        this->save(filename, file_format_type::npy);
     } else {
-        throw data_set_exception(fmt::format("Unrecognized file extension for file \"{}\" (must be one of: .libsvm or .arff)!", filename));
+        throw data_set_exception(fmt::format("Unrecognized file extension for file \"{}\" (must be one of: .libsvm, .arff, .bin, .csv, or .npy)!", filename));
     }
 }
 
@@ -735,36 +916,105 @@ void data_set<T, U>::scale() {
 }
 
 template <typename T, typename U>
-void data_set<T, U>::read_file(const std::string &filename, file_format_type format) {
+void data_set<T, U>::read_file(const std::string &filename, file_format_type format, const csv_options &options, const subset_options &subset) {
     const std::chrono::time_point start_time = std::chrono::steady_clock::now();
 
-    // get the comment character based on the file_format_type
-    char comment{ ' ' };
-    switch (format) {
-        case file_format_type::libsvm:
-            comment = '#';
-            break;
-        case file_format_type::arff:
-            comment = '%';
-            break;
-    }
-
-    // open the file
-    detail::io::file_reader reader{ filename };
-    reader.read_lines(comment);
-
     // create the empty placeholders
     std::vector<std::vector<real_type>> data{};
     std::vector<label_type> label{};
+    bool cache_hit{ false };
 
-    // parse the given file
-    switch (format) {
-        case file_format_type::libsvm:
-            std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_libsvm_data<real_type, label_type>(reader);
-            break;
-        case file_format_type::arff:
-            std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_arff_data<real_type, label_type>(reader);
-            break;
+    if (format == file_format_type::libsvm && detail::io::is_standard_input(filename)) {
+        // parse the LIBSVM data from the standard input while it is still being read
+        std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_libsvm_data_stream<real_type, label_type>(std::cin, detail::io::libsvm_stream_block_size, subset);
+    } else {
+        // only the text formats benefit from caching, the binary and NumPy files are already memory mapped without parsing any text
+        std::optional<std::filesystem::path> cache_entry{};
+        if (format == file_format_type::libsvm || format == file_format_type::arff || format == file_format_type::csv) {
+            std::string_view label_type_name{ "std::string" };
+            if constexpr (!std::is_same_v<label_type, std::string>) {
+                label_type_name = detail::arithmetic_type_name<label_type>();
+            }
+            const std::string parser_settings = fmt::format("{}_{}_{}_{}_{}_{}_{}_{}_{}",
+                                                            format,
+                                                            options.delimiter,
+                                                            options.has_header,
+                                                            options.label_column.has_value() ? fmt::format("{}", options.label_column.value()) : "none",
+                                                            subset.features.empty() ? "all" : detail::io::format_feature_selection(subset.features),
+                                                            subset.num_samples,
+                                                            subset.sampling,
+                                                            detail::arithmetic_type_name<real_type>(),
+                                                            label_type_name);
+            try {
+                cache_entry = detail::io::data_set_cache_entry(data_set_cache, filename, parser_settings);
+            } catch (const file_exception &e) {
+                // an insecure cache directory is never used
+                std::clog << fmt::format("WARNING: {} The data set cache is not used.", e.what()) << std::endl;
+            }
+        }
+
+        // try to memory map the binary image of a previous read of the same file
+        if (cache_entry.has_value() && detail::io::touch_data_set_cache_entry(cache_entry.value())) {
+            try {
+                const detail::io::file_reader reader{ cache_entry.value() };
+                std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_binary_data<real_type, label_type>(reader);
+                cache_hit = true;
+            } catch (const exception &) {
+                // the cache entry has been corrupted or evicted in the meantime -> parse the file again
+                detail::io::remove_data_set_cache_entry(cache_entry.value());
+            }
+        }
+
+        const detail::io::compression_type compression = detail::io::determine_compression_type(filename);
+        if (!cache_hit && format == file_format_type::libsvm && compression != detail::io::compression_type::none) {
+            // parse the LIBSVM data while decompressing the file on-the-fly instead of materializing the whole decompressed file
+            detail::io::decompressing_streambuf decompressor{ filename, compression };
+            std::istream in{ &decompressor };
+            // rethrow the exceptions thrown while decompressing instead of silently stopping to read
+            in.exceptions(std::ios::badbit);
+            std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_libsvm_data_stream<real_type, label_type>(in, detail::io::libsvm_stream_block_size, subset);
+
+            if (cache_entry.has_value()) {
+                this->store_in_data_set_cache(cache_entry.value(), data, label);
+            }
+        } else if (!cache_hit) {
+            // open the file; compressed files are decompressed as a whole
+            detail::io::file_reader reader{ filename };
+            // the LIBSVM, CSV, binary, and NumPy parsers work directly on the file content, only the ARFF parser needs the preprocessed lines
+            if (format == file_format_type::arff) {
+                reader.read_lines('%');
+            }
+
+            // parse the given file
+            switch (format) {
+                case file_format_type::libsvm:
+                    std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_libsvm_data_chunked<real_type, label_type>(reader, 0, subset);
+                    break;
+                case file_format_type::arff:
+                    std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_arff_data<real_type, label_type>(reader, subset);
+                    break;
+                case file_format_type::binary:
+                    std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_binary_data<real_type, label_type>(reader);
+                    break;
+                case file_format_type::csv:
+                    std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_csv_data<real_type, label_type>(reader, options);
+                    break;
+                case file_format_type::npy:
+                    std::tie(num_data_points_, num_features_, data, label) = detail::io::parse_npy_data<real_type, label_type>(reader, options.label_column);
+                    break;
+            }
+
+            // the LIBSVM and ARFF parsers already applied the subset while parsing, all other parsers read the whole file
+            if (format == file_format_type::binary || format == file_format_type::csv || format == file_format_type::npy) {
+                detail::io::select_subset(data, label, subset);
+                num_data_points_ = data.size();
+                num_features_ = data.empty() ? 0 : data.front().size();
+            }
+
+            if (cache_entry.has_value()) {
+                this->store_in_data_set_cache(cache_entry.value(), data, label);
+            }
+        }
     }
 
     // update shared pointer
@@ -782,12 +1032,44 @@ void data_set<T, U>::read_file(const std::string &filename, file_format_type for
 
     const std::chrono::time_point end_time = std::chrono::steady_clock::now();
     detail::log(verbosity_level::full | verbosity_level::timing,
-                "Read {} data points with {} features in {} using the {} parser from file '{}'.\n",
+                "Read {} data points with {} features in {} using the {} parser from file '{}'{}.\n",
                 detail::tracking_entry{ "data_set_read", "num_data_points", num_data_points_ },
                 detail::tracking_entry{ "data_set_read", "num_features", num_features_ },
                 detail::tracking_entry{ "data_set_read", "time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
                 detail::tracking_entry{ "data_set_read", "format", format },
-                detail::tracking_entry{ "data_set_read", "filename", filename });
+                detail::tracking_entry{ "data_set_read", "filename", filename },
+                cache_hit ? " (memory mapped from the data set cache)" : "");
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "data_set_read", "cache_hit", cache_hit }));
+}
+
+template <typename T, typename U>
+void data_set<T, U>::store_in_data_set_cache(const std::filesystem::path &entry, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) const {
+    std::filesystem::path temporary_file{};
+    try {
+        temporary_file = detail::io::create_data_set_cache_file(data_set_cache, entry);
+        if (label.empty()) {
+            detail::io::write_binary_data(temporary_file.string(), data);
+        } else {
+            detail::io::write_binary_data(temporary_file.string(), data, label);
+        }
+        if (detail::io::commit_data_set_cache_entry(data_set_cache, temporary_file, entry)) {
+            detail::log(verbosity_level::full,
+                        "Cached the parsed data set in '{}'.\n",
+                        entry.string());
+        } else {
+            detail::log(verbosity_level::full,
+                        "The parsed data set is larger than the maximum data set cache size of {} bytes and has not been cached.\n",
+                        data_set_cache.max_size);
+        }
+    } catch (const std::exception &e) {
+        if (!temporary_file.empty()) {
+            detail::io::remove_data_set_cache_entry(temporary_file);
+        }
+        detail::log(verbosity_level::full,
+                    "Couldn't cache the parsed data set in '{}': {}\n",
+                    entry.string(),
+                    e.what());
+    }
 }
 
 }  // namespace plssvm
@@ -0,0 +1,256 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the backend independent checkpointing of the CG algorithm used to continue long running solves after an interruption.
+ */
+
+#ifndef PLSSVM_DETAIL_CG_CHECKPOINT_HPP_
+#define PLSSVM_DETAIL_CG_CHECKPOINT_HPP_
+#pragma once
+
+#include "plssvm/detail/arithmetic_type_name.hpp"   // plssvm::detail::arithmetic_type_name
+#include "plssvm/detail/io/checkpoint_parsing.hpp"  // plssvm::detail::io::{checkpoint_data, parse_checkpoint, write_checkpoint}
+#include "plssvm/detail/io/file_reader.hpp"         // plssvm::detail::io::file_reader
+#include "plssvm/detail/logger.hpp"                 // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"    // plssvm::detail::tracking_entry
+#include "plssvm/detail/sha256.hpp"                 // plssvm::detail::sha256
+#include "plssvm/exceptions/exceptions.hpp"         // plssvm::invalid_file_format_exception
+#include "plssvm/parameter.hpp"                     // plssvm::detail::parameter
+
+#include "fmt/chrono.h"                             // format std::chrono types using fmt
+#include "fmt/core.h"                               // fmt::format
+#include "fmt/ostream.h"                            // format types with an operator<< overload using fmt
+
+#include <algorithm>                                // std::min
+#include <chrono>                                   // std::chrono::{time_point, steady_clock, duration_cast, milliseconds}
+#include <cstddef>                                  // std::size_t
+#include <filesystem>                               // std::filesystem::exists
+#include <future>                                   // std::future, std::async, std::launch
+#include <string>                                   // std::string
+#include <utility>                                  // std::move
+#include <vector>                                   // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief The user provided checkpoint settings of a single CG solve.
+ */
+struct checkpoint_config {
+    /// The file the checkpoints are written to and read from.
+    std::string filename{};
+    /// The number of CG iterations between two checkpoints (0 disables writing checkpoints).
+    unsigned long long interval{ 0 };
+    /// If `true`, the CG continues from the checkpoint in `filename` (if the file exists).
+    bool resume{ false };
+
+    /**
+     * @brief Check whether checkpoints are written or read.
+     * @return `true` if checkpointing is enabled, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool enabled() const noexcept { return !filename.empty() && (interval > 0 || resume); }
+};
+
+/**
+ * @brief Calculate a fingerprint of the system of linear equations given by the SVM parameters @p params, the data points @p A, and the right-hand side @p b.
+ * @details The epsilon and maximum number of iterations are **not** part of the fingerprint, i.e., a solve may be continued using a stricter stopping criterion.
+ *          The data points are hashed in blocks to avoid copying the whole data set into a single string.
+ * @tparam real_type the type of the data
+ * @param[in] params the SVM parameters
+ * @param[in] A the data points
+ * @param[in] b the right-hand side
+ * @return the sha256 fingerprint (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] inline std::string checkpoint_fingerprint(const parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b) {
+    constexpr std::size_t block_size = 1024;
+    const sha256 hasher{};
+
+    std::string digests = fmt::format("{}\n{}\n{}x{}\n", arithmetic_type_name<real_type>(), params, A.size(), A.empty() ? 0 : A.front().size());
+    std::string block;
+    for (std::size_t i = 0; i < A.size(); i += block_size) {
+        block.clear();
+        for (std::size_t row = i; row < std::min(i + block_size, A.size()); ++row) {
+            block.append(reinterpret_cast<const char *>(A[row].data()), A[row].size() * sizeof(real_type));
+        }
+        digests += hasher(block);
+    }
+    digests += hasher(std::string(reinterpret_cast<const char *>(b.data()), b.size() * sizeof(real_type)));
+    return hasher(std::move(digests));
+}
+
+/**
+ * @brief Writes periodic checkpoints of a CG solve and restores the CG from a previously written checkpoint.
+ * @details The backends call the member functions at the respective positions of their CG loop:
+ *          1. plssvm::detail::cg_checkpoint::restore after the initial residual has been calculated,
+ *          2. plssvm::detail::cg_checkpoint::write after each update of the search direction,
+ *          3. plssvm::detail::cg_checkpoint::finish after the CG loop has been finished.
+ *          The checkpoints are written asynchronously, i.e., the CG only has to wait if the previous checkpoint hasn't been written yet.
+ *          If checkpointing is disabled, all member functions are no-ops.
+ * @tparam T the floating point type of the data
+ */
+template <typename T>
+class cg_checkpoint {
+  public:
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+
+    /**
+     * @brief Setup the checkpointing for the system of linear equations given by @p params, @p A, and @p b.
+     * @param[in] config the checkpoint settings
+     * @param[in] params the SVM parameters
+     * @param[in] A the data points
+     * @param[in] b the right-hand side
+     */
+    cg_checkpoint(checkpoint_config config, const parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b);
+    /**
+     * @brief Delete the copy-constructor since the pending checkpoint can't be copied.
+     */
+    cg_checkpoint(const cg_checkpoint &) = delete;
+    /**
+     * @brief Delete the copy-assignment operator since the pending checkpoint can't be copied.
+     */
+    cg_checkpoint &operator=(const cg_checkpoint &) = delete;
+    /**
+     * @brief Wait for the pending checkpoint (if any) to be written.
+     */
+    ~cg_checkpoint();
+
+    /**
+     * @brief Overwrite the CG state with the one in the checkpoint file if the CG should be resumed and the checkpoint file exists.
+     * @param[out] x the solution vector
+     * @param[out] r the residual
+     * @param[out] d the search direction
+     * @param[out] delta the squared residual norm
+     * @param[out] delta0 the initial squared residual norm
+     * @param[out] iteration the number of already performed CG iterations
+     * @throws plssvm::invalid_file_format_exception if the checkpoint has been written for another system of linear equations
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_checkpoint
+     * @return `true` if the CG state has been restored, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool restore(std::vector<real_type> &x, std::vector<real_type> &r, std::vector<real_type> &d, real_type &delta, real_type &delta0, unsigned long long &iteration) const;
+    /**
+     * @brief Asynchronously write the CG state to the checkpoint file if @p iteration is a multiple of the checkpoint interval.
+     * @details Only waits if the previous checkpoint hasn't been written yet.
+     * @param[in] iteration the number of already performed CG iterations
+     * @param[in] x the solution vector
+     * @param[in] r the residual
+     * @param[in] d the search direction
+     * @param[in] delta the squared residual norm
+     * @param[in] delta0 the initial squared residual norm
+     */
+    void write(unsigned long long iteration, const std::vector<real_type> &x, const std::vector<real_type> &r, const std::vector<real_type> &d, real_type delta, real_type delta0);
+    /**
+     * @brief Wait for the pending checkpoint (if any) to be written and output the checkpoint overhead.
+     */
+    void finish();
+
+  private:
+    /// The checkpoint settings.
+    checkpoint_config config_{};
+    /// The fingerprint of the current system of linear equations.
+    std::string fingerprint_{};
+    /// The checkpoint currently written in the background.
+    std::future<void> pending_{};
+    /// The number of written checkpoints.
+    unsigned long long num_checkpoints_{ 0 };
+    /// The time the CG loop has been blocked due to checkpointing.
+    std::chrono::milliseconds overhead_{};
+};
+
+template <typename T>
+cg_checkpoint<T>::cg_checkpoint(checkpoint_config config, const parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b) :
+    config_{ std::move(config) } {
+    if (config_.enabled()) {
+        fingerprint_ = checkpoint_fingerprint(params, A, b);
+    }
+}
+
+template <typename T>
+cg_checkpoint<T>::~cg_checkpoint() {
+    if (pending_.valid()) {
+        pending_.wait();
+    }
+}
+
+template <typename T>
+bool cg_checkpoint<T>::restore(std::vector<real_type> &x, std::vector<real_type> &r, std::vector<real_type> &d, real_type &delta, real_type &delta0, unsigned long long &iteration) const {
+    if (!config_.enabled() || !config_.resume) {
+        return false;
+    }
+    if (!std::filesystem::exists(config_.filename)) {
+        detail::log(verbosity_level::full,
+                    "No checkpoint file '{}' found, starting the CG from scratch.\n",
+                    config_.filename);
+        return false;
+    }
+
+    // read the checkpoint file
+    io::file_reader reader{ config_.filename };
+    reader.read_lines('#');
+    io::checkpoint_data<real_type> data = io::parse_checkpoint<real_type>(reader);
+
+    // the checkpoint must belong to the current system of linear equations
+    if (data.fingerprint != fingerprint_ || data.x.size() != x.size()) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' has been written for another data set or other SVM parameters!", config_.filename) };
+    }
+
+    x = std::move(data.x);
+    r = std::move(data.r);
+    d = std::move(data.d);
+    delta = data.delta;
+    delta0 = data.delta0;
+    iteration = data.iteration;
+
+    detail::log(verbosity_level::full,
+                "Resuming the CG from the checkpoint file '{}' after {} iterations.\n",
+                config_.filename,
+                detail::tracking_entry{ "checkpoint", "resumed_iteration", iteration });
+    return true;
+}
+
+template <typename T>
+void cg_checkpoint<T>::write(const unsigned long long iteration, const std::vector<real_type> &x, const std::vector<real_type> &r, const std::vector<real_type> &d, const real_type delta, const real_type delta0) {
+    if (!config_.enabled() || config_.interval == 0 || iteration % config_.interval != 0) {
+        return;
+    }
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // wait for the previous checkpoint to be written
+    if (pending_.valid()) {
+        pending_.get();
+    }
+    // copy the current CG state and write it in the background
+    pending_ = std::async(std::launch::async, [filename = config_.filename, data = io::checkpoint_data<real_type>{ fingerprint_, iteration, delta, delta0, x, r, d }]() {
+        io::write_checkpoint(filename, data);
+    });
+    ++num_checkpoints_;
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    overhead_ += std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+}
+
+template <typename T>
+void cg_checkpoint<T>::finish() {
+    if (!pending_.valid()) {
+        return;
+    }
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+    pending_.get();
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    overhead_ += std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Wrote {} checkpoints to '{}' with a total overhead of {}.\n",
+                detail::tracking_entry{ "checkpoint", "num_checkpoints", num_checkpoints_ },
+                config_.filename,
+                detail::tracking_entry{ "checkpoint", "overhead", overhead_ });
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_CG_CHECKPOINT_HPP_
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the backend independent progress reporting and cancellation of the CG algorithm.
+ */
+
+#ifndef PLSSVM_DETAIL_CG_MONITOR_HPP_
+#define PLSSVM_DETAIL_CG_MONITOR_HPP_
+#pragma once
+
+#include "plssvm/cancellation_token.hpp"          // plssvm::cancellation_token
+#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry
+#include "plssvm/solver_progress.hpp"             // plssvm::solver_progress, plssvm::progress_callback_type
+
+#include <chrono>                                 // std::chrono::{time_point, steady_clock, duration_cast, milliseconds}
+#include <cmath>                                  // std::sqrt
+#include <utility>                                // std::move
+
+namespace plssvm::detail {
+
+/**
+ * @brief Reports the progress of the CG algorithm and checks whether the CG should be cancelled.
+ * @details The backends call plssvm::detail::cg_monitor::report after each CG iteration and stop the CG (keeping the current iterate) if it returns `true`.
+ *          Since the CG minimizes the error in the energy norm monotonically, the current iterate is the best one found so far.
+ *          A default constructed monitor neither reports any progress nor is ever cancelled.
+ */
+class cg_monitor {
+  public:
+    /**
+     * @brief Create a monitor without progress callback observing a new cancellation token.
+     */
+    cg_monitor() = default;
+    /**
+     * @brief Create a monitor invoking @p callback after each CG iteration and observing the cancellation @p token.
+     * @details The elapsed time reported to @p callback is measured starting with the construction of the monitor.
+     * @param[in] callback the progress callback (may be empty)
+     * @param[in] token the cancellation token
+     */
+    cg_monitor(progress_callback_type callback, cancellation_token token) :
+        callback_{ std::move(callback) },
+        token_{ std::move(token) } {}
+
+    /**
+     * @brief Report the progress after the @p iteration-th CG iteration and check whether the CG should be cancelled.
+     * @tparam real_type the type of the data
+     * @param[in] iteration the number of already performed CG iterations
+     * @param[in] max_iter the maximum number of CG iterations
+     * @param[in] delta the current squared residual norm
+     * @param[in] delta0 the initial squared residual norm
+     * @param[in] eps the relative residual at which the CG stops
+     * @return `true` if the CG should be cancelled, `false` otherwise (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] bool report(const unsigned long long iteration, const unsigned long long max_iter, const real_type delta, const real_type delta0, const real_type eps) const {
+        if (callback_) {
+            const std::chrono::time_point now = std::chrono::steady_clock::now();
+            const double residual = delta0 > real_type{ 0.0 } ? std::sqrt(static_cast<double>(delta) / static_cast<double>(delta0)) : 0.0;
+            callback_(solver_progress{ iteration, max_iter, residual, static_cast<double>(eps), std::chrono::duration_cast<std::chrono::milliseconds>(now - start_time_) });
+        }
+        if (token_.cancellation_requested()) {
+            detail::log(verbosity_level::full,
+                        "Cancelled the CG after {} iterations.\n",
+                        detail::tracking_entry{ "cg", "cancelled_iteration", iteration });
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Return the cancellation token observed by this monitor.
+     * @return the cancellation token (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const cancellation_token &token() const noexcept { return token_; }
+    /**
+     * @brief Check whether a progress callback has been set.
+     * @return `true` if a progress callback is invoked after each CG iteration, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool has_callback() const noexcept { return static_cast<bool>(callback_); }
+
+  private:
+    /// The callback invoked after each CG iteration.
+    progress_callback_type callback_{};
+    /// The observed cancellation token.
+    cancellation_token token_{};
+    /// The time point used to calculate the elapsed time.
+    std::chrono::steady_clock::time_point start_time_{ std::chrono::steady_clock::now() };
+};
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_CG_MONITOR_HPP_
@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a small dense Cholesky solver used for the low-dimensional systems of linear equations arising in the approximate training methods.
+ */
+
+#ifndef PLSSVM_DETAIL_CHOLESKY_HPP_
+#define PLSSVM_DETAIL_CHOLESKY_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+#include <algorithm>                 // std::max
+#include <cmath>                     // std::sqrt
+#include <cstddef>                   // std::size_t
+#include <vector>                    // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Solve the symmetric positive (semi-)definite system of linear equations @p A * x = @p b in-place using a Cholesky decomposition.
+ * @details If the decomposition fails, an increasing regularization (relative to the largest diagonal entry) is added to the diagonal.
+ * @param[in,out] A the `b.size()` x `b.size()` matrix stored row-wise; overwritten by its Cholesky factor
+ * @param[in,out] b the right-hand side; overwritten by the solution
+ * @return `true` if the system could be solved, `false` if the decomposition failed even with regularization (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline bool solve_cholesky(std::vector<double> &A, std::vector<double> &b) {
+    using size_type = std::size_t;
+
+    const size_type dim = b.size();
+    PLSSVM_ASSERT(A.size() == dim * dim, "Sizes mismatch!: {} != {}", A.size(), dim * dim);
+
+    // scale the regularization with the largest diagonal entry
+    double max_diagonal{ 0.0 };
+    for (size_type i = 0; i < dim; ++i) {
+        max_diagonal = std::max(max_diagonal, A[i * dim + i]);
+    }
+
+    const std::vector<double> A_original{ A };
+    double regularization{ 0.0 };
+    for (int attempt = 0; attempt < 10; ++attempt) {
+        // A = L * L^T; L is stored in the lower triangular part of A
+        bool success = true;
+        for (size_type j = 0; j < dim && success; ++j) {
+            double diagonal = A[j * dim + j] + regularization;
+            for (size_type k = 0; k < j; ++k) {
+                diagonal -= A[j * dim + k] * A[j * dim + k];
+            }
+            if (diagonal <= 0.0) {
+                success = false;
+                break;
+            }
+            const double L_jj = std::sqrt(diagonal);
+            A[j * dim + j] = L_jj;
+            #pragma omp parallel for default(none) shared(A) firstprivate(dim, j, L_jj)
+            for (size_type i = j + 1; i < dim; ++i) {
+                double value = A[i * dim + j];
+                for (size_type k = 0; k < j; ++k) {
+                    value -= A[i * dim + k] * A[j * dim + k];
+                }
+                A[i * dim + j] = value / L_jj;
+            }
+        }
+
+        if (success) {
+            // forward substitution: L * z = b
+            for (size_type i = 0; i < dim; ++i) {
+                double value = b[i];
+                for (size_type k = 0; k < i; ++k) {
+                    value -= A[i * dim + k] * b[k];
+                }
+                b[i] = value / A[i * dim + i];
+            }
+            // backward substitution: L^T * x = z
+            for (size_type i = dim; i-- > 0;) {
+                double value = b[i];
+                for (size_type k = i + 1; k < dim; ++k) {
+                    value -= A[k * dim + i] * b[k];
+                }
+                b[i] = value / A[i * dim + i];
+            }
+            return true;
+        }
+
+        // the matrix is (numerically) singular, e.g., due to duplicated data points -> retry with a larger regularization
+        A = A_original;
+        regularization = regularization == 0.0 ? 1e-12 * max_diagonal : regularization * 100.0;
+    }
+    return false;
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_CHOLESKY_HPP_
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "plssvm/data_set.hpp"                   // plssvm::data_set
+#include "plssvm/detail/cmd/parser_grid.hpp"     // plssvm::detail::cmd::parser_grid
 #include "plssvm/detail/cmd/parser_predict.hpp"  // plssvm::detail::cmd::parser_predict
 #include "plssvm/detail/cmd/parser_scale.hpp"    // plssvm::detail::cmd::parser_scale
 #include "plssvm/detail/cmd/parser_train.hpp"    // plssvm::detail::cmd::parser_train
@@ -41,7 +42,7 @@ using data_set_variants = std::variant<plssvm::data_set<float, int>, plssvm::dat
  */
 template <typename real_type, typename label_type = typename data_set<real_type>::label_type>
 [[nodiscard]] inline data_set_variants data_set_factory_impl(const cmd::parser_train &cmd_parser) {
-    return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename } };
+    return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename, cmd_parser.input_options, cmd_parser.subset } };
 }
 /**
  * @brief Return the correct data set type based on the plssvm::detail::cmd::parser_predict command line options.
@@ -52,7 +53,18 @@ template <typename real_type, typename label_type = typename data_set<real_type>
  */
 template <typename real_type, typename label_type = typename data_set<real_type>::label_type>
 [[nodiscard]] inline data_set_variants data_set_factory_impl(const cmd::parser_predict &cmd_parser) {
-    return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename } };
+    return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename, cmd_parser.input_options } };
+}
+/**
+ * @brief Return the correct data set type based on the plssvm::detail::cmd::parser_grid command line options.
+ * @tparam real_type the type of the data points
+ * @tparam label_type the type of the labels
+ * @param[in] cmd_parser the provided command line parser
+ * @return the data set type based on the provided command line parser (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type = typename data_set<real_type>::label_type>
+[[nodiscard]] inline data_set_variants data_set_factory_impl(const cmd::parser_grid &cmd_parser) {
+    return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename, cmd_parser.input_options } };
 }
 /**
  * @brief Return the correct data set type based on the plssvm::detail::cmd::parser_scale command line options.
@@ -64,15 +76,15 @@ template <typename real_type, typename label_type = typename data_set<real_type>
 template <typename real_type, typename label_type = typename data_set<real_type>::label_type>
 [[nodiscard]] inline data_set_variants data_set_factory_impl(const cmd::parser_scale &cmd_parser) {
     if (!cmd_parser.restore_filename.empty()) {
-        return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename, { cmd_parser.restore_filename } } };
+        return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename, cmd_parser.input_options, { cmd_parser.restore_filename } } };
     } else {
-        return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename, { static_cast<real_type>(cmd_parser.lower), static_cast<real_type>(cmd_parser.upper) } } };
+        return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename, cmd_parser.input_options, { static_cast<real_type>(cmd_parser.lower), static_cast<real_type>(cmd_parser.upper) } } };
     }
 }
 
 /**
  * @brief Based on the provided command line @p cmd_parser, return the correct plssvm::data_set type.
- * @tparam cmd_parser_type the type of the command line parser (train, predict, or scale)
+ * @tparam cmd_parser_type the type of the command line parser (train, grid, predict, or scale)
  * @param[in] cmd_parser the provided command line parser
  * @return the data set type based on the provided command line parser (`[[nodiscard]]`)
  */
@@ -0,0 +1,86 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a class encapsulating all necessary parameters for a grid search over the C-SVM parameters possibly provided through command line arguments.
+ */
+
+#ifndef PLSSVM_DETAIL_CMD_PARSER_GRID_HPP_
+#define PLSSVM_DETAIL_CMD_PARSER_GRID_HPP_
+#pragma once
+
+#include "plssvm/default_value.hpp"             // plssvm::default_value
+#include "plssvm/detail/io/data_set_cache.hpp"  // plssvm::data_set_cache_options
+#include "plssvm/file_format_types.hpp"         // plssvm::csv_options
+#include "plssvm/parameter.hpp"                 // plssvm::parameter
+
+#include <cstddef>                              // std::size_t
+#include <iosfwd>                               // forward declare std::ostream
+#include <string>                               // std::string
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::cmd {
+
+/**
+ * @brief Class for encapsulating all necessary parameters for a grid search; normally provided through command line arguments.
+ */
+class parser_grid {
+  public:
+    /**
+     * @brief Parse the command line arguments @p argv using [`cxxopts`](https://github.com/jarro2783/cxxopts) and set the grid search parameters accordingly.
+     * @details If no model filename is given, uses the input filename and appends a ".model". The model file of the best grid point is than saved in the current working directory.
+     * @param[in] argc the number of passed command line arguments
+     * @param[in] argv the command line arguments
+     */
+    parser_grid(int argc, char **argv);
+
+    /// Other base C-SVM parameters (the kernel function, `degree`, and `coef0`).
+    plssvm::parameter csvm_params{};
+    /// The `gamma` values to test; if empty, uses 1 / num_features.
+    std::vector<double> gamma_values{};
+    /// The `cost` values to test; if empty, uses the default cost.
+    std::vector<double> cost_values{};
+
+    /// The error tolerance parameter for the CG algorithm.
+    default_value<double> epsilon{ default_init<double>{ 0.001 } };
+    /// The maximum number of iterations in the CG algorithm.
+    default_value<std::size_t> max_iter{ default_init<std::size_t>{ 0 } };
+
+    /// The delimiter, header, and label column used to read CSV (and NumPy) input files.
+    csv_options input_options{};
+    /// The settings of the cache storing the parsed content of text input files.
+    data_set_cache_options cache_options{};
+
+    /// `true` if `std::string` should be used as label type instead of the default type `ìnt`.
+    bool strings_as_labels{ false };
+    /// `true` if `float` should be used as real type instead of the default type `double`.
+    bool float_as_real_type{ false };
+
+    /// The name of the data file to parse.
+    std::string input_filename{};
+    /// The name of the data file used to score the grid points; if empty, the grid points are scored using the input file.
+    std::string validation_filename{};
+    /// The name of the model file to write the best learned model to.
+    std::string model_filename{};
+    /// The name of the file to write the ranking of all grid points to; if empty, the ranking is only printed.
+    std::string ranking_filename{};
+
+    /// If performance tracking has been enabled, provides the name of the file where the performance tracking results are saved to. If the filename is empty, the results are dumped to stdout instead.
+    std::string performance_tracking_filename{};
+};
+
+/**
+ * @brief Output all grid search parameters encapsulated by @p params to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the parameters to
+ * @param[in] params the parameters
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const parser_grid &params);
+
+}  // namespace plssvm::detail::cmd
+
+#endif  // PLSSVM_DETAIL_CMD_PARSER_GRID_HPP_
@@ -15,8 +15,11 @@
 
 #include "plssvm/backend_types.hpp"                      // plssvm::backend_type
 #include "plssvm/backends/SYCL/implementation_type.hpp"  // plssvm::sycl::implementation_type
+#include "plssvm/detail/io/data_set_cache.hpp"           // plssvm::data_set_cache_options
+#include "plssvm/file_format_types.hpp"                  // plssvm::csv_options
 #include "plssvm/target_platforms.hpp"                   // plssvm::target_platform
 
+#include <cstddef>                                       // std::size_t
 #include <iosfwd>                                        // forward declare std::ostream
 #include <string>                                        // std::string
 
@@ -43,6 +46,11 @@ class parser_predict {
     /// The SYCL implementation to use with `--backend sycl`: automatic (depending on the SYCL implementation defined during the CMake configuration), hipsycl, or dpcpp.
     sycl::implementation_type sycl_implementation_type{ sycl::implementation_type::automatic };
 
+    /// The delimiter, header, and label column used to read CSV (and NumPy) input files.
+    csv_options input_options{};
+    /// The settings of the cache storing the parsed content of text input files.
+    data_set_cache_options cache_options{};
+
     /// `true` if `std::string` should be used as label type instead of the default type `ìnt`.
     bool strings_as_labels{ false };
     /// `true` if `float` should be used as real type instead of the default type `double`.
@@ -55,6 +63,11 @@ class parser_predict {
     /// The name of the file to write the predicted labels to.
     std::string predict_filename{};
 
+    /// The maximum number of data points read and predicted at once; `0` reads the whole data set at once (unless a memory limit is given).
+    std::size_t chunk_size{ 0 };
+    /// The maximum memory in MiB used for the data points while predicting in chunks; `0` means no limit.
+    std::size_t max_memory{ 0 };
+
     /// If performance tracking has been enabled, provides the name of the file where the performance tracking results are saved to. If the filename is empty, the results are dumped to stdout instead.
     std::string performance_tracking_filename{};
 };
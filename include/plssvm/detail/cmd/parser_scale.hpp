@@ -13,10 +13,11 @@
 #define PLSSVM_DETAIL_CMD_PARSER_SCALE_HPP_
 #pragma once
 
-#include "plssvm/file_format_types.hpp"  // plssvm::file_format_type
+#include "plssvm/detail/io/data_set_cache.hpp"  // plssvm::data_set_cache_options
+#include "plssvm/file_format_types.hpp"         // plssvm::{file_format_type, csv_options}
 
-#include <iosfwd>                        // forward declare std::ostream
-#include <string>                        // std::string
+#include <iosfwd>                               // forward declare std::ostream
+#include <string>                               // std::string
 
 namespace plssvm::detail::cmd {
 
@@ -37,9 +38,14 @@ class parser_scale {
     double lower{ -1.0 };
     /// The upper bound of the scaled data values.
     double upper{ +1.0 };
-    /// The file type (currently either LIBSVM or ARFF) to which the scaled data should be written to.
+    /// The file type (currently either LIBSVM, ARFF, or binary) to which the scaled data should be written to.
     file_format_type format{ file_format_type::libsvm };
 
+    /// The delimiter, header, and label column used to read CSV (and NumPy) input files.
+    csv_options input_options{};
+    /// The settings of the cache storing the parsed content of text input files.
+    data_set_cache_options cache_options{};
+
     /// `true` if `std::string` should be used as label type instead of the default type `ìnt`.
     bool strings_as_labels{ false };
     /// `true` if `float` should be used as real type instead of the default type `double`.
@@ -17,12 +17,17 @@
 #include "plssvm/backends/SYCL/implementation_type.hpp"     // plssvm::sycl::implementation_type
 #include "plssvm/backends/SYCL/kernel_invocation_type.hpp"  // plssvm::sycl::kernel_invocation_type
 #include "plssvm/default_value.hpp"                         // plssvm::default_value
+#include "plssvm/detail/io/data_set_cache.hpp"              // plssvm::data_set_cache_options
+#include "plssvm/file_format_types.hpp"                     // plssvm::csv_options, plssvm::subset_options
+#include "plssvm/landmark_selection_types.hpp"              // plssvm::landmark_selection_type
 #include "plssvm/parameter.hpp"                             // plssvm::parameter
+#include "plssvm/solver_types.hpp"                          // plssvm::solver_type
 #include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
 
 #include <cstddef>                                          // std::size_t
 #include <iosfwd>                                           // forward declare std::ostream
 #include <string>                                           // std::string
+#include <vector>                                           // std::vector
 
 namespace plssvm::detail::cmd {
 
@@ -41,22 +46,74 @@ class parser_train {
 
     /// Other base C-SVM parameters
     plssvm::parameter csvm_params{};
+    /// The `cost` values to learn one model each for using a single CG run; if empty, only one model using the `cost` value in `csvm_params` is learned.
+    std::vector<double> cost_path{};
 
     /// The error tolerance parameter for the CG algorithm.
     default_value<double> epsilon{ default_init<double>{ 0.001 } };
     /// The maximum number of iterations in the CG algorithm.
     default_value<std::size_t> max_iter{ default_init<std::size_t>{ 0 } };
+    /// The CG variant used to solve the system of linear equations.
+    solver_type solver{ solver_type::cg };
+    /// The file the deflation vectors of previous trainings are read from and written to (Krylov subspace recycling); empty if no solver state should be used.
+    std::string solver_state_filename{};
+    /// The number of CG iterations between two checkpoints; `0` if no checkpoints should be written.
+    unsigned long long checkpoint_interval{ 0 };
+    /// `true` if the CG should be continued from the last checkpoint (if present).
+    bool resume{ false };
+    /// The file the CG checkpoints are written to and resumed from (default: `model_filename.checkpoint`).
+    std::string checkpoint_filename{};
+    /// `true` if the data points in the input file should be added to the model in the model file (incremental training warm started using the model's weights).
+    bool append{ false };
+
+    /// `true` if only the leave-one-out accuracy should be calculated instead of saving a model file.
+    bool loo{ false };
+    /// The number of random probing vectors used to estimate the leave-one-out residuals.
+    default_value<std::size_t> loo_probes{ default_init<std::size_t>{ 10 } };
+    /// The number of folds used in a k-fold cross-validation instead of saving a model file; `0` if no cross-validation should be performed.
+    std::size_t cross_validation{ 0 };
+    /// The number of partitions used in the cascade training; `1` if a single system of linear equations should be solved.
+    std::size_t num_partitions{ 1 };
+
+    /// The number of landmarks used to approximately train a fixed-size LS-SVM; `0` if the exact LS-SVM should be trained.
+    std::size_t num_landmarks{ 0 };
+    /// The strategy used to select the landmarks of the fixed-size LS-SVM.
+    landmark_selection_type landmark_selection{ landmark_selection_type::uniform };
+
+    /// The number of support vectors the sparse LS-SVM is pruned to during training; `0` if no data points should be pruned.
+    std::size_t prune_to{ 0 };
+    /// The fraction of the remaining data points removed in each round of the sparse LS-SVM training.
+    default_value<double> prune_fraction{ default_init<double>{ 0.05 } };
+    /// The maximum decrease of the training accuracy tolerated while pruning the sparse LS-SVM.
+    default_value<double> max_accuracy_drop{ default_init<double>{ 1.0 } };
+
+    /// The number of support vectors the learned model is reduced to before saving it; `0` if all support vectors should be kept.
+    std::size_t reduce_to{ 0 };
+    /// The maximum fraction of the original support vectors whose predicted label may change due to the support vector reduction.
+    default_value<double> reduce_tolerance{ default_init<double>{ 1.0 } };
 
     /// The used backend: automatic (depending on the specified target_platforms), OpenMP, CUDA, HIP, OpenCL, or SYCL.
     backend_type backend{ backend_type::automatic };
     /// The target platform: automatic (depending on the used backend), CPUs or GPUs from NVIDIA, AMD or Intel.
     target_platform target{ target_platform::automatic };
 
+    /// The relative tolerance used to compress the kernel matrix using a HODLR approximation when using OpenMP as backend; `0.0` if the dense kernel matrix should be used.
+    double hodlr_tolerance{ 0.0 };
+    /// The value below which rbf kernel matrix entries are dropped when using OpenMP as backend; `0.0` if the dense kernel matrix should be used.
+    double rbf_cutoff{ 0.0 };
+
     /// The kernel invocation type when using SYCL as backend.
     sycl::kernel_invocation_type sycl_kernel_invocation_type{ sycl::kernel_invocation_type::automatic };
     /// The SYCL implementation to use with --backend=sycl.
     sycl::implementation_type sycl_implementation_type{ sycl::implementation_type::automatic };
 
+    /// The delimiter, header, and label column used to read CSV (and NumPy) input files.
+    csv_options input_options{};
+    /// The settings of the cache storing the parsed content of text input files.
+    data_set_cache_options cache_options{};
+    /// The zero-based features and the number of data points read from the input file; by default, all features of all data points are read.
+    subset_options subset{};
+
     /// `true` if `std::string` should be used as label type instead of the default type `ìnt`.
     bool strings_as_labels{ false };
     /// `true` if `float` should be used as real type instead of the default type `double`.
@@ -0,0 +1,427 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the backend independent parts of the deflated CG algorithm used to recycle Krylov subspace information across related solves.
+ */
+
+#ifndef PLSSVM_DETAIL_DEFLATED_CG_HPP_
+#define PLSSVM_DETAIL_DEFLATED_CG_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"    // PLSSVM_ASSERT
+#include "plssvm/detail/cholesky.hpp"  // plssvm::detail::solve_cholesky
+#include "plssvm/detail/logger.hpp"    // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/solver_state.hpp"     // plssvm::solver_state
+
+#include <algorithm>                   // std::fill, std::max, std::min, std::sort
+#include <cmath>                       // std::abs, std::sqrt
+#include <cstddef>                     // std::size_t
+#include <functional>                  // std::function
+#include <numeric>                     // std::iota
+#include <utility>                     // std::move
+#include <vector>                      // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Deflated CG (Saad, Yeung, Erhel, and Guyomarc'h, 2000) using the deflation vectors \f$W\f$ stored in a plssvm::solver_state.
+ * @details The backends call the member functions at the respective positions of their CG loop:
+ *          1. plssvm::detail::deflated_cg::initial_guess after the initial residual has been calculated,
+ *          2. plssvm::detail::deflated_cg::project after each update of the search direction,
+ *          3. plssvm::detail::deflated_cg::record after each matrix-vector product,
+ *          4. plssvm::detail::deflated_cg::update_state after the CG loop has been finished.
+ *          The search directions are kept \f$A\f$-orthogonal to \f$W\f$, i.e., the CG effectively works on the system with the eigenvalues belonging to \f$W\f$ removed.
+ *          Afterward, the new deflation vectors are calculated using the Rayleigh-Ritz procedure on \f$[W, P]\f$, where \f$P\f$ are the first search directions of the current solve.
+ *          If no solver state is given, all member functions are no-ops.
+ * @tparam T the floating point type of the data
+ */
+template <typename T>
+class deflated_cg {
+  public:
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+    /// The type of the function calculating the matrix-vector product `result = A * vec` of the reduced system matrix (@p result is overwritten).
+    using matvec_type = std::function<void(const std::vector<real_type> &vec, std::vector<real_type> &result)>;
+
+    /**
+     * @brief Setup the deflated CG using the deflation vectors in @p state.
+     * @details Calculates \f$AW\f$ (one matrix-vector product per deflation vector) and \f$W^TAW\f$.
+     *          If the deflation vectors in @p state have been calculated for a system with another size, they are ignored (and replaced after the solve).
+     * @param[in,out] state the solver state; may be `nullptr`
+     * @param[in] num_rows the size of the reduced system of linear equations
+     * @param[in] matvec the function calculating the matrix-vector product with the reduced system matrix
+     */
+    deflated_cg(solver_state<real_type> *state, size_type num_rows, matvec_type matvec);
+
+    /**
+     * @brief Check whether the CG is currently deflated, i.e., a solver state with usable deflation vectors is present.
+     * @return `true` if the CG is deflated, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool is_deflated() const noexcept { return !W_.empty(); }
+
+    /**
+     * @brief Improve the initial guess @p x such that the residual @p r is orthogonal to the deflation vectors: \f$x = x + W(W^TAW)^{-1}W^Tr\f$.
+     * @details The residual is updated accordingly without an additional matrix-vector product.
+     * @param[in,out] x the initial guess
+     * @param[in,out] r the initial residual \f$b - Ax\f$
+     */
+    void initial_guess(std::vector<real_type> &x, std::vector<real_type> &r) const;
+    /**
+     * @brief Remove the components of the search direction @p d in the direction of the deflation vectors: \f$d = d - W(W^TAW)^{-1}(AW)^Tr\f$.
+     * @param[in,out] d the current search direction
+     * @param[in] r the current residual
+     */
+    void project(std::vector<real_type> &d, const std::vector<real_type> &r) const;
+    /**
+     * @brief Remember the search direction @p d and @p Ad for the calculation of the next deflation vectors.
+     * @details Only the first `2 * max_vectors` search directions are remembered.
+     * @param[in] d the current search direction
+     * @param[in] Ad the matrix-vector product of the current search direction
+     */
+    void record(const std::vector<real_type> &d, const std::vector<real_type> &Ad);
+    /**
+     * @brief Calculate the new deflation vectors, i.e., the Ritz vectors belonging to the smallest Ritz values in the space spanned by the old deflation vectors and the remembered search directions.
+     * @param[in] num_iterations the number of performed CG iterations
+     */
+    void update_state(unsigned long long num_iterations);
+
+  private:
+    /**
+     * @brief Solve \f$(W^TAW)y = @p rhs\f$.
+     * @param[in] rhs the right-hand side
+     * @return the solution (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<double> solve_coarse(std::vector<double> rhs) const;
+    /**
+     * @brief Calculate all eigenvalues and eigenvectors of the symmetric @p dim x @p dim matrix @p M using the cyclic Jacobi method.
+     * @param[in,out] M the matrix stored row-wise; the eigenvalues are stored on its diagonal afterward
+     * @param[in] dim the size of the matrix
+     * @return the eigenvectors stored column-wise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static std::vector<double> jacobi_eigen(std::vector<double> &M, size_type dim);
+
+    /// The solver state; may be `nullptr`.
+    solver_state<real_type> *state_{ nullptr };
+    /// The size of the reduced system of linear equations.
+    size_type num_rows_{ 0 };
+    /// The function calculating the matrix-vector product with the reduced system matrix.
+    matvec_type matvec_{};
+    /// The deflation vectors \f$W\f$.
+    std::vector<std::vector<real_type>> W_{};
+    /// The matrix-vector products \f$AW\f$.
+    std::vector<std::vector<real_type>> AW_{};
+    /// The coarse matrix \f$W^TAW\f$ stored row-wise.
+    std::vector<double> E_{};
+    /// The remembered search directions \f$P\f$.
+    std::vector<std::vector<real_type>> P_{};
+    /// The remembered matrix-vector products \f$AP\f$.
+    std::vector<std::vector<real_type>> AP_{};
+};
+
+template <typename T>
+deflated_cg<T>::deflated_cg(solver_state<real_type> *state, const size_type num_rows, matvec_type matvec) :
+    state_{ state },
+    num_rows_{ num_rows },
+    matvec_{ std::move(matvec) } {
+    if (state_ == nullptr || state_->empty()) {
+        return;
+    }
+    if (state_->num_rows() != num_rows_) {
+        detail::log(verbosity_level::full,
+                    "Ignoring the {} deflation vectors of the solver state since their size ({}) doesn't match the size of the system of linear equations ({}).\n",
+                    state_->num_vectors(),
+                    state_->num_rows(),
+                    num_rows_);
+        return;
+    }
+
+    // calculate AW and E = W^T * A * W
+    W_ = state_->vectors_;
+    const size_type k = W_.size();
+    AW_.assign(k, std::vector<real_type>(num_rows_));
+    for (size_type i = 0; i < k; ++i) {
+        matvec_(W_[i], AW_[i]);
+    }
+    E_.assign(k * k, 0.0);
+    for (size_type i = 0; i < k; ++i) {
+        for (size_type j = 0; j <= i; ++j) {
+            double temp{ 0.0 };
+            for (size_type row = 0; row < num_rows_; ++row) {
+                temp += static_cast<double>(W_[i][row]) * static_cast<double>(AW_[j][row]);
+            }
+            E_[i * k + j] = temp;
+            E_[j * k + i] = temp;
+        }
+    }
+    detail::log(verbosity_level::full,
+                "Deflating the CG using {} recycled deflation vectors.\n",
+                k);
+}
+
+template <typename T>
+std::vector<double> deflated_cg<T>::solve_coarse(std::vector<double> rhs) const {
+    // the Cholesky decomposition overwrites the matrix
+    std::vector<double> E{ E_ };
+    if (!detail::solve_cholesky(E, rhs)) {
+        // the deflation vectors are (numerically) linearly dependent -> don't deflate in this direction
+        std::fill(rhs.begin(), rhs.end(), 0.0);
+    }
+    return rhs;
+}
+
+template <typename T>
+void deflated_cg<T>::initial_guess(std::vector<real_type> &x, std::vector<real_type> &r) const {
+    if (!this->is_deflated()) {
+        return;
+    }
+    PLSSVM_ASSERT(x.size() == num_rows_, "Sizes mismatch!: {} != {}", x.size(), num_rows_);
+    PLSSVM_ASSERT(r.size() == num_rows_, "Sizes mismatch!: {} != {}", r.size(), num_rows_);
+
+    // y = E^-1 * W^T * r
+    std::vector<double> rhs(W_.size(), 0.0);
+    for (size_type i = 0; i < W_.size(); ++i) {
+        for (size_type row = 0; row < num_rows_; ++row) {
+            rhs[i] += static_cast<double>(W_[i][row]) * static_cast<double>(r[row]);
+        }
+    }
+    const std::vector<double> y = this->solve_coarse(std::move(rhs));
+
+    // x = x + W * y and r = r - A * W * y
+    for (size_type i = 0; i < W_.size(); ++i) {
+        const auto y_i = static_cast<real_type>(y[i]);
+        for (size_type row = 0; row < num_rows_; ++row) {
+            x[row] += y_i * W_[i][row];
+            r[row] -= y_i * AW_[i][row];
+        }
+    }
+}
+
+template <typename T>
+void deflated_cg<T>::project(std::vector<real_type> &d, const std::vector<real_type> &r) const {
+    if (!this->is_deflated()) {
+        return;
+    }
+    PLSSVM_ASSERT(d.size() == num_rows_, "Sizes mismatch!: {} != {}", d.size(), num_rows_);
+    PLSSVM_ASSERT(r.size() == num_rows_, "Sizes mismatch!: {} != {}", r.size(), num_rows_);
+
+    // mu = E^-1 * (A * W)^T * r
+    std::vector<double> rhs(W_.size(), 0.0);
+    for (size_type i = 0; i < W_.size(); ++i) {
+        for (size_type row = 0; row < num_rows_; ++row) {
+            rhs[i] += static_cast<double>(AW_[i][row]) * static_cast<double>(r[row]);
+        }
+    }
+    const std::vector<double> mu = this->solve_coarse(std::move(rhs));
+
+    // d = d - W * mu
+    for (size_type i = 0; i < W_.size(); ++i) {
+        const auto mu_i = static_cast<real_type>(mu[i]);
+        for (size_type row = 0; row < num_rows_; ++row) {
+            d[row] -= mu_i * W_[i][row];
+        }
+    }
+}
+
+template <typename T>
+void deflated_cg<T>::record(const std::vector<real_type> &d, const std::vector<real_type> &Ad) {
+    if (state_ == nullptr || P_.size() >= 2 * state_->max_vectors()) {
+        return;
+    }
+    P_.push_back(d);
+    AP_.push_back(Ad);
+}
+
+template <typename T>
+void deflated_cg<T>::update_state(const unsigned long long num_iterations) {
+    if (state_ == nullptr) {
+        return;
+    }
+    state_->last_num_iterations_ = num_iterations;
+
+    // Z = [W, P] and A * Z = [A * W, A * P]
+    std::vector<const std::vector<real_type> *> Z;
+    std::vector<const std::vector<real_type> *> AZ;
+    for (size_type i = 0; i < W_.size(); ++i) {
+        Z.push_back(&W_[i]);
+        AZ.push_back(&AW_[i]);
+    }
+    for (size_type i = 0; i < P_.size(); ++i) {
+        Z.push_back(&P_[i]);
+        AZ.push_back(&AP_[i]);
+    }
+    const size_type m = Z.size();
+    if (m == 0) {
+        return;
+    }
+
+    // G = Z^T * Z and F = Z^T * A * Z
+    std::vector<double> G(m * m);
+    std::vector<double> F(m * m);
+    for (size_type i = 0; i < m; ++i) {
+        for (size_type j = 0; j <= i; ++j) {
+            double g{ 0.0 };
+            double f_ij{ 0.0 };
+            double f_ji{ 0.0 };
+            for (size_type row = 0; row < num_rows_; ++row) {
+                g += static_cast<double>((*Z[i])[row]) * static_cast<double>((*Z[j])[row]);
+                f_ij += static_cast<double>((*Z[i])[row]) * static_cast<double>((*AZ[j])[row]);
+                f_ji += static_cast<double>((*Z[j])[row]) * static_cast<double>((*AZ[i])[row]);
+            }
+            G[i * m + j] = G[j * m + i] = g;
+            // symmetrize to remove rounding errors
+            F[i * m + j] = F[j * m + i] = (f_ij + f_ji) / 2.0;
+        }
+    }
+
+    // orthonormalize Z using the eigendecomposition G = U * Lambda * U^T: T = U * Lambda^-1/2 dropping (numerically) linearly dependent directions
+    const std::vector<double> U = jacobi_eigen(G, m);
+    double max_eigenvalue{ 0.0 };
+    for (size_type i = 0; i < m; ++i) {
+        max_eigenvalue = std::max(max_eigenvalue, G[i * m + i]);
+    }
+    std::vector<size_type> kept;
+    for (size_type i = 0; i < m; ++i) {
+        if (G[i * m + i] > 1e-10 * max_eigenvalue) {
+            kept.push_back(i);
+        }
+    }
+    const size_type r = kept.size();
+    if (r == 0) {
+        state_->vectors_.clear();
+        return;
+    }
+    std::vector<double> Tm(m * r);
+    for (size_type j = 0; j < r; ++j) {
+        const double scale = 1.0 / std::sqrt(G[kept[j] * m + kept[j]]);
+        for (size_type i = 0; i < m; ++i) {
+            Tm[i * r + j] = U[i * m + kept[j]] * scale;
+        }
+    }
+
+    // C = T^T * F * T
+    std::vector<double> FT(m * r, 0.0);
+    for (size_type i = 0; i < m; ++i) {
+        for (size_type l = 0; l < m; ++l) {
+            for (size_type j = 0; j < r; ++j) {
+                FT[i * r + j] += F[i * m + l] * Tm[l * r + j];
+            }
+        }
+    }
+    std::vector<double> C(r * r, 0.0);
+    for (size_type i = 0; i < r; ++i) {
+        for (size_type j = 0; j < r; ++j) {
+            for (size_type l = 0; l < m; ++l) {
+                C[i * r + j] += Tm[l * r + i] * FT[l * r + j];
+            }
+        }
+    }
+
+    // Ritz values and vectors: C = V * Theta * V^T
+    const std::vector<double> V = jacobi_eigen(C, r);
+    std::vector<size_type> order(r);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const size_type lhs, const size_type rhs) { return C[lhs * r + lhs] < C[rhs * r + rhs]; });
+
+    // the new deflation vectors are the Ritz vectors Z * T * V belonging to the smallest Ritz values
+    const size_type k = std::min(state_->max_vectors(), r);
+    std::vector<std::vector<real_type>> new_vectors(k, std::vector<real_type>(num_rows_, real_type{ 0.0 }));
+    for (size_type j = 0; j < k; ++j) {
+        // the coefficients of the Ritz vector with respect to Z
+        std::vector<double> coefficients(m, 0.0);
+        for (size_type i = 0; i < m; ++i) {
+            for (size_type l = 0; l < r; ++l) {
+                coefficients[i] += Tm[i * r + l] * V[l * r + order[j]];
+            }
+        }
+        std::vector<double> ritz_vector(num_rows_, 0.0);
+        for (size_type i = 0; i < m; ++i) {
+            for (size_type row = 0; row < num_rows_; ++row) {
+                ritz_vector[row] += coefficients[i] * static_cast<double>((*Z[i])[row]);
+            }
+        }
+        // normalize the Ritz vector
+        double norm{ 0.0 };
+        for (const double val : ritz_vector) {
+            norm += val * val;
+        }
+        norm = norm > 0.0 ? std::sqrt(norm) : 1.0;
+        for (size_type row = 0; row < num_rows_; ++row) {
+            new_vectors[j][row] = static_cast<real_type>(ritz_vector[row] / norm);
+        }
+    }
+    state_->vectors_ = std::move(new_vectors);
+}
+
+template <typename T>
+std::vector<double> deflated_cg<T>::jacobi_eigen(std::vector<double> &M, const size_type dim) {
+    PLSSVM_ASSERT(M.size() == dim * dim, "Sizes mismatch!: {} != {}", M.size(), dim * dim);
+
+    // start with the identity matrix
+    std::vector<double> V(dim * dim, 0.0);
+    for (size_type i = 0; i < dim; ++i) {
+        V[i * dim + i] = 1.0;
+    }
+
+    constexpr unsigned max_sweeps = 100;
+    for (unsigned sweep = 0; sweep < max_sweeps; ++sweep) {
+        // check whether the off-diagonal entries are small enough
+        double off_diagonal{ 0.0 };
+        double diagonal{ 0.0 };
+        for (size_type i = 0; i < dim; ++i) {
+            diagonal += M[i * dim + i] * M[i * dim + i];
+            for (size_type j = i + 1; j < dim; ++j) {
+                off_diagonal += M[i * dim + j] * M[i * dim + j];
+            }
+        }
+        if (off_diagonal <= 1e-24 * diagonal) {
+            break;
+        }
+
+        // annihilate each off-diagonal entry using a Jacobi rotation
+        for (size_type p = 0; p < dim; ++p) {
+            for (size_type q = p + 1; q < dim; ++q) {
+                const double m_pq = M[p * dim + q];
+                if (m_pq == 0.0) {
+                    continue;
+                }
+                const double theta = (M[q * dim + q] - M[p * dim + p]) / (2.0 * m_pq);
+                const double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                const double c = 1.0 / std::sqrt(t * t + 1.0);
+                const double s = t * c;
+
+                // M = J^T * M * J
+                for (size_type l = 0; l < dim; ++l) {
+                    const double m_lp = M[l * dim + p];
+                    const double m_lq = M[l * dim + q];
+                    M[l * dim + p] = c * m_lp - s * m_lq;
+                    M[l * dim + q] = s * m_lp + c * m_lq;
+                }
+                for (size_type l = 0; l < dim; ++l) {
+                    const double m_pl = M[p * dim + l];
+                    const double m_ql = M[q * dim + l];
+                    M[p * dim + l] = c * m_pl - s * m_ql;
+                    M[q * dim + l] = s * m_pl + c * m_ql;
+                }
+                // V = V * J
+                for (size_type l = 0; l < dim; ++l) {
+                    const double v_lp = V[l * dim + p];
+                    const double v_lq = V[l * dim + q];
+                    V[l * dim + p] = c * v_lp - s * v_lq;
+                    V[l * dim + q] = s * v_lp + c * v_lq;
+                }
+            }
+        }
+    }
+    return V;
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_DEFLATED_CG_HPP_
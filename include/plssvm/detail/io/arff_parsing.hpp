@@ -13,24 +13,30 @@
 #define PLSSVM_DETAIL_IO_ARFF_PARSING_HPP_
 #pragma once
 
-#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
-#include "plssvm/detail/operators.hpp"          // plssvm::operator::sign
-#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
-#include "plssvm/detail/string_utility.hpp"     // plssvm::detail::{to_upper_case, as_upper_case, starts_with, ends_with}
-#include "plssvm/detail/utility.hpp"            // plssvm::detail::current_date_time
-#include "plssvm/exceptions/exceptions.hpp"     // plssvm::exception::invalid_file_format_exception
-
-#include "fmt/format.h"                         // fmt::format, fmt::join
-#include "fmt/os.h"                             // fmt::ostream, fmt::output_file
-
-#include <cstddef>                              // std::size_t
-#include <exception>                            // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception
-#include <set>                                  // std::set
-#include <string>                               // std::string
-#include <string_view>                          // std::string_view
-#include <tuple>                                // std::tuple, std::make_tuple
-#include <utility>                              // std::move
-#include <vector>                               // std::vector
+#include "plssvm/detail/io/data_set_subset.hpp"  // plssvm::detail::io::{feature_projection, check_feature_projection, samples_data_points, sample_uniform, sample_stratified}
+#include "plssvm/detail/io/file_reader.hpp"      // plssvm::detail::io::file_reader
+#include "plssvm/detail/io/ordered_writer.hpp"   // plssvm::detail::io::{write_ordered, ordered_writer_rows_per_block}
+#include "plssvm/detail/operators.hpp"           // plssvm::operator::sign
+#include "plssvm/detail/string_conversion.hpp"   // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"      // plssvm::detail::{to_upper_case, as_upper_case, starts_with, ends_with, split, trim}
+#include "plssvm/detail/utility.hpp"             // plssvm::detail::current_date_time
+#include "plssvm/exceptions/exceptions.hpp"      // plssvm::exception::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"          // plssvm::subset_options
+#include "plssvm/sampling_types.hpp"             // plssvm::sampling_type
+
+#include "fmt/format.h"                          // fmt::format, fmt::format_to, fmt::join
+#include "fmt/os.h"                              // fmt::ostream, fmt::output_file
+
+#include <cstddef>                               // std::size_t
+#include <exception>                             // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <iterator>                              // std::back_inserter
+#include <set>                                   // std::set
+#include <string>                                // std::string
+#include <string_view>                           // std::string_view
+#include <tuple>                                 // std::tuple, std::make_tuple
+#include <type_traits>                           // std::is_same_v
+#include <utility>                               // std::move
+#include <vector>                                // std::vector
 
 namespace plssvm::detail::io {
 
@@ -195,6 +201,41 @@ template <typename label_type>
     return std::make_tuple(num_features, header_line + 1, labels, has_label ? label_idx : 0);
 }
 
+/**
+ * @brief Parse only the label of the single ARFF data point given in @p line, which is located at the attribute with index @p label_idx.
+ * @details Used to draw a stratified sample of the data points before parsing them. The data point itself is validated when it is actually parsed.
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] line the dense or sparse ARFF data point
+ * @param[in] label_idx the attribute index of the label
+ * @throws plssvm::invalid_file_format_exception if the data point has no label
+ * @throws plssvm::invalid_file_format_exception if the label couldn't be converted to the provided @p label_type
+ * @return the label of the data point (`[[nodiscard]]`)
+ */
+template <typename label_type>
+[[nodiscard]] inline label_type parse_arff_label(std::string_view line, const std::size_t label_idx) {
+    if (detail::starts_with(line, '{')) {
+        // sparse data point: search for the entry with the label index
+        line.remove_prefix(1);
+        if (detail::ends_with(line, '}')) {
+            line.remove_suffix(1);
+        }
+        for (const std::string_view entry : detail::split(line, ',')) {
+            const std::string_view trimmed_entry = detail::trim(entry);
+            const std::string_view::size_type pos = trimmed_entry.find(' ');
+            if (pos != std::string_view::npos && detail::convert_to<unsigned long, invalid_file_format_exception>(trimmed_entry.substr(0, pos)) == label_idx) {
+                return detail::convert_to<label_type, invalid_file_format_exception>(trimmed_entry.substr(pos + 1));
+            }
+        }
+    } else {
+        // dense data point
+        const std::vector<std::string_view> line_split = detail::split(line, ',');
+        if (label_idx < line_split.size()) {
+            return detail::convert_to<label_type, invalid_file_format_exception>(line_split[label_idx]);
+        }
+    }
+    throw invalid_file_format_exception{ fmt::format("Missing label for data point \"{}\"!", line) };
+}
+
 /**
  * @brief Parse all data points and potential label using the file @p reader, ignoring all empty lines and lines starting with an `%`.
  *        If no labels are found, returns an empty vector.
@@ -218,6 +259,8 @@ template <typename label_type>
  * @tparam real_type the floating point type
  * @tparam label_type the type of the labels (any arithmetic type or std::string)
  * @param[in] reader the file_reader used to read the ARFF data
+ * @param[in] subset the features to keep and the number of data points to sample; the values of all other features are skipped without converting them
+ *                   and only the sampled data points are parsed (for a stratified sample, the labels of all data points are parsed first)
  * @note The features must be provided with zero-based indices!
  * @throws plssvm::invalid_file_format_exception if no features could be found (may indicate an empty file)
  * @throws plssvm::invalid_file_format_exception if a label couldn't be converted to the provided @p label_type
@@ -230,10 +273,12 @@ template <typename label_type>
  * @throws plssvm::invalid_file_format_exception if the ARFF header specifies labels but any data point misses a label
  * @throws plssvm::invalid_file_format_exception if the number of found features and labels mismatches the numbers provided in the ARFF header
  * @throws plssvm::invalid_file_format_exception if a label in the data section has been found, that did not appear in the header
+ * @throws plssvm::invalid_file_format_exception if a kept feature index is larger or equal than the number of features provided in the ARFF header
+ * @throws plssvm::invalid_file_format_exception if a stratified sample should be drawn, but the ARFF header specifies no labels
  * @return a std::tuple containing: [num_data_points, num_features, data_points, labels] (`[[nodiscard]]`)
  */
 template <typename real_type, typename label_type>
-[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> parse_arff_data(const file_reader &reader) {
+[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> parse_arff_data(const file_reader &reader, const subset_options &subset = {}) {
     PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
 
     // parse arff header, structured bindings can't be used because of the OpenMP parallel section
@@ -245,21 +290,67 @@ template <typename real_type, typename label_type>
     const bool has_label = !unique_label.empty();
 
     // calculate data set sizes
-    const std::size_t num_data_points = reader.num_lines() - num_header_lines;
+    const std::size_t num_lines = reader.num_lines() - num_header_lines;
     const std::size_t num_attributes = num_features + static_cast<std::size_t>(has_label);
 
-    // create data and label vectors
-    std::vector<std::vector<real_type>> data(num_data_points, std::vector<real_type>(num_features));
-    std::vector<label_type> label(num_data_points);
+    // the values of all features that aren't kept are skipped
+    const feature_projection projection{ subset.features };
+    check_feature_projection(projection, num_features);
 
     std::exception_ptr parallel_exception;
 
-    #pragma omp parallel default(none) shared(reader, data, label, unique_label, parallel_exception) firstprivate(num_header_lines, num_features, num_attributes, has_label, label_idx)
+    // draw the sampled data points; only these lines are parsed afterward
+    std::vector<std::size_t> sample{};
+    if (samples_data_points(subset)) {
+        if (subset.sampling == sampling_type::stratified) {
+            if (!has_label) {
+                throw invalid_file_format_exception{ "Can't draw a stratified sample since the data points have no labels!" };
+            }
+            std::vector<label_type> all_labels(num_lines);
+            #pragma omp parallel for default(none) shared(reader, all_labels, parallel_exception) firstprivate(num_header_lines, label_idx)
+            for (std::size_t i = 0; i < all_labels.size(); ++i) {
+                try {
+                    if constexpr (std::is_same_v<label_type, bool>) {
+                        // the std::vector<bool> template specialization is per C++ standard NOT thread safe
+                        const label_type line_label = parse_arff_label<label_type>(reader.line(i + num_header_lines), label_idx);
+                        #pragma omp critical
+                        all_labels[i] = line_label;
+                    } else {
+                        all_labels[i] = parse_arff_label<label_type>(reader.line(i + num_header_lines), label_idx);
+                    }
+                } catch (const std::exception &) {
+                    // catch first exception and store it
+                    #pragma omp critical
+                    {
+                        if (!parallel_exception) {
+                            parallel_exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+            // rethrow if an exception occurred inside the parallel region
+            if (parallel_exception) {
+                std::rethrow_exception(parallel_exception);
+            }
+            sample = sample_stratified(all_labels, subset.num_samples);
+        } else {
+            sample = sample_uniform(num_lines, subset.num_samples);
+        }
+    }
+    const std::size_t num_data_points = sample.empty() ? num_lines : sample.size();
+    const std::size_t num_kept_features = projection.keeps_all_features() ? num_features : projection.num_features();
+
+    // create data and label vectors
+    std::vector<std::vector<real_type>> data(num_data_points, std::vector<real_type>(num_kept_features));
+    std::vector<label_type> label(num_data_points);
+
+    #pragma omp parallel default(none) shared(reader, data, label, unique_label, parallel_exception, projection, sample) firstprivate(num_header_lines, num_features, num_attributes, has_label, label_idx)
     {
         #pragma omp for
         for (std::size_t i = 0; i < data.size(); ++i) {
             try {
-                std::string_view line = reader.line(i + num_header_lines);
+                const std::size_t line_idx = (sample.empty() ? i : sample[i]) + num_header_lines;
+                std::string_view line = reader.line(line_idx);
                 // there must not be any @ inside the data section
                 if (detail::starts_with(line, '@')) {
                     throw invalid_file_format_exception{ fmt::format("Read @ inside data section!: \"{}\"!", line) };
@@ -310,7 +401,11 @@ template <typename real_type, typename label_type>
                             if (has_label && index > label_idx) {
                                 --index;
                             }
-                            data[i][index] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+                            // skip the values of features that aren't kept without converting them
+                            const std::size_t projected_index = projection[index];
+                            if (projected_index != feature_projection::skip) {
+                                data[i][projected_index] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+                            }
                         }
 
                         // remove already processes part of the line
@@ -320,7 +415,7 @@ template <typename real_type, typename label_type>
                     }
                     // there should be a class label but none has been found
                     if (has_label && !is_class_set) {
-                        throw invalid_file_format_exception{ fmt::format("Missing label for data point \"{}\"!", reader.line(i + num_header_lines)) };
+                        throw invalid_file_format_exception{ fmt::format("Missing label for data point \"{}\"!", reader.line(line_idx)) };
                     }
                 } else {
                     // check if the last character is a closing brace
@@ -345,8 +440,11 @@ template <typename real_type, typename label_type>
                                 label[i] = detail::convert_to<label_type, invalid_file_format_exception>(line_split[j]);
                             }
                         } else {
-                            // found data point
-                            data[i][j] = detail::convert_to<real_type, invalid_file_format_exception>(line_split[j]);
+                            // found data point, the features after the label are shifted by one; skip the values of features that aren't kept without converting them
+                            const std::size_t projected_index = projection[has_label && j > label_idx ? j - 1 : j];
+                            if (projected_index != feature_projection::skip) {
+                                data[i][projected_index] = detail::convert_to<real_type, invalid_file_format_exception>(line_split[j]);
+                            }
                         }
                     }
                 }
@@ -372,7 +470,7 @@ template <typename real_type, typename label_type>
         std::rethrow_exception(parallel_exception);
     }
 
-    return std::make_tuple(num_data_points, num_features, std::move(data), has_label ? std::move(label) : std::vector<label_type>{});
+    return std::make_tuple(num_data_points, num_kept_features, std::move(data), has_label ? std::move(label) : std::vector<label_type>{});
 }
 
 /**
@@ -401,7 +499,7 @@ template <typename real_type, typename label_type>
  * @param[in] filename the filename to write the data to
  * @param[in] data the data points to write to the file
  * @param[in] label the labels to write to the file
- * @note The resulting order of the data points in the ARFF file is unspecified!
+ * @note The data points are written in the same order as in @p data, i.e., the resulting ARFF file is independent of the number of used threads.
  * @note The features are written using zero-based indices!
  */
 template <typename real_type, typename label_type, bool has_label>
@@ -438,23 +536,15 @@ inline void write_arff_data_impl(const std::string &filename, const std::vector<
     }
     out.print("@DATA\n");
 
-    // write arff data
-    #pragma omp parallel default(none) shared(out, data, label) firstprivate(num_data_points)
-    {
-        // all support vectors
-        std::string out_string;
-        #pragma omp for schedule(dynamic) nowait
-        for (std::size_t i = 0; i < num_data_points; ++i) {
-            if constexpr (has_label) {
-                out_string.append(fmt::format("{:.10e},{}\n", fmt::join(data[i], ","), label[i]));
-            } else {
-                out_string.append(fmt::format("{:.10e}\n", fmt::join(data[i], ",")));
-            }
+    // write arff data: format the data points in parallel, but write them in order
+    // one dense value in scientific notation has at most 18 chars + the ','
+    write_ordered(out, num_data_points, ordered_writer_rows_per_block(num_features * 19), [&](std::string &output, const std::size_t i) {
+        if constexpr (has_label) {
+            fmt::format_to(std::back_inserter(output), "{:.10e},{}\n", fmt::join(data[i], ","), label[i]);
+        } else {
+            fmt::format_to(std::back_inserter(output), "{:.10e}\n", fmt::join(data[i], ","));
         }
-
-        #pragma omp critical
-        out.print("{}", out_string);
-    }
+    });
 }
 
 /**
@@ -482,7 +572,7 @@ inline void write_arff_data_impl(const std::string &filename, const std::vector<
  * @param[in] filename the filename to write the data to
  * @param[in] data the data points to write to the file
  * @param[in] label the labels to write to the file
- * @note The resulting order of the data points in the ARFF file is unspecified!
+ * @note The data points are written in the same order as in @p data, i.e., the resulting ARFF file is independent of the number of used threads.
  * @note The features are written using zero-based indices!
  */
 template <typename real_type, typename label_type>
@@ -512,7 +602,7 @@ inline void write_arff_data(const std::string &filename, const std::vector<std::
  * @tparam real_type the floating point type
  * @param[in] filename the filename to write the data to
  * @param[in] data the data points to write to the file
- * @note The resulting order of the data points in the ARFF file is unspecified!
+ * @note The data points are written in the same order as in @p data, i.e., the resulting ARFF file is independent of the number of used threads.
  * @note The features are written using zero-based indices!
  */
 template <typename real_type>
@@ -0,0 +1,274 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements parsing functions for the versioned binary model file format.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_BINARY_MODEL_PARSING_HPP_
+#define PLSSVM_DETAIL_IO_BINARY_MODEL_PARSING_HPP_
+#pragma once
+
+#include "plssvm/data_set.hpp"                  // plssvm::data_set
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/io/binary_parsing.hpp"  // plssvm::detail::io::{binary_data_byte_order_mark, align_binary_offset, check_binary_section, read_binary_value, read_binary_real_values,
+                                                //                      parse_binary_labels, binary_file_writer, create_binary_label_dictionary, write_binary_labels}
+#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_file_format_exception
+#include "plssvm/kernel_function_types.hpp"     // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                 // plssvm::parameter
+
+#include "fmt/core.h"                           // fmt::format
+
+#include <cstddef>                              // std::size_t
+#include <cstdint>                              // std::uint8_t, std::uint32_t, std::int32_t, std::uint64_t
+#include <limits>                               // std::numeric_limits
+#include <string>                               // std::string
+#include <string_view>                          // std::string_view
+#include <tuple>                                // std::tuple, std::make_tuple, std::tie, std::ignore
+#include <utility>                              // std::move
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::io {
+
+/// The magic bytes at the beginning of each binary model file.
+constexpr std::string_view binary_model_magic{ "PLSSVMMD" };
+/// The current version of the binary model file format.
+constexpr std::uint32_t binary_model_version{ 1 };
+/// The size (in bytes) of the fixed header of a binary model file.
+constexpr std::size_t binary_model_header_size{ 128 };
+
+/// The bit marking an explicitly set kernel type (necessary to restore the `plssvm::default_value::is_default()` state of each SVM parameter).
+constexpr std::uint8_t binary_model_kernel_type_flag{ 1U << 0U };
+/// The bit marking an explicitly set degree.
+constexpr std::uint8_t binary_model_degree_flag{ 1U << 1U };
+/// The bit marking an explicitly set gamma value.
+constexpr std::uint8_t binary_model_gamma_flag{ 1U << 2U };
+/// The bit marking an explicitly set coef0 value.
+constexpr std::uint8_t binary_model_coef0_flag{ 1U << 3U };
+/// The bit marking an explicitly set cost value.
+constexpr std::uint8_t binary_model_cost_flag{ 1U << 4U };
+
+/**
+ * @brief Parse the binary model file read by @p reader.
+ * @details The binary model file starts with a 128 byte header:
+ *          | offset | type          | content                                                              |
+ *          |--------|---------------|----------------------------------------------------------------------|
+ *          | 0      | char[8]       | the magic bytes `PLSSVMMD`                                           |
+ *          | 8      | std::uint32_t | the version of the file format                                       |
+ *          | 12     | std::uint32_t | the byte order mark `0x01020304`                                     |
+ *          | 16     | std::uint32_t | the size of the stored floating point type (`4` or `8`)              |
+ *          | 20     | std::uint32_t | the kernel function type                                             |
+ *          | 24     | std::int32_t  | the degree                                                           |
+ *          | 28     | std::uint8_t  | the explicitly set SVM parameters (e.g., plssvm::detail::io::binary_model_gamma_flag) |
+ *          | 29     | std::uint8_t  | `1` if the file contains the precomputed `w` vector, `0` otherwise   |
+ *          | 32     | double        | gamma                                                                |
+ *          | 40     | double        | coef0                                                                |
+ *          | 48     | double        | cost                                                                 |
+ *          | 56     | double        | rho                                                                  |
+ *          | 64     | std::uint64_t | the number of support vectors                                        |
+ *          | 72     | std::uint64_t | the number of features                                               |
+ *          | 80     | std::uint64_t | the number of different labels                                       |
+ *          The header is followed by the label dictionary and the label of each support vector (see plssvm::detail::io::parse_binary_labels),
+ *          the weights, the support vectors as one contiguous row-major block, and, optionally, the `w` vector used to speedup the prediction using the linear kernel.
+ *          Each section starts at an offset that is a multiple of 64 bytes.
+ *          Since no text must be parsed, the support vectors are directly copied from the (memory mapped) file.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] reader the file_reader used to read the binary model file (must **not** be split into lines)
+ * @throws plssvm::invalid_file_format_exception if the file doesn't start with the magic bytes
+ * @throws plssvm::invalid_file_format_exception if the file has been written using an unsupported version or a different byte order
+ * @throws plssvm::invalid_file_format_exception if the stored floating point type is neither `float` nor `double`
+ * @throws plssvm::invalid_file_format_exception if the kernel function type is invalid
+ * @throws plssvm::invalid_file_format_exception if the file doesn't contain any support vectors or features
+ * @throws plssvm::invalid_file_format_exception if not exactly two different labels are given
+ * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_binary_labels
+ * @throws plssvm::invalid_file_format_exception if the file is too small for the sizes given in the header
+ * @return a std::tuple containing: [the SVM parameter, the value of rho, the support vectors, the labels, the weights, the (potentially empty) w vector] (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::tuple<plssvm::parameter, real_type, std::vector<std::vector<real_type>>, std::vector<label_type>, std::vector<real_type>, std::vector<real_type>> parse_binary_model(const file_reader &reader) {
+    PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
+
+    // check the header
+    if (static_cast<std::size_t>(reader.num_bytes()) < binary_model_header_size || std::string_view{ reader.buffer(), binary_model_magic.size() } != binary_model_magic) {
+        throw invalid_file_format_exception{ fmt::format("The binary model file must start with \"{}\"!", binary_model_magic) };
+    }
+    const auto version = read_binary_value<std::uint32_t>(reader, 8);
+    if (version != binary_model_version) {
+        throw invalid_file_format_exception{ fmt::format("Unsupported binary model file format version {} (supported: {})!", version, binary_model_version) };
+    }
+    if (read_binary_value<std::uint32_t>(reader, 12) != binary_data_byte_order_mark) {
+        throw invalid_file_format_exception{ "The binary model file has been written on a machine with a different byte order!" };
+    }
+    const auto stored_real_type_size = read_binary_value<std::uint32_t>(reader, 16);
+    if (stored_real_type_size != sizeof(float) && stored_real_type_size != sizeof(double)) {
+        throw invalid_file_format_exception{ fmt::format("The size of the stored floating point type must be {} or {}, but is {}!", sizeof(float), sizeof(double), stored_real_type_size) };
+    }
+    const auto kernel = read_binary_value<std::uint32_t>(reader, 20);
+    if (kernel > static_cast<std::uint32_t>(kernel_function_type::rbf)) {
+        throw invalid_file_format_exception{ fmt::format("Unrecognized kernel type '{}'!", kernel) };
+    }
+    const auto flags = read_binary_value<std::uint8_t>(reader, 28);
+    const bool has_w = read_binary_value<std::uint8_t>(reader, 29) != 0;
+    const auto rho = static_cast<real_type>(read_binary_value<double>(reader, 56));
+    const auto num_support_vectors = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, 64));
+    const auto num_features = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, 72));
+    const auto num_labels = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, 80));
+    if (num_support_vectors == 0) {
+        throw invalid_file_format_exception{ "The number of support vectors must be greater than 0!" };
+    }
+    if (num_features == 0) {
+        throw invalid_file_format_exception{ "Can't parse file: no features are given!" };
+    }
+    // current limitation
+    if (num_labels != 2) {
+        throw invalid_file_format_exception{ fmt::format("Currently only binary classification is supported, but {} different label where given!", num_labels) };
+    }
+
+    // restore the SVM parameter including their default state
+    plssvm::parameter params{};
+    if (flags & binary_model_kernel_type_flag) {
+        params.kernel_type = static_cast<kernel_function_type>(kernel);
+    }
+    if (flags & binary_model_degree_flag) {
+        params.degree = read_binary_value<std::int32_t>(reader, 24);
+    }
+    if (flags & binary_model_gamma_flag) {
+        params.gamma = read_binary_value<double>(reader, 32);
+    }
+    if (flags & binary_model_coef0_flag) {
+        params.coef0 = read_binary_value<double>(reader, 40);
+    }
+    if (flags & binary_model_cost_flag) {
+        params.cost = read_binary_value<double>(reader, 48);
+    }
+
+    // parse the label dictionary and the label of each support vector
+    std::vector<label_type> labels{};
+    std::size_t offset{};
+    std::tie(labels, offset) = parse_binary_labels<label_type>(reader, binary_model_header_size, num_labels, num_support_vectors);
+
+    // check all sizes given in the header before allocating any memory for the weights and support vectors
+    const std::size_t real_type_size = stored_real_type_size;
+    const std::size_t support_vectors_offset = align_binary_offset(check_binary_section(reader, offset, num_support_vectors, real_type_size));
+    if (num_features > std::numeric_limits<std::size_t>::max() / real_type_size / num_support_vectors) {
+        throw invalid_file_format_exception{ fmt::format("The {} support vectors with {} features each are too large!", num_support_vectors, num_features) };
+    }
+    std::ignore = check_binary_section(reader, support_vectors_offset, num_support_vectors * num_features, real_type_size);
+
+    // copy the weights
+    std::vector<real_type> alpha(num_support_vectors);
+    read_binary_real_values(reader, offset, stored_real_type_size, alpha.data(), num_support_vectors);
+    offset = support_vectors_offset;
+
+    // copy the support vectors, the size has already been checked above to be able to copy the rows in parallel
+    std::vector<std::vector<real_type>> support_vectors(num_support_vectors, std::vector<real_type>(num_features));
+    #pragma omp parallel for default(none) shared(reader, support_vectors) firstprivate(num_support_vectors, num_features, offset, real_type_size, stored_real_type_size)
+    for (std::size_t i = 0; i < num_support_vectors; ++i) {
+        read_binary_real_values(reader, offset + i * num_features * real_type_size, stored_real_type_size, support_vectors[i].data(), num_features);
+    }
+    offset = align_binary_offset(offset + num_support_vectors * num_features * real_type_size);
+
+    // copy the precomputed w vector
+    std::vector<real_type> w{};
+    if (has_w) {
+        w.resize(num_features);
+        read_binary_real_values(reader, offset, stored_real_type_size, w.data(), num_features);
+    }
+
+    return std::make_tuple(std::move(params), rho, std::move(support_vectors), std::move(labels), std::move(alpha), std::move(w));
+}
+
+/**
+ * @brief Write the model to the binary model file @p filename (see plssvm::detail::io::parse_binary_model for the file layout).
+ * @details If the linear kernel is used, the `w` vector is always written, i.e., if @p w is empty, it is calculated from the support vectors and weights.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] filename the file to write the binary model to
+ * @param[in] params the SVM parameters
+ * @param[in] rho the rho value resulting from the hyperplane learning
+ * @param[in] alpha the weights learned by the SVM
+ * @param[in] w the (potentially empty) vector used to speedup the prediction using the linear kernel
+ * @param[in] data the data used to create the model
+ * @note In contrast to the LIBSVM model file, the order of the support vectors is preserved.
+ * @throws plssvm::file_exception if the file couldn't be created or written
+ */
+template <typename real_type, typename label_type>
+inline void write_binary_model_data(const std::string &filename, const plssvm::parameter &params, const real_type rho, const std::vector<real_type> &alpha, const std::vector<real_type> &w, const data_set<real_type, label_type> &data) {
+    PLSSVM_ASSERT(data.has_labels(), "Cannot write a model file that does not include labels!");
+    PLSSVM_ASSERT(alpha.size() == data.num_data_points(), "The number of weights ({}) doesn't match the number of data points ({})!", alpha.size(), data.num_data_points());
+    PLSSVM_ASSERT(w.empty() || w.size() == data.num_features(), "Either w must be empty or contain exactly the same number of values ({}) as features are present ({})!", w.size(), data.num_features());
+
+    const std::vector<std::vector<real_type>> &support_vectors = data.data();
+    const std::size_t num_support_vectors = data.num_data_points();
+    const std::size_t num_features = data.num_features();
+
+    // precompute the w vector for the linear kernel if it hasn't been calculated yet
+    std::vector<real_type> linear_w{ w };
+    if (params.kernel_type == kernel_function_type::linear && linear_w.empty()) {
+        linear_w.assign(num_features, real_type{ 0.0 });
+        for (std::size_t i = 0; i < num_support_vectors; ++i) {
+            for (std::size_t j = 0; j < num_features; ++j) {
+                linear_w[j] += alpha[i] * support_vectors[i][j];
+            }
+        }
+    }
+
+    // create the label dictionary
+    const auto [dictionary, label_indices] = create_binary_label_dictionary(data.labels().value().get());
+
+    // mark the explicitly set SVM parameters
+    const auto flags = static_cast<std::uint8_t>((params.kernel_type.is_default() ? 0U : binary_model_kernel_type_flag)
+                                                 | (params.degree.is_default() ? 0U : binary_model_degree_flag)
+                                                 | (params.gamma.is_default() ? 0U : binary_model_gamma_flag)
+                                                 | (params.coef0.is_default() ? 0U : binary_model_coef0_flag)
+                                                 | (params.cost.is_default() ? 0U : binary_model_cost_flag));
+
+    // create output file
+    binary_file_writer out{ filename };
+
+    // write the header
+    out.write(binary_model_magic.data(), binary_model_magic.size());
+    out.write_value(binary_model_version);
+    out.write_value(binary_data_byte_order_mark);
+    out.write_value(static_cast<std::uint32_t>(sizeof(real_type)));
+    out.write_value(static_cast<std::uint32_t>(params.kernel_type.value()));
+    out.write_value(static_cast<std::int32_t>(params.degree.value()));
+    out.write_value(flags);
+    out.write_value(static_cast<std::uint8_t>(!linear_w.empty()));
+    out.write_value(std::uint16_t{ 0 });
+    out.write_value(static_cast<double>(params.gamma.value()));
+    out.write_value(static_cast<double>(params.coef0.value()));
+    out.write_value(static_cast<double>(params.cost.value()));
+    out.write_value(static_cast<double>(rho));
+    out.write_value(static_cast<std::uint64_t>(num_support_vectors));
+    out.write_value(static_cast<std::uint64_t>(num_features));
+    out.write_value(static_cast<std::uint64_t>(dictionary.size()));
+    out.pad();
+
+    // write the label dictionary and the label of each support vector
+    write_binary_labels(out, dictionary, label_indices);
+
+    // write the weights
+    out.write_values(alpha);
+    out.pad();
+
+    // write the support vectors as one contiguous block
+    for (const std::vector<real_type> &sv : support_vectors) {
+        out.write_values(sv);
+    }
+    out.pad();
+
+    // write the w vector
+    out.write_values(linear_w);
+    out.close();
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_BINARY_MODEL_PARSING_HPP_
@@ -0,0 +1,553 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements parsing functions for the versioned binary data set file format.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_BINARY_PARSING_HPP_
+#define PLSSVM_DETAIL_IO_BINARY_PARSING_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
+#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_file_format_exception, plssvm::file_exception
+
+#include "fmt/core.h"                           // fmt::format
+
+#include <algorithm>                            // std::copy, std::count_if, std::is_sorted, std::any_of
+#include <cstddef>                              // std::size_t
+#include <cstdint>                              // std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <cstring>                              // std::memcpy
+#include <fstream>                              // std::ofstream
+#include <ios>                                  // std::ios, std::streamsize
+#include <limits>                               // std::numeric_limits
+#include <map>                                  // std::map
+#include <new>                                  // std::bad_alloc
+#include <string>                               // std::string
+#include <string_view>                          // std::string_view
+#include <tuple>                                // std::tuple, std::make_tuple, std::tie, std::ignore
+#include <utility>                              // std::move, std::pair, std::make_pair
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::io {
+
+/// The magic bytes at the beginning of each binary data set file.
+constexpr std::string_view binary_data_magic{ "PLSSVMDS" };
+/// The current version of the binary data set file format.
+constexpr std::uint32_t binary_data_version{ 1 };
+/// The value used to detect binary data set files written on a machine with a different byte order.
+constexpr std::uint32_t binary_data_byte_order_mark{ 0x01020304 };
+/// The alignment (in bytes) of all sections of a binary data set file.
+constexpr std::size_t binary_data_alignment{ 64 };
+/// The size (in bytes) of the fixed header of a binary data set file.
+constexpr std::size_t binary_data_header_size{ 64 };
+
+/**
+ * @brief Round @p offset up to the next multiple of plssvm::detail::io::binary_data_alignment.
+ * @param[in] offset the offset to align
+ * @return the aligned offset (`[[nodiscard]]`)
+ */
+[[nodiscard]] constexpr std::size_t align_binary_offset(const std::size_t offset) noexcept {
+    return (offset + binary_data_alignment - 1) / binary_data_alignment * binary_data_alignment;
+}
+
+/**
+ * @brief Check that @p count values with @p value_size bytes each starting at @p offset are contained in the binary file read by @p reader.
+ * @details The sizes are read from the (potentially corrupted) file. Therefore, the check is overflow-safe and must be done **before** allocating memory for the values.
+ * @param[in] reader the file_reader used to read the binary file
+ * @param[in] offset the offset (in bytes) of the first value in the file
+ * @param[in] count the number of values
+ * @param[in] value_size the size (in bytes) of a single value
+ * @throws plssvm::invalid_file_format_exception if the file is too small to contain all values
+ * @return the offset directly after the last value (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::size_t check_binary_section(const file_reader &reader, const std::size_t offset, const std::size_t count, const std::size_t value_size) {
+    const auto num_bytes = static_cast<std::size_t>(reader.num_bytes());
+    if (offset > num_bytes || (value_size > 0 && count > (num_bytes - offset) / value_size)) {
+        if (value_size > 0 && count > (std::numeric_limits<std::size_t>::max() - offset) / value_size) {
+            // the number of needed bytes isn't even representable
+            throw invalid_file_format_exception{ fmt::format("Unexpected end of the binary file: need {} values with {} bytes each starting at offset {}, but only {} bytes are present!", count, value_size, offset, num_bytes) };
+        }
+        throw invalid_file_format_exception{ fmt::format("Unexpected end of the binary file: need {} bytes, but only {} are present!", offset + count * value_size, num_bytes) };
+    }
+    return offset + count * value_size;
+}
+
+/**
+ * @brief Copy @p count values of type @p T starting at @p offset from the binary file read by @p reader to @p dest.
+ * @tparam T the type of the values to copy
+ * @param[in] reader the file_reader used to read the binary file
+ * @param[in] offset the offset (in bytes) of the first value in the file
+ * @param[out] dest the destination of the values
+ * @param[in] count the number of values to copy
+ * @throws plssvm::invalid_file_format_exception if the file is too small to contain all requested values
+ */
+template <typename T>
+inline void read_binary_values(const file_reader &reader, const std::size_t offset, T *dest, const std::size_t count) {
+    std::ignore = check_binary_section(reader, offset, count, sizeof(T));
+    if (count > 0) {
+        std::memcpy(dest, reader.buffer() + offset, count * sizeof(T));
+    }
+}
+
+/**
+ * @brief Read the value of type @p T at @p offset from the binary file read by @p reader.
+ * @tparam T the type of the value to read
+ * @param[in] reader the file_reader used to read the binary file
+ * @param[in] offset the offset (in bytes) of the value in the file
+ * @throws plssvm::invalid_file_format_exception if the file is too small to contain the requested value
+ * @return the read value (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T read_binary_value(const file_reader &reader, const std::size_t offset) {
+    T value{};
+    read_binary_values(reader, offset, &value, 1);
+    return value;
+}
+
+/**
+ * @brief Copy the @p count floating point values stored with @p stored_real_type_size bytes each starting at @p offset to @p dest converting them to @p real_type.
+ * @tparam real_type the floating point type of the destination
+ * @param[in] reader the file_reader used to read the binary file
+ * @param[in] offset the offset (in bytes) of the first value in the file
+ * @param[in] stored_real_type_size the size of the stored floating point type (`4` for `float` and `8` for `double`)
+ * @param[out] dest the destination of the values
+ * @param[in] count the number of values to copy
+ */
+template <typename real_type>
+inline void read_binary_real_values(const file_reader &reader, const std::size_t offset, const std::uint32_t stored_real_type_size, real_type *dest, const std::size_t count) {
+    if (stored_real_type_size == sizeof(real_type)) {
+        // same floating point type -> plain copy
+        read_binary_values(reader, offset, dest, count);
+    } else if (stored_real_type_size == sizeof(float)) {
+        std::vector<float> tmp(count);
+        read_binary_values(reader, offset, tmp.data(), count);
+        std::copy(tmp.cbegin(), tmp.cend(), dest);
+    } else {
+        std::vector<double> tmp(count);
+        read_binary_values(reader, offset, tmp.data(), count);
+        std::copy(tmp.cbegin(), tmp.cend(), dest);
+    }
+}
+
+/**
+ * @brief Parse the label dictionary with @p num_labels entries and the label indices of the @p num_data_points data points starting at @p offset.
+ * @details The label dictionary contains for each label its length in bytes as std::uint64_t followed by its string representation.
+ *          It is followed by the index of the label of each data point in the dictionary (std::uint64_t), starting at the next aligned offset.
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] reader the file_reader used to read the binary file
+ * @param[in] offset the offset (in bytes) of the label dictionary in the file
+ * @param[in] num_labels the number of labels in the dictionary
+ * @param[in] num_data_points the number of label indices
+ * @throws plssvm::invalid_file_format_exception if a label couldn't be converted to the provided @p label_type
+ * @throws plssvm::invalid_file_format_exception if a label index is out of bounds
+ * @throws plssvm::invalid_file_format_exception if the file is too small to contain all labels
+ * @return the label of each data point and the aligned offset directly after the label indices (`[[nodiscard]]`)
+ */
+template <typename label_type>
+[[nodiscard]] inline std::pair<std::vector<label_type>, std::size_t> parse_binary_labels(const file_reader &reader, std::size_t offset, const std::size_t num_labels, const std::size_t num_data_points) {
+    // each label needs at least the bytes for its length
+    std::ignore = check_binary_section(reader, offset, num_labels, sizeof(std::uint64_t));
+    std::vector<label_type> dictionary(num_labels);
+    for (std::size_t i = 0; i < num_labels; ++i) {
+        const auto length = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, offset));
+        std::ignore = check_binary_section(reader, offset + sizeof(std::uint64_t), length, sizeof(char));
+        std::string str(length, '\0');
+        read_binary_values(reader, offset + sizeof(std::uint64_t), str.data(), length);
+        dictionary[i] = detail::convert_to<label_type, invalid_file_format_exception>(str);
+        offset += sizeof(std::uint64_t) + length;
+    }
+    offset = align_binary_offset(offset);
+
+    const std::size_t label_indices_end = check_binary_section(reader, offset, num_data_points, sizeof(std::uint64_t));
+    std::vector<std::uint64_t> label_indices(num_data_points);
+    read_binary_values(reader, offset, label_indices.data(), num_data_points);
+    offset = align_binary_offset(label_indices_end);
+
+    std::vector<label_type> label(num_data_points);
+    for (std::size_t i = 0; i < num_data_points; ++i) {
+        if (label_indices[i] >= num_labels) {
+            throw invalid_file_format_exception{ fmt::format("The label index {} of the data point {} must be less than the number of labels {}!", label_indices[i], i, num_labels) };
+        }
+        label[i] = dictionary[label_indices[i]];
+    }
+    return std::make_pair(std::move(label), offset);
+}
+
+/**
+ * @brief Parse the binary data set file read by @p reader.
+ * @details The binary file starts with a 64 byte header:
+ *          | offset | type          | content                                                       |
+ *          |--------|---------------|---------------------------------------------------------------|
+ *          | 0      | char[8]       | the magic bytes `PLSSVMDS`                                    |
+ *          | 8      | std::uint32_t | the version of the file format                                |
+ *          | 12     | std::uint32_t | the byte order mark `0x01020304`                              |
+ *          | 16     | std::uint32_t | the size of the stored floating point type (`4` or `8`)       |
+ *          | 20     | std::uint8_t  | `1` if the file contains labels, `0` otherwise                |
+ *          | 21     | std::uint8_t  | `1` if the data points are stored in the CSR format, `0` otherwise |
+ *          | 24     | std::uint64_t | the number of data points                                     |
+ *          | 32     | std::uint64_t | the number of features                                        |
+ *          | 40     | std::uint64_t | the number of non-zero values (only used in the CSR format)   |
+ *          | 48     | std::uint64_t | the number of different labels                                |
+ *          If the file contains labels, the header is followed by the label dictionary (for each label its length in bytes as std::uint64_t followed by its string representation)
+ *          and the index of the label of each data point in the dictionary (std::uint64_t).
+ *          Afterward, the data points are stored either dense (row-major) or in the CSR format (the row offsets and column indices as std::uint64_t followed by the values).
+ *          Each section starts at an offset that is a multiple of 64 bytes.
+ *          Since no text must be parsed, the data points are directly copied from the (memory mapped) file.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] reader the file_reader used to read the binary file (must **not** be split into lines)
+ * @throws plssvm::invalid_file_format_exception if the file doesn't start with the magic bytes
+ * @throws plssvm::invalid_file_format_exception if the file has been written using an unsupported version or a different byte order
+ * @throws plssvm::invalid_file_format_exception if the stored floating point type is neither `float` nor `double`
+ * @throws plssvm::invalid_file_format_exception if the file doesn't contain any data points or features
+ * @throws plssvm::invalid_file_format_exception if a label index or CSR entry is out of bounds
+ * @throws plssvm::invalid_file_format_exception if the file is too small for the sizes given in the header (checked before allocating any memory)
+ * @throws plssvm::invalid_file_format_exception if the data points stored in the CSR format are too large to be allocated
+ * @return a std::tuple containing: [num_data_points, num_features, data_points, labels] (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> parse_binary_data(const file_reader &reader) {
+    PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
+
+    // check the header
+    if (static_cast<std::size_t>(reader.num_bytes()) < binary_data_header_size || std::string_view{ reader.buffer(), binary_data_magic.size() } != binary_data_magic) {
+        throw invalid_file_format_exception{ fmt::format("The binary file must start with \"{}\"!", binary_data_magic) };
+    }
+    const auto version = read_binary_value<std::uint32_t>(reader, 8);
+    if (version != binary_data_version) {
+        throw invalid_file_format_exception{ fmt::format("Unsupported binary file format version {} (supported: {})!", version, binary_data_version) };
+    }
+    if (read_binary_value<std::uint32_t>(reader, 12) != binary_data_byte_order_mark) {
+        throw invalid_file_format_exception{ "The binary file has been written on a machine with a different byte order!" };
+    }
+    const auto stored_real_type_size = read_binary_value<std::uint32_t>(reader, 16);
+    if (stored_real_type_size != sizeof(float) && stored_real_type_size != sizeof(double)) {
+        throw invalid_file_format_exception{ fmt::format("The size of the stored floating point type must be {} or {}, but is {}!", sizeof(float), sizeof(double), stored_real_type_size) };
+    }
+    const bool has_label = read_binary_value<std::uint8_t>(reader, 20) != 0;
+    const bool is_sparse = read_binary_value<std::uint8_t>(reader, 21) != 0;
+    const auto num_data_points = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, 24));
+    const auto num_features = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, 32));
+    const auto num_nonzeros = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, 40));
+    const auto num_labels = static_cast<std::size_t>(read_binary_value<std::uint64_t>(reader, 48));
+    if (num_data_points == 0) {
+        throw invalid_file_format_exception{ "Can't parse file: no data points are given!" };
+    }
+    if (num_features == 0) {
+        throw invalid_file_format_exception{ "Can't parse file: no features are given!" };
+    }
+    std::size_t offset = binary_data_header_size;
+
+    // parse the label dictionary and the label of each data point
+    std::vector<label_type> label{};
+    if (has_label) {
+        std::tie(label, offset) = parse_binary_labels<label_type>(reader, offset, num_labels, num_data_points);
+    }
+
+    // check all sizes given in the header before allocating any memory for the data points
+    const std::size_t real_type_size = stored_real_type_size;
+    if (num_features > std::numeric_limits<std::size_t>::max() / real_type_size / num_data_points) {
+        throw invalid_file_format_exception{ fmt::format("The {} data points with {} features each are too large!", num_data_points, num_features) };
+    }
+    std::size_t col_indices_offset{};
+    std::size_t values_offset{};
+    if (is_sparse) {
+        // the CSR format contains num_data_points + 1 row offsets
+        col_indices_offset = align_binary_offset(check_binary_section(reader, offset + sizeof(std::uint64_t), num_data_points, sizeof(std::uint64_t)));
+        values_offset = align_binary_offset(check_binary_section(reader, col_indices_offset, num_nonzeros, sizeof(std::uint64_t)));
+        std::ignore = check_binary_section(reader, values_offset, num_nonzeros, real_type_size);
+    } else {
+        std::ignore = check_binary_section(reader, offset, num_data_points * num_features, real_type_size);
+    }
+
+    // copy the data points
+    std::vector<std::vector<real_type>> data{};
+    try {
+        data.assign(num_data_points, std::vector<real_type>(num_features));
+    } catch (const std::bad_alloc &) {
+        // the number of features of the CSR format isn't bounded by the file size
+        throw invalid_file_format_exception{ fmt::format("Can't allocate {} data points with {} features each!", num_data_points, num_features) };
+    }
+    if (is_sparse) {
+        std::vector<std::uint64_t> row_offsets(num_data_points + 1);
+        read_binary_values(reader, offset, row_offsets.data(), num_data_points + 1);
+        offset = col_indices_offset;
+        std::vector<std::uint64_t> col_indices(num_nonzeros);
+        read_binary_values(reader, offset, col_indices.data(), num_nonzeros);
+        offset = values_offset;
+        std::vector<real_type> values(num_nonzeros);
+        read_binary_real_values(reader, offset, stored_real_type_size, values.data(), num_nonzeros);
+
+        // check the CSR structure before scattering the values
+        if (row_offsets.front() != 0 || row_offsets.back() != num_nonzeros || !std::is_sorted(row_offsets.cbegin(), row_offsets.cend())) {
+            throw invalid_file_format_exception{ "The row offsets of the CSR format are invalid!" };
+        }
+        if (std::any_of(col_indices.cbegin(), col_indices.cend(), [num_features](const std::uint64_t col) { return col >= num_features; })) {
+            throw invalid_file_format_exception{ fmt::format("All column indices of the CSR format must be less than the number of features {}!", num_features) };
+        }
+
+        #pragma omp parallel for default(none) shared(data, row_offsets, col_indices, values) firstprivate(num_data_points)
+        for (std::size_t i = 0; i < num_data_points; ++i) {
+            for (std::uint64_t j = row_offsets[i]; j < row_offsets[i + 1]; ++j) {
+                data[i][col_indices[j]] = values[j];
+            }
+        }
+    } else {
+        // the size has already been checked above to be able to copy the rows in parallel
+        #pragma omp parallel for default(none) shared(reader, data) firstprivate(num_data_points, num_features, offset, real_type_size, stored_real_type_size)
+        for (std::size_t i = 0; i < num_data_points; ++i) {
+            read_binary_real_values(reader, offset + i * num_features * real_type_size, stored_real_type_size, data[i].data(), num_features);
+        }
+    }
+
+    return std::make_tuple(num_data_points, num_features, std::move(data), std::move(label));
+}
+
+/**
+ * @brief A small helper class writing raw values to a binary file while keeping track of the current offset to be able to align the file sections.
+ * @details Every failed write throws a plssvm::file_exception. Since an std::ofstream buffers its output, plssvm::detail::io::binary_file_writer::close
+ *          **must** be called after the last write to also detect failures while flushing the remaining bytes (e.g., if the disk is full).
+ */
+class binary_file_writer {
+  public:
+    /**
+     * @brief Create (or truncate) the binary file @p filename.
+     * @param[in] filename the file to write to
+     * @throws plssvm::file_exception if the file couldn't be created
+     */
+    explicit binary_file_writer(std::string filename) :
+        filename_{ std::move(filename) },
+        out_{ filename_, std::ios::binary | std::ios::trunc } {
+        if (!out_.is_open()) {
+            throw file_exception{ fmt::format("Couldn't create the binary file \"{}\"!", filename_) };
+        }
+    }
+
+    /**
+     * @brief Write @p num_bytes raw bytes starting at @p ptr to the file.
+     * @param[in] ptr the bytes to write
+     * @param[in] num_bytes the number of bytes to write
+     * @throws plssvm::file_exception if the bytes couldn't be written
+     */
+    void write(const void *ptr, const std::size_t num_bytes) {
+        out_.write(static_cast<const char *>(ptr), static_cast<std::streamsize>(num_bytes));
+        if (!out_) {
+            throw file_exception{ fmt::format("Couldn't write {} bytes at offset {} to the binary file \"{}\"!", num_bytes, offset_, filename_) };
+        }
+        offset_ += num_bytes;
+    }
+    /**
+     * @brief Write the raw bytes of @p value to the file.
+     * @tparam T the type of the value
+     * @param[in] value the value to write
+     * @throws plssvm::file_exception if the value couldn't be written
+     */
+    template <typename T>
+    void write_value(const T value) {
+        this->write(&value, sizeof(T));
+    }
+    /**
+     * @brief Write all values in @p values to the file.
+     * @tparam T the type of the values
+     * @param[in] values the values to write
+     * @throws plssvm::file_exception if the values couldn't be written
+     */
+    template <typename T>
+    void write_values(const std::vector<T> &values) {
+        this->write(values.data(), values.size() * sizeof(T));
+    }
+    /**
+     * @brief Pad the file with zeros up to the next multiple of plssvm::detail::io::binary_data_alignment.
+     * @throws plssvm::file_exception if the padding couldn't be written
+     */
+    void pad() {
+        static constexpr char zeros[binary_data_alignment]{};
+        this->write(zeros, align_binary_offset(offset_) - offset_);
+    }
+    /**
+     * @brief Flush all buffered bytes and close the file.
+     * @throws plssvm::file_exception if the buffered bytes couldn't be written or the file couldn't be closed
+     */
+    void close() {
+        out_.close();
+        if (!out_) {
+            throw file_exception{ fmt::format("Couldn't write the binary file \"{}\" ({} bytes)!", filename_, offset_) };
+        }
+    }
+
+  private:
+    /// The name of the output file (used in the error messages).
+    std::string filename_;
+    /// The output file.
+    std::ofstream out_;
+    /// The number of bytes written so far.
+    std::size_t offset_{ 0 };
+};
+
+/**
+ * @brief Create the label dictionary (in the order of the first occurrence) and the index of each label in @p label in this dictionary.
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] label the labels
+ * @return the label dictionary and the label indices (`[[nodiscard]]`)
+ */
+template <typename label_type>
+[[nodiscard]] inline std::pair<std::vector<label_type>, std::vector<std::uint64_t>> create_binary_label_dictionary(const std::vector<label_type> &label) {
+    std::vector<label_type> dictionary{};
+    std::vector<std::uint64_t> label_indices{};
+    label_indices.reserve(label.size());
+
+    std::map<label_type, std::uint64_t> label_to_index{};
+    for (const label_type &l : label) {
+        const auto [it, inserted] = label_to_index.emplace(l, dictionary.size());
+        if (inserted) {
+            dictionary.push_back(l);
+        }
+        label_indices.push_back(it->second);
+    }
+    return std::make_pair(std::move(dictionary), std::move(label_indices));
+}
+
+/**
+ * @brief Write the label @p dictionary and the @p label_indices using @p out (see plssvm::detail::io::parse_binary_labels for the layout).
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in,out] out the binary file to write to
+ * @param[in] dictionary the label dictionary
+ * @param[in] label_indices the index of the label of each data point in the @p dictionary
+ */
+template <typename label_type>
+inline void write_binary_labels(binary_file_writer &out, const std::vector<label_type> &dictionary, const std::vector<std::uint64_t> &label_indices) {
+    for (const label_type &l : dictionary) {
+        const std::string str = fmt::format("{}", l);
+        out.write_value(static_cast<std::uint64_t>(str.size()));
+        out.write(str.data(), str.size());
+    }
+    out.pad();
+    out.write_values(label_indices);
+    out.pad();
+}
+
+/**
+ * @brief Write the provided @p data and @p label to the binary file @p filename (see plssvm::detail::io::parse_binary_data for the file layout).
+ * @details The data points are stored in the CSR format if this results in a smaller file, otherwise they are stored dense.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @tparam has_label if `true` the provided labels are also written to the file, if `false` **no** labels are outputted
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @param[in] label the labels to write to the file (ignored if @p has_label is `false`)
+ * @note As with the text formats, the data points are written in the same order as in @p data.
+ * @throws plssvm::file_exception if the file couldn't be created or written
+ */
+template <typename real_type, typename label_type, bool has_label>
+inline void write_binary_data_impl(const std::string &filename, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) {
+    if constexpr (has_label) {
+        PLSSVM_ASSERT(data.empty() || !label.empty(), "has_label is 'true' but no labels were provided!");
+        PLSSVM_ASSERT(data.size() == label.size(), "Number of data points ({}) and number of labels ({}) mismatch!", data.size(), label.size());
+    } else {
+        PLSSVM_ASSERT(label.empty(), "has_label is 'false' but labels were provided!");
+    }
+
+    const std::size_t num_data_points = data.size();
+    const std::size_t num_features = data.empty() ? 0 : data.front().size();
+
+    // store the data points in the CSR format if the file gets smaller
+    std::size_t num_nonzeros{ 0 };
+    for (const std::vector<real_type> &point : data) {
+        num_nonzeros += static_cast<std::size_t>(std::count_if(point.cbegin(), point.cend(), [](const real_type value) { return value != real_type{ 0.0 }; }));
+    }
+    const bool is_sparse = (num_data_points + 1 + num_nonzeros) * sizeof(std::uint64_t) + num_nonzeros * sizeof(real_type) < num_data_points * num_features * sizeof(real_type);
+
+    // create the label dictionary (in the order of the first occurrence)
+    std::vector<label_type> dictionary{};
+    std::vector<std::uint64_t> label_indices{};
+    if constexpr (has_label) {
+        std::tie(dictionary, label_indices) = create_binary_label_dictionary(label);
+    }
+
+    // create output file
+    binary_file_writer out{ filename };
+
+    // write the header
+    out.write(binary_data_magic.data(), binary_data_magic.size());
+    out.write_value(binary_data_version);
+    out.write_value(binary_data_byte_order_mark);
+    out.write_value(static_cast<std::uint32_t>(sizeof(real_type)));
+    out.write_value(static_cast<std::uint8_t>(has_label));
+    out.write_value(static_cast<std::uint8_t>(is_sparse));
+    out.write_value(std::uint16_t{ 0 });
+    out.write_value(static_cast<std::uint64_t>(num_data_points));
+    out.write_value(static_cast<std::uint64_t>(num_features));
+    out.write_value(static_cast<std::uint64_t>(is_sparse ? num_nonzeros : 0));
+    out.write_value(static_cast<std::uint64_t>(dictionary.size()));
+    out.pad();
+
+    // write the label dictionary and the label of each data point
+    if constexpr (has_label) {
+        write_binary_labels(out, dictionary, label_indices);
+    }
+
+    // write the data points
+    if (is_sparse) {
+        std::vector<std::uint64_t> row_offsets(num_data_points + 1, 0);
+        std::vector<std::uint64_t> col_indices{};
+        std::vector<real_type> values{};
+        col_indices.reserve(num_nonzeros);
+        values.reserve(num_nonzeros);
+        for (std::size_t i = 0; i < num_data_points; ++i) {
+            for (std::size_t j = 0; j < num_features; ++j) {
+                if (data[i][j] != real_type{ 0.0 }) {
+                    col_indices.push_back(j);
+                    values.push_back(data[i][j]);
+                }
+            }
+            row_offsets[i + 1] = col_indices.size();
+        }
+        out.write_values(row_offsets);
+        out.pad();
+        out.write_values(col_indices);
+        out.pad();
+        out.write_values(values);
+    } else {
+        for (const std::vector<real_type> &point : data) {
+            out.write_values(point);
+        }
+    }
+    out.close();
+}
+
+/**
+ * @brief Write the provided @p data and @p label to the binary file @p filename.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @param[in] label the labels to write to the file
+ * @throws plssvm::file_exception if the file couldn't be created or written
+ */
+template <typename real_type, typename label_type>
+inline void write_binary_data(const std::string &filename, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) {
+    write_binary_data_impl<real_type, label_type, true>(filename, data, label);
+}
+
+/**
+ * @brief Write the provided @p data to the binary file @p filename.
+ * @tparam real_type the floating point type
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @throws plssvm::file_exception if the file couldn't be created or written
+ */
+template <typename real_type>
+inline void write_binary_data(const std::string &filename, const std::vector<std::vector<real_type>> &data) {
+    write_binary_data_impl<real_type, real_type, false>(filename, data, {});
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_BINARY_PARSING_HPP_
@@ -0,0 +1,154 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements parsing functions for the checkpoint files written during long running CG solves.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_CHECKPOINT_PARSING_HPP_
+#define PLSSVM_DETAIL_IO_CHECKPOINT_PARSING_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
+#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::{convert_to, split_as}
+#include "plssvm/detail/string_utility.hpp"     // plssvm::detail::{trim, starts_with}
+#include "plssvm/detail/utility.hpp"            // plssvm::detail::current_date_time
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_file_format_exception
+
+#include "fmt/core.h"                           // fmt::format
+#include "fmt/format.h"                         // fmt::join
+#include "fmt/os.h"                             // fmt::ostream, fmt::output_file
+
+#include <cstddef>                              // std::size_t
+#include <filesystem>                           // std::filesystem::rename
+#include <string>                               // std::string
+#include <string_view>                          // std::string_view
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::io {
+
+/**
+ * @brief The state of a CG solve necessary to continue it later on.
+ * @tparam real_type the used floating point type
+ */
+template <typename real_type>
+struct checkpoint_data {
+    /// The fingerprint of the data and parameters of the solved system of linear equations.
+    std::string fingerprint{};
+    /// The number of already performed CG iterations.
+    unsigned long long iteration{ 0 };
+    /// The current squared residual norm.
+    real_type delta{};
+    /// The initial squared residual norm (used in the stopping criterion).
+    real_type delta0{};
+    /// The current solution vector.
+    std::vector<real_type> x{};
+    /// The current residual.
+    std::vector<real_type> r{};
+    /// The current search direction.
+    std::vector<real_type> d{};
+};
+
+/**
+ * @brief Parse the checkpoint entry @p line of the form `name value`.
+ * @param[in] line the checkpoint line
+ * @param[in] name the expected name of the checkpoint entry
+ * @throws plssvm::invalid_file_format_exception if @p line doesn't start with @p name
+ * @return the (trimmed) value of the checkpoint entry (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::string_view parse_checkpoint_entry(const std::string_view line, const std::string_view name) {
+    const std::string_view trimmed = detail::trim(line);
+    if (!detail::starts_with(trimmed, name)) {
+        throw invalid_file_format_exception{ fmt::format("Expected the checkpoint entry \"{}\", but got \"{}\"!", name, trimmed) };
+    }
+    return detail::trim(trimmed.substr(name.size()));
+}
+
+/**
+ * @brief Read a CG checkpoint from the file read by @p reader.
+ * @details An example file can look like
+ * @code
+ * fingerprint 5ba8f1fa36b2cba5ab5a92f6e4e6bbb9ea44bfd1b2e2ae5e3e04d9f4c2d19ba3
+ * iteration 100
+ * delta 0.25
+ * delta0 12.5
+ * num_rows 4
+ * x 0.1 -0.2 0.3 -0.4
+ * r 0.25 0.25 -0.25 0.25
+ * d 0.5 0.25 -0.5 0.25
+ * @endcode
+ * @tparam real_type the used floating point type
+ * @param[in] reader the file_reader used to read the checkpoint
+ * @throws plssvm::invalid_file_format_exception if the file doesn't contain exactly eight lines
+ * @throws plssvm::invalid_file_format_exception if the entries are omitted or in the wrong order
+ * @throws plssvm::invalid_file_format_exception if one of the vectors doesn't contain exactly `num_rows` values
+ * @return the read checkpoint (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] inline checkpoint_data<real_type> parse_checkpoint(const file_reader &reader) {
+    PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
+
+    // exactly eight lines ("fingerprint", "iteration", "delta", "delta0", "num_rows", "x", "r", and "d")
+    if (reader.num_lines() != 8) {
+        throw invalid_file_format_exception{ fmt::format("Exactly eight lines must be present, but {} were given!", reader.num_lines()) };
+    }
+
+    checkpoint_data<real_type> data{};
+    data.fingerprint = std::string{ parse_checkpoint_entry(reader.line(0), "fingerprint") };
+    data.iteration = detail::convert_to<unsigned long long, invalid_file_format_exception>(parse_checkpoint_entry(reader.line(1), "iteration"));
+    data.delta = detail::convert_to<real_type, invalid_file_format_exception>(parse_checkpoint_entry(reader.line(2), "delta"));
+    data.delta0 = detail::convert_to<real_type, invalid_file_format_exception>(parse_checkpoint_entry(reader.line(3), "delta0"));
+    const auto num_rows = detail::convert_to<std::size_t, invalid_file_format_exception>(parse_checkpoint_entry(reader.line(4), "num_rows"));
+
+    // parse the vectors
+    const auto parse_vector = [&](const std::size_t line, const std::string_view name) {
+        std::vector<real_type> vec = detail::split_as<real_type>(parse_checkpoint_entry(reader.line(line), name));
+        if (vec.size() != num_rows) {
+            throw invalid_file_format_exception{ fmt::format("The vector \"{}\" must contain exactly {} values, but contains {}!", name, num_rows, vec.size()) };
+        }
+        return vec;
+    };
+    data.x = parse_vector(5, "x");
+    data.r = parse_vector(6, "r");
+    data.d = parse_vector(7, "d");
+
+    return data;
+}
+
+/**
+ * @brief Write the CG checkpoint @p data to the file @p filename.
+ * @details The checkpoint is first written to a temporary file which is renamed afterward.
+ *          Therefore, the file @p filename always contains a complete checkpoint, even if the program is killed while writing.
+ *          For an example file see plssvm::detail::io::parse_checkpoint.
+ * @tparam real_type the used floating point type
+ * @param[in] filename the filename to write the checkpoint to
+ * @param[in] data the checkpoint to write
+ */
+template <typename real_type>
+inline void write_checkpoint(const std::string &filename, const checkpoint_data<real_type> &data) {
+    PLSSVM_ASSERT(data.x.size() == data.r.size() && data.x.size() == data.d.size(), "Sizes mismatch!: {} != {} != {}", data.x.size(), data.r.size(), data.d.size());
+
+    const std::string tmp_filename = filename + ".tmp";
+    {
+        // create temporary output file
+        fmt::ostream out = fmt::output_file(tmp_filename);
+        // write timestamp as current date time
+        out.print("# This checkpoint has been created at {}\n", detail::current_date_time());
+
+        // write the scalar values
+        out.print("fingerprint {}\niteration {}\ndelta {}\ndelta0 {}\nnum_rows {}\n", data.fingerprint, data.iteration, data.delta, data.delta0, data.x.size());
+        // write the vectors
+        out.print("x {}\nr {}\nd {}\n", fmt::join(data.x, " "), fmt::join(data.r, " "), fmt::join(data.d, " "));
+    }
+    // atomically replace the old checkpoint
+    std::filesystem::rename(tmp_filename, filename);
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_CHECKPOINT_PARSING_HPP_
@@ -0,0 +1,136 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the transparent decompression of gzip and Zstandard compressed input files.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_COMPRESSION_HPP_
+#define PLSSVM_DETAIL_IO_COMPRESSION_HPP_
+#pragma once
+
+#include <cstddef>      // std::size_t
+#include <iosfwd>       // forward declare std::ostream
+#include <memory>       // std::unique_ptr
+#include <streambuf>    // std::streambuf
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <vector>       // std::vector
+
+namespace plssvm::detail::io {
+
+/**
+ * @brief Enum class for all supported compression types of input files.
+ */
+enum class compression_type {
+    /** The file isn't compressed. */
+    none,
+    /** The file is compressed using gzip (file extension `.gz`), requires zlib. */
+    gzip,
+    /** The file is compressed using Zstandard (file extension `.zst`), requires zstd. */
+    zstd
+};
+
+/**
+ * @brief Output the @p type to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the compression type to
+ * @param[in] type the compression type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, compression_type type);
+
+/**
+ * @brief Determine the compression type of the file @p filename based on its file extension.
+ * @param[in] filename the file to check
+ * @return plssvm::detail::io::compression_type::gzip for `.gz`, plssvm::detail::io::compression_type::zstd for `.zst`, and plssvm::detail::io::compression_type::none otherwise (`[[nodiscard]]`)
+ */
+[[nodiscard]] compression_type determine_compression_type(std::string_view filename) noexcept;
+
+/**
+ * @brief Remove the file extension denoting the compression type (`.gz` or `.zst`) from @p filename, e.g., `data.arff.gz` results in `data.arff`.
+ * @details Used to determine the file format of compressed files.
+ * @param[in] filename the filename to strip
+ * @return the filename without the compression file extension (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::string_view remove_compression_extension(std::string_view filename) noexcept;
+
+/**
+ * @brief Check whether the decompression of files compressed using @p type is supported, i.e., whether the necessary library was available when building PLSSVM.
+ * @param[in] type the compression type to check
+ * @return `true` if @p type is supported, otherwise `false` (`[[nodiscard]]`)
+ */
+[[nodiscard]] bool is_compression_type_supported(compression_type type) noexcept;
+
+/**
+ * @brief Decompress the whole @p content compressed using @p type.
+ * @details If possible, the content is decompressed in parallel:
+ *          - Zstandard: if the file consists of multiple frames whose decompressed sizes are stored in the frame headers (e.g., created using `zstd -T0` or `pzstd`), all frames are decompressed in parallel,
+ *          - gzip: if the file consists of BGZF blocks (e.g., created using `bgzip`), all blocks are decompressed in parallel.
+ *          Since the decompressed sizes are read from the block headers, the parallel decompression is only used if they are plausible
+ *          (at most 64 KiB per BGZF block, at most the maximum compression ratio per Zstandard frame, and no overflowing total size).
+ *          Otherwise, the content is decompressed sequentially. Multiple concatenated gzip members or Zstandard frames are always supported.
+ * @param[in] content the compressed content
+ * @param[in] type the compression type of @p content
+ * @param[in] filename the name of the compressed file (only used in error messages)
+ * @throws plssvm::file_reader_exception if decompressing @p type isn't supported
+ * @throws plssvm::invalid_file_format_exception if @p content isn't a valid (or is a truncated) compressed file
+ * @return the decompressed content (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<char> decompress(std::string_view content, compression_type type, const std::string &filename);
+
+/**
+ * @brief A stream buffer decompressing a compressed file on-the-fly using bounded input and output buffers.
+ * @details In contrast to plssvm::detail::io::decompress, the decompressed file is **never** materialized as a whole.
+ *          Errors while decompressing are reported by throwing an exception, i.e., the using std::istream should have its `badbit` exception mask set to retain it.
+ */
+class decompressing_streambuf : public std::streambuf {
+  public:
+    /// The size of the buffer holding the decompressed data (1 MiB).
+    static constexpr std::size_t buffer_size = 1024 * 1024;
+
+    /**
+     * @brief Open the file @p filename compressed using @p type.
+     * @param[in] filename the compressed file to read
+     * @param[in] type the compression type; must not be plssvm::detail::io::compression_type::none
+     * @throws plssvm::file_not_found_exception if the file @p filename couldn't be opened
+     * @throws plssvm::file_reader_exception if decompressing @p type isn't supported
+     */
+    decompressing_streambuf(const std::string &filename, compression_type type);
+    /**
+     * @brief Delete the copy-constructor since decompressing_streambuf is not copyable.
+     */
+    decompressing_streambuf(const decompressing_streambuf &) = delete;
+    /**
+     * @brief Delete the copy-assignment operator since decompressing_streambuf is not copyable.
+     * @return `*this`
+     */
+    decompressing_streambuf &operator=(const decompressing_streambuf &) = delete;
+    /**
+     * @brief Release the used decompression context.
+     */
+    ~decompressing_streambuf() override;
+
+  protected:
+    /**
+     * @brief Decompress the next part of the file into the internal buffer.
+     * @throws plssvm::invalid_file_format_exception if the file isn't a valid (or is a truncated) compressed file
+     * @return the next character or `traits_type::eof()` if the whole file has been decompressed
+     */
+    int_type underflow() override;
+
+  private:
+    /// Forward declaration of the decompression context wrapping the zlib or zstd API.
+    struct decompressor;
+    /// The decompression context.
+    std::unique_ptr<decompressor> decompressor_;
+    /// The buffer holding the decompressed data.
+    std::vector<char> buffer_;
+};
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_COMPRESSION_HPP_
@@ -0,0 +1,301 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements parsing functions for the dense CSV file format.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_CSV_PARSING_HPP_
+#define PLSSVM_DETAIL_IO_CSV_PARSING_HPP_
+#pragma once
+
+#include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/io/file_reader.hpp"        // plssvm::detail::io::file_reader
+#include "plssvm/detail/io/libsvm_parsing.hpp"     // plssvm::detail::io::{split_at_line_boundaries, libsvm_range_result, merge_libsvm_ranges}
+#include "plssvm/detail/io/ordered_writer.hpp"     // plssvm::detail::io::{write_ordered, ordered_writer_rows_per_block}
+#include "plssvm/detail/string_conversion.hpp"     // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"        // plssvm::detail::trim_left
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"            // plssvm::csv_options
+
+#include "fmt/format.h"                            // fmt::format, fmt::format_to, fmt::join
+#include "fmt/os.h"                                // fmt::ostream, fmt::output_file
+
+#include <algorithm>                               // std::count, std::min
+#include <cmath>                                   // std::trunc
+#include <cstddef>                                 // std::size_t
+#include <exception>                               // std::exception, std::current_exception
+#include <iterator>                                // std::back_inserter
+#include <optional>                                // std::optional
+#include <string>                                  // std::string
+#include <string_view>                             // std::string_view
+#include <tuple>                                   // std::tuple
+#include <type_traits>                             // std::is_same_v, std::is_integral_v, std::is_floating_point_v
+#include <utility>                                 // std::move
+#include <vector>                                  // std::vector
+
+namespace plssvm::detail::io {
+
+/**
+ * @brief Convert the numeric label @p value to the @p label_type.
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] value the numeric label
+ * @throws plssvm::invalid_file_format_exception if @p label_type is an integral type, but @p value isn't an integral value
+ * @return the converted label (`[[nodiscard]]`)
+ */
+template <typename label_type>
+[[nodiscard]] inline label_type convert_numeric_label(const double value) {
+    if constexpr (std::is_same_v<label_type, std::string>) {
+        return fmt::format("{}", value);
+    } else if constexpr (std::is_floating_point_v<label_type>) {
+        return static_cast<label_type>(value);
+    } else {
+        if (value != std::trunc(value)) {
+            throw invalid_file_format_exception{ fmt::format("Can't convert the non-integral label {} to a value of type {}!", value, arithmetic_type_name<label_type>()) };
+        }
+        return static_cast<label_type>(value);
+    }
+}
+
+/**
+ * @brief Convert the CSV field @p str to the @p label_type.
+ * @details Numeric CSV exporters (e.g., `numpy.savetxt`) write integral labels in floating point notation (e.g., `1.000000000000000000e+00`),
+ *          such values are also accepted for integral label types.
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] str the CSV field containing the label
+ * @throws plssvm::invalid_file_format_exception if @p str can't be converted to the @p label_type
+ * @return the converted label (`[[nodiscard]]`)
+ */
+template <typename label_type>
+[[nodiscard]] inline label_type convert_csv_label(const std::string_view str) {
+    if constexpr (std::is_integral_v<label_type> && !std::is_same_v<label_type, char>) {
+        if (str.find_first_of(".eE") != std::string_view::npos && str.find_first_of("0123456789") != std::string_view::npos) {
+            return convert_numeric_label<label_type>(detail::convert_to<double, invalid_file_format_exception>(str));
+        }
+    }
+    return detail::convert_to<label_type, invalid_file_format_exception>(str);
+}
+
+/**
+ * @brief Parse all data points and potential labels in the CSV @p content, ignoring all empty lines, and append them to @p result.
+ * @details The @p content must start at the beginning of a line and must end directly after a newline or at the end of the file.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] content the byte range to parse
+ * @param[in] delimiter the character separating the values in one line
+ * @param[in] num_columns the number of values in each line
+ * @param[in] label_column the column containing the labels; if empty, the lines contain no labels
+ * @param[in,out] result the parsing result of the byte range
+ * @throws plssvm::invalid_file_format_exception if a line doesn't contain exactly @p num_columns values
+ * @throws plssvm::invalid_file_format_exception if a label couldn't be converted to the provided @p label_type
+ * @throws plssvm::invalid_file_format_exception if a feature value couldn't be converted to the provided @p real_type
+ */
+template <typename real_type, typename label_type>
+inline void parse_csv_range(const std::string_view content, const char delimiter, const std::size_t num_columns, const std::optional<std::size_t> label_column, libsvm_range_result<real_type, label_type> &result) {
+    const std::size_t num_features = label_column.has_value() ? num_columns - 1 : num_columns;
+    result.num_features = num_features;
+
+    std::string_view::size_type pos = 0;
+    while (pos < content.size()) {
+        std::string_view::size_type pos_line_end = content.find_first_of("\r\n", pos);
+        if (pos_line_end == std::string_view::npos) {
+            pos_line_end = content.size();
+        }
+        const std::string_view line = content.substr(pos, pos_line_end - pos);
+        pos = pos_line_end + 1;
+
+        // skip empty lines
+        if (detail::trim_left(line).empty()) {
+            continue;
+        }
+
+        // check the number of values before converting them, otherwise the label column may be wrong
+        const auto line_num_columns = static_cast<std::size_t>(std::count(line.cbegin(), line.cend(), delimiter)) + 1;
+        if (line_num_columns != num_columns) {
+            throw invalid_file_format_exception{ fmt::format("Each line of the CSV file must contain {} values, but \"{}\" contains {}!", num_columns, line, line_num_columns) };
+        }
+
+        std::vector<real_type> data_point(num_features);
+        label_type line_label{};
+        std::size_t feature = 0;
+        std::string_view::size_type field_begin = 0;
+        for (std::size_t column = 0; column < num_columns; ++column) {
+            const std::string_view::size_type field_end = line.find(delimiter, field_begin);
+            const std::string_view field = line.substr(field_begin, field_end == std::string_view::npos ? std::string_view::npos : field_end - field_begin);
+            if (label_column == column) {
+                line_label = convert_csv_label<label_type>(field);
+            } else {
+                data_point[feature++] = detail::convert_to<real_type, invalid_file_format_exception>(field);
+            }
+            field_begin = field_end + 1;
+        }
+
+        result.data.push_back(std::move(data_point));
+        if (label_column.has_value()) {
+            result.has_label = true;
+            result.label.push_back(std::move(line_label));
+        }
+    }
+}
+
+/**
+ * @brief Parse all data points and potential labels directly from the content of the CSV file @p reader, ignoring all empty lines.
+ *        If the file contains no labels (`options.label_column` is empty), returns an empty vector.
+ * @details An example file can look like
+ * @code
+ * -1.117827500607882,-2.9087188881250993,0.66638344270039144,1.0978832703949288,1
+ * -0.5282118298909262,-0.335880984968183973,0.51687296029754564,0.54604461446026,1
+ * 0.57650218263054642,1.01405596624706053,0.13009428079760464,0.7261913886869387,-1
+ * -0.20981208921241892,0.60276937379453293,-0.13086851759108944,0.10805254527169827,-1
+ * 1.88494043717792,1.00518564317278263,0.298499933047586044,1.6464627048813514,-1
+ * @endcode
+ *          The number of values per line is determined using the first (non-header) line. Afterward, the content is split into @p num_chunks byte ranges,
+ *          each starting directly after a newline, which are parsed in parallel and merged in file order (see plssvm::detail::io::parse_libsvm_data_chunked).
+ *          Quoted fields aren't supported, since all values must be numeric (except the label).
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] reader the file_reader used to read the CSV data; read_lines() must **not** have been called
+ * @param[in] options the delimiter, header, and label column of the CSV file
+ * @param[in] num_chunks the number of byte ranges the file content is split into; if `0`, one range per OpenMP thread is used
+ * @throws plssvm::invalid_file_format_exception if the file doesn't contain any data points
+ * @throws plssvm::invalid_file_format_exception if the label column is out of range
+ * @throws plssvm::invalid_file_format_exception if the data points have no features
+ * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_csv_range; if multiple lines are invalid, the exception of the first one in the file is rethrown
+ * @return a std::tuple containing: [num_data_points, num_features, data_points, labels] (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> parse_csv_data(const file_reader &reader, const csv_options &options = {}, std::size_t num_chunks = 0) {
+    PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
+
+    std::string_view content{ reader.buffer(), static_cast<std::string_view::size_type>(reader.num_bytes()) };
+
+    // find the first non-empty line, skipping the header if present
+    std::string_view first_line{};
+    bool skip_header = options.has_header;
+    while (!content.empty()) {
+        std::string_view::size_type pos_line_end = content.find_first_of("\r\n");
+        if (pos_line_end == std::string_view::npos) {
+            pos_line_end = content.size();
+        }
+        const std::string_view line = content.substr(0, pos_line_end);
+        if (!detail::trim_left(line).empty()) {
+            if (!skip_header) {
+                first_line = line;
+                break;
+            }
+            skip_header = false;
+        }
+        content.remove_prefix(std::min(pos_line_end + 1, content.size()));
+    }
+    if (first_line.empty()) {
+        throw invalid_file_format_exception{ "Can't parse file: no data points are given!" };
+    }
+
+    // the number of values in the first line determines the number of features
+    const auto num_columns = static_cast<std::size_t>(std::count(first_line.cbegin(), first_line.cend(), options.delimiter)) + 1;
+    std::optional<std::size_t> label_column{};
+    if (options.label_column.has_value()) {
+        const long long column = options.label_column.value() < 0 ? static_cast<long long>(num_columns) + options.label_column.value() : options.label_column.value();
+        if (column < 0 || column >= static_cast<long long>(num_columns)) {
+            throw invalid_file_format_exception{ fmt::format("The label column {} is out of range for a CSV file with {} columns!", options.label_column.value(), num_columns) };
+        }
+        label_column = static_cast<std::size_t>(column);
+    }
+    if (label_column.has_value() && num_columns == 1) {
+        throw invalid_file_format_exception{ "Can't parse file: no features are given!" };
+    }
+
+    // split the content into byte ranges, each one starting at the beginning of a line
+    const std::vector<std::size_t> chunk_begin = split_at_line_boundaries(content, num_chunks);
+    num_chunks = chunk_begin.size() - 1;
+    const char delimiter = options.delimiter;
+
+    // the thread-local parsing results of each byte range
+    std::vector<libsvm_range_result<real_type, label_type>> chunk_results(num_chunks);
+
+    #pragma omp parallel for schedule(dynamic) default(none) shared(chunk_begin, chunk_results) firstprivate(content, num_chunks, delimiter, num_columns, label_column)
+    for (std::size_t c = 0; c < num_chunks; ++c) {
+        try {
+            parse_csv_range(content.substr(chunk_begin[c], chunk_begin[c + 1] - chunk_begin[c]), delimiter, num_columns, label_column, chunk_results[c]);
+        } catch (const std::exception &) {
+            // store the exception of each byte range to be able to rethrow the first one in file order
+            chunk_results[c].exception = std::current_exception();
+        }
+    }
+
+    return merge_libsvm_ranges(chunk_results);
+}
+
+/**
+ * @brief Write the provided @p data and @p labels to the CSV file @p filename.
+ * @details The values are separated by a `,` and the label is written as the last column. No header is written.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @tparam has_label if `true` the provided labels are also written to the file, if `false` **no** labels are outputted
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @param[in] label the labels to write to the file
+ * @note The data points are written in the same order as in @p data, i.e., the resulting CSV file is independent of the number of used threads.
+ */
+template <typename real_type, typename label_type, bool has_label>
+inline void write_csv_data_impl(const std::string &filename, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) {
+    if constexpr (has_label) {
+        PLSSVM_ASSERT(data.empty() || !label.empty(), "has_label is 'true' but no labels were provided!");
+        PLSSVM_ASSERT(data.size() == label.size(), "Number of data points ({}) and number of labels ({}) mismatch!", data.size(), label.size());
+    } else {
+        PLSSVM_ASSERT(label.empty(), "has_label is 'false' but labels were provided!");
+    }
+
+    // create file
+    fmt::ostream out = fmt::output_file(filename);
+
+    const std::size_t num_data_points = data.size();
+    if (num_data_points == 0) {
+        // nothing to output
+        return;
+    }
+    const std::size_t num_features = data.front().size();
+
+    // format the data points in parallel, but write them in order
+    // one dense value in scientific notation has at most 18 chars + the ','
+    write_ordered(out, num_data_points, ordered_writer_rows_per_block(num_features * 19), [&](std::string &output, const std::size_t i) {
+        if constexpr (has_label) {
+            fmt::format_to(std::back_inserter(output), "{:.10e},{}\n", fmt::join(data[i], ","), label[i]);
+        } else {
+            fmt::format_to(std::back_inserter(output), "{:.10e}\n", fmt::join(data[i], ","));
+        }
+    });
+}
+
+/**
+ * @brief Write the provided @p data and @p labels to the CSV file @p filename, the labels are written as last column.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @param[in] label the labels to write to the file
+ */
+template <typename real_type, typename label_type>
+inline void write_csv_data(const std::string &filename, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) {
+    write_csv_data_impl<real_type, label_type, true>(filename, data, label);
+}
+
+/**
+ * @brief Write the provided @p data to the CSV file @p filename.
+ * @tparam real_type the floating point type
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ */
+template <typename real_type>
+inline void write_csv_data(const std::string &filename, const std::vector<std::vector<real_type>> &data) {
+    write_csv_data_impl<real_type, real_type, false>(filename, data, {});
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_CSV_PARSING_HPP_
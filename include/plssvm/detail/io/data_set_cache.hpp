@@ -0,0 +1,145 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements an opt-in cache storing the parsed content of text data set files as memory-mappable binary images.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_DATA_SET_CACHE_HPP_
+#define PLSSVM_DETAIL_IO_DATA_SET_CACHE_HPP_
+#pragma once
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uintmax_t
+#include <filesystem>   // std::filesystem::path
+#include <iosfwd>       // forward declare std::ostream
+#include <optional>     // std::optional
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+
+namespace plssvm {
+
+/**
+ * @brief The settings of the cache storing the parsed content of text data set files (LIBSVM, ARFF, and CSV).
+ * @details If enabled, the first read of a data set file stores a binary image of the parsed data points and labels in the cache directory.
+ *          Subsequent reads of the same, unchanged file memory map this image instead of parsing the text again.
+ *          A cache entry is identified by the path, size, and last modification time of the file (and optionally a sampled fingerprint of its content),
+ *          the parser settings, and the used real_type and label_type.
+ */
+struct data_set_cache_options {
+    /// `true` if the data set cache should be used.
+    bool enabled{ false };
+    /// The directory containing the cached binary images. If empty, the per-user directory `$XDG_CACHE_HOME/plssvm/data_set_cache` (or `~/.cache/plssvm/data_set_cache`) is used.
+    std::filesystem::path directory{};
+    /// The maximum total size (in bytes) of all cached binary images. If exceeded, the least recently used images are evicted. `0` means no limit.
+    std::uintmax_t max_size{ std::uintmax_t{ 8 } * 1024 * 1024 * 1024 };
+    /// `true` if a sha256 fingerprint of samples of the file content should additionally identify a cache entry (detects changes that keep the file size and modification time).
+    bool fingerprint{ false };
+};
+
+/// The data set cache settings used when reading data sets from files. Disabled by default. May be changed by the user.
+extern data_set_cache_options data_set_cache;
+
+/**
+ * @brief Output the data set cache @p options to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the data set cache options to
+ * @param[in] options the data set cache options
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const data_set_cache_options &options);
+
+namespace detail::io {
+
+/// The number of equally spaced samples of the file content used to calculate the fingerprint of a data set file.
+constexpr std::size_t data_set_cache_num_fingerprint_samples{ 64 };
+/// The size (in bytes) of a single sample used to calculate the fingerprint of a data set file.
+constexpr std::size_t data_set_cache_fingerprint_sample_size{ 4096 };
+
+/**
+ * @brief Return the directory containing the cached binary images according to @p options.
+ * @details If no directory is given in @p options, `$XDG_CACHE_HOME/plssvm/data_set_cache` is used, falling back to `$HOME/.cache/plssvm/data_set_cache`.
+ *          If neither environment variable is set, a directory in the temporary directory whose name contains the user ID is used.
+ * @param[in] options the data set cache options
+ * @return the cache directory (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::filesystem::path data_set_cache_directory(const data_set_cache_options &options);
+
+/**
+ * @brief Check that the cache @p directory can't be manipulated by other users, i.e., that it is owned by the current user and neither group- nor world-writable.
+ * @details A non-existing @p directory is accepted since it is created with the correct permissions.
+ * @param[in] directory the cache directory
+ * @throws plssvm::file_exception if @p directory isn't a directory, isn't owned by the current user, or is writable by other users
+ */
+void check_data_set_cache_directory(const std::filesystem::path &directory);
+
+/**
+ * @brief Calculate the sha256 fingerprint of the file @p filename using plssvm::detail::io::data_set_cache_num_fingerprint_samples equally spaced samples of its content.
+ * @details The first and last sample are always located at the beginning and end of the file. Files smaller than all samples combined are hashed completely.
+ * @param[in] filename the file to fingerprint
+ * @throws plssvm::file_not_found_exception if the @p filename couldn't be opened
+ * @return the sha256 fingerprint (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::string data_set_cache_fingerprint(const std::filesystem::path &filename);
+
+/**
+ * @brief Determine the cache entry of the data set file @p filename parsed using the @p parser_settings.
+ * @details The @p parser_settings must contain everything influencing the parsed result besides the file content, e.g., the file format, the CSV options, and the used types.
+ * @param[in] options the data set cache options
+ * @param[in] filename the data set file
+ * @param[in] parser_settings the settings used to parse @p filename
+ * @throws plssvm::file_exception if the cache directory could have been manipulated by other users (see plssvm::detail::io::check_data_set_cache_directory)
+ * @return the path of the cache entry; `std::nullopt` if the cache is disabled or @p filename isn't a regular file (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::optional<std::filesystem::path> data_set_cache_entry(const data_set_cache_options &options, const std::string &filename, std::string_view parser_settings);
+
+/**
+ * @brief Mark the cache @p entry as most recently used by updating its last modification time.
+ * @param[in] entry the cache entry
+ * @return `true` if the cache @p entry exists, `false` otherwise (`[[nodiscard]]`)
+ */
+[[nodiscard]] bool touch_data_set_cache_entry(const std::filesystem::path &entry);
+
+/**
+ * @brief Remove the (corrupted) cache @p entry.
+ * @param[in] entry the cache entry
+ */
+void remove_data_set_cache_entry(const std::filesystem::path &entry);
+
+/**
+ * @brief Create the cache directory (if necessary) and return a unique temporary file in it to which the binary image of the cache @p entry can be written.
+ * @details The binary image must be written to a temporary file first, such that concurrent readers never see a partially written cache entry.
+ * @param[in] options the data set cache options
+ * @param[in] entry the cache entry
+ * @throws std::filesystem::filesystem_error if the cache directory couldn't be created
+ * @throws plssvm::file_exception if the cache directory could have been manipulated by other users (see plssvm::detail::io::check_data_set_cache_directory)
+ * @return the temporary file (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::filesystem::path create_data_set_cache_file(const data_set_cache_options &options, const std::filesystem::path &entry);
+
+/**
+ * @brief Atomically publish the @p temporary_file as cache @p entry and evict the least recently used entries until the cache size is below the maximum size given in @p options.
+ * @details If the @p temporary_file alone is larger than the maximum cache size, it is removed instead.
+ * @param[in] options the data set cache options
+ * @param[in] temporary_file the file containing the complete binary image (created using plssvm::detail::io::create_data_set_cache_file)
+ * @param[in] entry the cache entry
+ * @throws std::filesystem::filesystem_error if the size of the @p temporary_file couldn't be determined or it couldn't be renamed
+ * @return `true` if the cache @p entry has been published, `false` if it has been discarded
+ */
+bool commit_data_set_cache_entry(const data_set_cache_options &options, const std::filesystem::path &temporary_file, const std::filesystem::path &entry);
+
+/**
+ * @brief Evict the least recently used cache entries until the total size of all cache entries doesn't exceed the maximum size given in @p options.
+ * @param[in] options the data set cache options
+ * @return the number of evicted cache entries
+ */
+std::size_t evict_data_set_cache_entries(const data_set_cache_options &options);
+
+}  // namespace detail::io
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_DETAIL_IO_DATA_SET_CACHE_HPP_
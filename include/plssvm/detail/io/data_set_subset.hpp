@@ -0,0 +1,358 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements the column projection and row sampling used to read only a subset of a data set file.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_DATA_SET_SUBSET_HPP_
+#define PLSSVM_DETAIL_IO_DATA_SET_SUBSET_HPP_
+#pragma once
+
+#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"     // plssvm::detail::{split, trim}
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_parameter_exception, plssvm::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"         // plssvm::subset_options
+#include "plssvm/sampling_types.hpp"            // plssvm::sampling_type
+
+#include "fmt/core.h"                           // fmt::format
+#include "fmt/format.h"                         // fmt::join
+
+#include <algorithm>                            // std::sort, std::unique, std::max_element
+#include <cmath>                                // std::floor
+#include <cstddef>                              // std::size_t
+#include <limits>                               // std::numeric_limits::max
+#include <map>                                  // std::map
+#include <random>                               // std::mt19937, std::uniform_real_distribution
+#include <string>                               // std::string
+#include <string_view>                          // std::string_view
+#include <utility>                              // std::move, std::pair
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::io {
+
+/**
+ * @brief The maximum number of feature indices a feature selection may contain.
+ * @details Guards against huge allocations for feature selections like `0-18446744073709551614`.
+ */
+constexpr std::size_t max_num_selected_features = std::size_t{ 1 } << 24;
+
+/**
+ * @brief Parse the comma separated list of zero-based feature indices and inclusive index ranges in @p selection, e.g., `0-9,15,20-29`.
+ * @param[in] selection the feature selection to parse
+ * @throws plssvm::invalid_parameter_exception if @p selection is empty or contains an empty entry
+ * @throws plssvm::invalid_parameter_exception if an index couldn't be converted to `unsigned long`
+ * @throws plssvm::invalid_parameter_exception if the first index of a range is larger than its last index
+ * @throws plssvm::invalid_parameter_exception if @p selection contains more than plssvm::detail::io::max_num_selected_features feature indices
+ * @return the selected feature indices in strictly increasing order (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::vector<std::size_t> parse_feature_selection(const std::string_view selection) {
+    std::vector<std::size_t> features{};
+    for (const std::string_view entry : detail::split(detail::trim(selection), ',')) {
+        const std::string_view trimmed_entry = detail::trim(entry);
+        if (trimmed_entry.empty()) {
+            throw invalid_parameter_exception{ fmt::format("Invalid feature selection \"{}\": empty entries are not allowed!", selection) };
+        }
+        const std::string_view::size_type pos_dash = trimmed_entry.find('-');
+        if (pos_dash == std::string_view::npos) {
+            // single feature index
+            if (features.size() == max_num_selected_features) {
+                throw invalid_parameter_exception{ fmt::format("Invalid feature selection \"{}\": at most {} feature indices may be selected!", selection, max_num_selected_features) };
+            }
+            features.push_back(detail::convert_to<unsigned long, invalid_parameter_exception>(trimmed_entry));
+        } else {
+            // inclusive range of feature indices
+            const auto first = detail::convert_to<unsigned long, invalid_parameter_exception>(trimmed_entry.substr(0, pos_dash));
+            const auto last = detail::convert_to<unsigned long, invalid_parameter_exception>(trimmed_entry.substr(pos_dash + 1));
+            if (first > last) {
+                throw invalid_parameter_exception{ fmt::format("Invalid feature range \"{}\": the first index {} must not be larger than the last index {}!", trimmed_entry, first, last) };
+            }
+            // check the size of the range before expanding it (last - first + 1 may overflow)
+            if (last - first >= max_num_selected_features - features.size()) {
+                throw invalid_parameter_exception{ fmt::format("Invalid feature selection \"{}\": at most {} feature indices may be selected!", selection, max_num_selected_features) };
+            }
+            for (unsigned long offset = 0; offset <= last - first; ++offset) {
+                features.push_back(first + offset);
+            }
+        }
+    }
+    if (features.empty()) {
+        throw invalid_parameter_exception{ "The feature selection must not be empty!" };
+    }
+
+    std::sort(features.begin(), features.end());
+    features.erase(std::unique(features.begin(), features.end()), features.end());
+    return features;
+}
+
+/**
+ * @brief Format the zero-based feature indices @p features in the format understood by plssvm::detail::io::parse_feature_selection, i.e., consecutive indices are combined to ranges.
+ * @param[in] features the feature indices (in any order; duplicates are ignored)
+ * @return the formatted feature selection, e.g., `0-9,15,20-29` (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::string format_feature_selection(std::vector<std::size_t> features) {
+    std::sort(features.begin(), features.end());
+    features.erase(std::unique(features.begin(), features.end()), features.end());
+
+    std::vector<std::string> entries{};
+    for (std::size_t i = 0; i < features.size();) {
+        // find the end of the range of consecutive feature indices starting at i
+        std::size_t j = i;
+        while (j + 1 < features.size() && features[j + 1] == features[j] + 1) {
+            ++j;
+        }
+        entries.push_back(i == j ? fmt::format("{}", features[i]) : fmt::format("{}-{}", features[i], features[j]));
+        i = j + 1;
+    }
+    return fmt::format("{}", fmt::join(entries, ","));
+}
+
+/**
+ * @brief Maps the zero-based feature indices of a data set file to the indices of the kept features while parsing the file.
+ * @details Allows the parsers to skip the values of all features that aren't kept, without converting them to a floating point value.
+ *          Only the kept feature indices are stored, i.e., the memory consumption is independent of the largest kept feature index.
+ */
+class feature_projection {
+  public:
+    /// The index returned for all features that aren't kept.
+    static constexpr std::size_t skip = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Default construct a projection keeping all features.
+     */
+    feature_projection() = default;
+    /**
+     * @brief Construct a projection keeping only the zero-based feature indices @p features (in any order; duplicates are ignored).
+     * @details If @p features is empty, all features are kept.
+     * @param[in] features the features to keep
+     */
+    explicit feature_projection(std::vector<std::size_t> features) :
+        features_{ std::move(features) } {
+        std::sort(features_.begin(), features_.end());
+        features_.erase(std::unique(features_.begin(), features_.end()), features_.end());
+    }
+
+    /**
+     * @brief Check whether all features are kept.
+     * @return `true` if no projection takes place, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool keeps_all_features() const noexcept { return features_.empty(); }
+    /**
+     * @brief Return the number of kept features.
+     * @return the number of features after the projection, `0` if all features are kept (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_features() const noexcept { return features_.size(); }
+    /**
+     * @brief Return the largest kept zero-based feature index. All features with a larger index can be skipped altogether.
+     * @return the largest kept feature index, `0` if all features are kept (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t max_index() const noexcept { return features_.empty() ? 0 : features_.back(); }
+    /**
+     * @brief Return the kept zero-based feature indices, i.e., the kept feature `i` has the index `features()[i]` in the data set file.
+     * @return the kept feature indices in strictly increasing order, empty if all features are kept (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<std::size_t> &features() const noexcept { return features_; }
+    /**
+     * @brief Map the zero-based feature @p index of the data set file to the index of the kept feature.
+     * @details Uses a binary search over the kept feature indices.
+     * @param[in] index the feature index in the data set file
+     * @return the feature index after the projection or plssvm::detail::io::feature_projection::skip if the feature isn't kept (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t operator[](const std::size_t index) const noexcept {
+        if (features_.empty()) {
+            return index;
+        }
+        const auto it = std::lower_bound(features_.cbegin(), features_.cend(), index);
+        return it != features_.cend() && *it == index ? static_cast<std::size_t>(it - features_.cbegin()) : skip;
+    }
+
+  private:
+    /// The kept feature indices in strictly increasing order.
+    std::vector<std::size_t> features_{};
+};
+
+/**
+ * @brief Check whether all features kept by the @p projection are present in a data set file with @p num_features features.
+ * @param[in] projection the features to keep
+ * @param[in] num_features the number of features in the data set file
+ * @throws plssvm::invalid_file_format_exception if a kept feature index is larger or equal than @p num_features
+ */
+inline void check_feature_projection(const feature_projection &projection, const std::size_t num_features) {
+    if (!projection.keeps_all_features() && projection.max_index() >= num_features) {
+        throw invalid_file_format_exception{ fmt::format("Can't keep the feature with index {} since the data points only have {} features!", projection.max_index(), num_features) };
+    }
+}
+
+/**
+ * @brief Draw @p num_samples of the @p num_data_points indices uniformly at random without replacement using the @p generator.
+ * @details Uses selection sampling, i.e., the indices are drawn in a single pass in increasing order and only the drawn indices are stored.
+ * @param[in] num_data_points the total number of data points
+ * @param[in] num_samples the number of data points to draw
+ * @param[in,out] generator the pseudo-random number generator
+ * @return the drawn indices in strictly increasing order; all indices if @p num_samples is `0` or not smaller than @p num_data_points (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::vector<std::size_t> sample_uniform(const std::size_t num_data_points, const std::size_t num_samples, std::mt19937 &generator) {
+    std::vector<std::size_t> indices{};
+    if (num_samples == 0 || num_samples >= num_data_points) {
+        indices.resize(num_data_points);
+        for (std::size_t i = 0; i < num_data_points; ++i) {
+            indices[i] = i;
+        }
+        return indices;
+    }
+
+    indices.reserve(num_samples);
+    std::uniform_real_distribution<double> dist{ 0.0, 1.0 };
+    for (std::size_t i = 0; i < num_data_points && indices.size() < num_samples; ++i) {
+        // select the current index with the probability: number of still needed samples / number of remaining indices
+        if (static_cast<double>(num_data_points - i) * dist(generator) < static_cast<double>(num_samples - indices.size())) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+/**
+ * @brief Draw a stratified random sample of @p num_samples data points out of all `labels.size()` data points.
+ * @details Each class contributes proportionally to its size (at least one data point per class if @p num_samples
+ *          is not smaller than the number of classes). A fixed seed is used such that the sample is reproducible.
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] labels the labels of all data points
+ * @param[in] num_samples the number of data points to draw
+ * @return the drawn indices in strictly increasing order; all indices if @p num_samples is `0` or not smaller than the number of data points (`[[nodiscard]]`)
+ */
+template <typename label_type>
+[[nodiscard]] inline std::vector<std::size_t> sample_stratified(const std::vector<label_type> &labels, const std::size_t num_samples) {
+    std::mt19937 generator{ 42 };
+    const std::size_t num_data_points = labels.size();
+    if (num_samples == 0 || num_samples >= num_data_points) {
+        return sample_uniform(num_data_points, num_samples, generator);
+    }
+
+    // group the data point indices by their class; std::map results in a deterministic class order
+    std::map<label_type, std::vector<std::size_t>> classes{};
+    for (std::size_t i = 0; i < num_data_points; ++i) {
+        classes[labels[i]].push_back(i);
+    }
+
+    // distribute the samples proportionally to the class sizes using the largest remainder method
+    std::vector<std::pair<const label_type *, std::size_t>> quota{};
+    std::vector<std::pair<double, std::size_t>> remainders{};
+    std::size_t num_distributed{ 0 };
+    for (const auto &[label, indices] : classes) {
+        const double exact_quota = static_cast<double>(num_samples) * static_cast<double>(indices.size()) / static_cast<double>(num_data_points);
+        const auto class_quota = static_cast<std::size_t>(std::floor(exact_quota));
+        remainders.emplace_back(exact_quota - static_cast<double>(class_quota), quota.size());
+        quota.emplace_back(&label, class_quota);
+        num_distributed += class_quota;
+    }
+    std::sort(remainders.begin(), remainders.end(), [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second); });
+    for (std::size_t i = 0; num_distributed < num_samples; ++i, ++num_distributed) {
+        ++quota[remainders[i].second].second;
+    }
+    // each class should be part of the sample, take the missing data points from the largest classes
+    if (num_samples >= quota.size()) {
+        for (auto &[label, class_quota] : quota) {
+            if (class_quota == 0) {
+                auto largest = std::max_element(quota.begin(), quota.end(), [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+                --largest->second;
+                class_quota = 1;
+            }
+        }
+    }
+
+    // draw the samples of each class
+    std::vector<std::size_t> sample{};
+    sample.reserve(num_samples);
+    for (const auto &[label, class_quota] : quota) {
+        const std::vector<std::size_t> &indices = classes[*label];
+        for (const std::size_t i : sample_uniform(indices.size(), class_quota, generator)) {
+            sample.push_back(indices[i]);
+        }
+    }
+    std::sort(sample.begin(), sample.end());
+    return sample;
+}
+
+/**
+ * @brief Draw @p num_samples of the @p num_data_points indices uniformly at random without replacement. A fixed seed is used such that the sample is reproducible.
+ * @param[in] num_data_points the total number of data points
+ * @param[in] num_samples the number of data points to draw
+ * @return the drawn indices in strictly increasing order; all indices if @p num_samples is `0` or not smaller than @p num_data_points (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::vector<std::size_t> sample_uniform(const std::size_t num_data_points, const std::size_t num_samples) {
+    std::mt19937 generator{ 42 };
+    return sample_uniform(num_data_points, num_samples, generator);
+}
+
+/**
+ * @brief Check whether the @p subset requires a random sample of the data points.
+ * @param[in] subset the subset options
+ * @return `true` if only some data points should be kept, `false` otherwise (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline bool samples_data_points(const subset_options &subset) noexcept {
+    return subset.num_samples > 0;
+}
+
+/**
+ * @brief Keep only the features and a random sample of the data points given by @p subset from the already parsed @p data and @p label.
+ * @details Used for all file formats whose parsers don't support the @p subset directly, e.g., the binary and NumPy formats.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in,out] data the parsed data points
+ * @param[in,out] label the parsed labels; may be empty if the data set has no labels
+ * @param[in] subset the features and the number of data points to keep
+ * @throws plssvm::invalid_file_format_exception if a kept feature index is larger or equal than the number of features in @p data
+ * @throws plssvm::invalid_file_format_exception if a stratified sample should be drawn, but the data points have no labels
+ */
+template <typename real_type, typename label_type>
+inline void select_subset(std::vector<std::vector<real_type>> &data, std::vector<label_type> &label, const subset_options &subset) {
+    // draw the random sample of the data points
+    if (samples_data_points(subset) && subset.num_samples < data.size()) {
+        std::vector<std::size_t> sample{};
+        if (subset.sampling == sampling_type::stratified) {
+            if (label.empty()) {
+                throw invalid_file_format_exception{ "Can't draw a stratified sample since the data points have no labels!" };
+            }
+            sample = sample_stratified(label, subset.num_samples);
+        } else {
+            sample = sample_uniform(data.size(), subset.num_samples);
+        }
+        // the sample is in strictly increasing order -> the data points can be moved in-place
+        for (std::size_t i = 0; i < sample.size(); ++i) {
+            if (i != sample[i]) {
+                data[i] = std::move(data[sample[i]]);
+                if (!label.empty()) {
+                    label[i] = label[sample[i]];
+                }
+            }
+        }
+        data.resize(sample.size());
+        if (!label.empty()) {
+            label.resize(sample.size());
+        }
+    }
+
+    // keep only the selected features
+    const feature_projection projection{ subset.features };
+    if (!projection.keeps_all_features()) {
+        check_feature_projection(projection, data.empty() ? 0 : data.front().size());
+        const std::vector<std::size_t> &features = projection.features();
+        #pragma omp parallel for default(none) shared(data, features)
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            std::vector<real_type> data_point(features.size());
+            for (std::size_t f = 0; f < features.size(); ++f) {
+                data_point[f] = data[i][features[f]];
+            }
+            data[i] = std::move(data_point);
+        }
+    }
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_DATA_SET_SUBSET_HPP_
@@ -28,16 +28,28 @@
 
 #include <filesystem>   // std::filesystem::path
 #include <ios>          // std::streamsize
+#include <istream>      // std::istream
 #include <string>       // std::string
 #include <string_view>  // std::string_view
 #include <vector>       // std::vector
 
 namespace plssvm::detail::io {
 
+/**
+ * @brief Check whether @p filename denotes the standard input, i.e., is either `-` or `/dev/stdin`.
+ * @param[in] filename the filename to check
+ * @return `true` if @p filename denotes the standard input, otherwise `false` (`[[nodiscard]]`)
+ */
+[[nodiscard]] bool is_standard_input(std::string_view filename) noexcept;
+
 /**
  * @brief The plssvm::detail::file_reader class is responsible for reading a file and splitting it into its lines.
  * @details If the necessary headers are present, the class tries to memory map the given file. If this fails or if the headers are not present,
  *          the file is read as one blob using [`std::ifstream::read`](https://en.cppreference.com/w/cpp/io/basic_ifstream).
+ *          Files ending with `.gz` or `.zst` are transparently decompressed (see plssvm::detail::io::decompress), if PLSSVM was built with zlib or zstd support respectively.
+ *          Since the whole decompressed file is kept in memory, plssvm::data_set doesn't use the file_reader for compressed LIBSVM files, but parses them while decompressing
+ *          (see plssvm::detail::io::decompressing_streambuf); the whole-file decompression is only used for the formats needing random access (e.g., ARFF or binary files).
+ *          The standard input (`-` or `/dev/stdin`) and other files that can't be memory mapped since they aren't regular files (e.g., pipes) are read in chunks into a growing buffer.
  */
 class file_reader {
   public:
@@ -92,6 +104,8 @@ class file_reader {
      * @param[in] filename the file to open
      * @throws plssvm::file_reader_exception if the file_reader has already opened another file
      * @throws plssvm::file_not_found_exception if the @p filename couldn't be found
+     * @throws plssvm::file_reader_exception if the @p filename is compressed, but PLSSVM was built without support for the respective compression type
+     * @throws plssvm::invalid_file_format_exception if the @p filename is compressed, but isn't a valid compressed file
      */
     void open(const char *filename);
     /**
@@ -156,8 +170,29 @@ class file_reader {
      * @return the file content (`[[nodiscard]]`)
      */
     [[nodiscard]] const char *buffer() const noexcept;
+    /**
+     * @brief Return the number of bytes of the underlying file content.
+     * @details Returns `0` if no file is currently associated with this file_reader.
+     * @return the number of bytes (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::streamsize num_bytes() const noexcept;
 
   private:
+    /**
+     * @brief Open the file @p filename and "read" its content without decompressing it, using memory mapped IO if possible.
+     * @param[in] filename the file to open
+     * @throws plssvm::file_not_found_exception if the @p filename couldn't be found
+     */
+    void open_uncompressed_file(const char *filename);
+
+    /**
+     * @brief Read the whole content of the input stream @p in, whose size isn't known beforehand (e.g., the standard input or a pipe), in chunks into a growing buffer.
+     * @param[in,out] in the input stream to read
+     * @param[in] filename the name of the read file (only used in error messages)
+     * @throws plssvm::invalid_file_format_exception if an error occurs while reading from @p in
+     */
+    void open_stream(std::istream &in, const char *filename);
+
     /**
      * @brief Try to open the file @p filename and "read" its content using memory mapped IO on UNIX systems.
      * @details If the file could not be memory mapped, automatically falls back to open_file().
@@ -197,6 +232,8 @@ class file_reader {
 #endif
     /// The content of the file. Pointer to the memory mapped area or to a separately allocated memory area holding the file's content. If the file is empty, corresponds to a `nullptr`!
     char *file_content_{ nullptr };
+    /// The decompressed content of a compressed file or the content read from a stream (e.g., the standard input). If not empty, file_content_ points to its data.
+    std::vector<char> content_buffer_{};
     /// The number of bytes stored in file_content_.
     std::streamsize num_bytes_{ 0 };
     /// The parsed content of file_content_: a vector of all lines that are not empty and do not start with the provided comment.
@@ -0,0 +1,215 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a reader parsing a LIBSVM file chunk by chunk such that only a bounded number of data points is in memory at any time.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_LIBSVM_CHUNK_READER_HPP_
+#define PLSSVM_DETAIL_IO_LIBSVM_CHUNK_READER_HPP_
+#pragma once
+
+#include "plssvm/detail/io/compression.hpp"     // plssvm::detail::io::{compression_type, determine_compression_type, decompressing_streambuf}
+#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::is_standard_input
+#include "plssvm/detail/io/libsvm_parsing.hpp"  // plssvm::detail::io::{parse_libsvm_last_index, parse_libsvm_line}
+#include "plssvm/detail/string_utility.hpp"     // plssvm::detail::{trim_left, starts_with, ends_with}
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::file_not_found_exception, plssvm::invalid_file_format_exception
+
+#include "fmt/core.h"                           // fmt::format
+
+#include <cstddef>                              // std::size_t
+#include <exception>                            // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <fstream>                              // std::ifstream
+#include <ios>                                  // std::ios
+#include <iostream>                             // std::cin
+#include <istream>                              // std::istream
+#include <memory>                               // std::unique_ptr, std::make_unique
+#include <string>                               // std::string, std::getline
+#include <string_view>                          // std::string_view
+#include <type_traits>                          // std::is_same_v
+#include <utility>                              // std::pair, std::make_pair, std::move
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::io {
+
+/**
+ * @brief Reads the data points and potential labels of a LIBSVM file in chunks of a user defined number of data points.
+ * @details In contrast to plssvm::detail::io::parse_libsvm_data, the file is **not** read at once, i.e., the memory consumption only depends on the chunk size.
+ *          Since the number of features can't be determined without reading the whole file, it must be provided (e.g., by a previously learned model).
+ *          Data points with fewer features are padded with zeros.
+ *          Files ending with `.gz` or `.zst` are decompressed on-the-fly using bounded buffers (see plssvm::detail::io::decompressing_streambuf), i.e., the decompressed file is never materialized.
+ *          If the filename is `-` or `/dev/stdin`, the data points are read from the standard input.
+ * @tparam T the floating point type
+ * @tparam U the type of the labels (any arithmetic type or std::string)
+ */
+template <typename T, typename U>
+class libsvm_chunk_reader {
+  public:
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+    /// The type of the labels: any arithmetic type or `std::string`.
+    using label_type = U;
+
+    /**
+     * @brief Open the LIBSVM file @p filename whose data points have at most @p num_features features.
+     * @param[in] filename the LIBSVM file to read
+     * @param[in] num_features the number of features of each read data point
+     * @throws plssvm::file_not_found_exception if the file @p filename couldn't be opened
+     * @throws plssvm::file_reader_exception if the file @p filename is compressed, but PLSSVM was built without support for the respective compression type
+     */
+    libsvm_chunk_reader(const std::string &filename, std::size_t num_features);
+
+    /**
+     * @brief Read and parse the next at most @p max_num_data_points data points, ignoring all empty lines and lines starting with an `#`.
+     * @details If the data points aren't annotated with labels, the returned labels are empty.
+     * @param[in] max_num_data_points the maximum number of data points to read
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_libsvm_last_index and plssvm::detail::io::parse_libsvm_line
+     * @throws plssvm::invalid_file_format_exception if a feature index is larger than the number of features provided in the constructor
+     * @throws plssvm::invalid_file_format_exception if only **some** of the data points read so far are annotated with labels
+     * @throws plssvm::invalid_file_format_exception if the file is compressed, but isn't a valid compressed file
+     * @return the parsed data points and labels; empty if the end of the file has been reached (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::pair<std::vector<std::vector<real_type>>, std::vector<label_type>> read_chunk(std::size_t max_num_data_points);
+
+    /**
+     * @brief Return the number of features of each read data point.
+     * @return the number of features (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_features() const noexcept { return num_features_; }
+    /**
+     * @brief Return the number of data points read so far.
+     * @return the number of data points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_data_points() const noexcept { return num_data_points_; }
+    /**
+     * @brief Check whether the data points read so far are annotated with labels.
+     * @return `true` if labels are present, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool has_labels() const noexcept { return has_label_; }
+
+  private:
+    /// The input file stream of an uncompressed LIBSVM file.
+    std::ifstream file_{};
+    /// The stream buffer decompressing a compressed LIBSVM file on-the-fly.
+    std::unique_ptr<decompressing_streambuf> decompressor_{};
+    /// The input stream reading the (decompressed) LIBSVM file using the stream buffer of either file_, decompressor_, or the standard input.
+    std::istream in_{ nullptr };
+    /// The number of features of each data point.
+    std::size_t num_features_{ 0 };
+    /// The number of data points read so far.
+    std::size_t num_data_points_{ 0 };
+    /// `true` if any data point read so far has a label.
+    bool has_label_{ false };
+    /// `true` if any data point read so far has no label.
+    bool has_no_label_{ false };
+};
+
+template <typename T, typename U>
+libsvm_chunk_reader<T, U>::libsvm_chunk_reader(const std::string &filename, const std::size_t num_features) :
+    num_features_{ num_features } {
+    const compression_type compression = determine_compression_type(filename);
+    if (is_standard_input(filename)) {
+        // read the data points directly from the standard input
+        in_.rdbuf(std::cin.rdbuf());
+    } else if (compression == compression_type::none) {
+        file_.open(filename, std::ios::binary);
+        if (!file_.is_open()) {
+            throw file_not_found_exception{ fmt::format("Couldn't find file: '{}'!", filename) };
+        }
+        in_.rdbuf(file_.rdbuf());
+    } else {
+        decompressor_ = std::make_unique<decompressing_streambuf>(filename, compression);
+        in_.rdbuf(decompressor_.get());
+        // rethrow the exceptions thrown while decompressing instead of silently stopping to read
+        in_.exceptions(std::ios::badbit);
+    }
+}
+
+template <typename T, typename U>
+auto libsvm_chunk_reader<T, U>::read_chunk(const std::size_t max_num_data_points) -> std::pair<std::vector<std::vector<real_type>>, std::vector<label_type>> {
+    // read the next lines containing data points
+    std::vector<std::string> lines;
+    std::string line;
+    while (lines.size() < max_num_data_points && std::getline(in_, line)) {
+        // handle Windows line endings
+        if (detail::ends_with(line, '\r')) {
+            line.pop_back();
+        }
+        // skip empty lines and comments
+        const std::string_view trimmed_line = detail::trim_left(line);
+        if (trimmed_line.empty() || detail::starts_with(trimmed_line, '#')) {
+            continue;
+        }
+        lines.emplace_back(trimmed_line);
+    }
+
+    // parse the read data points
+    std::vector<std::vector<real_type>> data(lines.size());
+    std::vector<label_type> label(lines.size());
+
+    const std::size_t num_features = num_features_;
+    std::exception_ptr parallel_exception;
+    bool has_label = false;
+    bool has_no_label = false;
+
+    #pragma omp parallel default(none) shared(lines, data, label, parallel_exception, has_label, has_no_label) firstprivate(num_features)
+    {
+        #pragma omp for reduction(|| : has_label) reduction(|| : has_no_label)
+        for (typename std::vector<std::string>::size_type i = 0; i < lines.size(); ++i) {
+            try {
+                // the number of features is fixed -> the data point must not contain larger feature indices
+                const std::size_t last_index = parse_libsvm_last_index(lines[i]);
+                if (last_index > num_features) {
+                    throw invalid_file_format_exception{ fmt::format("The feature index {} is larger than the number of features {}!", last_index, num_features) };
+                }
+
+                std::vector<real_type> vline(num_features);
+                label_type line_label{};
+                if (parse_libsvm_line(lines[i], vline, line_label)) {
+                    has_label = true;
+                    if constexpr (std::is_same_v<label_type, bool>) {
+                        // the std::vector<bool> template specialization is per C++ standard NOT thread safe
+                        #pragma omp critical
+                        label[i] = line_label;
+                    } else {
+                        label[i] = std::move(line_label);
+                    }
+                } else {
+                    has_no_label = true;
+                }
+                data[i] = std::move(vline);
+            } catch (const std::exception &) {
+                // catch first exception and store it
+                #pragma omp critical
+                {
+                    if (!parallel_exception) {
+                        parallel_exception = std::current_exception();
+                    }
+                }
+            }
+        }
+    }
+
+    // rethrow if an exception occurred inside the parallel region
+    if (parallel_exception) {
+        std::rethrow_exception(parallel_exception);
+    }
+    // the labels must be consistent over ALL chunks
+    has_label_ = has_label_ || has_label;
+    has_no_label_ = has_no_label_ || has_no_label;
+    if (has_label_ && has_no_label_) {
+        // some data points where given with labels, BUT some data pints where given without labels
+        throw invalid_file_format_exception{ "Inconsistent label specification found (some data points are labeled, others are not)!" };
+    }
+
+    num_data_points_ += data.size();
+    return std::make_pair(std::move(data), has_label ? std::move(label) : std::vector<label_type>{});
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_LIBSVM_CHUNK_READER_HPP_
@@ -13,23 +13,20 @@
 #define PLSSVM_DETAIL_IO_LIBSVM_MODEL_PARSING_HPP_
 #pragma once
 
-#include "plssvm/data_set.hpp"        // plssvm::data_set
-#include "plssvm/detail/assert.hpp"   // PLSSVM_ASSERT
-#include "plssvm/detail/logger.hpp"   // plssvm::detail::log, plssvm::verbosity_level
-#include "plssvm/detail/utility.hpp"  // plssvm::detail::current_date_time
-#include "plssvm/parameter.hpp"       // plssvm::parameter
+#include "plssvm/data_set.hpp"                  // plssvm::data_set
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/io/ordered_writer.hpp"  // plssvm::detail::io::{write_ordered, ordered_writer_rows_per_block}
+#include "plssvm/detail/logger.hpp"             // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/utility.hpp"            // plssvm::detail::current_date_time
+#include "plssvm/parameter.hpp"                 // plssvm::parameter
 
 #include "fmt/compile.h"  // FMT_COMPILE
 #include "fmt/format.h"   // fmt::format, fmt::format_to
 #include "fmt/os.h"       // fmt::ostream, fmt::output_file
-#ifdef _OPENMP
-    #include <omp.h>  // omp_get_num_threads
-#endif
 
 #include <algorithm>    // std::min, std::fill
 #include <cstddef>      // std::size_t
 #include <map>          // std::map
-#include <memory>       // std::unique_ptr
 #include <numeric>      // std::accumulate
 #include <set>          // std::set
 #include <sstream>      // std::stringstream
@@ -366,6 +363,7 @@ template <typename real_type, typename label_type>
  * @param[in] rho the rho value resulting from the hyperplane learning
  * @param[in] alpha the weights learned by the SVM
  * @param[in] data the data used to create the model
+ * @note The support vectors are grouped by their label. Inside each group, they are written in the same order as in @p data, i.e., the resulting model file is independent of the number of used threads.
  */
 template <typename real_type, typename label_type>
 inline void write_libsvm_model_data(const std::string &filename, const plssvm::parameter &params, const real_type rho, const std::vector<real_type> &alpha, const data_set<real_type, label_type> &data) {
@@ -394,8 +392,6 @@ inline void write_libsvm_model_data(const std::string &filename, const plssvm::p
     static constexpr std::size_t CHARS_PER_BLOCK = 48;
     // results in 48 B * 128 B = 6 KiB stack buffer per thread
     static constexpr std::size_t BLOCK_SIZE = 128;
-    // use 1 MiB as buffer per thread
-    constexpr std::size_t STRING_BUFFER_SIZE = 1024 * 1024;
 
     // format one output-line
     auto format_libsvm_line = [](std::string &output, const real_type a, const std::vector<real_type> &d) {
@@ -417,82 +413,23 @@ inline void write_libsvm_model_data(const std::string &filename, const plssvm::p
         output.push_back('\n');
     };
 
-    // initialize volatile array
-    auto counts = std::make_unique<volatile int[]>(label_order.size());
-    #pragma omp parallel default(none) shared(counts, alpha, format_libsvm_line, label_order, labels, support_vectors, out) firstprivate(BLOCK_SIZE, CHARS_PER_BLOCK, num_features)
-    {
-        // preallocate string buffer, only ONE allocation
-        std::string out_string;
-        out_string.reserve(STRING_BUFFER_SIZE + (num_features + 1) * CHARS_PER_BLOCK);
-
-        // support vectors with the first class
-        #pragma omp for nowait
-        for (typename std::vector<real_type>::size_type i = 0; i < alpha.size(); ++i) {
-            if (labels[i] == label_order[0]) {
-                format_libsvm_line(out_string, alpha[i], support_vectors[i]);
-
-                // if the buffer is full, write it to the file
-                if (out_string.size() > STRING_BUFFER_SIZE) {
-                    #pragma omp critical
-                    {
-                        out.print("{}", out_string);
-                        #pragma omp flush(out)
-                    }
-                    // clear buffer
-                    out_string.clear();
-                }
-            }
-        }
-
-        #pragma omp critical
-        {
-            if (!out_string.empty()) {
-                out.print("{}", out_string);
-                out_string.clear();
-            }
-            counts[0] = counts[0] + 1;
-            #pragma omp flush(counts, out)
-        }
-
-        for (typename std::vector<label_type>::size_type l = 1; l < label_order.size(); ++l) {
-            // the support vectors with the i-th class
-
-            #pragma omp for nowait
-            for (typename std::vector<real_type>::size_type i = 0; i < alpha.size(); ++i) {
-                if (labels[i] == label_order[l]) {
-                    format_libsvm_line(out_string, alpha[i], support_vectors[i]);
-
-                    // if the buffer is full, write it to the file
-                    if (out_string.size() > STRING_BUFFER_SIZE) {
-                        #pragma omp critical
-                        {
-                            out.print("{}", out_string);
-                            #pragma omp flush(out)
-                        }
-                        // clear buffer
-                        out_string.clear();
-                    }
-                }
-            }
-            // wait for all threads to write support vectors for previous class
-#ifdef _OPENMP
-            while (counts[l - 1] < omp_get_num_threads()) {
-            }
-#else
-    #pragma omp barrier
-#endif
-
-            #pragma omp critical
-            {
-                if (!out_string.empty()) {
-                    out.print("{}", out_string);
-                    out_string.clear();
-                }
-                counts[l] = counts[l] + 1;
-                #pragma omp flush(counts, out)
+    // the support vectors must be grouped by their label in the order given by label_order
+    // -> determine the index of the support vector written in each output line, retaining the original order inside each group
+    std::vector<std::size_t> sv_order;
+    sv_order.reserve(alpha.size());
+    for (const label_type &l : label_order) {
+        for (typename std::vector<label_type>::size_type i = 0; i < labels.size(); ++i) {
+            if (labels[i] == l) {
+                sv_order.push_back(i);
             }
         }
     }
+
+    // format the support vectors in parallel, but write them in order
+    write_ordered(out, sv_order.size(), ordered_writer_rows_per_block((num_features + 1) * CHARS_PER_BLOCK), [&](std::string &output, const std::size_t line) {
+        const std::size_t i = sv_order[line];
+        format_libsvm_line(output, alpha[i], support_vectors[i]);
+    });
 }
 
 }  // namespace plssvm::detail::io
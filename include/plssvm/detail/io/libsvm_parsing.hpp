@@ -13,27 +13,64 @@
 #define PLSSVM_DETAIL_IO_LIBSVM_PARSING_HPP_
 #pragma once
 
-#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
-#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
-#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
-#include "plssvm/detail/utility.hpp"            // plssvm::detail::current_date_time
-#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_file_format_exception
-
-#include "fmt/compile.h"                        // FMT_COMPILE
-#include "fmt/format.h"                         // fmt::format, fmt::format_to
-#include "fmt/os.h"                             // fmt::ostream, fmt::output_file
-
-#include <algorithm>                            // std::max, std::min
-#include <cstddef>                              // std::size_t
-#include <exception>                            // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception
-#include <string>                               // std::string
-#include <string_view>                          // std::string_view
-#include <tuple>                                // std::tuple, std::make_tuple
-#include <utility>                              // std::move
-#include <vector>                               // std::vector
+#include "plssvm/detail/assert.hpp"              // PLSSVM_ASSERT
+#include "plssvm/detail/io/data_set_subset.hpp"  // plssvm::detail::io::{feature_projection, check_feature_projection, samples_data_points, sample_uniform, sample_stratified, select_subset}
+#include "plssvm/detail/io/file_reader.hpp"      // plssvm::detail::io::file_reader
+#include "plssvm/detail/io/ordered_writer.hpp"   // plssvm::detail::io::{write_ordered, ordered_writer_rows_per_block}
+#include "plssvm/detail/string_conversion.hpp"   // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"      // plssvm::detail::{trim_left, starts_with}
+#include "plssvm/detail/utility.hpp"             // plssvm::detail::current_date_time
+#include "plssvm/exceptions/exceptions.hpp"      // plssvm::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"          // plssvm::subset_options
+#include "plssvm/sampling_types.hpp"             // plssvm::sampling_type
+
+#include "fmt/compile.h"                         // FMT_COMPILE
+#include "fmt/format.h"                          // fmt::format, fmt::format_to
+#include "fmt/os.h"                              // fmt::ostream, fmt::output_file
+#ifdef _OPENMP
+    #include <omp.h>                             // omp_get_max_threads
+#endif
+
+#include <algorithm>                             // std::max, std::min, std::max_element
+#include <cstddef>                               // std::size_t
+#include <deque>                                 // std::deque
+#include <exception>                             // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception, std::make_exception_ptr
+#include <ios>                                   // std::streamsize
+#include <istream>                               // std::istream
+#include <iterator>                              // std::back_inserter, std::make_move_iterator
+#include <string>                                // std::string
+#include <string_view>                           // std::string_view
+#include <tuple>                                 // std::tuple, std::make_tuple
+#include <type_traits>                           // std::is_same_v
+#include <utility>                               // std::move
+#include <vector>                                // std::vector
 
 namespace plssvm::detail::io {
 
+/**
+ * @brief Parse the biggest feature index of the single LIBSVM data point given in @p line.
+ * @details Since LIBSVM mandates that the features are ordered strictly increasing, it is sufficient to only look at the last feature index.
+ * @param[in] line the LIBSVM data point to parse for its biggest feature index
+ * @note The features must be provided with one-based indices!
+ * @throws plssvm::invalid_file_format_exception if the feature index couldn't be converted to `unsigned long`
+ * @return the last feature index, `0` if the data point doesn't contain any features (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::size_t parse_libsvm_last_index(const std::string_view line) {
+    // check index of last feature entry
+    const std::string_view::size_type pos_colon = line.find_last_of(':');
+    if (pos_colon == std::string_view::npos) {
+        // no features could be found -> can't contribute to the number of feature calculation
+        return 0;
+    }
+    std::string_view::size_type pos_whitespace = line.find_last_of(' ', pos_colon);
+    if (pos_whitespace == std::string_view::npos) {
+        // no whitespace BEFORE the last colon could be found
+        // this may only happen if NO labels are given
+        pos_whitespace = 0;
+    }
+    return detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos_whitespace, pos_colon - pos_whitespace));
+}
+
 /**
  * @brief Parse the maximum number of features per data point given in @p lines, where the first @p skipped_lines are skipped.
  * @details The maximum number of features equals the biggest found feature index. Since LIBSVM mandates that the features are ordered
@@ -53,22 +90,7 @@ namespace plssvm::detail::io {
         #pragma omp for reduction(max : num_features)
         for (std::size_t i = skipped_lines; i < lines.size(); ++i) {
             try {
-                const std::string_view line = lines[i];
-
-                // check index of last feature entry
-                const std::string_view::size_type pos_colon = line.find_last_of(':');
-                if (pos_colon == std::string_view::npos) {
-                    // no features could be found -> can't contribute to the number of feature calculation
-                    continue;
-                }
-                std::string_view::size_type pos_whitespace = line.find_last_of(' ', pos_colon);
-                if (pos_whitespace == std::string_view::npos) {
-                    // no whitespace BEFORE the last colon could be found
-                    // this may only happen if NO labels are given
-                    pos_whitespace = 0;
-                }
-                const auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos_whitespace, pos_colon - pos_whitespace));
-                num_features = std::max<std::size_t>(num_features, index);
+                num_features = std::max(num_features, parse_libsvm_last_index(lines[i]));
             } catch (const std::exception &) {
                 // catch first exception and store it
                 #pragma omp critical
@@ -89,6 +111,90 @@ namespace plssvm::detail::io {
     return num_features;
 }
 
+/**
+ * @brief Parse the single LIBSVM data point given in @p line into @p data_point and, if present, its @p label.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] line the LIBSVM data point to parse
+ * @param[out] data_point the parsed feature values; must be at least as large as the last feature index in @p line
+ * @param[out] label the parsed label; left unchanged if @p line isn't annotated with a label
+ * @param[in] projection the features to keep; the values of all other features are skipped without converting them and @p data_point must be at least as large as
+ *            the number of kept features (the indices of the skipped features are only checked up to the largest kept feature index)
+ * @note The features must be provided with one-based indices!
+ * @throws plssvm::invalid_file_format_exception if the label couldn't be converted to the provided @p label_type
+ * @throws plssvm::invalid_file_format_exception if a feature index couldn't be converted to `unsigned long`
+ * @throws plssvm::invalid_file_format_exception if a feature value couldn't be converted to the provided @p real_type
+ * @throws plssvm::invalid_file_format_exception if the data point uses zero-based indexing (LIBSVM mandates one-based indices)
+ * @throws plssvm::invalid_file_format_exception if the feature (indices) are not given in a strictly increasing order
+ * @return `true` if @p line is annotated with a label, `false` otherwise (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline bool parse_libsvm_line(const std::string_view line, std::vector<real_type> &data_point, label_type &label, const feature_projection &projection = {}) {
+    unsigned long last_index = 0;
+    bool has_label = false;
+
+    // check if class labels are present (not necessarily the case for test files)
+    std::string_view::size_type pos = line.find_first_of(" \n");
+    const std::string_view::size_type first_colon = line.find_first_of(":\n");
+    if (first_colon >= pos) {
+        // get class or alpha
+        has_label = true;
+        label = detail::convert_to<label_type, invalid_file_format_exception>(line.substr(0, pos));
+    } else {
+        pos = 0;
+    }
+
+    // get data
+    while (true) {
+        std::string_view::size_type next_pos = line.find_first_of(':', pos);
+        // no further data points
+        if (next_pos == std::string_view::npos) {
+            break;
+        }
+
+        // get index
+        auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+
+        // LIBSVM assumes a 1-based indexing -> if the parsed index is 0 this condition is violated
+        if (index == 0) {
+            throw invalid_file_format_exception{ "LIBSVM assumes a 1-based feature indexing scheme, but 0 was given!" };
+        }
+        // the indices must be strictly increasing!
+        if (last_index >= index) {
+            throw invalid_file_format_exception{ fmt::format("The features indices must be strictly increasing, but {} is smaller or equal than {}!", index, last_index) };
+        }
+        last_index = index;
+
+        // since arrays start at 0, reduce 1 based index by one
+        --index;
+        pos = next_pos + 1;
+
+        // get value
+        next_pos = line.find_first_of(' ', pos);
+
+        // skip the values of features that aren't kept without converting them
+        if (!projection.keeps_all_features()) {
+            // the indices are strictly increasing -> all remaining features are skipped as well
+            if (index > projection.max_index()) {
+                break;
+            }
+            const std::size_t projected_index = projection[index];
+            if (projected_index != feature_projection::skip) {
+                data_point[projected_index] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+            }
+            pos = next_pos;
+            continue;
+        }
+        const auto value = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
+        // an index past the last feature index can only occur if the indices aren't strictly increasing -> reported by a later index
+        if (index < data_point.size()) {
+            data_point[index] = value;
+        }
+        pos = next_pos;
+    }
+    return has_label;
+}
+
 /**
  * @brief Parse all data points and potential label using the file @p reader, ignoring all empty lines and lines starting with an `#`.
  *        If no labels are found, returns an empty vector.
@@ -142,57 +248,19 @@ template <typename real_type, typename label_type>
         #pragma omp for reduction(|| : has_label) reduction(|| : has_no_label)
         for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < data.size(); ++i) {
             try {
-                std::string_view line = reader.line(skipped_lines + i);
-                unsigned long last_index = 0;
-
-                // check if class labels are present (not necessarily the case for test files)
-                std::string_view::size_type pos = line.find_first_of(" \n");
-                const std::string_view::size_type first_colon = line.find_first_of(":\n");
-                if (first_colon >= pos) {
-                    // get class or alpha
+                std::vector<real_type> vline(num_features);
+                label_type line_label{};
+                if (parse_libsvm_line(reader.line(skipped_lines + i), vline, line_label)) {
                     has_label = true;
                     if constexpr (std::is_same_v<label_type, bool>) {
                         // the std::vector<bool> template specialization is per C++ standard NOT thread safe
                         #pragma omp critical
-                        label[i] = detail::convert_to<bool, invalid_file_format_exception>(line.substr(0, pos));
+                        label[i] = line_label;
                     } else {
-                        label[i] = detail::convert_to<label_type, invalid_file_format_exception>(line.substr(0, pos));
+                        label[i] = std::move(line_label);
                     }
                 } else {
                     has_no_label = true;
-                    pos = 0;
-                }
-
-                // get data
-                std::vector<real_type> vline(num_features);
-                while (true) {
-                    std::string_view::size_type next_pos = line.find_first_of(':', pos);
-                    // no further data points
-                    if (next_pos == std::string_view::npos) {
-                        break;
-                    }
-
-                    // get index
-                    auto index = detail::convert_to<unsigned long, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
-
-                    // LIBSVM assumes a 1-based indexing -> if the parsed index is 0 this condition is violated
-                    if (index == 0) {
-                        throw invalid_file_format_exception{ "LIBSVM assumes a 1-based feature indexing scheme, but 0 was given!" };
-                    }
-                    // the indices must be strictly increasing!
-                    if (last_index >= index) {
-                        throw invalid_file_format_exception{ fmt::format("The features indices must be strictly increasing, but {} is smaller or equal than {}!", index, last_index) };
-                    }
-                    last_index = index;
-
-                    // since arrays start at 0, reduce 1 based index by one
-                    --index;
-                    pos = next_pos + 1;
-
-                    // get value
-                    next_pos = line.find_first_of(' ', pos);
-                    vline[index] = detail::convert_to<real_type, invalid_file_format_exception>(line.substr(pos, next_pos - pos));
-                    pos = next_pos;
                 }
                 // move filled line to overall matrix
                 data[i] = std::move(vline);
@@ -220,6 +288,482 @@ template <typename real_type, typename label_type>
     return std::make_tuple(num_data_points, num_features, std::move(data), !has_no_label ? std::move(label) : std::vector<label_type>{});
 }
 
+/**
+ * @brief The minimal number of bytes per byte range used by plssvm::detail::io::parse_libsvm_data_chunked if the number of ranges is determined automatically.
+ * @details Avoids spawning threads for only a handful of lines.
+ */
+constexpr std::size_t libsvm_min_chunk_size = 64 * 1024;
+
+/**
+ * @brief The number of bytes read at once from the input stream by plssvm::detail::io::parse_libsvm_data_stream before the read block is parsed (4 MiB).
+ */
+constexpr std::size_t libsvm_stream_block_size = 4 * 1024 * 1024;
+
+/**
+ * @brief Split the @p content into @p num_chunks byte ranges, each one starting at the beginning of a line.
+ * @param[in] content the content to split
+ * @param[in] num_chunks the number of byte ranges; if `0`, one range per OpenMP thread is used (at least libsvm_min_chunk_size bytes each)
+ * @return the offset of the first byte of each byte range followed by the size of @p content, i.e., the byte range `c` is [offset[c], offset[c + 1]) (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::vector<std::size_t> split_at_line_boundaries(const std::string_view content, std::size_t num_chunks) {
+    // determine the number of byte ranges
+    if (num_chunks == 0) {
+#ifdef _OPENMP
+        num_chunks = static_cast<std::size_t>(omp_get_max_threads());
+#else
+        num_chunks = 1;
+#endif
+        num_chunks = std::min(num_chunks, content.size() / libsvm_min_chunk_size + 1);
+    }
+
+    std::vector<std::size_t> chunk_begin(num_chunks + 1, content.size());
+    chunk_begin.front() = 0;
+    for (std::size_t c = 1; c < num_chunks; ++c) {
+        const std::string_view::size_type pos_newline = content.find('\n', std::max(c * (content.size() / num_chunks), chunk_begin[c - 1]));
+        chunk_begin[c] = pos_newline == std::string_view::npos ? content.size() : pos_newline + 1;
+    }
+    return chunk_begin;
+}
+
+/**
+ * @brief The parsing result of one byte range of a LIBSVM file.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ */
+template <typename real_type, typename label_type>
+struct libsvm_range_result {
+    /// The parsed data points; their size is the biggest feature index seen **so far** in this byte range.
+    std::vector<std::vector<real_type>> data{};
+    /// The parsed labels; default initialized if the data points have no labels.
+    std::vector<label_type> label{};
+    /// The biggest feature index in this byte range.
+    std::size_t num_features{ 0 };
+    /// The biggest feature index in this byte range including the skipped features; only determined if not all features are kept.
+    std::size_t num_file_features{ 0 };
+    /// `true` if at least one data point in this byte range has a label.
+    bool has_label{ false };
+    /// `true` if at least one data point in this byte range has no label.
+    bool has_no_label{ false };
+    /// The exception thrown while parsing this byte range, if any.
+    std::exception_ptr exception{};
+};
+
+/**
+ * @brief Call @p func for each data point in the LIBSVM @p content, ignoring all empty lines and lines starting with an `#`.
+ * @details The @p content must start at the beginning of a line and must end directly after a newline or at the end of the file.
+ * @tparam Func the type of the function called for each data point
+ * @param[in] content the byte range to iterate
+ * @param[in] func the function called with each (left trimmed) data point line; returning `false` stops the iteration
+ */
+template <typename Func>
+inline void for_each_libsvm_data_point(const std::string_view content, Func func) {
+    std::string_view::size_type pos = 0;
+    while (pos < content.size()) {
+        std::string_view::size_type pos_line_end = content.find_first_of("\r\n", pos);
+        if (pos_line_end == std::string_view::npos) {
+            pos_line_end = content.size();
+        }
+        const std::string_view line = detail::trim_left(content.substr(pos, pos_line_end - pos));
+        pos = pos_line_end + 1;
+
+        // skip empty lines and comments
+        if (line.empty() || detail::starts_with(line, '#')) {
+            continue;
+        }
+        if (!func(line)) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Count the data points in the LIBSVM @p content and, if @p labels isn't a `nullptr`, append the label of each data point to @p labels.
+ * @details Only the labels and the last feature index of each data point are converted, the features aren't parsed at all. Used to draw a random sample of the data points before parsing them.
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] content the byte range to scan
+ * @param[in,out] labels the labels of the data points; may be `nullptr` if only the number of data points is needed
+ * @param[out] num_features the biggest feature index in @p content; may be `nullptr` if not needed
+ * @throws plssvm::invalid_file_format_exception if @p labels isn't a `nullptr` and a data point has no label
+ * @throws plssvm::invalid_file_format_exception if a label couldn't be converted to the provided @p label_type
+ * @throws plssvm::invalid_file_format_exception if @p num_features isn't a `nullptr` and a feature index couldn't be converted to `unsigned long`
+ * @return the number of data points in @p content (`[[nodiscard]]`)
+ */
+template <typename label_type>
+[[nodiscard]] inline std::size_t scan_libsvm_range(const std::string_view content, std::vector<label_type> *labels, std::size_t *num_features = nullptr) {
+    std::size_t num_data_points = 0;
+    for_each_libsvm_data_point(content, [&](const std::string_view line) {
+        if (labels != nullptr) {
+            // the label is the first token of the line, if it is followed by a feature
+            const std::string_view::size_type pos = line.find_first_of(" \n");
+            if (line.find_first_of(":\n") < pos) {
+                throw invalid_file_format_exception{ "Can't draw a stratified sample since the data points have no labels!" };
+            }
+            labels->push_back(detail::convert_to<label_type, invalid_file_format_exception>(line.substr(0, pos)));
+        }
+        if (num_features != nullptr) {
+            *num_features = std::max(*num_features, parse_libsvm_last_index(line));
+        }
+        ++num_data_points;
+        return true;
+    });
+    return num_data_points;
+}
+
+/**
+ * @brief Parse all data points and potential labels in the LIBSVM @p content, ignoring all empty lines and lines starting with an `#`, and append them to @p result.
+ * @details The @p content must start at the beginning of a line and must end directly after a newline or at the end of the file.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] content the byte range to parse
+ * @param[in,out] result the parsing result of the byte range
+ * @param[in] projection the features to keep; if not all features are kept, each data point has exactly as many features as are kept
+ * @param[in] sample if not a `nullptr`, only the data points with these indices (relative to the beginning of @p content, in strictly increasing order) are parsed
+ * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_libsvm_last_index and plssvm::detail::io::parse_libsvm_line
+ */
+template <typename real_type, typename label_type>
+inline void parse_libsvm_range(const std::string_view content, libsvm_range_result<real_type, label_type> &result, const feature_projection &projection = {}, const std::vector<std::size_t> *sample = nullptr) {
+    std::size_t data_point_idx = 0;
+    std::size_t next_sample = 0;
+    for_each_libsvm_data_point(content, [&](const std::string_view line) {
+        // skip the data points that aren't part of the sample without parsing them
+        if (sample != nullptr) {
+            if (next_sample == sample->size()) {
+                // all sampled data points have been parsed
+                return false;
+            }
+            if ((*sample)[next_sample] != data_point_idx++) {
+                return true;
+            }
+            ++next_sample;
+        }
+
+        if (projection.keeps_all_features()) {
+            // the data point is as large as the biggest feature index of this byte range so far -> most data points don't have to be resized later on
+            result.num_features = std::max(result.num_features, parse_libsvm_last_index(line));
+        } else {
+            // the skipped features are needed to check whether all kept features are present in the file
+            result.num_file_features = std::max(result.num_file_features, parse_libsvm_last_index(line));
+            result.num_features = projection.num_features();
+        }
+        std::vector<real_type> data_point(result.num_features);
+        label_type line_label{};
+        if (parse_libsvm_line(line, data_point, line_label, projection)) {
+            result.has_label = true;
+        } else {
+            result.has_no_label = true;
+        }
+        result.data.push_back(std::move(data_point));
+        result.label.push_back(std::move(line_label));
+        return true;
+    });
+}
+
+/**
+ * @brief Return the biggest feature index, including the skipped features, over all byte ranges in @p ranges.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] ranges the parsing results of all byte ranges
+ * @return the number of features in the file if not all features are kept (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::size_t max_num_file_features(const std::vector<libsvm_range_result<real_type, label_type>> &ranges) {
+    std::size_t num_file_features = 0;
+    for (const libsvm_range_result<real_type, label_type> &range : ranges) {
+        num_file_features = std::max(num_file_features, range.num_file_features);
+    }
+    return num_file_features;
+}
+
+/**
+ * @brief Combine the parsing results of all byte ranges in @p ranges, given in file order, to the final data points and labels.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in,out] ranges the parsing results of all byte ranges; their data points and labels are moved out
+ * @throws plssvm::invalid_file_format_exception the first exception, in file order, thrown while parsing the byte ranges
+ * @throws plssvm::invalid_file_format_exception if no features could be found (may indicate an empty file)
+ * @throws plssvm::invalid_file_format_exception if only **some** data points are annotated with labels
+ * @return a std::tuple containing: [num_data_points, num_features, data_points, labels] (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> merge_libsvm_ranges(std::vector<libsvm_range_result<real_type, label_type>> &ranges) {
+    std::size_t num_features = 0;
+    bool has_label = false;
+    bool has_no_label = false;
+    for (const libsvm_range_result<real_type, label_type> &range : ranges) {
+        // rethrow if an exception occurred while parsing the byte ranges
+        if (range.exception) {
+            std::rethrow_exception(range.exception);
+        }
+        num_features = std::max(num_features, range.num_features);
+        has_label = has_label || range.has_label;
+        has_no_label = has_no_label || range.has_no_label;
+    }
+    // no features were parsed -> invalid file
+    if (num_features == 0) {
+        throw invalid_file_format_exception{ fmt::format("Can't parse file: no data points are given!") };
+    }
+    if (has_label && has_no_label) {
+        // some data points where given with labels, BUT some data pints where given without labels
+        throw invalid_file_format_exception{ "Inconsistent label specification found (some data points are labeled, others are not)!" };
+    }
+
+    // calculate the position of the first data point of each byte range in the final data
+    const std::size_t num_ranges = ranges.size();
+    std::vector<std::size_t> range_offset(num_ranges + 1, 0);
+    for (std::size_t r = 0; r < num_ranges; ++r) {
+        range_offset[r + 1] = range_offset[r] + ranges[r].data.size();
+    }
+    const std::size_t num_data_points = range_offset.back();
+
+    // move the thread-local data points to the overall matrix
+    std::vector<std::vector<real_type>> data(num_data_points);
+    #pragma omp parallel for schedule(dynamic) default(none) shared(data, ranges, range_offset) firstprivate(num_ranges, num_features)
+    for (std::size_t r = 0; r < num_ranges; ++r) {
+        for (std::size_t i = 0; i < ranges[r].data.size(); ++i) {
+            // data points parsed before the biggest feature index was encountered are too short
+            ranges[r].data[i].resize(num_features);
+            data[range_offset[r] + i] = std::move(ranges[r].data[i]);
+        }
+        ranges[r].data = std::vector<std::vector<real_type>>{};
+    }
+
+    // the std::vector<bool> template specialization is per C++ standard NOT thread safe -> move the labels sequentially
+    std::vector<label_type> label{};
+    if (has_label) {
+        label.reserve(num_data_points);
+        for (libsvm_range_result<real_type, label_type> &range : ranges) {
+            std::move(range.label.begin(), range.label.end(), std::back_inserter(label));
+        }
+    }
+
+    return std::make_tuple(num_data_points, num_features, std::move(data), std::move(label));
+}
+
+/**
+ * @brief Parse all data points and potential label directly from the content of the file @p reader in a single pass, ignoring all empty lines and lines starting with an `#`.
+ *        If no labels are found, returns an empty vector.
+ * @details In contrast to plssvm::detail::io::parse_libsvm_data, neither plssvm::detail::io::file_reader::read_lines nor a separate pass to determine
+ *          the number of features is needed. Instead, the file content is split into @p num_chunks byte ranges, each starting directly after a newline.
+ *          Each byte range is parsed exactly once by one thread into thread-local data points, whose size grows with the biggest feature index seen so far
+ *          in this range. The number of features is reduced at the end and only data points that are too short are resized.
+ *          The order of the data points is the same as in the file.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] reader the file_reader used to read the LIBSVM data; read_lines() must **not** have been called
+ * @param[in] num_chunks the number of byte ranges the file content is split into; if `0`, one range per OpenMP thread is used (at least libsvm_min_chunk_size bytes each)
+ * @param[in] subset the features to keep and the number of data points to sample; the values of all other features are skipped without converting them.
+ *            If data points should be sampled, the data points are counted (and, for a stratified sample, only their labels are parsed) in a first pass over the file content,
+ *            afterward only the sampled data points are parsed
+ * @note The features must be provided with one-based indices!
+ * @throws plssvm::invalid_file_format_exception if no features could be found (may indicate an empty file)
+ * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_libsvm_last_index and plssvm::detail::io::parse_libsvm_line;
+ *         if multiple data points are invalid, the exception of the first one in the file is rethrown
+ * @throws plssvm::invalid_file_format_exception if only **some** data points are annotated with labels
+ * @throws plssvm::invalid_file_format_exception if a stratified sample should be drawn, but the data points have no labels
+ * @throws plssvm::invalid_file_format_exception if a kept feature index is larger or equal than the number of features in the file (the biggest feature index)
+ * @return a std::tuple containing: [num_data_points, num_features, data_points, labels] (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> parse_libsvm_data_chunked(const file_reader &reader, std::size_t num_chunks = 0, const subset_options &subset = {}) {
+    PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
+
+    const std::string_view content{ reader.buffer(), static_cast<std::string_view::size_type>(reader.num_bytes()) };
+
+    // split the content into byte ranges, each one starting at the beginning of a line
+    const std::vector<std::size_t> chunk_begin = split_at_line_boundaries(content, num_chunks);
+    num_chunks = chunk_begin.size() - 1;
+
+    const feature_projection projection{ subset.features };
+
+    // draw the sampled data points of each byte range (relative to the first data point in the respective byte range)
+    std::vector<std::vector<std::size_t>> chunk_samples{};
+    if (samples_data_points(subset)) {
+        const bool stratified = subset.sampling == sampling_type::stratified;
+        const bool keeps_all_features = projection.keeps_all_features();
+        std::vector<std::size_t> chunk_num_data_points(num_chunks);
+        std::vector<std::size_t> chunk_num_features(num_chunks, 0);
+        std::vector<std::vector<label_type>> chunk_labels(stratified ? num_chunks : 0);
+        std::vector<std::exception_ptr> chunk_exceptions(num_chunks);
+
+        #pragma omp parallel for schedule(dynamic) default(none) shared(chunk_begin, chunk_num_data_points, chunk_num_features, chunk_labels, chunk_exceptions) firstprivate(content, num_chunks, stratified, keeps_all_features)
+        for (std::size_t c = 0; c < num_chunks; ++c) {
+            try {
+                // the skipped features of the data points that aren't sampled are needed to check whether all kept features are present in the file
+                chunk_num_data_points[c] = scan_libsvm_range(content.substr(chunk_begin[c], chunk_begin[c + 1] - chunk_begin[c]), stratified ? &chunk_labels[c] : nullptr, keeps_all_features ? nullptr : &chunk_num_features[c]);
+            } catch (const std::exception &) {
+                chunk_exceptions[c] = std::current_exception();
+            }
+        }
+        // rethrow the first exception in file order
+        for (const std::exception_ptr &chunk_exception : chunk_exceptions) {
+            if (chunk_exception) {
+                std::rethrow_exception(chunk_exception);
+            }
+        }
+        if (!keeps_all_features) {
+            check_feature_projection(projection, *std::max_element(chunk_num_features.cbegin(), chunk_num_features.cend()));
+        }
+
+        // draw the sample over all data points
+        std::vector<std::size_t> sample{};
+        if (stratified) {
+            std::vector<label_type> labels{};
+            for (std::vector<label_type> &range_labels : chunk_labels) {
+                std::move(range_labels.begin(), range_labels.end(), std::back_inserter(labels));
+                range_labels = std::vector<label_type>{};
+            }
+            sample = sample_stratified(labels, subset.num_samples);
+        } else {
+            std::size_t num_data_points = 0;
+            for (const std::size_t chunk_size : chunk_num_data_points) {
+                num_data_points += chunk_size;
+            }
+            sample = sample_uniform(num_data_points, subset.num_samples);
+        }
+
+        // distribute the sample to the byte ranges
+        chunk_samples.resize(num_chunks);
+        std::size_t first_data_point = 0;
+        std::size_t s = 0;
+        for (std::size_t c = 0; c < num_chunks; ++c) {
+            for (; s < sample.size() && sample[s] < first_data_point + chunk_num_data_points[c]; ++s) {
+                chunk_samples[c].push_back(sample[s] - first_data_point);
+            }
+            first_data_point += chunk_num_data_points[c];
+        }
+    }
+
+    // the thread-local parsing results of each byte range
+    std::vector<libsvm_range_result<real_type, label_type>> chunk_results(num_chunks);
+
+    #pragma omp parallel for schedule(dynamic) default(none) shared(chunk_begin, chunk_results, chunk_samples, projection) firstprivate(content, num_chunks)
+    for (std::size_t c = 0; c < num_chunks; ++c) {
+        try {
+            parse_libsvm_range(content.substr(chunk_begin[c], chunk_begin[c + 1] - chunk_begin[c]), chunk_results[c], projection, chunk_samples.empty() ? nullptr : &chunk_samples[c]);
+        } catch (const std::exception &) {
+            // store the exception of each byte range to be able to rethrow the first one in file order
+            chunk_results[c].exception = std::current_exception();
+        }
+    }
+
+    if (!chunk_samples.empty()) {
+        // the kept features have already been checked while drawing the sample
+        return merge_libsvm_ranges(chunk_results);
+    }
+    const std::size_t num_file_features = max_num_file_features(chunk_results);
+    auto result = merge_libsvm_ranges(chunk_results);
+    check_feature_projection(projection, num_file_features);
+    return result;
+}
+
+/**
+ * @brief Parse all data points and potential label from the input stream @p in (e.g., `std::cin`), ignoring all empty lines and lines starting with an `#`.
+ *        If no labels are found, returns an empty vector.
+ * @details In contrast to plssvm::detail::io::parse_libsvm_data_chunked, the parsing overlaps the reading: one thread reads blocks of libsvm_stream_block_size bytes
+ *          from @p in, each block ending directly after a newline (the remaining partial line is prepended to the next block). For each read block,
+ *          an OpenMP task is created parsing this block, while the reading thread already continues with the next block.
+ *          A parsed block's content is released as soon as it has been parsed. The order of the data points is the same as in the stream.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in,out] in the input stream to read the LIBSVM data from
+ * @param[in] block_size the number of bytes read at once
+ * @param[in] subset the features to keep and the number of data points to sample; the values of all other features are skipped without converting them.
+ *            Since the number of data points in the stream isn't known in advance, all data points are parsed and the sample is drawn afterward
+ * @note The features must be provided with one-based indices!
+ * @throws plssvm::invalid_file_format_exception if an error occurs while reading from @p in
+ * @throws plssvm::invalid_file_format_exception if no features could be found (may indicate an empty stream)
+ * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_libsvm_last_index and plssvm::detail::io::parse_libsvm_line;
+ *         if multiple data points are invalid, the exception of the first one in the stream is rethrown
+ * @throws plssvm::invalid_file_format_exception if only **some** data points are annotated with labels
+ * @throws plssvm::invalid_file_format_exception if a stratified sample should be drawn, but the data points have no labels
+ * @throws plssvm::invalid_file_format_exception if a kept feature index is larger or equal than the number of features in the stream (the biggest feature index)
+ * @return a std::tuple containing: [num_data_points, num_features, data_points, labels] (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> parse_libsvm_data_stream(std::istream &in, const std::size_t block_size = libsvm_stream_block_size, const subset_options &subset = {}) {
+    PLSSVM_ASSERT(block_size > 0, "The block size must be greater than 0!");
+
+    // std::deque never invalidates references to its elements when appending -> the tasks can safely reference their block while new blocks are read
+    std::deque<std::string> blocks;
+    std::deque<libsvm_range_result<real_type, label_type>> block_results;
+    std::exception_ptr read_exception;
+    const feature_projection projection{ subset.features };
+
+    #pragma omp parallel default(none) shared(in, blocks, block_results, read_exception, projection) firstprivate(block_size)
+    {
+        #pragma omp single
+        {
+            // the partial last line of the previous block
+            std::string remainder;
+            while (true) {
+                std::string block = std::move(remainder);
+                remainder = std::string{};
+                const std::size_t old_size = block.size();
+                block.resize(old_size + block_size);
+                in.read(block.data() + old_size, static_cast<std::streamsize>(block_size));
+                block.resize(old_size + static_cast<std::size_t>(in.gcount()));
+                if (in.bad()) {
+                    read_exception = std::make_exception_ptr(invalid_file_format_exception{ "Error while reading the LIBSVM data from the input stream!" });
+                    break;
+                }
+                const bool end_of_stream = in.eof();
+
+                if (!end_of_stream) {
+                    // only complete lines are parsed
+                    const std::string::size_type pos_newline = block.find_last_of('\n');
+                    if (pos_newline == std::string::npos) {
+                        // the block contains only a part of a single line -> read more
+                        remainder = std::move(block);
+                        continue;
+                    }
+                    remainder = block.substr(pos_newline + 1);
+                    block.resize(pos_newline + 1);
+                }
+
+                if (!block.empty()) {
+                    // parse the block asynchronously
+                    std::string *block_ptr = &blocks.emplace_back(std::move(block));
+                    libsvm_range_result<real_type, label_type> *result_ptr = &block_results.emplace_back();
+                    #pragma omp task default(none) shared(projection) firstprivate(block_ptr, result_ptr)
+                    {
+                        try {
+                            parse_libsvm_range(std::string_view{ *block_ptr }, *result_ptr, projection);
+                        } catch (const std::exception &) {
+                            // store the exception of each block to be able to rethrow the first one in stream order
+                            result_ptr->exception = std::current_exception();
+                        }
+                        // release the block's content as soon as possible
+                        *block_ptr = std::string{};
+                    }
+                }
+
+                if (end_of_stream) {
+                    break;
+                }
+            }
+        }
+        // implicit barrier: all tasks have finished
+    }
+
+    // rethrow if an exception occurred while reading
+    if (read_exception) {
+        std::rethrow_exception(read_exception);
+    }
+
+    std::vector<libsvm_range_result<real_type, label_type>> results(std::make_move_iterator(block_results.begin()), std::make_move_iterator(block_results.end()));
+    const std::size_t num_file_features = max_num_file_features(results);
+    auto [num_data_points, num_features, data, label] = merge_libsvm_ranges(results);
+    check_feature_projection(projection, num_file_features);
+    if (!samples_data_points(subset)) {
+        return std::make_tuple(num_data_points, num_features, std::move(data), std::move(label));
+    }
+
+    // draw the sample from all parsed data points; the features have already been projected
+    select_subset(data, label, subset_options{ {}, subset.num_samples, subset.sampling });
+    num_data_points = data.size();
+    return std::make_tuple(num_data_points, num_features, std::move(data), std::move(label));
+}
+
 /**
  * @brief Write the provided @p data and @p labels to the LIBSVM file @p filename.
  * @details An example file can look like
@@ -237,7 +781,7 @@ template <typename real_type, typename label_type>
  * @param[in] filename the filename to write the data to
  * @param[in] data the data points to write to the file
  * @param[in] label the labels to write to the file
- * @note The resulting order of the data points in the LIBSVM file is unspecified!
+ * @note The data points are written in the same order as in @p data, i.e., the resulting LIBSVM file is independent of the number of used threads.
  * @note The features are written using one-based indices!
  */
 template <typename real_type, typename label_type, bool has_label>
@@ -282,21 +826,14 @@ inline void write_libsvm_data_impl(const std::string &filename, const std::vecto
         output.push_back('\n');
     };
 
-    #pragma omp parallel default(none) shared(out, data, label, format_libsvm_line)
-    {
-        // all support vectors
-        std::string out_string;
-        #pragma omp for schedule(dynamic) nowait
-        for (typename std::vector<real_type>::size_type i = 0; i < data.size(); ++i) {
-            if constexpr (has_label) {
-                out_string.append(fmt::format(FMT_COMPILE("{} "), label[i]));
-            }
-            format_libsvm_line(out_string, data[i]);
+    // format the data points in parallel, but write them in order
+    // one formatted entry has at most 40 chars: index (20 chars) + ':' + value in scientific notation (18 chars) + ' '
+    write_ordered(out, num_data_points, ordered_writer_rows_per_block(num_features * 40), [&](std::string &output, const std::size_t i) {
+        if constexpr (has_label) {
+            output.append(fmt::format(FMT_COMPILE("{} "), label[i]));
         }
-
-        #pragma omp critical
-        out.print("{}", out_string);
-    }
+        format_libsvm_line(output, data[i]);
+    });
 }
 
 /**
@@ -315,7 +852,7 @@ inline void write_libsvm_data_impl(const std::string &filename, const std::vecto
  * @param[in] filename the filename to write the data to
  * @param[in] data the data points to write to the file
  * @param[in] label the labels to write to the file
- * @note The resulting order of the data points in the LIBSVM file is unspecified!
+ * @note The data points are written in the same order as in @p data, i.e., the resulting LIBSVM file is independent of the number of used threads.
  * @note The features are written using one-based indices!
  */
 template <typename real_type, typename label_type>
@@ -337,7 +874,7 @@ inline void write_libsvm_data(const std::string &filename, const std::vector<std
  * @tparam real_type the floating point type
  * @param[in] filename the filename to write the data to
  * @param[in] data the data points to write to the file
- * @note The resulting order of the data points in the LIBSVM file is unspecified!
+ * @note The data points are written in the same order as in @p data, i.e., the resulting LIBSVM file is independent of the number of used threads.
  * @note The features are written using one-based indices!
  */
 template <typename real_type>
@@ -0,0 +1,401 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements parsing functions for the NumPy `.npy` file format.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_NPY_PARSING_HPP_
+#define PLSSVM_DETAIL_IO_NPY_PARSING_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/io/binary_parsing.hpp"  // plssvm::detail::io::{read_binary_value, binary_file_writer}
+#include "plssvm/detail/io/csv_parsing.hpp"     // plssvm::detail::io::convert_numeric_label
+#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
+#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"     // plssvm::detail::{trim, trim_left, split}
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_file_format_exception
+
+#include "fmt/core.h"                           // fmt::format
+
+#include <algorithm>                            // std::min
+#include <cstddef>                              // std::size_t
+#include <cstdint>                              // std::uint8_t, std::uint16_t, std::uint32_t, std::int32_t, std::int64_t
+#include <cstring>                              // std::memcpy
+#include <limits>                               // std::numeric_limits::max
+#include <optional>                             // std::optional
+#include <string>                               // std::string
+#include <string_view>                          // std::string_view
+#include <tuple>                                // std::tuple, std::make_tuple
+#include <type_traits>                          // std::is_same_v, std::is_arithmetic_v
+#include <utility>                              // std::move
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::io {
+
+/// The magic bytes at the beginning of each NumPy file.
+constexpr std::string_view npy_magic{ "\x93NUMPY", 6 };
+/// The alignment (in bytes) of the array data in a NumPy file.
+constexpr std::size_t npy_alignment{ 64 };
+
+/**
+ * @brief The information stored in the header of a NumPy file.
+ */
+struct npy_header {
+    /// The kind of the stored values: `f` for floating point and `i` for signed integer values.
+    char kind{ 'f' };
+    /// The size (in bytes) of one stored value.
+    std::size_t item_size{ 0 };
+    /// `true` if the array is stored in column-major (Fortran) order, `false` if it is stored in row-major (C) order.
+    bool fortran_order{ false };
+    /// The number of rows of the array.
+    std::size_t num_rows{ 0 };
+    /// The number of columns of the array.
+    std::size_t num_cols{ 0 };
+    /// The offset (in bytes) of the array data in the file.
+    std::size_t data_offset{ 0 };
+};
+
+/**
+ * @brief Return the (unparsed) value of the @p key in the Python dictionary literal @p dict (e.g., `'<f8'`, `False`, or `(5, 4)`).
+ * @param[in] dict the NumPy header dictionary
+ * @param[in] key the key to search for (without quotes)
+ * @throws plssvm::invalid_file_format_exception if @p key isn't present in @p dict
+ * @return the value (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::string_view parse_npy_header_value(const std::string_view dict, const std::string_view key) {
+    std::string_view::size_type pos = dict.find(fmt::format("'{}'", key));
+    if (pos == std::string_view::npos) {
+        pos = dict.find(fmt::format("\"{}\"", key));
+    }
+    const std::string_view::size_type pos_colon = pos == std::string_view::npos ? pos : dict.find(':', pos + key.size() + 2);
+    if (pos_colon == std::string_view::npos) {
+        throw invalid_file_format_exception{ fmt::format("The NumPy header \"{}\" doesn't contain the key '{}'!", dict, key) };
+    }
+    const std::string_view value = detail::trim_left(dict.substr(pos_colon + 1));
+    // the value ends at the matching closing character or the next comma
+    std::string_view::size_type pos_end{};
+    if (!value.empty() && (value.front() == '\'' || value.front() == '"')) {
+        pos_end = value.find(value.front(), 1);
+        pos_end = pos_end == std::string_view::npos ? pos_end : pos_end + 1;
+    } else if (!value.empty() && value.front() == '(') {
+        pos_end = value.find(')');
+        pos_end = pos_end == std::string_view::npos ? pos_end : pos_end + 1;
+    } else {
+        pos_end = value.find_first_of(",}");
+    }
+    return detail::trim(value.substr(0, pos_end));
+}
+
+/**
+ * @brief Parse the header of the NumPy file read by @p reader.
+ * @details The file starts with the magic bytes `\x93NUMPY`, the major and minor version, and the length of the header (2 bytes in version 1, 4 bytes in versions 2 and 3).
+ *          The header is a Python dictionary literal, e.g., `{'descr': '<f8', 'fortran_order': False, 'shape': (5, 4), }`.
+ * @param[in] reader the file_reader used to read the NumPy file
+ * @throws plssvm::invalid_file_format_exception if the file doesn't start with the magic bytes or uses an unsupported version
+ * @throws plssvm::invalid_file_format_exception if the data type isn't one of `<f4`, `<f8`, `<i4`, or `<i8`
+ * @throws plssvm::invalid_file_format_exception if the array isn't two-dimensional
+ * @throws plssvm::invalid_file_format_exception if the file is too small to contain the whole array
+ * @return the parsed header (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline npy_header parse_npy_header(const file_reader &reader) {
+    const auto num_bytes = static_cast<std::size_t>(reader.num_bytes());
+    if (num_bytes < npy_magic.size() + 4 || std::string_view{ reader.buffer(), npy_magic.size() } != npy_magic) {
+        throw invalid_file_format_exception{ "The NumPy file must start with \"\\x93NUMPY\"!" };
+    }
+
+    // the length of the header depends on the version
+    const auto major_version = read_binary_value<std::uint8_t>(reader, 6);
+    std::size_t header_begin{};
+    std::size_t header_length{};
+    if (major_version == 1) {
+        header_begin = 10;
+        header_length = read_binary_value<std::uint16_t>(reader, 8);
+    } else if (major_version == 2 || major_version == 3) {
+        header_begin = 12;
+        header_length = read_binary_value<std::uint32_t>(reader, 8);
+    } else {
+        throw invalid_file_format_exception{ fmt::format("Unsupported NumPy file format version {} (supported: 1, 2, and 3)!", major_version) };
+    }
+    if (header_begin + header_length > num_bytes) {
+        throw invalid_file_format_exception{ fmt::format("Unexpected end of the NumPy file: need {} bytes, but only {} are present!", header_begin + header_length, num_bytes) };
+    }
+    const std::string_view dict{ reader.buffer() + header_begin, header_length };
+
+    npy_header header{};
+    header.data_offset = header_begin + header_length;
+
+    // parse the data type, e.g., '<f8'
+    const std::string_view descr = parse_npy_header_value(dict, "descr");
+    if (descr == "'<f4'" || descr == "'<f8'" || descr == "'<i4'" || descr == "'<i8'") {
+        header.kind = descr[2];
+        header.item_size = descr[3] == '4' ? 4 : 8;
+    } else {
+        throw invalid_file_format_exception{ fmt::format("Unsupported NumPy data type {} (supported: '<f4', '<f8', '<i4', and '<i8')!", descr) };
+    }
+
+    // parse the memory layout
+    const std::string_view fortran_order = parse_npy_header_value(dict, "fortran_order");
+    if (fortran_order != "False" && fortran_order != "True") {
+        throw invalid_file_format_exception{ fmt::format("The NumPy fortran_order must be either False or True, but is {}!", fortran_order) };
+    }
+    header.fortran_order = fortran_order == "True";
+
+    // parse the shape, e.g., (5, 4)
+    const std::string_view shape = parse_npy_header_value(dict, "shape");
+    std::vector<std::size_t> dims{};
+    if (shape.size() >= 2 && shape.front() == '(' && shape.back() == ')') {
+        for (const std::string_view dim : detail::split(shape.substr(1, shape.size() - 2), ',')) {
+            if (!detail::trim(dim).empty()) {
+                dims.push_back(detail::convert_to<std::size_t, invalid_file_format_exception>(detail::trim(dim)));
+            }
+        }
+    }
+    if (dims.size() != 2) {
+        throw invalid_file_format_exception{ fmt::format("The NumPy file must contain a two-dimensional array, but the shape is {}!", shape) };
+    }
+    header.num_rows = dims[0];
+    header.num_cols = dims[1];
+
+    // check the size only once to be able to copy the rows in parallel
+    // since the shape is read from the (potentially corrupted) file, the check must be overflow-safe
+    const std::size_t num_array_bytes = num_bytes - header.data_offset;
+    if (header.num_cols > 0 && header.num_rows > num_array_bytes / header.item_size / header.num_cols) {
+        if (header.num_rows > (std::numeric_limits<std::size_t>::max() - header.data_offset) / header.item_size / header.num_cols) {
+            // the number of needed bytes isn't even representable
+            throw invalid_file_format_exception{ fmt::format("The NumPy array with the shape {} is too large!", shape) };
+        }
+        throw invalid_file_format_exception{ fmt::format("Unexpected end of the NumPy file: need {} bytes, but only {} are present!", header.data_offset + header.num_rows * header.num_cols * header.item_size, num_bytes) };
+    }
+    return header;
+}
+
+/**
+ * @brief Copy the @p count values of type @p stored_type starting at @p src to @p dest converting them to @p real_type.
+ * @tparam stored_type the type of the values stored in the file
+ * @tparam real_type the floating point type of the destination
+ * @param[in] src the first value in the file
+ * @param[out] dest the destination of the values
+ * @param[in] count the number of values to copy
+ */
+template <typename stored_type, typename real_type>
+inline void copy_npy_values(const char *src, real_type *dest, const std::size_t count) {
+    if constexpr (std::is_same_v<stored_type, real_type>) {
+        // same type -> plain copy
+        std::memcpy(dest, src, count * sizeof(real_type));
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            stored_type value{};
+            std::memcpy(&value, src + i * sizeof(stored_type), sizeof(stored_type));
+            dest[i] = static_cast<real_type>(value);
+        }
+    }
+}
+
+/**
+ * @brief Copy the @p count values described by @p header starting at @p src to @p dest converting them to @p real_type.
+ * @tparam real_type the floating point type of the destination
+ * @param[in] header the header describing the stored data type
+ * @param[in] src the first value in the file
+ * @param[out] dest the destination of the values
+ * @param[in] count the number of values to copy
+ */
+template <typename real_type>
+inline void read_npy_values(const npy_header &header, const char *src, real_type *dest, const std::size_t count) {
+    if (header.kind == 'f' && header.item_size == 4) {
+        copy_npy_values<float>(src, dest, count);
+    } else if (header.kind == 'f') {
+        copy_npy_values<double>(src, dest, count);
+    } else if (header.item_size == 4) {
+        copy_npy_values<std::int32_t>(src, dest, count);
+    } else {
+        copy_npy_values<std::int64_t>(src, dest, count);
+    }
+}
+
+/**
+ * @brief Parse the NumPy `.npy` file read by @p reader containing a two-dimensional array.
+ * @details Each row of the array is one data point. If @p label_column is given, the respective column contains the labels and all other columns the features.
+ *          Since no text must be parsed, the rows are directly copied from the (memory mapped) file. Arrays stored in row-major order whose data type matches
+ *          @p real_type are copied using plain `memcpy`.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] reader the file_reader used to read the NumPy file (must **not** be split into lines)
+ * @param[in] label_column the column containing the labels; negative values count from the last column. If empty, the file contains no labels.
+ * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_npy_header
+ * @throws plssvm::invalid_file_format_exception if the array doesn't contain any data points or features
+ * @throws plssvm::invalid_file_format_exception if the label column is out of range
+ * @throws plssvm::invalid_file_format_exception if a label couldn't be converted to the provided @p label_type
+ * @return a std::tuple containing: [num_data_points, num_features, data_points, labels] (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] inline std::tuple<std::size_t, std::size_t, std::vector<std::vector<real_type>>, std::vector<label_type>> parse_npy_data(const file_reader &reader, const std::optional<long long> label_column = -1) {
+    PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
+
+    const npy_header header = parse_npy_header(reader);
+    const std::size_t num_data_points = header.num_rows;
+    const std::size_t num_cols = header.num_cols;
+    if (num_data_points == 0) {
+        throw invalid_file_format_exception{ "Can't parse file: no data points are given!" };
+    }
+
+    // determine the label column
+    const bool has_label = label_column.has_value();
+    std::size_t label_idx = num_cols;
+    if (has_label) {
+        const long long column = label_column.value() < 0 ? static_cast<long long>(num_cols) + label_column.value() : label_column.value();
+        if (column < 0 || column >= static_cast<long long>(num_cols)) {
+            throw invalid_file_format_exception{ fmt::format("The label column {} is out of range for a NumPy array with {} columns!", label_column.value(), num_cols) };
+        }
+        label_idx = static_cast<std::size_t>(column);
+    }
+    const std::size_t num_features = has_label ? num_cols - 1 : num_cols;
+    if (num_features == 0) {
+        throw invalid_file_format_exception{ "Can't parse file: no features are given!" };
+    }
+
+    // copy the data points
+    std::vector<std::vector<real_type>> data(num_data_points, std::vector<real_type>(num_features));
+    std::vector<double> numeric_label(has_label ? num_data_points : 0);
+    const char *array = reader.buffer() + header.data_offset;
+
+    #pragma omp parallel for default(none) shared(header, data, numeric_label, array) firstprivate(num_data_points, num_cols, num_features, has_label, label_idx)
+    for (std::size_t i = 0; i < num_data_points; ++i) {
+        if (header.fortran_order) {
+            // column-major order -> the values of one data point are strided
+            for (std::size_t j = 0; j < num_cols; ++j) {
+                const char *src = array + (j * num_data_points + i) * header.item_size;
+                if (j == label_idx) {
+                    read_npy_values(header, src, &numeric_label[i], 1);
+                } else {
+                    read_npy_values(header, src, &data[i][j < label_idx ? j : j - 1], 1);
+                }
+            }
+        } else {
+            // row-major order -> the values in front of and behind the label column are contiguous
+            const char *row = array + i * num_cols * header.item_size;
+            read_npy_values(header, row, data[i].data(), std::min(label_idx, num_features));
+            if (has_label) {
+                read_npy_values(header, row + label_idx * header.item_size, &numeric_label[i], 1);
+                read_npy_values(header, row + (label_idx + 1) * header.item_size, data[i].data() + label_idx, num_features - label_idx);
+            }
+        }
+    }
+
+    // convert the labels sequentially since the std::vector<bool> template specialization is per C++ standard NOT thread safe
+    std::vector<label_type> label{};
+    if (has_label) {
+        label.reserve(num_data_points);
+        for (const double value : numeric_label) {
+            label.push_back(convert_numeric_label<label_type>(value));
+        }
+    }
+
+    return std::make_tuple(num_data_points, num_features, std::move(data), std::move(label));
+}
+
+/**
+ * @brief Write the provided @p data and @p label to the NumPy file @p filename as a two-dimensional array in row-major order.
+ * @details The array has the data type of @p real_type (`<f4` or `<f8`). If @p has_label is `true`, the labels are stored as the last column.
+ *          The header is padded such that the array data starts at a multiple of plssvm::detail::io::npy_alignment bytes.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @tparam has_label if `true` the provided labels are also written to the file, if `false` **no** labels are outputted
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @param[in] label the labels to write to the file (ignored if @p has_label is `false`)
+ * @throws plssvm::invalid_file_format_exception if a label can't be converted to @p real_type (the NumPy file format only supports numeric labels)
+ * @throws plssvm::file_exception if the file couldn't be created or written
+ * @note Assumes a little-endian machine.
+ */
+template <typename real_type, typename label_type, bool has_label>
+inline void write_npy_data_impl(const std::string &filename, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) {
+    if constexpr (has_label) {
+        PLSSVM_ASSERT(data.empty() || !label.empty(), "has_label is 'true' but no labels were provided!");
+        PLSSVM_ASSERT(data.size() == label.size(), "Number of data points ({}) and number of labels ({}) mismatch!", data.size(), label.size());
+    } else {
+        PLSSVM_ASSERT(label.empty(), "has_label is 'false' but labels were provided!");
+    }
+
+    const std::size_t num_data_points = data.size();
+    const std::size_t num_features = data.empty() ? 0 : data.front().size();
+    const std::size_t num_cols = has_label ? num_features + 1 : num_features;
+
+    // convert the labels to real_type before creating the file
+    std::vector<real_type> numeric_label{};
+    if constexpr (has_label) {
+        numeric_label.reserve(num_data_points);
+        for (const label_type &l : label) {
+            if constexpr (std::is_arithmetic_v<label_type>) {
+                numeric_label.push_back(static_cast<real_type>(l));
+            } else {
+                numeric_label.push_back(detail::convert_to<real_type, invalid_file_format_exception>(l));
+            }
+        }
+    }
+
+    // create the header; it is terminated by a newline and padded with spaces such that the array data is aligned
+    std::string dict = fmt::format("{{'descr': '<f{}', 'fortran_order': False, 'shape': ({}, {}), }}", sizeof(real_type), num_data_points, num_cols);
+    const std::size_t header_begin = dict.size() + npy_alignment <= std::numeric_limits<std::uint16_t>::max() ? 10 : 12;
+    dict.append((npy_alignment - (header_begin + dict.size() + 1) % npy_alignment) % npy_alignment, ' ');
+    dict.push_back('\n');
+
+    // create output file
+    binary_file_writer out{ filename };
+    out.write(npy_magic.data(), npy_magic.size());
+    if (header_begin == 10) {
+        out.write_value(std::uint8_t{ 1 });
+        out.write_value(std::uint8_t{ 0 });
+        out.write_value(static_cast<std::uint16_t>(dict.size()));
+    } else {
+        out.write_value(std::uint8_t{ 2 });
+        out.write_value(std::uint8_t{ 0 });
+        out.write_value(static_cast<std::uint32_t>(dict.size()));
+    }
+    out.write(dict.data(), dict.size());
+
+    // write the data points row by row
+    for (std::size_t i = 0; i < num_data_points; ++i) {
+        out.write_values(data[i]);
+        if constexpr (has_label) {
+            out.write_value(numeric_label[i]);
+        }
+    }
+    out.close();
+}
+
+/**
+ * @brief Write the provided @p data and @p label to the NumPy file @p filename, the labels are written as last column.
+ * @tparam real_type the floating point type
+ * @tparam label_type the type of the labels (any arithmetic type or std::string)
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @param[in] label the labels to write to the file
+ * @throws plssvm::invalid_file_format_exception if a label can't be converted to @p real_type (the NumPy file format only supports numeric labels)
+ * @throws plssvm::file_exception if the file couldn't be created or written
+ */
+template <typename real_type, typename label_type>
+inline void write_npy_data(const std::string &filename, const std::vector<std::vector<real_type>> &data, const std::vector<label_type> &label) {
+    write_npy_data_impl<real_type, label_type, true>(filename, data, label);
+}
+
+/**
+ * @brief Write the provided @p data to the NumPy file @p filename.
+ * @tparam real_type the floating point type
+ * @param[in] filename the filename to write the data to
+ * @param[in] data the data points to write to the file
+ * @throws plssvm::file_exception if the file couldn't be created or written
+ */
+template <typename real_type>
+inline void write_npy_data(const std::string &filename, const std::vector<std::vector<real_type>> &data) {
+    write_npy_data_impl<real_type, real_type, false>(filename, data, {});
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_NPY_PARSING_HPP_
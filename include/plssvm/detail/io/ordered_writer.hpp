@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a parallel writer formatting blocks of rows concurrently while writing them in their original order.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_ORDERED_WRITER_HPP_
+#define PLSSVM_DETAIL_IO_ORDERED_WRITER_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+#include "fmt/os.h"                  // fmt::ostream
+
+#include <algorithm>                 // std::max, std::min
+#include <cstddef>                   // std::size_t
+#include <exception>                 // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <string>                    // std::string
+
+namespace plssvm::detail::io {
+
+/// The targeted size of the formatted output of one block of rows in bytes (1 MiB).
+constexpr std::size_t ordered_writer_block_bytes = 1024 * 1024;
+
+/**
+ * @brief Calculate the number of rows per block such that a formatted block has roughly a size of plssvm::detail::io::ordered_writer_block_bytes.
+ * @param[in] bytes_per_row the (estimated) number of bytes of one formatted row
+ * @return the number of rows per block, always at least one (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::size_t ordered_writer_rows_per_block(const std::size_t bytes_per_row) {
+    return std::max<std::size_t>(ordered_writer_block_bytes / std::max<std::size_t>(bytes_per_row, 1), 1);
+}
+
+/**
+ * @brief Write @p num_rows rows to @p out, where the rows are formatted in parallel using @p format_row.
+ * @details The rows are split into fixed-size blocks of @p rows_per_block rows. The blocks are distributed dynamically over all threads, each thread formatting its
+ *          block into a thread-local buffer. The formatted blocks are then written using an `ordered` construct, i.e., while one thread writes its block, the other
+ *          threads already format the next blocks. Since the blocks are always written in ascending order, the resulting file is byte-identical regardless
+ *          of the number of used threads and at most one block per thread is kept in memory.
+ * @tparam format_func the type of the function formatting one row
+ * @param[in,out] out the output stream to write the formatted rows to
+ * @param[in] num_rows the total number of rows to write
+ * @param[in] rows_per_block the number of rows formatted together by one thread (e.g., calculated by plssvm::detail::io::ordered_writer_rows_per_block)
+ * @param[in] format_row the function appending the row with the given index to the given `std::string`: `void(std::string &, std::size_t)`
+ * @throws std::exception the first exception, in row order, thrown by @p format_row or while writing to @p out; no further rows are written afterwards
+ */
+template <typename format_func>
+inline void write_ordered(fmt::ostream &out, const std::size_t num_rows, const std::size_t rows_per_block, format_func &&format_row) {
+    PLSSVM_ASSERT(rows_per_block > 0, "The number of rows per block must be greater than 0!");
+
+    const std::size_t num_blocks = (num_rows + rows_per_block - 1) / rows_per_block;
+    // only accessed inside the ordered region -> no additional synchronization necessary
+    std::exception_ptr ordered_exception;
+
+    #pragma omp parallel default(none) shared(out, format_row, ordered_exception) firstprivate(num_rows, rows_per_block, num_blocks)
+    {
+        // reuse the buffer for all blocks of the current thread
+        std::string buffer;
+
+        #pragma omp for ordered schedule(dynamic)
+        for (std::size_t block = 0; block < num_blocks; ++block) {
+            // format all rows of the current block
+            buffer.clear();
+            std::exception_ptr format_exception;
+            try {
+                const std::size_t block_end = std::min(num_rows, (block + 1) * rows_per_block);
+                for (std::size_t row = block * rows_per_block; row < block_end; ++row) {
+                    format_row(buffer, row);
+                }
+            } catch (const std::exception &) {
+                format_exception = std::current_exception();
+            }
+
+            // write the blocks in ascending order
+            #pragma omp ordered
+            {
+                if (!ordered_exception) {
+                    if (format_exception) {
+                        ordered_exception = format_exception;
+                    } else {
+                        try {
+                            out.print("{}", buffer);
+                        } catch (const std::exception &) {
+                            ordered_exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // rethrow if an exception occurred inside the parallel region
+    if (ordered_exception) {
+        std::rethrow_exception(ordered_exception);
+    }
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_ORDERED_WRITER_HPP_
@@ -0,0 +1,136 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements parsing functions for the solver state file used for Krylov subspace recycling.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_SOLVER_STATE_PARSING_HPP_
+#define PLSSVM_DETAIL_IO_SOLVER_STATE_PARSING_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
+#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::{convert_to, split_as}
+#include "plssvm/detail/string_utility.hpp"     // plssvm::detail::{trim, starts_with}
+#include "plssvm/detail/utility.hpp"            // plssvm::detail::current_date_time
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_file_format_exception
+
+#include "fmt/core.h"                           // fmt::format
+#include "fmt/format.h"                         // fmt::join
+#include "fmt/os.h"                             // fmt::ostream, fmt::output_file
+
+#include <algorithm>                            // std::all_of
+#include <cstddef>                              // std::size_t
+#include <string>                               // std::string
+#include <string_view>                          // std::string_view
+#include <tuple>                                // std::tuple, std::make_tuple
+#include <utility>                              // std::move
+#include <vector>                               // std::vector
+
+namespace plssvm::detail::io {
+
+/**
+ * @brief Parse the header entry @p line of the form `name value`.
+ * @param[in] line the header line
+ * @param[in] name the expected name of the header entry
+ * @throws plssvm::invalid_file_format_exception if @p line doesn't start with @p name
+ * @return the value of the header entry (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::size_t parse_solver_state_header_entry(const std::string_view line, const std::string_view name) {
+    const std::string_view trimmed = detail::trim(line);
+    if (!detail::starts_with(trimmed, name)) {
+        throw invalid_file_format_exception{ fmt::format("Expected the header entry \"{}\", but got \"{}\"!", name, trimmed) };
+    }
+    return detail::convert_to<std::size_t, invalid_file_format_exception>(detail::trim(trimmed.substr(name.size())));
+}
+
+/**
+ * @brief Read the deflation vectors of a solver state from the file read by @p reader.
+ * @details An example file can look like
+ * @code
+ * max_vectors 2
+ * num_rows 4
+ * 0.5 0.5 0.5 0.5
+ * 0.5 -0.5 0.5 -0.5
+ * @endcode
+ * Each line after the header contains one deflation vector, i.e., an approximate eigenvector of the reduced system matrix of a previous solve.
+ * @tparam real_type the used floating point type
+ * @param[in] reader the file_reader used to read the solver state
+ * @throws plssvm::invalid_file_format_exception if the header is omitted (`max_vectors` and `num_rows`)
+ * @throws plssvm::invalid_file_format_exception if the maximum number of deflation vectors is zero
+ * @throws plssvm::invalid_file_format_exception if more than `max_vectors` deflation vectors are given
+ * @throws plssvm::invalid_file_format_exception if a deflation vector doesn't contain exactly `num_rows` values
+ * @return the maximum number of deflation vectors and the read deflation vectors (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] inline std::tuple<std::size_t, std::vector<std::vector<real_type>>> parse_solver_state(const file_reader &reader) {
+    PLSSVM_ASSERT(reader.is_open(), "The file_reader is currently not associated with a file!");
+
+    // at least two lines ("max_vectors" + "num_rows")
+    if (reader.num_lines() < 2) {
+        throw invalid_file_format_exception{ fmt::format("At least two lines must be present, but only {} were given!", reader.num_lines()) };
+    }
+
+    const std::size_t max_vectors = parse_solver_state_header_entry(reader.line(0), "max_vectors");
+    if (max_vectors == 0) {
+        throw invalid_file_format_exception{ "The maximum number of deflation vectors must be greater than 0!" };
+    }
+    const std::size_t num_rows = parse_solver_state_header_entry(reader.line(1), "num_rows");
+    if (reader.num_lines() - 2 > max_vectors) {
+        throw invalid_file_format_exception{ fmt::format("At most {} deflation vectors may be given, but {} were given!", max_vectors, reader.num_lines() - 2) };
+    }
+
+    // parse the deflation vectors
+    std::vector<std::vector<real_type>> vectors(reader.num_lines() - 2);
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        vectors[i] = detail::split_as<real_type>(detail::trim(reader.line(i + 2)));
+        if (vectors[i].size() != num_rows) {
+            throw invalid_file_format_exception{ fmt::format("Each deflation vector must contain exactly {} values, but deflation vector {} contains {}!", num_rows, i, vectors[i].size()) };
+        }
+    }
+
+    return std::make_tuple(max_vectors, std::move(vectors));
+}
+
+/**
+ * @brief Write the deflation @p vectors of a solver state to the file @p filename.
+ * @details An example file can look like
+ * @code
+ * max_vectors 2
+ * num_rows 4
+ * 0.5 0.5 0.5 0.5
+ * 0.5 -0.5 0.5 -0.5
+ * @endcode
+ * @tparam real_type the used floating point type
+ * @param[in] filename the filename to write the solver state to
+ * @param[in] max_vectors the maximum number of deflation vectors
+ * @param[in] num_rows the number of values in each deflation vector
+ * @param[in] vectors the deflation vectors
+ */
+template <typename real_type>
+inline void write_solver_state(const std::string &filename, const std::size_t max_vectors, const std::size_t num_rows, const std::vector<std::vector<real_type>> &vectors) {
+    PLSSVM_ASSERT(max_vectors > 0, "The maximum number of deflation vectors must be greater than 0!");
+    PLSSVM_ASSERT(vectors.size() <= max_vectors, "At most {} deflation vectors may be given, but {} were given!", max_vectors, vectors.size());
+    PLSSVM_ASSERT(std::all_of(vectors.cbegin(), vectors.cend(), [num_rows](const std::vector<real_type> &vec) { return vec.size() == num_rows; }), "All deflation vectors must contain exactly {} values!", num_rows);
+
+    // create output file
+    fmt::ostream out = fmt::output_file(filename);
+    // write timestamp as current date time
+    out.print("# This solver state has been created at {}\n", detail::current_date_time());
+
+    // write the header
+    out.print("max_vectors {}\nnum_rows {}\n", max_vectors, num_rows);
+    // write one deflation vector per line
+    for (const std::vector<real_type> &vec : vectors) {
+        out.print("{}\n", fmt::join(vec, " "));
+    }
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_SOLVER_STATE_PARSING_HPP_
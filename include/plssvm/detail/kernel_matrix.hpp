@@ -0,0 +1,284 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines functions to explicitly compute kernel matrices on the host, e.g., used to share the kernel matrix between multiple fits,
+ *        and to solve the reduced LS-SVM system of linear equations using such an explicit kernel matrix.
+ */
+
+#ifndef PLSSVM_DETAIL_KERNEL_MATRIX_HPP_
+#define PLSSVM_DETAIL_KERNEL_MATRIX_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/detail/operators.hpp"       // plssvm::operators::{squared_euclidean_dist, transposed, sum}
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"              // plssvm::detail::parameter
+
+#include <algorithm>                         // std::fill, std::min
+#include <cmath>                             // std::exp, std::pow, std::fma
+#include <cstddef>                           // std::size_t
+#include <vector>                            // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Compute the pairwise base values (squared euclidean distances for the rbf kernel, inner products otherwise) between all points in @p lhs and @p rhs.
+ * @details The result is stored row-wise in a `lhs.size()` x `rhs.size()` matrix. The base values only depend on the kernel function, but not on its
+ *          parameters, i.e., they can be reused for different `gamma`, `degree`, or `coef0` values.
+ * @tparam real_type the type of the data (`float` or `double`)
+ * @param[in] kernel the used kernel function
+ * @param[in] lhs the first set of data points
+ * @param[in] rhs the second set of data points
+ * @return the pairwise base values (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] std::vector<real_type> compute_base_matrix(const kernel_function_type kernel, const std::vector<std::vector<real_type>> &lhs, const std::vector<std::vector<real_type>> &rhs) {
+    PLSSVM_ASSERT(!lhs.empty() && !rhs.empty(), "The data must not be empty!");
+
+    using size_type = std::size_t;
+    using namespace plssvm::operators;
+
+    const size_type num_rows = lhs.size();
+    const size_type num_cols = rhs.size();
+    const bool symmetric = &lhs == &rhs;
+    std::vector<real_type> base(num_rows * num_cols);
+
+    #pragma omp parallel for schedule(dynamic) default(none) shared(lhs, rhs, base) firstprivate(num_rows, num_cols, symmetric, kernel)
+    for (size_type row = 0; row < num_rows; ++row) {
+        // only calculate the upper triangular matrix in the symmetric case
+        for (size_type col = symmetric ? row : 0; col < num_cols; ++col) {
+            const real_type value = kernel == kernel_function_type::rbf ? squared_euclidean_dist(lhs[row], rhs[col]) : transposed<real_type>{ lhs[row] } * rhs[col];
+            base[row * num_cols + col] = value;
+            if (symmetric) {
+                base[col * num_cols + row] = value;
+            }
+        }
+    }
+    return base;
+}
+
+/**
+ * @brief Element-wise apply the kernel function given by @p params to the previously computed @p base matrix.
+ * @details @p base and @p kernel_matrix may refer to the same vector to transform the base values in-place.
+ * @tparam real_type the type of the data (`float` or `double`)
+ * @param[in] params the SVM parameter (kernel function, `gamma`, `degree`, and `coef0`)
+ * @param[in] base the pairwise base values
+ * @param[out] kernel_matrix the resulting kernel matrix; must have the same size as @p base
+ */
+template <typename real_type>
+void apply_kernel_function(const parameter<real_type> &params, const std::vector<real_type> &base, std::vector<real_type> &kernel_matrix) {
+    PLSSVM_ASSERT(base.size() == kernel_matrix.size(), "Sizes mismatch!: {} != {}", base.size(), kernel_matrix.size());
+
+    using size_type = std::size_t;
+
+    const size_type size = base.size();
+    const real_type gamma = params.gamma.value();
+    const real_type coef0 = params.coef0.value();
+    const auto degree = static_cast<real_type>(params.degree.value());
+
+    switch (params.kernel_type) {
+        case kernel_function_type::linear:
+            if (&base != &kernel_matrix) {
+                kernel_matrix = base;
+            }
+            break;
+        case kernel_function_type::polynomial:
+            #pragma omp parallel for simd default(none) shared(base, kernel_matrix) firstprivate(size, gamma, coef0, degree)
+            for (size_type i = 0; i < size; ++i) {
+                kernel_matrix[i] = std::pow(std::fma(gamma, base[i], coef0), degree);
+            }
+            break;
+        case kernel_function_type::rbf:
+            #pragma omp parallel for simd default(none) shared(base, kernel_matrix) firstprivate(size, gamma)
+            for (size_type i = 0; i < size; ++i) {
+                kernel_matrix[i] = std::exp(-gamma * base[i]);
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Calculate `ret = add * A * d + ret` where `A` is the reduced LS-SVM matrix of the data points given by @p indices defined by the explicit @p kernel_matrix.
+ * @tparam real_type the type of the data (`float` or `double`)
+ * @param[in] kernel_matrix the explicit `num_data_points` x `num_data_points` kernel matrix
+ * @param[in] num_data_points the number of **all** data points, i.e., the number of columns in @p kernel_matrix
+ * @param[in] indices the indices of the data points spanning the reduced LS-SVM matrix; the last index is used in the dimensional reduction;
+ *                    if empty, all data points are used in their original order
+ * @param[in] q the `q` vector used in the dimensional reduction
+ * @param[in] QA_cost a value used in the dimensional reduction
+ * @param[in] cost `1 / cost` added to the diagonal
+ * @param[in] d the vector to multiply
+ * @param[in,out] ret the result vector
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ */
+template <typename real_type>
+void reduced_matrix_vector_multiplication(const std::vector<real_type> &kernel_matrix, const std::size_t num_data_points, const std::vector<std::size_t> &indices, const std::vector<real_type> &q, const real_type QA_cost, const real_type cost, const std::vector<real_type> &d, std::vector<real_type> &ret, const real_type add) {
+    PLSSVM_ASSERT(kernel_matrix.size() == num_data_points * num_data_points, "Sizes mismatch!: {} != {}", kernel_matrix.size(), num_data_points * num_data_points);
+    PLSSVM_ASSERT(q.size() == (indices.empty() ? num_data_points : indices.size()) - 1, "Sizes mismatch!: {} != {}", q.size(), (indices.empty() ? num_data_points : indices.size()) - 1);
+    PLSSVM_ASSERT(d.size() == q.size() && ret.size() == q.size(), "Sizes mismatch!: {}, {}, and {}", q.size(), d.size(), ret.size());
+
+    using size_type = std::size_t;
+    using namespace plssvm::operators;
+
+    const size_type dept = q.size();
+    const bool all_data_points = indices.empty();
+    const real_type d_sum = sum(d);
+    const real_type q_d = transposed{ q } * d;
+
+    #pragma omp parallel for default(none) shared(kernel_matrix, indices, q, d, ret) firstprivate(num_data_points, dept, all_data_points, QA_cost, cost, add, d_sum, q_d)
+    for (size_type row = 0; row < dept; ++row) {
+        real_type temp{ 0.0 };
+        if (all_data_points) {
+            // contiguous access to the kernel matrix row
+            const real_type *kernel_row = kernel_matrix.data() + row * num_data_points;
+            #pragma omp simd reduction(+ : temp)
+            for (size_type col = 0; col < dept; ++col) {
+                temp += kernel_row[col] * d[col];
+            }
+        } else {
+            const real_type *kernel_row = kernel_matrix.data() + indices[row] * num_data_points;
+            for (size_type col = 0; col < dept; ++col) {
+                temp = std::fma(kernel_row[indices[col]], d[col], temp);
+            }
+        }
+        // (K_ij + QA_cost - q_i - q_j) * d_j + cost * d_i
+        temp += (QA_cost - q[row]) * d_sum - q_d + cost * d[row];
+        ret[row] += add * temp;
+    }
+}
+
+/**
+ * @brief Solve the reduced LS-SVM system of the data points given by @p indices for the explicit @p kernel_matrix using the CG algorithm starting at @p alpha.
+ * @details Identical to the CG algorithm of the backends (see plssvm::csvm::solve_system_of_linear_equations), i.e., the residual is recomputed every
+ *          50 iterations. The termination criterion is relative to the residual of the default initial guess (all ones) to obtain the same accuracy
+ *          as plssvm::csvm::fit regardless of the provided warm start.
+ * @tparam real_type the type of the data (`float` or `double`)
+ * @param[in] kernel_matrix the explicit `y.size()` x `y.size()` kernel matrix
+ * @param[in] y the mapped labels of **all** data points
+ * @param[in] indices the indices of the data points spanning the reduced LS-SVM system; if empty, all data points are used in their original order
+ * @param[in] cost the `cost` SVM parameter
+ * @param[in] eps the relative error tolerance of the CG algorithm
+ * @param[in] max_iter the maximum number of CG iterations
+ * @param[in,out] alpha the warm start (reduced size) and the solution after the CG algorithm finished
+ * @return the number of performed CG iterations (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] unsigned long long solve_reduced_system_of_linear_equations(const std::vector<real_type> &kernel_matrix, const std::vector<real_type> &y, const std::vector<std::size_t> &indices, const real_type cost, const real_type eps, const unsigned long long max_iter, std::vector<real_type> &alpha) {
+    PLSSVM_ASSERT(kernel_matrix.size() == y.size() * y.size(), "Sizes mismatch!: {} != {}", kernel_matrix.size(), y.size() * y.size());
+    PLSSVM_ASSERT((indices.empty() ? y.size() : indices.size()) >= 2, "At least two data points are necessary, but only {} are given!", indices.empty() ? y.size() : indices.size());
+    PLSSVM_ASSERT(alpha.size() == (indices.empty() ? y.size() : indices.size()) - 1, "Sizes mismatch!: {} != {}", alpha.size(), (indices.empty() ? y.size() : indices.size()) - 1);
+
+    using size_type = std::size_t;
+    using namespace plssvm::operators;
+
+    const size_type num_data_points = y.size();
+    const size_type dept = alpha.size();
+    const auto index = [&indices](const size_type i) { return indices.empty() ? i : indices[i]; };
+    const size_type last = index(dept);
+
+    // create q vector (kernel values between the data points and the last data point)
+    std::vector<real_type> q(dept);
+    for (size_type i = 0; i < dept; ++i) {
+        q[i] = kernel_matrix[index(i) * num_data_points + last];
+    }
+    // calculate QA_costs
+    const real_type QA_cost = kernel_matrix[last * num_data_points + last] + real_type{ 1.0 } / cost;
+    const real_type inv_cost = real_type{ 1.0 } / cost;
+
+    // update b
+    std::vector<real_type> b(dept);
+    for (size_type i = 0; i < dept; ++i) {
+        b[i] = y[index(i)] - y[last];
+    }
+
+    // the termination criterion is relative to the residual of the default initial guess
+    std::vector<real_type> r(b);
+    reduced_matrix_vector_multiplication(kernel_matrix, num_data_points, indices, q, QA_cost, inv_cost, std::vector<real_type>(dept, real_type{ 1.0 }), r, real_type{ -1.0 });
+    const real_type delta0 = transposed{ r } * r;
+
+    // r = b - A * alpha
+    r = b;
+    reduced_matrix_vector_multiplication(kernel_matrix, num_data_points, indices, q, QA_cost, inv_cost, alpha, r, real_type{ -1.0 });
+    real_type delta = transposed{ r } * r;
+    if (delta <= eps * eps * delta0) {
+        // the initial guess is already exact enough
+        return 0;
+    }
+
+    std::vector<real_type> d(r);
+    std::vector<real_type> Ad(dept);
+
+    unsigned long long iter = 0;
+    for (; iter < max_iter; ++iter) {
+        // Ad = A * d
+        std::fill(Ad.begin(), Ad.end(), real_type{ 0.0 });
+        reduced_matrix_vector_multiplication(kernel_matrix, num_data_points, indices, q, QA_cost, inv_cost, d, Ad, real_type{ 1.0 });
+
+        // (alpha = delta_new / (d^T * q))
+        const real_type alpha_cd = delta / (transposed{ d } * Ad);
+
+        // (x = x + alpha * d)
+        alpha += alpha_cd * d;
+
+        if (iter % 50 == 49) {
+            // r = b - A * x
+            r = b;
+            reduced_matrix_vector_multiplication(kernel_matrix, num_data_points, indices, q, QA_cost, inv_cost, alpha, r, real_type{ -1.0 });
+        } else {
+            // r -= alpha_cd * Ad
+            r -= alpha_cd * Ad;
+        }
+
+        // (delta = r^T * r)
+        const real_type delta_old = delta;
+        delta = transposed{ r } * r;
+        // if we are exact enough stop CG iterations
+        if (delta <= eps * eps * delta0) {
+            break;
+        }
+
+        // d = beta * d + r
+        d = (delta / delta_old) * d + r;
+    }
+    return std::min(iter + 1, max_iter);
+}
+
+/**
+ * @brief Calculate the bias `rho` of the solution @p alpha of the reduced LS-SVM system of the data points given by @p indices (identical to the backend implementations).
+ * @tparam real_type the type of the data (`float` or `double`)
+ * @param[in] kernel_matrix the explicit `y.size()` x `y.size()` kernel matrix
+ * @param[in] y the mapped labels of **all** data points
+ * @param[in] indices the indices of the data points spanning the reduced LS-SVM system; if empty, all data points are used in their original order
+ * @param[in] cost the `cost` SVM parameter
+ * @param[in] alpha the solution of the reduced LS-SVM system
+ * @return the bias (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] real_type calculate_reduced_rho(const std::vector<real_type> &kernel_matrix, const std::vector<real_type> &y, const std::vector<std::size_t> &indices, const real_type cost, const std::vector<real_type> &alpha) {
+    PLSSVM_ASSERT(kernel_matrix.size() == y.size() * y.size(), "Sizes mismatch!: {} != {}", kernel_matrix.size(), y.size() * y.size());
+    PLSSVM_ASSERT(alpha.size() == (indices.empty() ? y.size() : indices.size()) - 1, "Sizes mismatch!: {} != {}", alpha.size(), (indices.empty() ? y.size() : indices.size()) - 1);
+
+    using size_type = std::size_t;
+    using namespace plssvm::operators;
+
+    const size_type num_data_points = y.size();
+    const size_type dept = alpha.size();
+    const auto index = [&indices](const size_type i) { return indices.empty() ? i : indices[i]; };
+    const size_type last = index(dept);
+
+    const real_type QA_cost = kernel_matrix[last * num_data_points + last] + real_type{ 1.0 } / cost;
+    real_type q_alpha{ 0.0 };
+    for (size_type i = 0; i < dept; ++i) {
+        q_alpha = std::fma(kernel_matrix[index(i) * num_data_points + last], alpha[i], q_alpha);
+    }
+    return -(y[last] + QA_cost * sum(alpha) - q_alpha);
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_KERNEL_MATRIX_HPP_
@@ -0,0 +1,161 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a pipeline predicting the labels of a LIBSVM file chunk by chunk using a bounded amount of memory.
+ */
+
+#ifndef PLSSVM_DETAIL_PREDICT_PIPELINE_HPP_
+#define PLSSVM_DETAIL_PREDICT_PIPELINE_HPP_
+#pragma once
+
+#include "plssvm/data_set.hpp"                       // plssvm::data_set
+#include "plssvm/detail/assert.hpp"                  // PLSSVM_ASSERT
+#include "plssvm/detail/io/libsvm_chunk_reader.hpp"  // plssvm::detail::io::libsvm_chunk_reader
+#include "plssvm/detail/logger.hpp"                  // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"     // plssvm::detail::tracking_entry
+#include "plssvm/exceptions/exceptions.hpp"          // plssvm::invalid_file_format_exception
+
+#include "fmt/chrono.h"                              // format std::chrono types using fmt
+#include "fmt/format.h"                              // fmt::join
+#include "fmt/os.h"                                  // fmt::ostream, fmt::output_file
+
+#include <algorithm>                                 // std::max, std::min
+#include <chrono>                                    // std::chrono::{steady_clock, duration, duration_cast, milliseconds}
+#include <cstddef>                                   // std::size_t
+#include <future>                                    // std::future, std::async, std::launch
+#include <string>                                    // std::string
+#include <utility>                                   // std::pair, std::move
+#include <vector>                                    // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief The result of a plssvm::detail::run_predict_pipeline invocation.
+ */
+struct predict_pipeline_result {
+    /// The number of predicted data points.
+    std::size_t num_data_points{ 0 };
+    /// The number of processed chunks.
+    std::size_t num_chunks{ 0 };
+    /// The number of correctly predicted data points (only meaningful if the data points are annotated with labels).
+    std::size_t num_correct{ 0 };
+    /// `true` if the data points are annotated with labels.
+    bool has_labels{ false };
+};
+
+/**
+ * @brief Calculate the number of data points per chunk used in plssvm::detail::run_predict_pipeline.
+ * @details The pipeline holds at most two chunks of data points at the same time: the one currently read and the one currently predicted.
+ *          If a @p memory_limit is given, the chunk size is reduced such that these two chunks fit into @p memory_limit bytes.
+ * @param[in] chunk_size the requested number of data points per chunk; if `0`, only the @p memory_limit is used
+ * @param[in] memory_limit the maximum number of bytes used for the data points; if `0`, only the @p chunk_size is used
+ * @param[in] num_features the number of features of each data point
+ * @param[in] real_type_size the size of the floating point type in bytes
+ * @return the number of data points per chunk, always at least one (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::size_t predict_pipeline_chunk_size(const std::size_t chunk_size, const std::size_t memory_limit, const std::size_t num_features, const std::size_t real_type_size) {
+    PLSSVM_ASSERT(chunk_size > 0 || memory_limit > 0, "Either the chunk size or the memory limit must be provided!");
+
+    if (memory_limit == 0) {
+        return chunk_size;
+    }
+    // a data point consists of the feature values and the std::vector managing them
+    const std::size_t bytes_per_data_point = num_features * real_type_size + sizeof(std::vector<double>);
+    const std::size_t max_chunk_size = std::max<std::size_t>(memory_limit / (2 * bytes_per_data_point), 1);
+    return chunk_size == 0 ? max_chunk_size : std::min(chunk_size, max_chunk_size);
+}
+
+/**
+ * @brief Predict all data points read by @p reader in chunks of @p chunk_size data points using @p predict and write the predicted labels to @p predict_filename.
+ * @details Reading and parsing the next chunk, predicting the current chunk, and writing the predicted labels of the previous chunk are overlapped in a three-stage pipeline.
+ *          The labels are written in the same order as the data points in the input file. The resulting file is identical to the one written after predicting the whole data set at once.
+ * @tparam real_type the type of the data points
+ * @tparam label_type the type of the labels
+ * @tparam predict_func the type of the prediction function
+ * @param[in,out] reader the reader providing the data points to predict
+ * @param[in] predict_filename the file to write the predicted labels to
+ * @param[in] chunk_size the maximum number of data points per chunk
+ * @param[in] predict the function predicting the labels of a `plssvm::data_set<real_type, label_type>` chunk (e.g., a wrapper around plssvm::csvm::predict)
+ * @throws plssvm::invalid_file_format_exception if no data points could be read
+ * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::libsvm_chunk_reader::read_chunk
+ * @throws plssvm::exception all exceptions thrown by @p predict
+ * @return the number of predicted data points, chunks, and correctly predicted data points (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type, typename predict_func>
+[[nodiscard]] inline predict_pipeline_result run_predict_pipeline(io::libsvm_chunk_reader<real_type, label_type> &reader, const std::string &predict_filename, const std::size_t chunk_size, predict_func &&predict) {
+    PLSSVM_ASSERT(chunk_size > 0, "The chunk size must be greater than 0!");
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    predict_pipeline_result result{};
+    fmt::ostream out = fmt::output_file(predict_filename);
+
+    // stage 1: read and parse the next chunk
+    const auto read_next_chunk = [&reader, chunk_size]() { return reader.read_chunk(chunk_size); };
+    std::future<std::pair<std::vector<std::vector<real_type>>, std::vector<label_type>>> next_chunk = std::async(std::launch::async, read_next_chunk);
+    // stage 3: write the predicted labels of the previous chunk and count the correct predictions
+    std::future<std::size_t> pending_write{};
+
+    while (true) {
+        auto [data, correct_labels] = next_chunk.get();
+        if (data.empty()) {
+            break;
+        }
+        const std::size_t num_data_points = data.size();
+        // start reading the next chunk while predicting the current one
+        next_chunk = std::async(std::launch::async, read_next_chunk);
+
+        // stage 2: predict the current chunk
+        const data_set<real_type, label_type> chunk{ std::move(data) };
+        std::vector<label_type> predicted_labels = predict(chunk);
+
+        // the previous chunk must have been written before the current one to retain the order of the labels
+        if (pending_write.valid()) {
+            result.num_correct += pending_write.get();
+        }
+        pending_write = std::async(std::launch::async, [&out, is_first_chunk = result.num_chunks == 0, predicted_labels = std::move(predicted_labels), correct_labels = std::move(correct_labels)]() {
+            out.print("{}{}", is_first_chunk ? "" : "\n", fmt::join(predicted_labels, "\n"));
+            std::size_t correct{ 0 };
+            for (typename std::vector<label_type>::size_type i = 0; i < correct_labels.size(); ++i) {
+                // check whether prediction is correct
+                if (predicted_labels[i] == correct_labels[i]) {
+                    ++correct;
+                }
+            }
+            return correct;
+        });
+
+        result.num_data_points += num_data_points;
+        ++result.num_chunks;
+    }
+    if (pending_write.valid()) {
+        result.num_correct += pending_write.get();
+    }
+    result.has_labels = reader.has_labels();
+
+    // no data points were read -> invalid file
+    if (result.num_data_points == 0) {
+        throw invalid_file_format_exception{ "Can't parse file: no data points are given!" };
+    }
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed_seconds = end_time - start_time;
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Predicted {} data points in {} chunks of at most {} data points in {} ({} data points/s).\n",
+                detail::tracking_entry{ "predict_pipeline", "num_data_points", result.num_data_points },
+                detail::tracking_entry{ "predict_pipeline", "num_chunks", result.num_chunks },
+                detail::tracking_entry{ "predict_pipeline", "chunk_size", chunk_size },
+                detail::tracking_entry{ "predict_pipeline", "time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
+                detail::tracking_entry{ "predict_pipeline", "throughput", static_cast<std::size_t>(static_cast<double>(result.num_data_points) / std::max(elapsed_seconds.count(), 1e-9)) });
+
+    return result;
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_PREDICT_PIPELINE_HPP_
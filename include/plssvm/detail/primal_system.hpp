@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a function to assemble the low-dimensional primal LS-SVM system spanned by a subset of the data points.
+ */
+
+#ifndef PLSSVM_DETAIL_PRIMAL_SYSTEM_HPP_
+#define PLSSVM_DETAIL_PRIMAL_SYSTEM_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function
+#include "plssvm/parameter.hpp"              // plssvm::detail::parameter
+
+#include <algorithm>                         // std::min
+#include <cstddef>                           // std::size_t
+#include <vector>                            // std::vector
+
+namespace plssvm::detail {
+
+/// The number of data points whose kernel values are computed at once while assembling the primal system.
+constexpr std::size_t primal_system_block_size = 1024;
+
+/**
+ * @brief Assemble the `(m + 1)`-dimensional primal LS-SVM system spanned by the `m` data points given by @p basis.
+ * @details The resulting system is `[K_mm / C + K_mn * K_nm, K_mn * 1; 1^T * K_nm, n] * [beta; b] = [K_mn * t; 1^T * t]` with the @p targets `t`.
+ *          The `n x m` kernel matrix `K_nm` is never stored completely but processed in blocks of plssvm::detail::primal_system_block_size data points,
+ *          i.e., the memory consumption is quadratic in `m` and independent of the number of data points `n`.
+ *          The system is accumulated in double precision since the normal equations square the condition number.
+ * @tparam real_type the type of the data (`float` or `double`)
+ * @param[in] X all data points
+ * @param[in] basis the indices of the data points spanning the primal system
+ * @param[in] targets the target value of each data point
+ * @param[in] params the kernel function parameter
+ * @param[in] cost the `cost` SVM parameter
+ * @param[out] A the `(m + 1)` x `(m + 1)` system matrix stored row-wise
+ * @param[out] b the right-hand side of the system
+ */
+template <typename real_type>
+void assemble_primal_system(const std::vector<std::vector<real_type>> &X, const std::vector<std::size_t> &basis, const std::vector<real_type> &targets, const parameter<real_type> &params, const double cost, std::vector<double> &A, std::vector<double> &b) {
+    PLSSVM_ASSERT(X.size() == targets.size(), "Sizes mismatch!: {} != {}", X.size(), targets.size());
+    PLSSVM_ASSERT(!basis.empty(), "The basis must not be empty!");
+
+    using size_type = std::size_t;
+
+    const size_type num_data_points = X.size();
+    const size_type m = basis.size();
+    const size_type dim = m + 1;
+
+    A.assign(dim * dim, 0.0);
+    b.assign(dim, 0.0);
+    const size_type block_size = std::min(num_data_points, primal_system_block_size);
+    std::vector<real_type> feature_block(block_size * m);
+
+    for (size_type block_start = 0; block_start < num_data_points; block_start += block_size) {
+        const size_type current_block_size = std::min(block_size, num_data_points - block_start);
+
+        // compute the kernel values between the data points of the current block and all basis data points
+        #pragma omp parallel for collapse(2) default(none) shared(X, basis, params, feature_block) firstprivate(block_start, current_block_size, m)
+        for (size_type i = 0; i < current_block_size; ++i) {
+            for (size_type j = 0; j < m; ++j) {
+                feature_block[i * m + j] = kernel_function(X[block_start + i], X[basis[j]], params);
+            }
+        }
+
+        // A += K_bm^T * K_bm (upper triangle only); A[:, m] += K_bm^T * 1; b += K_bm^T * t
+        #pragma omp parallel for schedule(dynamic) default(none) shared(feature_block, targets, A, b) firstprivate(block_start, current_block_size, m, dim)
+        for (size_type j = 0; j < m; ++j) {
+            double *A_row = A.data() + j * dim;
+            for (size_type i = 0; i < current_block_size; ++i) {
+                const real_type *feature_row = feature_block.data() + i * m;
+                const double k_ij = feature_row[j];
+                for (size_type l = j; l < m; ++l) {
+                    A_row[l] += k_ij * static_cast<double>(feature_row[l]);
+                }
+                A_row[m] += k_ij;
+                b[j] += k_ij * static_cast<double>(targets[block_start + i]);
+            }
+        }
+    }
+    // add the regularization term K_mm / C
+    const double inv_cost = 1.0 / cost;
+    #pragma omp parallel for schedule(dynamic) default(none) shared(X, basis, params, A) firstprivate(m, dim, inv_cost)
+    for (size_type j = 0; j < m; ++j) {
+        for (size_type l = j; l < m; ++l) {
+            A[j * dim + l] += inv_cost * static_cast<double>(kernel_function(X[basis[j]], X[basis[l]], params));
+        }
+    }
+    // last row: 1^T * K_nm and n; right-hand side: 1^T * t
+    A[m * dim + m] = static_cast<double>(num_data_points);
+    for (const real_type t_i : targets) {
+        b[m] += static_cast<double>(t_i);
+    }
+    // mirror the upper triangular matrix
+    for (size_type j = 0; j < dim; ++j) {
+        for (size_type l = j + 1; l < dim; ++l) {
+            A[l * dim + j] = A[j * dim + l];
+        }
+    }
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_PRIMAL_SYSTEM_HPP_
@@ -0,0 +1,47 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the optional settings of a single solve of the system of linear equations passed to the backends.
+ */
+
+#ifndef PLSSVM_DETAIL_SOLVE_OPTIONS_HPP_
+#define PLSSVM_DETAIL_SOLVE_OPTIONS_HPP_
+#pragma once
+
+#include "plssvm/detail/cg_checkpoint.hpp"  // plssvm::detail::checkpoint_config
+#include "plssvm/detail/cg_monitor.hpp"     // plssvm::detail::cg_monitor
+#include "plssvm/solver_state.hpp"          // plssvm::solver_state
+#include "plssvm/solver_types.hpp"          // plssvm::solver_type
+
+#include <vector>                           // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief The optional settings of a single solve of the system of linear equations (see plssvm::csvm::solve_system_of_linear_equations).
+ * @details A default constructed object solves the system using the classic CG algorithm starting with all ones, i.e., without deflation,
+ *          checkpoints, progress reports, or cancellation.
+ * @tparam real_type the type of the data
+ */
+template <typename real_type>
+struct solve_options {
+    /// The CG variant used to solve the system of linear equations.
+    solver_type solver{ solver_type::cg };
+    /// The solver state used to deflate the CG (only supported for plssvm::solver_type::cg); may be `nullptr`.
+    solver_state<real_type> *state{ nullptr };
+    /// The settings used to write and resume from CG checkpoints (only supported for plssvm::solver_type::cg).
+    checkpoint_config checkpoint{};
+    /// Reports the progress after each CG iteration and stops the CG early if it has been cancelled.
+    cg_monitor monitor{};
+    /// The initial guess of the CG for the reduced system of linear equations (`num_data_points - 1` values); if empty, the CG starts with all ones.
+    std::vector<real_type> initial_guess{};
+};
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_SOLVE_OPTIONS_HPP_
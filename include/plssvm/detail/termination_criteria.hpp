@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a function to parse the termination criteria of the CG algorithm from the named parameters.
+ */
+
+#ifndef PLSSVM_DETAIL_TERMINATION_CRITERIA_HPP_
+#define PLSSVM_DETAIL_TERMINATION_CRITERIA_HPP_
+#pragma once
+
+#include "plssvm/default_value.hpp"          // plssvm::default_value, plssvm::default_init
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_parameter_exception
+#include "plssvm/parameter.hpp"              // plssvm::{epsilon, max_iter}, plssvm::detail::get_value_from_named_parameter
+
+#include "fmt/core.h"                        // fmt::format
+#include "fmt/ostream.h"                     // can use fmt using operator<< overloads
+#include "igor/igor.hpp"                     // igor::parser
+
+#include <cstddef>                           // std::size_t
+#include <utility>                           // std::pair, std::make_pair, std::forward
+
+namespace plssvm::detail {
+
+/**
+ * @brief Parse the termination criteria `epsilon` and `max_iter` of the CG algorithm from the named parameters @p named_args.
+ * @details All other named parameters are ignored, i.e., the caller must check the allowed named parameters itself.
+ * @tparam real_type the type of the data (`float` or `double`)
+ * @tparam Args the type of the potential additional parameters
+ * @param[in] num_data_points the number of training data points used as default value for `max_iter`
+ * @param[in] named_args the potential additional parameters
+ * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+ * @throws plssvm::invalid_parameter_exception if the provided maximum number of iterations is zero
+ * @return the `epsilon` and `max_iter` values (`[[nodiscard]]`)
+ */
+template <typename real_type, typename... Args>
+[[nodiscard]] std::pair<real_type, unsigned long long> parse_termination_criteria(const std::size_t num_data_points, Args &&...named_args) {
+    igor::parser parser{ std::forward<Args>(named_args)... };
+
+    // set default values
+    default_value epsilon_val{ default_init<real_type>{ 0.001 } };
+    default_value max_iter_val{ default_init<unsigned long long>{ num_data_points } };
+
+    // compile time check: only named parameter are permitted
+    static_assert(!parser.has_unnamed_arguments(), "Can only use named parameter!");
+    // compile time check: each named parameter must only be passed once
+    static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
+
+    // compile time/runtime check: the values must have the correct types
+    if constexpr (parser.has(epsilon)) {
+        // get the value of the provided named parameter
+        epsilon_val = get_value_from_named_parameter<typename decltype(epsilon_val)::value_type>(parser, epsilon);
+        // check if value makes sense
+        if (epsilon_val <= static_cast<typename decltype(epsilon_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("epsilon must be greater than 0.0, but is {}!", epsilon_val) };
+        }
+    }
+    if constexpr (parser.has(max_iter)) {
+        // get the value of the provided named parameter
+        max_iter_val = get_value_from_named_parameter<typename decltype(max_iter_val)::value_type>(parser, max_iter);
+        // check if value makes sense
+        if (max_iter_val == static_cast<typename decltype(max_iter_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("max_iter must be greater than 0, but is {}!", max_iter_val) };
+        }
+    }
+
+    return std::make_pair(epsilon_val.value(), max_iter_val.value());
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_TERMINATION_CRITERIA_HPP_
@@ -82,6 +82,19 @@ class file_reader_exception : public exception {
     explicit file_reader_exception(const std::string &msg, source_location loc = source_location::current());
 };
 
+/**
+ * @brief Exception type thrown if a file couldn't be created or written (e.g., if the disk is full).
+ */
+class file_exception : public exception {
+  public:
+    /**
+     * @brief Construct a new exception forwarding the exception message and source location to plssvm::exception.
+     * @param[in] msg the exception's `what()` message
+     * @param[in] loc the exception's call side information
+     */
+    explicit file_exception(const std::string &msg, source_location loc = source_location::current());
+};
+
 /**
  * @brief Exception type thrown if a data_set is used inappropriately.
  */
@@ -160,6 +173,19 @@ class gpu_device_ptr_exception : public exception {
     explicit gpu_device_ptr_exception(const std::string &msg, source_location loc = source_location::current());
 };
 
+/**
+ * @brief Exception type thrown if an operation has been cancelled before it could produce a result.
+ */
+class operation_cancelled_exception : public exception {
+  public:
+    /**
+     * @brief Construct a new exception forwarding the exception message and source location to plssvm::exception.
+     * @param[in] msg the exception's `what()` message
+     * @param[in] loc the exception's call side information
+     */
+    explicit operation_cancelled_exception(const std::string &msg, source_location loc = source_location::current());
+};
+
 }  // namespace plssvm
 
 #endif  // PLSSVM_EXCEPTIONS_EXCEPTIONS_HPP_
\ No newline at end of file
@@ -6,14 +6,19 @@
  * @license This file is part of the PLSSVM project which is released under the MIT license.
  *          See the LICENSE.md file in the project root for full license information.
  *
- * @brief Defines an enumeration holding all supported file formats.
+ * @brief Defines an enumeration holding all supported file formats and the options used to read them.
  */
 
 #ifndef PLSSVM_FILE_FORMAT_TYPES_HPP_
 #define PLSSVM_FILE_FORMAT_TYPES_HPP_
 #pragma once
 
-#include <iosfwd>  // forward declare std::ostream and std::istream
+#include "plssvm/sampling_types.hpp"  // plssvm::sampling_type
+
+#include <cstddef>                    // std::size_t
+#include <iosfwd>                     // forward declare std::ostream and std::istream
+#include <optional>                   // std::optional
+#include <vector>                     // std::vector
 
 namespace plssvm {
 
@@ -24,7 +29,38 @@ enum class file_format_type {
     /** The LIBSVM file format. Used as default. For the file format specification see: https://www.csie.ntu.edu.tw/~cjlin/libsvm/faq.html */
     libsvm,
     /** The ARFF file format. For the file format specification see: https://www.cs.waikato.ac.nz/~ml/weka/arff.html */
-    arff
+    arff,
+    /** The versioned PLSSVM binary file format. Can be read without parsing any text. For the file format specification see plssvm::detail::io::parse_binary_data. */
+    binary,
+    /** The dense CSV file format. The delimiter, header, and label column can be configured using plssvm::csv_options. */
+    csv,
+    /** The NumPy `.npy` file format storing a two-dimensional array. Can be read without parsing any text. For the file format specification see: https://numpy.org/doc/stable/reference/generated/numpy.lib.format.html */
+    npy
+};
+
+/**
+ * @brief The options used to read a CSV file. The label column is also used to read a NumPy `.npy` file.
+ */
+struct csv_options {
+    /// The character separating the values in one line.
+    char delimiter{ ',' };
+    /// `true` if the first line is a header that must be skipped.
+    bool has_header{ false };
+    /// The column containing the labels; negative values count from the last column, i.e., `-1` (default) denotes the last column. If empty, the file contains no labels.
+    std::optional<long long> label_column{ -1 };
+};
+
+/**
+ * @brief The options used to read only a subset of a data set file, i.e., only some of the features of a random sample of the data points.
+ * @details For the LIBSVM and ARFF formats, the values of all other features are skipped while parsing and only the sampled data points are parsed at all.
+ */
+struct subset_options {
+    /// The zero-based indices of the features to keep; the kept features retain their relative order. If empty, all features are kept.
+    std::vector<std::size_t> features{};
+    /// The number of data points to randomly sample without replacement. If `0` or not smaller than the number of data points, all data points are kept.
+    std::size_t num_samples{ 0 };
+    /// The strategy used to draw the random sample of the data points.
+    sampling_type sampling{ sampling_type::uniform };
 };
 
 /**
@@ -43,6 +79,14 @@ std::ostream &operator<<(std::ostream &out, file_format_type format);
  */
 std::istream &operator>>(std::istream &in, file_format_type &format);
 
+/**
+ * @brief Output the @p subset to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the subset options to
+ * @param[in] subset the subset options
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const subset_options &subset);
+
 }  // namespace plssvm
 
 #endif  // PLSSVM_FILE_FORMAT_TYPES_HPP_
\ No newline at end of file
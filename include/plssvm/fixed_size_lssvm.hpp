@@ -0,0 +1,335 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements an approximate fixed-size LS-SVM using the Nyström method for very large data sets.
+ */
+
+#ifndef PLSSVM_FIXED_SIZE_LSSVM_HPP_
+#define PLSSVM_FIXED_SIZE_LSSVM_HPP_
+#pragma once
+
+#include "plssvm/data_set.hpp"                    // plssvm::data_set
+#include "plssvm/detail/cholesky.hpp"             // plssvm::detail::solve_cholesky
+#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/operators.hpp"            // plssvm::operators::squared_euclidean_dist
+#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry
+#include "plssvm/detail/primal_system.hpp"        // plssvm::detail::{assemble_primal_system, primal_system_block_size}
+#include "plssvm/detail/utility.hpp"              // plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"       // plssvm::invalid_parameter_exception, plssvm::exception
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type, plssvm::kernel_function
+#include "plssvm/landmark_selection_types.hpp"    // plssvm::landmark_selection_type
+#include "plssvm/model.hpp"                       // plssvm::model
+#include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::parameter
+
+#include "fmt/chrono.h"                           // directly print std::chrono literals with fmt
+#include "fmt/core.h"                             // fmt::format
+#include "fmt/ostream.h"                          // can use fmt using operator<< overloads
+
+#include <algorithm>                              // std::sample, std::sort, std::find, std::none_of, std::min
+#include <chrono>                                 // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
+#include <cstddef>                                // std::size_t
+#include <iterator>                               // std::back_inserter
+#include <limits>                                 // std::numeric_limits
+#include <numeric>                                // std::iota
+#include <random>                                 // std::mt19937, std::uniform_int_distribution, std::uniform_real_distribution
+#include <utility>                                // std::move
+#include <vector>                                 // std::vector
+
+namespace plssvm {
+
+/**
+ * @brief Approximately fits an LS-SVM using only a fixed number of landmark data points (fixed-size LS-SVM).
+ * @details The kernel matrix is approximated using the Nyström method `K ~ K_nm * K_mm^-1 * K_mn` based on `m` selected landmark points.
+ *          Instead of the `n`-dimensional dual system, the `(m + 1)`-dimensional primal system
+ *          `[K_mm / C + K_mn * K_nm, K_mn * 1; 1^T * K_nm, n] * [beta; b] = [K_mn * y; 1^T * y]` is solved directly.
+ *          The `n x m` feature map `K_nm` is never stored completely but processed block-wise, i.e., the memory consumption is quadratic in `m`
+ *          and independent of the number of data points `n`.
+ *          The resulting plssvm::model uses the landmarks as support vectors with the weights `beta` and can be used by all backends unchanged.
+ * @note The landmark selection uses a fixed seed such that the results are reproducible.
+ */
+class fixed_size_lssvm {
+  public:
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Create a new fixed-size LS-SVM.
+     * @param[in] params the SVM parameter
+     * @param[in] num_landmarks the number of landmark data points, i.e., the number of support vectors in the resulting model
+     * @param[in] selection the strategy used to select the landmark data points
+     * @throws plssvm::invalid_parameter_exception if the kernel function is invalid
+     * @throws plssvm::invalid_parameter_exception if @p num_landmarks is less than two
+     */
+    explicit fixed_size_lssvm(parameter params = {}, size_type num_landmarks = 1000, landmark_selection_type selection = landmark_selection_type::uniform);
+
+    /**
+     * @brief Return the SVM parameter.
+     * @return the SVM parameter (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const parameter &get_params() const noexcept { return params_; }
+    /**
+     * @brief Return the number of landmark data points.
+     * @return the number of landmarks (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_landmarks() const noexcept { return num_landmarks_; }
+    /**
+     * @brief Return the strategy used to select the landmark data points.
+     * @return the landmark selection strategy (`[[nodiscard]]`)
+     */
+    [[nodiscard]] landmark_selection_type landmark_selection() const noexcept { return selection_; }
+
+    /**
+     * @brief Approximately fit a model on the @p data using the landmark data points.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @param[in] data the data used to train the SVM model
+     * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if the training @p data contains less data points than landmarks should be selected
+     * @throws plssvm::exception if the primal system of linear equations couldn't be solved
+     * @return the learned model with the landmarks as support vectors (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type>
+    [[nodiscard]] model<real_type, label_type> fit(const data_set<real_type, label_type> &data) const;
+
+  private:
+    /**
+     * @brief Select the landmark data points from @p data using the landmark selection strategy.
+     * @details Makes sure that data points of both classes are present in the landmarks.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @param[in] params the SVM parameter (used in the entropy based selection)
+     * @param[in] data the data to select the landmarks from
+     * @return the indices of the selected landmarks sorted ascending (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type>
+    [[nodiscard]] std::vector<size_type> select_landmarks(const detail::parameter<real_type> &params, const data_set<real_type, label_type> &data) const;
+
+    /// The SVM parameter.
+    parameter params_{};
+    /// The number of landmark data points.
+    size_type num_landmarks_{ 1000 };
+    /// The strategy used to select the landmark data points.
+    landmark_selection_type selection_{ landmark_selection_type::uniform };
+};
+
+inline fixed_size_lssvm::fixed_size_lssvm(parameter params, const size_type num_landmarks, const landmark_selection_type selection) :
+    params_{ params }, num_landmarks_{ num_landmarks }, selection_{ selection } {
+    // kernel: valid kernel function
+    if (params_.kernel_type != kernel_function_type::linear && params_.kernel_type != kernel_function_type::polynomial && params_.kernel_type != kernel_function_type::rbf) {
+        throw invalid_parameter_exception{ fmt::format("Invalid kernel function {} given!", detail::to_underlying(params_.kernel_type)) };
+    }
+    // num_landmarks: at least one landmark per class is necessary
+    if (num_landmarks_ < 2) {
+        throw invalid_parameter_exception{ fmt::format("The number of landmarks must be at least 2, but is {}!", num_landmarks_) };
+    }
+    // selection: valid landmark selection strategy
+    if (selection_ != landmark_selection_type::uniform && selection_ != landmark_selection_type::kmeans_pp && selection_ != landmark_selection_type::entropy) {
+        throw invalid_parameter_exception{ fmt::format("Invalid landmark selection type {} given!", detail::to_underlying(selection_)) };
+    }
+}
+
+template <typename real_type, typename label_type>
+model<real_type, label_type> fixed_size_lssvm::fit(const data_set<real_type, label_type> &data) const {
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    }
+    if (data.num_data_points() < num_landmarks_) {
+        throw invalid_parameter_exception{ fmt::format("The number of landmarks ({}) must not be greater than the number of data points ({})!", num_landmarks_, data.num_data_points()) };
+    }
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    parameter params{ params_ };
+    if (params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        params.gamma = 1.0 / data.num_features();
+    }
+    const auto real_params = static_cast<detail::parameter<real_type>>(params);
+
+    const std::vector<std::vector<real_type>> &X = data.data();
+    const std::vector<real_type> &y = *data.y_ptr_;
+    const size_type num_data_points = data.num_data_points();
+    const size_type num_features = data.num_features();
+    const size_type m = num_landmarks_;
+    const size_type dim = m + 1;
+
+    // select the landmark data points
+    const std::vector<size_type> landmarks = this->select_landmarks(real_params, data);
+
+    const std::chrono::time_point selection_end_time = std::chrono::steady_clock::now();
+
+    // assemble the primal system without storing the complete n x m kernel matrix
+    std::vector<double> A{};
+    std::vector<double> b{};
+    detail::assemble_primal_system(X, landmarks, y, real_params, params.cost.value(), A, b);
+
+    const std::chrono::time_point feature_map_end_time = std::chrono::steady_clock::now();
+
+    // solve the (m + 1)-dimensional primal system
+    if (!detail::solve_cholesky(A, b)) {
+        throw exception{ "Couldn't solve the primal system of the fixed-size LS-SVM! Maybe try less landmarks?" };
+    }
+
+    const std::chrono::time_point solve_end_time = std::chrono::steady_clock::now();
+
+    // create the model using the landmarks as support vectors
+    const std::vector<label_type> &labels = data.labels().value();
+    std::vector<std::vector<real_type>> support_vectors(m);
+    std::vector<label_type> support_vector_labels(m);
+    std::vector<real_type> beta(m);
+    for (size_type j = 0; j < m; ++j) {
+        support_vectors[j] = X[landmarks[j]];
+        support_vector_labels[j] = labels[landmarks[j]];
+        beta[j] = static_cast<real_type>(b[j]);
+    }
+    model<real_type, label_type> approximate_model{ params, data_set<real_type, label_type>{ std::move(support_vectors), std::move(support_vector_labels) } };
+    *approximate_model.alpha_ptr_ = std::move(beta);
+    // f(x) = sum_j beta_j * k(x, l_j) + b = sum_j alpha_j * k(x, l_j) - rho
+    approximate_model.rho_ = static_cast<real_type>(-b[m]);
+
+    // compare the resource usage with the exact training using an explicit kernel matrix
+    const size_type block_size = std::min(num_data_points, detail::primal_system_block_size);
+    const size_type memory = (2 * dim * dim + dim) * sizeof(double) + (block_size + num_features) * m * sizeof(real_type);
+    const size_type exact_memory = num_data_points * num_data_points * sizeof(real_type);
+    const size_type flops = num_data_points * m * (2 * num_features + m + 3) + m * m * num_features + dim * dim * dim / 3;
+    const size_type exact_flops_per_iteration = num_data_points * num_data_points * (2 * num_features + 2);
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Selected {} {} landmarks out of {} data points in {}, built the feature map in {}, and solved the primal system in {}.\n",
+                detail::tracking_entry{ "fixed_size_lssvm", "num_landmarks", m },
+                detail::tracking_entry{ "fixed_size_lssvm", "landmark_selection", selection_ },
+                detail::tracking_entry{ "fixed_size_lssvm", "num_data_points", num_data_points },
+                detail::tracking_entry{ "fixed_size_lssvm", "landmark_selection_time", std::chrono::duration_cast<std::chrono::milliseconds>(selection_end_time - start_time) },
+                detail::tracking_entry{ "fixed_size_lssvm", "feature_map_time", std::chrono::duration_cast<std::chrono::milliseconds>(feature_map_end_time - selection_end_time) },
+                detail::tracking_entry{ "fixed_size_lssvm", "solve_time", std::chrono::duration_cast<std::chrono::milliseconds>(solve_end_time - feature_map_end_time) });
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Used {} bytes and {} FLOPs in {} (an explicit exact kernel matrix needs {} bytes and each exact CG iteration {} FLOPs).\n",
+                detail::tracking_entry{ "fixed_size_lssvm", "memory", memory },
+                detail::tracking_entry{ "fixed_size_lssvm", "flops", flops },
+                detail::tracking_entry{ "fixed_size_lssvm", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
+                detail::tracking_entry{ "fixed_size_lssvm", "exact_kernel_matrix_memory", exact_memory },
+                detail::tracking_entry{ "fixed_size_lssvm", "exact_flops_per_cg_iteration", exact_flops_per_iteration });
+
+    return approximate_model;
+}
+
+template <typename real_type, typename label_type>
+std::vector<fixed_size_lssvm::size_type> fixed_size_lssvm::select_landmarks(const detail::parameter<real_type> &params, const data_set<real_type, label_type> &data) const {
+    using namespace plssvm::operators;
+
+    const std::vector<std::vector<real_type>> &X = data.data();
+    const std::vector<real_type> &y = *data.y_ptr_;
+    const size_type num_data_points = data.num_data_points();
+    const size_type m = num_landmarks_;
+
+    std::mt19937 generator{ 42 };
+    std::vector<size_type> landmarks;
+    landmarks.reserve(m);
+
+    switch (selection_) {
+        case landmark_selection_type::uniform:
+        case landmark_selection_type::entropy: {
+            // select the landmarks uniformly at random; also used as initial guess for the entropy based selection
+            std::vector<size_type> indices(num_data_points);
+            std::iota(indices.begin(), indices.end(), size_type{ 0 });
+            std::sample(indices.cbegin(), indices.cend(), std::back_inserter(landmarks), m, generator);
+        } break;
+        case landmark_selection_type::kmeans_pp: {
+            // the first landmark is selected uniformly at random
+            landmarks.push_back(std::uniform_int_distribution<size_type>{ 0, num_data_points - 1 }(generator));
+            // the squared distance of each data point to its closest landmark
+            std::vector<real_type> min_dist(num_data_points, std::numeric_limits<real_type>::max());
+            while (landmarks.size() < m) {
+                const size_type last = landmarks.back();
+                real_type dist_sum{ 0.0 };
+                #pragma omp parallel for reduction(+ : dist_sum) default(none) shared(X, min_dist) firstprivate(num_data_points, last)
+                for (size_type i = 0; i < num_data_points; ++i) {
+                    min_dist[i] = std::min(min_dist[i], squared_euclidean_dist(X[i], X[last]));
+                    dist_sum += min_dist[i];
+                }
+                if (dist_sum <= real_type{ 0.0 }) {
+                    // all data points are already covered (duplicated data points) -> continue with an arbitrary data point not yet selected
+                    for (size_type i = 0; landmarks.size() < m; ++i) {
+                        if (std::find(landmarks.cbegin(), landmarks.cend(), i) == landmarks.cend()) {
+                            landmarks.push_back(i);
+                        }
+                    }
+                    break;
+                }
+                // select the next landmark with a probability proportional to its squared distance to the closest landmark
+                real_type threshold = std::uniform_real_distribution<real_type>{ 0.0, dist_sum }(generator);
+                size_type next = 0;
+                for (; next < num_data_points - 1; ++next) {
+                    threshold -= min_dist[next];
+                    if (threshold < real_type{ 0.0 } && min_dist[next] > real_type{ 0.0 }) {
+                        break;
+                    }
+                }
+                landmarks.push_back(next);
+            }
+        } break;
+    }
+
+    if (selection_ == landmark_selection_type::entropy) {
+        // maximize the quadratic Rényi entropy -log(1/m^2 * sum_ij K_ij) of the landmarks by minimizing the sum of the landmark kernel matrix;
+        // randomly swap a landmark with a data point not yet selected and keep the swap if it improves the entropy
+        std::vector<bool> is_landmark(num_data_points, false);
+        for (const size_type idx : landmarks) {
+            is_landmark[idx] = true;
+        }
+        std::vector<real_type> candidate_row(m);
+        std::vector<real_type> landmark_row(m);
+        std::uniform_int_distribution<size_type> landmark_dist{ 0, m - 1 };
+        std::uniform_int_distribution<size_type> data_point_dist{ 0, num_data_points - 1 };
+        const size_type num_trials = 10 * m;
+        for (size_type trial = 0; trial < num_trials && m < num_data_points; ++trial) {
+            const size_type position = landmark_dist(generator);
+            size_type candidate = data_point_dist(generator);
+            while (is_landmark[candidate]) {
+                candidate = data_point_dist(generator);
+            }
+            // change of the kernel matrix sum if the landmark at position is replaced by the candidate (the diagonal is counted once, the rest twice)
+            real_type delta{ 0.0 };
+            #pragma omp parallel for reduction(+ : delta) default(none) shared(X, landmarks, params) firstprivate(m, position, candidate)
+            for (size_type j = 0; j < m; ++j) {
+                if (j != position) {
+                    delta += 2 * (kernel_function(X[candidate], X[landmarks[j]], params) - kernel_function(X[landmarks[position]], X[landmarks[j]], params));
+                }
+            }
+            delta += kernel_function(X[candidate], X[candidate], params) - kernel_function(X[landmarks[position]], X[landmarks[position]], params);
+            if (delta < real_type{ 0.0 }) {
+                is_landmark[landmarks[position]] = false;
+                is_landmark[candidate] = true;
+                landmarks[position] = candidate;
+            }
+        }
+    }
+
+    // make sure both classes are represented in the landmarks; otherwise, the model's label mapping would be incomplete
+    for (const real_type mapped_label : { real_type{ -1.0 }, real_type{ 1.0 } }) {
+        const auto has_label = [&](const size_type idx) { return y[idx] == mapped_label; };
+        if (std::none_of(landmarks.cbegin(), landmarks.cend(), has_label)) {
+            // replace the landmark at a random position with the first data point of the missing class
+            size_type idx = 0;
+            while (!has_label(idx)) {
+                ++idx;
+            }
+            // since one class is missing, all landmarks belong to the other class, i.e., at least two landmarks of the other class remain
+            landmarks[std::uniform_int_distribution<size_type>{ 0, m - 1 }(generator)] = idx;
+        }
+    }
+
+    // sort the landmarks for a better memory locality
+    std::sort(landmarks.begin(), landmarks.end());
+    return landmarks;
+}
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_FIXED_SIZE_LSSVM_HPP_
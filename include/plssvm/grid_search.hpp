@@ -0,0 +1,444 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a grid search over the `gamma` and `cost` SVM parameters reusing the pairwise distances between all data points.
+ */
+
+#ifndef PLSSVM_GRID_SEARCH_HPP_
+#define PLSSVM_GRID_SEARCH_HPP_
+#pragma once
+
+#include "plssvm/data_set.hpp"                     // plssvm::data_set
+#include "plssvm/detail/assert.hpp"                // PLSSVM_ASSERT
+#include "plssvm/detail/kernel_matrix.hpp"         // plssvm::detail::{compute_base_matrix, apply_kernel_function, solve_reduced_system_of_linear_equations, calculate_reduced_rho}
+#include "plssvm/detail/logger.hpp"                // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/operators.hpp"             // plssvm::operators::{sign, sum}
+#include "plssvm/detail/performance_tracker.hpp"   // plssvm::detail::tracking_entry
+#include "plssvm/detail/termination_criteria.hpp"  // plssvm::detail::parse_termination_criteria
+#include "plssvm/detail/type_traits.hpp"           // PLSSVM_REQUIRES
+#include "plssvm/detail/utility.hpp"               // plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
+#include "plssvm/model.hpp"                        // plssvm::model
+#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::{epsilon, max_iter}, plssvm::detail::has_only_named_args_v
+
+#include "fmt/chrono.h"                            // directly print std::chrono literals with fmt
+#include "fmt/core.h"                              // fmt::format
+#include "fmt/ostream.h"                           // can use fmt using operator<< overloads
+#include "igor/igor.hpp"                           // igor::has_other_than
+
+#include <algorithm>                               // std::sort, std::stable_sort, std::unique
+#include <chrono>                                  // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
+#include <cmath>                                   // std::fma
+#include <cstddef>                                 // std::size_t
+#include <ostream>                                 // std::ostream
+#include <type_traits>                             // std::enable_if_t
+#include <utility>                                 // std::move, std::forward
+#include <vector>                                  // std::vector
+
+namespace plssvm {
+
+/**
+ * @brief One evaluated point of a grid search, i.e., the used SVM parameter together with the achieved accuracy.
+ * @tparam T the floating point type of the data (must either be `float` or `double`)
+ */
+template <typename T>
+struct grid_search_entry {
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+
+    /// The SVM parameter (most notably `gamma` and `cost`) used for this grid point.
+    parameter params{};
+    /// The accuracy achieved on the scoring data set using the SVM parameter @p params.
+    real_type accuracy{ 0.0 };
+    /// The number of CG iterations necessary to fit the model.
+    unsigned long long num_iterations{ 0 };
+    /// The time necessary to fit and score the model (excluding the shared distance computations).
+    std::chrono::milliseconds runtime{};
+};
+
+/**
+ * @brief The result of a plssvm::grid_search: the ranking of all evaluated grid points together with the best learned model.
+ * @tparam T the floating point type of the data (must either be `float` or `double`)
+ * @tparam U the type of the used labels (must be an arithmetic type or `std:string`; default: `int`)
+ */
+template <typename T, typename U = int>
+class grid_search_result {
+    // plssvm::grid_search needs the private constructor
+    friend class grid_search;
+
+  public:
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+    /// The type of the labels: any arithmetic type or `std::string`.
+    using label_type = U;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Return all evaluated grid points ordered by their accuracy (best first).
+     * @details Grid points with the same accuracy retain the order in which they have been evaluated.
+     * @return the ranking (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<grid_search_entry<real_type>> &ranking() const noexcept { return ranking_; }
+    /**
+     * @brief Return the best grid point, i.e., the first entry in the ranking.
+     * @return the best grid point (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const grid_search_entry<real_type> &best() const noexcept {
+        PLSSVM_ASSERT(!ranking_.empty(), "The ranking may never be empty!");
+        return ranking_.front();
+    }
+    /**
+     * @brief Return the model learned using the SVM parameter of the best grid point.
+     * @return the best model (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const model<real_type, label_type> &best_model() const noexcept { return best_model_; }
+
+  private:
+    /**
+     * @brief Create a new grid search result.
+     * @param[in] ranking the ranked grid points
+     * @param[in] best_model the model learned using the best grid point
+     */
+    grid_search_result(std::vector<grid_search_entry<real_type>> ranking, model<real_type, label_type> best_model) :
+        ranking_{ std::move(ranking) }, best_model_{ std::move(best_model) } {}
+
+    /// All evaluated grid points ordered by their accuracy.
+    std::vector<grid_search_entry<real_type>> ranking_{};
+    /// The model learned using the best grid point.
+    model<real_type, label_type> best_model_;
+};
+
+/**
+ * @brief Output the ranking stored in @p result as table to the given output-stream @p out.
+ * @tparam T the floating point type of the data
+ * @tparam U the type of the used labels
+ * @param[in,out] out the output-stream to write the ranking to
+ * @param[in] result the grid search result
+ * @return the output-stream
+ */
+template <typename T, typename U>
+std::ostream &operator<<(std::ostream &out, const grid_search_result<T, U> &result) {
+    out << fmt::format("{:>5} {:>14} {:>14} {:>10} {:>10} {:>10}\n", "rank", "gamma", "cost", "accuracy", "iter", "time");
+    for (typename std::vector<grid_search_entry<T>>::size_type i = 0; i < result.ranking().size(); ++i) {
+        const grid_search_entry<T> &entry = result.ranking()[i];
+        out << fmt::format("{:>5} {:>14.6g} {:>14.6g} {:>9.2f}% {:>10} {:>10}\n",
+                           i + 1,
+                           entry.params.gamma.value(),
+                           entry.params.cost.value(),
+                           entry.accuracy * 100,
+                           entry.num_iterations,
+                           entry.runtime);
+    }
+    return out;
+}
+
+/**
+ * @brief Performs a grid search over the `gamma` and `cost` SVM parameters.
+ * @details Instead of fitting each grid point from scratch, the pairwise squared distances (rbf kernel) or inner products (linear and polynomial kernel)
+ *          between all data points are computed exactly once. The kernel matrix for each `gamma` value is derived from them using element-wise
+ *          operations only (e.g., `exp(-gamma * dist)`). Since the `cost` parameter only changes the diagonal of the kernel matrix, all `cost`
+ *          values for the same `gamma` share one kernel matrix and are fitted back-to-back using the previous solution as warm start for the CG algorithm.
+ * @note The kernel matrix is stored explicitly, i.e., the memory consumption is quadratic in the number of training data points.
+ */
+class grid_search {
+  public:
+    /**
+     * @brief Create a new grid search.
+     * @details The kernel function and its `degree` and `coef0` parameters are taken from @p params. If @p gamma_values (@p cost_values) are empty,
+     *          the `gamma` (`cost`) value of @p params is used.
+     * @param[in] params the SVM parameter used for all grid points
+     * @param[in] gamma_values the `gamma` values to test
+     * @param[in] cost_values the `cost` values to test
+     * @throws plssvm::invalid_parameter_exception if the kernel function is invalid
+     * @throws plssvm::invalid_parameter_exception if any of the @p gamma_values is **not** greater than zero
+     * @throws plssvm::invalid_parameter_exception if any of the @p cost_values is **not** greater than zero
+     * @throws plssvm::invalid_parameter_exception if more than one `gamma` value has been provided for the linear kernel function
+     */
+    explicit grid_search(parameter params = {}, std::vector<double> gamma_values = {}, std::vector<double> cost_values = {});
+
+    /**
+     * @brief Return the SVM parameter used for all grid points.
+     * @return the SVM parameter (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const parameter &get_params() const noexcept { return params_; }
+    /**
+     * @brief Return the `gamma` values that are tested.
+     * @return the `gamma` values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<double> &gamma_values() const noexcept { return gamma_values_; }
+    /**
+     * @brief Return the `cost` values that are tested.
+     * @return the `cost` values (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<double> &cost_values() const noexcept { return cost_values_; }
+
+    /**
+     * @brief Fit a model for each grid point on the @p data and rank them by their accuracy on the same @p data.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the data used to train the SVM models
+     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided maximum number of iterations is zero
+     * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
+     * @return the ranking of the grid points together with the best model (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args, PLSSVM_REQUIRES(detail::has_only_named_args_v<Args...>)>
+    [[nodiscard]] grid_search_result<real_type, label_type> fit(const data_set<real_type, label_type> &data, Args &&...named_args) const;
+    /**
+     * @brief Fit a model for each grid point on the @p data and rank them by their accuracy on the @p validation_data.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the data used to train the SVM models
+     * @param[in] validation_data the data used to score the SVM models
+     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided maximum number of iterations is zero
+     * @throws plssvm::invalid_parameter_exception if the training @p data or the @p validation_data do **not** include labels
+     * @throws plssvm::invalid_parameter_exception if the number of features in @p data and @p validation_data mismatch
+     * @return the ranking of the grid points together with the best model (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] grid_search_result<real_type, label_type> fit(const data_set<real_type, label_type> &data, const data_set<real_type, label_type> &validation_data, Args &&...named_args) const;
+
+  private:
+    /**
+     * @brief Parse the named parameters @p named_args and return the values for `epsilon` and `max_iter`.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] num_data_points the number of training data points used as default value for `max_iter`
+     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided maximum number of iterations is zero
+     * @return the `epsilon` and `max_iter` values (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename... Args>
+    [[nodiscard]] static std::pair<real_type, unsigned long long> parse_named_args(std::size_t num_data_points, Args &&...named_args);
+
+    /**
+     * @brief Perform the grid search on @p data scoring each grid point using @p validation_data.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @param[in] data the data used to train the SVM models
+     * @param[in] validation_data the data used to score the SVM models
+     * @param[in] eps the relative error tolerance of the CG algorithm
+     * @param[in] max_iter the maximum number of CG iterations
+     * @return the ranking of the grid points together with the best model (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type>
+    [[nodiscard]] grid_search_result<real_type, label_type> fit_impl(const data_set<real_type, label_type> &data, const data_set<real_type, label_type> &validation_data, real_type eps, unsigned long long max_iter) const;
+
+    /// The SVM parameter (kernel function, `degree`, and `coef0`) used for all grid points.
+    parameter params_{};
+    /// The `gamma` values to test.
+    std::vector<double> gamma_values_{};
+    /// The `cost` values to test.
+    std::vector<double> cost_values_{};
+};
+
+inline grid_search::grid_search(parameter params, std::vector<double> gamma_values, std::vector<double> cost_values) :
+    params_{ params }, gamma_values_{ std::move(gamma_values) }, cost_values_{ std::move(cost_values) } {
+    // kernel: valid kernel function
+    if (params_.kernel_type != kernel_function_type::linear && params_.kernel_type != kernel_function_type::polynomial && params_.kernel_type != kernel_function_type::rbf) {
+        throw invalid_parameter_exception{ fmt::format("Invalid kernel function {} given!", detail::to_underlying(params_.kernel_type)) };
+    }
+    // gamma: must be greater than 0 and may only be used for the polynomial and rbf kernel
+    for (const double gamma_value : gamma_values_) {
+        if (gamma_value <= 0.0) {
+            throw invalid_parameter_exception{ fmt::format("All gamma values must be greater than 0.0, but {} is not!", gamma_value) };
+        }
+    }
+    if (params_.kernel_type == kernel_function_type::linear && gamma_values_.size() > 1) {
+        throw invalid_parameter_exception{ fmt::format("The linear kernel doesn't use gamma, but {} gamma values were provided!", gamma_values_.size()) };
+    }
+    // cost: must be greater than 0
+    for (const double cost_value : cost_values_) {
+        if (cost_value <= 0.0) {
+            throw invalid_parameter_exception{ fmt::format("All cost values must be greater than 0.0, but {} is not!", cost_value) };
+        }
+    }
+
+    // remove duplicated values; sort the cost values ascending to improve the warm starts
+    std::sort(gamma_values_.begin(), gamma_values_.end());
+    gamma_values_.erase(std::unique(gamma_values_.begin(), gamma_values_.end()), gamma_values_.end());
+    std::sort(cost_values_.begin(), cost_values_.end());
+    cost_values_.erase(std::unique(cost_values_.begin(), cost_values_.end()), cost_values_.end());
+}
+
+template <typename real_type, typename label_type, typename... Args, std::enable_if_t<detail::has_only_named_args_v<Args...>, bool>>
+grid_search_result<real_type, label_type> grid_search::fit(const data_set<real_type, label_type> &data, Args &&...named_args) const {
+    const auto [eps, max_iter] = parse_named_args<real_type>(data.num_data_points(), std::forward<Args>(named_args)...);
+
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    }
+
+    return this->fit_impl(data, data, eps, max_iter);
+}
+
+template <typename real_type, typename label_type, typename... Args>
+grid_search_result<real_type, label_type> grid_search::fit(const data_set<real_type, label_type> &data, const data_set<real_type, label_type> &validation_data, Args &&...named_args) const {
+    const auto [eps, max_iter] = parse_named_args<real_type>(data.num_data_points(), std::forward<Args>(named_args)...);
+
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
+    }
+    if (!validation_data.has_labels()) {
+        throw invalid_parameter_exception{ "The data set to score must have labels!" };
+    }
+    if (data.num_features() != validation_data.num_features()) {
+        throw invalid_parameter_exception{ fmt::format("Number of features per data point ({}) must match the number of features per training data point ({})!", validation_data.num_features(), data.num_features()) };
+    }
+
+    return this->fit_impl(data, validation_data, eps, max_iter);
+}
+
+template <typename real_type, typename... Args>
+std::pair<real_type, unsigned long long> grid_search::parse_named_args(const std::size_t num_data_points, Args &&...named_args) {
+    // compile time check: only some named parameters are allowed
+    static_assert(!igor::has_other_than<Args...>(epsilon, max_iter), "An illegal named parameter has been passed!");
+
+    return detail::parse_termination_criteria<real_type>(num_data_points, std::forward<Args>(named_args)...);
+}
+
+template <typename real_type, typename label_type>
+grid_search_result<real_type, label_type> grid_search::fit_impl(const data_set<real_type, label_type> &data, const data_set<real_type, label_type> &validation_data, const real_type eps, const unsigned long long max_iter) const {
+    using size_type = std::size_t;
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // determine the values to test
+    parameter params{ params_ };
+    if (params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        params.gamma = 1.0 / data.num_features();
+    }
+    const std::vector<double> gamma_values = gamma_values_.empty() ? std::vector<double>{ params.gamma.value() } : gamma_values_;
+    const std::vector<double> cost_values = cost_values_.empty() ? std::vector<double>{ params.cost.value() } : cost_values_;
+
+    const size_type num_data_points = data.num_data_points();
+    const size_type num_validation_points = validation_data.num_data_points();
+    const bool score_on_training_data = &data == &validation_data;
+
+    // compute the pairwise distances (or inner products) exactly once
+    const std::vector<real_type> base = detail::compute_base_matrix(params.kernel_type, data.data(), data.data());
+    const std::vector<real_type> validation_base = score_on_training_data ? std::vector<real_type>{} : detail::compute_base_matrix(params.kernel_type, validation_data.data(), data.data());
+
+    const std::chrono::time_point base_end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Computed the {}x{} {} matrix shared by all {} grid points in {}.\n",
+                num_data_points,
+                num_data_points,
+                params.kernel_type == kernel_function_type::rbf ? "squared distance" : "inner product",
+                detail::tracking_entry{ "grid_search", "num_grid_points", gamma_values.size() * cost_values.size() },
+                detail::tracking_entry{ "grid_search", "base_matrix_time", std::chrono::duration_cast<std::chrono::milliseconds>(base_end_time - start_time) });
+
+    const std::vector<label_type> &correct_labels = validation_data.labels().value();
+
+    std::vector<grid_search_entry<real_type>> ranking;
+    ranking.reserve(gamma_values.size() * cost_values.size());
+    std::vector<real_type> kernel_matrix(base.size());
+    std::vector<real_type> validation_kernel_matrix(validation_base.size());
+    // all training data points span the LS-SVM system
+    const std::vector<size_type> all_data_points{};
+
+    // the best model found so far
+    parameter best_params{};
+    std::vector<real_type> best_alpha{};
+    real_type best_rho{ 0.0 };
+    real_type best_accuracy{ -1.0 };
+
+    for (const double gamma_value : gamma_values) {
+        params.gamma = gamma_value;
+        const auto real_params = static_cast<detail::parameter<real_type>>(params);
+
+        // derive the kernel matrix for the current gamma value using element-wise operations only
+        detail::apply_kernel_function(real_params, base, kernel_matrix);
+        if (!score_on_training_data) {
+            detail::apply_kernel_function(real_params, validation_base, validation_kernel_matrix);
+        }
+        const std::vector<real_type> &scoring_kernel_matrix = score_on_training_data ? kernel_matrix : validation_kernel_matrix;
+
+        // the solution of the previous cost value is used as warm start for the next one
+        std::vector<real_type> alpha(num_data_points - 1, real_type{ 1.0 });
+
+        for (const double cost_value : cost_values) {
+            params.cost = cost_value;
+            const std::chrono::time_point fit_start_time = std::chrono::steady_clock::now();
+
+            // solve the reduced system of linear equations
+            const unsigned long long num_iterations = detail::solve_reduced_system_of_linear_equations(kernel_matrix, *data.y_ptr_, all_data_points, static_cast<real_type>(cost_value), eps, max_iter, alpha);
+
+            // calculate the bias (identical to the backend implementations)
+            const real_type rho = detail::calculate_reduced_rho(kernel_matrix, *data.y_ptr_, all_data_points, static_cast<real_type>(cost_value), alpha);
+            const real_type alpha_sum = plssvm::operators::sum(alpha);
+
+            // score the current model
+            size_type correct{ 0 };
+            #pragma omp parallel for reduction(+ : correct) default(none) shared(scoring_kernel_matrix, alpha, correct_labels, data) firstprivate(num_validation_points, num_data_points, alpha_sum, rho)
+            for (size_type point = 0; point < num_validation_points; ++point) {
+                const real_type *row = scoring_kernel_matrix.data() + point * num_data_points;
+                real_type temp{ -rho };
+                for (size_type sv = 0; sv < num_data_points - 1; ++sv) {
+                    temp = std::fma(alpha[sv], row[sv], temp);
+                }
+                temp = std::fma(-alpha_sum, row[num_data_points - 1], temp);
+                if (data.mapping_->get_label_by_mapped_value(plssvm::operators::sign(temp)) == correct_labels[point]) {
+                    ++correct;
+                }
+            }
+            const real_type accuracy = static_cast<real_type>(correct) / static_cast<real_type>(num_validation_points);
+
+            const std::chrono::time_point fit_end_time = std::chrono::steady_clock::now();
+            const auto fit_duration = std::chrono::duration_cast<std::chrono::milliseconds>(fit_end_time - fit_start_time);
+            detail::log(verbosity_level::full,
+                        "gamma = {}, cost = {}: accuracy = {:.2f}% after {} CG iterations in {}.\n",
+                        gamma_value,
+                        cost_value,
+                        accuracy * 100,
+                        num_iterations,
+                        fit_duration);
+            ranking.push_back(grid_search_entry<real_type>{ params, accuracy, num_iterations, fit_duration });
+
+            // remember the best model
+            if (accuracy > best_accuracy) {
+                best_accuracy = accuracy;
+                best_params = params;
+                best_alpha = alpha;
+                best_alpha.push_back(-alpha_sum);
+                best_rho = rho;
+            }
+        }
+    }
+
+    // rank the grid points by their accuracy; retain the evaluation order for equally well performing grid points
+    std::stable_sort(ranking.begin(), ranking.end(), [](const grid_search_entry<real_type> &lhs, const grid_search_entry<real_type> &rhs) { return lhs.accuracy > rhs.accuracy; });
+
+    // create the best model
+    model<real_type, label_type> best_model{ best_params, data };
+    *best_model.alpha_ptr_ = std::move(best_alpha);
+    best_model.rho_ = best_rho;
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Best grid point: gamma = {}, cost = {} with an accuracy of {}%. Total grid search time: {}.\n\n",
+                detail::tracking_entry{ "grid_search", "best_gamma", best_params.gamma.value() },
+                detail::tracking_entry{ "grid_search", "best_cost", best_params.cost.value() },
+                detail::tracking_entry{ "grid_search", "best_accuracy", best_accuracy * 100 },
+                detail::tracking_entry{ "grid_search", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return grid_search_result<real_type, label_type>{ std::move(ranking), std::move(best_model) };
+}
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_GRID_SEARCH_HPP_
@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an enumeration holding all supported strategies to select the landmark points of a fixed-size LS-SVM.
+ */
+
+#ifndef PLSSVM_LANDMARK_SELECTION_TYPES_HPP_
+#define PLSSVM_LANDMARK_SELECTION_TYPES_HPP_
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for all supported landmark selection strategies.
+ */
+enum class landmark_selection_type {
+    /** Select the landmarks uniformly at random. Used as default. */
+    uniform,
+    /** Select the landmarks using the k-means++ seeding, i.e., with a probability proportional to the squared distance to the already selected landmarks. */
+    kmeans_pp,
+    /** Select the landmarks maximizing the quadratic Rényi entropy of the landmark kernel matrix (as in the original fixed-size LS-SVM). */
+    entropy
+};
+
+/**
+ * @brief Output the @p selection to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the landmark selection type to
+ * @param[in] selection the landmark selection type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, landmark_selection_type selection);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p selection type.
+ * @param[in,out] in input-stream to extract the landmark selection type from
+ * @param[in] selection the landmark selection type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, landmark_selection_type &selection);
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_LANDMARK_SELECTION_TYPES_HPP_
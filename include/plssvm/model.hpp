@@ -15,10 +15,14 @@
 
 #include "plssvm/data_set.hpp"                        // plssvm::data_set
 #include "plssvm/detail/assert.hpp"                   // PLSSVM_ASSERT
+#include "plssvm/detail/io/binary_model_parsing.hpp"  // plssvm::detail::io::{parse_binary_model, write_binary_model_data}
+#include "plssvm/detail/io/compression.hpp"           // plssvm::detail::io::remove_compression_extension
+#include "plssvm/detail/io/file_reader.hpp"           // plssvm::detail::io::file_reader
 #include "plssvm/detail/io/libsvm_model_parsing.hpp"  // plssvm::detail::io::{parse_libsvm_model_header, write_libsvm_model_data}
 #include "plssvm/detail/io/libsvm_parsing.hpp"        // plssvm::detail::io::parse_libsvm_data
 #include "plssvm/detail/logger.hpp"                   // plssvm::detail::log, plssvm::verbosity_level
 #include "plssvm/detail/performance_tracker.hpp"      // plssvm::detail::tracking_entry
+#include "plssvm/detail/string_utility.hpp"           // plssvm::detail::ends_with
 #include "plssvm/detail/type_list.hpp"                // plssvm::detail::{real_type_list, label_type_list, type_list_contains_v}
 #include "plssvm/parameter.hpp"                       // plssvm::parameter
 
@@ -54,6 +58,12 @@ class model {
 
     // plssvm::csvm needs the private constructor
     friend class csvm;
+    // plssvm::grid_search needs the private constructor
+    friend class grid_search;
+    // plssvm::fixed_size_lssvm needs the private constructor
+    friend class fixed_size_lssvm;
+    // plssvm::support_vector_reduction needs the private constructor
+    friend class support_vector_reduction;
 
   public:
     /// The type of the data points: either `float` or `double`.
@@ -64,14 +74,17 @@ class model {
     using size_type = std::size_t;
 
     /**
-     * @brief Read a previously learned model from the LIBSVM model file @p filename.
+     * @brief Read a previously learned model from the model file @p filename.
+     * @details If @p filename ends with `.bin` the binary model format is used, otherwise the file is assumed to be a LIBSVM model file.
+     *          A trailing `.gz` or `.zst` extension denotes a compressed model file, which is decompressed transparently.
      * @param[in] filename the model file to read
-     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_libsvm_model_header and plssvm::detail::io::parse_libsvm_data
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_libsvm_model_header, plssvm::detail::io::parse_libsvm_data, and plssvm::detail::io::parse_binary_model
      */
     explicit model(const std::string &filename);
 
     /**
-     * @brief Save the model to a LIBSVM model file for later usage.
+     * @brief Save the model to a model file for later usage.
+     * @details If @p filename ends with `.bin` the binary model format is used (including the precomputed `w` vector in case of the linear kernel), otherwise a LIBSVM model file is written.
      * @param[in] filename the file to save the model to
      */
     void save(const std::string &filename) const;
@@ -170,21 +183,35 @@ template <typename T, typename U>
 model<T, U>::model(const std::string &filename) {
     const std::chrono::time_point start_time = std::chrono::steady_clock::now();
 
-    // open the file
-    detail::io::file_reader reader{ filename };
-    reader.read_lines('#');
-
-    // parse the libsvm model header
-    std::vector<label_type> labels{};
-    std::size_t num_header_lines{};
-    std::tie(params_, rho_, labels, num_header_lines) = detail::io::parse_libsvm_model_header<real_type, label_type, size_type>(reader.lines());
-
-    // create empty support vectors and alpha vector
+    // create empty support vectors, labels, and alpha vector
     std::vector<std::vector<real_type>> support_vectors;
+    std::vector<label_type> labels{};
     std::vector<real_type> alphas;
 
-    // parse libsvm model data
-    std::tie(num_support_vectors_, num_features_, support_vectors, alphas) = detail::io::parse_libsvm_data<real_type, real_type>(reader, num_header_lines);
+    // if the file doesn't end with .bin (ignoring a compression file extension), assume a LIBSVM model file
+    const bool is_binary = detail::ends_with(detail::io::remove_compression_extension(filename), ".bin");
+    if (is_binary) {
+        // open the file, the binary format isn't split into lines
+        const detail::io::file_reader reader{ filename };
+
+        // parse the binary model
+        std::vector<real_type> w{};
+        std::tie(params_, rho_, support_vectors, labels, alphas, w) = detail::io::parse_binary_model<real_type, label_type>(reader);
+        num_support_vectors_ = support_vectors.size();
+        num_features_ = support_vectors.front().size();
+        *w_ = std::move(w);
+    } else {
+        // open the file
+        detail::io::file_reader reader{ filename };
+        reader.read_lines('#');
+
+        // parse the libsvm model header
+        std::size_t num_header_lines{};
+        std::tie(params_, rho_, labels, num_header_lines) = detail::io::parse_libsvm_model_header<real_type, label_type, size_type>(reader.lines());
+
+        // parse libsvm model data
+        std::tie(num_support_vectors_, num_features_, support_vectors, alphas) = detail::io::parse_libsvm_data<real_type, real_type>(reader, num_header_lines);
+    }
 
     // create data set
     data_ = data_set<real_type, label_type>{ std::move(support_vectors), std::move(labels) };
@@ -192,10 +219,11 @@ model<T, U>::model(const std::string &filename) {
 
     const std::chrono::time_point end_time = std::chrono::steady_clock::now();
     detail::log(verbosity_level::full | verbosity_level::timing,
-                "Read {} support vectors with {} features in {} using the libsvm model parser from file '{}'.\n\n",
+                "Read {} support vectors with {} features in {} using the {} model parser from file '{}'.\n\n",
                 detail::tracking_entry{ "model_read", "num_support_vectors", num_support_vectors_ },
                 detail::tracking_entry{ "model_read", "num_features", num_features_ },
                 detail::tracking_entry{ "model_read", "time",  std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
+                detail::tracking_entry{ "model_read", "format", is_binary ? "binary" : "libsvm" },
                 detail::tracking_entry{ "model_read", "filename", filename });
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ "model_read", "rho", rho_ }));
 }
@@ -209,14 +237,21 @@ void model<T, U>::save(const std::string &filename) const {
     const std::chrono::time_point start_time = std::chrono::steady_clock::now();
 
     // save model file header and support vectors
-    detail::io::write_libsvm_model_data(filename, params_, rho_, *alpha_ptr_, data_);
+    // if the file doesn't end with .bin, write a LIBSVM model file
+    const bool is_binary = detail::ends_with(filename, ".bin");
+    if (is_binary) {
+        detail::io::write_binary_model_data(filename, params_, rho_, *alpha_ptr_, *w_, data_);
+    } else {
+        detail::io::write_libsvm_model_data(filename, params_, rho_, *alpha_ptr_, data_);
+    }
 
     const std::chrono::time_point end_time = std::chrono::steady_clock::now();
     detail::log(verbosity_level::full | verbosity_level::timing,
-                "Write {} support vectors with {} features in {} to the libsvm model file '{}'.\n",
+                "Write {} support vectors with {} features in {} to the {} model file '{}'.\n",
                 detail::tracking_entry{ "model_write", "num_support_vectors", num_support_vectors_ },
                 detail::tracking_entry{ "model_write", "num_features", num_features_ },
                 detail::tracking_entry{ "model_write", "time",  std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
+                detail::tracking_entry{ "model_write", "format", is_binary ? "binary" : "libsvm" },
                 detail::tracking_entry{ "model_write", "filename", filename });
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ "model_write", "rho", rho_ }));
 }
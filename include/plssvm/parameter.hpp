@@ -45,6 +45,32 @@ IGOR_MAKE_NAMED_ARGUMENT(cost);
 IGOR_MAKE_NAMED_ARGUMENT(epsilon);
 /// Create a named argument for the maximum number of iterations `max_iter` performed in the CG algorithm.
 IGOR_MAKE_NAMED_ARGUMENT(max_iter);
+/// Create a named argument for the number of random probing vectors `num_probes` used to estimate the leave-one-out residuals.
+IGOR_MAKE_NAMED_ARGUMENT(num_probes);
+/// Create a named argument for the number of partitions `num_partitions` used in the cascade training.
+IGOR_MAKE_NAMED_ARGUMENT(num_partitions);
+/// Create a named argument for the CG variant `solver` used to solve the system of linear equations.
+IGOR_MAKE_NAMED_ARGUMENT(solver);
+/// Create a named argument for the plssvm::solver_state `recycle` whose deflation vectors are recycled in the CG algorithm (passed as pointer).
+IGOR_MAKE_NAMED_ARGUMENT(recycle);
+/// Create a named argument for the file `checkpoint_file` the CG checkpoints are written to and resumed from.
+IGOR_MAKE_NAMED_ARGUMENT(checkpoint_file);
+/// Create a named argument for the number of CG iterations `checkpoint_interval` between two checkpoints (0 disables writing checkpoints).
+IGOR_MAKE_NAMED_ARGUMENT(checkpoint_interval);
+/// Create a named argument for `resume`, i.e., whether the CG should be continued from the checkpoint file (if present).
+IGOR_MAKE_NAMED_ARGUMENT(resume);
+/// Create a named argument for the `progress_callback` invoked with a plssvm::solver_progress after each CG iteration.
+IGOR_MAKE_NAMED_ARGUMENT(progress_callback);
+/// Create a named argument for the plssvm::cancellation_token `cancellation` used to stop the CG early (keeping the current iterate).
+IGOR_MAKE_NAMED_ARGUMENT(cancellation);
+/// Create a named argument for the fraction `prune_fraction` of the remaining data points removed in each round of the sparse LS-SVM training.
+IGOR_MAKE_NAMED_ARGUMENT(prune_fraction);
+/// Create a named argument for the maximum decrease of the training accuracy `max_accuracy_drop` tolerated in the sparse LS-SVM training.
+IGOR_MAKE_NAMED_ARGUMENT(max_accuracy_drop);
+/// Create a named argument for the OpenMP backend specific relative tolerance `hodlr_tolerance` used to compress the kernel matrix (0.0 disables the compression).
+IGOR_MAKE_NAMED_ARGUMENT(hodlr_tolerance);
+/// Create a named argument for the OpenMP backend specific value `rbf_cutoff` below which rbf kernel matrix entries are truncated (0.0 disables the truncation).
+IGOR_MAKE_NAMED_ARGUMENT(rbf_cutoff);
 /// Create a named argument for the SYCL backend specific SYCL implementation type (DPC++ or hipSYCL).
 IGOR_MAKE_NAMED_ARGUMENT(sycl_implementation_type);
 /// Create a named argument for the SYCL backend specific kernel invocation type (nd_range or hierarchical).
@@ -65,6 +91,12 @@ constexpr bool has_only_named_args_v = !igor::has_unnamed_arguments<Args...>();
 template <typename... Args>
 constexpr bool has_only_parameter_named_args_v = !igor::has_other_than<Args...>(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost);
 
+/**
+ * @brief Trait to check whether @p Args only contains named-parameter that can be used to initialize a `plssvm::parameter` struct including OpenMP specific named-parameters.
+ */
+template <typename... Args>
+constexpr bool has_only_openmp_parameter_named_args_v = !igor::has_other_than<Args...>(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::hodlr_tolerance, plssvm::rbf_cutoff);
+
 /**
  * @brief Trait to check whether @p Args only contains named-parameter that can be used to initialize a `plssvm::parameter` struct including SYCL specific named-parameters.
  */
@@ -221,7 +253,7 @@ struct parameter {
         // compile time check: each named parameter must only be passed once
         static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
         // compile time check: only some named parameters are allowed
-        static_assert(!parser.has_other_than(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::sycl_implementation_type, plssvm::sycl_kernel_invocation_type),
+        static_assert(!parser.has_other_than(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::hodlr_tolerance, plssvm::rbf_cutoff, plssvm::sycl_implementation_type, plssvm::sycl_kernel_invocation_type),
                       "An illegal named parameter has been passed!");
 
         // shorthand function for emitting a warning if a provided parameter is not used by the current kernel function
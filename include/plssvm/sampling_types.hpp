@@ -0,0 +1,48 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an enumeration holding all supported strategies to draw a random sample of the data points while reading a data set.
+ */
+
+#ifndef PLSSVM_SAMPLING_TYPES_HPP_
+#define PLSSVM_SAMPLING_TYPES_HPP_
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for all supported sampling strategies.
+ */
+enum class sampling_type {
+    /** Draw the data points uniformly at random. Used as default. */
+    uniform,
+    /** Draw the data points uniformly at random per class such that the class distribution of the sample matches the one of the whole data set. */
+    stratified
+};
+
+/**
+ * @brief Output the @p sampling to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the sampling type to
+ * @param[in] sampling the sampling type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, sampling_type sampling);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p sampling type.
+ * @param[in,out] in input-stream to extract the sampling type from
+ * @param[in] sampling the sampling type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, sampling_type &sampling);
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_SAMPLING_TYPES_HPP_
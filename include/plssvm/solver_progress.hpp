@@ -0,0 +1,56 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the progress information reported after each CG iteration.
+ */
+
+#ifndef PLSSVM_SOLVER_PROGRESS_HPP_
+#define PLSSVM_SOLVER_PROGRESS_HPP_
+#pragma once
+
+#include "fmt/chrono.h"  // format std::chrono types using fmt
+#include "fmt/core.h"    // fmt::format
+
+#include <chrono>        // std::chrono::milliseconds
+#include <functional>    // std::function
+#include <ostream>       // std::ostream
+
+namespace plssvm {
+
+/**
+ * @brief The progress of a running CG solve reported after each iteration.
+ */
+struct solver_progress {
+    /// The number of already performed CG iterations.
+    unsigned long long iteration{ 0 };
+    /// The maximum number of CG iterations.
+    unsigned long long max_iter{ 0 };
+    /// The current relative residual, i.e., \f$\|r\| / \|r_0\|\f$.
+    double residual{ 0.0 };
+    /// The relative residual at which the CG stops, i.e., the `epsilon` used in the training.
+    double target_residual{ 0.0 };
+    /// The time elapsed since the training has been started.
+    std::chrono::milliseconds elapsed{};
+};
+
+/// The type of the callback invoked after each CG iteration (passed to plssvm::csvm::fit using the `progress_callback` named parameter).
+using progress_callback_type = std::function<void(const solver_progress &)>;
+
+/**
+ * @brief Output the @p progress to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the progress to
+ * @param[in] progress the progress
+ * @return the output-stream
+ */
+inline std::ostream &operator<<(std::ostream &out, const solver_progress &progress) {
+    return out << fmt::format("iteration {}/{} with a relative residual of {} (target: {}) after {}", progress.iteration, progress.max_iter, progress.residual, progress.target_residual, progress.elapsed);
+}
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_SOLVER_PROGRESS_HPP_
@@ -0,0 +1,175 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a class storing the Krylov subspace information of a CG solve that can be recycled in subsequent, related solves.
+ */
+
+#ifndef PLSSVM_SOLVER_STATE_HPP_
+#define PLSSVM_SOLVER_STATE_HPP_
+#pragma once
+
+#include "plssvm/detail/io/file_reader.hpp"          // plssvm::detail::io::file_reader
+#include "plssvm/detail/io/solver_state_parsing.hpp"  // plssvm::detail::io::{parse_solver_state, write_solver_state}
+#include "plssvm/detail/logger.hpp"                   // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"      // plssvm::detail::tracking_entry
+#include "plssvm/detail/type_list.hpp"                // plssvm::detail::{real_type_list, type_list_contains_v}
+#include "plssvm/exceptions/exceptions.hpp"           // plssvm::invalid_parameter_exception
+
+#include "fmt/chrono.h"                               // format std::chrono types using fmt
+#include "fmt/core.h"                                 // fmt::format
+
+#include <chrono>                                     // std::chrono::{time_point, steady_clock, duration_cast, milliseconds}
+#include <cstddef>                                    // std::size_t
+#include <string>                                     // std::string
+#include <tuple>                                      // std::tie
+#include <vector>                                     // std::vector
+
+namespace plssvm {
+
+namespace detail {
+
+// forward declare the deflated CG helper class
+template <typename T>
+class deflated_cg;
+
+}  // namespace detail
+
+/**
+ * @brief Stores approximate eigenvectors of the (reduced) system matrix of a previous CG solve belonging to its smallest eigenvalues.
+ * @details If a solver state is passed to plssvm::csvm::fit using the `recycle` named parameter, its deflation vectors are removed from the Krylov subspace
+ *          of the next CG solve (deflated CG) and afterward updated using the first CG search directions of that solve (Rayleigh-Ritz).
+ *          Therefore, a sequence of related systems, e.g., retraining on slowly changing data or sweeping the hyper-parameters, needs fewer CG iterations.
+ *          The deflation vectors are only reused if the number of data points didn't change.
+ * @tparam T the floating point type of the data (must either be `float` or `double`)
+ */
+template <typename T>
+class solver_state {
+    // make sure only valid template types are used
+    static_assert(detail::type_list_contains_v<T, detail::real_type_list>, "Illegal real type provided! See the 'real_type_list' in the type_list.hpp header for a list of the allowed types.");
+
+    // the deflated CG algorithm updates the deflation vectors
+    friend class detail::deflated_cg<T>;
+
+  public:
+    /// The type of the data points: either `float` or `double`.
+    using real_type = T;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Create an empty solver state keeping at most @p max_vectors deflation vectors.
+     * @param[in] max_vectors the maximum number of deflation vectors
+     * @throws plssvm::invalid_parameter_exception if @p max_vectors is zero
+     */
+    explicit solver_state(size_type max_vectors = 8);
+    /**
+     * @brief Read a previously saved solver state from the file @p filename.
+     * @param[in] filename the solver state file to read
+     * @throws plssvm::invalid_file_format_exception all exceptions thrown by plssvm::detail::io::parse_solver_state
+     */
+    explicit solver_state(const std::string &filename);
+
+    /**
+     * @brief Save the solver state to the file @p filename for later usage.
+     * @param[in] filename the file to save the solver state to
+     */
+    void save(const std::string &filename) const;
+
+    /**
+     * @brief Return the maximum number of deflation vectors.
+     * @return the maximum number of deflation vectors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type max_vectors() const noexcept { return max_vectors_; }
+    /**
+     * @brief Return the number of currently stored deflation vectors.
+     * @return the number of deflation vectors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_vectors() const noexcept { return vectors_.size(); }
+    /**
+     * @brief Return the number of values in each deflation vector, i.e., the dimension of the reduced system of linear equations (`num_data_points - 1`).
+     * @return the number of rows (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_rows() const noexcept { return vectors_.empty() ? 0 : vectors_.front().size(); }
+    /**
+     * @brief Check whether no deflation vectors are currently stored.
+     * @return `true` if no deflation vectors are stored, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool empty() const noexcept { return vectors_.empty(); }
+    /**
+     * @brief Return the stored deflation vectors.
+     * @return the deflation vectors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<std::vector<real_type>> &deflation_vectors() const noexcept { return vectors_; }
+    /**
+     * @brief Return the number of CG iterations of the last solve using this solver state.
+     * @details Not saved to the solver state file.
+     * @return the number of CG iterations (`[[nodiscard]]`)
+     */
+    [[nodiscard]] unsigned long long last_num_iterations() const noexcept { return last_num_iterations_; }
+
+    /**
+     * @brief Remove all deflation vectors.
+     */
+    void clear() noexcept { vectors_.clear(); }
+
+  private:
+    /// The maximum number of deflation vectors.
+    size_type max_vectors_{ 8 };
+    /// The deflation vectors, i.e., approximate eigenvectors belonging to the smallest eigenvalues of the reduced system matrix.
+    std::vector<std::vector<real_type>> vectors_{};
+    /// The number of CG iterations of the last solve using this solver state.
+    unsigned long long last_num_iterations_{ 0 };
+};
+
+template <typename T>
+solver_state<T>::solver_state(const size_type max_vectors) :
+    max_vectors_{ max_vectors } {
+    if (max_vectors_ == 0) {
+        throw invalid_parameter_exception{ "The maximum number of deflation vectors must be greater than 0!" };
+    }
+}
+
+template <typename T>
+solver_state<T>::solver_state(const std::string &filename) {
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // open the file
+    detail::io::file_reader reader{ filename };
+    reader.read_lines('#');
+
+    // parse the solver state
+    std::tie(max_vectors_, vectors_) = detail::io::parse_solver_state<real_type>(reader);
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Read {} deflation vectors with {} values in {} from the solver state file '{}'.\n",
+                detail::tracking_entry{ "solver_state_read", "num_vectors", this->num_vectors() },
+                detail::tracking_entry{ "solver_state_read", "num_rows", this->num_rows() },
+                detail::tracking_entry{ "solver_state_read", "time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
+                detail::tracking_entry{ "solver_state_read", "filename", filename });
+}
+
+template <typename T>
+void solver_state<T>::save(const std::string &filename) const {
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // save the header and the deflation vectors
+    detail::io::write_solver_state(filename, max_vectors_, this->num_rows(), vectors_);
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Write {} deflation vectors with {} values in {} to the solver state file '{}'.\n",
+                detail::tracking_entry{ "solver_state_write", "num_vectors", this->num_vectors() },
+                detail::tracking_entry{ "solver_state_write", "num_rows", this->num_rows() },
+                detail::tracking_entry{ "solver_state_write", "time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
+                detail::tracking_entry{ "solver_state_write", "filename", filename });
+}
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_SOLVER_STATE_HPP_
@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an enumeration holding all supported solvers for the system of linear equations.
+ */
+
+#ifndef PLSSVM_SOLVER_TYPES_HPP_
+#define PLSSVM_SOLVER_TYPES_HPP_
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for all supported solvers of the system of linear equations.
+ */
+enum class solver_type {
+    /** The classic Conjugate Gradients algorithm with two global reductions per iteration and an explicit residual correction every 50 iterations. Used as default. */
+    cg,
+    /**
+     * The Chronopoulos-Gear Conjugate Gradients variant with a single fused global reduction per iteration and an adaptive residual replacement,
+     * i.e., the residual is only recomputed explicitly if the recursively updated residual may have drifted away from the true residual.
+     */
+    single_reduction_cg
+};
+
+/**
+ * @brief Output the @p solver to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the solver type to
+ * @param[in] solver the solver type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, solver_type solver);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p solver type.
+ * @param[in,out] in input-stream to extract the solver type from
+ * @param[in] solver the solver type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, solver_type &solver);
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_SOLVER_TYPES_HPP_
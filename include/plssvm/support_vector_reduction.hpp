@@ -0,0 +1,233 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a post-training reduction of the number of support vectors of a learned model to speedup the prediction.
+ */
+
+#ifndef PLSSVM_SUPPORT_VECTOR_REDUCTION_HPP_
+#define PLSSVM_SUPPORT_VECTOR_REDUCTION_HPP_
+#pragma once
+
+#include "plssvm/data_set.hpp"                    // plssvm::data_set
+#include "plssvm/detail/cholesky.hpp"             // plssvm::detail::solve_cholesky
+#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry
+#include "plssvm/detail/primal_system.hpp"        // plssvm::detail::assemble_primal_system
+#include "plssvm/exceptions/exceptions.hpp"       // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function
+#include "plssvm/model.hpp"                       // plssvm::model
+#include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::parameter
+
+#include "fmt/chrono.h"                           // directly print std::chrono literals with fmt
+#include "fmt/core.h"                             // fmt::format
+#include "fmt/ostream.h"                          // can use fmt using operator<< overloads
+
+#include <algorithm>                              // std::stable_sort, std::sort, std::find_if, std::min
+#include <chrono>                                 // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
+#include <cmath>                                  // std::abs
+#include <cstddef>                                // std::size_t
+#include <numeric>                                // std::iota
+#include <utility>                                // std::move
+#include <vector>                                 // std::vector
+
+namespace plssvm {
+
+/**
+ * @brief Reduces the number of support vectors of a learned LS-SVM model to speedup the prediction.
+ * @details Since every training data point is a support vector of an LS-SVM, the prediction time of a model scales with the size of the training set.
+ *          The reduction keeps the `m` support vectors with the largest absolute weights (the LS-SVM support values) and refits their weights `beta` and the bias `b`,
+ *          such that the reduced decision function approximates the decision function `f` of the original model on all original support vectors
+ *          (regularized least squares: `[K_mm / C + K_mn * K_nm, K_mn * 1; 1^T * K_nm, n] * [beta; b] = [K_mn * f; 1^T * f]`).
+ *          If the fraction of original support vectors whose predicted label changes exceeds the tolerance, the number of kept support vectors is doubled
+ *          until the tolerance is met; if this isn't possible, the original model is returned unchanged.
+ */
+class support_vector_reduction {
+  public:
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Create a new support vector reduction keeping @p num_support_vectors support vectors.
+     * @param[in] num_support_vectors the number of support vectors of the reduced model
+     * @param[in] tolerance the maximum fraction of the original support vectors whose predicted label may change due to the reduction (`1.0` disables the check)
+     * @throws plssvm::invalid_parameter_exception if @p num_support_vectors is less than two
+     * @throws plssvm::invalid_parameter_exception if @p tolerance isn't in the range [0.0, 1.0]
+     */
+    explicit support_vector_reduction(size_type num_support_vectors, double tolerance = 1.0);
+
+    /**
+     * @brief Return the number of support vectors of the reduced model.
+     * @details If the tolerance isn't met, the reduced model may contain more support vectors.
+     * @return the number of support vectors (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_support_vectors() const noexcept { return num_support_vectors_; }
+    /**
+     * @brief Return the maximum fraction of the original support vectors whose predicted label may change due to the reduction.
+     * @return the tolerance (`[[nodiscard]]`)
+     */
+    [[nodiscard]] double tolerance() const noexcept { return tolerance_; }
+
+    /**
+     * @brief Reduce the number of support vectors of the @p full_model.
+     * @details The reduced model uses a subset of the support vectors of @p full_model with refitted weights and bias.
+     *          If @p full_model doesn't contain more support vectors than requested, or the tolerance can't be met, a copy of @p full_model is returned.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @param[in] full_model the learned model to reduce
+     * @throws plssvm::exception if the system of linear equations of the refit couldn't be solved
+     * @return the reduced model (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type>
+    [[nodiscard]] model<real_type, label_type> reduce(const model<real_type, label_type> &full_model) const;
+
+  private:
+    /// The number of support vectors of the reduced model.
+    size_type num_support_vectors_{ 0 };
+    /// The maximum fraction of the original support vectors whose predicted label may change.
+    double tolerance_{ 1.0 };
+};
+
+inline support_vector_reduction::support_vector_reduction(const size_type num_support_vectors, const double tolerance) :
+    num_support_vectors_{ num_support_vectors }, tolerance_{ tolerance } {
+    // num_support_vectors: at least one support vector per class is necessary
+    if (num_support_vectors_ < 2) {
+        throw invalid_parameter_exception{ fmt::format("The number of support vectors must be at least 2, but is {}!", num_support_vectors_) };
+    }
+    // tolerance: must be a valid fraction
+    if (tolerance_ < 0.0 || tolerance_ > 1.0) {
+        throw invalid_parameter_exception{ fmt::format("The tolerance must be in the range [0.0, 1.0], but is {}!", tolerance_) };
+    }
+}
+
+template <typename real_type, typename label_type>
+model<real_type, label_type> support_vector_reduction::reduce(const model<real_type, label_type> &full_model) const {
+    const size_type num_data_points = full_model.num_support_vectors();
+    if (num_data_points <= num_support_vectors_) {
+        detail::log(verbosity_level::full,
+                    "The model contains only {} support vectors; no reduction to {} support vectors necessary.\n",
+                    num_data_points,
+                    num_support_vectors_);
+        return full_model;
+    }
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    parameter kernel_params{ full_model.get_params() };
+    if (kernel_params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        kernel_params.gamma = 1.0 / full_model.num_features();
+    }
+    const auto real_params = static_cast<detail::parameter<real_type>>(kernel_params);
+
+    const std::vector<std::vector<real_type>> &X = full_model.support_vectors();
+    const std::vector<real_type> &alpha = full_model.weights();
+    const std::vector<label_type> &labels = full_model.labels();
+    // the first label is mapped to -1, the second one to +1
+    const label_type negative_label = full_model.different_labels().front();
+
+    // the decision values of the full model on all support vectors, i.e., the values the reduced model should approximate
+    std::vector<real_type> f(num_data_points);
+    #pragma omp parallel for schedule(dynamic) default(none) shared(X, alpha, real_params, f, full_model) firstprivate(num_data_points)
+    for (size_type i = 0; i < num_data_points; ++i) {
+        real_type temp{ 0.0 };
+        for (size_type j = 0; j < num_data_points; ++j) {
+            temp += alpha[j] * kernel_function(X[i], X[j], real_params);
+        }
+        f[i] = temp - full_model.rho();
+    }
+
+    // rank the support vectors by the absolute value of their weights (the LS-SVM support values)
+    std::vector<size_type> ranking(num_data_points);
+    std::iota(ranking.begin(), ranking.end(), size_type{ 0 });
+    std::stable_sort(ranking.begin(), ranking.end(), [&](const size_type lhs, const size_type rhs) { return std::abs(alpha[lhs]) > std::abs(alpha[rhs]); });
+
+    const std::chrono::time_point ranking_end_time = std::chrono::steady_clock::now();
+
+    for (size_type m = num_support_vectors_; m < num_data_points; m = std::min(2 * m, num_data_points)) {
+        // keep the m support vectors with the largest absolute weights
+        std::vector<size_type> kept(ranking.cbegin(), ranking.cbegin() + m);
+        // make sure both classes are represented; otherwise, the model's label mapping would be incomplete
+        for (const bool negative : { true, false }) {
+            const auto has_class = [&](const size_type idx) { return (labels[idx] == negative_label) == negative; };
+            if (std::find_if(kept.cbegin(), kept.cend(), has_class) == kept.cend()) {
+                // replace the support vector with the smallest absolute weight by the most important one of the missing class
+                kept.back() = *std::find_if(ranking.cbegin() + m, ranking.cend(), has_class);
+            }
+        }
+        // sort the kept support vectors for a better memory locality
+        std::sort(kept.begin(), kept.end());
+
+        // assemble the refit system without storing the complete n x m kernel matrix
+        std::vector<double> A{};
+        std::vector<double> b{};
+        detail::assemble_primal_system(X, kept, f, real_params, kernel_params.cost.value(), A, b);
+
+        // solve the (m + 1)-dimensional refit system
+        if (!detail::solve_cholesky(A, b)) {
+            throw exception{ "Couldn't solve the system of linear equations to refit the weights of the reduced model!" };
+        }
+
+        // count the support vectors whose predicted label changes due to the reduction
+        size_type num_changed_labels = 0;
+        #pragma omp parallel for reduction(+ : num_changed_labels) default(none) shared(X, kept, real_params, b, f) firstprivate(num_data_points, m)
+        for (size_type i = 0; i < num_data_points; ++i) {
+            double g_i = b[m];
+            for (size_type j = 0; j < m; ++j) {
+                g_i += b[j] * static_cast<double>(kernel_function(X[i], X[kept[j]], real_params));
+            }
+            if ((g_i > 0.0) != (f[i] > real_type{ 0.0 })) {
+                ++num_changed_labels;
+            }
+        }
+        const double changed_fraction = static_cast<double>(num_changed_labels) / static_cast<double>(num_data_points);
+
+        if (changed_fraction > tolerance_) {
+            detail::log(verbosity_level::full,
+                        "The predicted labels of {:.2f}% of the support vectors changed using {} support vectors (tolerance: {:.2f}%); retrying with more support vectors.\n",
+                        changed_fraction * 100,
+                        m,
+                        tolerance_ * 100);
+            continue;
+        }
+
+        // create the reduced model using the kept support vectors
+        std::vector<std::vector<real_type>> support_vectors(m);
+        std::vector<label_type> support_vector_labels(m);
+        std::vector<real_type> beta(m);
+        for (size_type j = 0; j < m; ++j) {
+            support_vectors[j] = X[kept[j]];
+            support_vector_labels[j] = labels[kept[j]];
+            beta[j] = static_cast<real_type>(b[j]);
+        }
+        model<real_type, label_type> reduced_model{ full_model.get_params(), data_set<real_type, label_type>{ std::move(support_vectors), std::move(support_vector_labels) } };
+        *reduced_model.alpha_ptr_ = std::move(beta);
+        // f(x) = sum_j beta_j * k(x, sv_j) + b = sum_j alpha_j * k(x, sv_j) - rho
+        reduced_model.rho_ = static_cast<real_type>(-b[m]);
+
+        const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Reduced the number of support vectors from {} to {} changing the predicted labels of {} support vectors in {} (ranking took {}).\n",
+                    detail::tracking_entry{ "support_vector_reduction", "num_original_support_vectors", num_data_points },
+                    detail::tracking_entry{ "support_vector_reduction", "num_support_vectors", m },
+                    detail::tracking_entry{ "support_vector_reduction", "num_changed_labels", num_changed_labels },
+                    detail::tracking_entry{ "support_vector_reduction", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) },
+                    detail::tracking_entry{ "support_vector_reduction", "ranking_time", std::chrono::duration_cast<std::chrono::milliseconds>(ranking_end_time - start_time) });
+
+        return reduced_model;
+    }
+
+    detail::log(verbosity_level::full,
+                "Couldn't reduce the number of support vectors within a tolerance of {:.2f}%; keeping all {} support vectors.\n",
+                tolerance_ * 100,
+                num_data_points);
+    return full_model;
+}
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_SUPPORT_VECTOR_REDUCTION_HPP_
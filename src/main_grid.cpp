@@ -0,0 +1,87 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Main function compiled to the `plssvm-grid` executable used for performing a grid search over the C-SVM parameters.
+ */
+
+#include "plssvm/core.hpp"
+
+#include "plssvm/detail/cmd/data_set_variants.hpp"  // plssvm::detail::cmd::data_set_factory
+#include "plssvm/detail/cmd/parser_grid.hpp"        // plssvm::detail::cmd::parser_grid
+#include "plssvm/detail/io/data_set_cache.hpp"      // plssvm::data_set_cache
+#include "plssvm/detail/logger.hpp"                 // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"    // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE
+
+#include "fmt/os.h"                                 // fmt::ostream, fmt::output_file
+#include "fmt/ostream.h"                            // can use fmt using operator<< overloads
+
+#include <chrono>                                   // std::chrono::{steady_clock, duration}
+#include <cstdlib>                                  // EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>                                // std::exception
+#include <iostream>                                 // std::cerr, std::clog, std::endl
+#include <variant>                                  // std::visit
+
+int main(int argc, char *argv[]) {
+    try {
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+        // parse SVM parameter from command line
+        plssvm::detail::cmd::parser_grid cmd_parser{ argc, argv };
+        // use the requested data set cache for all data sets read from files
+        plssvm::data_set_cache = cmd_parser.cache_options;
+
+        // output used parameter
+        plssvm::detail::log(plssvm::verbosity_level::full,
+                            "\ntask: grid search\n{}\n\n\n",
+                            plssvm::detail::tracking_entry{ "parameter", "", cmd_parser });
+
+        // create data set
+        std::visit([&](auto &&data) {
+            using real_type = typename std::remove_reference_t<decltype(data)>::real_type;
+            using label_type = typename std::remove_reference_t<decltype(data)>::label_type;
+
+            // create grid search
+            const plssvm::grid_search grid{ cmd_parser.csvm_params, cmd_parser.gamma_values, cmd_parser.cost_values };
+
+            // evaluate all grid points
+            if (cmd_parser.max_iter.is_default()) {
+                cmd_parser.max_iter = data.num_data_points();
+            }
+            const plssvm::grid_search_result<real_type, label_type> result = cmd_parser.validation_filename.empty()
+                                                                                 ? grid.fit(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter)
+                                                                                 : grid.fit(data, plssvm::data_set<real_type, label_type>{ cmd_parser.validation_filename, cmd_parser.input_options }, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter);
+
+            // output the ranking
+            plssvm::detail::log(plssvm::verbosity_level::full,
+                                "\n{}\n",
+                                result);
+            if (!cmd_parser.ranking_filename.empty()) {
+                fmt::ostream out = fmt::output_file(cmd_parser.ranking_filename);
+                out.print("{}", result);
+            }
+
+            // save the best model to file
+            result.best_model().save(cmd_parser.model_filename);
+        }, plssvm::detail::cmd::data_set_factory(cmd_parser));
+
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+        plssvm::detail::log(plssvm::verbosity_level::full,
+                            "\nTotal runtime: {}\n",
+                            plssvm::detail::tracking_entry{ "", "total_time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE(cmd_parser.performance_tracking_filename);
+
+    } catch (const plssvm::exception &e) {
+        std::cerr << e.what_with_loc() << std::endl;
+        return EXIT_FAILURE;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -10,21 +10,55 @@
 
 #include "plssvm/core.hpp"
 
-#include "plssvm/detail/cmd/data_set_variants.hpp"  // plssvm::detail::cmd::data_set_factory
-#include "plssvm/detail/cmd/parser_predict.hpp"     // plssvm::detail::cmd::parser_predict
-#include "plssvm/detail/logger.hpp"                 // plssvm::detail::log, plssvm::verbosity_level
-#include "plssvm/detail/performance_tracker.hpp"    // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE
-
-#include "fmt/format.h"                             // fmt::print, fmt::join
-#include "fmt/os.h"                                 // fmt::ostream, fmt::output_file
-
-#include <chrono>                                   // std::chrono::{steady_clock, duration}
-#include <cstdlib>                                  // EXIT_SUCCESS, EXIT_FAILURE
-#include <exception>                                // std::exception
-#include <fstream>                                  // std::ofstream
-#include <iostream>                                 // std::cerr, std::clog, std::endl
-#include <variant>                                  // std::visit
-#include <vector>                                   // std::vector
+#include "plssvm/detail/cmd/data_set_variants.hpp"   // plssvm::detail::cmd::data_set_factory
+#include "plssvm/detail/cmd/parser_predict.hpp"      // plssvm::detail::cmd::parser_predict
+#include "plssvm/detail/io/data_set_cache.hpp"       // plssvm::data_set_cache
+#include "plssvm/detail/io/libsvm_chunk_reader.hpp"  // plssvm::detail::io::libsvm_chunk_reader
+#include "plssvm/detail/logger.hpp"                  // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"     // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE
+#include "plssvm/detail/predict_pipeline.hpp"        // plssvm::detail::{predict_pipeline_chunk_size, run_predict_pipeline}
+
+#include "fmt/format.h"                              // fmt::print, fmt::join
+#include "fmt/os.h"                                  // fmt::ostream, fmt::output_file
+
+#include <chrono>                                    // std::chrono::{steady_clock, duration}
+#include <cstdlib>                                   // EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>                                 // std::exception
+#include <fstream>                                   // std::ofstream
+#include <iostream>                                  // std::cerr, std::clog, std::endl
+#include <string>                                    // std::string
+#include <variant>                                   // std::visit
+#include <vector>                                    // std::vector
+
+/**
+ * @brief Predict the test file given in @p cmd_parser in chunks using a bounded amount of memory.
+ * @tparam real_type the type of the data points
+ * @tparam label_type the type of the labels
+ * @param[in] cmd_parser the provided command line parser
+ */
+template <typename real_type, typename label_type>
+void predict_in_chunks(const plssvm::detail::cmd::parser_predict &cmd_parser) {
+    // create model
+    const plssvm::model<real_type, label_type> model{ cmd_parser.model_filename };
+    // create default csvm
+    const auto svm = plssvm::make_csvm(cmd_parser.backend, cmd_parser.target);
+
+    // read, predict, and write the test file chunk by chunk
+    const std::size_t chunk_size = plssvm::detail::predict_pipeline_chunk_size(cmd_parser.chunk_size, cmd_parser.max_memory * 1024 * 1024, model.num_features(), sizeof(real_type));
+    plssvm::detail::io::libsvm_chunk_reader<real_type, label_type> reader{ cmd_parser.input_filename, model.num_features() };
+    const plssvm::detail::predict_pipeline_result result = plssvm::detail::run_predict_pipeline(reader, cmd_parser.predict_filename, chunk_size, [&](const plssvm::data_set<real_type, label_type> &chunk) {
+        return svm->predict(model, chunk);
+    });
+
+    // print achieved accuracy (if possible)
+    if (result.has_labels) {
+        plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::libsvm,
+                            "Accuracy = {}% ({}/{}) (classification)\n",
+                            static_cast<real_type>(result.num_correct) / static_cast<real_type>(result.num_data_points) * real_type{ 100 },
+                            result.num_correct,
+                            result.num_data_points);
+    }
+}
 
 int main(int argc, char *argv[]) {
     try {
@@ -32,57 +66,72 @@ int main(int argc, char *argv[]) {
 
         // parse SVM parameter from command line
         const plssvm::detail::cmd::parser_predict cmd_parser{ argc, argv };
+        // use the requested data set cache for all data sets read from files
+        plssvm::data_set_cache = cmd_parser.cache_options;
 
         // output used parameter
         plssvm::detail::log(plssvm::verbosity_level::full,
                             "\ntask: prediction\n{}\n",
                             plssvm::detail::tracking_entry{ "parameter", "", cmd_parser });
 
-        // create data set
-        std::visit([&](auto &&data) {
-            using real_type = typename std::remove_reference_t<decltype(data)>::real_type;
-            using label_type = typename std::remove_reference_t<decltype(data)>::label_type;
-
-            // create model
-            const plssvm::model<real_type, label_type> model{ cmd_parser.model_filename };
-            // create default csvm
-            const auto svm = plssvm::make_csvm(cmd_parser.backend, cmd_parser.target);
-            // predict labels
-            const std::vector<label_type> predicted_labels = svm->predict(model, data);
-
-            // write prediction file
-            {
-                const std::chrono::time_point write_start_time = std::chrono::steady_clock::now();
-
-                fmt::ostream out = fmt::output_file(cmd_parser.predict_filename);
-                out.print("{}", fmt::join(predicted_labels, "\n"));
-
-                const std::chrono::time_point write_end_time = std::chrono::steady_clock::now();
-                plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::timing,
-                                    "Write {} predictions in {} to the file '{}'.\n",
-                                    plssvm::detail::tracking_entry{ "predictions_write", "num_predictions", predicted_labels.size() },
-                                    plssvm::detail::tracking_entry{ "predictions_write", "time", std::chrono::duration_cast<std::chrono::milliseconds>(write_end_time - write_start_time) },
-                                    plssvm::detail::tracking_entry{ "predictions_write", "filename", cmd_parser.predict_filename });
+        if (cmd_parser.chunk_size > 0 || cmd_parser.max_memory > 0) {
+            // predict the test file in chunks without reading it at once
+            if (cmd_parser.float_as_real_type && cmd_parser.strings_as_labels) {
+                predict_in_chunks<float, std::string>(cmd_parser);
+            } else if (cmd_parser.float_as_real_type && !cmd_parser.strings_as_labels) {
+                predict_in_chunks<float, int>(cmd_parser);
+            } else if (!cmd_parser.float_as_real_type && cmd_parser.strings_as_labels) {
+                predict_in_chunks<double, std::string>(cmd_parser);
+            } else {
+                predict_in_chunks<double, int>(cmd_parser);
             }
+        } else {
+            // create data set
+            std::visit([&](auto &&data) {
+                using real_type = typename std::remove_reference_t<decltype(data)>::real_type;
+                using label_type = typename std::remove_reference_t<decltype(data)>::label_type;
+
+                // create model
+                const plssvm::model<real_type, label_type> model{ cmd_parser.model_filename };
+                // create default csvm
+                const auto svm = plssvm::make_csvm(cmd_parser.backend, cmd_parser.target);
+                // predict labels
+                const std::vector<label_type> predicted_labels = svm->predict(model, data);
+
+                // write prediction file
+                {
+                    const std::chrono::time_point write_start_time = std::chrono::steady_clock::now();
+
+                    fmt::ostream out = fmt::output_file(cmd_parser.predict_filename);
+                    out.print("{}", fmt::join(predicted_labels, "\n"));
+
+                    const std::chrono::time_point write_end_time = std::chrono::steady_clock::now();
+                    plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::timing,
+                                        "Write {} predictions in {} to the file '{}'.\n",
+                                        plssvm::detail::tracking_entry{ "predictions_write", "num_predictions", predicted_labels.size() },
+                                        plssvm::detail::tracking_entry{ "predictions_write", "time", std::chrono::duration_cast<std::chrono::milliseconds>(write_end_time - write_start_time) },
+                                        plssvm::detail::tracking_entry{ "predictions_write", "filename", cmd_parser.predict_filename });
+                }
 
-            // print achieved accuracy (if possible)
-            if (data.has_labels()) {
-                const std::vector<label_type> &correct_labels = data.labels().value();
-                std::size_t correct{ 0 };
-                for (typename std::vector<label_type>::size_type i = 0; i < predicted_labels.size(); ++i) {
-                    // check whether prediction is correct
-                    if (predicted_labels[i] == correct_labels[i]) {
-                        ++correct;
+                // print achieved accuracy (if possible)
+                if (data.has_labels()) {
+                    const std::vector<label_type> &correct_labels = data.labels().value();
+                    std::size_t correct{ 0 };
+                    for (typename std::vector<label_type>::size_type i = 0; i < predicted_labels.size(); ++i) {
+                        // check whether prediction is correct
+                        if (predicted_labels[i] == correct_labels[i]) {
+                            ++correct;
+                        }
                     }
+                    // print accuracy
+                    plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::libsvm,
+                                        "Accuracy = {}% ({}/{}) (classification)\n",
+                                        static_cast<real_type>(correct) / static_cast<real_type>(data.num_data_points()) * real_type{ 100 },
+                                        correct,
+                                        data.num_data_points());
                 }
-                // print accuracy
-                plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::libsvm,
-                                    "Accuracy = {}% ({}/{}) (classification)\n",
-                                    static_cast<real_type>(correct) / static_cast<real_type>(data.num_data_points()) * real_type{ 100 },
-                                    correct,
-                                    data.num_data_points());
-            }
-        }, plssvm::detail::cmd::data_set_factory(cmd_parser));
+            }, plssvm::detail::cmd::data_set_factory(cmd_parser));
+        }
 
         const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
         plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::timing,
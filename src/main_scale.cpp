@@ -12,6 +12,7 @@
 
 #include "plssvm/detail/cmd/data_set_variants.hpp"  // plssvm::detail::cmd::data_set_factory
 #include "plssvm/detail/cmd/parser_scale.hpp"       // plssvm::detail::cmd::parser_scale
+#include "plssvm/detail/io/data_set_cache.hpp"      // plssvm::data_set_cache
 #include "plssvm/detail/logger.hpp"                 // plssvm::detail::log, plssvm::verbosity_level
 #include "plssvm/detail/performance_tracker.hpp"    // plssvm::detail::tracking_entry,PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE
 
@@ -28,6 +29,8 @@ int main(int argc, char *argv[]) {
 
         // create default parameters
         const plssvm::detail::cmd::parser_scale cmd_parser{ argc, argv };
+        // use the requested data set cache for all data sets read from files
+        plssvm::data_set_cache = cmd_parser.cache_options;
 
         // output used parameter
         plssvm::detail::log(plssvm::verbosity_level::full,
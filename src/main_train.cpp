@@ -12,14 +12,22 @@
 
 #include "plssvm/detail/cmd/data_set_variants.hpp"  // plssvm::detail::cmd::data_set_factory
 #include "plssvm/detail/cmd/parser_train.hpp"       // plssvm::detail::cmd::parser_train
+#include "plssvm/detail/io/data_set_cache.hpp"      // plssvm::data_set_cache
 #include "plssvm/detail/logger.hpp"                 // plssvm::detail::log, plssvm::verbosity_level
 #include "plssvm/detail/performance_tracker.hpp"    // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE
 
+#include "fmt/core.h"                               // fmt::format
+#include "fmt/ostream.h"                            // can use fmt using operator<< overloads
+
 #include <chrono>                                   // std::chrono::{steady_clock, duration}
+#include <cstddef>                                  // std::size_t
 #include <cstdlib>                                  // EXIT_SUCCESS, EXIT_FAILURE
 #include <exception>                                // std::exception
+#include <filesystem>                               // std::filesystem::exists
 #include <iostream>                                 // std::cerr, std::clog, std::endl
+#include <string>                                   // std::string
 #include <variant>                                  // std::visit
+#include <vector>                                   // std::vector
 
 int main(int argc, char *argv[]) {
     try {
@@ -27,6 +35,8 @@ int main(int argc, char *argv[]) {
 
         // parse SVM parameter from command line
         plssvm::detail::cmd::parser_train cmd_parser{ argc, argv };
+        // use the requested data set cache for all data sets read from files
+        plssvm::data_set_cache = cmd_parser.cache_options;
 
         // output used parameter
         plssvm::detail::log(plssvm::verbosity_level::full,
@@ -40,15 +50,83 @@ int main(int argc, char *argv[]) {
 
             // create SVM
             const std::unique_ptr<plssvm::csvm> svm = (cmd_parser.backend == plssvm::backend_type::sycl) ? plssvm::make_csvm(cmd_parser.backend, cmd_parser.target, cmd_parser.csvm_params, plssvm::sycl_implementation_type = cmd_parser.sycl_implementation_type, plssvm::sycl_kernel_invocation_type = cmd_parser.sycl_kernel_invocation_type)
+                                                    : (cmd_parser.hodlr_tolerance > 0.0)                 ? plssvm::make_csvm(cmd_parser.backend, cmd_parser.target, cmd_parser.csvm_params, plssvm::hodlr_tolerance = cmd_parser.hodlr_tolerance)
+                                                    : (cmd_parser.rbf_cutoff > 0.0)                      ? plssvm::make_csvm(cmd_parser.backend, cmd_parser.target, cmd_parser.csvm_params, plssvm::rbf_cutoff = cmd_parser.rbf_cutoff)
                                                                                                          : plssvm::make_csvm(cmd_parser.backend, cmd_parser.target, cmd_parser.csvm_params);
 
+            // save the learned model, optionally reducing the number of support vectors beforehand
+            const auto save_model = [&](const plssvm::model<real_type, label_type> &model, const std::string &filename) {
+                if (cmd_parser.reduce_to > 0) {
+                    const plssvm::support_vector_reduction reduction{ cmd_parser.reduce_to, cmd_parser.reduce_tolerance.value() };
+                    reduction.reduce(model).save(filename);
+                } else {
+                    model.save(filename);
+                }
+            };
+
             // learn model
-            if (cmd_parser.max_iter.is_default()) {
+            const bool max_iter_is_default = cmd_parser.max_iter.is_default();
+            if (max_iter_is_default) {
                 cmd_parser.max_iter = data.num_data_points();
             }
-            const plssvm::model<real_type, label_type> model = svm->fit(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter);
-            // save model to file
-            model.save(cmd_parser.model_filename);
+            if (cmd_parser.append) {
+                // add the data points to the model in the model file and warm start the CG using its weights
+                const plssvm::model<real_type, label_type> old_model{ cmd_parser.model_filename };
+                const std::size_t max_iter = max_iter_is_default ? old_model.num_support_vectors() + data.num_data_points() : cmd_parser.max_iter.value();
+                const plssvm::model<real_type, label_type> model = svm->fit_incremental(old_model, data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = max_iter, plssvm::solver = cmd_parser.solver);
+                // overwrite the model file with the updated model
+                save_model(model, cmd_parser.model_filename);
+            } else if (cmd_parser.cross_validation > 0) {
+                // only perform a k-fold cross-validation
+                const plssvm::cross_validation cv{ cmd_parser.csvm_params, cmd_parser.cross_validation };
+                const plssvm::cross_validation_result<real_type> result = cv.evaluate(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter);
+                plssvm::detail::log(plssvm::verbosity_level::full,
+                                    "\n{}\n",
+                                    result);
+                plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::libsvm,
+                                    "Cross Validation Accuracy = {}%\n",
+                                    result.accuracy() * 100);
+            } else if (cmd_parser.loo) {
+                // only estimate the leave-one-out accuracy
+                const real_type accuracy = svm->loo_score(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter, plssvm::num_probes = cmd_parser.loo_probes, plssvm::solver = cmd_parser.solver);
+                plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::libsvm,
+                                    "Leave-one-out accuracy = {}%\n",
+                                    accuracy * 100);
+            } else if (cmd_parser.num_landmarks > 0) {
+                // approximately learn a model using only the landmarks as support vectors
+                const plssvm::fixed_size_lssvm approximation{ cmd_parser.csvm_params, cmd_parser.num_landmarks, cmd_parser.landmark_selection };
+                const plssvm::model<real_type, label_type> model = approximation.fit(data);
+                // save model to file
+                save_model(model, cmd_parser.model_filename);
+            } else if (cmd_parser.prune_to > 0) {
+                // learn a sparse model by iteratively pruning the data points with the smallest weights
+                const plssvm::model<real_type, label_type> model = svm->fit_sparse(data, cmd_parser.prune_to, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter, plssvm::solver = cmd_parser.solver, plssvm::prune_fraction = cmd_parser.prune_fraction, plssvm::max_accuracy_drop = cmd_parser.max_accuracy_drop);
+                // save model to file
+                save_model(model, cmd_parser.model_filename);
+            } else if (!cmd_parser.solver_state_filename.empty()) {
+                // recycle the deflation vectors of previous trainings if the solver state file already exists
+                plssvm::solver_state<real_type> state = std::filesystem::exists(cmd_parser.solver_state_filename) ? plssvm::solver_state<real_type>{ cmd_parser.solver_state_filename } : plssvm::solver_state<real_type>{};
+                const plssvm::model<real_type, label_type> model = svm->fit(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter, plssvm::solver = cmd_parser.solver, plssvm::recycle = &state);
+                // save model and the updated solver state to file
+                save_model(model, cmd_parser.model_filename);
+                state.save(cmd_parser.solver_state_filename);
+            } else if (cmd_parser.checkpoint_interval > 0 || cmd_parser.resume) {
+                // periodically write checkpoints of the CG and/or resume the CG from a previously written checkpoint
+                const plssvm::model<real_type, label_type> model = svm->fit(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter, plssvm::solver = cmd_parser.solver, plssvm::checkpoint_file = cmd_parser.checkpoint_filename, plssvm::checkpoint_interval = cmd_parser.checkpoint_interval, plssvm::resume = cmd_parser.resume);
+                // save model to file
+                save_model(model, cmd_parser.model_filename);
+            } else if (cmd_parser.cost_path.empty()) {
+                const plssvm::model<real_type, label_type> model = svm->fit(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter, plssvm::num_partitions = cmd_parser.num_partitions, plssvm::solver = cmd_parser.solver);
+                // save model to file
+                save_model(model, cmd_parser.model_filename);
+            } else {
+                // learn one model per cost value at once
+                const std::vector<plssvm::model<real_type, label_type>> models = svm->fit(data, cmd_parser.cost_path, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter);
+                // save each model to its own file
+                for (std::vector<double>::size_type i = 0; i < models.size(); ++i) {
+                    save_model(models[i], fmt::format("{}.cost_{}", cmd_parser.model_filename, cmd_parser.cost_path[i]));
+                }
+            }
         }, plssvm::detail::cmd::data_set_factory(cmd_parser));
 
         const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
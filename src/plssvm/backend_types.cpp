@@ -84,6 +84,8 @@ std::ostream &operator<<(std::ostream &out, const backend_type backend) {
             return out << "opencl";
         case backend_type::sycl:
             return out << "sycl";
+        case backend_type::hpx:
+            return out << "hpx";
     }
     return out << "unknown";
 }
@@ -105,6 +107,8 @@ std::istream &operator>>(std::istream &in, backend_type &backend) {
         backend = backend_type::opencl;
     } else if (str == "sycl") {
         backend = backend_type::sycl;
+    } else if (str == "hpx") {
+        backend = backend_type::hpx;
     } else {
         in.setstate(std::ios::failbit);
     }
@@ -13,21 +13,27 @@
 #include "plssvm/backends/HPX/svm_kernel.hpp"  // plssvm::hpx::device_kernel_linear, plssvm::hpx::device_kernel_polynomial, plssvm::hpx::device_kernel_rbf
 #include "plssvm/csvm.hpp"                        // plssvm::csvm
 #include "plssvm/detail/assert.hpp"               // PLSSVM_ASSERT
+#include "plssvm/detail/cg_checkpoint.hpp"        // plssvm::detail::cg_checkpoint
+#include "plssvm/detail/deflated_cg.hpp"          // plssvm::detail::deflated_cg
 #include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
 #include "plssvm/detail/operators.hpp"            // various operator overloads for std::vector and scalars
 #include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
+#include "plssvm/detail/solve_options.hpp"        // plssvm::detail::solve_options
 #include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
 #include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/solver_types.hpp"                // plssvm::solver_type
 #include "plssvm/target_platforms.hpp"            // plssvm::target_platform
 
 #include "fmt/chrono.h"                           // directly print std::chrono literals with fmt
 #include "fmt/core.h"                             // fmt::format
 #include "fmt/ostream.h"                          // can use fmt using operator<< overloads
 
-#include <algorithm>                              // std::fill, std::all_of, std::min
+#include <algorithm>                              // std::fill, std::all_of, std::min, std::max
 #include <chrono>                                 // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
 #include <cmath>                                  // std::fma
 #include <iostream>                               // std::cout, std::endl
+#include <limits>                                 // std::numeric_limits
+#include <tuple>                                  // std::tie, std::ignore
 #include <utility>                                // std::pair, std::make_pair, std::move
 #include <vector>                                 // std::vector
 
@@ -65,7 +71,7 @@ void csvm::init(const target_platform target) {
 }
 
 template <typename real_type>
-std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter) const {
+std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter, const detail::solve_options<real_type> &options) const {
     PLSSVM_ASSERT(!A.empty(), "The data must not be empty!");
     PLSSVM_ASSERT(!A.front().empty(), "The data points must contain at least one feature!");
     PLSSVM_ASSERT(std::all_of(A.cbegin(), A.cend(), [&A](const std::vector<real_type> &data_point) { return data_point.size() == A.front().size(); }), "All data points must have the same number of features!");
@@ -88,7 +94,9 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
 
     // CG
 
-    std::vector<real_type> alpha(b.size(), 1.0);
+    // start with the initial guess if provided, otherwise with all ones
+    PLSSVM_ASSERT(options.initial_guess.empty() || options.initial_guess.size() == b.size(), "The initial guess must contain {} values, but contains {}!", b.size(), options.initial_guess.size());
+    std::vector<real_type> alpha = options.initial_guess.empty() ? std::vector<real_type>(b.size(), real_type{ 1.0 }) : options.initial_guess;
     const typename std::vector<real_type>::size_type dept = b.size();
 
     // sanity checks
@@ -101,7 +109,13 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
 
     // delta = r.T * r
     real_type delta = transposed{ r } * r;
-    const real_type delta0 = delta;
+    real_type delta0 = delta;
+    if (!options.initial_guess.empty()) {
+        // measure the convergence of a warm start relative to the initial residual of a cold start, i.e., reach the same accuracy as a full training
+        std::vector<real_type> r_cold(b);
+        run_device_kernel(params, q, r_cold, std::vector<real_type>(dept, real_type{ 1.0 }), A, QA_cost, real_type{ -1.0 });
+        delta0 = transposed{ r_cold } * r_cold;
+    }
     std::vector<real_type> Ad(dept);
 
     std::vector<real_type> d(r);
@@ -118,47 +132,169 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
     };
 
     unsigned long long iter = 0;
-    for (; iter < max_iter; ++iter) {
-        detail::log(verbosity_level::full | verbosity_level::timing,
-                    "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
-        iteration_start_time = std::chrono::steady_clock::now();
-
-        // Ad = A * d (q = A * d)
-        std::fill(Ad.begin(), Ad.end(), real_type{ 0.0 });
-        run_device_kernel(params, q, Ad, d, A, QA_cost, real_type{ 1.0 });
-
-        // (alpha = delta_new / (d^T * q))
-        const real_type alpha_cd = delta / (transposed{ d } * Ad);
+    unsigned long long num_residual_replacements = 0;
+    if (options.solver == solver_type::cg) {
+        // optionally deflate the CG using the recycled deflation vectors of the solver state
+        const auto matrix_vector_product = [&](const std::vector<real_type> &vec, std::vector<real_type> &result) {
+            std::fill(result.begin(), result.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, result, vec, A, QA_cost, real_type{ 1.0 });
+        };
+        detail::deflated_cg<real_type> deflation{ options.state, dept, matrix_vector_product };
+        if (deflation.is_deflated()) {
+            // x = x + W * (W^T * A * W)^-1 * W^T * r and update r accordingly
+            deflation.initial_guess(alpha, r);
+            delta = transposed{ r } * r;
+            d = r;
+            deflation.project(d, r);
+        }
+        // optionally continue the CG from a previously written checkpoint
+        detail::cg_checkpoint<real_type> checkpointer{ options.checkpoint, params, A, b };
+        std::ignore = checkpointer.restore(alpha, r, d, delta, delta0, iter);
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+
+            // Ad = A * d (q = A * d)
+            std::fill(Ad.begin(), Ad.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, Ad, d, A, QA_cost, real_type{ 1.0 });
+            deflation.record(d, Ad);
+
+            // (alpha = delta_new / (d^T * q))
+            const real_type alpha_cd = delta / (transposed{ d } * Ad);
+
+            // (x = x + alpha * d)
+            alpha += alpha_cd * d;
+
+            if (iter % 50 == 49) {
+                // (r = b - A * x)
+                // r = b
+                r = b;
+                // r -= A * x
+                run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 });
+            } else {
+                // r -= alpha_cd * Ad (r = r - alpha * q)
+                r -= alpha_cd * Ad;
+            }
+
+            // (delta = r^T * r)
+            const real_type delta_old = delta;
+            delta = transposed{ r } * r;
+            // report the progress and stop with the current iterate if the CG has been cancelled
+            if (options.monitor.report(iter + 1, max_iter, delta, delta0, eps)) {
+                output_iteration_duration();
+                break;
+            }
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                output_iteration_duration();
+                break;
+            }
 
-        // (x = x + alpha * d)
-        alpha += alpha_cd * d;
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta / delta_old;
+            // d = beta * d + r
+            d = beta * d + r;
+            // d = d - W * (W^T * A * W)^-1 * (A * W)^T * r
+            deflation.project(d, r);
+            // asynchronously write a checkpoint every checkpoint interval iterations
+            checkpointer.write(iter + 1, alpha, r, d, delta, delta0);
 
-        if (iter % 50 == 49) {
-            // (r = b - A * x)
-            // r = b
+            output_iteration_duration();
+        }
+        // update the deflation vectors for the next solve
+        deflation.update_state(std::min(iter + 1, max_iter));
+        // wait until the last checkpoint has been written
+        checkpointer.finish();
+    } else {
+        // single reduction CG (Chronopoulos and Gear): additionally carry w = A * r and s = A * d, such that each iteration
+        // needs only one matrix-vector product and the two inner products can be fused into a single reduction
+        const auto fused_inner_products = [dept](const std::vector<real_type> &r_vec, const std::vector<real_type> &w_vec) {
+            real_type rr{ 0.0 };
+            real_type wr{ 0.0 };
+            hpx::experimental::for_loop(hpx::execution::par, 0, dept, hpx::experimental::reduction_plus(rr), hpx::experimental::reduction_plus(wr), [&](typename std::vector<real_type>::size_type i, real_type &rr_local, real_type &wr_local)
+            {
+                rr_local += r_vec[i] * r_vec[i];
+                wr_local += w_vec[i] * r_vec[i];
+            });
+            return std::make_pair(rr, wr);
+        };
+
+        // w = A * r and s = A * d (with d = r)
+        std::vector<real_type> w(dept, real_type{ 0.0 });
+        run_device_kernel(params, q, w, r, A, QA_cost, real_type{ 1.0 });
+        std::vector<real_type> s(w);
+        real_type mu{ 0.0 };
+        std::tie(delta, mu) = fused_inner_products(r, w);
+        real_type alpha_cd = delta / mu;
+
+        // the largest residual since the last residual replacement
+        real_type max_delta = delta;
+        // recompute r = b - A * x, s = A * d, and w = A * r to remove the rounding errors accumulated by the recurrences
+        const auto replace_residual = [&]() {
             r = b;
-            // r -= A * x
             run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 });
-        } else {
-            // r -= alpha_cd * Ad (r = r - alpha * q)
-            r -= alpha_cd * Ad;
-        }
+            std::fill(s.begin(), s.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, s, d, A, QA_cost, real_type{ 1.0 });
+            std::fill(w.begin(), w.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, w, r, A, QA_cost, real_type{ 1.0 });
+            std::tie(delta, mu) = fused_inner_products(r, w);
+            max_delta = delta;
+            ++num_residual_replacements;
+        };
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+
+            // (x = x + alpha * d)
+            alpha += alpha_cd * d;
+            // (r = r - alpha * s)
+            r -= alpha_cd * s;
+
+            // w = A * r
+            std::fill(w.begin(), w.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, w, r, A, QA_cost, real_type{ 1.0 });
+
+            // (delta = r^T * r, mu = w^T * r) in a single reduction
+            const real_type delta_old = delta;
+            std::tie(delta, mu) = fused_inner_products(r, w);
+
+            bool replaced = false;
+            if (delta <= eps * eps * delta0) {
+                // the recursively updated residual may have drifted from the true residual -> verify it before stopping
+                replace_residual();
+                replaced = true;
+                // if we are exact enough stop CG iterations
+                if (delta <= eps * eps * delta0) {
+                    output_iteration_duration();
+                    break;
+                }
+            } else if (delta < std::numeric_limits<real_type>::epsilon() * max_delta) {
+                // the residual norm decreased by more than sqrt(machine epsilon) since the last replacement
+                replace_residual();
+                replaced = true;
+            }
+            max_delta = std::max(max_delta, delta);
+            // report the progress and stop with the current iterate if the CG has been cancelled
+            if (options.monitor.report(iter + 1, max_iter, delta, delta0, eps)) {
+                output_iteration_duration();
+                break;
+            }
+
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta / delta_old;
+            // d = beta * d + r
+            d = beta * d + r;
+            // s = beta * s + w
+            s = beta * s + w;
+            // (alpha = delta_new / (d^T * A * d)); after a residual replacement the recurrence isn't valid, so calculate it explicitly
+            alpha_cd = replaced ? delta / (transposed{ d } * s) : delta / (mu - beta * delta / alpha_cd);
 
-        // (delta = r^T * r)
-        const real_type delta_old = delta;
-        delta = transposed{ r } * r;
-        // if we are exact enough stop CG iterations
-        if (delta <= eps * eps * delta0) {
             output_iteration_duration();
-            break;
         }
-
-        // (beta = delta_new / delta_old)
-        const real_type beta = delta / delta_old;
-        // d = beta * d + r
-        d = beta * d + r;
-
-        output_iteration_duration();
     }
     detail::log(verbosity_level::full | verbosity_level::timing,
                 "Finished after {}/{} iterations with a residuum of {} (target: {}) and an average iteration time of {}.\n",
@@ -167,7 +303,13 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
                 detail::tracking_entry{ "cg", "residuum", delta },
                 detail::tracking_entry{ "cg", "target_residuum", eps * eps * delta0 },
                 detail::tracking_entry{ "cg", "avg_iteration_time", average_iteration_time / std::min(iter + 1, max_iter) });
+    if (options.solver == solver_type::single_reduction_cg) {
+        detail::log(verbosity_level::full,
+                    "Replaced the recursively updated residual {} times.\n",
+                    detail::tracking_entry{ "cg", "residual_replacements", num_residual_replacements });
+    }
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "epsilon", eps }));
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "solver", options.solver }));
     detail::log(verbosity_level::libsvm,
                 "optimization finished, #iter = {}\n", std::min(iter + 1, max_iter));
 
@@ -178,8 +320,8 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
     return std::make_pair(std::move(alpha), -bias);
 }
 
-template std::pair<std::vector<float>, float> csvm::solve_system_of_linear_equations_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const float, const unsigned long long) const;
-template std::pair<std::vector<double>, double> csvm::solve_system_of_linear_equations_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const double, const unsigned long long) const;
+template std::pair<std::vector<float>, float> csvm::solve_system_of_linear_equations_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const float, const unsigned long long, const detail::solve_options<float> &) const;
+template std::pair<std::vector<double>, double> csvm::solve_system_of_linear_equations_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const double, const unsigned long long, const detail::solve_options<double> &) const;
 
 template <typename real_type>
 std::vector<real_type> csvm::predict_values_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const real_type rho, std::vector<real_type> &w, const std::vector<std::vector<real_type>> &predict_points) const {
@@ -8,28 +8,39 @@
 
 #include "plssvm/backends/OpenMP/csvm.hpp"
 
-#include "plssvm/backends/OpenMP/exceptions.hpp"  // plssvm::openmp::backend_exception
-#include "plssvm/backends/OpenMP/q_kernel.hpp"    // plssvm::openmp::device_kernel_q_linear, plssvm::openmp::device_kernel_q_polynomial, plssvm::openmp::device_kernel_q_rbf
-#include "plssvm/backends/OpenMP/svm_kernel.hpp"  // plssvm::openmp::device_kernel_linear, plssvm::openmp::device_kernel_polynomial, plssvm::openmp::device_kernel_rbf
-#include "plssvm/csvm.hpp"                        // plssvm::csvm
-#include "plssvm/detail/assert.hpp"               // PLSSVM_ASSERT
-#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
-#include "plssvm/detail/operators.hpp"            // various operator overloads for std::vector and scalars
-#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
-#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
-#include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::parameter
-#include "plssvm/target_platforms.hpp"            // plssvm::target_platform
-
-#include "fmt/chrono.h"                           // directly print std::chrono literals with fmt
-#include "fmt/core.h"                             // fmt::format
-#include "fmt/ostream.h"                          // can use fmt using operator<< overloads
-
-#include <algorithm>                              // std::fill, std::all_of, std::min
-#include <chrono>                                 // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
-#include <cmath>                                  // std::fma
-#include <iostream>                               // std::cout, std::endl
-#include <utility>                                // std::pair, std::make_pair, std::move
-#include <vector>                                 // std::vector
+#include "plssvm/backends/OpenMP/exceptions.hpp"            // plssvm::openmp::backend_exception
+#include "plssvm/backends/OpenMP/hodlr_matrix.hpp"          // plssvm::openmp::hodlr_matrix
+#include "plssvm/backends/OpenMP/q_kernel.hpp"              // plssvm::openmp::device_kernel_q_linear, plssvm::openmp::device_kernel_q_polynomial, plssvm::openmp::device_kernel_q_rbf
+#include "plssvm/backends/OpenMP/sparse_kernel_matrix.hpp"  // plssvm::openmp::sparse_kernel_matrix
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"            // plssvm::openmp::device_kernel_linear, plssvm::openmp::device_kernel_polynomial, plssvm::openmp::device_kernel_rbf
+#include "plssvm/csvm.hpp"                                  // plssvm::csvm
+#include "plssvm/detail/assert.hpp"                         // PLSSVM_ASSERT
+#include "plssvm/detail/cg_checkpoint.hpp"                  // plssvm::detail::cg_checkpoint
+#include "plssvm/detail/deflated_cg.hpp"                    // plssvm::detail::deflated_cg
+#include "plssvm/detail/logger.hpp"                         // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/operators.hpp"                      // various operator overloads for std::vector and scalars
+#include "plssvm/detail/performance_tracker.hpp"            // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
+#include "plssvm/detail/solve_options.hpp"                  // plssvm::detail::solve_options
+#include "plssvm/exceptions/exceptions.hpp"                 // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"                 // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                             // plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/solver_types.hpp"                          // plssvm::solver_type
+#include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
+
+#include "fmt/chrono.h"                                     // directly print std::chrono literals with fmt
+#include "fmt/core.h"                                       // fmt::format
+#include "fmt/ostream.h"                                    // can use fmt using operator<< overloads
+#include "fmt/ranges.h"                                     // directly print std::vector with fmt
+
+#include <algorithm>                                        // std::fill, std::all_of, std::min, std::max, std::max_element
+#include <chrono>                                           // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
+#include <cmath>                                            // std::fma
+#include <iostream>                                         // std::cout, std::endl
+#include <limits>                                           // std::numeric_limits
+#include <optional>                                         // std::optional, std::make_optional, std::nullopt
+#include <tuple>                                            // std::tie, std::ignore
+#include <utility>                                          // std::pair, std::make_pair, std::move
+#include <vector>                                           // std::vector
 
 namespace plssvm::openmp {
 
@@ -50,6 +61,18 @@ void csvm::init(const target_platform target) {
 #if !defined(PLSSVM_HAS_CPU_TARGET)
     throw backend_exception{ "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!" };
 #endif
+    // the HODLR tolerance must not be negative
+    if (hodlr_tolerance_ < 0.0) {
+        throw invalid_parameter_exception{ fmt::format("hodlr_tolerance must be greater or equal than 0.0, but is {}!", hodlr_tolerance_) };
+    }
+    // the rbf cutoff must be a valid kernel value
+    if (rbf_cutoff_ < 0.0 || rbf_cutoff_ >= 1.0) {
+        throw invalid_parameter_exception{ fmt::format("rbf_cutoff must be in the range [0.0, 1.0), but is {}!", rbf_cutoff_) };
+    }
+    // only one kernel matrix approximation can be used at once
+    if (hodlr_tolerance_ > 0.0 && rbf_cutoff_ > 0.0) {
+        throw invalid_parameter_exception{ "Can't use the HODLR approximation (hodlr_tolerance) and the rbf truncation (rbf_cutoff) at the same time!" };
+    }
 
     // get the number of used OpenMP threads
     int num_omp_threads = 0;
@@ -69,7 +92,7 @@ void csvm::init(const target_platform target) {
 }
 
 template <typename real_type>
-std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter) const {
+std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter, const detail::solve_options<real_type> &options) const {
     PLSSVM_ASSERT(!A.empty(), "The data must not be empty!");
     PLSSVM_ASSERT(!A.front().empty(), "The data points must contain at least one feature!");
     PLSSVM_ASSERT(std::all_of(A.cbegin(), A.cend(), [&A](const std::vector<real_type> &data_point) { return data_point.size() == A.front().size(); }), "All data points must have the same number of features!");
@@ -92,20 +115,75 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
 
     // CG
 
-    std::vector<real_type> alpha(b.size(), 1.0);
+    // start with the initial guess if provided, otherwise with all ones
+    PLSSVM_ASSERT(options.initial_guess.empty() || options.initial_guess.size() == b.size(), "The initial guess must contain {} values, but contains {}!", b.size(), options.initial_guess.size());
+    std::vector<real_type> alpha = options.initial_guess.empty() ? std::vector<real_type>(b.size(), real_type{ 1.0 }) : options.initial_guess;
     const typename std::vector<real_type>::size_type dept = b.size();
 
     // sanity checks
     PLSSVM_ASSERT(dept == A.size() - 1, "Sizes mismatch!: {} != {}", dept, A.size() - 1);
 
+    // optionally compress the kernel matrix using a HODLR approximation
+    std::optional<hodlr_matrix<real_type>> compressed{ std::nullopt };
+    if (hodlr_tolerance_ > 0.0) {
+        const std::chrono::time_point compression_start_time = std::chrono::steady_clock::now();
+        hodlr_matrix<real_type> hodlr{ params, A, static_cast<real_type>(hodlr_tolerance_) };
+        const std::chrono::time_point compression_end_time = std::chrono::steady_clock::now();
+        if (hodlr.is_compressed()) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Compressed the kernel matrix to a tolerance of {} with a maximum off-diagonal rank of {} using {:.2f}% of the dense memory in {}.\n",
+                        detail::tracking_entry{ "hodlr", "tolerance", hodlr_tolerance_ },
+                        detail::tracking_entry{ "hodlr", "max_rank", hodlr.max_rank() },
+                        hodlr.memory_ratio() * 100.0,
+                        detail::tracking_entry{ "hodlr", "compression_time", std::chrono::duration_cast<std::chrono::milliseconds>(compression_end_time - compression_start_time) });
+            PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "hodlr", "memory_ratio", hodlr.memory_ratio() }));
+            compressed = std::make_optional(std::move(hodlr));
+        } else {
+            detail::log(verbosity_level::full,
+                        "The kernel matrix can't be compressed to a tolerance of {}, falling back to the dense kernel matrix.\n",
+                        detail::tracking_entry{ "hodlr", "tolerance", hodlr_tolerance_ });
+        }
+    }
+    const hodlr_matrix<real_type> *compressed_ptr = compressed.has_value() ? &compressed.value() : nullptr;
+
+    // optionally drop all rbf kernel matrix entries below the cutoff
+    std::optional<sparse_kernel_matrix<real_type>> truncated{ std::nullopt };
+    if (rbf_cutoff_ > 0.0) {
+        if (params.kernel_type == kernel_function_type::rbf) {
+            const std::chrono::time_point truncation_start_time = std::chrono::steady_clock::now();
+            truncated = std::make_optional<sparse_kernel_matrix<real_type>>(params, A, static_cast<real_type>(rbf_cutoff_));
+            const std::chrono::time_point truncation_end_time = std::chrono::steady_clock::now();
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Truncated the rbf kernel matrix at {} storing {} of {} tile pairs ({:.2f}% of the dense memory) with a dropped mass of at most {} per row in {}.\n",
+                        detail::tracking_entry{ "truncated_rbf", "cutoff", rbf_cutoff_ },
+                        detail::tracking_entry{ "truncated_rbf", "num_blocks", truncated->num_blocks() },
+                        truncated->num_tiles() * truncated->num_tiles(),
+                        truncated->density() * 100.0,
+                        detail::tracking_entry{ "truncated_rbf", "max_dropped_row_mass", truncated->max_dropped_row_mass() },
+                        detail::tracking_entry{ "truncated_rbf", "truncation_time", std::chrono::duration_cast<std::chrono::milliseconds>(truncation_end_time - truncation_start_time) });
+            PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "truncated_rbf", "density", truncated->density() }));
+            PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "truncated_rbf", "dropped_mass", truncated->dropped_mass() }));
+        } else {
+            detail::log(verbosity_level::full,
+                        "The kernel matrix can only be truncated for the rbf kernel, falling back to the dense kernel matrix.\n");
+        }
+    }
+    const sparse_kernel_matrix<real_type> *truncated_ptr = truncated.has_value() ? &truncated.value() : nullptr;
+
     std::vector<real_type> r(b);
 
     // r = A + alpha_ (r = b - Ax)
-    run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 });
+    run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 }, compressed_ptr, truncated_ptr);
 
     // delta = r.T * r
     real_type delta = transposed{ r } * r;
-    const real_type delta0 = delta;
+    real_type delta0 = delta;
+    if (!options.initial_guess.empty()) {
+        // measure the convergence of a warm start relative to the initial residual of a cold start, i.e., reach the same accuracy as a full training
+        std::vector<real_type> r_cold(b);
+        run_device_kernel(params, q, r_cold, std::vector<real_type>(dept, real_type{ 1.0 }), A, QA_cost, real_type{ -1.0 }, compressed_ptr, truncated_ptr);
+        delta0 = transposed{ r_cold } * r_cold;
+    }
     std::vector<real_type> Ad(dept);
 
     std::vector<real_type> d(r);
@@ -121,69 +199,376 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
         average_iteration_time += iteration_duration;
     };
 
+    unsigned long long iter = 0;
+    unsigned long long num_residual_replacements = 0;
+    if (options.solver == solver_type::cg) {
+        // optionally deflate the CG using the recycled deflation vectors of the solver state
+        const auto matrix_vector_product = [&](const std::vector<real_type> &vec, std::vector<real_type> &result) {
+            std::fill(result.begin(), result.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, result, vec, A, QA_cost, real_type{ 1.0 }, compressed_ptr, truncated_ptr);
+        };
+        detail::deflated_cg<real_type> deflation{ options.state, dept, matrix_vector_product };
+        if (deflation.is_deflated()) {
+            // x = x + W * (W^T * A * W)^-1 * W^T * r and update r accordingly
+            deflation.initial_guess(alpha, r);
+            delta = transposed{ r } * r;
+            d = r;
+            deflation.project(d, r);
+        }
+        // optionally continue the CG from a previously written checkpoint
+        detail::cg_checkpoint<real_type> checkpointer{ options.checkpoint, params, A, b };
+        std::ignore = checkpointer.restore(alpha, r, d, delta, delta0, iter);
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+
+            // Ad = A * d (q = A * d)
+            std::fill(Ad.begin(), Ad.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, Ad, d, A, QA_cost, real_type{ 1.0 }, compressed_ptr, truncated_ptr);
+            deflation.record(d, Ad);
+
+            // (alpha = delta_new / (d^T * q))
+            const real_type alpha_cd = delta / (transposed{ d } * Ad);
+
+            // (x = x + alpha * d)
+            alpha += alpha_cd * d;
+
+            if (iter % 50 == 49) {
+                // (r = b - A * x)
+                // r = b
+                r = b;
+                // r -= A * x
+                run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 }, compressed_ptr, truncated_ptr);
+            } else {
+                // r -= alpha_cd * Ad (r = r - alpha * q)
+                r -= alpha_cd * Ad;
+            }
+
+            // (delta = r^T * r)
+            const real_type delta_old = delta;
+            delta = transposed{ r } * r;
+            // report the progress and stop with the current iterate if the CG has been cancelled
+            if (options.monitor.report(iter + 1, max_iter, delta, delta0, eps)) {
+                output_iteration_duration();
+                break;
+            }
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                output_iteration_duration();
+                break;
+            }
+
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta / delta_old;
+            // d = beta * d + r
+            d = beta * d + r;
+            // d = d - W * (W^T * A * W)^-1 * (A * W)^T * r
+            deflation.project(d, r);
+            // asynchronously write a checkpoint every checkpoint interval iterations
+            checkpointer.write(iter + 1, alpha, r, d, delta, delta0);
+
+            output_iteration_duration();
+        }
+        // update the deflation vectors for the next solve
+        deflation.update_state(std::min(iter + 1, max_iter));
+        // wait until the last checkpoint has been written
+        checkpointer.finish();
+    } else {
+        // single reduction CG (Chronopoulos and Gear): additionally carry w = A * r and s = A * d, such that each iteration
+        // needs only one matrix-vector product and the two inner products can be fused into a single reduction
+        const auto fused_inner_products = [dept](const std::vector<real_type> &r_vec, const std::vector<real_type> &w_vec) {
+            real_type rr{ 0.0 };
+            real_type wr{ 0.0 };
+            #pragma omp parallel for default(none) shared(r_vec, w_vec) firstprivate(dept) reduction(+ : rr, wr)
+            for (typename std::vector<real_type>::size_type i = 0; i < dept; ++i) {
+                rr += r_vec[i] * r_vec[i];
+                wr += w_vec[i] * r_vec[i];
+            }
+            return std::make_pair(rr, wr);
+        };
+
+        // w = A * r and s = A * d (with d = r)
+        std::vector<real_type> w(dept, real_type{ 0.0 });
+        run_device_kernel(params, q, w, r, A, QA_cost, real_type{ 1.0 }, compressed_ptr, truncated_ptr);
+        std::vector<real_type> s(w);
+        real_type mu{ 0.0 };
+        std::tie(delta, mu) = fused_inner_products(r, w);
+        real_type alpha_cd = delta / mu;
+
+        // the largest residual since the last residual replacement
+        real_type max_delta = delta;
+        // recompute r = b - A * x, s = A * d, and w = A * r to remove the rounding errors accumulated by the recurrences
+        const auto replace_residual = [&]() {
+            r = b;
+            run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 }, compressed_ptr, truncated_ptr);
+            std::fill(s.begin(), s.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, s, d, A, QA_cost, real_type{ 1.0 }, compressed_ptr, truncated_ptr);
+            std::fill(w.begin(), w.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, w, r, A, QA_cost, real_type{ 1.0 }, compressed_ptr, truncated_ptr);
+            std::tie(delta, mu) = fused_inner_products(r, w);
+            max_delta = delta;
+            ++num_residual_replacements;
+        };
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+
+            // (x = x + alpha * d)
+            alpha += alpha_cd * d;
+            // (r = r - alpha * s)
+            r -= alpha_cd * s;
+
+            // w = A * r
+            std::fill(w.begin(), w.end(), real_type{ 0.0 });
+            run_device_kernel(params, q, w, r, A, QA_cost, real_type{ 1.0 }, compressed_ptr, truncated_ptr);
+
+            // (delta = r^T * r, mu = w^T * r) in a single reduction
+            const real_type delta_old = delta;
+            std::tie(delta, mu) = fused_inner_products(r, w);
+
+            bool replaced = false;
+            if (delta <= eps * eps * delta0) {
+                // the recursively updated residual may have drifted from the true residual -> verify it before stopping
+                replace_residual();
+                replaced = true;
+                // if we are exact enough stop CG iterations
+                if (delta <= eps * eps * delta0) {
+                    output_iteration_duration();
+                    break;
+                }
+            } else if (delta < std::numeric_limits<real_type>::epsilon() * max_delta) {
+                // the residual norm decreased by more than sqrt(machine epsilon) since the last replacement
+                replace_residual();
+                replaced = true;
+            }
+            max_delta = std::max(max_delta, delta);
+            // report the progress and stop with the current iterate if the CG has been cancelled
+            if (options.monitor.report(iter + 1, max_iter, delta, delta0, eps)) {
+                output_iteration_duration();
+                break;
+            }
+
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta / delta_old;
+            // d = beta * d + r
+            d = beta * d + r;
+            // s = beta * s + w
+            s = beta * s + w;
+            // (alpha = delta_new / (d^T * A * d)); after a residual replacement the recurrence isn't valid, so calculate it explicitly
+            alpha_cd = replaced ? delta / (transposed{ d } * s) : delta / (mu - beta * delta / alpha_cd);
+
+            output_iteration_duration();
+        }
+    }
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Finished after {}/{} iterations with a residuum of {} (target: {}) and an average iteration time of {}.\n",
+                detail::tracking_entry{ "cg", "iterations", std::min(iter + 1, max_iter) },
+                detail::tracking_entry{ "cg", "max_iterations", max_iter },
+                detail::tracking_entry{ "cg", "residuum", delta },
+                detail::tracking_entry{ "cg", "target_residuum", eps * eps * delta0 },
+                detail::tracking_entry{ "cg", "avg_iteration_time", average_iteration_time / std::min(iter + 1, max_iter) });
+    if (options.solver == solver_type::single_reduction_cg) {
+        detail::log(verbosity_level::full,
+                    "Replaced the recursively updated residual {} times.\n",
+                    detail::tracking_entry{ "cg", "residual_replacements", num_residual_replacements });
+    }
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "epsilon", eps }));
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "solver", options.solver }));
+    detail::log(verbosity_level::libsvm,
+                "optimization finished, #iter = {}\n", std::min(iter + 1, max_iter));
+
+    // calculate bias
+    const real_type bias = b_back_value + QA_cost * sum(alpha) - (transposed{ q } * alpha);
+    alpha.push_back(-sum(alpha));
+
+    return std::make_pair(std::move(alpha), -bias);
+}
+
+template std::pair<std::vector<float>, float> csvm::solve_system_of_linear_equations_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const float, const unsigned long long, const detail::solve_options<float> &) const;
+template std::pair<std::vector<double>, double> csvm::solve_system_of_linear_equations_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const double, const unsigned long long, const detail::solve_options<double> &) const;
+
+template <typename real_type>
+std::vector<std::pair<std::vector<real_type>, real_type>> csvm::solve_system_of_linear_equations_cost_path_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const std::vector<real_type> &cost_values, const real_type eps, const unsigned long long max_iter) const {
+    PLSSVM_ASSERT(!A.empty(), "The data must not be empty!");
+    PLSSVM_ASSERT(!A.front().empty(), "The data points must contain at least one feature!");
+    PLSSVM_ASSERT(std::all_of(A.cbegin(), A.cend(), [&A](const std::vector<real_type> &data_point) { return data_point.size() == A.front().size(); }), "All data points must have the same number of features!");
+    PLSSVM_ASSERT(A.size() == b.size(), "The number of data points in the matrix A ({}) and the values in the right hand side vector ({}) must be the same!", A.size(), b.size());
+    PLSSVM_ASSERT(!cost_values.empty(), "At least one cost value must be given!");
+    PLSSVM_ASSERT(std::all_of(cost_values.cbegin(), cost_values.cend(), [](const real_type cost_value) { return cost_value > real_type{ 0.0 }; }), "All cost values must be greater than 0.0!");
+    PLSSVM_ASSERT(eps > real_type{ 0.0 }, "The stopping criterion in the CG algorithm must be greater than 0.0, but is {}!", eps);
+    PLSSVM_ASSERT(max_iter > 0, "The number of CG iterations must be greater than 0!");
+
+    // the shifted systems are solved using the dense kernel matrix, i.e., the kernel matrix approximations aren't supported
+    if (hodlr_tolerance_ > 0.0 || rbf_cutoff_ > 0.0) {
+        throw invalid_parameter_exception{ "The cost path can't be combined with the HODLR approximation (hodlr_tolerance) or the rbf truncation (rbf_cutoff)!" };
+    }
+
+    using namespace plssvm::operators;
+    using size_type = typename std::vector<real_type>::size_type;
+
+    const size_type num_systems = cost_values.size();
+
+    // the system with the largest cost value (= smallest shift) converges the slowest -> use it as seed system
+    detail::parameter<real_type> seed_params{ params };
+    seed_params.cost = *std::max_element(cost_values.cbegin(), cost_values.cend());
+
+    // create q vector
+    const std::vector<real_type> q = this->generate_q(params, A);
+
+    // calculate QA_costs of the seed system
+    const real_type kernel_back = kernel_function(A.back(), A.back(), params);
+    const real_type QA_cost = kernel_back + real_type{ 1.0 } / seed_params.cost;
+
+    // update b
+    const real_type b_back_value = b.back();
+    b.pop_back();
+    b -= b_back_value;
+
+    const size_type dept = b.size();
+
+    // sanity checks
+    PLSSVM_ASSERT(dept == A.size() - 1, "Sizes mismatch!: {} != {}", dept, A.size() - 1);
+
+    // the cost value only changes the reduced matrix by (1 / cost) * M with M = I + e * e^T
+    // -> preconditioning with M^-1 = I - e * e^T / (1 + dept) results in systems that only differ by a multiple of the identity matrix
+    const auto apply_preconditioner = [dept](const std::vector<real_type> &vec) {
+        return vec - sum(vec) / (real_type{ 1.0 } + static_cast<real_type>(dept));
+    };
+    // the shifts of all systems relative to the seed system
+    std::vector<real_type> shifts(num_systems);
+    for (size_type i = 0; i < num_systems; ++i) {
+        shifts[i] = real_type{ 1.0 } / cost_values[i] - real_type{ 1.0 } / seed_params.cost;
+    }
+
+    // CG
+
+    // all systems start with x = 0 such that their initial residuals are collinear
+    std::vector<std::vector<real_type>> alpha(num_systems, std::vector<real_type>(dept, real_type{ 0.0 }));
+
+    std::vector<real_type> r(b);
+    std::vector<real_type> z = apply_preconditioner(r);
+
+    // delta = r.T * z
+    real_type delta = transposed{ r } * z;
+    // residuum = r.T * r
+    real_type residuum = transposed{ r } * r;
+    const real_type residuum0 = residuum;
+    std::vector<real_type> Ad(dept);
+
+    std::vector<real_type> d(z);
+    std::vector<std::vector<real_type>> d_shifted(num_systems, z);
+
+    // the residual of the i-th system is zeta[i] * r
+    std::vector<real_type> zeta(num_systems, real_type{ 1.0 });
+    std::vector<real_type> zeta_old(num_systems, real_type{ 1.0 });
+    std::vector<bool> converged(num_systems, false);
+    size_type num_converged = 0;
+    real_type alpha_cd_old{ 1.0 };
+    real_type beta_old{ 0.0 };
+
+    // timing for each CG iteration
+    std::chrono::milliseconds average_iteration_time{};
+    std::chrono::steady_clock::time_point iteration_start_time{};
+    const auto output_iteration_duration = [&]() {
+        const std::chrono::time_point iteration_end_time = std::chrono::steady_clock::now();
+        const auto iteration_duration = std::chrono::duration_cast<std::chrono::milliseconds>(iteration_end_time - iteration_start_time);
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Done in {}.\n", iteration_duration);
+        average_iteration_time += iteration_duration;
+    };
+
     unsigned long long iter = 0;
     for (; iter < max_iter; ++iter) {
         detail::log(verbosity_level::full | verbosity_level::timing,
-                    "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+                    "Start Iteration {} (max: {}) with {}/{} converged systems and current seed residuum {} (target: {}). ", iter + 1, max_iter, num_converged, num_systems, residuum, eps * eps * residuum0);
         iteration_start_time = std::chrono::steady_clock::now();
 
-        // Ad = A * d (q = A * d)
+        // Ad = A * d (q = A * d) -> the only matrix-vector multiplication, shared by all systems
         std::fill(Ad.begin(), Ad.end(), real_type{ 0.0 });
-        run_device_kernel(params, q, Ad, d, A, QA_cost, real_type{ 1.0 });
+        run_device_kernel(seed_params, q, Ad, d, A, QA_cost, real_type{ 1.0 });
 
         // (alpha = delta_new / (d^T * q))
         const real_type alpha_cd = delta / (transposed{ d } * Ad);
 
-        // (x = x + alpha * d)
-        alpha += alpha_cd * d;
-
-        if (iter % 50 == 49) {
-            // (r = b - A * x)
-            // r = b
-            r = b;
-            // r -= A * x
-            run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 });
-        } else {
-            // r -= alpha_cd * Ad (r = r - alpha * q)
-            r -= alpha_cd * Ad;
+        // update the solutions of all not yet converged systems using the scalar recurrences
+        for (size_type i = 0; i < num_systems; ++i) {
+            if (converged[i]) {
+                continue;
+            }
+            const real_type zeta_new = zeta[i] * zeta_old[i] * alpha_cd_old / (alpha_cd * beta_old * (zeta_old[i] - zeta[i]) + zeta_old[i] * alpha_cd_old * (real_type{ 1.0 } + shifts[i] * alpha_cd));
+            // (x_i = x_i + alpha_i * d_i)
+            alpha[i] += (alpha_cd * zeta_new / zeta[i]) * d_shifted[i];
+            zeta_old[i] = zeta[i];
+            zeta[i] = zeta_new;
         }
 
-        // (delta = r^T * r)
+        // r -= alpha_cd * Ad (r = r - alpha * q); no periodic recalculation since it would break the collinearity of the residuals
+        r -= alpha_cd * Ad;
+        z = apply_preconditioner(r);
+
+        // (delta = r^T * z)
         const real_type delta_old = delta;
-        delta = transposed{ r } * r;
-        // if we are exact enough stop CG iterations
-        if (delta <= eps * eps * delta0) {
+        delta = transposed{ r } * z;
+        residuum = transposed{ r } * r;
+        // if a system is exact enough stop updating it
+        for (size_type i = 0; i < num_systems; ++i) {
+            if (!converged[i] && zeta[i] * zeta[i] * residuum <= eps * eps * residuum0) {
+                converged[i] = true;
+                ++num_converged;
+            }
+        }
+        if (num_converged == num_systems) {
             output_iteration_duration();
             break;
         }
 
         // (beta = delta_new / delta_old)
         const real_type beta = delta / delta_old;
-        // d = beta * d + r
-        d = beta * d + r;
+        // d_i = beta_i * d_i + zeta_i * z
+        for (size_type i = 0; i < num_systems; ++i) {
+            if (!converged[i]) {
+                const real_type zeta_ratio = zeta[i] / zeta_old[i];
+                d_shifted[i] = (beta * zeta_ratio * zeta_ratio) * d_shifted[i] + zeta[i] * z;
+            }
+        }
+        // d = beta * d + z
+        d = beta * d + z;
+
+        alpha_cd_old = alpha_cd;
+        beta_old = beta;
 
         output_iteration_duration();
     }
     detail::log(verbosity_level::full | verbosity_level::timing,
-                "Finished after {}/{} iterations with a residuum of {} (target: {}) and an average iteration time of {}.\n",
+                "Finished after {}/{} iterations for {} systems with a seed residuum of {} (target: {}) and an average iteration time of {}.\n",
                 detail::tracking_entry{ "cg", "iterations", std::min(iter + 1, max_iter) },
                 detail::tracking_entry{ "cg", "max_iterations", max_iter },
-                detail::tracking_entry{ "cg", "residuum", delta },
-                detail::tracking_entry{ "cg", "target_residuum", eps * eps * delta0 },
+                detail::tracking_entry{ "cg", "num_systems", num_systems },
+                detail::tracking_entry{ "cg", "residuum", residuum },
+                detail::tracking_entry{ "cg", "target_residuum", eps * eps * residuum0 },
                 detail::tracking_entry{ "cg", "avg_iteration_time", average_iteration_time / std::min(iter + 1, max_iter) });
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "epsilon", eps }));
     detail::log(verbosity_level::libsvm,
                 "optimization finished, #iter = {}\n", std::min(iter + 1, max_iter));
 
-    // calculate bias
-    const real_type bias = b_back_value + QA_cost * sum(alpha) - (transposed{ q } * alpha);
-    alpha.push_back(-sum(alpha));
-
-    return std::make_pair(std::move(alpha), -bias);
+    // calculate the bias for each system
+    std::vector<std::pair<std::vector<real_type>, real_type>> solutions;
+    solutions.reserve(num_systems);
+    for (size_type i = 0; i < num_systems; ++i) {
+        const real_type QA_cost_i = kernel_back + real_type{ 1.0 } / cost_values[i];
+        const real_type bias = b_back_value + QA_cost_i * sum(alpha[i]) - (transposed{ q } * alpha[i]);
+        alpha[i].push_back(-sum(alpha[i]));
+        solutions.emplace_back(std::move(alpha[i]), -bias);
+    }
+    return solutions;
 }
 
-template std::pair<std::vector<float>, float> csvm::solve_system_of_linear_equations_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const float, const unsigned long long) const;
-template std::pair<std::vector<double>, double> csvm::solve_system_of_linear_equations_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const double, const unsigned long long) const;
+template std::vector<std::pair<std::vector<float>, float>> csvm::solve_system_of_linear_equations_cost_path_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const std::vector<float> &, const float, const unsigned long long) const;
+template std::vector<std::pair<std::vector<double>, double>> csvm::solve_system_of_linear_equations_cost_path_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const std::vector<double> &, const double, const unsigned long long) const;
 
 template <typename real_type>
 std::vector<real_type> csvm::predict_values_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const real_type rho, std::vector<real_type> &w, const std::vector<std::vector<real_type>> &predict_points) const {
@@ -283,7 +668,7 @@ template std::vector<float> csvm::calculate_w(const std::vector<std::vector<floa
 template std::vector<double> csvm::calculate_w(const std::vector<std::vector<double>> &, const std::vector<double> &) const;
 
 template <typename real_type>
-void csvm::run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type add) const {
+void csvm::run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type add, const hodlr_matrix<real_type> *compressed, const sparse_kernel_matrix<real_type> *truncated) const {
     PLSSVM_ASSERT(!q.empty(), "The q array may not be empty!");
     PLSSVM_ASSERT(!ret.empty(), "The ret array may not be empty!");
     PLSSVM_ASSERT(!d.empty(), "The d array may not be empty!");
@@ -292,6 +677,17 @@ void csvm::run_device_kernel(const detail::parameter<real_type> &params, const s
     PLSSVM_ASSERT(std::all_of(data.cbegin(), data.cend(), [](const std::vector<real_type> &features) { return !features.empty(); }), "All data point must have exactly the same number of features!");
     PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either by -1.0 or 1.0, but is {}!", add);
 
+    // use the compressed kernel matrix if available
+    if (compressed != nullptr) {
+        compressed->multiply(q, ret, d, QA_cost, 1 / params.cost, add);
+        return;
+    }
+    // use the truncated kernel matrix if available
+    if (truncated != nullptr) {
+        truncated->multiply(q, ret, d, QA_cost, 1 / params.cost, add);
+        return;
+    }
+
     switch (params.kernel_type) {
         case kernel_function_type::linear:
             openmp::device_kernel_linear(q, ret, d, data, QA_cost, 1 / params.cost, add);
@@ -304,7 +700,7 @@ void csvm::run_device_kernel(const detail::parameter<real_type> &params, const s
             break;
     }
 }
-template void csvm::run_device_kernel(const detail::parameter<float> &, const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float) const;
-template void csvm::run_device_kernel(const detail::parameter<double> &, const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double) const;
+template void csvm::run_device_kernel(const detail::parameter<float> &, const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, const hodlr_matrix<float> *, const sparse_kernel_matrix<float> *) const;
+template void csvm::run_device_kernel(const detail::parameter<double> &, const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, const hodlr_matrix<double> *, const sparse_kernel_matrix<double> *) const;
 
 }  // namespace plssvm::openmp
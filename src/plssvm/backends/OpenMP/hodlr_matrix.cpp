@@ -0,0 +1,316 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/hodlr_matrix.hpp"
+
+#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function
+#include "plssvm/parameter.hpp"              // plssvm::detail::parameter
+
+#include <algorithm>                         // std::nth_element, std::minmax_element, std::all_of, std::find, std::min, std::max
+#include <cmath>                             // std::abs, std::sqrt
+#include <cstddef>                           // std::size_t
+#include <numeric>                           // std::iota
+#include <vector>                            // std::vector
+
+namespace plssvm::openmp {
+
+template <typename T>
+hodlr_matrix<T>::hodlr_matrix(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, const real_type tolerance, const size_type leaf_size) :
+    params_{ params }, tolerance_{ tolerance } {
+    PLSSVM_ASSERT(data.size() > 1, "At least two data points must be given!");
+    PLSSVM_ASSERT(tolerance > real_type{ 0.0 }, "The tolerance must be greater than 0.0, but is {}!", tolerance);
+    PLSSVM_ASSERT(leaf_size > 0, "The leaf size must be greater than 0!");
+
+    // the last data point is removed in the dimensional reduction
+    permutation_.resize(data.size() - 1);
+    std::iota(permutation_.begin(), permutation_.end(), 0);
+
+    // build the cluster tree starting with the root representing all data points
+    nodes_.push_back(node{ 0, permutation_.size() });
+    this->build_cluster_tree(data, 0, 0, leaf_size);
+
+    // a single leaf is the dense kernel matrix
+    if (nodes_.front().is_leaf()) {
+        return;
+    }
+
+    // compress all off-diagonal blocks and calculate the dense diagonal blocks
+    const std::vector<size_type> &permutation = permutation_;
+    const detail::parameter<real_type> &kernel_params = params_;
+    std::vector<int> success(nodes_.size(), 1);
+    #pragma omp parallel for schedule(dynamic)
+    for (size_type i = 0; i < nodes_.size(); ++i) {
+        node &n = nodes_[i];
+        if (n.is_leaf()) {
+            const size_type size = n.end - n.begin;
+            n.u.resize(size * size);
+            for (size_type row = 0; row < size; ++row) {
+                for (size_type col = row; col < size; ++col) {
+                    const real_type value = kernel_function(data[permutation[n.begin + row]], data[permutation[n.begin + col]], kernel_params);
+                    n.u[row * size + col] = value;
+                    n.u[col * size + row] = value;
+                }
+            }
+        } else {
+            success[i] = this->compress(data, n) ? 1 : 0;
+        }
+    }
+
+    compressed_ = std::all_of(success.cbegin(), success.cend(), [](const int s) { return s == 1; });
+    if (!compressed_) {
+        // release the memory of the unusable approximation
+        nodes_.clear();
+        levels_.clear();
+        return;
+    }
+    for (const node &n : nodes_) {
+        max_rank_ = std::max(max_rank_, n.rank);
+    }
+}
+
+template <typename T>
+void hodlr_matrix<T>::build_cluster_tree(const std::vector<std::vector<real_type>> &data, const size_type node_idx, const size_type level, const size_type leaf_size) {
+    if (levels_.size() <= level) {
+        levels_.emplace_back();
+    }
+    levels_[level].push_back(node_idx);
+
+    const size_type begin = nodes_[node_idx].begin;
+    const size_type end = nodes_[node_idx].end;
+    if (end - begin <= leaf_size) {
+        return;
+    }
+
+    // split along the feature with the largest spread
+    size_type split_feature = 0;
+    real_type max_spread{ -1.0 };
+    for (size_type feature = 0; feature < data.front().size(); ++feature) {
+        const auto [min, max] = std::minmax_element(permutation_.cbegin() + begin, permutation_.cbegin() + end, [&](const size_type lhs, const size_type rhs) { return data[lhs][feature] < data[rhs][feature]; });
+        const real_type spread = data[*max][feature] - data[*min][feature];
+        if (spread > max_spread) {
+            max_spread = spread;
+            split_feature = feature;
+        }
+    }
+
+    // bisect at the median
+    const size_type mid = begin + (end - begin) / 2;
+    std::nth_element(permutation_.begin() + begin, permutation_.begin() + mid, permutation_.begin() + end, [&](const size_type lhs, const size_type rhs) { return data[lhs][split_feature] < data[rhs][split_feature]; });
+
+    nodes_.push_back(node{ begin, mid });
+    nodes_[node_idx].left = nodes_.size() - 1;
+    nodes_.push_back(node{ mid, end });
+    nodes_[node_idx].right = nodes_.size() - 1;
+
+    // note: nodes_ may reallocate, i.e., the child indices must be read again
+    this->build_cluster_tree(data, nodes_[node_idx].left, level + 1, leaf_size);
+    this->build_cluster_tree(data, nodes_[node_idx].right, level + 1, leaf_size);
+}
+
+template <typename T>
+bool hodlr_matrix<T>::compress(const std::vector<std::vector<real_type>> &data, node &n) const {
+    const size_type row_offset = nodes_[n.left].begin;
+    const size_type num_rows = nodes_[n.left].end - row_offset;
+    const size_type col_offset = nodes_[n.right].begin;
+    const size_type num_cols = nodes_[n.right].end - col_offset;
+    // a compression with a larger rank doesn't save any work compared to the dense block
+    const size_type max_rank = std::max<size_type>(std::min(num_rows, num_cols) / 2, 1);
+
+    std::vector<bool> used_rows(num_rows, false);
+    std::vector<bool> used_cols(num_cols, false);
+    std::vector<real_type> row(num_cols);
+    std::vector<real_type> col(num_rows);
+    // the squared Frobenius norm of the current approximation
+    real_type approx_norm_sq{ 0.0 };
+    size_type pivot_row = 0;
+
+    n.rank = 0;
+    while (true) {
+        used_rows[pivot_row] = true;
+
+        // calculate the residual row
+        for (size_type j = 0; j < num_cols; ++j) {
+            row[j] = kernel_function(data[permutation_[row_offset + pivot_row]], data[permutation_[col_offset + j]], params_);
+            for (size_type l = 0; l < n.rank; ++l) {
+                row[j] -= n.u[l * num_rows + pivot_row] * n.v[l * num_cols + j];
+            }
+        }
+        // find the column pivot
+        size_type pivot_col = num_cols;
+        real_type pivot_abs{ 0.0 };
+        for (size_type j = 0; j < num_cols; ++j) {
+            if (!used_cols[j] && std::abs(row[j]) > pivot_abs) {
+                pivot_abs = std::abs(row[j]);
+                pivot_col = j;
+            }
+        }
+        if (pivot_col == num_cols) {
+            // the residual row vanishes -> try the next unused row
+            const auto next_row = std::find(used_rows.cbegin(), used_rows.cend(), false);
+            if (next_row == used_rows.cend()) {
+                // all rows are exactly reproduced
+                break;
+            }
+            pivot_row = static_cast<size_type>(next_row - used_rows.cbegin());
+            continue;
+        }
+        if (n.rank == max_rank) {
+            // the block isn't compressible to the requested tolerance
+            return false;
+        }
+        used_cols[pivot_col] = true;
+
+        // calculate the residual column
+        for (size_type i = 0; i < num_rows; ++i) {
+            col[i] = kernel_function(data[permutation_[row_offset + i]], data[permutation_[col_offset + pivot_col]], params_);
+            for (size_type l = 0; l < n.rank; ++l) {
+                col[i] -= n.u[l * num_rows + i] * n.v[l * num_cols + pivot_col];
+            }
+        }
+
+        // update the norm of the approximation: ||S_k||^2 = ||S_k-1||^2 + 2 sum_l (u_l^T u_k)(v_l^T v_k) + ||u_k||^2 ||v_k||^2
+        const real_type pivot = row[pivot_col];
+        real_type u_norm_sq{ 0.0 };
+        real_type v_norm_sq{ 0.0 };
+        for (size_type i = 0; i < num_rows; ++i) {
+            u_norm_sq += col[i] * col[i];
+        }
+        for (size_type j = 0; j < num_cols; ++j) {
+            row[j] /= pivot;
+            v_norm_sq += row[j] * row[j];
+        }
+        for (size_type l = 0; l < n.rank; ++l) {
+            real_type uu{ 0.0 };
+            real_type vv{ 0.0 };
+            for (size_type i = 0; i < num_rows; ++i) {
+                uu += n.u[l * num_rows + i] * col[i];
+            }
+            for (size_type j = 0; j < num_cols; ++j) {
+                vv += n.v[l * num_cols + j] * row[j];
+            }
+            approx_norm_sq += 2 * uu * vv;
+        }
+        approx_norm_sq += u_norm_sq * v_norm_sq;
+
+        // append the new cross
+        n.u.insert(n.u.end(), col.cbegin(), col.cend());
+        n.v.insert(n.v.end(), row.cbegin(), row.cend());
+        ++n.rank;
+
+        // check the stopping criterion
+        if (std::sqrt(u_norm_sq * v_norm_sq) <= tolerance_ * std::sqrt(approx_norm_sq)) {
+            break;
+        }
+
+        // the next row pivot is the largest unused entry in the new column
+        pivot_row = num_rows;
+        real_type row_pivot_abs{ -1.0 };
+        for (size_type i = 0; i < num_rows; ++i) {
+            if (!used_rows[i] && std::abs(col[i]) > row_pivot_abs) {
+                row_pivot_abs = std::abs(col[i]);
+                pivot_row = i;
+            }
+        }
+        if (pivot_row == num_rows) {
+            break;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void hodlr_matrix<T>::multiply(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type QA_cost, const real_type cost, const real_type add) const {
+    PLSSVM_ASSERT(compressed_, "Can't use an uncompressed HODLR matrix!");
+    PLSSVM_ASSERT(q.size() == this->num_rows(), "Sizes mismatch!: {} != {}", q.size(), this->num_rows());
+    PLSSVM_ASSERT(q.size() == ret.size(), "Sizes mismatch!: {} != {}", q.size(), ret.size());
+    PLSSVM_ASSERT(q.size() == d.size(), "Sizes mismatch!: {} != {}", q.size(), d.size());
+    PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either be -1.0 or 1.0, but is {}!", add);
+
+    const size_type size = this->num_rows();
+    const std::vector<size_type> &permutation = permutation_;
+    const std::vector<node> &nodes = nodes_;
+
+    // permute the right-hand side according to the cluster tree
+    std::vector<real_type> x(size);
+    std::vector<real_type> y(size, real_type{ 0.0 });
+    #pragma omp parallel for default(none) shared(x, d, permutation) firstprivate(size)
+    for (size_type i = 0; i < size; ++i) {
+        x[i] = d[permutation[i]];
+    }
+
+    // all clusters on the same level are disjoint and, therefore, can be processed in parallel
+    for (const std::vector<size_type> &level : levels_) {
+        #pragma omp parallel for schedule(dynamic) default(none) shared(level, nodes, x, y)
+        for (size_type idx = 0; idx < level.size(); ++idx) {
+            const node &n = nodes[level[idx]];
+            if (n.is_leaf()) {
+                // y_n += K_nn * x_n
+                const size_type block_size = n.end - n.begin;
+                for (size_type row = 0; row < block_size; ++row) {
+                    real_type temp{ 0.0 };
+                    for (size_type col = 0; col < block_size; ++col) {
+                        temp += n.u[row * block_size + col] * x[n.begin + col];
+                    }
+                    y[n.begin + row] += temp;
+                }
+            } else {
+                // y_L += U V^T x_R and y_R += V U^T x_L
+                const node &lhs = nodes[n.left];
+                const node &rhs = nodes[n.right];
+                const size_type num_rows = lhs.end - lhs.begin;
+                const size_type num_cols = rhs.end - rhs.begin;
+                for (size_type l = 0; l < n.rank; ++l) {
+                    real_type v_x{ 0.0 };
+                    for (size_type j = 0; j < num_cols; ++j) {
+                        v_x += n.v[l * num_cols + j] * x[rhs.begin + j];
+                    }
+                    real_type u_x{ 0.0 };
+                    for (size_type i = 0; i < num_rows; ++i) {
+                        u_x += n.u[l * num_rows + i] * x[lhs.begin + i];
+                    }
+                    for (size_type i = 0; i < num_rows; ++i) {
+                        y[lhs.begin + i] += n.u[l * num_rows + i] * v_x;
+                    }
+                    for (size_type j = 0; j < num_cols; ++j) {
+                        y[rhs.begin + j] += n.v[l * num_cols + j] * u_x;
+                    }
+                }
+            }
+        }
+    }
+
+    // add the terms of the dimensional reduction: (K + QA_cost - q_i - q_j + cost * I) * d
+    real_type d_sum{ 0.0 };
+    real_type q_d{ 0.0 };
+    #pragma omp parallel for default(none) shared(q, d) firstprivate(size) reduction(+ : d_sum, q_d)
+    for (size_type i = 0; i < size; ++i) {
+        d_sum += d[i];
+        q_d += q[i] * d[i];
+    }
+    #pragma omp parallel for default(none) shared(q, ret, d, y, permutation) firstprivate(size, QA_cost, cost, add, d_sum, q_d)
+    for (size_type i = 0; i < size; ++i) {
+        const size_type pi = permutation[i];
+        ret[pi] += add * (y[i] + (QA_cost - q[pi]) * d_sum - q_d + cost * d[pi]);
+    }
+}
+
+template <typename T>
+double hodlr_matrix<T>::memory_ratio() const noexcept {
+    size_type num_entries = 0;
+    for (const node &n : nodes_) {
+        num_entries += n.u.size() + n.v.size();
+    }
+    const auto size = static_cast<double>(this->num_rows());
+    return static_cast<double>(num_entries) / (size * size);
+}
+
+template class hodlr_matrix<float>;
+template class hodlr_matrix<double>;
+
+}  // namespace plssvm::openmp
@@ -0,0 +1,200 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/sparse_kernel_matrix.hpp"
+
+#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type, plssvm::kernel_function
+#include "plssvm/parameter.hpp"              // plssvm::detail::parameter
+
+#include <algorithm>                         // std::nth_element, std::minmax_element, std::max
+#include <cmath>                             // std::exp, std::log
+#include <cstddef>                           // std::size_t
+#include <numeric>                           // std::iota
+#include <utility>                           // std::move
+#include <vector>                            // std::vector
+
+namespace plssvm::openmp {
+
+template <typename T>
+sparse_kernel_matrix<T>::sparse_kernel_matrix(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, const real_type cutoff, const size_type tile_size) {
+    PLSSVM_ASSERT(params.kernel_type == kernel_function_type::rbf, "The truncated kernel matrix can only be used with the rbf kernel!");
+    PLSSVM_ASSERT(data.size() > 1, "At least two data points must be given!");
+    PLSSVM_ASSERT(cutoff > real_type{ 0.0 } && cutoff < real_type{ 1.0 }, "The cutoff must be in the range (0.0, 1.0), but is {}!", cutoff);
+    PLSSVM_ASSERT(tile_size > 0, "The tile size must be greater than 0!");
+
+    // the last data point is removed in the dimensional reduction
+    permutation_.resize(data.size() - 1);
+    std::iota(permutation_.begin(), permutation_.end(), 0);
+
+    // reorder the data points using a k-d tree such that spatially close data points are contiguous
+    this->build_tiles(data, 0, permutation_.size(), tile_size);
+
+    // all tile pairs whose bounding boxes are further apart than this (squared) radius only contain kernel matrix entries smaller than the cutoff
+    const real_type gamma = params.gamma.value();
+    const real_type radius_sq = -std::log(cutoff) / gamma;
+    const size_type num_features = data.front().size();
+    const size_type num_tiles = tiles_.size();
+
+    blocks_.resize(num_tiles);
+    dropped_mass_.resize(num_tiles);
+
+    const std::vector<size_type> &permutation = permutation_;
+    const std::vector<tile> &tiles = tiles_;
+    #pragma omp parallel for schedule(dynamic)
+    for (size_type i = 0; i < num_tiles; ++i) {
+        const tile &row_tile = tiles[i];
+        const size_type num_rows = row_tile.end - row_tile.begin;
+        real_type dropped{ 0.0 };
+        for (size_type j = 0; j < num_tiles; ++j) {
+            const tile &col_tile = tiles[j];
+            const size_type num_cols = col_tile.end - col_tile.begin;
+
+            // the squared distance between the two bounding boxes is a lower bound of the squared distance between any two data points in the tiles
+            real_type box_dist_sq{ 0.0 };
+            for (size_type f = 0; f < num_features; ++f) {
+                const real_type gap = std::max({ real_type{ 0.0 }, col_tile.lower[f] - row_tile.upper[f], row_tile.lower[f] - col_tile.upper[f] });
+                box_dist_sq += gap * gap;
+            }
+            if (box_dist_sq > radius_sq) {
+                // drop the whole tile pair; each of its entries is at most exp(-gamma * box_dist_sq)
+                dropped += static_cast<real_type>(num_rows * num_cols) * std::exp(-gamma * box_dist_sq);
+                continue;
+            }
+
+            // calculate the dense kernel matrix block
+            block b{ j, std::vector<real_type>(num_rows * num_cols) };
+            for (size_type row = 0; row < num_rows; ++row) {
+                for (size_type col = 0; col < num_cols; ++col) {
+                    b.values[row * num_cols + col] = kernel_function(data[permutation[row_tile.begin + row]], data[permutation[col_tile.begin + col]], params);
+                }
+            }
+            blocks_[i].push_back(std::move(b));
+        }
+        dropped_mass_[i] = dropped;
+    }
+}
+
+template <typename T>
+void sparse_kernel_matrix<T>::build_tiles(const std::vector<std::vector<real_type>> &data, const size_type begin, const size_type end, const size_type tile_size) {
+    const size_type num_features = data.front().size();
+
+    // calculate the bounding box of the current cluster
+    tile t{ begin, end, std::vector<real_type>(num_features), std::vector<real_type>(num_features) };
+    size_type split_feature = 0;
+    real_type max_spread{ -1.0 };
+    for (size_type feature = 0; feature < num_features; ++feature) {
+        const auto [min, max] = std::minmax_element(permutation_.cbegin() + begin, permutation_.cbegin() + end, [&](const size_type lhs, const size_type rhs) { return data[lhs][feature] < data[rhs][feature]; });
+        t.lower[feature] = data[*min][feature];
+        t.upper[feature] = data[*max][feature];
+        if (t.upper[feature] - t.lower[feature] > max_spread) {
+            max_spread = t.upper[feature] - t.lower[feature];
+            split_feature = feature;
+        }
+    }
+
+    if (end - begin <= tile_size) {
+        tiles_.push_back(std::move(t));
+        return;
+    }
+
+    // bisect at the median of the feature with the largest spread
+    const size_type mid = begin + (end - begin) / 2;
+    std::nth_element(permutation_.begin() + begin, permutation_.begin() + mid, permutation_.begin() + end, [&](const size_type lhs, const size_type rhs) { return data[lhs][split_feature] < data[rhs][split_feature]; });
+
+    this->build_tiles(data, begin, mid, tile_size);
+    this->build_tiles(data, mid, end, tile_size);
+}
+
+template <typename T>
+void sparse_kernel_matrix<T>::multiply(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const real_type QA_cost, const real_type cost, const real_type add) const {
+    PLSSVM_ASSERT(q.size() == this->num_rows(), "Sizes mismatch!: {} != {}", q.size(), this->num_rows());
+    PLSSVM_ASSERT(q.size() == ret.size(), "Sizes mismatch!: {} != {}", q.size(), ret.size());
+    PLSSVM_ASSERT(q.size() == d.size(), "Sizes mismatch!: {} != {}", q.size(), d.size());
+    PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either be -1.0 or 1.0, but is {}!", add);
+
+    const size_type size = this->num_rows();
+    const std::vector<size_type> &permutation = permutation_;
+    const std::vector<tile> &tiles = tiles_;
+    const std::vector<std::vector<block>> &blocks = blocks_;
+
+    // permute the right-hand side according to the k-d tree
+    std::vector<real_type> x(size);
+    std::vector<real_type> y(size, real_type{ 0.0 });
+    #pragma omp parallel for default(none) shared(x, d, permutation) firstprivate(size)
+    for (size_type i = 0; i < size; ++i) {
+        x[i] = d[permutation[i]];
+    }
+
+    // each row tile only writes to its own part of the result
+    #pragma omp parallel for schedule(dynamic) default(none) shared(tiles, blocks, x, y)
+    for (size_type i = 0; i < tiles.size(); ++i) {
+        const tile &row_tile = tiles[i];
+        const size_type num_rows = row_tile.end - row_tile.begin;
+        for (const block &b : blocks[i]) {
+            const tile &col_tile = tiles[b.col_tile];
+            const size_type num_cols = col_tile.end - col_tile.begin;
+            for (size_type row = 0; row < num_rows; ++row) {
+                real_type temp{ 0.0 };
+                for (size_type col = 0; col < num_cols; ++col) {
+                    temp += b.values[row * num_cols + col] * x[col_tile.begin + col];
+                }
+                y[row_tile.begin + row] += temp;
+            }
+        }
+    }
+
+    // add the terms of the dimensional reduction: (K + QA_cost - q_i - q_j + cost * I) * d
+    real_type d_sum{ 0.0 };
+    real_type q_d{ 0.0 };
+    #pragma omp parallel for default(none) shared(q, d) firstprivate(size) reduction(+ : d_sum, q_d)
+    for (size_type i = 0; i < size; ++i) {
+        d_sum += d[i];
+        q_d += q[i] * d[i];
+    }
+    #pragma omp parallel for default(none) shared(q, ret, d, y, permutation) firstprivate(size, QA_cost, cost, add, d_sum, q_d)
+    for (size_type i = 0; i < size; ++i) {
+        const size_type pi = permutation[i];
+        ret[pi] += add * (y[i] + (QA_cost - q[pi]) * d_sum - q_d + cost * d[pi]);
+    }
+}
+
+template <typename T>
+auto sparse_kernel_matrix<T>::num_blocks() const noexcept -> size_type {
+    size_type num_blocks = 0;
+    for (const std::vector<block> &row_blocks : blocks_) {
+        num_blocks += row_blocks.size();
+    }
+    return num_blocks;
+}
+
+template <typename T>
+double sparse_kernel_matrix<T>::density() const noexcept {
+    size_type num_entries = 0;
+    for (const std::vector<block> &row_blocks : blocks_) {
+        for (const block &b : row_blocks) {
+            num_entries += b.values.size();
+        }
+    }
+    const auto size = static_cast<double>(this->num_rows());
+    return static_cast<double>(num_entries) / (size * size);
+}
+
+template <typename T>
+auto sparse_kernel_matrix<T>::max_dropped_row_mass() const noexcept -> real_type {
+    real_type max_mass{ 0.0 };
+    for (size_type i = 0; i < tiles_.size(); ++i) {
+        max_mass = std::max(max_mass, dropped_mass_[i] / static_cast<real_type>(tiles_[i].end - tiles_[i].begin));
+    }
+    return max_mass;
+}
+
+template class sparse_kernel_matrix<float>;
+template class sparse_kernel_matrix<double>;
+
+}  // namespace plssvm::openmp
@@ -0,0 +1,303 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/cmd/parser_grid.hpp"
+
+#include "plssvm/constants.hpp"                 // plssvm::verbose_default, plssvm::verbose
+#include "plssvm/default_value.hpp"             // plssvm::default_value
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/logger.hpp"             // plssvm::verbosity
+#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
+#include "plssvm/detail/utility.hpp"            // plssvm::detail::to_underlying
+#include "plssvm/kernel_function_types.hpp"     // plssvm::kernel_type_to_math_string
+#include "plssvm/version/version.hpp"           // plssvm::version::detail::get_version_info
+
+#include "cxxopts.hpp"                          // cxxopts::Options, cxxopts::value,cxxopts::ParseResult
+#include "fmt/color.h"                          // fmt::fg, fmt::color::orange
+#include "fmt/core.h"                           // fmt::format, fmt::join
+#include "fmt/ostream.h"                        // can use fmt using operator<< overloads
+
+#include <cstdint>                              // std::uintmax_t
+#include <cstdlib>                              // std::exit, EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>                            // std::exception
+#include <filesystem>                           // std::filesystem::path
+#include <iostream>                             // std::cout, std::cerr, std::clog, std::endl
+#include <optional>                             // std::nullopt
+#include <string>                               // std::string
+
+namespace plssvm::detail::cmd {
+
+parser_grid::parser_grid(int argc, char **argv) {
+    // check for basic argc and argv correctness
+    PLSSVM_ASSERT(argc >= 1, fmt::format("At least one argument is always given (the executable name), but argc is {}!", argc));
+    PLSSVM_ASSERT(argv != nullptr, "At least one argument is always given (the executable name), but argv is a nullptr!");
+
+    cxxopts::Options options(argv[0], "LS-SVM with multiple (GPU-)backends");
+    options
+        .positional_help("training_set_file [model_file]")
+        .show_positional_help();
+    options
+        .set_width(150)
+        .set_tab_expansion()
+        // clang-format off
+       .add_options()
+           ("t,kernel_type", "set type of kernel function. \n\t 0 -- linear: u'*v\n\t 1 -- polynomial: (gamma*u'*v + coef0)^degree \n\t 2 -- radial basis function: exp(-gamma*|u-v|^2)", cxxopts::value<typename decltype(csvm_params.kernel_type)::value_type>()->default_value(fmt::format("{}", detail::to_underlying(csvm_params.kernel_type))))
+           ("d,degree", "set degree in kernel function", cxxopts::value<typename decltype(csvm_params.degree)::value_type>()->default_value(fmt::format("{}", csvm_params.degree)))
+           ("r,coef0", "set coef0 in kernel function", cxxopts::value<typename decltype(csvm_params.coef0)::value_type>()->default_value(fmt::format("{}", csvm_params.coef0)))
+           ("g,gamma_values", "comma separated list of the gamma values to test (default: 1 / num_features)", cxxopts::value<decltype(gamma_values)>())
+           ("c,cost_values", fmt::format("comma separated list of the cost values to test (default: {})", csvm_params.cost), cxxopts::value<decltype(cost_values)>())
+           ("e,epsilon", "set the tolerance of termination criterion", cxxopts::value<typename decltype(epsilon)::value_type>()->default_value(fmt::format("{}", epsilon)))
+           ("i,max_iter", "set the maximum number of CG iterations (default: num_features)", cxxopts::value<long long int>())
+           ("validation", "the data file used to score the grid points; if not provided, the training set file is used", cxxopts::value<decltype(validation_filename)>())
+           ("ranking", "the output file where the ranking of all grid points is written to; if not provided, the ranking is only printed", cxxopts::value<decltype(ranking_filename)>())
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+           ("performance_tracking", "the output YAML file where the performance tracking results are written to; if not provided, the results are dumped to stderr", cxxopts::value<decltype(performance_tracking_filename)>())
+#endif
+           ("csv_delimiter", "the character separating the values in a CSV input file", cxxopts::value<decltype(input_options.delimiter)>()->default_value(fmt::format("{}", input_options.delimiter)))
+           ("csv_header", "skip the first line of a CSV input file", cxxopts::value<decltype(input_options.has_header)>()->default_value(fmt::format("{}", input_options.has_header)))
+           ("csv_label_column", "the column of a CSV or NumPy input file containing the labels; negative values count from the last column, \"none\" if the file contains no labels", cxxopts::value<std::string>()->default_value("-1"))
+           ("cache", "cache the parsed content of text input files as memory-mappable binary images to speed up subsequent reads", cxxopts::value<decltype(cache_options.enabled)>()->default_value(fmt::format("{}", cache_options.enabled)))
+           ("cache_dir", "the directory of the data set cache (implies --cache); if not provided, the per-user directory $XDG_CACHE_HOME/plssvm/data_set_cache (or ~/.cache/plssvm/data_set_cache) is used", cxxopts::value<std::string>())
+           ("cache_max_size", "the maximum size of the data set cache in MiB; the least recently used entries are evicted first (0 means no limit)", cxxopts::value<std::uintmax_t>()->default_value(fmt::format("{}", cache_options.max_size / (1024 * 1024))))
+           ("cache_fingerprint", "additionally identify a cached data set by a sha256 fingerprint of samples of the file content", cxxopts::value<decltype(cache_options.fingerprint)>()->default_value(fmt::format("{}", cache_options.fingerprint)))
+           ("use_strings_as_labels", "use strings as labels instead of plane numbers", cxxopts::value<decltype(strings_as_labels)>()->default_value(fmt::format("{}", strings_as_labels)))
+           ("use_float_as_real_type", "use floats as real types instead of doubles", cxxopts::value<decltype(float_as_real_type)>()->default_value(fmt::format("{}", float_as_real_type)))
+           ("verbosity", fmt::format("choose the level of verbosity: full|timing|libsvm|quiet (default: {})", fmt::format("{}", verbosity)), cxxopts::value<verbosity_level>())
+           ("q,quiet", "quiet mode (no outputs regardless the provided verbosity level!)", cxxopts::value<bool>()->default_value(verbosity == verbosity_level::quiet ? "true" : "false"))
+           ("h,help", "print this helper message", cxxopts::value<bool>())
+           ("v,version", "print version information", cxxopts::value<bool>())
+           ("input", "", cxxopts::value<decltype(input_filename)>(), "training_set_file")
+           ("model", "", cxxopts::value<decltype(model_filename)>(), "model_file");
+    // clang-format on
+
+    // parse command line options
+    cxxopts::ParseResult result;
+    try {
+        options.parse_positional({ "input", "model" });
+        result = options.parse(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // print help message and exit
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_SUCCESS);
+    }
+
+    // print version info
+    if (result.count("version")) {
+        std::cout << version::detail::get_version_info("plssvm-grid") << std::endl;
+        std::exit(EXIT_SUCCESS);
+    }
+
+    // check if the number of positional arguments is not too large
+    if (!result.unmatched().empty()) {
+        std::cerr << fmt::format("Only up to two positional options may be given, but {} (\"{}\") additional option(s) where provided!\n", result.unmatched().size(), fmt::join(result.unmatched(), " ")) << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse kernel_type and cast the value to the respective enum
+    if (result.count("kernel_type")) {
+        csvm_params.kernel_type = result["kernel_type"].as<typename decltype(csvm_params.kernel_type)::value_type>();
+    }
+
+    // parse degree
+    if (result.count("degree")) {
+        csvm_params.degree = result["degree"].as<typename decltype(csvm_params.degree)::value_type>();
+    }
+
+    // parse coef0
+    if (result.count("coef0")) {
+        csvm_params.coef0 = result["coef0"].as<typename decltype(csvm_params.coef0)::value_type>();
+    }
+
+    // parse the gamma values
+    if (result.count("gamma_values")) {
+        gamma_values = result["gamma_values"].as<decltype(gamma_values)>();
+        // check if the provided gamma values are legal
+        for (const double gamma_input : gamma_values) {
+            if (gamma_input <= 0.0) {
+                std::cerr << fmt::format("gamma must be greater than 0.0, but is {}!", gamma_input) << std::endl;
+                std::cout << options.help() << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    // parse the cost values
+    if (result.count("cost_values")) {
+        cost_values = result["cost_values"].as<decltype(cost_values)>();
+        // check if the provided cost values are legal
+        for (const double cost_input : cost_values) {
+            if (cost_input <= 0.0) {
+                std::cerr << fmt::format("cost must be greater than 0.0, but is {}!", cost_input) << std::endl;
+                std::cout << options.help() << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    // parse epsilon
+    if (result.count("epsilon")) {
+        epsilon = result["epsilon"].as<typename decltype(epsilon)::value_type>();
+    }
+
+    // parse max_iter
+    if (result.count("max_iter")) {
+        const auto max_iter_input = result["max_iter"].as<long long int>();
+        // check if the provided max_iter is legal
+        if (max_iter_input <= decltype(max_iter_input){ 0 }) {
+            std::cerr << fmt::format("max_iter must be greater than 0, but is {}!", max_iter_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided max_iter was legal -> override default value
+        max_iter = static_cast<typename decltype(max_iter)::value_type>(max_iter_input);
+    }
+
+    // parse whether strings should be used as labels
+    strings_as_labels = result["use_strings_as_labels"].as<decltype(strings_as_labels)>();
+
+    // parse the options used to read CSV and NumPy input files
+    input_options.delimiter = result["csv_delimiter"].as<decltype(input_options.delimiter)>();
+    input_options.has_header = result["csv_header"].as<decltype(input_options.has_header)>();
+    const std::string label_column = result["csv_label_column"].as<std::string>();
+    if (label_column == "none") {
+        input_options.label_column = std::nullopt;
+    } else {
+        try {
+            input_options.label_column = detail::convert_to<long long>(label_column);
+        } catch (const std::exception &) {
+            std::cerr << fmt::format("Error invalid label column \"{}\"! Must be an integer or \"none\".", label_column) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // parse the settings of the cache storing the parsed content of text input files
+    cache_options.enabled = result["cache"].as<decltype(cache_options.enabled)>() || result.count("cache_dir") > 0;
+    if (result.count("cache_dir")) {
+        cache_options.directory = result["cache_dir"].as<std::string>();
+    }
+    cache_options.max_size = result["cache_max_size"].as<std::uintmax_t>() * 1024 * 1024;
+    cache_options.fingerprint = result["cache_fingerprint"].as<decltype(cache_options.fingerprint)>();
+
+    // parse whether floats should be used as real_type
+    float_as_real_type = result["use_float_as_real_type"].as<decltype(float_as_real_type)>();
+
+    // parse whether output is quiet or not
+    const bool quiet = result["quiet"].as<bool>();
+
+    // -q/--quiet has precedence over --verbosity
+    if (result["verbosity"].count()) {
+        const verbosity_level verb = result["verbosity"].as<verbosity_level>();
+        if (quiet && verb != verbosity_level::quiet) {
+            std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                     "WARNING: explicitly set the -q/--quiet flag, but the provided verbosity level isn't \"quiet\"; setting --verbosity={} to --verbosity=quiet",
+                                     verb)
+                      << std::endl;
+            verbosity = verbosity_level::quiet;
+        } else {
+            verbosity = verb;
+        }
+    } else if (quiet) {
+        verbosity = verbosity_level::quiet;
+    }
+
+    // parse input data filename
+    if (!result.count("input")) {
+        std::cerr << "Error missing input file!" << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    input_filename = result["input"].as<decltype(input_filename)>();
+
+    // parse output model filename
+    if (result.count("model")) {
+        model_filename = result["model"].as<decltype(model_filename)>();
+    } else {
+        const std::filesystem::path input_path{ input_filename };
+        model_filename = input_path.filename().string() + ".model";
+    }
+
+    // parse validation data filename
+    if (result.count("validation")) {
+        validation_filename = result["validation"].as<decltype(validation_filename)>();
+    }
+
+    // parse ranking filename
+    if (result.count("ranking")) {
+        ranking_filename = result["ranking"].as<decltype(ranking_filename)>();
+    }
+
+    // parse performance tracking filename
+    if (result.count("performance_tracking")) {
+        performance_tracking_filename = result["performance_tracking"].as<decltype(performance_tracking_filename)>();
+    }
+}
+
+std::ostream &operator<<(std::ostream &out, const parser_grid &params) {
+    out << fmt::format("kernel_type: {} -> {}\n", params.csvm_params.kernel_type, kernel_function_type_to_math_string(params.csvm_params.kernel_type));
+    switch (params.csvm_params.kernel_type) {
+        case kernel_function_type::linear:
+            break;
+        case kernel_function_type::polynomial:
+            out << fmt::format("coef0: {}{}\n", params.csvm_params.coef0.value(), params.csvm_params.coef0.is_default() ? " (default)" : "");
+            out << fmt::format("degree: {}{}\n", params.csvm_params.degree.value(), params.csvm_params.degree.is_default() ? " (default)" : "");
+            [[fallthrough]];
+        case kernel_function_type::rbf:
+            if (params.gamma_values.empty()) {
+                out << "gamma values: 1 / num_features (default)\n";
+            } else {
+                out << fmt::format("gamma values: [{}]\n", fmt::join(params.gamma_values, ", "));
+            }
+            break;
+    }
+    if (params.cost_values.empty()) {
+        out << fmt::format("cost values: {} (default)\n", params.csvm_params.cost.value());
+    } else {
+        out << fmt::format("cost values: [{}]\n", fmt::join(params.cost_values, ", "));
+    }
+    out << fmt::format("epsilon: {}{}\n", params.epsilon.value(), params.epsilon.is_default() ? " (default)" : "");
+    if (params.max_iter.is_default()) {
+        out << "max_iter: num_data_points (default)\n";
+    } else {
+        out << fmt::format("max_iter: {}\n", params.max_iter.value());
+    }
+    if (params.input_options.delimiter != csv_options{}.delimiter || params.input_options.has_header || params.input_options.label_column != csv_options{}.label_column) {
+        out << fmt::format("CSV options: delimiter '{}', header: {}, label column: {}\n",
+                           params.input_options.delimiter,
+                           params.input_options.has_header,
+                           params.input_options.label_column.has_value() ? fmt::format("{}", params.input_options.label_column.value()) : "none");
+    }
+    if (params.cache_options.enabled) {
+        out << fmt::format("data set cache: {}\n", params.cache_options);
+    }
+
+    return out << fmt::format(
+               "label_type: {}\n"
+               "real_type: {}\n"
+               "input file (data set): '{}'\n"
+               "validation file (data set): '{}'\n"
+               "output file (model): '{}'\n"
+               "output file (ranking): '{}'\n"
+               "performance tracking file: '{}'\n",
+               params.strings_as_labels ? "std::string" : "int (default)",
+               params.float_as_real_type ? "float" : "double (default)",
+               params.input_filename,
+               params.validation_filename,
+               params.model_filename,
+               params.ranking_filename,
+               params.performance_tracking_filename);
+}
+
+}  // namespace plssvm::detail::cmd
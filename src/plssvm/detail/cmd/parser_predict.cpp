@@ -11,7 +11,11 @@
 #include "plssvm/backend_types.hpp"                      // plssvm::list_available_backends
 #include "plssvm/backends/SYCL/implementation_type.hpp"  // plssvm::sycl::list_available_sycl_implementations
 #include "plssvm/detail/assert.hpp"                      // PLSSVM_ASSERT
+#include "plssvm/detail/io/compression.hpp"              // plssvm::detail::io::remove_compression_extension
+#include "plssvm/detail/io/file_reader.hpp"              // plssvm::detail::io::is_standard_input
 #include "plssvm/detail/logger.hpp"                      // plssvm::verbosity
+#include "plssvm/detail/string_conversion.hpp"           // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"              // plssvm::detail::ends_with
 #include "plssvm/target_platforms.hpp"                   // plssvm::list_available_target_platforms
 #include "plssvm/version/version.hpp"                    // plssvm::version::detail::get_version_info
 
@@ -20,10 +24,14 @@
 #include "fmt/core.h"                                    // fmt::format, fmt::join
 #include "fmt/ostream.h"                                 // can use fmt using operator<< overloads
 
+#include <cstdint>                                       // std::uintmax_t
 #include <cstdlib>                                       // std::exit, EXIT_SUCCESS, EXIT_FAILURE
 #include <exception>                                     // std::exception
 #include <filesystem>                                    // std::filesystem::path
 #include <iostream>                                      // std::cout, std::cerr, std::clog, std::endl
+#include <optional>                                      // std::nullopt
+#include <string>                                        // std::string
+#include <string_view>                                   // std::string_view
 
 namespace plssvm::detail::cmd {
 
@@ -50,8 +58,17 @@ parser_predict::parser_predict(int argc, char **argv) {
 #if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
            ("performance_tracking", "the output YAML file where the performance tracking results are written to; if not provided, the results are dumped to stderr", cxxopts::value<decltype(performance_tracking_filename)>())
 #endif
+            ("csv_delimiter", "the character separating the values in a CSV input file", cxxopts::value<decltype(input_options.delimiter)>()->default_value(fmt::format("{}", input_options.delimiter)))
+            ("csv_header", "skip the first line of a CSV input file", cxxopts::value<decltype(input_options.has_header)>()->default_value(fmt::format("{}", input_options.has_header)))
+            ("csv_label_column", "the column of a CSV or NumPy input file containing the labels; negative values count from the last column, \"none\" if the file contains no labels", cxxopts::value<std::string>()->default_value("-1"))
+            ("cache", "cache the parsed content of text input files as memory-mappable binary images to speed up subsequent reads", cxxopts::value<decltype(cache_options.enabled)>()->default_value(fmt::format("{}", cache_options.enabled)))
+            ("cache_dir", "the directory of the data set cache (implies --cache); if not provided, the per-user directory $XDG_CACHE_HOME/plssvm/data_set_cache (or ~/.cache/plssvm/data_set_cache) is used", cxxopts::value<std::string>())
+            ("cache_max_size", "the maximum size of the data set cache in MiB; the least recently used entries are evicted first (0 means no limit)", cxxopts::value<std::uintmax_t>()->default_value(fmt::format("{}", cache_options.max_size / (1024 * 1024))))
+            ("cache_fingerprint", "additionally identify a cached data set by a sha256 fingerprint of samples of the file content", cxxopts::value<decltype(cache_options.fingerprint)>()->default_value(fmt::format("{}", cache_options.fingerprint)))
             ("use_strings_as_labels", "use strings as labels instead of plane numbers", cxxopts::value<decltype(strings_as_labels)>()->default_value(fmt::format("{}", strings_as_labels)))
             ("use_float_as_real_type", "use floats as real types instead of doubles", cxxopts::value<decltype(float_as_real_type)>()->default_value(fmt::format("{}", float_as_real_type)))
+            ("chunk_size", "read and predict the test file in chunks of at most this many data points (LIBSVM files only); 0 reads the whole file at once", cxxopts::value<decltype(chunk_size)>()->default_value(fmt::format("{}", chunk_size)))
+            ("max_memory", "the maximum memory in MiB used for the data points while predicting in chunks (LIBSVM files only); 0 means no limit", cxxopts::value<decltype(max_memory)>()->default_value(fmt::format("{}", max_memory)))
             ("verbosity", fmt::format("choose the level of verbosity: full|timing|libsvm|quiet (default: {})", fmt::format("{}", verbosity)), cxxopts::value<verbosity_level>())
             ("q,quiet", "quiet mode (no outputs regardless the provided verbosity level!)", cxxopts::value<bool>()->default_value(verbosity == verbosity_level::quiet ? "true" : "false"))
             ("h,help", "print this helper message", cxxopts::value<bool>())
@@ -113,9 +130,37 @@ parser_predict::parser_predict(int argc, char **argv) {
     // parse whether strings should be used as labels
     strings_as_labels = result["use_strings_as_labels"].as<decltype(strings_as_labels)>();
 
+    // parse the options used to read CSV and NumPy input files
+    input_options.delimiter = result["csv_delimiter"].as<decltype(input_options.delimiter)>();
+    input_options.has_header = result["csv_header"].as<decltype(input_options.has_header)>();
+    const std::string label_column = result["csv_label_column"].as<std::string>();
+    if (label_column == "none") {
+        input_options.label_column = std::nullopt;
+    } else {
+        try {
+            input_options.label_column = detail::convert_to<long long>(label_column);
+        } catch (const std::exception &) {
+            std::cerr << fmt::format("Error invalid label column \"{}\"! Must be an integer or \"none\".", label_column) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // parse the settings of the cache storing the parsed content of text input files
+    cache_options.enabled = result["cache"].as<decltype(cache_options.enabled)>() || result.count("cache_dir") > 0;
+    if (result.count("cache_dir")) {
+        cache_options.directory = result["cache_dir"].as<std::string>();
+    }
+    cache_options.max_size = result["cache_max_size"].as<std::uintmax_t>() * 1024 * 1024;
+    cache_options.fingerprint = result["cache_fingerprint"].as<decltype(cache_options.fingerprint)>();
+
     // parse whether float should be used as real_type instead of double
     float_as_real_type = result["use_float_as_real_type"].as<decltype(float_as_real_type)>();
 
+    // parse the chunk size and memory limit used to predict the test file in chunks
+    chunk_size = result["chunk_size"].as<decltype(chunk_size)>();
+    max_memory = result["max_memory"].as<decltype(max_memory)>();
+
     // parse whether output is quiet or not
     const bool quiet = result["quiet"].as<bool>();
 
@@ -143,6 +188,13 @@ parser_predict::parser_predict(int argc, char **argv) {
     }
     input_filename = result["test"].as<decltype(input_filename)>();
 
+    // only LIBSVM files can be read in chunks
+    const std::string_view uncompressed_input_filename = detail::io::remove_compression_extension(input_filename);
+    if ((chunk_size > 0 || max_memory > 0) && (detail::ends_with(uncompressed_input_filename, ".arff") || detail::ends_with(uncompressed_input_filename, ".bin") || detail::ends_with(uncompressed_input_filename, ".csv") || detail::ends_with(uncompressed_input_filename, ".npy"))) {
+        std::cerr << fmt::format("Predicting in chunks (--chunk_size or --max_memory) is only supported for LIBSVM files, but '{}' was given!", input_filename) << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
     // parse model filename
     if (!result.count("model")) {
         std::cerr << "Error missing model file!" << std::endl;
@@ -151,11 +203,18 @@ parser_predict::parser_predict(int argc, char **argv) {
     }
     model_filename = result["model"].as<decltype(model_filename)>();
 
+    // the standard input can only be read once
+    if (detail::io::is_standard_input(input_filename) && detail::io::is_standard_input(model_filename)) {
+        std::cerr << "Error the test file and the model file can't both be read from the standard input!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
     // parse output filename
     if (result.count("output")) {
         predict_filename = result["output"].as<decltype(predict_filename)>();
     } else {
-        const std::filesystem::path input_path{ input_filename };
+        // the standard input has no meaningful filename
+        const std::filesystem::path input_path{ detail::io::is_standard_input(input_filename) ? "stdin" : input_filename };
         predict_filename = input_path.filename().string() + ".predict";
     }
 
@@ -166,18 +225,32 @@ parser_predict::parser_predict(int argc, char **argv) {
 }
 
 std::ostream &operator<<(std::ostream &out, const parser_predict &params) {
+    if (params.input_options.delimiter != csv_options{}.delimiter || params.input_options.has_header || params.input_options.label_column != csv_options{}.label_column) {
+        out << fmt::format("CSV options: delimiter '{}', header: {}, label column: {}\n",
+                           params.input_options.delimiter,
+                           params.input_options.has_header,
+                           params.input_options.label_column.has_value() ? fmt::format("{}", params.input_options.label_column.value()) : "none");
+    }
+    if (params.cache_options.enabled) {
+        out << fmt::format("data set cache: {}\n", params.cache_options);
+    }
+
     return out << fmt::format(
                "label_type: {}\n"
                "real_type: {}\n"
                "input file (data set): '{}'\n"
                "input file (model): '{}'\n"
                "output file (prediction): '{}'\n"
+               "chunk size (data points): {}\n"
+               "memory limit (MiB): {}\n"
                "performance tracking file: '{}'\n",
                params.strings_as_labels ? "std::string" : "int (default)",
                params.float_as_real_type ? "float" : "double (default)",
                params.input_filename,
                params.model_filename,
                params.predict_filename,
+               params.chunk_size,
+               params.max_memory,
                params.performance_tracking_filename);
 }
 
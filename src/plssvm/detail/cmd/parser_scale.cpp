@@ -8,19 +8,23 @@
 
 #include "plssvm/detail/cmd/parser_scale.hpp"
 
-#include "plssvm/constants.hpp"        // plssvm::verbose_default, plssvm::verbose
-#include "plssvm/detail/assert.hpp"    // PLSSVM_ASSERT
-#include "plssvm/detail/logger.hpp"    // plssvm::verbosity
-#include "plssvm/version/version.hpp"  // plssvm::version::detail::get_version_info
-
-#include "cxxopts.hpp"                 // cxxopts::{Options, value, ParseResult}
-#include "fmt/core.h"                  // fmt::format, fmt::join
-#include "fmt/ostream.h"               // can use fmt using operator<< overloads
-
-#include <cstdlib>                     // std::exit, EXIT_SUCCESS, EXIT_FAILURE
-#include <exception>                   // std::exception
-#include <filesystem>                  // std::filesystem::path
-#include <iostream>                    // std::cout, std::cerr, std::clog, std::endl
+#include "plssvm/constants.hpp"                 // plssvm::verbose_default, plssvm::verbose
+#include "plssvm/detail/assert.hpp"             // PLSSVM_ASSERT
+#include "plssvm/detail/logger.hpp"             // plssvm::verbosity
+#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
+#include "plssvm/version/version.hpp"           // plssvm::version::detail::get_version_info
+
+#include "cxxopts.hpp"                          // cxxopts::{Options, value, ParseResult}
+#include "fmt/core.h"                           // fmt::format, fmt::join
+#include "fmt/ostream.h"                        // can use fmt using operator<< overloads
+
+#include <cstdint>                              // std::uintmax_t
+#include <cstdlib>                              // std::exit, EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>                            // std::exception
+#include <filesystem>                           // std::filesystem::path
+#include <iostream>                             // std::cout, std::cerr, std::clog, std::endl
+#include <optional>                             // std::nullopt
+#include <string>                               // std::string
 
 namespace plssvm::detail::cmd {
 
@@ -41,12 +45,19 @@ parser_scale::parser_scale(int argc, char **argv) {
        .add_options()
            ("l,lower", "lower is the lowest (minimal) value allowed in each dimension", cxxopts::value<decltype(lower)>()->default_value(fmt::format("{}", lower)))
            ("u,upper", "upper is the highest (maximal) value allowed in each dimension", cxxopts::value<decltype(upper)>()->default_value(fmt::format("{}", upper)))
-           ("f,format", "the file format to output the scaled data set to", cxxopts::value<decltype(format)>()->default_value(fmt::format("{}", format)))
+           ("f,format", "the file format to output the scaled data set to: libsvm|arff|binary|csv|npy", cxxopts::value<decltype(format)>()->default_value(fmt::format("{}", format)))
            ("s,save_filename", "the file to which the scaling factors should be saved", cxxopts::value<decltype(save_filename)>())
            ("r,restore_filename", "the file from which previous scaling factors should be loaded", cxxopts::value<decltype(restore_filename)>())
 #if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
            ("performance_tracking", "the output YAML file where the performance tracking results are written to; if not provided, the results are dumped to stderr", cxxopts::value<decltype(performance_tracking_filename)>())
 #endif
+           ("csv_delimiter", "the character separating the values in a CSV input file", cxxopts::value<decltype(input_options.delimiter)>()->default_value(fmt::format("{}", input_options.delimiter)))
+           ("csv_header", "skip the first line of a CSV input file", cxxopts::value<decltype(input_options.has_header)>()->default_value(fmt::format("{}", input_options.has_header)))
+           ("csv_label_column", "the column of a CSV or NumPy input file containing the labels; negative values count from the last column, \"none\" if the file contains no labels", cxxopts::value<std::string>()->default_value("-1"))
+           ("cache", "cache the parsed content of text input files as memory-mappable binary images to speed up subsequent reads", cxxopts::value<decltype(cache_options.enabled)>()->default_value(fmt::format("{}", cache_options.enabled)))
+           ("cache_dir", "the directory of the data set cache (implies --cache); if not provided, the per-user directory $XDG_CACHE_HOME/plssvm/data_set_cache (or ~/.cache/plssvm/data_set_cache) is used", cxxopts::value<std::string>())
+           ("cache_max_size", "the maximum size of the data set cache in MiB; the least recently used entries are evicted first (0 means no limit)", cxxopts::value<std::uintmax_t>()->default_value(fmt::format("{}", cache_options.max_size / (1024 * 1024))))
+           ("cache_fingerprint", "additionally identify a cached data set by a sha256 fingerprint of samples of the file content", cxxopts::value<decltype(cache_options.fingerprint)>()->default_value(fmt::format("{}", cache_options.fingerprint)))
            ("use_strings_as_labels", "use strings as labels instead of plane numbers", cxxopts::value<decltype(strings_as_labels)>()->default_value(fmt::format("{}", strings_as_labels)))
            ("use_float_as_real_type", "use floats as real types instead of doubles", cxxopts::value<decltype(float_as_real_type)>()->default_value(fmt::format("{}", float_as_real_type)))
            ("verbosity", fmt::format("choose the level of verbosity: full|timing|libsvm|quiet (default: {})", fmt::format("{}", verbosity)), cxxopts::value<verbosity_level>())
@@ -106,6 +117,30 @@ parser_scale::parser_scale(int argc, char **argv) {
     // parse whether strings should be used as labels
     strings_as_labels = result["use_strings_as_labels"].as<decltype(strings_as_labels)>();
 
+    // parse the options used to read CSV and NumPy input files
+    input_options.delimiter = result["csv_delimiter"].as<decltype(input_options.delimiter)>();
+    input_options.has_header = result["csv_header"].as<decltype(input_options.has_header)>();
+    const std::string label_column = result["csv_label_column"].as<std::string>();
+    if (label_column == "none") {
+        input_options.label_column = std::nullopt;
+    } else {
+        try {
+            input_options.label_column = detail::convert_to<long long>(label_column);
+        } catch (const std::exception &) {
+            std::cerr << fmt::format("Error invalid label column \"{}\"! Must be an integer or \"none\".", label_column) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // parse the settings of the cache storing the parsed content of text input files
+    cache_options.enabled = result["cache"].as<decltype(cache_options.enabled)>() || result.count("cache_dir") > 0;
+    if (result.count("cache_dir")) {
+        cache_options.directory = result["cache_dir"].as<std::string>();
+    }
+    cache_options.max_size = result["cache_max_size"].as<std::uintmax_t>() * 1024 * 1024;
+    cache_options.fingerprint = result["cache_fingerprint"].as<decltype(cache_options.fingerprint)>();
+
     // parse whether floats should be used as real_type
     float_as_real_type = result["use_float_as_real_type"].as<decltype(float_as_real_type)>();
 
@@ -168,6 +203,16 @@ parser_scale::parser_scale(int argc, char **argv) {
 }
 
 std::ostream &operator<<(std::ostream &out, const parser_scale &params) {
+    if (params.input_options.delimiter != csv_options{}.delimiter || params.input_options.has_header || params.input_options.label_column != csv_options{}.label_column) {
+        out << fmt::format("CSV options: delimiter '{}', header: {}, label column: {}\n",
+                           params.input_options.delimiter,
+                           params.input_options.has_header,
+                           params.input_options.label_column.has_value() ? fmt::format("{}", params.input_options.label_column.value()) : "none");
+    }
+    if (params.cache_options.enabled) {
+        out << fmt::format("data set cache: {}\n", params.cache_options);
+    }
+
     return out << fmt::format(
                "lower: {}\n"
                "upper: {}\n"
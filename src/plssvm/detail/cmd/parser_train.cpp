@@ -8,16 +8,24 @@
 
 #include "plssvm/detail/cmd/parser_train.hpp"
 
-#include "plssvm/backend_types.hpp"                      // plssvm::list_available_backends
+#include "plssvm/backend_types.hpp"                      // plssvm::list_available_backends, plssvm::determine_default_backend
 #include "plssvm/backends/SYCL/implementation_type.hpp"  // plssvm::sycl_generic::list_available_sycl_implementations
 #include "plssvm/constants.hpp"                          // plssvm::verbose_default, plssvm::verbose
 #include "plssvm/default_value.hpp"                      // plssvm::default_value
 #include "plssvm/detail/arithmetic_type_name.hpp"        // plssvm::detail::arithmetic_type_name
 #include "plssvm/detail/assert.hpp"                      // PLSSVM_ASSERT
+#include "plssvm/detail/io/data_set_subset.hpp"          // plssvm::detail::io::parse_feature_selection
+#include "plssvm/detail/io/file_reader.hpp"              // plssvm::detail::io::is_standard_input
 #include "plssvm/detail/logger.hpp"                      // plssvm::verbosity
+#include "plssvm/detail/string_conversion.hpp"           // plssvm::detail::convert_to
 #include "plssvm/detail/string_utility.hpp"              // plssvm::detail::as_lower_case
 #include "plssvm/detail/utility.hpp"                     // plssvm::detail::to_underlying
-#include "plssvm/kernel_function_types.hpp"              // plssvm::kernel_type_to_math_string
+#include "plssvm/exceptions/exceptions.hpp"              // plssvm::invalid_parameter_exception
+#include "plssvm/file_format_types.hpp"                  // plssvm::subset_options
+#include "plssvm/kernel_function_types.hpp"              // plssvm::kernel_function_type, plssvm::kernel_type_to_math_string
+#include "plssvm/landmark_selection_types.hpp"           // plssvm::landmark_selection_type
+#include "plssvm/sampling_types.hpp"                     // plssvm::sampling_type
+#include "plssvm/solver_types.hpp"                       // plssvm::solver_type
 #include "plssvm/target_platforms.hpp"                   // plssvm::list_available_target_platforms
 #include "plssvm/version/version.hpp"                    // plssvm::version::detail::get_version_info
 
@@ -26,10 +34,13 @@
 #include "fmt/core.h"                                    // fmt::format, fmt::join
 #include "fmt/ostream.h"                                 // can use fmt using operator<< overloads
 
+#include <cstdint>                                       // std::uintmax_t
 #include <cstdlib>                                       // std::exit, EXIT_SUCCESS, EXIT_FAILURE
 #include <exception>                                     // std::exception
 #include <filesystem>                                    // std::filesystem::path
 #include <iostream>                                      // std::cout, std::cerr, std::clog, std::endl
+#include <optional>                                      // std::nullopt
+#include <string>                                        // std::string
 
 namespace plssvm::detail::cmd {
 
@@ -52,10 +63,30 @@ parser_train::parser_train(int argc, char **argv) {
            ("g,gamma", "set gamma in kernel function (default: 1 / num_features)", cxxopts::value<typename decltype(csvm_params.gamma)::value_type>())
            ("r,coef0", "set coef0 in kernel function", cxxopts::value<typename decltype(csvm_params.coef0)::value_type>()->default_value(fmt::format("{}", csvm_params.coef0)))
            ("c,cost", "set the parameter C", cxxopts::value<typename decltype(csvm_params.cost)::value_type>()->default_value(fmt::format("{}", csvm_params.cost)))
+           ("cost_path", "comma separated list of C values; learns one model per value using a single CG run (the models are saved as model_file.cost_C)", cxxopts::value<decltype(cost_path)>())
            ("e,epsilon", "set the tolerance of termination criterion", cxxopts::value<typename decltype(epsilon)::value_type>()->default_value(fmt::format("{}", epsilon)))
            ("i,max_iter", "set the maximum number of CG iterations (default: num_features)", cxxopts::value<long long int>())
+           ("solver", "choose the CG variant used to solve the system of linear equations: cg|single_reduction_cg", cxxopts::value<decltype(solver)>()->default_value(fmt::format("{}", solver)))
+           ("solver_state", "recycle the Krylov subspace information of previous trainings stored in the given file to reduce the number of CG iterations; the file is created or updated after training", cxxopts::value<decltype(solver_state_filename)>())
+           ("checkpoint_interval", "write a checkpoint of the CG state every given number of iterations to be able to continue an interrupted training using --resume (0 disables the checkpoints)", cxxopts::value<long long int>()->default_value(fmt::format("{}", checkpoint_interval)))
+           ("resume", "continue the CG from the last checkpoint if the checkpoint file exists", cxxopts::value<decltype(resume)>()->default_value(fmt::format("{}", resume)))
+           ("checkpoint_file", "the file the CG checkpoints are written to and resumed from (default: model_file.checkpoint)", cxxopts::value<decltype(checkpoint_filename)>())
+           ("append", "add the data points in the input file to the model in the model file and warm start the CG using its weights (the model file is overwritten)", cxxopts::value<decltype(append)>()->default_value(fmt::format("{}", append)))
+           ("loo", "only estimate the leave-one-out accuracy (using a single training and some probing solves) instead of saving a model file", cxxopts::value<decltype(loo)>()->default_value(fmt::format("{}", loo)))
+           ("loo_probes", "set the number of random probing vectors used to estimate the leave-one-out accuracy", cxxopts::value<long long int>()->default_value(fmt::format("{}", loo_probes)))
+           ("cross_validation", "only perform a k-fold cross-validation using the given number of folds instead of saving a model file", cxxopts::value<long long int>())
+           ("num_partitions", "split the data set into the given number of partitions, train one sub-model per partition, and merge them using a global correction (cascade training)", cxxopts::value<long long int>())
+           ("num_landmarks", "approximately train a fixed-size LS-SVM using the Nyström method with the given number of landmarks (support vectors)", cxxopts::value<long long int>())
+           ("landmark_selection", "choose the landmark selection strategy of the fixed-size LS-SVM: uniform|kmeans++|entropy", cxxopts::value<decltype(landmark_selection)>()->default_value(fmt::format("{}", landmark_selection)))
+           ("prune_to", "train a sparse LS-SVM by iteratively removing the data points with the smallest weights and retraining on the remaining ones until the given number of support vectors is reached", cxxopts::value<long long int>())
+           ("prune_fraction", "the fraction of the remaining data points removed in each round of --prune_to", cxxopts::value<typename decltype(prune_fraction)::value_type>()->default_value(fmt::format("{}", prune_fraction)))
+           ("max_accuracy_drop", "stop --prune_to early if the accuracy on the training data drops by more than the given value compared to the full LS-SVM (1 disables the check)", cxxopts::value<typename decltype(max_accuracy_drop)::value_type>()->default_value(fmt::format("{}", max_accuracy_drop)))
+           ("reduce_to", "reduce the number of support vectors of the learned model to the given number by pruning the support vectors with the smallest weights and refitting the remaining ones", cxxopts::value<long long int>())
+           ("reduce_tolerance", "the maximum fraction of the training data points whose predicted label may change due to --reduce_to; if exceeded, more support vectors are kept (1 disables the check)", cxxopts::value<typename decltype(reduce_tolerance)::value_type>()->default_value(fmt::format("{}", reduce_tolerance)))
            ("b,backend", fmt::format("choose the backend: {}", fmt::join(list_available_backends(), "|")), cxxopts::value<decltype(backend)>()->default_value(fmt::format("{}", backend)))
            ("p,target_platform", fmt::format("choose the target platform: {}", fmt::join(list_available_target_platforms(), "|")), cxxopts::value<decltype(target)>()->default_value(fmt::format("{}", target)))
+           ("hodlr_tolerance", "compress the kernel matrix using a HODLR approximation with the given relative tolerance when using OpenMP as backend (0 uses the dense kernel matrix)", cxxopts::value<decltype(hodlr_tolerance)>()->default_value(fmt::format("{}", hodlr_tolerance)))
+           ("rbf_cutoff", "drop all rbf kernel matrix entries smaller than the given value using a spatially sorted sparse kernel matrix when using OpenMP as backend (0 uses the dense kernel matrix)", cxxopts::value<decltype(rbf_cutoff)>()->default_value(fmt::format("{}", rbf_cutoff)))
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
            ("sycl_kernel_invocation_type", "choose the kernel invocation type when using SYCL as backend: automatic|nd_range|hierarchical", cxxopts::value<decltype(sycl_kernel_invocation_type)>()->default_value(fmt::format("{}", sycl_kernel_invocation_type)))
            ("sycl_implementation_type", fmt::format("choose the SYCL implementation to be used in the SYCL backend: {}", fmt::join(sycl::list_available_sycl_implementations(), "|")), cxxopts::value<decltype(sycl_implementation_type)>()->default_value(fmt::format("{}", sycl_implementation_type)))
@@ -63,6 +94,16 @@ parser_train::parser_train(int argc, char **argv) {
 #if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
            ("performance_tracking", "the output YAML file where the performance tracking results are written to; if not provided, the results are dumped to stderr", cxxopts::value<decltype(performance_tracking_filename)>())
 #endif
+           ("csv_delimiter", "the character separating the values in a CSV input file", cxxopts::value<decltype(input_options.delimiter)>()->default_value(fmt::format("{}", input_options.delimiter)))
+           ("csv_header", "skip the first line of a CSV input file", cxxopts::value<decltype(input_options.has_header)>()->default_value(fmt::format("{}", input_options.has_header)))
+           ("csv_label_column", "the column of a CSV or NumPy input file containing the labels; negative values count from the last column, \"none\" if the file contains no labels", cxxopts::value<std::string>()->default_value("-1"))
+           ("features", "keep only the given zero-based features (comma separated indices and inclusive ranges, e.g., 0-9,15) while reading the input file", cxxopts::value<std::string>())
+           ("sample_size", "read only a random sample of the given number of data points from the input file", cxxopts::value<long long int>())
+           ("sampling", "choose the sampling strategy used with --sample_size: uniform|stratified", cxxopts::value<decltype(subset.sampling)>()->default_value(fmt::format("{}", subset.sampling)))
+           ("cache", "cache the parsed content of text input files as memory-mappable binary images to speed up subsequent reads", cxxopts::value<decltype(cache_options.enabled)>()->default_value(fmt::format("{}", cache_options.enabled)))
+           ("cache_dir", "the directory of the data set cache (implies --cache); if not provided, the per-user directory $XDG_CACHE_HOME/plssvm/data_set_cache (or ~/.cache/plssvm/data_set_cache) is used", cxxopts::value<std::string>())
+           ("cache_max_size", "the maximum size of the data set cache in MiB; the least recently used entries are evicted first (0 means no limit)", cxxopts::value<std::uintmax_t>()->default_value(fmt::format("{}", cache_options.max_size / (1024 * 1024))))
+           ("cache_fingerprint", "additionally identify a cached data set by a sha256 fingerprint of samples of the file content", cxxopts::value<decltype(cache_options.fingerprint)>()->default_value(fmt::format("{}", cache_options.fingerprint)))
            ("use_strings_as_labels", "use strings as labels instead of plane numbers", cxxopts::value<decltype(strings_as_labels)>()->default_value(fmt::format("{}", strings_as_labels)))
            ("use_float_as_real_type", "use floats as real types instead of doubles", cxxopts::value<decltype(float_as_real_type)>()->default_value(fmt::format("{}", float_as_real_type)))
            ("verbosity", fmt::format("choose the level of verbosity: full|timing|libsvm|quiet (default: {})", fmt::format("{}", verbosity)), cxxopts::value<verbosity_level>())
@@ -136,6 +177,25 @@ parser_train::parser_train(int argc, char **argv) {
         csvm_params.cost = result["cost"].as<typename decltype(csvm_params.cost)::value_type>();
     }
 
+    // parse the cost path
+    if (result.count("cost_path")) {
+        // the cost path and a single cost value are mutually exclusive
+        if (result.count("cost")) {
+            std::cerr << "Only one of -c/--cost and --cost_path may be given!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        cost_path = result["cost_path"].as<decltype(cost_path)>();
+        // check if the provided cost values are legal
+        for (const double cost_input : cost_path) {
+            if (cost_input <= 0.0) {
+                std::cerr << fmt::format("cost must be greater than 0.0, but is {}!", cost_input) << std::endl;
+                std::cout << options.help() << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+    }
+
     // parse epsilon
     if (result.count("epsilon")) {
         epsilon = result["epsilon"].as<typename decltype(epsilon)::value_type>();
@@ -154,12 +214,329 @@ parser_train::parser_train(int argc, char **argv) {
         max_iter = static_cast<typename decltype(max_iter)::value_type>(max_iter_input);
     }
 
+    // parse whether the leave-one-out accuracy should be calculated
+    loo = result["loo"].as<decltype(loo)>();
+    if (loo && !cost_path.empty()) {
+        std::cerr << "Only one of --loo and --cost_path may be given!" << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse the number of probing vectors used in the leave-one-out accuracy estimation
+    if (result.count("loo_probes")) {
+        const auto loo_probes_input = result["loo_probes"].as<long long int>();
+        // check if the provided number of probing vectors is legal
+        if (loo_probes_input <= decltype(loo_probes_input){ 0 }) {
+            std::cerr << fmt::format("loo_probes must be greater than 0, but is {}!", loo_probes_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided loo_probes was legal -> override default value
+        loo_probes = static_cast<typename decltype(loo_probes)::value_type>(loo_probes_input);
+    }
+
+    // parse the number of folds used in the cross-validation
+    if (result.count("cross_validation")) {
+        const auto cross_validation_input = result["cross_validation"].as<long long int>();
+        // check if the provided number of folds is legal
+        if (cross_validation_input < decltype(cross_validation_input){ 2 }) {
+            std::cerr << fmt::format("cross_validation must be at least 2, but is {}!", cross_validation_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // the cross-validation, the leave-one-out accuracy, and the cost path are mutually exclusive
+        if (loo || !cost_path.empty()) {
+            std::cerr << "Only one of --cross_validation, --loo, and --cost_path may be given!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided number of folds was legal -> override default value
+        cross_validation = static_cast<decltype(cross_validation)>(cross_validation_input);
+    }
+
+    // parse the number of partitions used in the cascade training
+    if (result.count("num_partitions")) {
+        const auto num_partitions_input = result["num_partitions"].as<long long int>();
+        // check if the provided number of partitions is legal
+        if (num_partitions_input < decltype(num_partitions_input){ 1 }) {
+            std::cerr << fmt::format("num_partitions must be greater than 0, but is {}!", num_partitions_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // the cascade training can only be used to train a single model
+        if (num_partitions_input > 1 && (loo || !cost_path.empty() || cross_validation > 0)) {
+            std::cerr << "--num_partitions can't be combined with --cross_validation, --loo, or --cost_path!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided number of partitions was legal -> override default value
+        num_partitions = static_cast<decltype(num_partitions)>(num_partitions_input);
+    }
+
+    // parse the number of landmarks used in the fixed-size LS-SVM
+    if (result.count("num_landmarks")) {
+        const auto num_landmarks_input = result["num_landmarks"].as<long long int>();
+        // check if the provided number of landmarks is legal
+        if (num_landmarks_input < decltype(num_landmarks_input){ 2 }) {
+            std::cerr << fmt::format("num_landmarks must be at least 2, but is {}!", num_landmarks_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // the approximate training can't be combined with the other training modes
+        if (loo || !cost_path.empty() || cross_validation > 0 || num_partitions > 1) {
+            std::cerr << "--num_landmarks can't be combined with --cross_validation, --loo, --cost_path, or --num_partitions!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided number of landmarks was legal -> override default value
+        num_landmarks = static_cast<decltype(num_landmarks)>(num_landmarks_input);
+    }
+
+    // parse the landmark selection strategy and cast the value to the respective enum
+    landmark_selection = result["landmark_selection"].as<decltype(landmark_selection)>();
+
+    // warn if a landmark selection strategy is explicitly set but no fixed-size LS-SVM is trained
+    if (num_landmarks == 0 && result.count("landmark_selection")) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a landmark selection strategy but --num_landmarks isn't set; ignoring --landmark_selection={}",
+                                 landmark_selection)
+                  << std::endl;
+    }
+
+    // parse the number of support vectors the learned model is reduced to
+    if (result.count("reduce_to")) {
+        const auto reduce_to_input = result["reduce_to"].as<long long int>();
+        // check if the provided number of support vectors is legal
+        if (reduce_to_input < decltype(reduce_to_input){ 2 }) {
+            std::cerr << fmt::format("reduce_to must be at least 2, but is {}!", reduce_to_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // the support vector reduction needs a learned model
+        if (loo || cross_validation > 0) {
+            std::cerr << "--reduce_to can't be combined with --cross_validation or --loo!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided number of support vectors was legal -> override default value
+        reduce_to = static_cast<decltype(reduce_to)>(reduce_to_input);
+    }
+
+    // parse the tolerance of the support vector reduction
+    if (result.count("reduce_tolerance")) {
+        const auto reduce_tolerance_input = result["reduce_tolerance"].as<typename decltype(reduce_tolerance)::value_type>();
+        // check if the provided tolerance is legal
+        if (reduce_tolerance_input < 0.0 || reduce_tolerance_input > 1.0) {
+            std::cerr << fmt::format("reduce_tolerance must be in the range [0.0, 1.0], but is {}!", reduce_tolerance_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided tolerance was legal -> override default value
+        reduce_tolerance = reduce_tolerance_input;
+        // warn if a tolerance is explicitly set but the model isn't reduced
+        if (reduce_to == 0) {
+            std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                     "WARNING: explicitly set a support vector reduction tolerance but --reduce_to isn't set; ignoring --reduce_tolerance={}",
+                                     reduce_tolerance.value())
+                      << std::endl;
+        }
+    }
+
+    // parse the CG variant and cast the value to the respective enum
+    solver = result["solver"].as<decltype(solver)>();
+
+    // warn if a CG variant is explicitly set but the selected training mode doesn't use it
+    if (solver != solver_type::cg && (!cost_path.empty() || cross_validation > 0 || num_landmarks > 0)) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a CG variant but --cost_path, --cross_validation, and --num_landmarks only support the classic CG algorithm; ignoring --solver={}",
+                                 solver)
+                  << std::endl;
+        solver = solver_type::cg;
+    }
+
+    // parse the solver state file used to recycle the Krylov subspace information
+    if (result.count("solver_state")) {
+        solver_state_filename = result["solver_state"].as<decltype(solver_state_filename)>();
+        // check if the provided solver state can be used with the selected training mode
+        if (loo || !cost_path.empty() || cross_validation > 0 || num_partitions > 1 || num_landmarks > 0) {
+            std::cerr << "--solver_state can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, or --num_landmarks!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        if (solver != solver_type::cg) {
+            std::cerr << fmt::format("--solver_state can only be used with --solver={}, but --solver={} was given!", solver_type::cg, solver) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // parse the number of CG iterations between two checkpoints
+    if (result.count("checkpoint_interval")) {
+        const auto checkpoint_interval_input = result["checkpoint_interval"].as<long long int>();
+        // check if the provided checkpoint interval is legal
+        if (checkpoint_interval_input < decltype(checkpoint_interval_input){ 0 }) {
+            std::cerr << fmt::format("checkpoint_interval must be greater or equal than 0, but is {}!", checkpoint_interval_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided checkpoint interval was legal -> override default value
+        checkpoint_interval = static_cast<decltype(checkpoint_interval)>(checkpoint_interval_input);
+    }
+
+    // parse whether the CG should be continued from the last checkpoint
+    resume = result["resume"].as<decltype(resume)>();
+
+    // check if the checkpoints can be used with the selected training mode
+    if (checkpoint_interval > 0 || resume) {
+        if (loo || !cost_path.empty() || cross_validation > 0 || num_partitions > 1 || num_landmarks > 0 || !solver_state_filename.empty()) {
+            std::cerr << "--checkpoint_interval and --resume can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, --num_landmarks, or --solver_state!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        if (solver != solver_type::cg) {
+            std::cerr << fmt::format("--checkpoint_interval and --resume can only be used with --solver={}, but --solver={} was given!", solver_type::cg, solver) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    } else if (result.count("checkpoint_file")) {
+        // warn if a checkpoint file is explicitly set but no checkpoints are written or read
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a checkpoint file but neither --checkpoint_interval nor --resume is set; ignoring --checkpoint_file={}",
+                                 result["checkpoint_file"].as<decltype(checkpoint_filename)>())
+                  << std::endl;
+    }
+
+    // parse whether the data points should be added to an existing model
+    append = result["append"].as<decltype(append)>();
+    // check if the incremental training can be used with the selected training mode
+    if (append && (loo || !cost_path.empty() || cross_validation > 0 || num_partitions > 1 || num_landmarks > 0 || !solver_state_filename.empty() || checkpoint_interval > 0 || resume)) {
+        std::cerr << "--append can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, --num_landmarks, --solver_state, --checkpoint_interval, or --resume!" << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse the number of support vectors the sparse LS-SVM is pruned to
+    if (result.count("prune_to")) {
+        const auto prune_to_input = result["prune_to"].as<long long int>();
+        // check if the provided number of support vectors is legal
+        if (prune_to_input < decltype(prune_to_input){ 2 }) {
+            std::cerr << fmt::format("prune_to must be at least 2, but is {}!", prune_to_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // the sparse LS-SVM can't be combined with the other training modes
+        if (loo || !cost_path.empty() || cross_validation > 0 || num_partitions > 1 || num_landmarks > 0 || !solver_state_filename.empty() || checkpoint_interval > 0 || resume || append) {
+            std::cerr << "--prune_to can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, --num_landmarks, --solver_state, --checkpoint_interval, --resume, or --append!" << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided number of support vectors was legal -> override default value
+        prune_to = static_cast<decltype(prune_to)>(prune_to_input);
+    }
+
+    // parse the fraction of the data points removed in each pruning round
+    if (result.count("prune_fraction")) {
+        const auto prune_fraction_input = result["prune_fraction"].as<typename decltype(prune_fraction)::value_type>();
+        // check if the provided fraction is legal
+        if (prune_fraction_input <= 0.0 || prune_fraction_input >= 1.0) {
+            std::cerr << fmt::format("prune_fraction must be in the range (0.0, 1.0), but is {}!", prune_fraction_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided fraction was legal -> override default value
+        prune_fraction = prune_fraction_input;
+        // warn if a fraction is explicitly set but no sparse LS-SVM is trained
+        if (prune_to == 0) {
+            std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                     "WARNING: explicitly set a prune fraction but --prune_to isn't set; ignoring --prune_fraction={}",
+                                     prune_fraction.value())
+                      << std::endl;
+        }
+    }
+
+    // parse the maximum accuracy drop tolerated while pruning
+    if (result.count("max_accuracy_drop")) {
+        const auto max_accuracy_drop_input = result["max_accuracy_drop"].as<typename decltype(max_accuracy_drop)::value_type>();
+        // check if the provided accuracy drop is legal
+        if (max_accuracy_drop_input < 0.0 || max_accuracy_drop_input > 1.0) {
+            std::cerr << fmt::format("max_accuracy_drop must be in the range [0.0, 1.0], but is {}!", max_accuracy_drop_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided accuracy drop was legal -> override default value
+        max_accuracy_drop = max_accuracy_drop_input;
+        // warn if an accuracy drop is explicitly set but no sparse LS-SVM is trained
+        if (prune_to == 0) {
+            std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                     "WARNING: explicitly set a maximum accuracy drop but --prune_to isn't set; ignoring --max_accuracy_drop={}",
+                                     max_accuracy_drop.value())
+                      << std::endl;
+        }
+    }
+
     // parse backend_type and cast the value to the respective enum
     backend = result["backend"].as<decltype(backend)>();
 
     // parse target_platform and cast the value to the respective enum
     target = result["target_platform"].as<decltype(target)>();
 
+    // the OpenMP specific kernel matrix approximations are only used if the backend resolves to OpenMP, i.e., also if the automatic backend resolves to OpenMP
+    const backend_type used_backend = backend == backend_type::automatic ? determine_default_backend() : backend;
+
+    // parse the tolerance used to compress the kernel matrix in the OpenMP backend
+    hodlr_tolerance = result["hodlr_tolerance"].as<decltype(hodlr_tolerance)>();
+    // check if the provided tolerance is legal
+    if (hodlr_tolerance < 0.0) {
+        std::cerr << fmt::format("hodlr_tolerance must be greater or equal than 0.0, but is {}!", hodlr_tolerance) << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    // warn if a HODLR tolerance is explicitly set but OpenMP isn't the current backend
+    if (used_backend != backend_type::openmp && hodlr_tolerance > 0.0) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a HODLR tolerance but the current backend ({}) isn't OpenMP; ignoring --hodlr_tolerance={}",
+                                 used_backend,
+                                 hodlr_tolerance)
+                  << std::endl;
+        hodlr_tolerance = 0.0;
+    }
+
+    // parse the value below which rbf kernel matrix entries are dropped in the OpenMP backend
+    rbf_cutoff = result["rbf_cutoff"].as<decltype(rbf_cutoff)>();
+    // check if the provided cutoff is legal
+    if (rbf_cutoff < 0.0 || rbf_cutoff >= 1.0) {
+        std::cerr << fmt::format("rbf_cutoff must be in the range [0.0, 1.0), but is {}!", rbf_cutoff) << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    // warn if a rbf cutoff is explicitly set but OpenMP isn't the current backend or rbf isn't the current kernel function
+    if (used_backend != backend_type::openmp && rbf_cutoff > 0.0) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a rbf cutoff but the current backend ({}) isn't OpenMP; ignoring --rbf_cutoff={}",
+                                 used_backend,
+                                 rbf_cutoff)
+                  << std::endl;
+        rbf_cutoff = 0.0;
+    } else if (csvm_params.kernel_type != kernel_function_type::rbf && rbf_cutoff > 0.0) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a rbf cutoff but the current kernel function isn't rbf; ignoring --rbf_cutoff={}",
+                                 rbf_cutoff)
+                  << std::endl;
+        rbf_cutoff = 0.0;
+    }
+    // only one kernel matrix approximation can be used at once
+    if (hodlr_tolerance > 0.0 && rbf_cutoff > 0.0) {
+        std::cerr << "Only one of --hodlr_tolerance and --rbf_cutoff may be given!" << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    // the cost path always uses the dense kernel matrix
+    if (!cost_path.empty() && (hodlr_tolerance > 0.0 || rbf_cutoff > 0.0)) {
+        std::cerr << "--cost_path can't be combined with --hodlr_tolerance or --rbf_cutoff!" << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
     // parse kernel invocation type when using SYCL as backend
     sycl_kernel_invocation_type = result["sycl_kernel_invocation_type"].as<decltype(sycl_kernel_invocation_type)>();
@@ -187,6 +564,61 @@ parser_train::parser_train(int argc, char **argv) {
     // parse whether strings should be used as labels
     strings_as_labels = result["use_strings_as_labels"].as<decltype(strings_as_labels)>();
 
+    // parse the options used to read CSV and NumPy input files
+    input_options.delimiter = result["csv_delimiter"].as<decltype(input_options.delimiter)>();
+    input_options.has_header = result["csv_header"].as<decltype(input_options.has_header)>();
+    const std::string label_column = result["csv_label_column"].as<std::string>();
+    if (label_column == "none") {
+        input_options.label_column = std::nullopt;
+    } else {
+        try {
+            input_options.label_column = detail::convert_to<long long>(label_column);
+        } catch (const std::exception &) {
+            std::cerr << fmt::format("Error invalid label column \"{}\"! Must be an integer or \"none\".", label_column) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // parse the subset of the features and data points read from the input file
+    if (result.count("features")) {
+        try {
+            subset.features = detail::io::parse_feature_selection(result["features"].as<std::string>());
+        } catch (const invalid_parameter_exception &e) {
+            std::cerr << e.what() << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    if (result.count("sample_size")) {
+        const auto sample_size_input = result["sample_size"].as<long long int>();
+        // check if the provided sample size is legal
+        if (sample_size_input < decltype(sample_size_input){ 1 }) {
+            std::cerr << fmt::format("sample_size must be greater than 0, but is {}!", sample_size_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided sample size was legal -> override default value
+        subset.num_samples = static_cast<decltype(subset.num_samples)>(sample_size_input);
+    }
+    subset.sampling = result["sampling"].as<decltype(subset.sampling)>();
+
+    // warn if a sampling strategy is explicitly set but no sample is drawn
+    if (subset.num_samples == 0 && result.count("sampling")) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a sampling strategy but --sample_size isn't set; ignoring --sampling={}",
+                                 subset.sampling)
+                  << std::endl;
+    }
+
+    // parse the settings of the cache storing the parsed content of text input files
+    cache_options.enabled = result["cache"].as<decltype(cache_options.enabled)>() || result.count("cache_dir") > 0;
+    if (result.count("cache_dir")) {
+        cache_options.directory = result["cache_dir"].as<std::string>();
+    }
+    cache_options.max_size = result["cache_max_size"].as<std::uintmax_t>() * 1024 * 1024;
+    cache_options.fingerprint = result["cache_fingerprint"].as<decltype(cache_options.fingerprint)>();
+
     // parse whether floats should be used as real_type
     float_as_real_type = result["use_float_as_real_type"].as<decltype(float_as_real_type)>();
 
@@ -221,10 +653,20 @@ parser_train::parser_train(int argc, char **argv) {
     if (result.count("model")) {
         model_filename = result["model"].as<decltype(model_filename)>();
     } else {
-        const std::filesystem::path input_path{ input_filename };
+        // the standard input has no meaningful filename
+        const std::filesystem::path input_path{ detail::io::is_standard_input(input_filename) ? "stdin" : input_filename };
         model_filename = input_path.filename().string() + ".model";
     }
 
+    // parse checkpoint filename
+    if (checkpoint_interval > 0 || resume) {
+        if (result.count("checkpoint_file")) {
+            checkpoint_filename = result["checkpoint_file"].as<decltype(checkpoint_filename)>();
+        } else {
+            checkpoint_filename = model_filename + ".checkpoint";
+        }
+    }
+
     // parse performance tracking filename
     if (result.count("performance_tracking")) {
         performance_tracking_filename = result["performance_tracking"].as<decltype(performance_tracking_filename)>();
@@ -249,13 +691,72 @@ std::ostream &operator<<(std::ostream &out, const parser_train &params) {
             out << fmt::format("gamma: {}\n", params.csvm_params.gamma);
             break;
     }
-    out << fmt::format("cost: {}{}\n", params.csvm_params.cost.value(), params.csvm_params.cost.is_default() ? " (default)" : "");
+    if (params.cost_path.empty()) {
+        out << fmt::format("cost: {}{}\n", params.csvm_params.cost.value(), params.csvm_params.cost.is_default() ? " (default)" : "");
+    } else {
+        out << fmt::format("cost path: [{}]\n", fmt::join(params.cost_path, ", "));
+    }
     out << fmt::format("epsilon: {}{}\n", params.epsilon.value(), params.epsilon.is_default() ? " (default)" : "");
     if (params.max_iter.is_default()) {
         out << "max_iter: num_data_points (default)\n";
     } else {
         out << fmt::format("max_iter: {}\n", params.max_iter.value());
     }
+    if (params.solver != solver_type::cg) {
+        out << fmt::format("solver: {}\n", params.solver);
+    }
+    if (!params.solver_state_filename.empty()) {
+        out << fmt::format("solver state file: '{}'\n", params.solver_state_filename);
+    }
+    if (params.checkpoint_interval > 0) {
+        out << fmt::format("checkpoint interval: {} iterations\n", params.checkpoint_interval);
+    }
+    if (params.resume) {
+        out << "resume: true\n";
+    }
+    if (!params.checkpoint_filename.empty()) {
+        out << fmt::format("checkpoint file: '{}'\n", params.checkpoint_filename);
+    }
+    if (params.append) {
+        out << "append: true\n";
+    }
+
+    if (params.loo) {
+        out << fmt::format("leave-one-out: true ({} probing vectors{})\n", params.loo_probes.value(), params.loo_probes.is_default() ? " (default)" : "");
+    }
+    if (params.cross_validation > 0) {
+        out << fmt::format("cross-validation: {} folds\n", params.cross_validation);
+    }
+    if (params.num_partitions > 1) {
+        out << fmt::format("cascade training: {} partitions\n", params.num_partitions);
+    }
+    if (params.num_landmarks > 0) {
+        out << fmt::format("fixed-size LS-SVM: {} landmarks ({} selection)\n", params.num_landmarks, params.landmark_selection);
+    }
+    if (params.prune_to > 0) {
+        out << fmt::format("sparse LS-SVM: {} support vectors (prune fraction: {}{}, max accuracy drop: {}{})\n", params.prune_to, params.prune_fraction.value(), params.prune_fraction.is_default() ? " (default)" : "", params.max_accuracy_drop.value(), params.max_accuracy_drop.is_default() ? " (default)" : "");
+    }
+    if (params.reduce_to > 0) {
+        out << fmt::format("support vector reduction: {} support vectors (tolerance: {}{})\n", params.reduce_to, params.reduce_tolerance.value(), params.reduce_tolerance.is_default() ? " (default)" : "");
+    }
+    if (params.hodlr_tolerance > 0.0) {
+        out << fmt::format("HODLR tolerance: {}\n", params.hodlr_tolerance);
+    }
+    if (params.rbf_cutoff > 0.0) {
+        out << fmt::format("rbf cutoff: {}\n", params.rbf_cutoff);
+    }
+    if (params.input_options.delimiter != csv_options{}.delimiter || params.input_options.has_header || params.input_options.label_column != csv_options{}.label_column) {
+        out << fmt::format("CSV options: delimiter '{}', header: {}, label column: {}\n",
+                           params.input_options.delimiter,
+                           params.input_options.has_header,
+                           params.input_options.label_column.has_value() ? fmt::format("{}", params.input_options.label_column.value()) : "none");
+    }
+    if (!params.subset.features.empty() || params.subset.num_samples > 0) {
+        out << fmt::format("data set subset: {}\n", params.subset);
+    }
+    if (params.cache_options.enabled) {
+        out << fmt::format("data set cache: {}\n", params.cache_options);
+    }
 
     return out << fmt::format(
                "label_type: {}\n"
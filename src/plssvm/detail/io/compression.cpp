@@ -0,0 +1,603 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/io/compression.hpp"
+
+#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::ends_with
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::file_not_found_exception, plssvm::file_reader_exception, plssvm::invalid_file_format_exception
+
+#include "fmt/core.h"                        // fmt::format
+#include "fmt/ostream.h"                     // can use fmt using operator<< overloads
+
+#if defined(PLSSVM_HAS_ZLIB)
+    #include "zlib.h"                        // z_stream, inflateInit2, inflate, inflateReset, inflateEnd, Z_OK, Z_STREAM_END, Z_BUF_ERROR, Z_NO_FLUSH
+#endif
+#if defined(PLSSVM_HAS_ZSTD)
+    #include "zstd.h"                        // ZSTD_DCtx, ZSTD_createDCtx, ZSTD_freeDCtx, ZSTD_decompressStream, ZSTD_decompress, ZSTD_findFrameCompressedSize,
+                                             // ZSTD_getFrameContentSize, ZSTD_isError, ZSTD_getErrorName, ZSTD_CONTENTSIZE_UNKNOWN, ZSTD_CONTENTSIZE_ERROR
+#endif
+
+#include <algorithm>                         // std::max, std::min, std::copy
+#include <climits>                           // UINT_MAX
+#include <cstddef>                           // std::size_t, std::ptrdiff_t
+#include <cstdint>                           // std::uint32_t
+#include <exception>                         // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <fstream>                           // std::ifstream
+#include <ios>                               // std::ios, std::streamsize
+#include <limits>                            // std::numeric_limits
+#include <memory>                            // std::unique_ptr, std::make_unique
+#include <optional>                          // std::optional, std::nullopt
+#include <ostream>                           // std::ostream
+#include <string>                            // std::string
+#include <string_view>                       // std::string_view
+#include <tuple>                             // std::ignore
+#include <utility>                           // std::move
+#include <vector>                            // std::vector
+
+namespace plssvm::detail::io {
+
+std::ostream &operator<<(std::ostream &out, const compression_type type) {
+    switch (type) {
+        case compression_type::none:
+            return out << "none";
+        case compression_type::gzip:
+            return out << "gzip";
+        case compression_type::zstd:
+            return out << "zstd";
+    }
+    return out << "unknown";
+}
+
+compression_type determine_compression_type(const std::string_view filename) noexcept {
+    if (detail::ends_with(filename, ".gz")) {
+        return compression_type::gzip;
+    } else if (detail::ends_with(filename, ".zst")) {
+        return compression_type::zstd;
+    }
+    return compression_type::none;
+}
+
+std::string_view remove_compression_extension(std::string_view filename) noexcept {
+    switch (determine_compression_type(filename)) {
+        case compression_type::none:
+            break;
+        case compression_type::gzip:
+            filename.remove_suffix(std::string_view{ ".gz" }.size());
+            break;
+        case compression_type::zstd:
+            filename.remove_suffix(std::string_view{ ".zst" }.size());
+            break;
+    }
+    return filename;
+}
+
+bool is_compression_type_supported(const compression_type type) noexcept {
+    switch (type) {
+        case compression_type::none:
+            return true;
+        case compression_type::gzip:
+#if defined(PLSSVM_HAS_ZLIB)
+            return true;
+#else
+            return false;
+#endif
+        case compression_type::zstd:
+#if defined(PLSSVM_HAS_ZSTD)
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+namespace {
+
+/**
+ * @brief The result of one decompression step.
+ */
+struct decompression_step_result {
+    /// The number of consumed compressed bytes.
+    std::size_t consumed{ 0 };
+    /// The number of produced decompressed bytes.
+    std::size_t produced{ 0 };
+    /// `true` if the current gzip member or Zstandard frame has been decompressed completely.
+    bool finished{ false };
+};
+
+/**
+ * @brief Base class of all decompression contexts, wrapping the streaming API of the respective compression library.
+ */
+class decompression_context {
+  public:
+    /**
+     * @brief Default virtual destructor.
+     */
+    virtual ~decompression_context() = default;
+    /**
+     * @brief Decompress as much of the @p in_size bytes in @p in as fits into the @p out_size bytes of @p out.
+     * @details Multiple concatenated gzip members or Zstandard frames are decompressed one after another.
+     * @param[in] in the compressed input
+     * @param[in] in_size the number of compressed bytes
+     * @param[out] out the decompressed output
+     * @param[in] out_size the number of bytes available in @p out
+     * @throws plssvm::invalid_file_format_exception if the input isn't valid compressed data
+     * @return the number of consumed and produced bytes (`[[nodiscard]]`)
+     */
+    [[nodiscard]] virtual decompression_step_result step(const char *in, std::size_t in_size, char *out, std::size_t out_size) = 0;
+};
+
+#if defined(PLSSVM_HAS_ZLIB)
+/**
+ * @brief Decompression context for gzip compressed data using zlib.
+ */
+class gzip_decompression_context final : public decompression_context {
+  public:
+    /**
+     * @brief Initialize the zlib stream.
+     * @param[in] filename the name of the compressed file (only used in error messages)
+     * @throws plssvm::file_reader_exception if the zlib stream couldn't be initialized
+     */
+    explicit gzip_decompression_context(std::string filename) :
+        filename_{ std::move(filename) } {
+        // 15 + 32: maximum window size and automatic gzip/zlib header detection
+        if (inflateInit2(&stream_, 15 + 32) != Z_OK) {
+            throw file_reader_exception{ fmt::format("Couldn't initialize the zlib stream to decompress the file '{}'!", filename_) };
+        }
+    }
+    gzip_decompression_context(const gzip_decompression_context &) = delete;
+    gzip_decompression_context &operator=(const gzip_decompression_context &) = delete;
+    ~gzip_decompression_context() override {
+        inflateEnd(&stream_);
+    }
+
+    [[nodiscard]] decompression_step_result step(const char *in, const std::size_t in_size, char *out, const std::size_t out_size) override {
+        // zlib uses 32-bit sizes
+        const auto avail_in = static_cast<uInt>(std::min<std::size_t>(in_size, UINT_MAX));
+        const auto avail_out = static_cast<uInt>(std::min<std::size_t>(out_size, UINT_MAX));
+        stream_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(in));
+        stream_.avail_in = avail_in;
+        stream_.next_out = reinterpret_cast<Bytef *>(out);
+        stream_.avail_out = avail_out;
+
+        const int ret = inflate(&stream_, Z_NO_FLUSH);
+        decompression_step_result result{ avail_in - stream_.avail_in, avail_out - stream_.avail_out, false };
+        if (ret == Z_STREAM_END) {
+            // the current gzip member has been decompressed -> prepare for a potential next member
+            result.finished = true;
+            inflateReset(&stream_);
+        } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            // Z_BUF_ERROR only indicates that no progress was possible
+            throw invalid_file_format_exception{ fmt::format("Error while decompressing the gzip compressed file '{}': {}!", filename_, stream_.msg != nullptr ? stream_.msg : "unknown error") };
+        }
+        return result;
+    }
+
+  private:
+    /// The name of the compressed file.
+    std::string filename_;
+    /// The zlib stream.
+    z_stream stream_{};
+};
+#endif
+
+#if defined(PLSSVM_HAS_ZSTD)
+/**
+ * @brief Decompression context for Zstandard compressed data using zstd.
+ */
+class zstd_decompression_context final : public decompression_context {
+  public:
+    /**
+     * @brief Create the zstd decompression context.
+     * @param[in] filename the name of the compressed file (only used in error messages)
+     * @throws plssvm::file_reader_exception if the zstd decompression context couldn't be created
+     */
+    explicit zstd_decompression_context(std::string filename) :
+        filename_{ std::move(filename) },
+        context_{ ZSTD_createDCtx() } {
+        if (context_ == nullptr) {
+            throw file_reader_exception{ fmt::format("Couldn't create the zstd context to decompress the file '{}'!", filename_) };
+        }
+    }
+    zstd_decompression_context(const zstd_decompression_context &) = delete;
+    zstd_decompression_context &operator=(const zstd_decompression_context &) = delete;
+    ~zstd_decompression_context() override {
+        ZSTD_freeDCtx(context_);
+    }
+
+    [[nodiscard]] decompression_step_result step(const char *in, const std::size_t in_size, char *out, const std::size_t out_size) override {
+        ZSTD_inBuffer input{ in, in_size, 0 };
+        ZSTD_outBuffer output{ out, out_size, 0 };
+        const std::size_t ret = ZSTD_decompressStream(context_, &output, &input);
+        if (ZSTD_isError(ret)) {
+            throw invalid_file_format_exception{ fmt::format("Error while decompressing the zstd compressed file '{}': {}!", filename_, ZSTD_getErrorName(ret)) };
+        }
+        // a return value of 0 indicates that the current frame has been decompressed and flushed completely
+        return decompression_step_result{ input.pos, output.pos, ret == 0 };
+    }
+
+  private:
+    /// The name of the compressed file.
+    std::string filename_;
+    /// The zstd decompression context.
+    ZSTD_DCtx *context_{ nullptr };
+};
+#endif
+
+/**
+ * @brief Throw an exception if decompressing files compressed using @p type isn't supported.
+ * @param[in] type the compression type
+ * @param[in] filename the name of the compressed file (only used in error messages)
+ * @throws plssvm::file_reader_exception if decompressing @p type isn't supported
+ */
+void check_compression_type_supported(const compression_type type, const std::string &filename) {
+    if (!is_compression_type_supported(type)) {
+        throw file_reader_exception{ fmt::format("Can't decompress the {} compressed file '{}' since PLSSVM was built without {} support!", type, filename, type == compression_type::gzip ? "zlib" : "zstd") };
+    }
+}
+
+/**
+ * @brief Create the decompression context for @p type.
+ * @param[in] type the compression type
+ * @param[in] filename the name of the compressed file (only used in error messages)
+ * @throws plssvm::file_reader_exception if decompressing @p type isn't supported
+ * @return the decompression context (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::unique_ptr<decompression_context> make_decompression_context(const compression_type type, const std::string &filename) {
+    PLSSVM_ASSERT(type != compression_type::none, "Can't create a decompression context for uncompressed files!");
+
+    check_compression_type_supported(type, filename);
+#if defined(PLSSVM_HAS_ZLIB)
+    if (type == compression_type::gzip) {
+        return std::make_unique<gzip_decompression_context>(filename);
+    }
+#endif
+#if defined(PLSSVM_HAS_ZSTD)
+    if (type == compression_type::zstd) {
+        return std::make_unique<zstd_decompression_context>(filename);
+    }
+#endif
+    throw file_reader_exception{ fmt::format("Unknown compression type for the file '{}'!", filename) };
+}
+
+/**
+ * @brief Sequentially decompress the whole @p content compressed using @p type.
+ * @param[in] content the compressed content
+ * @param[in] type the compression type of @p content
+ * @param[in] filename the name of the compressed file (only used in error messages)
+ * @throws plssvm::file_reader_exception if decompressing @p type isn't supported
+ * @throws plssvm::invalid_file_format_exception if @p content isn't a valid (or is a truncated) compressed file
+ * @return the decompressed content (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<char> decompress_sequential(const std::string_view content, const compression_type type, const std::string &filename) {
+    const std::unique_ptr<decompression_context> context = make_decompression_context(type, filename);
+
+    // text files typically compress well -> start with an output buffer three times larger than the compressed content
+    std::vector<char> result(std::max<std::size_t>(3 * content.size(), 4096));
+    std::size_t in_pos = 0;
+    std::size_t out_pos = 0;
+    bool finished = true;
+    while (true) {
+        if (out_pos == result.size()) {
+            // the output buffer is full -> enlarge it
+            result.resize(2 * result.size());
+        }
+        const decompression_step_result step = context->step(content.data() + in_pos, content.size() - in_pos, result.data() + out_pos, result.size() - out_pos);
+        in_pos += step.consumed;
+        out_pos += step.produced;
+        if (step.consumed == 0 && step.produced == 0) {
+            // no progress is possible anymore
+            break;
+        }
+        finished = step.finished;
+    }
+    if (!finished || in_pos < content.size()) {
+        throw invalid_file_format_exception{ fmt::format("The {} compressed file '{}' is truncated!", type, filename) };
+    }
+
+    result.resize(out_pos);
+    result.shrink_to_fit();
+    return result;
+}
+
+/**
+ * @brief A compressed block that can be decompressed independently of all other blocks.
+ */
+struct compressed_block {
+    /// The offset of the block in the compressed content.
+    std::size_t offset{ 0 };
+    /// The size of the compressed block.
+    std::size_t size{ 0 };
+    /// The size of the decompressed block.
+    std::size_t decompressed_size{ 0 };
+};
+
+/// The maximum decompressed size of a BGZF block (64 KiB).
+constexpr std::size_t max_bgzf_block_size = std::size_t{ 1 } << 16;
+/// The maximum compression ratio of a Zstandard frame: a 3 byte block header and a single byte can encode a run-length block of up to 128 KiB.
+constexpr std::size_t max_zstd_compression_ratio = (std::size_t{ 1 } << 17) / 4;
+
+/**
+ * @brief Check whether the decompressed sizes of the @p blocks stored in the (untrusted) headers are plausible, i.e., whether the result can safely be allocated upfront.
+ * @details The decompressed size of a BGZF block may not exceed 64 KiB and the decompressed size of a Zstandard frame may not exceed its maximum compression ratio.
+ *          Additionally, the total decompressed size may not overflow.
+ * @param[in] blocks the position of each compressed block together with its decompressed size
+ * @param[in] type the compression type of the @p blocks
+ * @return `true` if all decompressed sizes are plausible, `false` otherwise (`[[nodiscard]]`)
+ */
+[[nodiscard]] bool has_plausible_decompressed_sizes(const std::vector<compressed_block> &blocks, const compression_type type) {
+    std::size_t total_size{ 0 };
+    for (const compressed_block &block : blocks) {
+        std::size_t max_size = max_bgzf_block_size;
+        if (type == compression_type::zstd) {
+            max_size = block.size > std::numeric_limits<std::size_t>::max() / max_zstd_compression_ratio ? std::numeric_limits<std::size_t>::max() : block.size * max_zstd_compression_ratio;
+        }
+        if (block.decompressed_size > max_size || block.decompressed_size > std::vector<char>{}.max_size() - total_size) {
+            return false;
+        }
+        total_size += block.decompressed_size;
+    }
+    return true;
+}
+
+/**
+ * @brief Decompress all independently compressed @p blocks of @p content in parallel, each directly into its part of the result.
+ * @pre The decompressed sizes of the @p blocks must be plausible (see has_plausible_decompressed_sizes).
+ * @param[in] content the compressed content
+ * @param[in] blocks the position of each compressed block in @p content together with its decompressed size
+ * @param[in] type the compression type of @p content
+ * @param[in] filename the name of the compressed file (only used in error messages)
+ * @throws plssvm::invalid_file_format_exception if a block isn't valid compressed data or its decompressed size doesn't match the expected one
+ * @return the decompressed content (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<char> decompress_blocks_parallel(const std::string_view content, const std::vector<compressed_block> &blocks, const compression_type type, const std::string &filename) {
+    // calculate the offset of each block in the decompressed content
+    std::vector<std::size_t> out_offsets(blocks.size() + 1, 0);
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        out_offsets[i + 1] = out_offsets[i] + blocks[i].decompressed_size;
+    }
+    std::vector<char> result(out_offsets.back());
+
+    std::exception_ptr parallel_exception;
+    #pragma omp parallel default(none) shared(content, blocks, type, filename, out_offsets, result, parallel_exception)
+    {
+        // reuse the decompression context for all blocks of the current thread
+        std::unique_ptr<decompression_context> context{};
+
+        #pragma omp for schedule(dynamic)
+        for (std::size_t i = 0; i < blocks.size(); ++i) {
+            try {
+                // blocks without content (e.g., the BGZF end-of-file marker) can be skipped
+                if (blocks[i].decompressed_size > 0) {
+                    if (!context) {
+                        context = make_decompression_context(type, filename);
+                    }
+                    const decompression_step_result step = context->step(content.data() + blocks[i].offset, blocks[i].size, result.data() + out_offsets[i], blocks[i].decompressed_size);
+                    // the block must be decompressed completely in exactly one step
+                    if (!step.finished || step.consumed != blocks[i].size || step.produced != blocks[i].decompressed_size) {
+                        throw invalid_file_format_exception{ fmt::format("The decompressed size of the block starting at byte {} in the {} compressed file '{}' doesn't match its header!", blocks[i].offset, type, filename) };
+                    }
+                }
+            } catch (const std::exception &) {
+                // the context may be in an inconsistent state
+                context.reset();
+                // catch first exception and store it
+                #pragma omp critical
+                {
+                    if (!parallel_exception) {
+                        parallel_exception = std::current_exception();
+                    }
+                }
+            }
+        }
+    }
+    // rethrow if an exception occurred inside the parallel region
+    if (parallel_exception) {
+        std::rethrow_exception(parallel_exception);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Split the gzip compressed @p content into its BGZF blocks, which can be decompressed independently.
+ * @details A BGZF file consists of gzip members whose "BC" extra field contains the size of the member. The decompressed size is stored in the gzip trailer.
+ * @param[in] content the gzip compressed content
+ * @return all BGZF blocks or `std::nullopt` if @p content isn't a BGZF file (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::optional<std::vector<compressed_block>> split_bgzf_blocks(const std::string_view content) {
+    const auto *data = reinterpret_cast<const unsigned char *>(content.data());
+    const auto read_little_endian = [data](const std::size_t pos, const std::size_t num_bytes) {
+        std::uint32_t value{ 0 };
+        for (std::size_t i = 0; i < num_bytes; ++i) {
+            value |= static_cast<std::uint32_t>(data[pos + i]) << (8 * i);
+        }
+        return value;
+    };
+
+    // gzip header (10 bytes) + XLEN (2 bytes)
+    constexpr std::size_t header_size = 12;
+    // CRC32 (4 bytes) + ISIZE (4 bytes)
+    constexpr std::size_t trailer_size = 8;
+
+    std::vector<compressed_block> blocks;
+    std::size_t pos = 0;
+    while (pos < content.size()) {
+        // check the gzip magic bytes, the deflate compression method, and the FEXTRA flag
+        if (content.size() - pos < header_size || data[pos] != 0x1f || data[pos + 1] != 0x8b || data[pos + 2] != 8 || (data[pos + 3] & 0x04) == 0) {
+            return std::nullopt;
+        }
+        const std::size_t extra_size = read_little_endian(pos + 10, 2);
+        if (content.size() - pos < header_size + extra_size) {
+            return std::nullopt;
+        }
+        // search for the BGZF subfield: SI1 = 'B', SI2 = 'C', SLEN = 2, BSIZE (total block size - 1)
+        std::size_t block_size = 0;
+        for (std::size_t sub = pos + header_size; sub + 4 <= pos + header_size + extra_size;) {
+            const std::size_t subfield_size = read_little_endian(sub + 2, 2);
+            if (data[sub] == 'B' && data[sub + 1] == 'C' && subfield_size == 2 && sub + 6 <= pos + header_size + extra_size) {
+                block_size = read_little_endian(sub + 4, 2) + 1;
+            }
+            sub += 4 + subfield_size;
+        }
+        if (block_size < header_size + extra_size + trailer_size || content.size() - pos < block_size) {
+            return std::nullopt;
+        }
+        blocks.push_back(compressed_block{ pos, block_size, read_little_endian(pos + block_size - 4, 4) });
+        pos += block_size;
+    }
+    return blocks;
+}
+
+#if defined(PLSSVM_HAS_ZSTD)
+/**
+ * @brief Split the Zstandard compressed @p content into its frames, which can be decompressed independently.
+ * @param[in] content the Zstandard compressed content
+ * @return all frames or `std::nullopt` if the decompressed size of any frame isn't stored in its header (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::optional<std::vector<compressed_block>> split_zstd_frames(const std::string_view content) {
+    std::vector<compressed_block> frames;
+    std::size_t pos = 0;
+    while (pos < content.size()) {
+        const std::size_t frame_size = ZSTD_findFrameCompressedSize(content.data() + pos, content.size() - pos);
+        if (ZSTD_isError(frame_size)) {
+            return std::nullopt;
+        }
+        const unsigned long long decompressed_size = ZSTD_getFrameContentSize(content.data() + pos, frame_size);
+        if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN || decompressed_size == ZSTD_CONTENTSIZE_ERROR) {
+            return std::nullopt;
+        }
+        frames.push_back(compressed_block{ pos, frame_size, static_cast<std::size_t>(decompressed_size) });
+        pos += frame_size;
+    }
+    return frames;
+}
+#endif
+
+}  // namespace
+
+std::vector<char> decompress(const std::string_view content, const compression_type type, const std::string &filename) {
+    PLSSVM_ASSERT(type != compression_type::none, "Can't decompress an uncompressed file!");
+    check_compression_type_supported(type, filename);
+
+    // check whether the content consists of independently compressed blocks with known sizes
+    std::optional<std::vector<compressed_block>> blocks{};
+    if (type == compression_type::gzip) {
+        blocks = split_bgzf_blocks(content);
+    }
+#if defined(PLSSVM_HAS_ZSTD)
+    if (type == compression_type::zstd) {
+        blocks = split_zstd_frames(content);
+    }
+#endif
+
+    // the decompressed sizes are read from the headers -> only trust them if they are plausible, otherwise the sequential decompression only allocates what is actually produced
+    if (blocks.has_value() && !blocks->empty() && has_plausible_decompressed_sizes(blocks.value(), type)) {
+        return decompress_blocks_parallel(content, blocks.value(), type, filename);
+    }
+    return decompress_sequential(content, type, filename);
+}
+
+//*************************************************************************************************************************************//
+//                                                      decompressing stream buffer                                                    //
+//*************************************************************************************************************************************//
+
+/**
+ * @brief The state necessary to decompress a file on-the-fly.
+ */
+struct decompressing_streambuf::decompressor {
+    /// The size of the buffer holding the compressed data (256 KiB).
+    static constexpr std::size_t input_buffer_size = 256 * 1024;
+
+    /// The type of the compression.
+    compression_type type{};
+    /// The name of the compressed file.
+    std::string filename{};
+    /// The compressed file.
+    std::ifstream file{};
+    /// The decompression context.
+    std::unique_ptr<decompression_context> context{};
+    /// The buffer holding the compressed data.
+    std::vector<char> input_buffer = std::vector<char>(input_buffer_size);
+    /// The position of the first not yet decompressed byte in the input buffer.
+    std::size_t input_pos{ 0 };
+    /// The number of valid bytes in the input buffer.
+    std::size_t input_size{ 0 };
+    /// `false` if the current gzip member or Zstandard frame hasn't been decompressed completely.
+    bool finished{ true };
+
+    /**
+     * @brief Move the not yet decompressed bytes to the front of the input buffer and fill the remaining buffer with the next bytes of the file.
+     * @throws plssvm::invalid_file_format_exception if an error occurs while reading the file
+     * @return the number of newly read bytes (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t refill() {
+        std::copy(input_buffer.begin() + static_cast<std::ptrdiff_t>(input_pos), input_buffer.begin() + static_cast<std::ptrdiff_t>(input_size), input_buffer.begin());
+        input_size -= input_pos;
+        input_pos = 0;
+
+        file.read(input_buffer.data() + input_size, static_cast<std::streamsize>(input_buffer.size() - input_size));
+        if (file.bad()) {
+            throw invalid_file_format_exception{ fmt::format("Error while reading file: '{}'!", filename) };
+        }
+        const auto num_read = static_cast<std::size_t>(file.gcount());
+        input_size += num_read;
+        return num_read;
+    }
+};
+
+decompressing_streambuf::decompressing_streambuf(const std::string &filename, const compression_type type) :
+    decompressor_{ std::make_unique<decompressor>() },
+    buffer_(buffer_size) {
+    PLSSVM_ASSERT(type != compression_type::none, "Can't decompress an uncompressed file!");
+
+    decompressor_->type = type;
+    decompressor_->filename = filename;
+    decompressor_->file.open(filename, std::ios::binary);
+    if (!decompressor_->file.is_open()) {
+        throw file_not_found_exception{ fmt::format("Couldn't find file: '{}'!", filename) };
+    }
+    decompressor_->context = make_decompression_context(type, filename);
+    // the buffer is initially empty
+    this->setg(buffer_.data(), buffer_.data(), buffer_.data());
+}
+
+decompressing_streambuf::~decompressing_streambuf() = default;
+
+auto decompressing_streambuf::underflow() -> int_type {
+    if (this->gptr() < this->egptr()) {
+        return traits_type::to_int_type(*this->gptr());
+    }
+
+    decompressor &state = *decompressor_;
+    while (true) {
+        // read the next compressed bytes if all bytes have been decompressed
+        if (state.input_pos == state.input_size) {
+            std::ignore = state.refill();
+        }
+        const decompression_step_result step = state.context->step(state.input_buffer.data() + state.input_pos, state.input_size - state.input_pos, buffer_.data(), buffer_.size());
+        state.input_pos += step.consumed;
+        if (step.consumed > 0 || step.produced > 0) {
+            state.finished = step.finished;
+        }
+        if (step.produced > 0) {
+            this->setg(buffer_.data(), buffer_.data(), buffer_.data() + step.produced);
+            return traits_type::to_int_type(*this->gptr());
+        }
+        if (step.consumed == 0 && state.refill() == 0) {
+            // no progress possible and the whole file has been read
+            if (!state.finished || state.input_pos < state.input_size) {
+                throw invalid_file_format_exception{ fmt::format("The {} compressed file '{}' is truncated!", state.type, state.filename) };
+            }
+            return traits_type::eof();
+        }
+    }
+}
+
+}  // namespace plssvm::detail::io
@@ -0,0 +1,251 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/io/data_set_cache.hpp"
+
+#include "plssvm/detail/sha256.hpp"          // plssvm::detail::sha256
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::{file_not_found_exception, file_exception}
+
+#include "fmt/core.h"                        // fmt::format
+#include "fmt/ostream.h"                     // can use fmt using operator<< overloads
+
+#include <algorithm>                         // std::sort
+#include <cstddef>                           // std::size_t
+#include <cstdint>                           // std::uintmax_t
+#include <cstdlib>                           // std::getenv
+#include <filesystem>                        // std::filesystem::{path, temp_directory_path, canonical, is_regular_file, file_size, last_write_time, exists, remove,
+                                             // create_directory, create_directories, permissions, perms, rename, directory_iterator, file_time_type}
+#include <fstream>                           // std::ifstream
+#include <ios>                               // std::ios, std::streamoff, std::streamsize
+#include <optional>                          // std::optional, std::nullopt
+#include <ostream>                           // std::ostream
+#include <random>                            // std::random_device
+#include <string>                            // std::string
+#include <string_view>                       // std::string_view
+#include <system_error>                      // std::error_code
+#include <tuple>                             // std::tuple
+#include <utility>                           // std::move
+#include <vector>                            // std::vector
+
+// check if the owner of a directory can be determined
+#if __has_include(<sys/stat.h>) && __has_include(<unistd.h>)
+    #include <sys/stat.h>  // stat, S_ISDIR, S_IWGRP, S_IWOTH
+    #include <unistd.h>    // geteuid
+
+    #define PLSSVM_HAS_FILE_OWNERSHIP
+#endif
+
+namespace plssvm {
+
+data_set_cache_options data_set_cache{};
+
+std::ostream &operator<<(std::ostream &out, const data_set_cache_options &options) {
+    if (!options.enabled) {
+        return out << "disabled";
+    }
+    return out << fmt::format("'{}' (max size: {} bytes, fingerprint: {})",
+                              detail::io::data_set_cache_directory(options).string(),
+                              options.max_size,
+                              options.fingerprint);
+}
+
+namespace detail::io {
+
+std::filesystem::path data_set_cache_directory(const data_set_cache_options &options) {
+    if (!options.directory.empty()) {
+        return options.directory;
+    }
+    // use the per-user cache directory as defined by the XDG Base Directory Specification
+    if (const char *xdg_cache_home = std::getenv("XDG_CACHE_HOME"); xdg_cache_home != nullptr && std::filesystem::path{ xdg_cache_home }.is_absolute()) {
+        return std::filesystem::path{ xdg_cache_home } / "plssvm" / "data_set_cache";
+    }
+    if (const char *home = std::getenv("HOME"); home != nullptr && std::filesystem::path{ home }.is_absolute()) {
+        return std::filesystem::path{ home } / ".cache" / "plssvm" / "data_set_cache";
+    }
+#if defined(PLSSVM_HAS_FILE_OWNERSHIP)
+    // the temporary directory is shared between all users -> the user ID makes the name unique
+    return std::filesystem::temp_directory_path() / fmt::format("plssvm_data_set_cache_{}", ::geteuid());
+#else
+    return std::filesystem::temp_directory_path() / "plssvm_data_set_cache";
+#endif
+}
+
+void check_data_set_cache_directory(const std::filesystem::path &directory) {
+#if defined(PLSSVM_HAS_FILE_OWNERSHIP)
+    struct ::stat status {};
+    if (::stat(directory.c_str(), &status) != 0) {
+        // a missing directory is created with the correct permissions
+        return;
+    }
+    if (!S_ISDIR(status.st_mode)) {
+        throw file_exception{ fmt::format("The data set cache directory \"{}\" isn't a directory!", directory.string()) };
+    }
+    // other users could otherwise inject arbitrary cache entries
+    if (status.st_uid != ::geteuid()) {
+        throw file_exception{ fmt::format("The data set cache directory \"{}\" isn't owned by the current user!", directory.string()) };
+    }
+    if ((status.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+        throw file_exception{ fmt::format("The data set cache directory \"{}\" is writable by other users!", directory.string()) };
+    }
+#else
+    // the owner can't be determined portably -> only check that the cache is a directory
+    std::error_code ec{};
+    if (std::filesystem::exists(directory, ec) && !std::filesystem::is_directory(directory, ec)) {
+        throw file_exception{ fmt::format("The data set cache directory \"{}\" isn't a directory!", directory.string()) };
+    }
+#endif
+}
+
+std::string data_set_cache_fingerprint(const std::filesystem::path &filename) {
+    std::ifstream in{ filename, std::ios::binary | std::ios::ate };
+    if (!in.good()) {
+        throw file_not_found_exception{ fmt::format("Couldn't find file: '{}'!", filename.string()) };
+    }
+    const auto num_bytes = static_cast<std::size_t>(in.tellg());
+
+    std::string samples{};
+    if (num_bytes <= data_set_cache_num_fingerprint_samples * data_set_cache_fingerprint_sample_size) {
+        // small files are hashed completely
+        samples.resize(num_bytes);
+        in.seekg(0);
+        in.read(samples.data(), static_cast<std::streamsize>(num_bytes));
+    } else {
+        // read equally spaced samples, the first one at the beginning and the last one at the end of the file
+        samples.resize(data_set_cache_num_fingerprint_samples * data_set_cache_fingerprint_sample_size);
+        const std::size_t last_offset = num_bytes - data_set_cache_fingerprint_sample_size;
+        for (std::size_t i = 0; i < data_set_cache_num_fingerprint_samples; ++i) {
+            in.seekg(static_cast<std::streamoff>(i * last_offset / (data_set_cache_num_fingerprint_samples - 1)));
+            in.read(samples.data() + i * data_set_cache_fingerprint_sample_size, static_cast<std::streamsize>(data_set_cache_fingerprint_sample_size));
+        }
+    }
+    // the file size is part of the fingerprint since the samples depend on it
+    samples.append(fmt::format("\n{}", num_bytes));
+    return sha256{}(std::move(samples));
+}
+
+std::optional<std::filesystem::path> data_set_cache_entry(const data_set_cache_options &options, const std::string &filename, const std::string_view parser_settings) {
+    if (!options.enabled) {
+        return std::nullopt;
+    }
+
+    // a file that can't be inspected isn't cached, the respective error is reported when actually reading the file
+    std::error_code ec{};
+    const std::filesystem::path path = std::filesystem::canonical(filename, ec);
+    if (ec || !std::filesystem::is_regular_file(path, ec)) {
+        return std::nullopt;
+    }
+    const std::uintmax_t file_size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const std::filesystem::file_time_type last_write_time = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    std::string fingerprint{};
+    if (options.fingerprint) {
+        try {
+            fingerprint = data_set_cache_fingerprint(path);
+        } catch (const file_not_found_exception &) {
+            return std::nullopt;
+        }
+    }
+
+    // never read cache entries that could have been written by other users
+    const std::filesystem::path cache_dir_name = data_set_cache_directory(options);
+    check_data_set_cache_directory(cache_dir_name);
+
+    // the name of the cache entry is the hash of everything influencing the parsed data
+    const std::string key = fmt::format("{}\n{}\n{}\n{}\n{}", path.string(), file_size, last_write_time.time_since_epoch().count(), fingerprint, parser_settings);
+    return cache_dir_name / fmt::format("{}.bin", sha256{}(key));
+}
+
+bool touch_data_set_cache_entry(const std::filesystem::path &entry) {
+    std::error_code ec{};
+    if (!std::filesystem::is_regular_file(entry, ec)) {
+        return false;
+    }
+    // the last modification time is used to determine the least recently used entries; ignore errors, e.g., due to a read-only cache
+    std::filesystem::last_write_time(entry, std::filesystem::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void remove_data_set_cache_entry(const std::filesystem::path &entry) {
+    std::error_code ec{};
+    std::filesystem::remove(entry, ec);
+}
+
+std::filesystem::path create_data_set_cache_file(const data_set_cache_options &options, const std::filesystem::path &entry) {
+    const std::filesystem::path cache_dir_name = data_set_cache_directory(options);
+    if (!std::filesystem::exists(cache_dir_name)) {
+        if (cache_dir_name.has_parent_path()) {
+            std::filesystem::create_directories(cache_dir_name.parent_path());
+        }
+        // only the current user may access the cached data sets; if the directory has been created concurrently, its permissions are checked below
+        if (std::filesystem::create_directory(cache_dir_name)) {
+            std::filesystem::permissions(cache_dir_name, std::filesystem::perms::owner_all, std::filesystem::perm_options::replace);
+        }
+    }
+    check_data_set_cache_directory(cache_dir_name);
+    // a random suffix guarantees that concurrent writers of the same entry don't interfere with each other
+    return cache_dir_name / fmt::format("{}.{:08x}.tmp", entry.filename().string(), std::random_device{}());
+}
+
+bool commit_data_set_cache_entry(const data_set_cache_options &options, const std::filesystem::path &temporary_file, const std::filesystem::path &entry) {
+    // an entry that doesn't fit into the cache would evict all other entries
+    if (options.max_size > 0 && std::filesystem::file_size(temporary_file) > options.max_size) {
+        remove_data_set_cache_entry(temporary_file);
+        return false;
+    }
+    // renaming a file is atomic, i.e., readers either see the old or the new (complete) entry
+    std::filesystem::rename(temporary_file, entry);
+    evict_data_set_cache_entries(options);
+    return true;
+}
+
+std::size_t evict_data_set_cache_entries(const data_set_cache_options &options) {
+    if (options.max_size == 0) {
+        return 0;
+    }
+
+    // gather all cache entries together with their last usage and size
+    std::vector<std::tuple<std::filesystem::file_time_type, std::uintmax_t, std::filesystem::path>> entries{};
+    std::uintmax_t total_size{ 0 };
+    std::error_code ec{};
+    for (const std::filesystem::directory_entry &dir_entry : std::filesystem::directory_iterator{ data_set_cache_directory(options), ec }) {
+        std::error_code entry_ec{};
+        if (dir_entry.path().extension() != ".bin" || !dir_entry.is_regular_file(entry_ec)) {
+            continue;
+        }
+        const std::uintmax_t size = dir_entry.file_size(entry_ec);
+        const std::filesystem::file_time_type last_usage = dir_entry.last_write_time(entry_ec);
+        if (!entry_ec) {
+            entries.emplace_back(last_usage, size, dir_entry.path());
+            total_size += size;
+        }
+    }
+
+    // evict the least recently used entries first
+    std::sort(entries.begin(), entries.end());
+    std::size_t num_evicted{ 0 };
+    for (const auto &[last_usage, size, path] : entries) {
+        if (total_size <= options.max_size) {
+            break;
+        }
+        if (std::filesystem::remove(path, ec)) {
+            total_size -= size;
+            ++num_evicted;
+        }
+    }
+    return num_evicted;
+}
+
+}  // namespace detail::io
+
+}  // namespace plssvm
@@ -9,6 +9,7 @@
 #include "plssvm/detail/io/file_reader.hpp"
 
 #include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/detail/io/compression.hpp"  // plssvm::detail::io::{compression_type, determine_compression_type, decompress}
 #include "plssvm/detail/string_utility.hpp"  // plssvm::detail::starts_with, plssvm::detail::trim_left
 #include "plssvm/exceptions/exceptions.hpp"  // plssvm::file_not_found_exception, plssvm::invalid_file_format_exception
 
@@ -18,8 +19,8 @@
 #if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
     #include <fcntl.h>     // open, O_RDONLY
     #include <sys/mman.h>  // mmap, munmap
-    #include <sys/stat.h>  // fstat
-    #include <unistd.h>    // close
+    #include <sys/stat.h>  // fstat, S_ISREG
+    #include <unistd.h>    // close, read, ssize_t
 #elif defined(PLSSVM_HAS_MEMORY_MAPPING_WINDOWS)
     #include <windows.h>   // CreateFile, GetLastError, GetFileSizeEx, CreateFileMapping, MapViewOfFile, UnmapViewOfFile, CloseHandle
                            // HANDLE, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_READONLY,l INVALID_HANDLE_VALUE, ERROR_FILE_NOT_FOUND,
@@ -27,12 +28,15 @@
 #endif
 
 #include <algorithm>    // std::min
+#include <cerrno>       // errno, EINTR
 #include <climits>      // INT32_MAX
 #include <cmath>        // std::ceil
+#include <cstddef>      // std::size_t
 #include <filesystem>   // std::filesystem::path
 #include <fstream>      // std::ifstream
 #include <ios>          // std::ios, std::streamsize
-#include <iostream>     // std::cerr, std::endl
+#include <iostream>     // std::cin, std::cerr, std::endl
+#include <istream>      // std::istream
 #include <limits>       // std::numeric_limits::max
 #include <memory>       // std::addressof
 #include <string>       // std::string
@@ -71,6 +75,7 @@ file_reader::file_reader(file_reader &&other) noexcept :
     must_unmap_file_{ std::exchange(other.must_unmap_file_, false) },
 #endif
     file_content_{ std::exchange(other.file_content_, nullptr) },
+    content_buffer_{ std::move(other.content_buffer_) },
     num_bytes_{ std::exchange(other.num_bytes_, 0) },
     lines_{ std::move(other.lines_) },
     is_open_{ std::exchange(other.is_open_, false) } {
@@ -92,6 +97,27 @@ void file_reader::open(const char *filename) {
         throw file_reader_exception{ "This file_reader is already associated to a file!" };
     }
 
+    const compression_type compression = determine_compression_type(filename);
+    if (is_standard_input(filename)) {
+        // the size of the standard input isn't known beforehand
+        this->open_stream(std::cin, filename);
+    } else if (compression == compression_type::none) {
+        this->open_uncompressed_file(filename);
+    } else {
+        // read the compressed file content (possibly memory mapped) and decompress it into the owned buffer
+        file_reader compressed_reader{};
+        compressed_reader.open_uncompressed_file(filename);
+        compressed_reader.is_open_ = true;
+        content_buffer_ = decompress(std::string_view{ compressed_reader.file_content_, static_cast<std::string_view::size_type>(compressed_reader.num_bytes_) }, compression, filename);
+        if (!content_buffer_.empty()) {
+            file_content_ = content_buffer_.data();
+        }
+        num_bytes_ = static_cast<std::streamsize>(content_buffer_.size());
+    }
+
+    is_open_ = true;
+}
+void file_reader::open_uncompressed_file(const char *filename) {
 #if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
     // headers for memory mapped IO on UNIX are present -> try it
     this->open_memory_mapped_file_unix(filename);
@@ -102,8 +128,6 @@ void file_reader::open(const char *filename) {
     // memory mapped IO headers are missing -> use std::ifstream instead
     this->open_file(filename);
 #endif
-
-    is_open_ = true;
 }
 void file_reader::open(const std::string &filename) {
     // open the provided file
@@ -143,6 +167,11 @@ void file_reader::close() {
         file_content_ = nullptr;
         must_unmap_file_ = false;
 #endif
+        // the decompressed or streamed content isn't allocated separately
+        if (!content_buffer_.empty()) {
+            file_content_ = nullptr;
+            content_buffer_ = std::vector<char>{};
+        }
         // delete allocated buffer (deleting nullptr is a no-op)
         delete[] file_content_;
         file_content_ = nullptr;
@@ -167,6 +196,7 @@ void file_reader::swap(file_reader &other) {
     swap(must_unmap_file_, other.must_unmap_file_);
 #endif
     swap(file_content_, other.file_content_);
+    swap(content_buffer_, other.content_buffer_);
     swap(num_bytes_, other.num_bytes_);
     swap(lines_, other.lines_);
     swap(is_open_, other.is_open_);
@@ -219,6 +249,9 @@ const std::vector<std::string_view> &file_reader::lines() const noexcept {
 const char *file_reader::buffer() const noexcept {
     return file_content_;
 }
+std::streamsize file_reader::num_bytes() const noexcept {
+    return num_bytes_;
+}
 
 void file_reader::open_memory_mapped_file_unix([[maybe_unused]] const char *filename) {
 #if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
@@ -230,7 +263,37 @@ void file_reader::open_memory_mapped_file_unix([[maybe_unused]] const char *file
         ::close(file_descriptor_);
         throw file_not_found_exception{ fmt::format("Couldn't find file: '{}'!", filename) };
     }
-    if (attr.st_size == 0) {
+    if (!S_ISREG(attr.st_mode)) {
+        // can't memory map pipes or character devices and their size isn't known beforehand -> read the already opened file descriptor in chunks
+        // (reopening the file would lose the data a writer already put into a named pipe)
+        constexpr std::size_t chunk_size = 1024 * 1024;
+        std::size_t size = 0;
+        while (true) {
+            content_buffer_.resize(size + chunk_size);
+            const ::ssize_t num_read = ::read(file_descriptor_, content_buffer_.data() + size, chunk_size);
+            if (num_read == -1 && errno == EINTR) {
+                // interrupted by a signal before anything has been read -> try again
+                continue;
+            }
+            if (num_read == -1) {
+                ::close(file_descriptor_);
+                content_buffer_ = std::vector<char>{};
+                throw invalid_file_format_exception{ fmt::format("Error while reading file: '{}'!", filename) };
+            }
+            if (num_read == 0) {
+                // end of file
+                break;
+            }
+            size += static_cast<std::size_t>(num_read);
+        }
+        ::close(file_descriptor_);
+        content_buffer_.resize(size);
+
+        if (!content_buffer_.empty()) {
+            file_content_ = content_buffer_.data();
+        }
+        num_bytes_ = static_cast<std::streamsize>(content_buffer_.size());
+    } else if (attr.st_size == 0) {
         // can't memory map empty file
         ::close(file_descriptor_);
         this->open_file(filename);
@@ -309,7 +372,7 @@ void file_reader::open_memory_mapped_file_windows([[maybe_unused]] const char *f
 
 void file_reader::open_file(const char *filename) {
     // open the file
-    std::ifstream f{ filename };
+    std::ifstream f{ filename, std::ios::binary };
     if (f.fail()) {
         throw file_not_found_exception{ fmt::format("Couldn't find file: '{}'!", filename) };
     }
@@ -335,6 +398,36 @@ void file_reader::open_file(const char *filename) {
     }
 }
 
+void file_reader::open_stream(std::istream &in, const char *filename) {
+    // the number of bytes read at once
+    constexpr std::size_t chunk_size = 1024 * 1024;
+
+    // read the stream in chunks, the buffer grows geometrically
+    std::size_t size = 0;
+    while (true) {
+        content_buffer_.resize(size + chunk_size);
+        in.read(content_buffer_.data() + size, static_cast<std::streamsize>(chunk_size));
+        size += static_cast<std::size_t>(in.gcount());
+        if (in.bad()) {
+            content_buffer_ = std::vector<char>{};
+            throw invalid_file_format_exception{ fmt::format("Error while reading file: '{}'!", filename) };
+        }
+        if (in.eof()) {
+            break;
+        }
+    }
+    content_buffer_.resize(size);
+
+    if (!content_buffer_.empty()) {
+        file_content_ = content_buffer_.data();
+    }
+    num_bytes_ = static_cast<std::streamsize>(content_buffer_.size());
+}
+
+bool is_standard_input(const std::string_view filename) noexcept {
+    return filename == "-" || filename == "/dev/stdin";
+}
+
 void swap(file_reader &lhs, file_reader &rhs) {
     lhs.swap(rhs);
 }
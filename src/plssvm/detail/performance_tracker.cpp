@@ -100,7 +100,9 @@ void performance_tracker::add_tracking_entry(const tracking_entry<cmd::parser_pr
                                                                       "  float_as_real_type:       {}\n"
                                                                       "  input_filename:           \"{}\"\n"
                                                                       "  model_filename:           \"{}\"\n"
-                                                                      "  predict_filename:         \"{}\"\n",
+                                                                      "  predict_filename:         \"{}\"\n"
+                                                                      "  chunk_size:               {}\n"
+                                                                      "  max_memory:               {}\n",
                                                                       entry.entry_value.backend,
                                                                       entry.entry_value.target,
                                                                       entry.entry_value.sycl_implementation_type,
@@ -108,7 +110,9 @@ void performance_tracker::add_tracking_entry(const tracking_entry<cmd::parser_pr
                                                                       entry.entry_value.float_as_real_type,
                                                                       entry.entry_value.input_filename,
                                                                       entry.entry_value.model_filename,
-                                                                      entry.entry_value.predict_filename));
+                                                                      entry.entry_value.predict_filename,
+                                                                      entry.entry_value.chunk_size,
+                                                                      entry.entry_value.max_memory));
     }
 }
 
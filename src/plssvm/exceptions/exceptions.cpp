@@ -43,6 +43,9 @@ invalid_parameter_exception::invalid_parameter_exception(const std::string &msg,
 file_reader_exception::file_reader_exception(const std::string &msg, source_location loc) :
     exception{ msg, "file_reader_exception", loc } {}
 
+file_exception::file_exception(const std::string &msg, source_location loc) :
+    exception{ msg, "file_exception", loc } {}
+
 data_set_exception::data_set_exception(const std::string &msg, source_location loc) :
     exception{ msg, "data_set_exception", loc } {}
 
@@ -61,4 +64,7 @@ unsupported_kernel_type_exception::unsupported_kernel_type_exception(const std::
 gpu_device_ptr_exception::gpu_device_ptr_exception(const std::string &msg, source_location loc) :
     exception{ msg, "gpu_device_ptr_exception", loc } {}
 
+operation_cancelled_exception::operation_cancelled_exception(const std::string &msg, source_location loc) :
+    exception{ msg, "operation_cancelled_exception", loc } {}
+
 }  // namespace plssvm
\ No newline at end of file
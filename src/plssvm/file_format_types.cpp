@@ -8,12 +8,14 @@
 
 #include "plssvm/file_format_types.hpp"
 
-#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::to_lower_case
+#include "plssvm/detail/io/data_set_subset.hpp"  // plssvm::detail::io::format_feature_selection
+#include "plssvm/detail/string_utility.hpp"      // plssvm::detail::to_lower_case
+#include "plssvm/sampling_types.hpp"             // plssvm::sampling_type
 
-#include <ios>                               // std::ios::failbit
-#include <istream>                           // std::istream
-#include <ostream>                           // std::ostream
-#include <string>                            // std::string
+#include <ios>                                   // std::ios::failbit
+#include <istream>                               // std::istream
+#include <ostream>                               // std::ostream
+#include <string>                                // std::string
 
 namespace plssvm {
 
@@ -23,6 +25,12 @@ std::ostream &operator<<(std::ostream &out, const file_format_type format) {
             return out << "libsvm";
         case file_format_type::arff:
             return out << "arff";
+        case file_format_type::binary:
+            return out << "binary";
+        case file_format_type::csv:
+            return out << "csv";
+        case file_format_type::npy:
+            return out << "npy";
     }
     return out << "unknown";
 }
@@ -36,10 +44,24 @@ std::istream &operator>>(std::istream &in, file_format_type &format) {
         format = file_format_type::libsvm;
     } else if (str == "arff") {
         format = file_format_type::arff;
+    } else if (str == "binary") {
+        format = file_format_type::binary;
+    } else if (str == "csv") {
+        format = file_format_type::csv;
+    } else if (str == "npy") {
+        format = file_format_type::npy;
     } else {
         in.setstate(std::ios::failbit);
     }
     return in;
 }
 
+std::ostream &operator<<(std::ostream &out, const subset_options &subset) {
+    out << "features: " << (subset.features.empty() ? std::string{ "all" } : detail::io::format_feature_selection(subset.features)) << ", samples: ";
+    if (subset.num_samples == 0) {
+        return out << "all";
+    }
+    return out << subset.num_samples << " (" << subset.sampling << ')';
+}
+
 }  // namespace plssvm
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/landmark_selection_types.hpp"
+
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::to_lower_case
+
+#include <ios>                               // std::ios::failbit
+#include <istream>                           // std::istream
+#include <ostream>                           // std::ostream
+#include <string>                            // std::string
+
+namespace plssvm {
+
+std::ostream &operator<<(std::ostream &out, const landmark_selection_type selection) {
+    switch (selection) {
+        case landmark_selection_type::uniform:
+            return out << "uniform";
+        case landmark_selection_type::kmeans_pp:
+            return out << "kmeans++";
+        case landmark_selection_type::entropy:
+            return out << "entropy";
+    }
+    return out << "unknown";
+}
+
+std::istream &operator>>(std::istream &in, landmark_selection_type &selection) {
+    std::string str;
+    in >> str;
+    detail::to_lower_case(str);
+
+    if (str == "uniform") {
+        selection = landmark_selection_type::uniform;
+    } else if (str == "kmeans++" || str == "kmeans_pp") {
+        selection = landmark_selection_type::kmeans_pp;
+    } else if (str == "entropy") {
+        selection = landmark_selection_type::entropy;
+    } else {
+        in.setstate(std::ios::failbit);
+    }
+    return in;
+}
+
+}  // namespace plssvm
@@ -0,0 +1,45 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/sampling_types.hpp"
+
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::to_lower_case
+
+#include <ios>                               // std::ios::failbit
+#include <istream>                           // std::istream
+#include <ostream>                           // std::ostream
+#include <string>                            // std::string
+
+namespace plssvm {
+
+std::ostream &operator<<(std::ostream &out, const sampling_type sampling) {
+    switch (sampling) {
+        case sampling_type::uniform:
+            return out << "uniform";
+        case sampling_type::stratified:
+            return out << "stratified";
+    }
+    return out << "unknown";
+}
+
+std::istream &operator>>(std::istream &in, sampling_type &sampling) {
+    std::string str;
+    in >> str;
+    detail::to_lower_case(str);
+
+    if (str == "uniform") {
+        sampling = sampling_type::uniform;
+    } else if (str == "stratified") {
+        sampling = sampling_type::stratified;
+    } else {
+        in.setstate(std::ios::failbit);
+    }
+    return in;
+}
+
+}  // namespace plssvm
@@ -0,0 +1,45 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/solver_types.hpp"
+
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::to_lower_case
+
+#include <ios>                               // std::ios::failbit
+#include <istream>                           // std::istream
+#include <ostream>                           // std::ostream
+#include <string>                            // std::string
+
+namespace plssvm {
+
+std::ostream &operator<<(std::ostream &out, const solver_type solver) {
+    switch (solver) {
+        case solver_type::cg:
+            return out << "cg";
+        case solver_type::single_reduction_cg:
+            return out << "single_reduction_cg";
+    }
+    return out << "unknown";
+}
+
+std::istream &operator>>(std::istream &in, solver_type &solver) {
+    std::string str;
+    in >> str;
+    detail::to_lower_case(str);
+
+    if (str == "cg") {
+        solver = solver_type::cg;
+    } else if (str == "single_reduction_cg" || str == "chronopoulos_gear") {
+        solver = solver_type::single_reduction_cg;
+    } else {
+        in.setstate(std::ios::failbit);
+    }
+    return in;
+}
+
+}  // namespace plssvm
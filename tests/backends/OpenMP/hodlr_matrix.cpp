@@ -0,0 +1,150 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the HODLR approximation of the kernel matrix used in the OpenMP backend.
+ */
+
+#include "plssvm/backends/OpenMP/hodlr_matrix.hpp"
+
+#include "backends/OpenMP/mock_openmp_csvm.hpp"
+
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"  // plssvm::openmp::device_kernel_rbf
+#include "plssvm/detail/solve_options.hpp"        // plssvm::detail::solve_options
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                   // plssvm::detail::parameter, plssvm::hodlr_tolerance
+
+#include "../../naming.hpp"                       // naming::real_type_to_name
+#include "../../types_to_test.hpp"                // util::real_type_gtest
+#include "../../utility.hpp"                      // util::{redirect_output, generate_random_vector}
+#include "../compare.hpp"                         // compare::{generate_q, kernel_function}
+
+#include "gtest/gtest.h"                          // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_LE, EXPECT_LT, EXPECT_GT, EXPECT_NEAR, EXPECT_FALSE, ASSERT_TRUE, ::testing::Test
+
+#include <cmath>                                  // std::sqrt, std::abs
+#include <cstddef>                                // std::size_t
+#include <random>                                 // std::mt19937, std::uniform_real_distribution
+#include <type_traits>                            // std::is_same_v
+#include <vector>                                 // std::vector
+
+namespace {
+
+/**
+ * @brief Generate @p num_points reproducible random data points with @p num_features features in the range [-1, 1].
+ * @tparam real_type the type of the data
+ * @param[in] num_points the number of data points
+ * @param[in] num_features the number of features per data point
+ * @return the data points (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] std::vector<std::vector<real_type>> generate_data(const std::size_t num_points, const std::size_t num_features) {
+    std::mt19937 gen{ 42 };
+    std::uniform_real_distribution<real_type> dist{ -1.0, 1.0 };
+    std::vector<std::vector<real_type>> data(num_points, std::vector<real_type>(num_features));
+    for (std::vector<real_type> &point : data) {
+        for (real_type &feature : point) {
+            feature = dist(gen);
+        }
+    }
+    return data;
+}
+
+/**
+ * @brief Calculate the relative difference between @p approx and @p exact in the euclidean norm.
+ * @tparam real_type the type of the data
+ * @param[in] approx the approximated values
+ * @param[in] exact the exact values
+ * @return the relative difference (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] real_type relative_difference(const std::vector<real_type> &approx, const std::vector<real_type> &exact) {
+    real_type diff{ 0.0 };
+    real_type norm{ 0.0 };
+    for (std::size_t i = 0; i < exact.size(); ++i) {
+        diff += (approx[i] - exact[i]) * (approx[i] - exact[i]);
+        norm += exact[i] * exact[i];
+    }
+    return std::sqrt(diff / norm);
+}
+
+}  // namespace
+
+template <typename T>
+class OpenMPHODLRMatrix : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(OpenMPHODLRMatrix, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(OpenMPHODLRMatrix, multiply) {
+    using real_type = TypeParam;
+
+    // low-dimensional data points result in numerically low-rank off-diagonal blocks
+    const plssvm::detail::parameter<real_type> params{ plssvm::kernel_function_type::rbf, 2, 1.0, 0.0, 1.0 };
+    const std::vector<std::vector<real_type>> data = generate_data<real_type>(513, 2);
+    const real_type tolerance = std::is_same_v<real_type, float> ? real_type{ 1e-4 } : real_type{ 1e-8 };
+
+    // compress the kernel matrix
+    const plssvm::openmp::hodlr_matrix<real_type> hodlr{ params, data, tolerance, 64 };
+    ASSERT_TRUE(hodlr.is_compressed());
+    EXPECT_EQ(hodlr.num_rows(), data.size() - 1);
+    EXPECT_GT(hodlr.max_rank(), 0);
+    EXPECT_LT(hodlr.memory_ratio(), 1.0);
+
+    // compare the compressed matrix-vector multiplication to the dense one
+    const std::vector<real_type> q = compare::generate_q(params, data);
+    const real_type QA_cost = compare::kernel_function(params, data.back(), data.back()) + 1 / params.cost;
+    const std::vector<real_type> d = util::generate_random_vector<real_type>(data.size() - 1, real_type{ 1.0 }, real_type{ 2.0 });
+    for (const real_type add : { real_type{ -1.0 }, real_type{ 1.0 } }) {
+        const std::vector<real_type> ret = util::generate_random_vector<real_type>(data.size() - 1);
+        std::vector<real_type> dense{ ret };
+        plssvm::openmp::device_kernel_rbf(q, dense, d, data, QA_cost, 1 / params.cost, add, params.gamma.value());
+        std::vector<real_type> compressed{ ret };
+        hodlr.multiply(q, compressed, d, QA_cost, 1 / params.cost, add);
+
+        EXPECT_LE(relative_difference(compressed, dense), 100 * tolerance);
+    }
+}
+TYPED_TEST(OpenMPHODLRMatrix, single_leaf) {
+    using real_type = TypeParam;
+
+    // if all data points fit into a single leaf, there is nothing to compress
+    const plssvm::detail::parameter<real_type> params{ plssvm::kernel_function_type::rbf, 2, 1.0, 0.0, 1.0 };
+    const plssvm::openmp::hodlr_matrix<real_type> hodlr{ params, generate_data<real_type>(5, 2), real_type{ 1e-3 } };
+
+    EXPECT_FALSE(hodlr.is_compressed());
+    EXPECT_EQ(hodlr.num_rows(), 4);
+}
+TYPED_TEST(OpenMPHODLRMatrix, incompressible) {
+    using real_type = TypeParam;
+
+    // high-dimensional random data points can't be compressed to a very small tolerance
+    const plssvm::detail::parameter<real_type> params{ plssvm::kernel_function_type::rbf, 2, real_type{ 1.0 / 64.0 }, 0.0, 1.0 };
+    const plssvm::openmp::hodlr_matrix<real_type> hodlr{ params, generate_data<real_type>(33, 64), real_type{ 1e-10 }, 8 };
+
+    EXPECT_FALSE(hodlr.is_compressed());
+}
+
+TYPED_TEST(OpenMPHODLRMatrix, solve_system_of_linear_equations) {
+    using real_type = TypeParam;
+
+    // create data set with labels depending on the first feature
+    const plssvm::detail::parameter<real_type> params{ plssvm::kernel_function_type::rbf, 2, 1.0, 0.0, 1.0 };
+    const std::vector<std::vector<real_type>> data = generate_data<real_type>(513, 2);
+    std::vector<real_type> b(data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        b[i] = data[i][0] > real_type{ 0.0 } ? real_type{ 1.0 } : real_type{ -1.0 };
+    }
+    const real_type eps = std::is_same_v<real_type, float> ? real_type{ 1e-5 } : real_type{ 1e-10 };
+
+    // solve the system once using the dense and once using the compressed kernel matrix
+    const mock_openmp_csvm dense_svm{};
+    const auto [dense_alpha, dense_rho] = dense_svm.solve_system_of_linear_equations(params, data, b, eps, data.size(), plssvm::detail::solve_options<real_type>{});
+    const mock_openmp_csvm compressed_svm{ plssvm::hodlr_tolerance = static_cast<double>(eps) };
+    const auto [compressed_alpha, compressed_rho] = compressed_svm.solve_system_of_linear_equations(params, data, b, eps, data.size(), plssvm::detail::solve_options<real_type>{});
+
+    // the solutions must be (nearly) the same
+    const real_type expected_precision = std::is_same_v<real_type, float> ? real_type{ 1e-2 } : real_type{ 1e-6 };
+    EXPECT_LE(relative_difference(compressed_alpha, dense_alpha), expected_precision);
+    EXPECT_NEAR(compressed_rho, dense_rho, expected_precision * std::abs(dense_rho) + expected_precision);
+}
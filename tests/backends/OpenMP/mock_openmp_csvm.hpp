@@ -33,6 +33,7 @@ class mock_openmp_csvm final : public plssvm::openmp::csvm {
     using base_type::predict_values;
     using base_type::run_device_kernel;
     using base_type::solve_system_of_linear_equations;
+    using base_type::solve_system_of_linear_equations_cost_path;
 };
 
 #endif  // PLSSVM_TESTS_BACKENDS_OPENMP_MOCK_OPENMP_CSVM_HPP_
\ No newline at end of file
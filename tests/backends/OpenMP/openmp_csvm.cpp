@@ -15,20 +15,24 @@
 #include "plssvm/backends/OpenMP/exceptions.hpp"   // plssvm::openmp::backend_exception
 #include "plssvm/data_set.hpp"                     // plssvm::data_set
 #include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_parameter_exception
+#include "plssvm/grid_search.hpp"                  // plssvm::grid_search, plssvm::grid_search_result
 #include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
-#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::detail::parameter, plssvm::kernel_type, plssvm::cost
+#include "plssvm/model.hpp"                        // plssvm::model
+#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::detail::parameter, plssvm::kernel_type, plssvm::gamma, plssvm::cost, plssvm::epsilon, plssvm::hodlr_tolerance, plssvm::rbf_cutoff
 #include "plssvm/target_platforms.hpp"             // plssvm::target_platform
 
-#include "../../custom_test_macros.hpp"            // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_VECTOR_NEAR
+#include "../../custom_test_macros.hpp"            // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_FLOATING_POINT_NEAR_EPS, EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS
 #include "../../naming.hpp"                        // naming::{real_type_kernel_function_to_name, real_type_to_name}
 #include "../../types_to_test.hpp"                 // util::{real_type_kernel_function_gtest, real_type_gtest}
 #include "../../utility.hpp"                       // util::{redirect_output, generate_random_vector}
 #include "../compare.hpp"                          // compare::{generate_q, calculate_w, kernel_function, device_kernel_function}
 #include "../generic_csvm_tests.hpp"               // generic::{test_solve_system_of_linear_equations, test_predict_values, test_predict, test_score}
 
-#include "gtest/gtest.h"                           // TEST_F, EXPECT_NO_THROW, TYPED_TEST_SUITE, TYPED_TEST, ::testing::Test
+#include "fmt/format.h"                            // fmt::format
+#include "gtest/gtest.h"                           // TEST_F, EXPECT_NO_THROW, EXPECT_EQ, ASSERT_EQ, TYPED_TEST_SUITE, TYPED_TEST, ::testing::Test
 
-#include <tuple>                                   // std::make_tuple
+#include <tuple>                                   // std::make_tuple, std::ignore
 #include <vector>                                  // std::vector
 
 class OpenMPCSVM : public ::testing::Test, private util::redirect_output<> {};
@@ -98,6 +102,85 @@ TEST_F(OpenMPCSVM, construct_target_and_named_args) {
                       "Invalid target platform 'gpu_intel' for the OpenMP backend!");
 }
 
+TEST_F(OpenMPCSVM, construct_hodlr_tolerance) {
+#if defined(PLSSVM_HAS_CPU_TARGET)
+    // the dense kernel matrix is used per default
+    EXPECT_EQ(plssvm::openmp::csvm{}.get_hodlr_tolerance(), 0.0);
+    EXPECT_EQ((plssvm::openmp::csvm{ plssvm::target_platform::cpu, plssvm::parameter{} }.get_hodlr_tolerance()), 0.0);
+    // the HODLR tolerance can be combined with all other named parameters
+    EXPECT_EQ((plssvm::openmp::csvm{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::hodlr_tolerance = 1e-6 }.get_hodlr_tolerance()), 1e-6);
+    EXPECT_EQ((plssvm::openmp::csvm{ plssvm::target_platform::cpu, plssvm::parameter{}, plssvm::hodlr_tolerance = 1e-3 }.get_hodlr_tolerance()), 1e-3);
+    // a negative tolerance is illegal
+    EXPECT_THROW_WHAT((plssvm::openmp::csvm{ plssvm::hodlr_tolerance = -1.0 }),
+                      plssvm::invalid_parameter_exception,
+                      "hodlr_tolerance must be greater or equal than 0.0, but is -1!");
+#else
+    GTEST_SKIP() << "The cpu target platform is not available!";
+#endif
+}
+
+TEST_F(OpenMPCSVM, construct_rbf_cutoff) {
+#if defined(PLSSVM_HAS_CPU_TARGET)
+    // the dense kernel matrix is used per default
+    EXPECT_EQ(plssvm::openmp::csvm{}.get_rbf_cutoff(), 0.0);
+    // the rbf cutoff can be combined with all other named parameters
+    EXPECT_EQ((plssvm::openmp::csvm{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::rbf_cutoff = 1e-8 }.get_rbf_cutoff()), 1e-8);
+    EXPECT_EQ((plssvm::openmp::csvm{ plssvm::target_platform::cpu, plssvm::parameter{}, plssvm::rbf_cutoff = 1e-3 }.get_rbf_cutoff()), 1e-3);
+    // the rbf cutoff must be a valid kernel value
+    EXPECT_THROW_WHAT((plssvm::openmp::csvm{ plssvm::rbf_cutoff = -1.0 }),
+                      plssvm::invalid_parameter_exception,
+                      "rbf_cutoff must be in the range [0.0, 1.0), but is -1!");
+    EXPECT_THROW_WHAT((plssvm::openmp::csvm{ plssvm::rbf_cutoff = 1.0 }),
+                      plssvm::invalid_parameter_exception,
+                      "rbf_cutoff must be in the range [0.0, 1.0), but is 1!");
+    // the rbf cutoff can't be combined with the HODLR approximation
+    EXPECT_THROW_WHAT((plssvm::openmp::csvm{ plssvm::hodlr_tolerance = 1e-6, plssvm::rbf_cutoff = 1e-8 }),
+                      plssvm::invalid_parameter_exception,
+                      "Can't use the HODLR approximation (hodlr_tolerance) and the rbf truncation (rbf_cutoff) at the same time!");
+#else
+    GTEST_SKIP() << "The cpu target platform is not available!";
+#endif
+}
+
+TEST_F(OpenMPCSVM, cost_path_kernel_matrix_approximation) {
+#if defined(PLSSVM_HAS_CPU_TARGET)
+    // create the data that should be used
+    const plssvm::data_set<double> data{ PLSSVM_TEST_FILE };
+    const std::vector<double> cost_values{ 0.1, 1.0 };
+
+    // the cost path always uses the dense kernel matrix
+    const plssvm::openmp::csvm hodlr_svm{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::hodlr_tolerance = 1e-6 };
+    EXPECT_THROW_WHAT(std::ignore = hodlr_svm.fit(data, cost_values),
+                      plssvm::invalid_parameter_exception,
+                      "The cost path can't be combined with the HODLR approximation (hodlr_tolerance) or the rbf truncation (rbf_cutoff)!");
+    const plssvm::openmp::csvm truncated_svm{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::rbf_cutoff = 1e-8 };
+    EXPECT_THROW_WHAT(std::ignore = truncated_svm.fit(data, cost_values),
+                      plssvm::invalid_parameter_exception,
+                      "The cost path can't be combined with the HODLR approximation (hodlr_tolerance) or the rbf truncation (rbf_cutoff)!");
+#else
+    GTEST_SKIP() << "The cpu target platform is not available!";
+#endif
+}
+
+TEST_F(OpenMPCSVM, grid_search_parity) {
+#if defined(PLSSVM_HAS_CPU_TARGET)
+    // create the data that should be used
+    const plssvm::data_set<double> data{ PLSSVM_TEST_FILE };
+    const plssvm::parameter params{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::gamma = 0.01, plssvm::cost = 2.0 };
+
+    // a grid search with a single grid point must yield the same model as fitting it directly
+    const plssvm::grid_search_result<double, int> result = plssvm::grid_search{ params }.fit(data, plssvm::epsilon = 1e-10);
+    const plssvm::model<double, int> correct_model = plssvm::openmp::csvm{ params }.fit(data, plssvm::epsilon = 1e-10);
+
+    ASSERT_EQ(result.ranking().size(), 1);
+    EXPECT_EQ(result.best_model().get_params(), correct_model.get_params());
+    EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(result.best_model().weights(), correct_model.weights(), 1e6);
+    EXPECT_FLOATING_POINT_NEAR_EPS(result.best_model().rho(), correct_model.rho(), 1e6);
+#else
+    GTEST_SKIP() << "The cpu target platform is not available!";
+#endif
+}
+
 template <typename T, plssvm::kernel_function_type kernel>
 struct csvm_test_type {
     using mock_csvm_type = mock_openmp_csvm;
@@ -212,4 +295,4 @@ TYPED_TEST(OpenMPCSVMRunDeviceKernel, run_device_kernel) {
         // check the calculated result for correctness
         EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, ground_truth);
     }
-}
\ No newline at end of file
+}
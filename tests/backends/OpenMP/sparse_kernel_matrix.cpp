@@ -0,0 +1,149 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the truncated rbf kernel matrix used in the OpenMP backend.
+ */
+
+#include "plssvm/backends/OpenMP/sparse_kernel_matrix.hpp"
+
+#include "backends/OpenMP/mock_openmp_csvm.hpp"
+
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"  // plssvm::openmp::device_kernel_rbf
+#include "plssvm/detail/solve_options.hpp"        // plssvm::detail::solve_options
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                   // plssvm::detail::parameter, plssvm::rbf_cutoff
+
+#include "../../naming.hpp"                       // naming::real_type_to_name
+#include "../../types_to_test.hpp"                // util::real_type_gtest
+#include "../../utility.hpp"                      // util::{redirect_output, generate_random_vector}
+#include "../compare.hpp"                         // compare::{generate_q, kernel_function}
+
+#include "gtest/gtest.h"                          // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_LE, EXPECT_LT, EXPECT_GT, EXPECT_NEAR, EXPECT_FLOAT_EQ, ::testing::Test
+
+#include <algorithm>                              // std::max
+#include <cmath>                                  // std::abs
+#include <cstddef>                                // std::size_t
+#include <numeric>                                // std::accumulate
+#include <random>                                 // std::mt19937, std::uniform_real_distribution
+#include <type_traits>                            // std::is_same_v
+#include <vector>                                 // std::vector
+
+namespace {
+
+/**
+ * @brief Generate @p num_points reproducible random data points with two features clustered around the four corners of the square [-5, 5]^2.
+ * @tparam real_type the type of the data
+ * @param[in] num_points the number of data points
+ * @return the data points (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] std::vector<std::vector<real_type>> generate_clustered_data(const std::size_t num_points) {
+    std::mt19937 gen{ 42 };
+    std::uniform_real_distribution<real_type> dist{ -0.5, 0.5 };
+    std::vector<std::vector<real_type>> data(num_points, std::vector<real_type>(2));
+    for (std::size_t i = 0; i < num_points; ++i) {
+        data[i][0] = (i % 2 == 0 ? real_type{ -5.0 } : real_type{ 5.0 }) + dist(gen);
+        data[i][1] = (i % 4 < 2 ? real_type{ -5.0 } : real_type{ 5.0 }) + dist(gen);
+    }
+    return data;
+}
+
+/**
+ * @brief Calculate the largest absolute difference between @p approx and @p exact.
+ * @tparam real_type the type of the data
+ * @param[in] approx the approximated values
+ * @param[in] exact the exact values
+ * @return the maximum difference (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] real_type max_difference(const std::vector<real_type> &approx, const std::vector<real_type> &exact) {
+    real_type diff{ 0.0 };
+    for (std::size_t i = 0; i < exact.size(); ++i) {
+        diff = std::max(diff, std::abs(approx[i] - exact[i]));
+    }
+    return diff;
+}
+
+}  // namespace
+
+template <typename T>
+class OpenMPSparseKernelMatrix : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(OpenMPSparseKernelMatrix, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(OpenMPSparseKernelMatrix, multiply) {
+    using real_type = TypeParam;
+
+    // four well separated clusters: the kernel matrix entries between different clusters vanish
+    const plssvm::detail::parameter<real_type> params{ plssvm::kernel_function_type::rbf, 2, 1.0, 0.0, 1.0 };
+    const std::vector<std::vector<real_type>> data = generate_clustered_data<real_type>(513);
+    const real_type cutoff{ 1e-6 };
+
+    // truncate the kernel matrix
+    const plssvm::openmp::sparse_kernel_matrix<real_type> truncated{ params, data, cutoff, 32 };
+    EXPECT_EQ(truncated.num_rows(), data.size() - 1);
+    EXPECT_EQ(truncated.num_tiles(), 16);
+    EXPECT_EQ(truncated.dropped_mass().size(), truncated.num_tiles());
+    EXPECT_LT(truncated.num_blocks(), truncated.num_tiles() * truncated.num_tiles());
+    EXPECT_LE(truncated.density(), 0.5);
+    EXPECT_GT(truncated.max_dropped_row_mass(), real_type{ 0.0 });
+    EXPECT_LE(truncated.max_dropped_row_mass(), static_cast<real_type>(data.size() - 1) * cutoff);
+
+    // compare the truncated matrix-vector multiplication to the dense one
+    const std::vector<real_type> q = compare::generate_q(params, data);
+    const real_type QA_cost = compare::kernel_function(params, data.back(), data.back()) + 1 / params.cost;
+    const std::vector<real_type> d = util::generate_random_vector<real_type>(data.size() - 1, real_type{ 1.0 }, real_type{ 2.0 });
+    for (const real_type add : { real_type{ -1.0 }, real_type{ 1.0 } }) {
+        const std::vector<real_type> ret = util::generate_random_vector<real_type>(data.size() - 1);
+        std::vector<real_type> dense{ ret };
+        plssvm::openmp::device_kernel_rbf(q, dense, d, data, QA_cost, 1 / params.cost, add, params.gamma.value());
+        std::vector<real_type> sparse{ ret };
+        truncated.multiply(q, sparse, d, QA_cost, 1 / params.cost, add);
+
+        // the error of each row is bounded by the dropped mass times the largest value in d (plus rounding errors)
+        const real_type rounding = (std::is_same_v<real_type, float> ? real_type{ 1e-5 } : real_type{ 1e-12 }) * max_difference(dense, std::vector<real_type>(dense.size(), real_type{ 0.0 }));
+        EXPECT_LE(max_difference(sparse, dense), real_type{ 2.0 } * truncated.max_dropped_row_mass() + rounding);
+    }
+}
+TYPED_TEST(OpenMPSparseKernelMatrix, no_truncation) {
+    using real_type = TypeParam;
+
+    // with a small gamma no tile pair can be dropped
+    const plssvm::detail::parameter<real_type> params{ plssvm::kernel_function_type::rbf, 2, real_type{ 1e-6 }, 0.0, 1.0 };
+    const std::vector<std::vector<real_type>> data = generate_clustered_data<real_type>(129);
+    const plssvm::openmp::sparse_kernel_matrix<real_type> truncated{ params, data, real_type{ 1e-3 }, 16 };
+
+    EXPECT_EQ(truncated.num_blocks(), truncated.num_tiles() * truncated.num_tiles());
+    EXPECT_FLOAT_EQ(truncated.density(), 1.0);
+    EXPECT_EQ(std::accumulate(truncated.dropped_mass().cbegin(), truncated.dropped_mass().cend(), real_type{ 0.0 }), real_type{ 0.0 });
+}
+
+TYPED_TEST(OpenMPSparseKernelMatrix, solve_system_of_linear_equations) {
+    using real_type = TypeParam;
+
+    // create data set with labels depending on the first feature
+    const plssvm::detail::parameter<real_type> params{ plssvm::kernel_function_type::rbf, 2, 1.0, 0.0, 1.0 };
+    const std::vector<std::vector<real_type>> data = generate_clustered_data<real_type>(513);
+    std::vector<real_type> b(data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        b[i] = data[i][0] > real_type{ 0.0 } ? real_type{ 1.0 } : real_type{ -1.0 };
+    }
+    const real_type eps = std::is_same_v<real_type, float> ? real_type{ 1e-5 } : real_type{ 1e-10 };
+
+    // solve the system once using the dense and once using the truncated kernel matrix
+    const mock_openmp_csvm dense_svm{};
+    const auto [dense_alpha, dense_rho] = dense_svm.solve_system_of_linear_equations(params, data, b, eps, data.size(), plssvm::detail::solve_options<real_type>{});
+    const mock_openmp_csvm truncated_svm{ plssvm::rbf_cutoff = 1e-12 };
+    const auto [truncated_alpha, truncated_rho] = truncated_svm.solve_system_of_linear_equations(params, data, b, eps, data.size(), plssvm::detail::solve_options<real_type>{});
+
+    // the solutions must be (nearly) the same
+    const real_type expected_precision = std::is_same_v<real_type, float> ? real_type{ 1e-2 } : real_type{ 1e-6 };
+    ASSERT_EQ(truncated_alpha.size(), dense_alpha.size());
+    for (std::size_t i = 0; i < dense_alpha.size(); ++i) {
+        EXPECT_NEAR(truncated_alpha[i], dense_alpha[i], expected_precision * std::abs(dense_alpha[i]) + expected_precision);
+    }
+    EXPECT_NEAR(truncated_rho, dense_rho, expected_precision * std::abs(dense_rho) + expected_precision);
+}
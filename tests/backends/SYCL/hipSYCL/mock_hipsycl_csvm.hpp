@@ -38,6 +38,7 @@ class mock_hipsycl_csvm final : public plssvm::hipsycl::csvm {
     using base_type::select_num_used_devices;
     using base_type::setup_data_on_device;
     using base_type::solve_system_of_linear_equations;
+    using base_type::solve_system_of_linear_equations_cost_path;
 
     using base_type::devices_;
 };
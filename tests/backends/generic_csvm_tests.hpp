@@ -13,31 +13,41 @@
 #define PLSSVM_TESTS_BACKENDS_GENERIC_TESTS_HPP_
 #pragma once
 
-#include "plssvm/constants.hpp"              // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE;
-#include "plssvm/data_set.hpp"               // plssvm::data_set
-#include "plssvm/detail/layout.hpp"          // plssvm::detail::{layout_type, transform_to_layout}
-#include "plssvm/detail/operators.hpp"       // operators namespace
-#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
-#include "plssvm/model.hpp"                  // plssvm::model
-#include "plssvm/parameter.hpp"              // plssvm::cost, plssvm::kernel_type, plssvm::parameter, plssvm::detail::parameter
-
-#include "../custom_test_macros.hpp"         // EXPECT_FLOATING_POINT_NEAR, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_FLOATING_POINT_VECTOR_EQ
-#include "../utility.hpp"                    // util::{redirect_output, generate_random_vector, construct_from_tuple}
-#include "compare.hpp"                       // compare::{generate_q, calculate_w, kernel_function, device_kernel_function}
-
-#include "fmt/format.h"                      // fmt::format
-#include "fmt/ostream.h"                     // can use fmt using operator<< overloads
-#include "gmock/gmock.h"                     // ::testing::HasSubstr
-#include "gtest/gtest.h"                     // ASSERT_EQ, EXPECT_EQ, EXPECT_NE, EXPECT_TRUE, TYPED_TEST_SUITE_P, TYPED_TEST_P, REGISTER_TYPED_TEST_SUITE_P,
-                                             // ::testing::Test
-
-#include <cmath>                             // std::sqrt, std::abs
-#include <cstddef>                           // std::size_t
-#include <fstream>                           // std::ifstream
-#include <iterator>                          // std::istream_iterator
-#include <limits>                            // std::numeric_limits::epsilon
-#include <tuple>                             // std::ignore
-#include <vector>                            // std::vector
+#include "plssvm/async_handle.hpp"                  // plssvm::async_handle
+#include "plssvm/cancellation_token.hpp"            // plssvm::cancellation_token
+#include "plssvm/constants.hpp"                     // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE;
+#include "plssvm/data_set.hpp"                      // plssvm::data_set
+#include "plssvm/detail/io/checkpoint_parsing.hpp"  // plssvm::detail::io::parse_checkpoint
+#include "plssvm/detail/io/file_reader.hpp"         // plssvm::detail::io::file_reader
+#include "plssvm/detail/layout.hpp"                 // plssvm::detail::{layout_type, transform_to_layout}
+#include "plssvm/detail/operators.hpp"              // operators namespace
+#include "plssvm/detail/solve_options.hpp"          // plssvm::detail::solve_options
+#include "plssvm/kernel_function_types.hpp"         // plssvm::kernel_function_type
+#include "plssvm/model.hpp"                         // plssvm::model
+#include "plssvm/parameter.hpp"                     // plssvm::cost, plssvm::kernel_type, plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/solver_progress.hpp"               // plssvm::solver_progress
+#include "plssvm/solver_state.hpp"                  // plssvm::solver_state
+#include "plssvm/solver_types.hpp"                  // plssvm::solver_type
+
+#include "../custom_test_macros.hpp"                // EXPECT_FLOATING_POINT_NEAR, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_FLOATING_POINT_2D_VECTOR_EQ
+#include "../utility.hpp"                           // util::{redirect_output, generate_random_vector, construct_from_tuple, temporary_file}
+#include "compare.hpp"                              // compare::{generate_q, calculate_w, kernel_function, device_kernel_function}
+
+#include "fmt/format.h"                             // fmt::format
+#include "fmt/ostream.h"                            // can use fmt using operator<< overloads
+#include "gmock/gmock.h"                            // ::testing::HasSubstr
+#include "gtest/gtest.h"                            // ASSERT_EQ, EXPECT_EQ, EXPECT_NE, EXPECT_NEAR, EXPECT_TRUE, TYPED_TEST_SUITE_P, TYPED_TEST_P, REGISTER_TYPED_TEST_SUITE_P,
+                                                // ::testing::Test
+
+#include <algorithm>                            // std::min, std::find
+#include <cmath>                                // std::sqrt, std::abs
+#include <cstddef>                              // std::size_t
+#include <fstream>                              // std::ifstream
+#include <iterator>                             // std::istream_iterator
+#include <limits>                               // std::numeric_limits::epsilon
+#include <tuple>                                // std::ignore
+#include <type_traits>                          // std::is_same_v
+#include <vector>                               // std::vector
 
 //*************************************************************************************************************************************//
 //                                                                 CSVM                                                                //
@@ -128,7 +138,7 @@ TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_trivial) {
     // | Q  1 |  *  | a |  =  | y |
     // | 1  0 |     | b |     | 0 |
     // with Q = A^TA
-    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size());
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), plssvm::detail::solve_options<real_type>{});
 
     // check the calculated result for correctness
     EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated_x, rhs);
@@ -146,6 +156,364 @@ TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_with_correction) {
     // TODO: test for the correction scheme after 50 iterations
 }
 
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_cost_path) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 2;
+        params.gamma = 0.5;
+        params.coef0 = 1.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        params.gamma = 0.5;
+    }
+
+    // create the data that should be used
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ 0.1 }, real_type{ 0.5 }, real_type{ -0.3 } },
+        { real_type{ 1.2 }, real_type{ -0.4 }, real_type{ 0.8 } },
+        { real_type{ -0.7 }, real_type{ 0.9 }, real_type{ 0.2 } },
+        { real_type{ 0.3 }, real_type{ 0.3 }, real_type{ -1.1 } },
+        { real_type{ -1.0 }, real_type{ -0.6 }, real_type{ 0.5 } },
+        { real_type{ 0.8 }, real_type{ 1.1 }, real_type{ -0.2 } }
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 }, real_type{ -1.0 }, real_type{ 1.0 } };
+    const std::vector<real_type> cost_values{ real_type{ 0.5 }, real_type{ 10.0 }, real_type{ 2.0 } };
+    const real_type tolerance = std::is_same_v<real_type, float> ? real_type{ 1e-3 } : real_type{ 1e-8 };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_cost_path is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the systems of linear equations for all cost values at once
+    const auto solutions = svm.solve_system_of_linear_equations_cost_path(params, A, rhs, cost_values, real_type{ 1e-10 }, 100);
+    ASSERT_EQ(solutions.size(), cost_values.size());
+
+    // the results must match the solutions of the single systems of linear equations
+    for (std::size_t i = 0; i < cost_values.size(); ++i) {
+        params.cost = cost_values[i];
+        const auto &[correct_x, correct_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 1e-10 }, 100, plssvm::detail::solve_options<real_type>{});
+
+        const auto &[calculated_x, calculated_rho] = solutions[i];
+        ASSERT_EQ(calculated_x.size(), correct_x.size());
+        for (std::size_t j = 0; j < correct_x.size(); ++j) {
+            EXPECT_NEAR(calculated_x[j], correct_x[j], tolerance) << fmt::format("cost: {}, index: {}", cost_values[i], j);
+        }
+        EXPECT_NEAR(calculated_rho, correct_rho, tolerance) << fmt::format("cost: {}", cost_values[i]);
+    }
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_single_reduction) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 2;
+        params.gamma = 0.5;
+        params.coef0 = 1.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        params.gamma = 0.5;
+    }
+
+    // create the data that should be used
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ 0.1 }, real_type{ 0.5 }, real_type{ -0.3 } },
+        { real_type{ 1.2 }, real_type{ -0.4 }, real_type{ 0.8 } },
+        { real_type{ -0.7 }, real_type{ 0.9 }, real_type{ 0.2 } },
+        { real_type{ 0.3 }, real_type{ 0.3 }, real_type{ -1.1 } },
+        { real_type{ -1.0 }, real_type{ -0.6 }, real_type{ 0.5 } },
+        { real_type{ 0.8 }, real_type{ 1.1 }, real_type{ -0.2 } }
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 }, real_type{ -1.0 }, real_type{ 1.0 } };
+    const real_type tolerance = std::is_same_v<real_type, float> ? real_type{ 1e-3 } : real_type{ 1e-8 };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // the single reduction CG variant must converge to the same solution as the classic CG algorithm
+    const auto &[correct_x, correct_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 1e-10 }, 100, plssvm::detail::solve_options<real_type>{});
+    plssvm::detail::solve_options<real_type> options{};
+    options.solver = plssvm::solver_type::single_reduction_cg;
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 1e-10 }, 100, options);
+
+    ASSERT_EQ(calculated_x.size(), correct_x.size());
+    for (std::size_t i = 0; i < correct_x.size(); ++i) {
+        EXPECT_NEAR(calculated_x[i], correct_x[i], tolerance) << fmt::format("index: {}", i);
+    }
+    EXPECT_NEAR(calculated_rho, correct_rho, tolerance);
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_warm_start) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 2;
+        params.gamma = 0.5;
+        params.coef0 = 1.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        params.gamma = 0.5;
+    }
+
+    // create the data that should be used
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ 0.1 }, real_type{ 0.5 }, real_type{ -0.3 } },
+        { real_type{ 1.2 }, real_type{ -0.4 }, real_type{ 0.8 } },
+        { real_type{ -0.7 }, real_type{ 0.9 }, real_type{ 0.2 } },
+        { real_type{ 0.3 }, real_type{ 0.3 }, real_type{ -1.1 } },
+        { real_type{ -1.0 }, real_type{ -0.6 }, real_type{ 0.5 } },
+        { real_type{ 0.8 }, real_type{ 1.1 }, real_type{ -0.2 } }
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 }, real_type{ -1.0 }, real_type{ 1.0 } };
+    const real_type tolerance = std::is_same_v<real_type, float> ? real_type{ 1e-3 } : real_type{ 1e-8 };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // a warm started CG must converge to the same solution as a cold started CG
+    const auto &[correct_x, correct_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 1e-10 }, 100, plssvm::detail::solve_options<real_type>{});
+    plssvm::detail::solve_options<real_type> options{};
+    options.initial_guess = std::vector<real_type>(A.size() - 1, real_type{ 0.0 });
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 1e-10 }, 100, options);
+
+    ASSERT_EQ(calculated_x.size(), correct_x.size());
+    for (std::size_t i = 0; i < correct_x.size(); ++i) {
+        EXPECT_NEAR(calculated_x[i], correct_x[i], tolerance) << fmt::format("index: {}", i);
+    }
+    EXPECT_NEAR(calculated_rho, correct_rho, tolerance);
+}
+
+TYPED_TEST_P(GenericCSVM, fit_cascade) {
+    using csvm_type = typename TypeParam::csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ plssvm::kernel_type = kernel };
+
+    // create data set to be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+
+    // create C-SVM
+    const csvm_type svm = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments);
+
+    // train the exact model and the model using the cascade training
+    const plssvm::model<real_type> exact_model = svm.fit(data, plssvm::epsilon = 1e-6);
+    const plssvm::model<real_type> cascade_model = svm.fit(data, plssvm::epsilon = 1e-6, plssvm::num_partitions = 4);
+
+    // all data points are support vectors
+    ASSERT_EQ(cascade_model.num_support_vectors(), data.num_data_points());
+    ASSERT_EQ(cascade_model.weights().size(), data.num_data_points());
+
+    // the merged sub-models must nearly be as accurate as the exact model on the training data
+    EXPECT_GE(svm.score(cascade_model), svm.score(exact_model) - real_type{ 0.1 });
+}
+
+TYPED_TEST_P(GenericCSVM, fit_recycle) {
+    using csvm_type = typename TypeParam::csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ plssvm::kernel_type = kernel };
+
+    // create data set to be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+
+    // create C-SVM
+    const csvm_type svm = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments);
+
+    // the first fit fills the solver state, the second one is deflated using the recycled deflation vectors
+    // (a tight epsilon is necessary to compare the solutions, but the deflated CG using floats can't reach it)
+    const double epsilon = std::is_same_v<real_type, float> ? 1e-6 : 1e-10;
+    plssvm::solver_state<real_type> state{ 4 };
+    const plssvm::model<real_type> exact_model = svm.fit(data, plssvm::epsilon = epsilon, plssvm::recycle = &state);
+    const unsigned long long first_num_iterations = state.last_num_iterations();
+    // at most one deflation vector per CG iteration can be calculated and (numerically) linearly dependent search directions are dropped
+    EXPECT_GT(state.num_vectors(), 0);
+    EXPECT_LE(state.num_vectors(), std::min<unsigned long long>(4, first_num_iterations));
+    EXPECT_EQ(state.num_rows(), data.num_data_points() - 1);
+    const plssvm::model<real_type> recycled_model = svm.fit(data, plssvm::epsilon = epsilon, plssvm::recycle = &state);
+
+    // the deflated CG must not need more iterations and must converge to the same solution
+    EXPECT_LE(state.last_num_iterations(), first_num_iterations);
+    const real_type tolerance = std::is_same_v<real_type, float> ? real_type{ 1e-2 } : real_type{ 1e-4 };
+    ASSERT_EQ(recycled_model.weights().size(), exact_model.weights().size());
+    for (std::size_t i = 0; i < exact_model.weights().size(); ++i) {
+        EXPECT_NEAR(recycled_model.weights()[i], exact_model.weights()[i], tolerance) << fmt::format("index: {}", i);
+    }
+    EXPECT_NEAR(recycled_model.rho(), exact_model.rho(), tolerance);
+}
+TYPED_TEST_P(GenericCSVM, fit_incremental) {
+    using csvm_type = typename TypeParam::csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ plssvm::kernel_type = kernel };
+
+    // create data set to be used and split it into the old and the new data points
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+    const std::size_t num_old_data_points = 400;
+    const std::vector<std::vector<real_type>> &points = data.data();
+    const std::vector<int> &labels = data.labels().value().get();
+    const plssvm::data_set<real_type> old_data{ std::vector<std::vector<real_type>>(points.cbegin(), points.cbegin() + num_old_data_points),
+                                                std::vector<int>(labels.cbegin(), labels.cbegin() + num_old_data_points) };
+    const plssvm::data_set<real_type> new_data{ std::vector<std::vector<real_type>>(points.cbegin() + num_old_data_points, points.cend()),
+                                                std::vector<int>(labels.cbegin() + num_old_data_points, labels.cend()) };
+
+    // create C-SVM
+    const csvm_type svm = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments);
+
+    // add the new data points to the model learned on the old data points
+    const plssvm::model<real_type> old_model = svm.fit(old_data, plssvm::epsilon = 1e-10);
+    unsigned long long incremental_num_iterations = 0;
+    const plssvm::model<real_type> incremental_model = svm.fit_incremental(old_model, new_data, plssvm::epsilon = 1e-10, plssvm::progress_callback = [&](const plssvm::solver_progress &p) { incremental_num_iterations = p.iteration; });
+
+    // learn a model from scratch using the same data point order
+    std::vector<std::vector<real_type>> all_points(points.cbegin(), points.cbegin() + num_old_data_points - 1);
+    all_points.insert(all_points.end(), points.cbegin() + num_old_data_points, points.cend());
+    all_points.push_back(points[num_old_data_points - 1]);
+    std::vector<int> all_labels(labels.cbegin(), labels.cbegin() + num_old_data_points - 1);
+    all_labels.insert(all_labels.end(), labels.cbegin() + num_old_data_points, labels.cend());
+    all_labels.push_back(labels[num_old_data_points - 1]);
+    const plssvm::data_set<real_type> all_data{ std::move(all_points), std::move(all_labels) };
+    unsigned long long exact_num_iterations = 0;
+    const plssvm::model<real_type> exact_model = svm.fit(all_data, plssvm::epsilon = 1e-10, plssvm::progress_callback = [&](const plssvm::solver_progress &p) { exact_num_iterations = p.iteration; });
+
+    // the warm started CG must not need more iterations and must converge to the same solution
+    EXPECT_LE(incremental_num_iterations, exact_num_iterations);
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(incremental_model.support_vectors(), exact_model.support_vectors());
+    const real_type tolerance = std::is_same_v<real_type, float> ? real_type{ 5e-2 } : real_type{ 1e-4 };
+    ASSERT_EQ(incremental_model.weights().size(), exact_model.weights().size());
+    for (std::size_t i = 0; i < exact_model.weights().size(); ++i) {
+        EXPECT_NEAR(incremental_model.weights()[i], exact_model.weights()[i], tolerance) << fmt::format("index: {}", i);
+    }
+    EXPECT_NEAR(incremental_model.rho(), exact_model.rho(), tolerance);
+}
+TYPED_TEST_P(GenericCSVM, fit_sparse) {
+    using csvm_type = typename TypeParam::csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ plssvm::kernel_type = kernel };
+
+    // create data set to be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+
+    // create C-SVM
+    const csvm_type svm = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments);
+
+    // prune the data points until the target number of support vectors is reached
+    const plssvm::model<real_type> sparse_model = svm.fit_sparse(data, 100, plssvm::prune_fraction = 0.2);
+    ASSERT_EQ(sparse_model.num_support_vectors(), 100);
+    ASSERT_EQ(sparse_model.weights().size(), 100);
+    for (std::size_t i = 0; i < sparse_model.num_support_vectors(); ++i) {
+        // each support vector must be one of the training data points
+        const auto pos = std::find(data.data().cbegin(), data.data().cend(), sparse_model.support_vectors()[i]);
+        ASSERT_NE(pos, data.data().cend()) << fmt::format("index: {}", i);
+        EXPECT_EQ(sparse_model.labels()[i], data.labels()->get()[static_cast<std::size_t>(pos - data.data().cbegin())]);
+    }
+
+    // the accuracy on the training data must not drop compared to the full model
+    const plssvm::model<real_type> full_model = svm.fit(data);
+    const plssvm::model<real_type> accurate_model = svm.fit_sparse(data, 100, plssvm::prune_fraction = 0.2, plssvm::max_accuracy_drop = 0.0);
+    EXPECT_GE(accurate_model.num_support_vectors(), 100);
+    EXPECT_LE(accurate_model.num_support_vectors(), data.num_data_points());
+    EXPECT_GE(svm.score(accurate_model, data), svm.score(full_model, data));
+}
+TYPED_TEST_P(GenericCSVM, fit_checkpoint) {
+    using csvm_type = typename TypeParam::csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ plssvm::kernel_type = kernel };
+
+    // create data set to be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+
+    // create C-SVM
+    const csvm_type svm = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments);
+
+    // fit without an interruption
+    unsigned long long exact_num_iterations = 0;
+    const plssvm::model<real_type> exact_model = svm.fit(data, plssvm::epsilon = 1e-10, plssvm::progress_callback = [&](const plssvm::solver_progress &p) { exact_num_iterations = p.iteration; });
+    ASSERT_GE(exact_num_iterations, 2);
+
+    // interrupt the CG halfway while writing a checkpoint after every iteration
+    const unsigned long long num_interrupted_iterations = exact_num_iterations / 2;
+    const util::temporary_file checkpoint_file{};
+    std::ignore = svm.fit(data, plssvm::epsilon = 1e-10, plssvm::max_iter = num_interrupted_iterations, plssvm::checkpoint_file = checkpoint_file.filename, plssvm::checkpoint_interval = 1);
+    plssvm::detail::io::file_reader reader{ checkpoint_file.filename };
+    reader.read_lines('#');
+    EXPECT_EQ(plssvm::detail::io::parse_checkpoint<real_type>(reader).iteration, num_interrupted_iterations);
+
+    // resume from the last checkpoint
+    const plssvm::model<real_type> resumed_model = svm.fit(data, plssvm::epsilon = 1e-10, plssvm::checkpoint_file = checkpoint_file.filename, plssvm::resume = true);
+
+    // the resumed CG must converge to the same solution
+    const real_type tolerance = std::is_same_v<real_type, float> ? real_type{ 1e-2 } : real_type{ 1e-4 };
+    ASSERT_EQ(resumed_model.weights().size(), exact_model.weights().size());
+    for (std::size_t i = 0; i < exact_model.weights().size(); ++i) {
+        EXPECT_NEAR(resumed_model.weights()[i], exact_model.weights()[i], tolerance) << fmt::format("index: {}", i);
+    }
+    EXPECT_NEAR(resumed_model.rho(), exact_model.rho(), tolerance);
+}
+TYPED_TEST_P(GenericCSVM, fit_async_cancel) {
+    using csvm_type = typename TypeParam::csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ plssvm::kernel_type = kernel };
+
+    // create data set to be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+
+    // create C-SVM
+    const csvm_type svm = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments);
+
+    // cancel the CG from within the progress callback after three iterations
+    const plssvm::cancellation_token token{};
+    std::vector<plssvm::solver_progress> progress{};
+    const auto callback = [&](const plssvm::solver_progress &p) {
+        progress.push_back(p);
+        if (p.iteration == 3) {
+            token.request_cancellation();
+        }
+    };
+    plssvm::async_handle<plssvm::model<real_type>> handle = svm.fit_async(data, plssvm::epsilon = 1e-10, plssvm::progress_callback = callback, plssvm::cancellation = token);
+    const plssvm::model<real_type> cancelled_model = handle.get();
+
+    // the progress must have been reported after each iteration
+    ASSERT_EQ(progress.size(), 3);
+    for (std::size_t i = 0; i < progress.size(); ++i) {
+        EXPECT_EQ(progress[i].iteration, i + 1);
+        EXPECT_EQ(progress[i].max_iter, data.num_data_points());
+        EXPECT_GT(progress[i].residual, 0.0);
+        EXPECT_DOUBLE_EQ(progress[i].target_residual, static_cast<double>(real_type{ 1e-10 }));
+    }
+
+    // the cancelled model must be equal to a model trained using exactly three CG iterations
+    const plssvm::model<real_type> limited_model = svm.fit(data, plssvm::epsilon = 1e-10, plssvm::max_iter = 3);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(cancelled_model.weights(), limited_model.weights());
+    EXPECT_FLOATING_POINT_NEAR(cancelled_model.rho(), limited_model.rho());
+
+    // the asynchronous prediction must be equal to the synchronous one
+    plssvm::async_handle<std::vector<int>> prediction = svm.predict_async(cancelled_model, data);
+    EXPECT_EQ(prediction.get(), svm.predict(cancelled_model, data));
+}
+
 TYPED_TEST_P(GenericCSVM, predict_values) {
     using mock_csvm_type = typename TypeParam::mock_csvm_type;
     using real_type = typename TypeParam::real_type;
@@ -251,6 +619,8 @@ REGISTER_TYPED_TEST_SUITE_P(GenericCSVM,
                             move_constructor, move_assignment,
                             get_target_platform,
                             solve_system_of_linear_equations_trivial, solve_system_of_linear_equations, solve_system_of_linear_equations_with_correction,
+                            solve_system_of_linear_equations_cost_path, solve_system_of_linear_equations_single_reduction, solve_system_of_linear_equations_warm_start,
+                            fit_cascade, fit_recycle, fit_incremental, fit_sparse, fit_checkpoint, fit_async_cancel,
                             predict_values, predict, score);
 // clang-format on
 
@@ -277,13 +647,13 @@ TYPED_TEST_P(GenericCSVMDeathTest, solve_system_of_linear_equations) {
     const std::vector<real_type> b{ real_type{ 1.0 }, real_type{ 2.0 } };
 
     // empty data is not allowed
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{}, b, real_type{ 0.1 }, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{}, b, real_type{ 0.1 }, 2, plssvm::detail::solve_options<real_type>{}),
                  "The data must not be empty!");
     // empty features are not allowed
-    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{} }, b, real_type{ 0.1 }, 2)),
+    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{} }, b, real_type{ 0.1 }, 2, plssvm::detail::solve_options<real_type>{})),
                  "The data points must contain at least one feature!");
     // all data points must have the same number of features
-    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{ real_type{ 1.0 } }, std::vector<real_type>{ real_type{ 1.0 }, real_type{ 2.0 } } }, b, real_type{ 0.1 }, 2)),
+    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{ real_type{ 1.0 } }, std::vector<real_type>{ real_type{ 1.0 }, real_type{ 2.0 } } }, b, real_type{ 0.1 }, 2, plssvm::detail::solve_options<real_type>{})),
                  "All data points must have the same number of features!");
 
     const std::vector<std::vector<real_type>> data = {
@@ -292,15 +662,15 @@ TYPED_TEST_P(GenericCSVMDeathTest, solve_system_of_linear_equations) {
     };
 
     // the number of data points and values in b must be the same
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, std::vector<real_type>{}, 0.1, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, std::vector<real_type>{}, 0.1, 2, plssvm::detail::solve_options<real_type>{}),
                  ::testing::HasSubstr("The number of data points in the matrix A (2) and the values in the right hand side vector (0) must be the same!"));
     // the stopping criterion must be greater than zero
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.0 }, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.0 }, 2, plssvm::detail::solve_options<real_type>{}),
                  "The stopping criterion in the CG algorithm must be greater than 0.0, but is 0!");
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ -0.1 }, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ -0.1 }, 2, plssvm::detail::solve_options<real_type>{}),
                  "The stopping criterion in the CG algorithm must be greater than 0.0, but is -0.1!");
     // at least one CG iteration must be performed
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.1 }, 0),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.1 }, 0, plssvm::detail::solve_options<real_type>{}),
                  "The number of CG iterations must be greater than 0!");
 }
 
@@ -0,0 +1,163 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the k-fold cross-validation.
+ */
+
+#include "plssvm/cross_validation.hpp"
+
+#include "plssvm/data_set.hpp"                 // plssvm::data_set
+#include "plssvm/exceptions/exceptions.hpp"    // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"    // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                // plssvm::parameter, plssvm::epsilon, plssvm::max_iter
+
+#include "custom_test_macros.hpp"              // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_EQ
+#include "naming.hpp"                          // naming::real_type_label_type_combination_to_name
+#include "types_to_test.hpp"                   // util::real_type_label_type_combination_gtest
+#include "utility.hpp"                         // util::{temporary_file, redirect_output, instantiate_template_file}
+
+#include "gtest/gtest.h"                       // TEST, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_GE, EXPECT_LE, ASSERT_EQ, ::testing::Test
+
+#include <cstddef>                             // std::size_t
+#include <tuple>                               // std::ignore
+#include <vector>                              // std::vector
+
+TEST(CrossValidation, construct) {
+    const plssvm::parameter params{ plssvm::kernel_type = plssvm::kernel_function_type::rbf };
+    const plssvm::cross_validation cv{ params, 3 };
+
+    EXPECT_EQ(cv.get_params(), params);
+    EXPECT_EQ(cv.num_folds(), 3);
+}
+TEST(CrossValidation, construct_default) {
+    const plssvm::cross_validation cv{};
+
+    EXPECT_EQ(cv.get_params(), plssvm::parameter{});
+    EXPECT_EQ(cv.num_folds(), 5);
+}
+TEST(CrossValidation, construct_invalid_num_folds) {
+    EXPECT_THROW_WHAT((plssvm::cross_validation{ plssvm::parameter{}, 1 }),
+                      plssvm::invalid_parameter_exception,
+                      "The number of folds must be at least 2, but is 1!");
+}
+TEST(CrossValidation, construct_invalid_kernel) {
+    const plssvm::parameter params{ plssvm::kernel_type = static_cast<plssvm::kernel_function_type>(3) };
+    EXPECT_THROW_WHAT(plssvm::cross_validation{ params },
+                      plssvm::invalid_parameter_exception,
+                      "Invalid kernel function 3 given!");
+}
+
+template <typename T>
+class CrossValidation : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(CrossValidation, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(CrossValidation, evaluate) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    // perform the cross-validation
+    const plssvm::cross_validation cv{ plssvm::parameter{ plssvm::kernel_type = plssvm::kernel_function_type::rbf }, 2 };
+    const plssvm::cross_validation_result<real_type> result = cv.evaluate(data, plssvm::epsilon = 1e-10);
+
+    // each data point must be held out exactly once
+    ASSERT_EQ(result.folds().size(), 2);
+    std::size_t num_test_points{ 0 };
+    real_type num_correct{ 0.0 };
+    for (const auto &fold : result.folds()) {
+        EXPECT_EQ(fold.num_training_points + fold.num_test_points, data.num_data_points());
+        EXPECT_GE(fold.accuracy, real_type{ 0.0 });
+        EXPECT_LE(fold.accuracy, real_type{ 1.0 });
+        num_test_points += fold.num_test_points;
+        num_correct += fold.accuracy * static_cast<real_type>(fold.num_test_points);
+    }
+    EXPECT_EQ(num_test_points, data.num_data_points());
+
+    // the overall accuracy must be the fraction of correctly predicted held out data points
+    EXPECT_FLOATING_POINT_EQ(result.accuracy(), num_correct / static_cast<real_type>(data.num_data_points()));
+}
+TYPED_TEST(CrossValidation, evaluate_deterministic) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    // the folds are created using a fixed seed, i.e., two runs must yield the same results
+    const plssvm::cross_validation cv{ plssvm::parameter{}, 2 };
+    const plssvm::cross_validation_result<real_type> result = cv.evaluate(data, plssvm::max_iter = 10);
+    const plssvm::cross_validation_result<real_type> result_second = cv.evaluate(data, plssvm::max_iter = 10);
+
+    ASSERT_EQ(result.folds().size(), result_second.folds().size());
+    for (std::size_t i = 0; i < result.folds().size(); ++i) {
+        EXPECT_EQ(result.folds()[i].num_test_points, result_second.folds()[i].num_test_points);
+        EXPECT_EQ(result.folds()[i].num_iterations, result_second.folds()[i].num_iterations);
+        EXPECT_FLOATING_POINT_EQ(result.folds()[i].accuracy, result_second.folds()[i].accuracy);
+    }
+    EXPECT_FLOATING_POINT_EQ(result.accuracy(), result_second.accuracy());
+}
+TYPED_TEST(CrossValidation, evaluate_invalid_epsilon) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    const plssvm::cross_validation cv{ plssvm::parameter{}, 2 };
+    EXPECT_THROW_WHAT((std::ignore = cv.evaluate(data, plssvm::epsilon = 0.0)),
+                      plssvm::invalid_parameter_exception,
+                      "epsilon must be greater than 0.0, but is 0!");
+}
+TYPED_TEST(CrossValidation, evaluate_invalid_max_iter) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    const plssvm::cross_validation cv{ plssvm::parameter{}, 2 };
+    EXPECT_THROW_WHAT((std::ignore = cv.evaluate(data, plssvm::max_iter = 0)),
+                      plssvm::invalid_parameter_exception,
+                      "max_iter must be greater than 0, but is 0!");
+}
+TYPED_TEST(CrossValidation, evaluate_too_few_data_points) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    // each fold must contain at least two data points
+    const plssvm::cross_validation cv{ plssvm::parameter{}, 3 };
+    EXPECT_THROW_WHAT((std::ignore = cv.evaluate(data)),
+                      plssvm::invalid_parameter_exception,
+                      "At least 6 data points are necessary for a 3-fold cross-validation, but only 5 are given!");
+}
+TYPED_TEST(CrossValidation, evaluate_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> data{ std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } } };
+
+    const plssvm::cross_validation cv{ plssvm::parameter{}, 2 };
+    EXPECT_THROW_WHAT(std::ignore = cv.evaluate(data),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for training! Maybe the data is only usable for prediction?");
+}
@@ -10,26 +10,37 @@
 
 #include "mock_csvm.hpp"                     // mock_csvm
 
+#include "plssvm/async_handle.hpp"           // plssvm::async_handle
+#include "plssvm/cancellation_token.hpp"     // plssvm::cancellation_token
 #include "plssvm/core.hpp"                   // necessary for type_traits, plssvm::csvm_backend_exists, plssvm::csvm_backend_exists_v
 #include "plssvm/data_set.hpp"               // plssvm::data_set
+#include "plssvm/detail/cg_checkpoint.hpp"   // plssvm::detail::checkpoint_config
+#include "plssvm/detail/cg_monitor.hpp"      // plssvm::detail::cg_monitor
+#include "plssvm/detail/solve_options.hpp"   // plssvm::detail::solve_options
 #include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_parameter_exception
 #include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
 #include "plssvm/model.hpp"                  // plssvm::model
 #include "plssvm/parameter.hpp"              // plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/solver_progress.hpp"        // plssvm::solver_progress
+#include "plssvm/solver_state.hpp"           // plssvm::solver_state
+#include "plssvm/solver_types.hpp"           // plssvm::solver_type
 
-#include "custom_test_macros.hpp"            // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_FLOATING_POINT_2D_VECTOR_EQ
+#include "custom_test_macros.hpp"            // EXPECT_THROW_WHAT, EXPECT_THROW_WHAT_MATCHER, EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_FLOATING_POINT_2D_VECTOR_EQ
 #include "naming.hpp"                        // naming::real_type_label_type_combination_to_name
 #include "types_to_test.hpp"                 // util::{real_type_label_type_combination_gtest, real_type_label_type_combination_gtest}
 #include "utility.hpp"                       // util::{redirect_output, temporary_file, instantiate_template_file, get_distinct_label}
 
-#include "gtest/gtest.h"                     // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_CALL, ::testing::{Test, An}
+#include "fmt/core.h"                        // fmt::format
+#include "gtest/gtest.h"                     // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_CALL, GTEST_SKIP, ::testing::{Test, An, Eq, AllOf, Field, Property, Truly, SizeIs, Return, Invoke, HasSubstr}
 
+#include <cstddef>                           // std::size_t
 #include <iostream>                          // std::clog
 #include <sstream>                           // std::stringstream
 #include <streambuf>                         // std::streambuf
 #include <string>                            // std::string
 #include <tuple>                             // std::ignore
-#include <utility>                           // std::pair
+#include <type_traits>                       // std::is_same_v
+#include <utility>                           // std::pair, std::make_pair, std::move
 #include <vector>                            // std::vector
 
 class BaseCSVM : public ::testing::Test {};
@@ -207,7 +218,8 @@ TYPED_TEST(BaseCSVMFit, fit) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(1);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(1);
     // clang-format on
 
     // create data set
@@ -240,7 +252,8 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(1);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(1);
     // clang-format on
 
     // create data set
@@ -259,6 +272,278 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters) {
     EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
     EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
 }
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_solver) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> the requested CG variant must be passed through
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solve_options<real_type>::solver, ::testing::Eq(plssvm::solver_type::single_reduction_cg)))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::solver = plssvm::solver_type::single_reduction_cg);
+
+    // check whether the model has been created correctly
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_recycle) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+    plssvm::solver_state<real_type> state{};
+
+    // mock the solve_system_of_linear_equations function -> the solver state must be passed through
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::AllOf(::testing::Field(&plssvm::detail::solve_options<real_type>::solver, ::testing::Eq(plssvm::solver_type::cg)),
+                                           ::testing::Field(&plssvm::detail::solve_options<real_type>::state, ::testing::Eq(&state))))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::recycle = &state);
+
+    // check whether the model has been created correctly
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_recycle) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+    plssvm::solver_state<real_type> state{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // a solver state can neither be recycled in the cascade training nor using the single reduction CG
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::num_partitions = 2, plssvm::recycle = &state)),
+                      plssvm::invalid_parameter_exception,
+                      "A solver state can't be recycled in the cascade training!");
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::solver = plssvm::solver_type::single_reduction_cg, plssvm::recycle = &state)),
+                      plssvm::invalid_parameter_exception,
+                      "A solver state can only be recycled using the cg solver, but single_reduction_cg was provided!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_checkpoint) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> the checkpoint settings must be passed through
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::AllOf(::testing::Field(&plssvm::detail::solve_options<real_type>::solver, ::testing::Eq(plssvm::solver_type::cg)),
+                                           ::testing::Field(&plssvm::detail::solve_options<real_type>::checkpoint,
+                                                            ::testing::AllOf(::testing::Field(&plssvm::detail::checkpoint_config::filename, "checkpoint.txt"),
+                                                                             ::testing::Field(&plssvm::detail::checkpoint_config::interval, 10ULL),
+                                                                             ::testing::Field(&plssvm::detail::checkpoint_config::resume, true)))))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::checkpoint_file = "checkpoint.txt", plssvm::checkpoint_interval = 10, plssvm::resume = true);
+
+    // check whether the model has been created correctly
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_checkpoint) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+    plssvm::solver_state<real_type> state{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // checkpoints need a file and can't be combined with the cascade training, the single reduction CG, or recycling a solver state
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::resume = true)),
+                      plssvm::invalid_parameter_exception,
+                      "A checkpoint_file must be provided to write or resume from CG checkpoints!");
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::num_partitions = 2, plssvm::checkpoint_file = "checkpoint.txt", plssvm::checkpoint_interval = 10)),
+                      plssvm::invalid_parameter_exception,
+                      "CG checkpoints can't be used in the cascade training!");
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::solver = plssvm::solver_type::single_reduction_cg, plssvm::checkpoint_file = "checkpoint.txt", plssvm::checkpoint_interval = 10)),
+                      plssvm::invalid_parameter_exception,
+                      "CG checkpoints can only be used with the cg solver, but single_reduction_cg was provided!");
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::recycle = &state, plssvm::checkpoint_file = "checkpoint.txt", plssvm::resume = true)),
+                      plssvm::invalid_parameter_exception,
+                      "CG checkpoints can't be combined with recycling a solver state!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_monitor) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+    const plssvm::cancellation_token token{};
+    token.request_cancellation();
+
+    // mock the solve_system_of_linear_equations function -> the progress callback and cancellation token must be passed through
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solve_options<real_type>::monitor,
+                                           ::testing::AllOf(::testing::Property(&plssvm::detail::cg_monitor::has_callback, true),
+                                                            ::testing::Truly([](const plssvm::detail::cg_monitor &monitor) { return monitor.token().cancellation_requested(); }))))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::progress_callback = [](const plssvm::solver_progress &) {}, plssvm::cancellation = token);
+
+    // check whether the model has been created correctly
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_async) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    plssvm::async_handle<plssvm::model<real_type, label_type>> handle = csvm.fit_async(training_data, plssvm::epsilon = 0.001);
+    ASSERT_TRUE(handle.valid());
+    EXPECT_FALSE(handle.cancellation_requested());
+    const plssvm::model<real_type, label_type> model = handle.get();
+    EXPECT_FALSE(handle.valid());
+
+    // check whether the model has been created correctly
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_async_shared_cancellation_token) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+    const plssvm::cancellation_token token{};
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // the handle must observe the provided cancellation token
+    plssvm::async_handle<plssvm::model<real_type, label_type>> handle = csvm.fit_async(training_data, plssvm::cancellation = token);
+    token.request_cancellation();
+    EXPECT_TRUE(handle.cancellation_requested());
+    std::ignore = handle.get();
+}
+TYPED_TEST(BaseCSVMFit, fit_async_invalid_named_parameters) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // the named parameters must be validated before the training is started
+    EXPECT_THROW_WHAT(std::ignore = csvm.fit_async(training_data, plssvm::max_iter = 0),
+                      plssvm::invalid_parameter_exception,
+                      "max_iter must be greater than 0, but is 0!");
+}
 TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_epsilon) {
     using real_type = typename TypeParam::real_type;
     using label_type = typename TypeParam::label_type;
@@ -273,19 +558,519 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_epsilon) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(0);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with an invalid epsilon should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::epsilon = 0.0)),
+                      plssvm::invalid_parameter_exception,
+                      "epsilon must be greater than 0.0, but is 0!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_max_iter) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with an invalid max_iter should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::max_iter = 0)),
+                      plssvm::invalid_parameter_exception,
+                      "max_iter must be greater than 0, but is 0!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_num_partitions) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with an invalid num_partitions should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::num_partitions = 0)),
+                      plssvm::invalid_parameter_exception,
+                      "num_partitions must be greater than 0, but is 0!");
+}
+TYPED_TEST(BaseCSVMFit, fit_too_many_partitions) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // each partition must contain at least two data points
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::num_partitions = 3)),
+                      plssvm::invalid_parameter_exception,
+                      "At least 6 data points are necessary to train using 3 partitions, but only 5 are given!");
+}
+TYPED_TEST(BaseCSVMFit, fit_too_few_data_points_per_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set with only a single data point of the first label
+    const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+    const plssvm::data_set<real_type, label_type> training_data{ std::vector<std::vector<real_type>>{ { real_type{ 1.0 } }, { real_type{ 2.0 } }, { real_type{ 3.0 } }, { real_type{ 4.0 } }, { real_type{ 5.0 } } },
+                                                               std::vector<label_type>{ first_label, second_label, second_label, second_label, second_label } };
+
+    // each partition must contain at least one data point per label
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::num_partitions = 2)),
+                      plssvm::invalid_parameter_exception,
+                      fmt::format("Each label must occur at least 2 times to train using 2 partitions, but label {} only occurs 1 times!", first_label));
+}
+TYPED_TEST(BaseCSVMFit, fit_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> training_data{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+
+    // in order to call fit, the provided data set must contain labels
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data)),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for training! Maybe the data is only usable for prediction?");
+}
+TYPED_TEST(BaseCSVMFit, fit_incremental) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // read a previously learned model from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> old_model{ model_file.filename };
+
+    // the CG must be warm started using the old weights (without the last one) padded with zeros for the new data points
+    std::vector<real_type> initial_guess(old_model.weights().cbegin(), old_model.weights().cend() - 1);
+    initial_guess.resize(initial_guess.size() + 5, real_type{ 0.0 });
+
+    // mock the solve_system_of_linear_equations function
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solve_options<real_type>::initial_guess, ::testing::Eq(initial_guess)))).Times(1);
+    // clang-format on
+
+    // create data set containing the new data points
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> new_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit_incremental(old_model, new_data);
+
+    // the new data points must be inserted before the last old support vector
+    EXPECT_EQ(model.num_support_vectors(), 10);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_EQ(model.get_params(), old_model.get_params());
+    std::vector<std::vector<real_type>> support_vectors(old_model.support_vectors().cbegin(), old_model.support_vectors().cend() - 1);
+    support_vectors.insert(support_vectors.end(), new_data.data().cbegin(), new_data.data().cend());
+    support_vectors.push_back(old_model.support_vectors().back());
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(model.support_vectors(), support_vectors);
+    EXPECT_EQ(model.labels().front(), old_model.labels().front());
+    EXPECT_EQ(model.labels().back(), old_model.labels().back());
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_incremental_num_partitions) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // read a previously learned model from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> old_model{ model_file.filename };
+
+    // create data set containing the new data points
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> new_data{ this->filename };
+
+    // the warm start can't be combined with the cascade training
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit_incremental(old_model, new_data, plssvm::num_partitions = 2)),
+                      plssvm::invalid_parameter_exception,
+                      "The incremental training can't be combined with the cascade training!");
+}
+TYPED_TEST(BaseCSVMFit, fit_incremental_num_feature_mismatch) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // read a previously learned model from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> old_model{ model_file.filename };
+
+    // create data set containing new data points with only two features
+    const std::pair<label_type, label_type> labels = util::get_distinct_label<label_type>();
+    const plssvm::data_set<real_type, label_type> new_data{ std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } },
+                                                          std::vector<label_type>{ labels.first, labels.second } };
+
+    // the number of features must match
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit_incremental(old_model, new_data)),
+                      plssvm::invalid_parameter_exception,
+                      "Number of features per data point (2) must match the number of features per support vector of the provided model (4)!");
+}
+TYPED_TEST(BaseCSVMFit, fit_incremental_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // read a previously learned model from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> old_model{ model_file.filename };
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> new_data{ std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 }, real_type{ 3.0 }, real_type{ 4.0 } } } };
+
+    // the new data points must contain labels
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit_incremental(old_model, new_data)),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for the new data points! Maybe the data is only usable for prediction?");
+}
+TYPED_TEST(BaseCSVMFit, fit_incremental_single_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(1);
+    // clang-format on
+
+    // read a previously learned model from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> old_model{ model_file.filename };
+
+    // the new data points may only contain a subset of the labels of the model
+    const label_type label = util::get_distinct_label<label_type>().first;
+    const std::vector<std::vector<real_type>> new_points{ { real_type{ 1.0 }, real_type{ 2.0 }, real_type{ 3.0 }, real_type{ 4.0 } }, { real_type{ 5.0 }, real_type{ 6.0 }, real_type{ 7.0 }, real_type{ 8.0 } } };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit_incremental(old_model, new_points, std::vector<label_type>{ label, label });
+
+    // the new data points must be inserted before the last old support vector
+    EXPECT_EQ(model.num_support_vectors(), 7);
+    EXPECT_EQ(model.different_labels(), old_model.different_labels());
+    EXPECT_EQ(model.labels()[4], label);
+    EXPECT_EQ(model.labels()[5], label);
+    EXPECT_EQ(model.labels().back(), old_model.labels().back());
+}
+TYPED_TEST(BaseCSVMFit, fit_incremental_unknown_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    if constexpr (std::is_same_v<label_type, bool>) {
+        GTEST_SKIP() << "A bool label can't be unknown to a binary model!";
+    } else {
+        // create mock_csvm (since plssvm::csvm is pure virtual!)
+        const mock_csvm csvm{};
+
+        // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+        // clang-format off
+        EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                              ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                              ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                              ::testing::An<std::vector<real_type>>(),
+                              ::testing::An<real_type>(),
+                              ::testing::An<unsigned long long>(),
+                              ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+        // clang-format on
+
+        // read a previously learned model from a model file
+        const util::temporary_file model_file;
+        util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+        const plssvm::model<real_type, label_type> old_model{ model_file.filename };
+
+        // create a label that isn't part of the model
+        label_type unknown_label{};
+        if constexpr (std::is_same_v<label_type, std::string>) {
+            unknown_label = "mouse";
+        } else {
+            unknown_label = static_cast<label_type>(42);
+        }
+
+        // the new data points must not add a new label
+        EXPECT_THROW_WHAT_MATCHER((std::ignore = csvm.fit_incremental(old_model, std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 }, real_type{ 3.0 }, real_type{ 4.0 } } }, std::vector<label_type>{ unknown_label })),
+                                  plssvm::invalid_parameter_exception,
+                                  ::testing::HasSubstr("The new data points must only have labels of the provided model"));
+    }
+}
+TYPED_TEST(BaseCSVMFit, fit_sparse) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> the full system is solved first, afterward the smaller system warm started using the remaining weights
+    const std::pair<std::vector<real_type>, real_type> pruned_return{ { real_type{ 1.5 }, real_type{ 2.5 }, real_type{ 3.5 }, real_type{ 4.5 } }, real_type{ 0.5 } };
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solve_options<real_type>::initial_guess, ::testing::Eq(std::vector<real_type>{})))).Times(1);
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::SizeIs(4),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solve_options<real_type>::initial_guess, ::testing::Eq(std::vector<real_type>{ real_type{ 2.0 }, real_type{ 3.0 }, real_type{ 4.0 } })))).WillOnce(::testing::Return(pruned_return));
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function -> the first data point has the smallest absolute weight and must be removed
+    const plssvm::model<real_type, label_type> model = csvm.fit_sparse(training_data, 4);
+
+    EXPECT_EQ(model.num_support_vectors(), 4);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(model.support_vectors(), (std::vector<std::vector<real_type>>(training_data.data().cbegin() + 1, training_data.data().cend())));
+    EXPECT_EQ(model.labels(), (std::vector<label_type>(training_data.labels()->get().cbegin() + 1, training_data.labels()->get().cend())));
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), pruned_return.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), pruned_return.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_sparse_nothing_to_prune) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> only the full system is solved
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function -> the data set already contains at most the requested number of data points
+    const plssvm::model<real_type, label_type> model = csvm.fit_sparse(training_data, 5);
+
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(model.support_vectors(), training_data.data());
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, fit_sparse_invalid_parameter) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
     // clang-format on
 
     // create data set
     util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
     const plssvm::data_set<real_type, label_type> training_data{ this->filename };
 
-    // calling the function with an invalid epsilon should throw
-    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::epsilon = 0.0)),
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit_sparse(training_data, 1)),
+                      plssvm::invalid_parameter_exception,
+                      "The number of support vectors must be at least 2, but is 1!");
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit_sparse(training_data, 2, plssvm::prune_fraction = 1.0)),
+                      plssvm::invalid_parameter_exception,
+                      "prune_fraction must be in the range (0.0, 1.0), but is 1!");
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit_sparse(training_data, 2, plssvm::max_accuracy_drop = -0.1)),
+                      plssvm::invalid_parameter_exception,
+                      "max_accuracy_drop must be in the range [0.0, 1.0], but is -0.1!");
+    // the named parameters shared with fit are validated the same way
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit_sparse(training_data, 2, plssvm::max_iter = 0)),
                       plssvm::invalid_parameter_exception,
-                      "epsilon must be less than 0.0, but is 0!");
+                      "max_iter must be greater than 0, but is 0!");
 }
-TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_max_iter) {
+TYPED_TEST(BaseCSVMFit, fit_cost_path) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> the default implementation solves the system once per cost value
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(3);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const std::vector<double> cost_values{ 0.1, 10.0, 1.0 };
+    const std::vector<plssvm::model<real_type, label_type>> models = csvm.fit(training_data, cost_values, plssvm::epsilon = 0.1);
+
+    // check whether the models have been created correctly
+    ASSERT_EQ(models.size(), cost_values.size());
+    for (std::size_t i = 0; i < models.size(); ++i) {
+        EXPECT_EQ(models[i].num_support_vectors(), 5);
+        EXPECT_EQ(models[i].num_features(), 4);
+        const plssvm::parameter params{ plssvm::gamma = 1.0 / 4.0, plssvm::cost = cost_values[i] };
+        EXPECT_EQ(models[i].get_params(), params);
+        EXPECT_FLOATING_POINT_2D_VECTOR_EQ(models[i].support_vectors(), training_data.data());
+        EXPECT_FLOATING_POINT_VECTOR_EQ(models[i].weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+        EXPECT_FLOATING_POINT_EQ(models[i].rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+    }
+}
+TYPED_TEST(BaseCSVMFit, fit_cost_path_empty) {
     using real_type = typename TypeParam::real_type;
     using label_type = typename TypeParam::label_type;
 
@@ -299,19 +1084,47 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_max_iter) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(0);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
     // clang-format on
 
     // create data set
     util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
     const plssvm::data_set<real_type, label_type> training_data{ this->filename };
 
-    // calling the function with an invalid max_iter should throw
-    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::max_iter = 0)),
+    // at least one cost value must be given
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, std::vector<double>{})),
                       plssvm::invalid_parameter_exception,
-                      "max_iter must be greater than 0, but is 0!");
+                      "At least one cost value must be given!");
 }
-TYPED_TEST(BaseCSVMFit, fit_no_label) {
+TYPED_TEST(BaseCSVMFit, fit_cost_path_invalid_cost) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // all cost values must be greater than zero
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, std::vector<double>{ 1.0, -0.5 })),
+                      plssvm::invalid_parameter_exception,
+                      "All cost values must be greater than 0.0, but -0.5 is not!");
+}
+TYPED_TEST(BaseCSVMFit, fit_cost_path_no_label) {
     using real_type = typename TypeParam::real_type;
     using label_type = typename TypeParam::label_type;
 
@@ -325,14 +1138,187 @@ TYPED_TEST(BaseCSVMFit, fit_no_label) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(0);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
     // clang-format on
 
     // create data set without labels
     const plssvm::data_set<real_type, label_type> training_data{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
 
     // in order to call fit, the provided data set must contain labels
-    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data)),
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, std::vector<double>{ 1.0 })),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for training! Maybe the data is only usable for prediction?");
+}
+TYPED_TEST(BaseCSVMFit, loo_score) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> one solve for the weights and one additional solve per probing vector
+    // H^-1 is mocked as identity matrix, i.e., the solution is the right-hand side
+    const auto identity_solve = [](const auto &, const auto &, std::vector<real_type> rhs, auto, auto, const auto &) { return std::make_pair(std::move(rhs), real_type{ 0.0 }); };
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(4).WillRepeatedly(::testing::Invoke(identity_solve));
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const real_type accuracy = csvm.loo_score(training_data, plssvm::epsilon = 0.1, plssvm::num_probes = 3);
+
+    // the leave-one-out accuracy must be a valid accuracy
+    EXPECT_GE(accuracy, real_type{ 0.0 });
+    EXPECT_LE(accuracy, real_type{ 1.0 });
+}
+TYPED_TEST(BaseCSVMFit, loo_score_exact_diagonal) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> one solve for the weights and one additional solve per unit vector
+    // since the data set has at most num_probes (default: 10) data points, the diagonal of H^-1 is computed exactly
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(6);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const real_type accuracy = csvm.loo_score(training_data, plssvm::epsilon = 0.1);
+
+    // the leave-one-out accuracy must be a valid accuracy
+    EXPECT_GE(accuracy, real_type{ 0.0 });
+    EXPECT_LE(accuracy, real_type{ 1.0 });
+}
+TYPED_TEST(BaseCSVMFit, loo_score_non_positive_estimate) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> H^-1 is mocked as identity matrix except for a negative (H^-1)_00
+    const auto negative_solve = [](const auto &, const auto &, std::vector<real_type> rhs, auto, auto, const auto &) {
+        rhs.front() = -rhs.front();
+        return std::make_pair(std::move(rhs), real_type{ 0.0 });
+    };
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(4).WillRepeatedly(::testing::Invoke(negative_solve));
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // a non-positive estimate would flip the sign of the LOO residual
+    EXPECT_THROW_WHAT((std::ignore = csvm.loo_score(training_data, plssvm::epsilon = 0.1, plssvm::num_probes = 3)),
+                      plssvm::invalid_parameter_exception,
+                      "1 of the 5 estimated diagonal entries of the inverse system matrix are non-positive! Increase num_probes (currently 3) to reduce the variance of the estimation.");
+}
+TYPED_TEST(BaseCSVMFit, loo_score_invalid_num_probes) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // at least one probing vector must be used
+    EXPECT_THROW_WHAT((std::ignore = csvm.loo_score(training_data, plssvm::num_probes = 0)),
+                      plssvm::invalid_parameter_exception,
+                      "num_probes must be greater than 0, but is 0!");
+}
+TYPED_TEST(BaseCSVMFit, loo_score_invalid_epsilon) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // epsilon must be greater than zero
+    EXPECT_THROW_WHAT((std::ignore = csvm.loo_score(training_data, plssvm::epsilon = -0.1)),
+                      plssvm::invalid_parameter_exception,
+                      "epsilon must be greater than 0.0, but is -0.1!");
+}
+TYPED_TEST(BaseCSVMFit, loo_score_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solve_options<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> training_data{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+
+    // in order to estimate the leave-one-out accuracy, the provided data set must contain labels
+    EXPECT_THROW_WHAT((std::ignore = csvm.loo_score(training_data)),
                       plssvm::invalid_parameter_exception,
                       "No labels given for training! Maybe the data is only usable for prediction?");
 }
@@ -407,6 +1393,65 @@ TYPED_TEST(BaseCSVMPredict, predict_num_feature_mismatch) {
                       plssvm::invalid_parameter_exception,
                       "Number of features per data point (2) must match the number of features per support vector of the provided model (4)!");
 }
+TYPED_TEST(BaseCSVMPredict, predict_async) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the predict_values function
+    // clang-format off
+    EXPECT_CALL(csvm, predict_values(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<const std::vector<real_type> &>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<std::vector<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>())).Times(1);
+    // clang-format on
+
+    // create data set
+    const util::temporary_file data_set_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_set_file.filename);
+    const plssvm::data_set<real_type, label_type> data_to_predict{ data_set_file.filename };
+
+    // read a previously learned from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> learned_model{ model_file.filename };
+
+    // call function
+    plssvm::async_handle<std::vector<label_type>> handle = csvm.predict_async(learned_model, data_to_predict);
+    handle.wait();
+    EXPECT_TRUE(handle.ready());
+    const std::vector<label_type> prediction = handle.get();
+
+    // check return value
+    const std::pair<label_type, label_type> labels = util::get_distinct_label<label_type>();
+    EXPECT_EQ(prediction, (std::vector<label_type>{ labels.first, labels.first, labels.first, labels.second, labels.second }));
+}
+TYPED_TEST(BaseCSVMPredict, predict_async_num_feature_mismatch) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // create data set
+    const plssvm::data_set<real_type, label_type> data_to_predict{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+
+    // read a previously learned from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> learned_model{ model_file.filename };
+
+    // the exception must be rethrown when retrieving the result
+    plssvm::async_handle<std::vector<label_type>> handle = csvm.predict_async(learned_model, data_to_predict);
+    EXPECT_THROW_WHAT(std::ignore = handle.get(),
+                      plssvm::invalid_parameter_exception,
+                      "Number of features per data point (2) must match the number of features per support vector of the provided model (4)!");
+}
 
 template <typename T>
 class BaseCSVMScore : public BaseCSVM, private util::redirect_output<> {};
@@ -10,26 +10,39 @@
 
 #include "plssvm/data_set.hpp"
 
-#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
-#include "plssvm/detail/string_conversion.hpp"  // plssvm::detail::convert_to
-#include "plssvm/exceptions/exceptions.hpp"     // plssvm::data_set_exception
-#include "plssvm/file_format_types.hpp"         // plssvm::file_format_type
-
-#include "custom_test_macros.hpp"               // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_NEAR, EXPECT_FLOATING_POINT_2D_VECTOR_EQ, EXPECT_FLOATING_POINT_2D_VECTOR_NEAR
-#include "naming.hpp"                           // naming::real_type_label_type_combination_to_name
-#include "types_to_test.hpp"                    // util::{real_type_label_type_combination_gtest}
-#include "utility.hpp"                          // util::{temporary_file, redirect_output, instantiate_template_file, get_distinct_label}
-
-#include "gmock/gmock-matchers.h"               // EXPECT_THAT, ::testing::{ContainsRegex, StartsWith}
-#include "gtest/gtest.h"                        // EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, ASSERT_EQ, TEST, TYPED_TEST, TYPED_TEST_SUITE, ::testing::Test
-
-#include <cstddef>                              // std::size_t
-#include <regex>                                // std::regex, std::regex::extended, std::regex_match
-#include <string>                               // std::string
-#include <string_view>                          // std::string_view
-#include <tuple>                                // std::ignore, std::get
-#include <type_traits>                          // std::is_same_v, std::is_integral_v
-#include <vector>                               // std::vector
+#include "plssvm/detail/io/binary_parsing.hpp"   // plssvm::detail::io::write_binary_data
+#include "plssvm/detail/io/compression.hpp"      // plssvm::detail::io::{determine_compression_type, is_compression_type_supported}
+#include "plssvm/detail/io/data_set_cache.hpp"   // plssvm::data_set_cache, plssvm::data_set_cache_options
+#include "plssvm/detail/io/data_set_subset.hpp"  // plssvm::detail::io::select_subset
+#include "plssvm/detail/io/file_reader.hpp"      // plssvm::detail::io::file_reader
+#include "plssvm/detail/string_conversion.hpp"   // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"      // plssvm::detail::ends_with
+#include "plssvm/exceptions/exceptions.hpp"      // plssvm::data_set_exception
+#include "plssvm/file_format_types.hpp"          // plssvm::file_format_type, plssvm::csv_options, plssvm::subset_options
+#include "plssvm/sampling_types.hpp"             // plssvm::sampling_type
+
+#include "custom_test_macros.hpp"                // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_NEAR, EXPECT_FLOATING_POINT_2D_VECTOR_EQ, EXPECT_FLOATING_POINT_2D_VECTOR_NEAR
+#include "naming.hpp"                            // naming::real_type_label_type_combination_to_name
+#include "types_to_test.hpp"                     // util::{real_type_label_type_combination_gtest}
+#include "utility.hpp"                           // util::{temporary_file, redirect_input, redirect_output, instantiate_template_file, get_distinct_label}
+
+#include "gmock/gmock-matchers.h"                // EXPECT_THAT, ::testing::{ContainsRegex, StartsWith}
+#include "gtest/gtest.h"                         // EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, ASSERT_EQ, ASSERT_TRUE, TEST, TEST_P, TYPED_TEST, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P, GTEST_SKIP
+                                                 // ::testing::{Test, TestWithParam, Values}
+
+#include <cstddef>                               // std::size_t
+#include <filesystem>                            // std::filesystem::{path, directory_entry, directory_iterator, exists, remove_all, file_size, create_directories, permissions, perms}
+#include <fstream>                               // std::ifstream, std::ofstream
+#include <ios>                                   // std::ios
+#include <iostream>                              // std::clog
+#include <iterator>                              // std::istreambuf_iterator
+#include <optional>                              // std::nullopt
+#include <regex>                                 // std::regex, std::regex::extended, std::regex_match
+#include <string>                                // std::string
+#include <string_view>                           // std::string_view
+#include <tuple>                                 // std::ignore, std::get, std::tuple, std::make_tuple
+#include <type_traits>                           // std::is_same_v, std::is_integral_v
+#include <vector>                                // std::vector
 
 //*************************************************************************************************************************************//
 //                                                         scaling nested-class                                                        //
@@ -510,6 +523,88 @@ TYPED_TEST(DataSet, construct_explicit_libsvm_from_file) {
     EXPECT_FALSE(data.scaling_factors().has_value());
 }
 
+TYPED_TEST(DataSet, construct_csv_from_file_with_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // must append .csv to filename so that the correct function is called in the data_set constructor
+    this->filename.append(".csv");
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/csv/5x4_TEMPLATE.csv", this->filename);
+    const plssvm::data_set<real_type, label_type> data{ this->filename };
+
+    // check values
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(data.data(), correct_data_points<real_type>);
+    EXPECT_TRUE(data.has_labels());
+    EXPECT_EQ(data.labels().value().get(), correct_labels<label_type>());
+    EXPECT_EQ(data.different_labels().value(), correct_different_labels<label_type>());
+
+    EXPECT_EQ(data.num_data_points(), correct_data_points<real_type>.size());
+    EXPECT_EQ(data.num_features(), correct_data_points<real_type>.front().size());
+    EXPECT_EQ(data.num_different_labels(), 2);
+}
+TYPED_TEST(DataSet, construct_csv_from_file_with_options) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> data{ PLSSVM_TEST_PATH "/data/csv/3x2_without_label.csv", plssvm::csv_options{ ',', false, std::nullopt } };
+
+    // check values
+    const std::vector<std::vector<real_type>> correct_data = {
+        { real_type{ 1.5 }, real_type{ -2.9 } },
+        { real_type{ 0.0 }, real_type{ -0.3 } },
+        { real_type{ 5.5 }, real_type{ 0.0 } }
+    };
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(data.data(), correct_data);
+    EXPECT_FALSE(data.has_labels());
+    EXPECT_EQ(data.num_data_points(), 3);
+    EXPECT_EQ(data.num_features(), 2);
+}
+TYPED_TEST(DataSet, construct_explicit_csv_from_file) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/csv/5x4_TEMPLATE.csv", this->filename);
+    const plssvm::data_set<real_type, label_type> data{ this->filename, plssvm::file_format_type::csv };
+
+    // check values
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(data.data(), correct_data_points<real_type>);
+    EXPECT_TRUE(data.has_labels());
+    EXPECT_EQ(data.labels().value().get(), correct_labels<label_type>());
+}
+TYPED_TEST(DataSet, construct_npy_from_file) {
+    using real_type = typename TypeParam::real_type;
+
+    // create data set; the NumPy file contains the labels 1 and -1 in the last column
+    const plssvm::data_set<real_type, int> data{ PLSSVM_TEST_PATH "/data/npy/5x4.npy" };
+
+    // check values
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(data.data(), correct_data_points<real_type>);
+    EXPECT_TRUE(data.has_labels());
+    EXPECT_EQ(data.labels().value().get(), (std::vector<int>{ 1, 1, -1, -1, -1 }));
+    EXPECT_EQ(data.num_data_points(), correct_data_points<real_type>.size());
+    EXPECT_EQ(data.num_features(), correct_data_points<real_type>.front().size());
+}
+TYPED_TEST(DataSet, construct_npy_from_file_without_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const plssvm::data_set<real_type, label_type> data{ PLSSVM_TEST_PATH "/data/npy/3x2_without_label.npy", plssvm::csv_options{ ',', false, std::nullopt } };
+
+    // check values
+    const std::vector<std::vector<real_type>> correct_data = {
+        { real_type{ 1.5 }, real_type{ -2.9 } },
+        { real_type{ 0.0 }, real_type{ -0.3 } },
+        { real_type{ 5.5 }, real_type{ 0.0 } }
+    };
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(data.data(), correct_data);
+    EXPECT_FALSE(data.has_labels());
+}
+
 TYPED_TEST(DataSet, construct_scaled_arff_from_file) {
     using real_type = typename TypeParam::real_type;
     using label_type = typename TypeParam::label_type;
@@ -905,6 +1000,311 @@ TYPED_TEST(DataSet, construct_scaled_from_vector_with_label) {
     }
 }
 
+// the compressed file and the uncompressed original file
+class DataSetCompressed : public ::testing::TestWithParam<std::tuple<std::string, std::string>>, private util::redirect_output<> {
+  protected:
+    void SetUp() override {
+        // skip the test if the compression type isn't supported in this build
+        if (!plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::determine_compression_type(std::get<0>(GetParam())))) {
+            GTEST_SKIP() << "The compression type isn't supported!";
+        }
+    }
+};
+TEST_P(DataSetCompressed, construct_from_compressed_file) {
+    const auto &[compressed_filename, filename] = GetParam();
+
+    // the file format must be determined ignoring the compression file extension
+    const plssvm::data_set<double, int> compressed_data{ compressed_filename };
+    const plssvm::data_set<double, int> data{ filename };
+
+    // check values
+    EXPECT_EQ(compressed_data.data(), data.data());
+    ASSERT_TRUE(compressed_data.has_labels());
+    EXPECT_EQ(compressed_data.labels().value().get(), data.labels().value().get());
+    EXPECT_EQ(compressed_data.num_data_points(), data.num_data_points());
+    EXPECT_EQ(compressed_data.num_features(), data.num_features());
+}
+TEST_P(DataSetCompressed, construct_explicit_from_compressed_file) {
+    const auto &[compressed_filename, filename] = GetParam();
+
+    // explicitly providing the file format must also work for compressed files
+    const plssvm::file_format_type format = plssvm::detail::ends_with(filename, ".arff") ? plssvm::file_format_type::arff : plssvm::file_format_type::libsvm;
+    const plssvm::data_set<double, int> compressed_data{ compressed_filename, format };
+    const plssvm::data_set<double, int> data{ filename, format };
+
+    // check values
+    EXPECT_EQ(compressed_data.data(), data.data());
+    ASSERT_TRUE(compressed_data.has_labels());
+    EXPECT_EQ(compressed_data.labels().value().get(), data.labels().value().get());
+}
+TEST_P(DataSetCompressed, construct_from_compressed_file_with_subset) {
+    const auto &[compressed_filename, filename] = GetParam();
+
+    // the feature projection must also be applied while decompressing the file
+    const plssvm::file_format_type format = plssvm::detail::ends_with(filename, ".arff") ? plssvm::file_format_type::arff : plssvm::file_format_type::libsvm;
+    const plssvm::subset_options subset{ { 0, 2 }, 0, plssvm::sampling_type::uniform };
+    const plssvm::data_set<double, int> compressed_data{ compressed_filename, format, subset };
+    const plssvm::data_set<double, int> data{ filename, format, subset };
+
+    // check values
+    EXPECT_EQ(compressed_data.num_features(), 2);
+    EXPECT_EQ(compressed_data.data(), data.data());
+    ASSERT_TRUE(compressed_data.has_labels());
+    EXPECT_EQ(compressed_data.labels().value().get(), data.labels().value().get());
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(DataSet, DataSetCompressed, ::testing::Values(
+                std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.arff.gz", PLSSVM_TEST_PATH "/data/arff/5x4.arff"),
+                std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.arff.zst", PLSSVM_TEST_PATH "/data/arff/5x4.arff")));
+// clang-format on
+
+class DataSetStandardInput : public ::testing::TestWithParam<std::string>, private util::redirect_output<> {};
+TEST_P(DataSetStandardInput, construct_from_standard_input) {
+    const std::string filename = PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm";
+    std::ifstream in{ filename, std::ios::binary };
+    const std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+
+    // read the data points from the standard input
+    const util::redirect_input redirect{ content };
+    const plssvm::data_set<double, int> stream_data{ GetParam() };
+    const plssvm::data_set<double, int> data{ filename };
+
+    // check values
+    EXPECT_EQ(stream_data.data(), data.data());
+    ASSERT_TRUE(stream_data.has_labels());
+    EXPECT_EQ(stream_data.labels().value().get(), data.labels().value().get());
+    EXPECT_EQ(stream_data.num_data_points(), data.num_data_points());
+    EXPECT_EQ(stream_data.num_features(), data.num_features());
+}
+TEST_P(DataSetStandardInput, construct_arff_from_standard_input) {
+    const std::string filename = PLSSVM_TEST_PATH "/data/arff/5x4.arff";
+    std::ifstream in{ filename, std::ios::binary };
+    const std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+
+    // the file format of the standard input must be provided explicitly
+    const util::redirect_input redirect{ content };
+    const plssvm::data_set<double, int> stream_data{ GetParam(), plssvm::file_format_type::arff };
+    const plssvm::data_set<double, int> data{ filename };
+
+    // check values
+    EXPECT_EQ(stream_data.data(), data.data());
+    ASSERT_TRUE(stream_data.has_labels());
+    EXPECT_EQ(stream_data.labels().value().get(), data.labels().value().get());
+}
+INSTANTIATE_TEST_SUITE_P(DataSet, DataSetStandardInput, ::testing::Values("-", "/dev/stdin"));
+
+template <typename T>
+class DataSetCached : public ::testing::Test, private util::redirect_output<>, protected util::temporary_file {
+  protected:
+    void SetUp() override {
+        plssvm::data_set_cache.enabled = true;
+        plssvm::data_set_cache.directory = this->filename + "_cache";
+    }
+    void TearDown() override {
+        std::filesystem::remove_all(plssvm::data_set_cache.directory);
+        plssvm::data_set_cache = plssvm::data_set_cache_options{};
+    }
+
+    /**
+     * @brief Return all entries currently stored in the data set cache.
+     * @return the cache entries (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::vector<std::filesystem::path> cache_entries() const {
+        std::vector<std::filesystem::path> entries{};
+        if (std::filesystem::exists(plssvm::data_set_cache.directory)) {
+            for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator{ plssvm::data_set_cache.directory }) {
+                entries.push_back(entry.path());
+            }
+        }
+        return entries;
+    }
+};
+TYPED_TEST_SUITE(DataSetCached, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(DataSetCached, read_from_cache) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // the first read parses the file and caches the binary image
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> data{ this->filename };
+    const std::vector<std::filesystem::path> entries = this->cache_entries();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries.front().extension(), ".bin");
+
+    // the second read must result in the same data set
+    const plssvm::data_set<real_type, label_type> cached_data{ this->filename };
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(cached_data.data(), correct_data_points<real_type>);
+    ASSERT_TRUE(cached_data.has_labels());
+    EXPECT_EQ(cached_data.labels().value().get(), correct_labels<label_type>());
+    EXPECT_EQ(cached_data.different_labels().value(), correct_different_labels<label_type>());
+    EXPECT_EQ(this->cache_entries(), entries);
+
+    // replace the cached binary image to make sure that it is actually used
+    const std::vector<std::vector<real_type>> other_data = { { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } };
+    plssvm::detail::io::write_binary_data(entries.front().string(), other_data, correct_different_labels<label_type>());
+    const plssvm::data_set<real_type, label_type> other_cached_data{ this->filename };
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(other_cached_data.data(), other_data);
+}
+TYPED_TEST(DataSetCached, read_from_cache_without_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // read the file twice
+    const plssvm::data_set<real_type, label_type> data{ PLSSVM_TEST_PATH "/data/arff/3x2_without_label.arff" };
+    ASSERT_EQ(this->cache_entries().size(), 1);
+    const plssvm::data_set<real_type, label_type> cached_data{ PLSSVM_TEST_PATH "/data/arff/3x2_without_label.arff" };
+
+    // check values
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(cached_data.data(), data.data());
+    EXPECT_FALSE(cached_data.has_labels());
+}
+
+class DataSetCachedRead : public DataSetCached<void> {};
+TEST_F(DataSetCachedRead, disabled) {
+    plssvm::data_set_cache.enabled = false;
+
+    // nothing may be cached
+    const plssvm::data_set<double, int> data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    EXPECT_FALSE(std::filesystem::exists(plssvm::data_set_cache.directory));
+}
+TEST_F(DataSetCachedRead, different_parser_settings) {
+    // the same file parsed using different settings or types must result in different cache entries
+    const plssvm::data_set<double, int> data{ PLSSVM_TEST_PATH "/data/csv/5x4_header.csv", plssvm::csv_options{ ';', true, 0 } };
+    const plssvm::data_set<double, int> data_without_label{ PLSSVM_TEST_PATH "/data/csv/5x4_header.csv", plssvm::csv_options{ ';', true, std::nullopt } };
+    const plssvm::data_set<float, int> float_data{ PLSSVM_TEST_PATH "/data/csv/5x4_header.csv", plssvm::csv_options{ ';', true, 0 } };
+    EXPECT_EQ(this->cache_entries().size(), 3);
+
+    // check values
+    EXPECT_TRUE(data.has_labels());
+    EXPECT_FALSE(data_without_label.has_labels());
+    EXPECT_EQ(data_without_label.num_features(), data.num_features() + 1);
+}
+TEST_F(DataSetCachedRead, binary_files_not_cached) {
+    // binary and NumPy files are already memory mapped
+    const plssvm::data_set<double, int> data{ PLSSVM_TEST_PATH "/data/npy/5x4.npy" };
+    EXPECT_TRUE(this->cache_entries().empty());
+}
+TEST_F(DataSetCachedRead, corrupted_entry) {
+    const plssvm::data_set<double, int> data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    const std::vector<std::filesystem::path> entries = this->cache_entries();
+    ASSERT_EQ(entries.size(), 1);
+
+    // a corrupted cache entry must be replaced
+    std::ofstream{ entries.front() } << "corrupted";
+    const plssvm::data_set<double, int> reparsed_data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    EXPECT_EQ(reparsed_data.data(), data.data());
+    ASSERT_EQ(this->cache_entries(), entries);
+    EXPECT_GT(std::filesystem::file_size(entries.front()), std::string_view{ "corrupted" }.size());
+}
+TEST_F(DataSetCachedRead, too_small_max_size) {
+    plssvm::data_set_cache.max_size = 16;
+
+    // the binary image is larger than the whole cache
+    const plssvm::data_set<double, int> data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    EXPECT_TRUE(this->cache_entries().empty());
+    EXPECT_EQ(data.num_data_points(), 5);
+}
+TEST_F(DataSetCachedRead, insecure_directory) {
+    std::filesystem::create_directories(plssvm::data_set_cache.directory);
+    std::filesystem::permissions(plssvm::data_set_cache.directory, std::filesystem::perms::others_write, std::filesystem::perm_options::add);
+
+    // a cache directory writable by other users must be ignored with a warning
+    util::redirect_output<&std::clog> clog_capture{};
+    const plssvm::data_set<double, int> data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    EXPECT_EQ(data.num_data_points(), 5);
+    EXPECT_TRUE(this->cache_entries().empty());
+    EXPECT_EQ(clog_capture.get_capture(), fmt::format("WARNING: The data set cache directory \"{}\" is writable by other users! The data set cache is not used.\n", plssvm::data_set_cache.directory.string()));
+}
+TEST_F(DataSetCachedRead, different_subsets) {
+    // the same file read using different subsets must result in different cache entries
+    const plssvm::subset_options subset{ { 0, 2 }, 3, plssvm::sampling_type::uniform };
+    const plssvm::data_set<double, int> data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    const plssvm::data_set<double, int> subset_data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm", plssvm::file_format_type::libsvm, subset };
+    EXPECT_EQ(this->cache_entries().size(), 2);
+
+    // the cached subset must be the same as the parsed one
+    const plssvm::data_set<double, int> cached_subset_data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm", plssvm::file_format_type::libsvm, subset };
+    EXPECT_EQ(this->cache_entries().size(), 2);
+    EXPECT_EQ(cached_subset_data.data(), subset_data.data());
+    EXPECT_EQ(cached_subset_data.labels().value().get(), subset_data.labels().value().get());
+    EXPECT_EQ(subset_data.num_data_points(), 3);
+    EXPECT_EQ(subset_data.num_features(), 2);
+}
+
+template <typename T>
+class DataSetSubset : public ::testing::Test, private util::redirect_output<>, protected util::temporary_file {
+  protected:
+    using real_type = typename T::real_type;
+    using label_type = typename T::label_type;
+
+    /**
+     * @brief Read the template file @p template_filename in the file format @p format using the subset of the first and third feature of a stratified sample of three data points
+     *        and check whether the same data points and labels as selected from the whole data set are read.
+     * @param[in] template_filename the template file used to create the data set file
+     * @param[in] format the file format of @p template_filename
+     */
+    void check_subset(const std::string &template_filename, const plssvm::file_format_type format) {
+        const plssvm::subset_options subset{ { 2, 0 }, 3, plssvm::sampling_type::stratified };
+
+        // create data set
+        util::instantiate_template_file<label_type>(template_filename, this->filename);
+        const plssvm::data_set<real_type, label_type> data{ this->filename, format, subset };
+
+        // select the same subset from the whole data set
+        std::vector<std::vector<real_type>> correct_data{ correct_data_points<real_type> };
+        std::vector<label_type> correct_label{ correct_labels<label_type>() };
+        plssvm::detail::io::select_subset(correct_data, correct_label, subset);
+
+        // check values
+        EXPECT_FLOATING_POINT_2D_VECTOR_EQ(data.data(), correct_data);
+        ASSERT_TRUE(data.has_labels());
+        EXPECT_EQ(data.labels().value().get(), correct_label);
+        EXPECT_EQ(data.different_labels().value(), correct_different_labels<label_type>());
+        EXPECT_EQ(data.num_data_points(), 3);
+        EXPECT_EQ(data.num_features(), 2);
+    }
+};
+TYPED_TEST_SUITE(DataSetSubset, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(DataSetSubset, read_libsvm) {
+    this->check_subset(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", plssvm::file_format_type::libsvm);
+}
+TYPED_TEST(DataSetSubset, read_arff) {
+    this->check_subset(PLSSVM_TEST_PATH "/data/arff/5x4_TEMPLATE.arff", plssvm::file_format_type::arff);
+}
+TYPED_TEST(DataSetSubset, read_csv) {
+    this->check_subset(PLSSVM_TEST_PATH "/data/csv/5x4_TEMPLATE.csv", plssvm::file_format_type::csv);
+}
+TYPED_TEST(DataSetSubset, read_and_scale) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set keeping only the last feature and scale it
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> data{ this->filename, plssvm::csv_options{}, plssvm::subset_options{ { 3 }, 0, plssvm::sampling_type::uniform }, { real_type{ -1.0 }, real_type{ 1.0 } } };
+
+    // check values
+    EXPECT_EQ(data.num_data_points(), 5);
+    ASSERT_EQ(data.num_features(), 1);
+    ASSERT_TRUE(data.scaling_factors().has_value());
+    ASSERT_EQ(data.scaling_factors().value().get().scaling_factors.size(), 1);
+    EXPECT_EQ(data.scaling_factors().value().get().scaling_factors.front().feature, 0);
+}
+TYPED_TEST(DataSetSubset, feature_out_of_range) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // the CSV file only has four features
+    this->filename.append(".csv");
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/csv/5x4_TEMPLATE.csv", this->filename);
+    EXPECT_THROW_WHAT((plssvm::data_set<real_type, label_type>{ this->filename, plssvm::csv_options{}, plssvm::subset_options{ { 4 }, 0, plssvm::sampling_type::uniform } }),
+                      plssvm::invalid_file_format_exception,
+                      "Can't keep the feature with index 4 since the data points only have 4 features!");
+}
+
 template <typename TypeParam>
 class DataSetSave : public ::testing::Test, private util::redirect_output<>, protected util::temporary_file {
   protected:
@@ -936,7 +1336,7 @@ TYPED_TEST(DataSetSave, save_invalid_automatic_format) {
     // try to save to temporary file with an unrecognized extension
     EXPECT_THROW_WHAT(data.save("test.txt");,
                       plssvm::data_set_exception,
-                      "Unrecognized file extension for file \"test.txt\" (must be one of: .libsvm or .arff)!");
+                      "Unrecognized file extension for file \"test.txt\" (must be one of: .libsvm, .arff, .bin, .csv, or .npy)!");
 }
 
 TYPED_TEST(DataSetSave, save_libsvm_with_label) {
@@ -1097,6 +1497,91 @@ TYPED_TEST(DataSetSave, save_arff_without_label) {
         EXPECT_TRUE(std::regex_match(std::string{ reader.line(i) }, reg));
     }
 }
+TYPED_TEST(DataSetSave, save_binary_with_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set with labels
+    const plssvm::data_set<real_type, label_type> data{ this->data_points, this->label };
+    // save to temporary file
+    data.save(this->filename, plssvm::file_format_type::binary);
+
+    // read the file again: the binary format must reproduce the data set exactly
+    const plssvm::data_set<real_type, label_type> read_data{ this->filename, plssvm::file_format_type::binary };
+    EXPECT_EQ(read_data.data(), this->data_points);
+    ASSERT_TRUE(read_data.has_labels());
+    EXPECT_EQ(read_data.labels().value().get(), this->label);
+}
+TYPED_TEST(DataSetSave, save_binary_automatic_format) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set with labels
+    const plssvm::data_set<real_type, label_type> data{ this->data_points, this->label };
+    // rename temporary such that it ends with .bin
+    const std::string old_filename = this->filename;
+    this->filename += ".bin";
+    std::filesystem::rename(old_filename, this->filename);
+    // save to temporary file
+    data.save(this->filename);
+
+    // read the file again using the automatic format detection
+    const plssvm::data_set<real_type, label_type> read_data{ this->filename };
+    EXPECT_EQ(read_data.data(), this->data_points);
+    ASSERT_TRUE(read_data.has_labels());
+    EXPECT_EQ(read_data.labels().value().get(), this->label);
+}
+TYPED_TEST(DataSetSave, save_binary_without_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> data{ this->data_points };
+    // save to temporary file
+    data.save(this->filename, plssvm::file_format_type::binary);
+
+    // read the file again
+    const plssvm::data_set<real_type, label_type> read_data{ this->filename, plssvm::file_format_type::binary };
+    EXPECT_EQ(read_data.data(), this->data_points);
+    EXPECT_FALSE(read_data.has_labels());
+}
+TYPED_TEST(DataSetSave, save_csv_automatic_format) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set with labels
+    const plssvm::data_set<real_type, label_type> data{ this->data_points, this->label };
+    // rename temporary such that it ends with .csv
+    const std::string old_filename = this->filename;
+    this->filename += ".csv";
+    std::filesystem::rename(old_filename, this->filename);
+    // save to temporary file
+    data.save(this->filename);
+
+    // read the file again using the automatic format detection
+    const plssvm::data_set<real_type, label_type> read_data{ this->filename };
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(read_data.data(), this->data_points);
+    ASSERT_TRUE(read_data.has_labels());
+    EXPECT_EQ(read_data.labels().value().get(), this->label);
+}
+TYPED_TEST(DataSetSave, save_npy_automatic_format) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set without labels, since the NumPy file format only supports numeric labels
+    const plssvm::data_set<real_type, label_type> data{ this->data_points };
+    // rename temporary such that it ends with .npy
+    const std::string old_filename = this->filename;
+    this->filename += ".npy";
+    std::filesystem::rename(old_filename, this->filename);
+    // save to temporary file
+    data.save(this->filename);
+
+    // read the file again: the NumPy format must reproduce the data points exactly
+    const plssvm::data_set<real_type, label_type> read_data{ this->filename, plssvm::csv_options{ ',', false, std::nullopt } };
+    EXPECT_EQ(read_data.data(), this->data_points);
+    EXPECT_FALSE(read_data.has_labels());
+}
 
 template <typename TypeParam>
 class DataSetGetter : public ::testing::Test, private util::redirect_output<> {
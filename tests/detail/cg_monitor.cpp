@@ -0,0 +1,78 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the progress reporting and cancellation of the CG algorithm.
+ */
+
+#include "plssvm/detail/cg_monitor.hpp"
+
+#include "plssvm/cancellation_token.hpp"  // plssvm::cancellation_token
+#include "plssvm/solver_progress.hpp"     // plssvm::solver_progress
+
+#include "gtest/gtest.h"                  // TEST, EXPECT_EQ, EXPECT_DOUBLE_EQ, EXPECT_TRUE, EXPECT_FALSE, ASSERT_EQ
+
+#include <vector>                         // std::vector
+
+TEST(CancellationToken, default_construct) {
+    const plssvm::cancellation_token token{};
+    EXPECT_FALSE(token.cancellation_requested());
+}
+TEST(CancellationToken, request_cancellation) {
+    const plssvm::cancellation_token token{};
+    token.request_cancellation();
+    EXPECT_TRUE(token.cancellation_requested());
+}
+TEST(CancellationToken, shared_between_copies) {
+    const plssvm::cancellation_token token{};
+    const plssvm::cancellation_token copy{ token };  // NOLINT(performance-unnecessary-copy-initialization)
+    copy.request_cancellation();
+    EXPECT_TRUE(token.cancellation_requested());
+}
+
+TEST(CGMonitor, default_construct) {
+    const plssvm::detail::cg_monitor monitor{};
+    EXPECT_FALSE(monitor.has_callback());
+    EXPECT_FALSE(monitor.token().cancellation_requested());
+    EXPECT_FALSE(monitor.report(1, 10, 0.5, 2.0, 1e-3));
+}
+TEST(CGMonitor, report) {
+    std::vector<plssvm::solver_progress> progress{};
+    const plssvm::detail::cg_monitor monitor{ [&](const plssvm::solver_progress &p) { progress.push_back(p); }, plssvm::cancellation_token{} };
+    EXPECT_TRUE(monitor.has_callback());
+
+    EXPECT_FALSE(monitor.report(3, 10, 0.25, 4.0, 1e-3));
+
+    // the progress must have been reported exactly once with the relative residual
+    ASSERT_EQ(progress.size(), 1);
+    EXPECT_EQ(progress.front().iteration, 3);
+    EXPECT_EQ(progress.front().max_iter, 10);
+    EXPECT_DOUBLE_EQ(progress.front().residual, 0.25);
+    EXPECT_DOUBLE_EQ(progress.front().target_residual, 1e-3);
+}
+TEST(CGMonitor, report_zero_initial_residual) {
+    std::vector<plssvm::solver_progress> progress{};
+    const plssvm::detail::cg_monitor monitor{ [&](const plssvm::solver_progress &p) { progress.push_back(p); }, plssvm::cancellation_token{} };
+
+    EXPECT_FALSE(monitor.report(1, 10, 0.0, 0.0, 1e-3));
+    ASSERT_EQ(progress.size(), 1);
+    EXPECT_DOUBLE_EQ(progress.front().residual, 0.0);
+}
+TEST(CGMonitor, cancel) {
+    const plssvm::cancellation_token token{};
+    const plssvm::detail::cg_monitor monitor{ {}, token };
+
+    EXPECT_FALSE(monitor.report(1, 10, 0.5, 2.0, 1e-3));
+    token.request_cancellation();
+    EXPECT_TRUE(monitor.report(2, 10, 0.5, 2.0, 1e-3));
+}
+TEST(CGMonitor, cancel_from_callback) {
+    const plssvm::cancellation_token token{};
+    const plssvm::detail::cg_monitor monitor{ [&](const plssvm::solver_progress &p) { if (p.iteration == 2) { token.request_cancellation(); } }, token };
+
+    EXPECT_FALSE(monitor.report(1, 10, 0.5, 2.0, 1e-3));
+    EXPECT_TRUE(monitor.report(2, 10, 0.5, 2.0, 1e-3));
+}
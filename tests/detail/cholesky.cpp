@@ -0,0 +1,49 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the small dense Cholesky solver.
+ */
+
+#include "plssvm/detail/cholesky.hpp"
+
+#include "../custom_test_macros.hpp"  // EXPECT_FLOATING_POINT_VECTOR_NEAR
+
+#include "gtest/gtest.h"              // TEST, EXPECT_TRUE, EXPECT_FALSE, EXPECT_NEAR
+
+#include <vector>                     // std::vector
+
+TEST(Cholesky, solve) {
+    // symmetric positive definite matrix
+    std::vector<double> A{ 4.0, 12.0, -16.0,
+                           12.0, 37.0, -43.0,
+                           -16.0, -43.0, 98.0 };
+    // right-hand side for the solution x = [1, -1, 2]
+    std::vector<double> b{ -40.0, -111.0, 223.0 };
+
+    EXPECT_TRUE(plssvm::detail::solve_cholesky(A, b));
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(b, (std::vector<double>{ 1.0, -1.0, 2.0 }));
+}
+TEST(Cholesky, solve_semi_definite) {
+    // the matrix is singular -> regularization is necessary
+    const std::vector<double> A_original{ 1.0, 1.0,
+                                          1.0, 1.0 };
+    std::vector<double> A{ A_original };
+    std::vector<double> b{ 2.0, 2.0 };
+
+    EXPECT_TRUE(plssvm::detail::solve_cholesky(A, b));
+    // the regularized solution must still (nearly) solve the system
+    EXPECT_NEAR(A_original[0] * b[0] + A_original[1] * b[1], 2.0, 1e-6);
+    EXPECT_NEAR(A_original[2] * b[0] + A_original[3] * b[1], 2.0, 1e-6);
+}
+TEST(Cholesky, solve_failure) {
+    // no regularization can be derived from a zero diagonal
+    std::vector<double> A{ 0.0, 0.0,
+                           0.0, 0.0 };
+    std::vector<double> b{ 1.0, 1.0 };
+
+    EXPECT_FALSE(plssvm::detail::solve_cholesky(A, b));
+}
@@ -0,0 +1,298 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the grid search cmd parameter parsing.
+ */
+
+#include "plssvm/detail/cmd/parser_grid.hpp"
+#include "plssvm/detail/logger.hpp"      // plssvm::verbosity
+
+#include "../../custom_test_macros.hpp"  // EXPECT_CONVERSION_TO_STRING
+#include "../../naming.hpp"              // naming::{pretty_print_parameter_flag_and_value, pretty_print_parameter_flag}
+#include "utility.hpp"                   // util::ParameterBase
+
+#include "fmt/core.h"                    // fmt::format
+#include "fmt/format.h"                  // fmt::join
+#include "gmock/gmock-matchers.h"        // ::testing::{StartsWith, HasSubstr}
+#include "gtest/gtest.h"                 // TEST_F, TEST_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_EXIT, EXPECT_DEATH, INSTANTIATE_TEST_SUITE_P,
+                                         // ::testing::WithParamInterface, ::testing::Combine, ::testing::Values, ::testing::Bool, ::testing::ExitedWithCode
+
+#include <cstdlib>                       // EXIT_SUCCESS, EXIT_FAILURE
+#include <string>                        // std::string
+#include <tuple>                         // std::tuple
+#include <vector>                        // std::vector
+
+class ParserGrid : public util::ParameterBase {};
+class ParserGridDeathTest : public util::ParameterBase {};
+
+TEST_F(ParserGrid, minimal) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+
+    // check default values
+    EXPECT_EQ(parser.csvm_params, plssvm::parameter{});
+    EXPECT_TRUE(parser.gamma_values.empty());
+    EXPECT_TRUE(parser.cost_values.empty());
+    EXPECT_TRUE(parser.epsilon.is_default());
+    EXPECT_DOUBLE_EQ(parser.epsilon.value(), 0.001);
+    EXPECT_TRUE(parser.max_iter.is_default());
+    EXPECT_EQ(parser.max_iter.value(), 0);
+    EXPECT_FALSE(parser.strings_as_labels);
+    EXPECT_FALSE(parser.float_as_real_type);
+    EXPECT_EQ(parser.input_filename, "data.libsvm");
+    EXPECT_EQ(parser.validation_filename, "");
+    EXPECT_EQ(parser.model_filename, "data.libsvm.model");
+    EXPECT_EQ(parser.ranking_filename, "");
+    EXPECT_EQ(parser.performance_tracking_filename, "");
+}
+TEST_F(ParserGrid, minimal_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost values: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "validation file (data set): ''\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "output file (ranking): ''\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserGrid, all_arguments) {
+    // create artificial command line arguments in test fixture
+    std::vector<std::string> cmd_args = { "./plssvm-grid", "--kernel_type", "1", "--degree", "2", "--gamma_values", "0.5,1.5", "--coef0", "-1.5", "--cost_values", "2,0.5,8", "--epsilon", "1e-10", "--max_iter", "100", "--validation", "data.libsvm.validation", "--ranking", "data.libsvm.ranking", "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm" };
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+    cmd_args.insert(cmd_args.end(), { "--performance_tracking", "tracking.yaml" });
+#endif
+    cmd_args.insert(cmd_args.end(), { "data.libsvm", "data.libsvm.model" });
+    this->CreateCMDArgs(cmd_args);
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+
+    // check parsed values
+    EXPECT_EQ(parser.csvm_params.kernel_type, plssvm::kernel_function_type::polynomial);
+    EXPECT_EQ(parser.csvm_params.degree, 2);
+    EXPECT_DOUBLE_EQ(parser.csvm_params.coef0, -1.5);
+    EXPECT_EQ(parser.gamma_values, (std::vector<double>{ 0.5, 1.5 }));
+    EXPECT_EQ(parser.cost_values, (std::vector<double>{ 2.0, 0.5, 8.0 }));
+    EXPECT_FALSE(parser.epsilon.is_default());
+    EXPECT_DOUBLE_EQ(parser.epsilon.value(), 1e-10);
+    EXPECT_FALSE(parser.max_iter.is_default());
+    EXPECT_EQ(parser.max_iter.value(), 100);
+    EXPECT_TRUE(parser.strings_as_labels);
+    EXPECT_TRUE(parser.float_as_real_type);
+    EXPECT_EQ(parser.input_filename, "data.libsvm");
+    EXPECT_EQ(parser.validation_filename, "data.libsvm.validation");
+    EXPECT_EQ(parser.model_filename, "data.libsvm.model");
+    EXPECT_EQ(parser.ranking_filename, "data.libsvm.ranking");
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+    EXPECT_EQ(parser.performance_tracking_filename, "tracking.yaml");
+#else
+    EXPECT_EQ(parser.performance_tracking_filename, "");
+#endif
+    EXPECT_EQ(plssvm::verbosity, plssvm::verbosity_level::libsvm);
+}
+TEST_F(ParserGrid, all_arguments_output) {
+    // create artificial command line arguments in test fixture
+    std::vector<std::string> cmd_args = { "./plssvm-grid", "--kernel_type", "1", "--degree", "2", "--gamma_values", "0.5,1.5", "--coef0", "-1.5", "--cost_values", "2,0.5,8", "--epsilon", "1e-10", "--max_iter", "100", "--validation", "data.libsvm.validation", "--ranking", "data.libsvm.ranking", "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm" };
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+    cmd_args.insert(cmd_args.end(), { "--performance_tracking", "tracking.yaml" });
+#endif
+    cmd_args.insert(cmd_args.end(), { "data.libsvm", "data.libsvm.model" });
+    this->CreateCMDArgs(cmd_args);
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: polynomial -> (gamma*u'*v+coef0)^degree\n"
+        "coef0: -1.5\n"
+        "degree: 2\n"
+        "gamma values: [0.5, 1.5]\n"
+        "cost values: [2, 0.5, 8]\n"
+        "epsilon: 1e-10\n"
+        "max_iter: 100\n"
+        "label_type: std::string\n"
+        "real_type: float\n"
+        "input file (data set): 'data.libsvm'\n"
+        "validation file (data set): 'data.libsvm.validation'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "output file (ranking): 'data.libsvm.ranking'\n"
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+        "performance tracking file: 'tracking.yaml'\n";
+#else
+        "performance tracking file: ''\n";
+#endif
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+    EXPECT_EQ(plssvm::verbosity, plssvm::verbosity_level::libsvm);
+}
+
+// test all command line parameter separately
+class ParserGridGammaValues : public ParserGrid, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserGridGammaValues, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(fmt::format("{}", fmt::join(parser.gamma_values, ",")), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserGrid, ParserGridGammaValues, ::testing::Combine(
+                ::testing::Values("-g", "--gamma_values"),
+                ::testing::Values("0.001", "0.5,1.5", "0.01,0.1,1,10")),
+                naming::pretty_print_parameter_flag_and_value<ParserGridGammaValues>);
+// clang-format on
+
+class ParserGridCostValues : public ParserGrid, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserGridCostValues, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(fmt::format("{}", fmt::join(parser.cost_values, ",")), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserGrid, ParserGridCostValues, ::testing::Combine(
+                ::testing::Values("-c", "--cost_values"),
+                ::testing::Values("1", "0.5,2", "0.1,1,10,100")),
+                naming::pretty_print_parameter_flag_and_value<ParserGridCostValues>);
+// clang-format on
+
+class ParserGridMaxIter : public ParserGrid, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserGridMaxIter, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.max_iter, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserGrid, ParserGridMaxIter, ::testing::Combine(
+                ::testing::Values("-i", "--max_iter"),
+                ::testing::Values(1, 10, 100, 1000, 10000)),
+                naming::pretty_print_parameter_flag_and_value<ParserGridMaxIter>);
+// clang-format on
+
+class ParserGridValidationFilename : public ParserGrid, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserGridValidationFilename, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.validation_filename, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserGrid, ParserGridValidationFilename, ::testing::Combine(
+                ::testing::Values("--validation"),
+                ::testing::Values("data.libsvm.validation", "test.txt")),
+                naming::pretty_print_parameter_flag_and_value<ParserGridValidationFilename>);
+// clang-format on
+
+class ParserGridRankingFilename : public ParserGrid, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserGridRankingFilename, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_grid parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.ranking_filename, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserGrid, ParserGridRankingFilename, ::testing::Combine(
+                ::testing::Values("--ranking"),
+                ::testing::Values("data.libsvm.ranking", "test.txt")),
+                naming::pretty_print_parameter_flag_and_value<ParserGridRankingFilename>);
+// clang-format on
+
+class ParserGridHelp : public ParserGrid, public ::testing::WithParamInterface<std::string> {};
+TEST_P(ParserGridHelp, parsing) {
+    const std::string &flag = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", flag });
+    // create parameter object
+    EXPECT_EXIT((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }), ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+}
+INSTANTIATE_TEST_SUITE_P(ParserGrid, ParserGridHelp, ::testing::Values("-h", "--help"), naming::pretty_print_parameter_flag<ParserGridHelp>);
+
+class ParserGridVersion : public ParserGrid, public ::testing::WithParamInterface<std::string> {};
+TEST_P(ParserGridVersion, parsing) {
+    const std::string &flag = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-grid", flag });
+    // create parameter object
+    EXPECT_EXIT((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }), ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+}
+INSTANTIATE_TEST_SUITE_P(ParserGrid, ParserGridVersion, ::testing::Values("-v", "--version"), naming::pretty_print_parameter_flag<ParserGridVersion>);
+
+TEST_F(ParserGridDeathTest, no_positional_argument) {
+    this->CreateCMDArgs({ "./plssvm-grid" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::StartsWith("Error missing input file!"));
+}
+TEST_F(ParserGridDeathTest, too_many_positional_arguments) {
+    this->CreateCMDArgs({ "./plssvm-grid", "p1", "p2", "p3", "p4" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr(R"(Only up to two positional options may be given, but 2 ("p3 p4") additional option(s) where provided!)"));
+}
+TEST_F(ParserGridDeathTest, illegal_gamma_value) {
+    this->CreateCMDArgs({ "./plssvm-grid", "--gamma_values", "0.1,-0.1", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("gamma must be greater than 0.0, but is -0.1!"));
+}
+TEST_F(ParserGridDeathTest, illegal_cost_value) {
+    this->CreateCMDArgs({ "./plssvm-grid", "--cost_values", "0.0,1.0", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("cost must be greater than 0.0, but is 0!"));
+}
+TEST_F(ParserGridDeathTest, illegal_max_iter) {
+    this->CreateCMDArgs({ "./plssvm-grid", "--max_iter", "0", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("max_iter must be greater than 0, but is 0!"));
+}
+
+// test whether nonsensical cmd arguments trigger the assertions
+TEST_F(ParserGridDeathTest, too_few_argc) {
+    EXPECT_DEATH((plssvm::detail::cmd::parser_grid{ 0, nullptr }),
+                 ::testing::HasSubstr("At least one argument is always given (the executable name), but argc is 0!"));
+}
+TEST_F(ParserGridDeathTest, nullptr_argv) {
+    EXPECT_DEATH((plssvm::detail::cmd::parser_grid{ 1, nullptr }),
+                 ::testing::HasSubstr("At least one argument is always given (the executable name), but argv is a nullptr!"));
+}
+TEST_F(ParserGridDeathTest, unrecognized_option) {
+    this->CreateCMDArgs({ "./plssvm-grid", "--foo", "bar" });
+    EXPECT_DEATH((plssvm::detail::cmd::parser_grid{ this->argc, this->argv }), "");
+}
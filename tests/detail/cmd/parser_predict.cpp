@@ -21,6 +21,7 @@
 #include "gtest/gtest.h"                 // TEST_F, TEST_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_EXIT, EXPECT_DEATH, INSTANTIATE_TEST_SUITE_P,
                                          // ::testing::WithParamInterface, ::testing::Combine, ::testing::Values, ::testing::Bool, ::testing::ExitedWithCode
 
+#include <cstddef>                       // std::size_t
 #include <cstdlib>                       // EXIT_SUCCESS, EXIT_FAILURE
 #include <string>                        // std::string
 #include <tuple>                         // std::tuple
@@ -44,6 +45,8 @@ TEST_F(ParserPredict, minimal) {
     EXPECT_EQ(parser.input_filename, "data.libsvm");
     EXPECT_EQ(parser.model_filename, "data.libsvm.model");
     EXPECT_EQ(parser.predict_filename, "data.libsvm.predict");
+    EXPECT_EQ(parser.chunk_size, 0);
+    EXPECT_EQ(parser.max_memory, 0);
     EXPECT_EQ(parser.performance_tracking_filename, "");
 }
 TEST_F(ParserPredict, minimal_output) {
@@ -60,13 +63,15 @@ TEST_F(ParserPredict, minimal_output) {
         "input file (data set): 'data.libsvm'\n"
         "input file (model): 'data.libsvm.model'\n"
         "output file (prediction): 'data.libsvm.predict'\n"
+        "chunk size (data points): 0\n"
+        "memory limit (MiB): 0\n"
         "performance tracking file: ''\n";
     EXPECT_CONVERSION_TO_STRING(parser, correct);
 }
 
 TEST_F(ParserPredict, all_arguments) {
     // create artificial command line arguments in test fixture
-    std::vector<std::string> cmd_args = { "./plssvm-predict", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm" };
+    std::vector<std::string> cmd_args = { "./plssvm-predict", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--chunk_size", "1024", "--max_memory", "512", "--verbosity", "libsvm" };
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
     cmd_args.insert(cmd_args.end(), { "--sycl_implementation_type", "dpcpp" });
 #endif
@@ -97,11 +102,13 @@ TEST_F(ParserPredict, all_arguments) {
     EXPECT_EQ(parser.input_filename, "data.libsvm");
     EXPECT_EQ(parser.model_filename, "data.libsvm.model");
     EXPECT_EQ(parser.predict_filename, "data.libsvm.predict");
+    EXPECT_EQ(parser.chunk_size, 1024);
+    EXPECT_EQ(parser.max_memory, 512);
     EXPECT_EQ(plssvm::verbosity, plssvm::verbosity_level::libsvm);
 }
 TEST_F(ParserPredict, all_arguments_output) {
     // create artificial command line arguments in test fixture
-    std::vector<std::string> cmd_args = { "./plssvm-predict", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm" };
+    std::vector<std::string> cmd_args = { "./plssvm-predict", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--chunk_size", "1024", "--max_memory", "512", "--verbosity", "libsvm" };
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
     cmd_args.insert(cmd_args.end(), { "--sycl_implementation_type", "dpcpp" });
 #endif
@@ -121,6 +128,8 @@ TEST_F(ParserPredict, all_arguments_output) {
         "input file (data set): 'data.libsvm'\n"
         "input file (model): 'data.libsvm.model'\n"
         "output file (prediction): 'data.libsvm.predict'\n"
+        "chunk size (data points): 1024\n"
+        "memory limit (MiB): 512\n"
 #if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
         "performance tracking file: 'tracking.yaml'\n";
 #else
@@ -247,6 +256,40 @@ INSTANTIATE_TEST_SUITE_P(ParserPredict, ParserPredictUseFloatAsRealType, ::testi
                 naming::pretty_print_parameter_flag_and_value<ParserPredictUseFloatAsRealType>);
 // clang-format on
 
+class ParserPredictChunkSize : public ParserPredict, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserPredictChunkSize, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-predict", flag, fmt::format("{}", value), "data.libsvm", "data.libsvm.model" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_predict parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.chunk_size, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserPredict, ParserPredictChunkSize, ::testing::Combine(
+                ::testing::Values("--chunk_size"),
+                ::testing::Values(0, 1, 1000000)),
+                naming::pretty_print_parameter_flag_and_value<ParserPredictChunkSize>);
+// clang-format on
+
+class ParserPredictMaxMemory : public ParserPredict, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserPredictMaxMemory, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-predict", flag, fmt::format("{}", value), "data.libsvm", "data.libsvm.model" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_predict parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.max_memory, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserPredict, ParserPredictMaxMemory, ::testing::Combine(
+                ::testing::Values("--max_memory"),
+                ::testing::Values(0, 64, 4096)),
+                naming::pretty_print_parameter_flag_and_value<ParserPredictMaxMemory>);
+// clang-format on
+
 class ParserPredictVerbosity : public ParserPredict, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
 TEST_P(ParserPredictVerbosity, parsing) {
     const auto &[flag, value] = GetParam();
@@ -325,6 +368,22 @@ TEST_F(ParserPredict, too_many_positional_arguments) {
                 ::testing::HasSubstr(R"(Only up to three positional options may be given, but 1 ("p4") additional option(s) where provided!)"));
 }
 
+class ParserPredictChunkedNonLIBSVMFile : public ParserPredict, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserPredictChunkedNonLIBSVMFile, parsing) {
+    const auto &[flag, filename] = GetParam();
+    // only LIBSVM files can be predicted in chunks
+    this->CreateCMDArgs({ "./plssvm-predict", flag, "64", filename, "data.libsvm.model" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_predict{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr(fmt::format("Predicting in chunks (--chunk_size or --max_memory) is only supported for LIBSVM files, but '{}' was given!", filename)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserPredict, ParserPredictChunkedNonLIBSVMFile, ::testing::Combine(
+                ::testing::Values("--chunk_size", "--max_memory"),
+                ::testing::Values("data.arff", "data.bin")),
+                naming::pretty_print_parameter_flag_and_value<ParserPredictChunkedNonLIBSVMFile>);
+// clang-format on
+
 // test whether nonsensical cmd arguments trigger the assertions
 TEST_F(ParserPredictDeathTest, too_few_argc) {
     EXPECT_DEATH((plssvm::detail::cmd::parser_predict{ 0, nullptr }),
@@ -9,22 +9,30 @@
  */
 
 #include "plssvm/detail/cmd/parser_train.hpp"
-#include "plssvm/detail/logger.hpp"      // plssvm::verbosity
 
-#include "../../custom_test_macros.hpp"  // EXPECT_CONVERSION_TO_STRING
-#include "../../naming.hpp"              // naming::{pretty_print_parameter_flag_and_value, pretty_print_parameter_flag}
-#include "../../utility.hpp"             // util::convert_from_string
-#include "utility.hpp"                   // util::ParameterBase
+#include "plssvm/backend_types.hpp"             // plssvm::backend_type, plssvm::determine_default_backend
+#include "plssvm/detail/io/data_set_cache.hpp"  // plssvm::data_set_cache_options
+#include "plssvm/detail/logger.hpp"             // plssvm::verbosity
+#include "plssvm/sampling_types.hpp"            // plssvm::sampling_type
 
-#include "fmt/core.h"                    // fmt::format
-#include "gmock/gmock-matchers.h"        // ::testing::{StartsWith, HasSubstr}
-#include "gtest/gtest.h"                 // TEST_F, TEST_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_EXIT, EXPECT_DEATH, INSTANTIATE_TEST_SUITE_P,
-                                         // ::testing::WithParamInterface, ::testing::Combine, ::testing::Values, ::testing::Range, ::testing::Bool, ::testing::ExitedWithCode
+#include "../../custom_test_macros.hpp"         // EXPECT_CONVERSION_TO_STRING
+#include "../../naming.hpp"                     // naming::{pretty_print_parameter_flag_and_value, pretty_print_parameter_flag}
+#include "../../utility.hpp"                    // util::convert_from_string
+#include "utility.hpp"                          // util::ParameterBase
 
-#include <cstddef>                       // std::size_t
-#include <cstdlib>                       // EXIT_SUCCESS, EXIT_FAILURE
-#include <string>                        // std::string
-#include <tuple>                         // std::tuple
+#include "fmt/core.h"                           // fmt::format
+#include "gmock/gmock-matchers.h"               // ::testing::{StartsWith, HasSubstr}
+#include "gtest/gtest.h"                        // TEST_F, TEST_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_EXIT, EXPECT_DEATH, INSTANTIATE_TEST_SUITE_P,
+                                                // ::testing::WithParamInterface, ::testing::Combine, ::testing::Values, ::testing::Range, ::testing::Bool, ::testing::ExitedWithCode
+
+#include <cstddef>                              // std::size_t
+#include <cstdint>                              // std::uintmax_t
+#include <cstdlib>                              // EXIT_SUCCESS, EXIT_FAILURE
+#include <filesystem>                           // std::filesystem::path
+#include <optional>                             // std::optional
+#include <string>                               // std::string
+#include <tuple>                                // std::tuple
+#include <vector>                               // std::vector
 
 class ParserTrain : public util::ParameterBase {};
 class ParserTrainDeathTest : public util::ParameterBase {};
@@ -38,14 +46,48 @@ TEST_F(ParserTrain, minimal) {
 
     // check parsed values
     EXPECT_EQ(parser.csvm_params, plssvm::parameter{});
+    EXPECT_TRUE(parser.cost_path.empty());
     EXPECT_TRUE(parser.epsilon.is_default());
     EXPECT_DOUBLE_EQ(parser.epsilon.value(), 0.001);
     EXPECT_TRUE(parser.max_iter.is_default());
     EXPECT_EQ(parser.max_iter.value(), 0);
+    EXPECT_EQ(parser.solver, plssvm::solver_type::cg);
+    EXPECT_TRUE(parser.solver_state_filename.empty());
+    EXPECT_EQ(parser.checkpoint_interval, 0);
+    EXPECT_FALSE(parser.resume);
+    EXPECT_TRUE(parser.checkpoint_filename.empty());
+    EXPECT_FALSE(parser.append);
+    EXPECT_FALSE(parser.loo);
+    EXPECT_TRUE(parser.loo_probes.is_default());
+    EXPECT_EQ(parser.loo_probes.value(), 10);
+    EXPECT_EQ(parser.cross_validation, 0);
+    EXPECT_EQ(parser.num_partitions, 1);
+    EXPECT_EQ(parser.num_landmarks, 0);
+    EXPECT_EQ(parser.landmark_selection, plssvm::landmark_selection_type::uniform);
+    EXPECT_EQ(parser.prune_to, 0);
+    EXPECT_TRUE(parser.prune_fraction.is_default());
+    EXPECT_DOUBLE_EQ(parser.prune_fraction.value(), 0.05);
+    EXPECT_TRUE(parser.max_accuracy_drop.is_default());
+    EXPECT_DOUBLE_EQ(parser.max_accuracy_drop.value(), 1.0);
+    EXPECT_EQ(parser.reduce_to, 0);
+    EXPECT_TRUE(parser.reduce_tolerance.is_default());
+    EXPECT_DOUBLE_EQ(parser.reduce_tolerance.value(), 1.0);
     EXPECT_EQ(parser.backend, plssvm::backend_type::automatic);
     EXPECT_EQ(parser.target, plssvm::target_platform::automatic);
+    EXPECT_EQ(parser.hodlr_tolerance, 0.0);
+    EXPECT_EQ(parser.rbf_cutoff, 0.0);
     EXPECT_EQ(parser.sycl_kernel_invocation_type, plssvm::sycl::kernel_invocation_type::automatic);
     EXPECT_EQ(parser.sycl_implementation_type, plssvm::sycl::implementation_type::automatic);
+    EXPECT_EQ(parser.input_options.delimiter, ',');
+    EXPECT_FALSE(parser.input_options.has_header);
+    EXPECT_EQ(parser.input_options.label_column, std::optional<long long>{ -1 });
+    EXPECT_FALSE(parser.cache_options.enabled);
+    EXPECT_TRUE(parser.cache_options.directory.empty());
+    EXPECT_EQ(parser.cache_options.max_size, plssvm::data_set_cache_options{}.max_size);
+    EXPECT_FALSE(parser.cache_options.fingerprint);
+    EXPECT_TRUE(parser.subset.features.empty());
+    EXPECT_EQ(parser.subset.num_samples, 0);
+    EXPECT_EQ(parser.subset.sampling, plssvm::sampling_type::uniform);
     EXPECT_FALSE(parser.strings_as_labels);
     EXPECT_FALSE(parser.float_as_real_type);
     EXPECT_EQ(parser.input_filename, "data.libsvm");
@@ -265,201 +307,1297 @@ INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCost, ::testing::Combine(
                 naming::pretty_print_parameter_flag_and_value<ParserTrainCost>);
 // clang-format on
 
-class ParserTrainEpsilon : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
-TEST_P(ParserTrainEpsilon, parsing) {
-    const auto &[flag, eps] = GetParam();
+class ParserTrainCostPath : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainCostPath, parsing) {
+    const auto &[flag, value] = GetParam();
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", eps), "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
     // test for correctness
-    EXPECT_FALSE(parser.epsilon.is_default());
-    EXPECT_DOUBLE_EQ(parser.epsilon, eps);
+    EXPECT_TRUE(parser.csvm_params.cost.is_default());
+    EXPECT_EQ(fmt::format("{}", fmt::join(parser.cost_path, ",")), value);
 }
 // clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainEpsilon, ::testing::Combine(
-                ::testing::Values("-e", "--epsilon"),
-                ::testing::Values(10.0, 1.0, 0.0, 0.1, 0.01, 0.001, 0.0001, 0.00001)),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainEpsilon>);
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCostPath, ::testing::Combine(
+                ::testing::Values("--cost_path"),
+                ::testing::Values("1", "0.5,2", "0.1,1,10,100")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCostPath>);
 // clang-format on
-
-class ParserTrainMaxIter : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
-TEST_P(ParserTrainMaxIter, parsing) {
-    const auto &[flag, max_iter] = GetParam();
+TEST_F(ParserTrain, cost_path_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", max_iter), "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--cost_path", "0.5,2", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_FALSE(parser.max_iter.is_default());
-    EXPECT_EQ(parser.max_iter, max_iter);
-}
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainMaxIter, ::testing::Combine(
-                ::testing::Values("-i", "--max_iter"),
-                ::testing::Values(1, 10, 100, 1000, 10000)),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainMaxIter>);
-// clang-format on
 
-class ParserTrainMaxIterDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
-TEST_P(ParserTrainMaxIterDeathTest, max_iter_explicit_less_or_equal_to_zero) {
-    const auto &[flag, max_iter] = GetParam();
-    // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", max_iter), "data.libsvm" });
-    // create parameter object
-    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("max_iter must be greater than 0, but is {}!", max_iter)));
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost path: [0.5, 2]\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
 }
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainMaxIterDeathTest, ::testing::Combine(
-                ::testing::Values("-i", "--max_iter"),
-                ::testing::Values(-100, -10, -1, 0)),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainMaxIterDeathTest>);
-// clang-format on
 
-class ParserTrainBackend : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
-TEST_P(ParserTrainBackend, parsing) {
-    const auto &[flag, value] = GetParam();
-    // convert string to backend
-    const auto backend = util::convert_from_string<plssvm::backend_type>(value);
+TEST_F(ParserTrain, loo_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--loo", "--loo_probes", "5", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(parser.backend, backend);
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "leave-one-out: true (5 probing vectors)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
 }
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainBackend, ::testing::Combine(
-                ::testing::Values("-b", "--backend"),
-                ::testing::Values("automatic", "OpenMP", "CUDA", "HIP", "OpenCL", "SYCL")),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainBackend>);
-// clang-format on
 
-class ParserTrainTargetPlatform : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
-TEST_P(ParserTrainTargetPlatform, parsing) {
-    const auto &[flag, value] = GetParam();
-    // convert string to target_platform
-    const auto target_platform = util::convert_from_string<plssvm::target_platform>(value);
+TEST_F(ParserTrain, csv_options_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--csv_delimiter", ";", "--csv_header", "--csv_label_column", "none", "data.csv" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(parser.target, target_platform);
-}
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainTargetPlatform, ::testing::Combine(
-                ::testing::Values("-p", "--target_platform"),
-                ::testing::Values("automatic", "cpu", "gpu_nvidia", "gpu_amd", "gpu_intel")),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainTargetPlatform>);
-// clang-format on
 
-#if defined(PLSSVM_HAS_SYCL_BACKEND)
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "CSV options: delimiter ';', header: true, label column: none\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.csv'\n"
+        "output file (model): 'data.csv.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
 
-class ParserTrainSYCLKernelInvocation : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
-TEST_P(ParserTrainSYCLKernelInvocation, parsing) {
-    const auto &[flag, value] = GetParam();
-    // convert string to sycl::kernel_invocation_type
-    const auto sycl_kernel_invocation_type = util::convert_from_string<plssvm::sycl::kernel_invocation_type>(value);
+TEST_F(ParserTrain, data_set_cache_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--cache_dir", "cache", "--cache_max_size", "16", "--cache_fingerprint", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(parser.sycl_kernel_invocation_type, sycl_kernel_invocation_type);
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "data set cache: 'cache' (max size: 16777216 bytes, fingerprint: true)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
 }
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSYCLKernelInvocation, ::testing::Combine(
-                ::testing::Values("--sycl_kernel_invocation_type"),
-                ::testing::Values("automatic", "nd_range", "ND_RANGE", "hierarchical")),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainSYCLKernelInvocation>);
-// clang-format on
 
-class ParserTrainSYCLImplementation : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
-TEST_P(ParserTrainSYCLImplementation, parsing) {
-    const auto &[flag, value] = GetParam();
-    // convert string to sycl::implementation_type
-    const auto sycl_implementation_type = util::convert_from_string<plssvm::sycl::implementation_type>(value);
+TEST_F(ParserTrain, data_set_subset_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--features", "0-3,7", "--sample_size", "100", "--sampling", "stratified", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(parser.sycl_implementation_type, sycl_implementation_type);
-}
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSYCLImplementation, ::testing::Combine(
-                ::testing::Values("--sycl_implementation_type"),
-                ::testing::Values("automatic", "hipSYCL", "DPCPP")),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainSYCLImplementation>);
-// clang-format on
-
-#endif  // PLSSVM_HAS_SYCL_BACKEND
 
-#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "data set subset: features: 0-3,7, samples: 100 (stratified)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
 
-class ParserTrainPerformanceTrackingFilename : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
-TEST_P(ParserTrainPerformanceTrackingFilename, parsing) {
-    const auto &[flag, value] = GetParam();
+TEST_F(ParserTrain, cross_validation_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--cross_validation", "5", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(parser.performance_tracking_filename, value);
-}
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainPerformanceTrackingFilename, ::testing::Combine(
-                ::testing::Values("--performance_tracking"),
-                ::testing::Values("tracking.yaml", "test.txt")),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainPerformanceTrackingFilename>);
-// clang-format on
 
-#endif  // PLSSVM_PERFORMANCE_TRACKER_ENABLED
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "cross-validation: 5 folds\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
 
-class ParserTrainUseStringsAsLabels : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
-TEST_P(ParserTrainUseStringsAsLabels, parsing) {
-    const auto &[flag, value] = GetParam();
+TEST_F(ParserTrain, solver_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--solver", "single_reduction_cg", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(parser.strings_as_labels, value);
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "solver: single_reduction_cg\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
 }
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainUseStringsAsLabels, ::testing::Combine(
-                ::testing::Values("--use_strings_as_labels"),
-                ::testing::Bool()),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainUseStringsAsLabels>);
-// clang-format on
 
-class ParserTrainUseFloatAsRealType : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
-TEST_P(ParserTrainUseFloatAsRealType, parsing) {
-    const auto &[flag, value] = GetParam();
+TEST_F(ParserTrain, solver_state_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--solver_state", "data.state", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(parser.float_as_real_type, value);
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "solver state file: 'data.state'\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
 }
-// clang-format off
-INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainUseFloatAsRealType, ::testing::Combine(
-                ::testing::Values("--use_float_as_real_type"),
-                ::testing::Bool()),
-                naming::pretty_print_parameter_flag_and_value<ParserTrainUseFloatAsRealType>);
-// clang-format on
 
-class ParserTrainVerbosity : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
-TEST_P(ParserTrainVerbosity, parsing) {
-    const auto &[flag, value] = GetParam();
+TEST_F(ParserTrain, checkpoint_output) {
     // create artificial command line arguments in test fixture
-    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    this->CreateCMDArgs({ "./plssvm-train", "--checkpoint_interval", "50", "--resume", "data.libsvm" });
+
     // create parameter object
     const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
-    // test for correctness
-    EXPECT_EQ(fmt::format("{}", plssvm::verbosity), value);
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "checkpoint interval: 50 iterations\n"
+        "resume: true\n"
+        "checkpoint file: 'data.libsvm.model.checkpoint'\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTrain, reduce_to_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--reduce_to", "100", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "support vector reduction: 100 support vectors (tolerance: 1 (default))\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTrain, prune_to_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--prune_to", "100", "--max_accuracy_drop", "0.01", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "sparse LS-SVM: 100 support vectors (prune fraction: 0.05 (default), max accuracy drop: 0.01)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTrain, append_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--append", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "append: true\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTrain, num_partitions_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--num_partitions", "8", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "cascade training: 8 partitions\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTrain, num_landmarks_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--num_landmarks", "100", "--landmark_selection", "kmeans++", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "fixed-size LS-SVM: 100 landmarks (kmeans++ selection)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTrain, hodlr_tolerance_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "openmp", "--hodlr_tolerance", "1e-06", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: linear -> u'*v\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "HODLR tolerance: 1e-06\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTrain, rbf_cutoff_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "openmp", "--kernel_type", "2", "--gamma", "0.5", "--rbf_cutoff", "1e-08", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_type: rbf -> exp(-gamma*|u-v|^2)\n"
+        "gamma: 0.5\n"
+        "cost: 1 (default)\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "rbf cutoff: 1e-08\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (model): 'data.libsvm.model'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+class ParserTrainEpsilon : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainEpsilon, parsing) {
+    const auto &[flag, eps] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", eps), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_FALSE(parser.epsilon.is_default());
+    EXPECT_DOUBLE_EQ(parser.epsilon, eps);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainEpsilon, ::testing::Combine(
+                ::testing::Values("-e", "--epsilon"),
+                ::testing::Values(10.0, 1.0, 0.0, 0.1, 0.01, 0.001, 0.0001, 0.00001)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainEpsilon>);
+// clang-format on
+
+class ParserTrainMaxIter : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainMaxIter, parsing) {
+    const auto &[flag, max_iter] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", max_iter), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_FALSE(parser.max_iter.is_default());
+    EXPECT_EQ(parser.max_iter, max_iter);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainMaxIter, ::testing::Combine(
+                ::testing::Values("-i", "--max_iter"),
+                ::testing::Values(1, 10, 100, 1000, 10000)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainMaxIter>);
+// clang-format on
+
+class ParserTrainMaxIterDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainMaxIterDeathTest, max_iter_explicit_less_or_equal_to_zero) {
+    const auto &[flag, max_iter] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", max_iter), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("max_iter must be greater than 0, but is {}!", max_iter)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainMaxIterDeathTest, ::testing::Combine(
+                ::testing::Values("-i", "--max_iter"),
+                ::testing::Values(-100, -10, -1, 0)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainMaxIterDeathTest>);
+// clang-format on
+
+class ParserTrainLOO : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainLOO, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.loo, value);
+}
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainLOO, ::testing::Combine(::testing::Values("--loo"), ::testing::Bool()), naming::pretty_print_parameter_flag_and_value<ParserTrainLOO>);
+
+class ParserTrainLOOProbes : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainLOOProbes, parsing) {
+    const auto &[flag, loo_probes] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", loo_probes), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_FALSE(parser.loo_probes.is_default());
+    EXPECT_EQ(parser.loo_probes, loo_probes);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainLOOProbes, ::testing::Combine(
+                ::testing::Values("--loo_probes"),
+                ::testing::Values(1, 2, 10, 100)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainLOOProbes>);
+// clang-format on
+
+class ParserTrainLOOProbesDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainLOOProbesDeathTest, loo_probes_explicit_less_or_equal_to_zero) {
+    const auto &[flag, loo_probes] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", loo_probes), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("loo_probes must be greater than 0, but is {}!", loo_probes)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainLOOProbesDeathTest, ::testing::Combine(
+                ::testing::Values("--loo_probes"),
+                ::testing::Values(-10, -1, 0)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainLOOProbesDeathTest>);
+// clang-format on
+
+class ParserTrainCrossValidation : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainCrossValidation, parsing) {
+    const auto &[flag, num_folds] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", num_folds), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.cross_validation, num_folds);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCrossValidation, ::testing::Combine(
+                ::testing::Values("--cross_validation"),
+                ::testing::Values(2, 5, 10)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCrossValidation>);
+// clang-format on
+
+class ParserTrainCrossValidationDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainCrossValidationDeathTest, cross_validation_explicit_less_than_two) {
+    const auto &[flag, num_folds] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", num_folds), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("cross_validation must be at least 2, but is {}!", num_folds)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainCrossValidationDeathTest, ::testing::Combine(
+                ::testing::Values("--cross_validation"),
+                ::testing::Values(-1, 0, 1)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCrossValidationDeathTest>);
+// clang-format on
+
+class ParserTrainNumPartitions : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainNumPartitions, parsing) {
+    const auto &[flag, num_partitions] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", num_partitions), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.num_partitions, num_partitions);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainNumPartitions, ::testing::Combine(
+                ::testing::Values("--num_partitions"),
+                ::testing::Values(1, 4, 16)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainNumPartitions>);
+// clang-format on
+
+class ParserTrainNumPartitionsDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainNumPartitionsDeathTest, num_partitions_explicit_less_or_equal_to_zero) {
+    const auto &[flag, num_partitions] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", num_partitions), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("num_partitions must be greater than 0, but is {}!", num_partitions)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainNumPartitionsDeathTest, ::testing::Combine(
+                ::testing::Values("--num_partitions"),
+                ::testing::Values(-1, 0)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainNumPartitionsDeathTest>);
+// clang-format on
+
+class ParserTrainNumLandmarks : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainNumLandmarks, parsing) {
+    const auto &[flag, num_landmarks] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", num_landmarks), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.num_landmarks, num_landmarks);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainNumLandmarks, ::testing::Combine(
+                ::testing::Values("--num_landmarks"),
+                ::testing::Values(2, 100, 1000)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainNumLandmarks>);
+// clang-format on
+
+class ParserTrainNumLandmarksDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainNumLandmarksDeathTest, num_landmarks_explicit_less_than_two) {
+    const auto &[flag, num_landmarks] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", num_landmarks), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("num_landmarks must be at least 2, but is {}!", num_landmarks)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainNumLandmarksDeathTest, ::testing::Combine(
+                ::testing::Values("--num_landmarks"),
+                ::testing::Values(-1, 0, 1)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainNumLandmarksDeathTest>);
+// clang-format on
+
+class ParserTrainPruneTo : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainPruneTo, parsing) {
+    const auto &[flag, prune_to] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", prune_to), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.prune_to, prune_to);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainPruneTo, ::testing::Combine(
+                ::testing::Values("--prune_to"),
+                ::testing::Values(2, 100, 1000)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainPruneTo>);
+// clang-format on
+
+class ParserTrainPruneToDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainPruneToDeathTest, prune_to_explicit_less_than_two) {
+    const auto &[flag, prune_to] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", prune_to), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("prune_to must be at least 2, but is {}!", prune_to)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainPruneToDeathTest, ::testing::Combine(
+                ::testing::Values("--prune_to"),
+                ::testing::Values(-1, 0, 1)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainPruneToDeathTest>);
+// clang-format on
+
+class ParserTrainPruneFraction : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainPruneFraction, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--prune_to", "10", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_FALSE(parser.prune_fraction.is_default());
+    EXPECT_DOUBLE_EQ(parser.prune_fraction.value(), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainPruneFraction, ::testing::Combine(
+                ::testing::Values("--prune_fraction"),
+                ::testing::Values(0.01, 0.1, 0.5)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainPruneFraction>);
+// clang-format on
+
+class ParserTrainPruneFractionDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainPruneFractionDeathTest, prune_fraction_out_of_range) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--prune_to", "10", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("prune_fraction must be in the range (0.0, 1.0), but is {}!", value)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainPruneFractionDeathTest, ::testing::Combine(
+                ::testing::Values("--prune_fraction"),
+                ::testing::Values(-0.5, 0.0, 1.0)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainPruneFractionDeathTest>);
+// clang-format on
+
+class ParserTrainMaxAccuracyDrop : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainMaxAccuracyDrop, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--prune_to", "10", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_FALSE(parser.max_accuracy_drop.is_default());
+    EXPECT_DOUBLE_EQ(parser.max_accuracy_drop.value(), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainMaxAccuracyDrop, ::testing::Combine(
+                ::testing::Values("--max_accuracy_drop"),
+                ::testing::Values(0.0, 0.01, 1.0)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainMaxAccuracyDrop>);
+// clang-format on
+
+class ParserTrainMaxAccuracyDropDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainMaxAccuracyDropDeathTest, max_accuracy_drop_out_of_range) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--prune_to", "10", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("max_accuracy_drop must be in the range [0.0, 1.0], but is {}!", value)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainMaxAccuracyDropDeathTest, ::testing::Combine(
+                ::testing::Values("--max_accuracy_drop"),
+                ::testing::Values(-0.5, 1.5)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainMaxAccuracyDropDeathTest>);
+// clang-format on
+
+class ParserTrainReduceTo : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainReduceTo, parsing) {
+    const auto &[flag, reduce_to] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", reduce_to), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.reduce_to, reduce_to);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainReduceTo, ::testing::Combine(
+                ::testing::Values("--reduce_to"),
+                ::testing::Values(2, 100, 1000)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainReduceTo>);
+// clang-format on
+
+class ParserTrainReduceToDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainReduceToDeathTest, reduce_to_explicit_less_than_two) {
+    const auto &[flag, reduce_to] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", reduce_to), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("reduce_to must be at least 2, but is {}!", reduce_to)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainReduceToDeathTest, ::testing::Combine(
+                ::testing::Values("--reduce_to"),
+                ::testing::Values(-1, 0, 1)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainReduceToDeathTest>);
+// clang-format on
+
+class ParserTrainReduceTolerance : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainReduceTolerance, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--reduce_to", "10", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_FALSE(parser.reduce_tolerance.is_default());
+    EXPECT_DOUBLE_EQ(parser.reduce_tolerance.value(), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainReduceTolerance, ::testing::Combine(
+                ::testing::Values("--reduce_tolerance"),
+                ::testing::Values(0.0, 0.01, 1.0)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainReduceTolerance>);
+// clang-format on
+
+class ParserTrainReduceToleranceDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainReduceToleranceDeathTest, reduce_tolerance_out_of_range) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--reduce_to", "10", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("reduce_tolerance must be in the range [0.0, 1.0], but is {}!", value)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainReduceToleranceDeathTest, ::testing::Combine(
+                ::testing::Values("--reduce_tolerance"),
+                ::testing::Values(-0.5, 1.5)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainReduceToleranceDeathTest>);
+// clang-format on
+
+class ParserTrainSolver : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainSolver, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to solver_type
+    const auto solver = util::convert_from_string<plssvm::solver_type>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.solver, solver);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSolver, ::testing::Combine(
+                ::testing::Values("--solver"),
+                ::testing::Values("cg", "single_reduction_cg", "CHRONOPOULOS_GEAR")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainSolver>);
+// clang-format on
+TEST_F(ParserTrain, solver_with_cost_path) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--solver", "single_reduction_cg", "--cost_path", "0.1,1", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // the cost path only supports the classic CG algorithm
+    EXPECT_EQ(parser.solver, plssvm::solver_type::cg);
+}
+
+class ParserTrainSolverState : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainSolverState, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.solver_state_filename, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSolverState, ::testing::Combine(
+                ::testing::Values("--solver_state"),
+                ::testing::Values("data.state", "/tmp/solver_state.txt")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainSolverState>);
+// clang-format on
+TEST_F(ParserTrainDeathTest, solver_state_with_cost_path) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--solver_state", "data.state", "--cost_path", "0.1,1", "data.libsvm" });
+    // the cost path can't recycle a solver state
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("--solver_state can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, or --num_landmarks!"));
+}
+TEST_F(ParserTrainDeathTest, solver_state_with_single_reduction_cg) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--solver_state", "data.state", "--solver", "single_reduction_cg", "data.libsvm" });
+    // only the classic CG algorithm can be deflated
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("--solver_state can only be used with --solver=cg, but --solver=single_reduction_cg was given!"));
+}
+
+class ParserTrainCheckpointInterval : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, unsigned long long>> {};
+TEST_P(ParserTrainCheckpointInterval, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.checkpoint_interval, value);
+    // the checkpoint file defaults to the model file with an additional extension
+    EXPECT_EQ(parser.checkpoint_filename, value > 0 ? "data.libsvm.model.checkpoint" : "");
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCheckpointInterval, ::testing::Combine(
+                ::testing::Values("--checkpoint_interval"),
+                ::testing::Values(0, 1, 100)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCheckpointInterval>);
+// clang-format on
+
+class ParserTrainCheckpointFile : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainCheckpointFile, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--resume", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_TRUE(parser.resume);
+    EXPECT_EQ(parser.checkpoint_filename, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCheckpointFile, ::testing::Combine(
+                ::testing::Values("--checkpoint_file"),
+                ::testing::Values("data.checkpoint", "/tmp/checkpoint.txt")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCheckpointFile>);
+// clang-format on
+TEST_F(ParserTrainDeathTest, negative_checkpoint_interval) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--checkpoint_interval", "-1", "data.libsvm" });
+    // create parser_train object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("checkpoint_interval must be greater or equal than 0, but is -1!"));
+}
+TEST_F(ParserTrainDeathTest, checkpoint_with_cost_path) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--checkpoint_interval", "10", "--cost_path", "0.1,1", "data.libsvm" });
+    // the cost path can't be checkpointed
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("--checkpoint_interval and --resume can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, --num_landmarks, or --solver_state!"));
+}
+TEST_F(ParserTrainDeathTest, checkpoint_with_single_reduction_cg) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--resume", "--solver", "single_reduction_cg", "data.libsvm" });
+    // only the classic CG algorithm can be checkpointed
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("--checkpoint_interval and --resume can only be used with --solver=cg, but --solver=single_reduction_cg was given!"));
+}
+
+class ParserTrainAppend : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainAppend, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.append, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainAppend, ::testing::Combine(
+                ::testing::Values("--append"),
+                ::testing::Bool()),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainAppend>);
+// clang-format on
+TEST_F(ParserTrainDeathTest, append_with_num_partitions) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--append", "--num_partitions", "4", "data.libsvm" });
+    // the cascade training can't be warm started
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("--append can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, --num_landmarks, --solver_state, --checkpoint_interval, or --resume!"));
+}
+
+class ParserTrainLandmarkSelection : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainLandmarkSelection, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to landmark_selection_type
+    const auto selection = util::convert_from_string<plssvm::landmark_selection_type>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--num_landmarks", "10", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.landmark_selection, selection);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainLandmarkSelection, ::testing::Combine(
+                ::testing::Values("--landmark_selection"),
+                ::testing::Values("uniform", "kmeans_pp", "KMEANS_PP", "entropy")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainLandmarkSelection>);
+// clang-format on
+
+class ParserTrainBackend : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainBackend, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to backend
+    const auto backend = util::convert_from_string<plssvm::backend_type>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.backend, backend);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainBackend, ::testing::Combine(
+                ::testing::Values("-b", "--backend"),
+                ::testing::Values("automatic", "OpenMP", "CUDA", "HIP", "OpenCL", "SYCL")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainBackend>);
+// clang-format on
+
+class ParserTrainTargetPlatform : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainTargetPlatform, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to target_platform
+    const auto target_platform = util::convert_from_string<plssvm::target_platform>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.target, target_platform);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainTargetPlatform, ::testing::Combine(
+                ::testing::Values("-p", "--target_platform"),
+                ::testing::Values("automatic", "cpu", "gpu_nvidia", "gpu_amd", "gpu_intel")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainTargetPlatform>);
+// clang-format on
+
+class ParserTrainHODLRTolerance : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainHODLRTolerance, parsing) {
+    const auto &[flag, hodlr_tolerance] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "openmp", flag, fmt::format("{}", hodlr_tolerance), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_DOUBLE_EQ(parser.hodlr_tolerance, hodlr_tolerance);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainHODLRTolerance, ::testing::Combine(
+                ::testing::Values("--hodlr_tolerance"),
+                ::testing::Values(0.0, 1e-10, 0.001)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainHODLRTolerance>);
+// clang-format on
+
+TEST_F(ParserTrain, hodlr_tolerance_non_openmp_backend) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "cuda", "--hodlr_tolerance", "0.001", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // the HODLR tolerance is ignored for all backends except OpenMP
+    EXPECT_EQ(parser.hodlr_tolerance, 0.0);
+}
+
+TEST_F(ParserTrain, hodlr_tolerance_automatic_backend) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "automatic", "--hodlr_tolerance", "0.001", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // the HODLR tolerance is only kept if the automatic backend resolves to OpenMP
+    EXPECT_EQ(parser.hodlr_tolerance, plssvm::determine_default_backend() == plssvm::backend_type::openmp ? 0.001 : 0.0);
+}
+
+class ParserTrainHODLRToleranceDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainHODLRToleranceDeathTest, hodlr_tolerance_explicit_less_than_zero) {
+    const auto &[flag, hodlr_tolerance] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", hodlr_tolerance), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("hodlr_tolerance must be greater or equal than 0.0, but is {}!", hodlr_tolerance)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainHODLRToleranceDeathTest, ::testing::Combine(
+                ::testing::Values("--hodlr_tolerance"),
+                ::testing::Values(-1.0, -0.001)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainHODLRToleranceDeathTest>);
+// clang-format on
+
+class ParserTrainRBFCutoff : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainRBFCutoff, parsing) {
+    const auto &[flag, rbf_cutoff] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "openmp", "--kernel_type", "2", flag, fmt::format("{}", rbf_cutoff), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_DOUBLE_EQ(parser.rbf_cutoff, rbf_cutoff);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainRBFCutoff, ::testing::Combine(
+                ::testing::Values("--rbf_cutoff"),
+                ::testing::Values(0.0, 1e-10, 0.001)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainRBFCutoff>);
+// clang-format on
+
+TEST_F(ParserTrain, rbf_cutoff_non_openmp_backend) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "cuda", "--kernel_type", "2", "--rbf_cutoff", "0.001", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // the rbf cutoff is ignored for all backends except OpenMP
+    EXPECT_EQ(parser.rbf_cutoff, 0.0);
+}
+TEST_F(ParserTrain, rbf_cutoff_automatic_backend) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "automatic", "--kernel_type", "2", "--rbf_cutoff", "0.001", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // the rbf cutoff is only kept if the automatic backend resolves to OpenMP
+    EXPECT_EQ(parser.rbf_cutoff, plssvm::determine_default_backend() == plssvm::backend_type::openmp ? 0.001 : 0.0);
+}
+TEST_F(ParserTrain, rbf_cutoff_non_rbf_kernel) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--kernel_type", "1", "--rbf_cutoff", "0.001", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // the rbf cutoff is ignored for all kernel functions except rbf
+    EXPECT_EQ(parser.rbf_cutoff, 0.0);
+}
+
+class ParserTrainRBFCutoffDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainRBFCutoffDeathTest, rbf_cutoff_explicit_out_of_range) {
+    const auto &[flag, rbf_cutoff] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--kernel_type", "2", flag, fmt::format("{}", rbf_cutoff), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("rbf_cutoff must be in the range [0.0, 1.0), but is {}!", rbf_cutoff)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainRBFCutoffDeathTest, ::testing::Combine(
+                ::testing::Values("--rbf_cutoff"),
+                ::testing::Values(-1.0, 1.0, 2.5)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainRBFCutoffDeathTest>);
+// clang-format on
+
+TEST_F(ParserTrainDeathTest, hodlr_tolerance_and_rbf_cutoff) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "openmp", "--kernel_type", "2", "--hodlr_tolerance", "1e-6", "--rbf_cutoff", "1e-8", "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("Only one of --hodlr_tolerance and --rbf_cutoff may be given!"));
+}
+TEST_F(ParserTrainDeathTest, cost_path_and_hodlr_tolerance) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "openmp", "--cost_path", "0.1,1", "--hodlr_tolerance", "1e-6", "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("--cost_path can't be combined with --hodlr_tolerance or --rbf_cutoff!"));
+}
+TEST_F(ParserTrainDeathTest, cost_path_and_rbf_cutoff) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--backend", "openmp", "--kernel_type", "2", "--cost_path", "0.1,1", "--rbf_cutoff", "1e-8", "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("--cost_path can't be combined with --hodlr_tolerance or --rbf_cutoff!"));
+}
+
+#if defined(PLSSVM_HAS_SYCL_BACKEND)
+
+class ParserTrainSYCLKernelInvocation : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainSYCLKernelInvocation, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to sycl::kernel_invocation_type
+    const auto sycl_kernel_invocation_type = util::convert_from_string<plssvm::sycl::kernel_invocation_type>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.sycl_kernel_invocation_type, sycl_kernel_invocation_type);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSYCLKernelInvocation, ::testing::Combine(
+                ::testing::Values("--sycl_kernel_invocation_type"),
+                ::testing::Values("automatic", "nd_range", "ND_RANGE", "hierarchical")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainSYCLKernelInvocation>);
+// clang-format on
+
+class ParserTrainSYCLImplementation : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainSYCLImplementation, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to sycl::implementation_type
+    const auto sycl_implementation_type = util::convert_from_string<plssvm::sycl::implementation_type>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.sycl_implementation_type, sycl_implementation_type);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSYCLImplementation, ::testing::Combine(
+                ::testing::Values("--sycl_implementation_type"),
+                ::testing::Values("automatic", "hipSYCL", "DPCPP")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainSYCLImplementation>);
+// clang-format on
+
+#endif  // PLSSVM_HAS_SYCL_BACKEND
+
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+
+class ParserTrainPerformanceTrackingFilename : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainPerformanceTrackingFilename, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.performance_tracking_filename, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainPerformanceTrackingFilename, ::testing::Combine(
+                ::testing::Values("--performance_tracking"),
+                ::testing::Values("tracking.yaml", "test.txt")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainPerformanceTrackingFilename>);
+// clang-format on
+
+#endif  // PLSSVM_PERFORMANCE_TRACKER_ENABLED
+
+TEST_F(ParserTrain, csv_delimiter) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--csv_delimiter", ";", "data.csv" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.input_options.delimiter, ';');
+}
+
+class ParserTrainCSVHeader : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainCSVHeader, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.csv" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.input_options.has_header, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCSVHeader, ::testing::Combine(
+                ::testing::Values("--csv_header"),
+                ::testing::Bool()),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCSVHeader>);
+// clang-format on
+
+class ParserTrainCSVLabelColumn : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainCSVLabelColumn, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.csv" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    if (value == "none") {
+        EXPECT_FALSE(parser.input_options.label_column.has_value());
+    } else {
+        EXPECT_EQ(parser.input_options.label_column, std::optional<long long>{ util::convert_from_string<long long>(value) });
+    }
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCSVLabelColumn, ::testing::Combine(
+                ::testing::Values("--csv_label_column"),
+                ::testing::Values("0", "3", "-1", "-2", "none")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCSVLabelColumn>);
+// clang-format on
+
+class ParserTrainCache : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainCache, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.cache_options.enabled, value);
+    EXPECT_TRUE(parser.cache_options.directory.empty());
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCache, ::testing::Combine(
+                ::testing::Values("--cache"),
+                ::testing::Bool()),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCache>);
+// clang-format on
+
+TEST_F(ParserTrain, cache_dir) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--cache_dir", "cache", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness: a cache directory implies using the cache
+    EXPECT_TRUE(parser.cache_options.enabled);
+    EXPECT_EQ(parser.cache_options.directory, std::filesystem::path{ "cache" });
+}
+
+TEST_F(ParserTrain, cache_max_size) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--cache", "--cache_max_size", "0", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.cache_options.max_size, std::uintmax_t{ 0 });
+}
+
+TEST_F(ParserTrain, features) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--features", "5,0-2,2", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.subset.features, (std::vector<std::size_t>{ 0, 1, 2, 5 }));
+}
+TEST_F(ParserTrainDeathTest, invalid_features) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--features", "3-1", "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("Invalid feature range \"3-1\": the first index 3 must not be larger than the last index 1!"));
+}
+
+class ParserTrainSampleSize : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTrainSampleSize, parsing) {
+    const auto &[flag, sample_size] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", sample_size), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.subset.num_samples, sample_size);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSampleSize, ::testing::Combine(
+                ::testing::Values("--sample_size"),
+                ::testing::Values(1, 42, 1000)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainSampleSize>);
+// clang-format on
+
+TEST_F(ParserTrainDeathTest, sample_size_zero) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--sample_size", "0", "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr("sample_size must be greater than 0, but is 0!"));
+}
+
+class ParserTrainSampling : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainSampling, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to sampling_type
+    const auto sampling = util::convert_from_string<plssvm::sampling_type>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--sample_size", "10", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.subset.sampling, sampling);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSampling, ::testing::Combine(
+                ::testing::Values("--sampling"),
+                ::testing::Values("uniform", "stratified", "STRATIFIED")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainSampling>);
+// clang-format on
+
+class ParserTrainUseStringsAsLabels : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainUseStringsAsLabels, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.strings_as_labels, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainUseStringsAsLabels, ::testing::Combine(
+                ::testing::Values("--use_strings_as_labels"),
+                ::testing::Bool()),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainUseStringsAsLabels>);
+// clang-format on
+
+class ParserTrainUseFloatAsRealType : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainUseFloatAsRealType, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.float_as_real_type, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainUseFloatAsRealType, ::testing::Combine(
+                ::testing::Values("--use_float_as_real_type"),
+                ::testing::Bool()),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainUseFloatAsRealType>);
+// clang-format on
+
+class ParserTrainVerbosity : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainVerbosity, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(fmt::format("{}", plssvm::verbosity), value);
 }
 // clang-format off
 INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainVerbosity, ::testing::Combine(
@@ -523,6 +1661,63 @@ TEST_F(ParserTrain, too_many_positional_arguments) {
                 ::testing::HasSubstr(R"(Only up to two positional options may be given, but 2 ("p3 p4") additional option(s) where provided!)"));
 }
 
+TEST_F(ParserTrainDeathTest, illegal_cost_path_value) {
+    this->CreateCMDArgs({ "./plssvm-train", "--cost_path", "1.0,0.0", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("cost must be greater than 0.0, but is 0!"));
+}
+TEST_F(ParserTrainDeathTest, cost_and_cost_path) {
+    this->CreateCMDArgs({ "./plssvm-train", "--cost", "2", "--cost_path", "0.5,2", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("Only one of -c/--cost and --cost_path may be given!"));
+}
+
+TEST_F(ParserTrainDeathTest, cross_validation_and_loo) {
+    this->CreateCMDArgs({ "./plssvm-train", "--cross_validation", "5", "--loo", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("Only one of --cross_validation, --loo, and --cost_path may be given!"));
+}
+TEST_F(ParserTrainDeathTest, num_partitions_and_loo) {
+    this->CreateCMDArgs({ "./plssvm-train", "--loo", "--num_partitions", "4", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("--num_partitions can't be combined with --cross_validation, --loo, or --cost_path!"));
+}
+TEST_F(ParserTrainDeathTest, num_landmarks_and_cross_validation) {
+    this->CreateCMDArgs({ "./plssvm-train", "--cross_validation", "5", "--num_landmarks", "10", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("--num_landmarks can't be combined with --cross_validation, --loo, --cost_path, or --num_partitions!"));
+}
+TEST_F(ParserTrainDeathTest, prune_to_and_num_landmarks) {
+    this->CreateCMDArgs({ "./plssvm-train", "--num_landmarks", "10", "--prune_to", "10", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("--prune_to can't be combined with --cross_validation, --loo, --cost_path, --num_partitions, --num_landmarks, --solver_state, --checkpoint_interval, --resume, or --append!"));
+}
+TEST_F(ParserTrainDeathTest, reduce_to_and_loo) {
+    this->CreateCMDArgs({ "./plssvm-train", "--loo", "--reduce_to", "10", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("--reduce_to can't be combined with --cross_validation or --loo!"));
+}
+TEST_F(ParserTrainDeathTest, loo_and_cost_path) {
+    this->CreateCMDArgs({ "./plssvm-train", "--loo", "--cost_path", "0.5,2", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("Only one of --loo and --cost_path may be given!"));
+}
+
+TEST_F(ParserTrainDeathTest, invalid_csv_label_column) {
+    this->CreateCMDArgs({ "./plssvm-train", "--csv_label_column", "first", "data.csv" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr(R"(Error invalid label column "first"! Must be an integer or "none".)"));
+}
+
 // test whether nonsensical cmd arguments trigger the assertions
 TEST_F(ParserTrainDeathTest, too_few_argc) {
     EXPECT_DEATH((plssvm::detail::cmd::parser_train{ 0, nullptr }),
@@ -10,25 +10,28 @@
 
 #include "plssvm/detail/io/arff_parsing.hpp"
 
-#include "plssvm/detail/io/file_reader.hpp"  // plssvm::detail::io::file_reader
-#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_file_format_exception
-
-#include "../../custom_test_macros.hpp"      // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_THROW_WHAT
-#include "../../naming.hpp"                  // naming::real_type_label_type_combination_to_name
-#include "../../types_to_test.hpp"           // util::real_type_label_type_combination_gtest
-#include "../../utility.hpp"                 // util::{temporary_file, instantiate_template_file, get_distinct_label}
-
-#include "fmt/core.h"                        // fmt::format
-#include "gmock/gmock-matchers.h"            // ::testing::HasSubstr
-#include "gtest/gtest.h"                     // TEST, TEST_P, TYPED_TEST, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_DEATH, ASSERT_EQ, GTEST_FAIL
-                                             // ::testing::{Test, Types, TestWithParam, Values}
-
-#include <cstddef>                           // std::size_t
-#include <set>                               // std::set
-#include <string>                            // std::string
-#include <tuple>                             // std::tuple, std::make_tuple, std::ignore
-#include <type_traits>                       // std::is_same_v
-#include <vector>                            // std::vector
+#include "plssvm/detail/io/data_set_subset.hpp"  // plssvm::detail::io::select_subset
+#include "plssvm/detail/io/file_reader.hpp"      // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"      // plssvm::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"          // plssvm::subset_options
+#include "plssvm/sampling_types.hpp"             // plssvm::sampling_type
+
+#include "../../custom_test_macros.hpp"          // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                      // naming::real_type_label_type_combination_to_name
+#include "../../types_to_test.hpp"               // util::real_type_label_type_combination_gtest
+#include "../../utility.hpp"                     // util::{temporary_file, instantiate_template_file, get_distinct_label}
+
+#include "fmt/core.h"                            // fmt::format
+#include "gmock/gmock-matchers.h"                // ::testing::HasSubstr
+#include "gtest/gtest.h"                         // TEST, TEST_P, TYPED_TEST, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_DEATH, ASSERT_EQ
+                                                 // ::testing::{Test, Types, TestWithParam, Values}
+
+#include <cstddef>                               // std::size_t
+#include <set>                                   // std::set
+#include <string>                                // std::string
+#include <tuple>                                 // std::tuple, std::make_tuple, std::ignore
+#include <type_traits>                           // std::is_same_v
+#include <vector>                                // std::vector
 
 class ARFFParseHeader : public ::testing::Test {};
 class ARFFParseHeaderValid : public ::testing::TestWithParam<std::tuple<std::string, std::size_t, std::size_t, bool, std::size_t>> {};
@@ -298,6 +301,114 @@ TYPED_TEST(ARFFParse, read_without_label) {
     EXPECT_TRUE(label.empty());
 }
 
+TYPED_TEST(ARFFParseDense, read_features) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // parse the ARFF file keeping only the second and fourth feature
+    plssvm::detail::io::file_reader reader{ this->filename };
+    reader.read_lines('%');
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_arff_data<current_real_type, current_label_type>(reader, plssvm::subset_options{ { 3, 1 }, 0, plssvm::sampling_type::uniform });
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 2);
+
+    // check for correct data
+    std::vector<std::vector<current_real_type>> correct_data{};
+    for (const std::vector<current_real_type> &point : this->correct_data) {
+        correct_data.push_back({ point[1], point[3] });
+    }
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(ARFFParseSparse, read_features) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // parse the ARFF file keeping only the first and third feature (the label attribute isn't counted)
+    plssvm::detail::io::file_reader reader{ this->filename };
+    reader.read_lines('%');
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_arff_data<current_real_type, current_label_type>(reader, plssvm::subset_options{ { 0, 2 }, 0, plssvm::sampling_type::uniform });
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 2);
+
+    // check for correct data
+    std::vector<std::vector<current_real_type>> correct_data{};
+    for (const std::vector<current_real_type> &point : this->correct_data) {
+        correct_data.push_back({ point[0], point[2] });
+    }
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(ARFFParseDense, read_sample) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    for (const plssvm::sampling_type sampling : { plssvm::sampling_type::uniform, plssvm::sampling_type::stratified }) {
+        const plssvm::subset_options subset{ { 0, 2 }, 3, sampling };
+
+        // parse the ARFF file drawing a sample of three data points
+        plssvm::detail::io::file_reader reader{ this->filename };
+        reader.read_lines('%');
+        const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_arff_data<current_real_type, current_label_type>(reader, subset);
+
+        // check for correct sizes
+        ASSERT_EQ(num_data_points, 3);
+        ASSERT_EQ(num_features, 2);
+
+        // the sample must be the same as the one selected after reading the whole file
+        std::vector<std::vector<current_real_type>> correct_data{ this->correct_data };
+        std::vector<current_label_type> correct_label{ this->correct_label };
+        plssvm::detail::io::select_subset(correct_data, correct_label, subset);
+        EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, correct_data);
+        EXPECT_EQ(label, correct_label);
+    }
+}
+TYPED_TEST(ARFFParseSparse, read_sample_stratified) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // parse the ARFF file drawing a stratified sample of two data points
+    plssvm::detail::io::file_reader reader{ this->filename };
+    reader.read_lines('%');
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_arff_data<current_real_type, current_label_type>(reader, plssvm::subset_options{ {}, 2, plssvm::sampling_type::stratified });
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 2);
+    ASSERT_EQ(num_features, 4);
+
+    // both classes must be present in the sample
+    const auto [first_label, second_label] = util::get_distinct_label<current_label_type>();
+    EXPECT_EQ(label, (std::vector<current_label_type>{ first_label, second_label }));
+}
+TYPED_TEST(ARFFParse, feature_out_of_range) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // parse the ARFF file
+    const std::string filename = PLSSVM_TEST_PATH "/data/arff/3x2_without_label.arff";
+    plssvm::detail::io::file_reader reader{ filename };
+    reader.read_lines('%');
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_arff_data<current_real_type, current_label_type>(reader, plssvm::subset_options{ { 0, 2 }, 0, plssvm::sampling_type::uniform })),
+                      plssvm::invalid_file_format_exception,
+                      "Can't keep the feature with index 2 since the data points only have 2 features!");
+}
+TYPED_TEST(ARFFParse, stratified_sample_without_label) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // parse the ARFF file
+    const std::string filename = PLSSVM_TEST_PATH "/data/arff/3x2_without_label.arff";
+    plssvm::detail::io::file_reader reader{ filename };
+    reader.read_lines('%');
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_arff_data<current_real_type, current_label_type>(reader, plssvm::subset_options{ {}, 2, plssvm::sampling_type::stratified })),
+                      plssvm::invalid_file_format_exception,
+                      "Can't draw a stratified sample since the data points have no labels!");
+}
+
 TYPED_TEST(ARFFParse, at_inside_data_section) {
     using current_real_type = typename TypeParam::real_type;
     using current_label_type = typename TypeParam::label_type;
@@ -509,15 +620,8 @@ TYPED_TEST(ARFFWrite, write_with_label) {
     // check the lines
     for (std::size_t i = 0; i < data.size(); ++i) {
         const std::string line = fmt::format("{:.10e},{:.10e},{:.10e},{}", data[i][0], data[i][1], data[i][2], label[i]);
-        bool line_found = false;
-        for (std::size_t j = 6; j < reader.num_lines(); ++j) {
-            if (reader.line(j) == line) {
-                line_found = true;
-            }
-        }
-        if (!line_found) {
-            GTEST_FAIL() << fmt::format("Couldn't find line '{}' in the output file.", line);
-        }
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(6 + i), line);
     }
 }
 
@@ -549,15 +653,8 @@ TYPED_TEST(ARFFWrite, write_without_label) {
     // check the lines
     for (std::size_t i = 0; i < data.size(); ++i) {
         const std::string line = fmt::format("{:.10e},{:.10e},{:.10e}", data[i][0], data[i][1], data[i][2]);
-        bool line_found = false;
-        for (std::size_t j = 5; j < reader.num_lines(); ++j) {
-            if (reader.line(j) == line) {
-                line_found = true;
-            }
-        }
-        if (!line_found) {
-            GTEST_FAIL() << fmt::format("Couldn't find line '{}' in the output file.", line);
-        }
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(5 + i), line);
     }
 }
 
@@ -0,0 +1,219 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to parsing and writing the binary model file.
+ */
+
+#include "plssvm/detail/io/binary_model_parsing.hpp"
+
+#include "plssvm/data_set.hpp"               // plssvm::data_set
+#include "plssvm/detail/io/file_reader.hpp"  // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_file_format_exception
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"              // plssvm::parameter
+
+#include "../../custom_test_macros.hpp"      // EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                  // naming::real_type_label_type_combination_to_name
+#include "../../types_to_test.hpp"           // util::real_type_label_type_combination_gtest
+#include "../../utility.hpp"                 // util::{temporary_file, redirect_output, get_distinct_label}
+
+#include "fmt/core.h"                        // fmt::format
+#include "gtest/gtest.h"                     // TEST, TEST_F, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW, EXPECT_DEATH, ASSERT_EQ, ::testing::Test
+
+#include <cstddef>                           // std::size_t
+#include <cstdint>                           // std::uint32_t, std::uint64_t
+#include <cstring>                           // std::memcpy
+#include <fstream>                           // std::ifstream, std::ofstream
+#include <ios>                               // std::ios, std::streamsize
+#include <iterator>                          // std::istreambuf_iterator
+#include <string>                            // std::string
+#include <tuple>                             // std::ignore
+#include <vector>                            // std::vector
+
+template <typename T>
+class BinaryModelParseWrite : public ::testing::Test, private util::redirect_output<>, protected util::temporary_file {
+  protected:
+    void SetUp() override {
+        const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+        label = std::vector<label_type>{ first_label, second_label, first_label };
+    }
+
+    using real_type = typename T::real_type;
+    using label_type = typename T::label_type;
+
+    const std::vector<std::vector<real_type>> support_vectors{
+        { real_type{ 1.1 }, real_type{ 1.2 } },
+        { real_type{ 2.1 }, real_type{ 2.2 } },
+        { real_type{ 3.1 }, real_type{ 3.2 } }
+    };
+    const std::vector<real_type> alpha{ real_type{ -0.5 }, real_type{ 0.25 }, real_type{ 0.125 } };
+    std::vector<label_type> label{};
+};
+TYPED_TEST_SUITE(BinaryModelParseWrite, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(BinaryModelParseWrite, linear) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // write and re-read the model
+    const plssvm::data_set<real_type, label_type> data{ this->support_vectors, this->label };
+    plssvm::detail::io::write_binary_model_data(this->filename, plssvm::parameter{}, real_type{ 0.75 }, this->alpha, std::vector<real_type>{}, data);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [params, rho, parsed_support_vectors, parsed_label, parsed_alpha, w] = plssvm::detail::io::parse_binary_model<real_type, label_type>(reader);
+
+    // check for correctness
+    EXPECT_EQ(params, plssvm::parameter{});
+    EXPECT_TRUE(params.kernel_type.is_default());
+    EXPECT_EQ(rho, real_type{ 0.75 });
+    EXPECT_EQ(parsed_support_vectors, this->support_vectors);
+    EXPECT_EQ(parsed_label, this->label);
+    EXPECT_EQ(parsed_alpha, this->alpha);
+    // the w vector is precomputed for the linear kernel
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(w, (std::vector<real_type>{ real_type{ -0.5 * 1.1 + 0.25 * 2.1 + 0.125 * 3.1 }, real_type{ -0.5 * 1.2 + 0.25 * 2.2 + 0.125 * 3.2 } }));
+}
+TYPED_TEST(BinaryModelParseWrite, rbf) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // write and re-read the model
+    const plssvm::parameter params_to_write{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::gamma = 0.01, plssvm::cost = 2.0 };
+    const plssvm::data_set<real_type, label_type> data{ this->support_vectors, this->label };
+    plssvm::detail::io::write_binary_model_data(this->filename, params_to_write, real_type{ -0.75 }, this->alpha, std::vector<real_type>{}, data);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [params, rho, parsed_support_vectors, parsed_label, parsed_alpha, w] = plssvm::detail::io::parse_binary_model<real_type, label_type>(reader);
+
+    // check for correctness
+    EXPECT_EQ(params, params_to_write);
+    EXPECT_FALSE(params.gamma.is_default());
+    EXPECT_FALSE(params.cost.is_default());
+    EXPECT_TRUE(params.degree.is_default());
+    EXPECT_TRUE(params.coef0.is_default());
+    EXPECT_EQ(rho, real_type{ -0.75 });
+    EXPECT_EQ(parsed_support_vectors, this->support_vectors);
+    EXPECT_EQ(parsed_label, this->label);
+    EXPECT_EQ(parsed_alpha, this->alpha);
+    // no w vector is stored for the rbf kernel
+    EXPECT_TRUE(w.empty());
+}
+
+class BinaryModelParse : public ::testing::Test, private util::redirect_output<>, protected util::temporary_file {
+  protected:
+    /**
+     * @brief Write a small valid binary model file and overwrite @p num_bytes bytes at @p offset with @p value.
+     * @param[in] offset the offset of the bytes to overwrite
+     * @param[in] value the new bytes
+     * @param[in] num_bytes the number of bytes to overwrite
+     */
+    void write_corrupted_file(const std::size_t offset, const void *value, const std::size_t num_bytes) {
+        plssvm::detail::io::write_binary_model_data(this->filename, plssvm::parameter{}, 0.5, std::vector<double>{ 1.0, -1.0 }, std::vector<double>{}, data);
+        std::string content = this->read_content();
+        std::memcpy(content.data() + offset, value, num_bytes);
+        this->write_content(content);
+    }
+    /**
+     * @brief Read the whole content of the temporary file.
+     * @return the file content (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::string read_content() const {
+        std::ifstream in{ this->filename, std::ios::binary };
+        return std::string{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+    }
+    /**
+     * @brief Overwrite the temporary file with @p content.
+     * @param[in] content the new file content
+     */
+    void write_content(const std::string &content) const {
+        std::ofstream out{ this->filename, std::ios::binary | std::ios::trunc };
+        out.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    const plssvm::data_set<double, int> data{ std::vector<std::vector<double>>{ { 1.1, 1.2 }, { 2.1, 2.2 } }, std::vector<int>{ -1, 1 } };
+};
+
+TEST_F(BinaryModelParse, libsvm_model_file) {
+    // parse a LIBSVM model file
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/model/5x4_linear.libsvm.model" };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The binary model file must start with \"PLSSVMMD\"!");
+}
+TEST_F(BinaryModelParse, binary_data_set_file) {
+    // parse a binary data set file
+    plssvm::detail::io::write_binary_data(this->filename, data.data());
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The binary model file must start with \"PLSSVMMD\"!");
+}
+TEST_F(BinaryModelParse, unsupported_version) {
+    const std::uint32_t version{ 42 };
+    this->write_corrupted_file(8, &version, sizeof(version));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unsupported binary model file format version 42 (supported: 1)!");
+}
+TEST_F(BinaryModelParse, invalid_kernel_type) {
+    const std::uint32_t kernel_type{ 3 };
+    this->write_corrupted_file(20, &kernel_type, sizeof(kernel_type));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unrecognized kernel type '3'!");
+}
+TEST_F(BinaryModelParse, no_support_vectors) {
+    const std::uint64_t num_support_vectors{ 0 };
+    this->write_corrupted_file(64, &num_support_vectors, sizeof(num_support_vectors));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The number of support vectors must be greater than 0!");
+}
+TEST_F(BinaryModelParse, too_many_labels) {
+    const std::uint64_t num_labels{ 3 };
+    this->write_corrupted_file(80, &num_labels, sizeof(num_labels));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Currently only binary classification is supported, but 3 different label where given!");
+}
+TEST_F(BinaryModelParse, truncated_file) {
+    // the file consists of: header (128 bytes), labels (128 bytes), weights (64 bytes), support vectors (64 bytes), w vector (16 bytes)
+    plssvm::detail::io::write_binary_model_data(this->filename, plssvm::parameter{}, 0.5, std::vector<double>{ 1.0, -1.0 }, std::vector<double>{}, data);
+    std::string content = this->read_content();
+    ASSERT_EQ(content.size(), 400);
+    // remove the support vectors and the w vector
+    content.resize(320);
+    this->write_content(content);
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unexpected end of the binary file: need 352 bytes, but only 320 are present!");
+}
+TEST_F(BinaryModelParse, corrupted_sizes) {
+    // corrupted sizes in the header must neither overflow nor result in huge allocations
+    for (const std::size_t offset : { 64, 72 }) {
+        for (const std::uint64_t size : { std::uint64_t{ 1 } << 40, std::uint64_t{ 1 } << 62, ~std::uint64_t{ 0 } }) {
+            this->write_corrupted_file(offset, &size, sizeof(size));
+
+            const plssvm::detail::io::file_reader reader{ this->filename };
+            EXPECT_THROW(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)), plssvm::invalid_file_format_exception) << fmt::format("offset: {}, size: {}", offset, size);
+        }
+    }
+}
+
+TEST(BinaryModelParseDeathTest, invalid_file_reader) {
+    // open file_reader without associating it to a file
+    const plssvm::detail::io::file_reader reader{};
+    EXPECT_DEATH(std::ignore = (plssvm::detail::io::parse_binary_model<double, int>(reader)),
+                 "The file_reader is currently not associated with a file!");
+}
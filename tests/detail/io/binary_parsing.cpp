@@ -0,0 +1,324 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to parsing and writing the data points from and to a binary file.
+ */
+
+#include "plssvm/detail/io/binary_parsing.hpp"
+
+#include "plssvm/detail/io/file_reader.hpp"  // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_file_format_exception, plssvm::file_exception
+
+#include "../../custom_test_macros.hpp"      // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                  // naming::real_type_label_type_combination_to_name
+#include "../../types_to_test.hpp"           // util::real_type_label_type_combination_gtest
+#include "../../utility.hpp"                 // util::{temporary_file, get_distinct_label}
+
+#include "fmt/core.h"                        // fmt::format
+#include "gtest/gtest.h"                     // TEST, TEST_F, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_TRUE, EXPECT_THROW, EXPECT_DEATH, ASSERT_EQ, ::testing::Test
+
+#include <cstddef>                           // std::size_t
+#include <cstdint>                           // std::uint32_t, std::uint64_t
+#include <cstring>                           // std::memcpy
+#include <fstream>                           // std::ifstream, std::ofstream
+#include <ios>                               // std::ios
+#include <iterator>                          // std::istreambuf_iterator
+#include <string>                            // std::string
+#include <tuple>                             // std::ignore
+#include <vector>                            // std::vector
+
+template <typename T>
+class BinaryParseWrite : public ::testing::Test, protected util::temporary_file {
+  protected:
+    void SetUp() override {
+        // create a vector with the correct labels
+        const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+        correct_label = std::vector<label_type>{ first_label, first_label, second_label, second_label, second_label };
+    }
+
+    using real_type = typename T::real_type;
+    using label_type = typename T::label_type;
+
+    const std::vector<std::vector<real_type>> dense_data{
+        { real_type{ -1.117827500607882 }, real_type{ -2.9087188881250993 }, real_type{ 0.66638344270039144 }, real_type{ 1.0978832703949288 } },
+        { real_type{ -0.5282118298909262 }, real_type{ -0.335880984968183973 }, real_type{ 0.51687296029754564 }, real_type{ 0.54604461446026 } },
+        { real_type{ 0.57650218263054642 }, real_type{ 1.01405596624706053 }, real_type{ 0.13009428079760464 }, real_type{ 0.7261913886869387 } },
+        { real_type{ -0.20981208921241892 }, real_type{ 0.60276937379453293 }, real_type{ -0.13086851759108944 }, real_type{ 0.10805254527169827 } },
+        { real_type{ 1.88494043717792 }, real_type{ 1.00518564317278263 }, real_type{ 0.298499933047586044 }, real_type{ 1.6464627048813514 } }
+    };
+    const std::vector<std::vector<real_type>> sparse_data{
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.51687296029754564 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 1.01405596624706053 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.60276937379453293 }, real_type{ 0.0 }, real_type{ -0.13086851759108944 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.298499933047586044 } }
+    };
+    std::vector<label_type> correct_label{};
+};
+TYPED_TEST_SUITE(BinaryParseWrite, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(BinaryParseWrite, dense_with_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // write and re-read the data
+    plssvm::detail::io::write_binary_data(this->filename, this->dense_data, this->correct_label);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_binary_data<real_type, label_type>(reader);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // the values must be bitwise identical and in the same order
+    EXPECT_EQ(data, this->dense_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(BinaryParseWrite, dense_without_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // write and re-read the data
+    plssvm::detail::io::write_binary_data(this->filename, this->dense_data);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_binary_data<real_type, label_type>(reader);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    EXPECT_EQ(data, this->dense_data);
+    EXPECT_TRUE(label.empty());
+}
+TYPED_TEST(BinaryParseWrite, sparse_with_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // write and re-read the data
+    plssvm::detail::io::write_binary_data(this->filename, this->sparse_data, this->correct_label);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_binary_data<real_type, label_type>(reader);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    EXPECT_EQ(data, this->sparse_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(BinaryParseWrite, sparse_without_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // write and re-read the data
+    plssvm::detail::io::write_binary_data(this->filename, this->sparse_data);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_binary_data<real_type, label_type>(reader);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    EXPECT_EQ(data, this->sparse_data);
+    EXPECT_TRUE(label.empty());
+}
+
+class BinaryParse : public ::testing::Test, protected util::temporary_file {
+  protected:
+    /**
+     * @brief Write a small valid binary file and overwrite @p num_bytes bytes at @p offset with @p value.
+     * @param[in] offset the offset of the bytes to overwrite
+     * @param[in] value the new bytes
+     * @param[in] num_bytes the number of bytes to overwrite
+     */
+    void write_corrupted_file(const std::size_t offset, const void *value, const std::size_t num_bytes) {
+        plssvm::detail::io::write_binary_data(this->filename, data, label);
+        std::string content = this->read_content();
+        std::memcpy(content.data() + offset, value, num_bytes);
+        this->write_content(content);
+    }
+    /**
+     * @brief Read the whole content of the temporary file.
+     * @return the file content (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::string read_content() const {
+        std::ifstream in{ this->filename, std::ios::binary };
+        return std::string{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+    }
+    /**
+     * @brief Overwrite the temporary file with @p content.
+     * @param[in] content the new file content
+     */
+    void write_content(const std::string &content) const {
+        std::ofstream out{ this->filename, std::ios::binary | std::ios::trunc };
+        out.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    const std::vector<std::vector<double>> data{ { 1.1, 1.2 }, { 2.1, 2.2 }, { 3.1, 3.2 } };
+    const std::vector<int> label{ -1, 1, -1 };
+};
+
+TEST_F(BinaryParse, float_to_double) {
+    const std::vector<std::vector<float>> float_data{ { 1.5f, -2.25f }, { 0.125f, 4.0f } };
+
+    // data written as float can be read as double
+    plssvm::detail::io::write_binary_data(this->filename, float_data);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, parsed_data, parsed_label] = plssvm::detail::io::parse_binary_data<double, int>(reader);
+
+    ASSERT_EQ(num_data_points, 2);
+    ASSERT_EQ(num_features, 2);
+    EXPECT_EQ(parsed_data, (std::vector<std::vector<double>>{ { 1.5, -2.25 }, { 0.125, 4.0 } }));
+    EXPECT_TRUE(parsed_label.empty());
+}
+TEST_F(BinaryParse, double_to_float) {
+    // data written as double can be read as float
+    plssvm::detail::io::write_binary_data(this->filename, data, label);
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, parsed_data, parsed_label] = plssvm::detail::io::parse_binary_data<float, int>(reader);
+
+    ASSERT_EQ(num_data_points, 3);
+    ASSERT_EQ(num_features, 2);
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(parsed_data, (std::vector<std::vector<float>>{ { 1.1f, 1.2f }, { 2.1f, 2.2f }, { 3.1f, 3.2f } }));
+    EXPECT_EQ(parsed_label, label);
+}
+TEST_F(BinaryParse, aligned_sections) {
+    // the dense data section must start at a 64 byte boundary
+    plssvm::detail::io::write_binary_data(this->filename, data);
+    const std::string content = this->read_content();
+    ASSERT_EQ(content.size(), plssvm::detail::io::binary_data_header_size + 3 * 2 * sizeof(double));
+
+    std::vector<double> values(6);
+    std::memcpy(values.data(), content.data() + plssvm::detail::io::binary_data_header_size, values.size() * sizeof(double));
+    EXPECT_EQ(values, (std::vector<double>{ 1.1, 1.2, 2.1, 2.2, 3.1, 3.2 }));
+}
+TEST_F(BinaryParse, empty) {
+    // parse an empty file
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/empty.txt" };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The binary file must start with \"PLSSVMDS\"!");
+}
+TEST_F(BinaryParse, libsvm_file) {
+    // parse a text file
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The binary file must start with \"PLSSVMDS\"!");
+}
+TEST_F(BinaryParse, unsupported_version) {
+    const std::uint32_t version{ 42 };
+    this->write_corrupted_file(8, &version, sizeof(version));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unsupported binary file format version 42 (supported: 1)!");
+}
+TEST_F(BinaryParse, different_byte_order) {
+    const std::uint32_t byte_order_mark{ 0x04030201 };
+    this->write_corrupted_file(12, &byte_order_mark, sizeof(byte_order_mark));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The binary file has been written on a machine with a different byte order!");
+}
+TEST_F(BinaryParse, invalid_real_type_size) {
+    const std::uint32_t real_type_size{ 2 };
+    this->write_corrupted_file(16, &real_type_size, sizeof(real_type_size));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The size of the stored floating point type must be 4 or 8, but is 2!");
+}
+TEST_F(BinaryParse, no_data_points) {
+    const std::uint64_t num_data_points{ 0 };
+    this->write_corrupted_file(24, &num_data_points, sizeof(num_data_points));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no data points are given!");
+}
+TEST_F(BinaryParse, no_features) {
+    const std::uint64_t num_features{ 0 };
+    this->write_corrupted_file(32, &num_features, sizeof(num_features));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no features are given!");
+}
+TEST_F(BinaryParse, invalid_label_index) {
+    // the label dictionary ("-1", "1") fits into the first 64 bytes after the header
+    const std::uint64_t label_index{ 2 };
+    this->write_corrupted_file(2 * plssvm::detail::io::binary_data_header_size + sizeof(std::uint64_t), &label_index, sizeof(label_index));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The label index 2 of the data point 1 must be less than the number of labels 2!");
+}
+TEST_F(BinaryParse, truncated_file) {
+    // remove the last data point
+    plssvm::detail::io::write_binary_data(this->filename, data, label);
+    std::string content = this->read_content();
+    const std::size_t num_bytes = content.size();
+    content.resize(num_bytes - 2 * sizeof(double));
+    this->write_content(content);
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("Unexpected end of the binary file: need {} bytes, but only {} are present!", num_bytes, num_bytes - 2 * sizeof(double)));
+}
+TEST_F(BinaryParse, corrupted_sizes) {
+    // corrupted sizes in the header must neither overflow nor result in huge allocations
+    for (const std::size_t offset : { 24, 32, 48 }) {
+        for (const std::uint64_t size : { std::uint64_t{ 1 } << 40, std::uint64_t{ 1 } << 62, ~std::uint64_t{ 0 } }) {
+            this->write_corrupted_file(offset, &size, sizeof(size));
+
+            const plssvm::detail::io::file_reader reader{ this->filename };
+            EXPECT_THROW(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)), plssvm::invalid_file_format_exception) << fmt::format("offset: {}, size: {}", offset, size);
+        }
+    }
+}
+TEST_F(BinaryParse, corrupted_label_length) {
+    // the length of the first label in the dictionary
+    const std::uint64_t length{ ~std::uint64_t{ 0 } - 4 };
+    this->write_corrupted_file(plssvm::detail::io::binary_data_header_size, &length, sizeof(length));
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)), plssvm::invalid_file_format_exception);
+}
+
+TEST(BinaryWrite, unwritable_file) {
+    // the file can't be created since its directory doesn't exist
+    const std::vector<std::vector<double>> data{ { 1.1, 1.2 } };
+    EXPECT_THROW_WHAT(plssvm::detail::io::write_binary_data("/non/existing/directory/data.bin", data),
+                      plssvm::file_exception,
+                      "Couldn't create the binary file \"/non/existing/directory/data.bin\"!");
+}
+#if defined(__linux__)
+TEST(BinaryWrite, full_disk) {
+    // every write to /dev/full fails with ENOSPC
+    const std::vector<std::vector<double>> data{ { 1.1, 1.2 }, { 2.1, 2.2 } };
+    EXPECT_THROW(plssvm::detail::io::write_binary_data("/dev/full", data), plssvm::file_exception);
+}
+#endif
+
+TEST(BinaryParseDeathTest, invalid_file_reader) {
+    // open file_reader without associating it to a file
+    const plssvm::detail::io::file_reader reader{};
+    EXPECT_DEATH(std::ignore = (plssvm::detail::io::parse_binary_data<double, int>(reader)),
+                 "The file_reader is currently not associated with a file!");
+}
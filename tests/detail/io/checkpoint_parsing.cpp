@@ -0,0 +1,120 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to parsing and writing the CG checkpoint files.
+ */
+
+#include "plssvm/detail/io/checkpoint_parsing.hpp"
+
+#include "plssvm/detail/io/file_reader.hpp"  // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_file_format_exception
+
+#include "../../custom_test_macros.hpp"      // EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                  // naming::real_type_to_name
+#include "../../types_to_test.hpp"           // util::real_type_gtest
+#include "../../utility.hpp"                 // util::temporary_file
+
+#include "gtest/gtest.h"                     // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_FALSE, ::testing::Test
+
+#include <filesystem>                        // std::filesystem::exists
+#include <string>                            // std::string
+#include <tuple>                             // std::ignore
+#include <vector>                            // std::vector
+
+template <typename T>
+class CheckpointRead : public ::testing::Test {};
+TYPED_TEST_SUITE(CheckpointRead, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(CheckpointRead, read) {
+    using real_type = TypeParam;
+
+    // parse the checkpoint
+    plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/checkpoint/checkpoint.txt" };
+    reader.read_lines('#');
+    const plssvm::detail::io::checkpoint_data<real_type> data = plssvm::detail::io::parse_checkpoint<real_type>(reader);
+
+    // check for correctness
+    EXPECT_EQ(data.fingerprint, "5ba8f1fa36b2cba5ab5a92f6e4e6bbb9ea44bfd1b2e2ae5e3e04d9f4c2d19ba3");
+    EXPECT_EQ(data.iteration, 100);
+    EXPECT_FLOATING_POINT_EQ(data.delta, real_type{ 0.25 });
+    EXPECT_FLOATING_POINT_EQ(data.delta0, real_type{ 12.5 });
+    EXPECT_FLOATING_POINT_VECTOR_EQ(data.x, (std::vector<real_type>{ real_type{ 0.1 }, real_type{ -0.2 }, real_type{ 0.3 }, real_type{ -0.4 } }));
+    EXPECT_FLOATING_POINT_VECTOR_EQ(data.r, (std::vector<real_type>{ real_type{ 0.25 }, real_type{ 0.25 }, real_type{ -0.25 }, real_type{ 0.25 } }));
+    EXPECT_FLOATING_POINT_VECTOR_EQ(data.d, (std::vector<real_type>{ real_type{ 0.5 }, real_type{ 0.25 }, real_type{ -0.5 }, real_type{ 0.25 } }));
+}
+TYPED_TEST(CheckpointRead, too_few_lines) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/checkpoint/invalid/too_few_lines.txt" };
+    reader.read_lines('#');
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_checkpoint<real_type>(reader),
+                      plssvm::invalid_file_format_exception,
+                      "Exactly eight lines must be present, but 7 were given!");
+}
+TYPED_TEST(CheckpointRead, wrong_entry_order) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/checkpoint/invalid/wrong_entry_order.txt" };
+    reader.read_lines('#');
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_checkpoint<real_type>(reader),
+                      plssvm::invalid_file_format_exception,
+                      "Expected the checkpoint entry \"iteration\", but got \"delta 0.25\"!");
+}
+TYPED_TEST(CheckpointRead, too_few_values) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/checkpoint/invalid/too_few_values.txt" };
+    reader.read_lines('#');
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_checkpoint<real_type>(reader),
+                      plssvm::invalid_file_format_exception,
+                      "The vector \"r\" must contain exactly 4 values, but contains 3!");
+}
+TYPED_TEST(CheckpointRead, invalid_iteration) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/checkpoint/invalid/invalid_iteration.txt" };
+    reader.read_lines('#');
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_checkpoint<real_type>(reader),
+                      plssvm::invalid_file_format_exception,
+                      "Can't convert 'abc' to a value of type unsigned long long!");
+}
+
+template <typename T>
+class CheckpointWrite : public ::testing::Test {
+  protected:
+    /// The temporary file the checkpoint is written to.
+    util::temporary_file tmp_file{};
+};
+TYPED_TEST_SUITE(CheckpointWrite, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(CheckpointWrite, write) {
+    using real_type = TypeParam;
+
+    // create a checkpoint
+    const plssvm::detail::io::checkpoint_data<real_type> data{
+        "fingerprint", 42, real_type{ 0.5 }, real_type{ 2.0 },
+        { real_type{ 1.5 }, real_type{ -2.5 } },
+        { real_type{ 0.125 }, real_type{ 0.25 } },
+        { real_type{ -1.0 }, real_type{ 3.0 } }
+    };
+
+    // write the checkpoint and read it again
+    plssvm::detail::io::write_checkpoint(this->tmp_file.filename, data);
+    EXPECT_FALSE(std::filesystem::exists(this->tmp_file.filename + ".tmp"));
+    plssvm::detail::io::file_reader reader{ this->tmp_file.filename };
+    reader.read_lines('#');
+    const plssvm::detail::io::checkpoint_data<real_type> read_data = plssvm::detail::io::parse_checkpoint<real_type>(reader);
+
+    // the read checkpoint must be equal to the written one
+    EXPECT_EQ(read_data.fingerprint, data.fingerprint);
+    EXPECT_EQ(read_data.iteration, data.iteration);
+    EXPECT_FLOATING_POINT_EQ(read_data.delta, data.delta);
+    EXPECT_FLOATING_POINT_EQ(read_data.delta0, data.delta0);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(read_data.x, data.x);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(read_data.r, data.r);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(read_data.d, data.d);
+}
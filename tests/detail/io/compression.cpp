@@ -0,0 +1,150 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the transparent decompression of gzip and Zstandard compressed input files.
+ */
+
+#include "plssvm/detail/io/compression.hpp"
+
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::file_not_found_exception, plssvm::invalid_file_format_exception
+
+#include "../../custom_test_macros.hpp"      // EXPECT_CONVERSION_TO_STRING, EXPECT_THROW_WHAT, EXPECT_THROW_WHAT_MATCHER
+
+#include "gmock/gmock-matchers.h"            // ::testing::HasSubstr
+#include "gtest/gtest.h"                     // TEST, TEST_P, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, GTEST_SKIP
+                                             // ::testing::{TestWithParam, Values}
+
+#include <fstream>                           // std::ifstream
+#include <ios>                               // std::ios
+#include <istream>                           // std::istream
+#include <iterator>                          // std::istreambuf_iterator
+#include <string>                            // std::string
+#include <tuple>                             // std::tuple, std::ignore
+#include <vector>                            // std::vector
+
+/**
+ * @brief Read the whole (raw) content of the file @p filename.
+ * @param[in] filename the file to read
+ * @return the file content (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::string read_file_content(const std::string &filename) {
+    std::ifstream in{ filename, std::ios::binary };
+    return std::string{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+}
+
+// check whether the plssvm::detail::io::compression_type -> std::string conversions are correct
+TEST(CompressionType, to_string) {
+    EXPECT_CONVERSION_TO_STRING(plssvm::detail::io::compression_type::none, "none");
+    EXPECT_CONVERSION_TO_STRING(plssvm::detail::io::compression_type::gzip, "gzip");
+    EXPECT_CONVERSION_TO_STRING(plssvm::detail::io::compression_type::zstd, "zstd");
+}
+TEST(CompressionType, to_string_unknown) {
+    // check conversions to std::string from unknown compression_type
+    EXPECT_CONVERSION_TO_STRING(static_cast<plssvm::detail::io::compression_type>(3), "unknown");
+}
+
+TEST(CompressionType, determine_compression_type) {
+    EXPECT_EQ(plssvm::detail::io::determine_compression_type("data.libsvm"), plssvm::detail::io::compression_type::none);
+    EXPECT_EQ(plssvm::detail::io::determine_compression_type("data.libsvm.gz"), plssvm::detail::io::compression_type::gzip);
+    EXPECT_EQ(plssvm::detail::io::determine_compression_type("data.arff.zst"), plssvm::detail::io::compression_type::zstd);
+    EXPECT_EQ(plssvm::detail::io::determine_compression_type("data.gz.libsvm"), plssvm::detail::io::compression_type::none);
+    EXPECT_EQ(plssvm::detail::io::determine_compression_type(""), plssvm::detail::io::compression_type::none);
+}
+TEST(CompressionType, remove_compression_extension) {
+    EXPECT_EQ(plssvm::detail::io::remove_compression_extension("data.libsvm"), "data.libsvm");
+    EXPECT_EQ(plssvm::detail::io::remove_compression_extension("data.libsvm.gz"), "data.libsvm");
+    EXPECT_EQ(plssvm::detail::io::remove_compression_extension("data.arff.zst"), "data.arff");
+    EXPECT_EQ(plssvm::detail::io::remove_compression_extension("data.bin.gz"), "data.bin");
+}
+TEST(CompressionType, is_compression_type_supported) {
+    EXPECT_TRUE(plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::compression_type::none));
+#if defined(PLSSVM_HAS_ZLIB)
+    EXPECT_TRUE(plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::compression_type::gzip));
+#else
+    EXPECT_FALSE(plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::compression_type::gzip));
+#endif
+#if defined(PLSSVM_HAS_ZSTD)
+    EXPECT_TRUE(plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::compression_type::zstd));
+#else
+    EXPECT_FALSE(plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::compression_type::zstd));
+#endif
+}
+
+// the compressed file and the uncompressed original file
+class Decompress : public ::testing::TestWithParam<std::tuple<std::string, std::string>> {
+  protected:
+    void SetUp() override {
+        // skip the test if the compression type isn't supported in this build
+        if (!plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::determine_compression_type(std::get<0>(GetParam())))) {
+            GTEST_SKIP() << "The compression type isn't supported!";
+        }
+    }
+};
+TEST_P(Decompress, decompress) {
+    const auto &[compressed_filename, filename] = GetParam();
+
+    // decompress the whole file at once
+    const std::string compressed_content = read_file_content(compressed_filename);
+    const std::vector<char> content = plssvm::detail::io::decompress(compressed_content, plssvm::detail::io::determine_compression_type(compressed_filename), compressed_filename);
+
+    // the content must be identical to the uncompressed file
+    EXPECT_EQ(std::string(content.begin(), content.end()), read_file_content(filename));
+}
+TEST_P(Decompress, decompressing_streambuf) {
+    const auto &[compressed_filename, filename] = GetParam();
+
+    // decompress the file on-the-fly
+    plssvm::detail::io::decompressing_streambuf buffer{ compressed_filename, plssvm::detail::io::determine_compression_type(compressed_filename) };
+    std::istream in{ &buffer };
+    const std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+
+    // the content must be identical to the uncompressed file
+    EXPECT_EQ(content, read_file_content(filename));
+}
+INSTANTIATE_TEST_SUITE_P(Decompress, Decompress, ::testing::Values(
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_multi_member.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_bgzf.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.arff.gz", PLSSVM_TEST_PATH "/data/arff/5x4.arff"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_multi_frame.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_no_content_size.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.arff.zst", PLSSVM_TEST_PATH "/data/arff/5x4.arff")));
+
+// the invalid compressed file and a part of the expected error message
+class DecompressInvalid : public Decompress {};
+TEST_P(DecompressInvalid, decompress) {
+    const auto &[compressed_filename, msg] = GetParam();
+
+    const std::string compressed_content = read_file_content(compressed_filename);
+    EXPECT_THROW_WHAT_MATCHER(std::ignore = plssvm::detail::io::decompress(compressed_content, plssvm::detail::io::determine_compression_type(compressed_filename), compressed_filename),
+                              plssvm::invalid_file_format_exception,
+                              ::testing::HasSubstr(msg));
+}
+TEST_P(DecompressInvalid, decompressing_streambuf) {
+    const auto &[compressed_filename, msg] = GetParam();
+
+    plssvm::detail::io::decompressing_streambuf buffer{ compressed_filename, plssvm::detail::io::determine_compression_type(compressed_filename) };
+    std::istream in{ &buffer };
+    EXPECT_THROW_WHAT_MATCHER((std::string{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} }),
+                              plssvm::invalid_file_format_exception,
+                              ::testing::HasSubstr(msg));
+}
+INSTANTIATE_TEST_SUITE_P(Decompress, DecompressInvalid, ::testing::Values(
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/truncated.libsvm.gz", "is truncated!"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/invalid.libsvm.gz", "Error while decompressing the gzip compressed file"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/invalid_bgzf.libsvm.gz", "incorrect length check!"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/oversized_bgzf.libsvm.gz", "incorrect length check!"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/truncated.libsvm.zst", "is truncated!"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/invalid.libsvm.zst", "Error while decompressing the zstd compressed file"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/oversized.libsvm.zst", "Error while decompressing the zstd compressed file")));
+
+TEST(DecompressingStreambuf, file_not_found) {
+    EXPECT_THROW_WHAT((plssvm::detail::io::decompressing_streambuf{ "foo.libsvm.gz", plssvm::detail::io::compression_type::gzip }),
+                      plssvm::file_not_found_exception,
+                      "Couldn't find file: 'foo.libsvm.gz'!");
+}
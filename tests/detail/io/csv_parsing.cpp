@@ -0,0 +1,381 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to parsing and writing the data points from and to a CSV file.
+ */
+
+#include "plssvm/detail/io/csv_parsing.hpp"
+
+#include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
+#include "plssvm/detail/io/file_reader.hpp"        // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"            // plssvm::csv_options
+
+#include "../../custom_test_macros.hpp"            // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                        // naming::{real_type_to_name, real_type_label_type_combination_to_name}
+#include "../../types_to_test.hpp"                 // util::{real_type_gtest, real_type_label_type_combination_gtest}
+#include "../../utility.hpp"                       // util::{temporary_file, instantiate_template_file, get_distinct_label}
+
+#include "fmt/core.h"                              // fmt::format
+#include "gmock/gmock-matchers.h"                  // ::testing::HasSubstr
+#include "gtest/gtest.h"                           // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_TRUE, EXPECT_DEATH, ASSERT_EQ, ::testing::Test
+
+#include <cstddef>                                 // std::size_t
+#include <fstream>                                 // std::ofstream
+#include <optional>                                // std::nullopt
+#include <string>                                  // std::string
+#include <tuple>                                   // std::ignore
+#include <vector>                                  // std::vector
+
+template <typename T>
+class CSVParseDense : public ::testing::Test, protected util::temporary_file {
+  protected:
+    void SetUp() override {
+        // create file used in this test fixture by instantiating the template file
+        util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/csv/5x4_TEMPLATE.csv", this->filename);
+        // create a vector with the correct labels
+        const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+        correct_label = std::vector<label_type>{ first_label, first_label, second_label, second_label, second_label };
+    }
+
+    using real_type = typename T::real_type;
+    using label_type = typename T::label_type;
+
+    const std::vector<std::vector<real_type>> correct_data{
+        { real_type{ -1.117827500607882 }, real_type{ -2.9087188881250993 }, real_type{ 0.66638344270039144 }, real_type{ 1.0978832703949288 } },
+        { real_type{ -0.5282118298909262 }, real_type{ -0.335880984968183973 }, real_type{ 0.51687296029754564 }, real_type{ 0.54604461446026 } },
+        { real_type{ 0.57650218263054642 }, real_type{ 1.01405596624706053 }, real_type{ 0.13009428079760464 }, real_type{ 0.7261913886869387 } },
+        { real_type{ -0.20981208921241892 }, real_type{ 0.60276937379453293 }, real_type{ -0.13086851759108944 }, real_type{ 0.10805254527169827 } },
+        { real_type{ 1.88494043717792 }, real_type{ 1.00518564317278263 }, real_type{ 0.298499933047586044 }, real_type{ 1.6464627048813514 } }
+    };
+    std::vector<label_type> correct_label{};
+};
+TYPED_TEST_SUITE(CSVParseDense, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(CSVParseDense, read) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // parse the CSV file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, this->correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(CSVParseDense, read_chunked) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // parse the CSV file using more byte ranges than lines
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader, plssvm::csv_options{}, 7);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // the data points must be in file order
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, this->correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+
+template <typename T>
+class CSVParseBase : public ::testing::Test, protected util::temporary_file {
+  protected:
+    /**
+     * @brief Write the @p content to the temporary file.
+     * @param[in] content the content to write
+     */
+    void write_content(const std::string &content) {
+        std::ofstream out{ this->filename };
+        out << content;
+    }
+};
+
+template <typename T>
+class CSVParse : public CSVParseBase<T> {};
+TYPED_TEST_SUITE(CSVParse, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+template <typename T>
+class CSVParseIntegralLabel : public CSVParseBase<T> {};
+TYPED_TEST_SUITE(CSVParseIntegralLabel, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(CSVParseIntegralLabel, read_header_delimiter_and_label_column) {
+    using real_type = TypeParam;
+
+    // parse the CSV file with a header, ';' as delimiter, and the labels in the first column
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/csv/5x4_header.csv" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_csv_data<real_type, int>(reader, plssvm::csv_options{ ';', true, 0 });
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    const std::vector<std::vector<real_type>> correct_data{
+        { real_type{ -1.117827500607882 }, real_type{ -2.9087188881250993 }, real_type{ 0.66638344270039144 }, real_type{ 1.0978832703949288 } },
+        { real_type{ -0.5282118298909262 }, real_type{ -0.335880984968183973 }, real_type{ 0.51687296029754564 }, real_type{ 0.54604461446026 } },
+        { real_type{ 0.57650218263054642 }, real_type{ 1.01405596624706053 }, real_type{ 0.13009428079760464 }, real_type{ 0.7261913886869387 } },
+        { real_type{ -0.20981208921241892 }, real_type{ 0.60276937379453293 }, real_type{ -0.13086851759108944 }, real_type{ 0.10805254527169827 } },
+        { real_type{ 1.88494043717792 }, real_type{ 1.00518564317278263 }, real_type{ 0.298499933047586044 }, real_type{ 1.6464627048813514 } }
+    };
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, correct_data);
+    EXPECT_EQ(label, (std::vector<int>{ 1, 1, -1, -1, -1 }));
+}
+TYPED_TEST(CSVParse, read_without_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // parse the CSV file
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/csv/3x2_without_label.csv" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader, plssvm::csv_options{ ',', false, std::nullopt });
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 3);
+    ASSERT_EQ(num_features, 2);
+
+    // check for correct data
+    const std::vector<std::vector<real_type>> correct_data{
+        { real_type{ 1.5 }, real_type{ -2.9 } },
+        { real_type{ 0.0 }, real_type{ -0.3 } },
+        { real_type{ 5.5 }, real_type{ 0.0 } }
+    };
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, correct_data);
+    EXPECT_TRUE(label.empty());
+}
+TYPED_TEST(CSVParseIntegralLabel, floating_point_integral_labels) {
+    using real_type = TypeParam;
+
+    // numeric exporters, e.g., numpy.savetxt, write integral labels in floating point notation
+    this->write_content("1.5,1.000000000000000000e+00\r\n2.5,-1.0\n\n3.5,1\n");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_csv_data<real_type, int>(reader);
+
+    // check for correct data
+    ASSERT_EQ(num_data_points, 3);
+    ASSERT_EQ(num_features, 1);
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1, 1 }));
+}
+TYPED_TEST(CSVParseIntegralLabel, non_integral_label) {
+    using real_type = TypeParam;
+
+    // a non-integral label can't be converted to an integral label type
+    this->write_content("1.5,1.5\n");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Can't convert the non-integral label 1.5 to a value of type int!");
+}
+TYPED_TEST(CSVParse, missing_value) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // the second line contains too few values
+    this->write_content("1.5,2.5,1\n1.5,1\n");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Each line of the CSV file must contain 3 values, but \"1.5,1\" contains 2!");
+}
+TYPED_TEST(CSVParse, too_many_values) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // the second line contains too many values
+    this->write_content("1.5,2.5,1\n1.5,2.5,3.5,1\n");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Each line of the CSV file must contain 3 values, but \"1.5,2.5,3.5,1\" contains 4!");
+}
+TYPED_TEST(CSVParse, invalid_feature_value) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // the feature value isn't a number
+    this->write_content("1.5,foo,1\n");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("Can't convert 'foo' to a value of type {}!", plssvm::detail::arithmetic_type_name<real_type>()));
+}
+TYPED_TEST(CSVParse, label_column_out_of_range) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // the CSV file only has 5 columns
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/csv/5x4_header.csv" };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader, plssvm::csv_options{ ';', true, -6 })),
+                      plssvm::invalid_file_format_exception,
+                      "The label column -6 is out of range for a CSV file with 5 columns!");
+}
+TYPED_TEST(CSVParse, no_features) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // only a label column is present
+    this->write_content("1\n2\n");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no features are given!");
+}
+TYPED_TEST(CSVParse, only_header) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // the file only contains a header
+    this->write_content("feature_1,feature_2,label\n");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader, plssvm::csv_options{ ',', true, -1 })),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no data points are given!");
+}
+TYPED_TEST(CSVParse, empty) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // parse an empty file
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/empty.txt" };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no data points are given!");
+}
+
+template <typename T>
+class CSVParseDeathTest : public ::testing::Test {};
+TYPED_TEST_SUITE(CSVParseDeathTest, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(CSVParseDeathTest, invalid_file_reader) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // open file_reader without associating it to a file
+    const plssvm::detail::io::file_reader reader{};
+    // try to parse the CSV file
+    EXPECT_DEATH((std::ignore = plssvm::detail::io::parse_csv_data<real_type, label_type>(reader)),
+                 "The file_reader is currently not associated with a file!");
+}
+
+template <typename T>
+class CSVWriteBase : public ::testing::Test, protected util::temporary_file {};
+
+template <typename T>
+class CSVWrite : public CSVWriteBase<T> {};
+TYPED_TEST_SUITE(CSVWrite, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+template <typename T>
+class CSVWriteDeathTest : public CSVWriteBase<T> {};
+TYPED_TEST_SUITE(CSVWriteDeathTest, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(CSVWrite, write_with_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // define data to write
+    const std::vector<std::vector<real_type>> data{
+        { real_type{ 1.1 }, real_type{ 1.2 }, real_type{ 1.3 } },
+        { real_type{ 2.1 }, real_type{ 2.2 }, real_type{ 2.3 } },
+        { real_type{ 3.1 }, real_type{ 3.2 }, real_type{ 3.3 } }
+    };
+    const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+    const std::vector<label_type> label = { first_label, second_label, first_label };
+
+    // write the necessary data to the file
+    plssvm::detail::io::write_csv_data(this->filename, data, label);
+
+    // read the previously written file to check for correctness
+    plssvm::detail::io::file_reader reader{ this->filename };
+    reader.read_lines('#');
+
+    // check the lines
+    ASSERT_EQ(reader.num_lines(), data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(i), fmt::format("{:.10e},{:.10e},{:.10e},{}", data[i][0], data[i][1], data[i][2], label[i]));
+    }
+
+    // the written file must be readable again
+    const plssvm::detail::io::file_reader csv_reader{ this->filename };
+    const auto [num_data_points, num_features, parsed_data, parsed_label] = plssvm::detail::io::parse_csv_data<real_type, label_type>(csv_reader);
+    ASSERT_EQ(num_data_points, 3);
+    ASSERT_EQ(num_features, 3);
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(parsed_data, data);
+    EXPECT_EQ(parsed_label, label);
+}
+TYPED_TEST(CSVWrite, write_without_label) {
+    using real_type = typename TypeParam::real_type;
+
+    // define data to write
+    const std::vector<std::vector<real_type>> data{
+        { real_type{ 1.1 }, real_type{ 1.2 }, real_type{ 1.3 } },
+        { real_type{ 2.1 }, real_type{ 2.2 }, real_type{ 2.3 } },
+        { real_type{ 3.1 }, real_type{ 3.2 }, real_type{ 3.3 } }
+    };
+
+    // write the necessary data to the file
+    plssvm::detail::io::write_csv_data(this->filename, data);
+
+    // read the previously written file to check for correctness
+    plssvm::detail::io::file_reader reader{ this->filename };
+    reader.read_lines('#');
+
+    // check the lines
+    ASSERT_EQ(reader.num_lines(), data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(i), fmt::format("{:.10e},{:.10e},{:.10e}", data[i][0], data[i][1], data[i][2]));
+    }
+}
+TYPED_TEST(CSVWrite, empty_data) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // define data to write
+    const std::vector<std::vector<real_type>> data{};
+    const std::vector<label_type> label{};
+
+    // write the necessary data to the file
+    plssvm::detail::io::write_csv_data(this->filename, data, label);
+
+    // read the previously written file to check for correctness
+    plssvm::detail::io::file_reader reader{ this->filename };
+    reader.read_lines('#');
+
+    EXPECT_EQ(reader.num_lines(), 0);
+    EXPECT_TRUE(reader.lines().empty());
+}
+
+TYPED_TEST(CSVWriteDeathTest, data_with_provided_empty_labels) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // define data to write
+    const std::vector<std::vector<real_type>> data{ { real_type{ 1.0 } } };
+    const std::vector<label_type> label{};
+
+    // try to write the necessary data to the file
+    EXPECT_DEATH(plssvm::detail::io::write_csv_data(this->filename, data, label), "has_label is 'true' but no labels were provided!");
+}
+TYPED_TEST(CSVWriteDeathTest, data_and_label_size_mismatch) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // define data to write
+    const std::vector<std::vector<real_type>> data{ { real_type{ 1.0 } }, { real_type{ 2.0 } } };
+    const std::vector<label_type> label{ plssvm::detail::convert_to<label_type>("0") };
+
+    // try to write the necessary data to the file
+    EXPECT_DEATH(plssvm::detail::io::write_csv_data(this->filename, data, label),
+                 ::testing::HasSubstr("Number of data points (2) and number of labels (1) mismatch!"));
+}
@@ -0,0 +1,290 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the cache storing the parsed content of text data set files as binary images.
+ */
+
+#include "plssvm/detail/io/data_set_cache.hpp"
+
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::{file_not_found_exception, file_exception}
+
+#include "../../custom_test_macros.hpp"      // EXPECT_CONVERSION_TO_STRING, EXPECT_THROW_WHAT
+#include "../../utility.hpp"                 // util::temporary_file
+
+#include "fmt/core.h"                        // fmt::format
+#include "gtest/gtest.h"                     // TEST, TEST_F, EXPECT_EQ, EXPECT_NE, EXPECT_TRUE, EXPECT_FALSE, ASSERT_TRUE, ::testing::Test
+
+#include <chrono>                            // std::chrono::hours
+#include <cstddef>                           // std::size_t
+#include <cstdint>                           // std::uintmax_t
+#include <cstdlib>                           // std::getenv
+#include <filesystem>                        // std::filesystem::{path, temp_directory_path, exists, remove_all, last_write_time, file_size, directory_iterator, status, permissions, perms}
+#include <fstream>                           // std::ofstream
+#include <optional>                          // std::optional
+#include <string>                            // std::string
+#include <tuple>                             // std::ignore
+
+class DataSetCache : public ::testing::Test, protected util::temporary_file {
+  protected:
+    void SetUp() override {
+        options.enabled = true;
+        options.directory = filename + "_cache";
+        options.max_size = 0;
+        // the data set file to cache
+        std::ofstream{ filename } << "1 1:1.5 2:-2.5\n-1 1:0.5 2:3.5\n";
+    }
+    void TearDown() override {
+        std::filesystem::remove_all(options.directory);
+    }
+
+    /**
+     * @brief Create the cache @p entry with @p num_bytes bytes and the last usage @p age hours in the past.
+     * @param[in] entry the cache entry
+     * @param[in] num_bytes the size of the cache entry
+     * @param[in] age the number of hours since the last usage
+     */
+    void create_entry(const std::filesystem::path &entry, const std::size_t num_bytes, const int age) const {
+        std::filesystem::create_directories(options.directory);
+        std::ofstream{ entry } << std::string(num_bytes, 'x');
+        std::filesystem::last_write_time(entry, std::filesystem::file_time_type::clock::now() - std::chrono::hours{ age });
+    }
+
+    /**
+     * @brief Return the number of cache entries in the cache directory.
+     * @return the number of cache entries (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_entries() const {
+        std::size_t count{ 0 };
+        for (const auto &entry : std::filesystem::directory_iterator{ options.directory }) {
+            count += entry.path().extension() == ".bin" ? 1 : 0;
+        }
+        return count;
+    }
+
+    /// The data set cache options using a unique cache directory.
+    plssvm::data_set_cache_options options{};
+};
+
+TEST(DataSetCacheOptions, default_construct) {
+    const plssvm::data_set_cache_options options{};
+    EXPECT_FALSE(options.enabled);
+    EXPECT_TRUE(options.directory.empty());
+    EXPECT_EQ(options.max_size, std::uintmax_t{ 8 } * 1024 * 1024 * 1024);
+    EXPECT_FALSE(options.fingerprint);
+    // the global data set cache must be disabled by default
+    EXPECT_FALSE(plssvm::data_set_cache.enabled);
+}
+TEST(DataSetCacheOptions, to_string) {
+    plssvm::data_set_cache_options options{};
+    EXPECT_CONVERSION_TO_STRING(options, "disabled");
+    options.enabled = true;
+    options.directory = "/tmp/cache";
+    options.max_size = 1024;
+    EXPECT_CONVERSION_TO_STRING(options, "'/tmp/cache' (max size: 1024 bytes, fingerprint: false)");
+}
+
+TEST(DataSetCacheDirectory, default_directory) {
+    const std::filesystem::path directory = plssvm::detail::io::data_set_cache_directory(plssvm::data_set_cache_options{});
+    // the default directory must be user specific
+    if (const char *xdg_cache_home = std::getenv("XDG_CACHE_HOME"); xdg_cache_home != nullptr && std::filesystem::path{ xdg_cache_home }.is_absolute()) {
+        EXPECT_EQ(directory, std::filesystem::path{ xdg_cache_home } / "plssvm" / "data_set_cache");
+    } else if (const char *home = std::getenv("HOME"); home != nullptr && std::filesystem::path{ home }.is_absolute()) {
+        EXPECT_EQ(directory, std::filesystem::path{ home } / ".cache" / "plssvm" / "data_set_cache");
+    } else {
+        EXPECT_NE(directory, std::filesystem::temp_directory_path() / "plssvm_data_set_cache");
+    }
+}
+TEST(DataSetCacheDirectory, user_defined_directory) {
+    plssvm::data_set_cache_options options{};
+    options.directory = "/path/to/cache";
+    EXPECT_EQ(plssvm::detail::io::data_set_cache_directory(options), std::filesystem::path{ "/path/to/cache" });
+}
+
+TEST_F(DataSetCache, fingerprint) {
+    // the fingerprint is a sha256 hash
+    const std::string fingerprint = plssvm::detail::io::data_set_cache_fingerprint(filename);
+    EXPECT_EQ(fingerprint.size(), 64);
+    // the fingerprint must be deterministic
+    EXPECT_EQ(plssvm::detail::io::data_set_cache_fingerprint(filename), fingerprint);
+
+    // changing the content must change the fingerprint
+    std::ofstream{ filename } << "1 1:1.5 2:-2.5\n-1 1:0.5 2:3.6\n";
+    EXPECT_NE(plssvm::detail::io::data_set_cache_fingerprint(filename), fingerprint);
+}
+TEST_F(DataSetCache, fingerprint_large_file) {
+    // create a file larger than all samples combined
+    const std::size_t num_bytes = 2 * plssvm::detail::io::data_set_cache_num_fingerprint_samples * plssvm::detail::io::data_set_cache_fingerprint_sample_size;
+    std::ofstream{ filename } << std::string(num_bytes, 'a');
+    const std::string fingerprint = plssvm::detail::io::data_set_cache_fingerprint(filename);
+
+    // changing the last byte must change the fingerprint since the last sample is located at the end of the file
+    std::ofstream{ filename } << std::string(num_bytes - 1, 'a') << 'b';
+    EXPECT_NE(plssvm::detail::io::data_set_cache_fingerprint(filename), fingerprint);
+}
+TEST_F(DataSetCache, fingerprint_missing_file) {
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::data_set_cache_fingerprint(filename + ".missing"),
+                      plssvm::file_not_found_exception,
+                      fmt::format("Couldn't find file: '{}.missing'!", filename));
+}
+
+TEST_F(DataSetCache, entry) {
+    const std::optional<std::filesystem::path> entry = plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm");
+    ASSERT_TRUE(entry.has_value());
+    // the entry must be located in the cache directory
+    EXPECT_EQ(entry.value().parent_path(), options.directory);
+    EXPECT_EQ(entry.value().extension(), ".bin");
+    // the entry must be deterministic
+    EXPECT_EQ(plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm"), entry);
+    // the cache entry must not be created
+    EXPECT_FALSE(std::filesystem::exists(entry.value()));
+}
+TEST_F(DataSetCache, entry_different_parser_settings) {
+    EXPECT_NE(plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm"), plssvm::detail::io::data_set_cache_entry(options, filename, "arff"));
+}
+TEST_F(DataSetCache, entry_modified_file) {
+    const std::optional<std::filesystem::path> entry = plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm");
+    // changing the last modification time must result in a different cache entry
+    std::filesystem::last_write_time(filename, std::filesystem::last_write_time(filename) - std::chrono::hours{ 1 });
+    EXPECT_NE(plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm"), entry);
+}
+TEST_F(DataSetCache, entry_fingerprint) {
+    plssvm::data_set_cache_options options_without_fingerprint{ options };
+    options.fingerprint = true;
+    const std::optional<std::filesystem::path> entry = plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm");
+    const std::optional<std::filesystem::path> entry_without_fingerprint = plssvm::detail::io::data_set_cache_entry(options_without_fingerprint, filename, "libsvm");
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_NE(entry, entry_without_fingerprint);
+
+    // change the content, but not the size and last modification time
+    const std::filesystem::file_time_type last_write_time = std::filesystem::last_write_time(filename);
+    std::ofstream{ filename } << "1 1:1.5 2:-2.5\n-1 1:0.5 2:3.6\n";
+    std::filesystem::last_write_time(filename, last_write_time);
+
+    // only the fingerprint detects the change
+    EXPECT_NE(plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm"), entry);
+    EXPECT_EQ(plssvm::detail::io::data_set_cache_entry(options_without_fingerprint, filename, "libsvm"), entry_without_fingerprint);
+}
+TEST_F(DataSetCache, entry_disabled) {
+    options.enabled = false;
+    EXPECT_FALSE(plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm").has_value());
+}
+TEST_F(DataSetCache, entry_missing_file) {
+    EXPECT_FALSE(plssvm::detail::io::data_set_cache_entry(options, filename + ".missing", "libsvm").has_value());
+}
+TEST_F(DataSetCache, entry_directory) {
+    EXPECT_FALSE(plssvm::detail::io::data_set_cache_entry(options, std::filesystem::temp_directory_path().string(), "libsvm").has_value());
+}
+
+TEST_F(DataSetCache, touch_entry) {
+    const std::filesystem::path entry = options.directory / "entry.bin";
+    EXPECT_FALSE(plssvm::detail::io::touch_data_set_cache_entry(entry));
+
+    // touching an entry must mark it as most recently used
+    this->create_entry(entry, 16, 10);
+    const std::filesystem::file_time_type last_usage = std::filesystem::last_write_time(entry);
+    EXPECT_TRUE(plssvm::detail::io::touch_data_set_cache_entry(entry));
+    EXPECT_GT(std::filesystem::last_write_time(entry), last_usage);
+}
+TEST_F(DataSetCache, remove_entry) {
+    const std::filesystem::path entry = options.directory / "entry.bin";
+    this->create_entry(entry, 16, 0);
+    plssvm::detail::io::remove_data_set_cache_entry(entry);
+    EXPECT_FALSE(std::filesystem::exists(entry));
+    // removing a non-existing entry must not throw
+    plssvm::detail::io::remove_data_set_cache_entry(entry);
+}
+
+TEST_F(DataSetCache, create_and_commit_entry) {
+    const std::filesystem::path entry = plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm").value();
+
+    // the temporary file must be located in the (newly created) cache directory
+    const std::filesystem::path temporary_file = plssvm::detail::io::create_data_set_cache_file(options, entry);
+    EXPECT_TRUE(std::filesystem::is_directory(options.directory));
+    EXPECT_EQ(temporary_file.parent_path(), options.directory);
+    EXPECT_NE(temporary_file, entry);
+    // concurrent writers must use different temporary files
+    EXPECT_NE(plssvm::detail::io::create_data_set_cache_file(options, entry), temporary_file);
+
+    // committing the temporary file must publish the cache entry
+    std::ofstream{ temporary_file } << "binary image";
+    EXPECT_TRUE(plssvm::detail::io::commit_data_set_cache_entry(options, temporary_file, entry));
+    EXPECT_FALSE(std::filesystem::exists(temporary_file));
+    EXPECT_TRUE(std::filesystem::exists(entry));
+}
+TEST_F(DataSetCache, create_entry_directory_permissions) {
+    const std::filesystem::path entry = options.directory / "entry.bin";
+    std::ignore = plssvm::detail::io::create_data_set_cache_file(options, entry);
+    // only the current user may access the newly created cache directory
+    EXPECT_EQ(std::filesystem::status(options.directory).permissions(), std::filesystem::perms::owner_all);
+}
+TEST_F(DataSetCache, insecure_directory) {
+    std::filesystem::create_directories(options.directory);
+    std::filesystem::permissions(options.directory, std::filesystem::perms::others_write, std::filesystem::perm_options::add);
+
+    // a cache directory writable by other users must never be used
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm"),
+                      plssvm::file_exception,
+                      fmt::format("The data set cache directory \"{}\" is writable by other users!", options.directory.string()));
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::create_data_set_cache_file(options, options.directory / "entry.bin"),
+                      plssvm::file_exception,
+                      fmt::format("The data set cache directory \"{}\" is writable by other users!", options.directory.string()));
+}
+TEST_F(DataSetCache, no_directory) {
+    // the cache directory must be a directory
+    options.directory = filename;
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::data_set_cache_entry(options, filename, "libsvm"),
+                      plssvm::file_exception,
+                      fmt::format("The data set cache directory \"{}\" isn't a directory!", filename));
+}
+TEST_F(DataSetCache, commit_too_large_entry) {
+    options.max_size = 8;
+    const std::filesystem::path entry = options.directory / "entry.bin";
+    const std::filesystem::path temporary_file = plssvm::detail::io::create_data_set_cache_file(options, entry);
+    this->create_entry(options.directory / "old.bin", 8, 1);
+
+    // an entry larger than the whole cache must be discarded without evicting other entries
+    std::ofstream{ temporary_file } << std::string(16, 'x');
+    EXPECT_FALSE(plssvm::detail::io::commit_data_set_cache_entry(options, temporary_file, entry));
+    EXPECT_FALSE(std::filesystem::exists(temporary_file));
+    EXPECT_FALSE(std::filesystem::exists(entry));
+    EXPECT_TRUE(std::filesystem::exists(options.directory / "old.bin"));
+}
+
+TEST_F(DataSetCache, evict_least_recently_used_entries) {
+    options.max_size = 40;
+    this->create_entry(options.directory / "a.bin", 16, 3);
+    this->create_entry(options.directory / "b.bin", 16, 1);
+    this->create_entry(options.directory / "c.bin", 16, 2);
+    this->create_entry(options.directory / "d.bin", 16, 0);
+    ASSERT_EQ(this->num_entries(), 4);
+
+    // the two least recently used entries must be evicted
+    EXPECT_EQ(plssvm::detail::io::evict_data_set_cache_entries(options), 2);
+    EXPECT_FALSE(std::filesystem::exists(options.directory / "a.bin"));
+    EXPECT_TRUE(std::filesystem::exists(options.directory / "b.bin"));
+    EXPECT_FALSE(std::filesystem::exists(options.directory / "c.bin"));
+    EXPECT_TRUE(std::filesystem::exists(options.directory / "d.bin"));
+}
+TEST_F(DataSetCache, evict_ignores_other_files) {
+    options.max_size = 8;
+    this->create_entry(options.directory / "a.bin", 16, 1);
+    this->create_entry(options.directory / "a.bin.0123abcd.tmp", 16, 2);
+
+    // only cache entries are evicted
+    EXPECT_EQ(plssvm::detail::io::evict_data_set_cache_entries(options), 1);
+    EXPECT_FALSE(std::filesystem::exists(options.directory / "a.bin"));
+    EXPECT_TRUE(std::filesystem::exists(options.directory / "a.bin.0123abcd.tmp"));
+}
+TEST_F(DataSetCache, evict_without_limit) {
+    this->create_entry(options.directory / "a.bin", 1024, 1);
+    EXPECT_EQ(plssvm::detail::io::evict_data_set_cache_entries(options), 0);
+    EXPECT_TRUE(std::filesystem::exists(options.directory / "a.bin"));
+}
+TEST_F(DataSetCache, evict_missing_directory) {
+    options.max_size = 8;
+    EXPECT_EQ(plssvm::detail::io::evict_data_set_cache_entries(options), 0);
+}
@@ -0,0 +1,181 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the column projection and row sampling used to read only a subset of a data set file.
+ */
+
+#include "plssvm/detail/io/data_set_subset.hpp"
+
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_parameter_exception, plssvm::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"      // plssvm::subset_options
+#include "plssvm/sampling_types.hpp"         // plssvm::sampling_type
+
+#include "../../custom_test_macros.hpp"      // EXPECT_THROW_WHAT
+
+#include "fmt/core.h"                        // fmt::format
+#include "gtest/gtest.h"                     // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, ASSERT_EQ, EXPECT_THROW, EXPECT_NO_THROW
+
+#include <algorithm>                         // std::is_sorted, std::adjacent_find, std::count
+#include <cstddef>                           // std::size_t
+#include <string>                            // std::string
+#include <vector>                            // std::vector
+
+TEST(FeatureSelection, parse) {
+    EXPECT_EQ(plssvm::detail::io::parse_feature_selection("3"), (std::vector<std::size_t>{ 3 }));
+    EXPECT_EQ(plssvm::detail::io::parse_feature_selection("0-3,7, 5 ,9-9"), (std::vector<std::size_t>{ 0, 1, 2, 3, 5, 7, 9 }));
+    // duplicates are removed
+    EXPECT_EQ(plssvm::detail::io::parse_feature_selection("4,1-4,2"), (std::vector<std::size_t>{ 1, 2, 3, 4 }));
+}
+TEST(FeatureSelection, parse_invalid) {
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_feature_selection(""), plssvm::invalid_parameter_exception, "The feature selection must not be empty!");
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_feature_selection("1,,2"), plssvm::invalid_parameter_exception, "Invalid feature selection \"1,,2\": empty entries are not allowed!");
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_feature_selection("5-3"), plssvm::invalid_parameter_exception, "Invalid feature range \"5-3\": the first index 5 must not be larger than the last index 3!");
+    EXPECT_THROW(std::ignore = plssvm::detail::io::parse_feature_selection("a"), plssvm::invalid_parameter_exception);
+    EXPECT_THROW(std::ignore = plssvm::detail::io::parse_feature_selection("-1"), plssvm::invalid_parameter_exception);
+    // huge ranges are rejected before they are expanded
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::io::parse_feature_selection("0-18446744073709551614"), plssvm::invalid_parameter_exception, fmt::format("Invalid feature selection \"0-18446744073709551614\": at most {} feature indices may be selected!", plssvm::detail::io::max_num_selected_features));
+    EXPECT_THROW(std::ignore = plssvm::detail::io::parse_feature_selection(fmt::format("0-{},42", plssvm::detail::io::max_num_selected_features - 1)), plssvm::invalid_parameter_exception);
+}
+TEST(FeatureSelection, parse_large_indices) {
+    // large indices don't require large allocations
+    EXPECT_EQ(plssvm::detail::io::parse_feature_selection("18446744073709551615"), (std::vector<std::size_t>{ 18446744073709551615ULL }));
+    EXPECT_EQ(plssvm::detail::io::parse_feature_selection("18446744073709551614-18446744073709551615"), (std::vector<std::size_t>{ 18446744073709551614ULL, 18446744073709551615ULL }));
+}
+TEST(FeatureSelection, format) {
+    EXPECT_EQ(plssvm::detail::io::format_feature_selection({}), "");
+    EXPECT_EQ(plssvm::detail::io::format_feature_selection({ 3 }), "3");
+    EXPECT_EQ(plssvm::detail::io::format_feature_selection({ 9, 0, 1, 2, 3, 5, 7, 3 }), "0-3,5,7,9");
+    // formatting and parsing are inverse operations
+    EXPECT_EQ(plssvm::detail::io::parse_feature_selection(plssvm::detail::io::format_feature_selection({ 0, 1, 4, 6, 7, 8 })), (std::vector<std::size_t>{ 0, 1, 4, 6, 7, 8 }));
+}
+
+TEST(FeatureProjection, default_construct) {
+    // a default constructed projection keeps all features
+    const plssvm::detail::io::feature_projection projection{};
+    EXPECT_TRUE(projection.keeps_all_features());
+    EXPECT_EQ(projection.num_features(), 0);
+    EXPECT_EQ(projection.max_index(), 0);
+    EXPECT_EQ(projection[0], 0);
+    EXPECT_EQ(projection[42], 42);
+}
+TEST(FeatureProjection, construct) {
+    // the features are sorted and duplicates are ignored
+    const plssvm::detail::io::feature_projection projection{ { 5, 1, 3, 3 } };
+    EXPECT_FALSE(projection.keeps_all_features());
+    EXPECT_EQ(projection.num_features(), 3);
+    EXPECT_EQ(projection.max_index(), 5);
+    EXPECT_EQ(projection[0], plssvm::detail::io::feature_projection::skip);
+    EXPECT_EQ(projection[1], 0);
+    EXPECT_EQ(projection[2], plssvm::detail::io::feature_projection::skip);
+    EXPECT_EQ(projection[3], 1);
+    EXPECT_EQ(projection[4], plssvm::detail::io::feature_projection::skip);
+    EXPECT_EQ(projection[5], 2);
+    EXPECT_EQ(projection[6], plssvm::detail::io::feature_projection::skip);
+    EXPECT_EQ(projection.features(), (std::vector<std::size_t>{ 1, 3, 5 }));
+}
+TEST(FeatureProjection, construct_large_index) {
+    // only the kept features are stored, independent of the largest kept feature index
+    const plssvm::detail::io::feature_projection projection{ { 1'000'000'000'000, 2 } };
+    EXPECT_EQ(projection.num_features(), 2);
+    EXPECT_EQ(projection.max_index(), 1'000'000'000'000);
+    EXPECT_EQ(projection[2], 0);
+    EXPECT_EQ(projection[999'999'999'999], plssvm::detail::io::feature_projection::skip);
+    EXPECT_EQ(projection[1'000'000'000'000], 1);
+}
+TEST(FeatureProjection, check) {
+    // all features are always present
+    EXPECT_NO_THROW(plssvm::detail::io::check_feature_projection(plssvm::detail::io::feature_projection{}, 0));
+    EXPECT_NO_THROW(plssvm::detail::io::check_feature_projection(plssvm::detail::io::feature_projection{ { 0, 3 } }, 4));
+    EXPECT_THROW_WHAT(plssvm::detail::io::check_feature_projection(plssvm::detail::io::feature_projection{ { 0, 4 } }, 4),
+                      plssvm::invalid_file_format_exception,
+                      "Can't keep the feature with index 4 since the data points only have 4 features!");
+}
+
+TEST(SampleUniform, sample) {
+    const std::vector<std::size_t> sample = plssvm::detail::io::sample_uniform(100, 10);
+    ASSERT_EQ(sample.size(), 10);
+    // the indices are unique, in increasing order, and valid
+    EXPECT_TRUE(std::is_sorted(sample.cbegin(), sample.cend()));
+    EXPECT_EQ(std::adjacent_find(sample.cbegin(), sample.cend()), sample.cend());
+    EXPECT_LT(sample.back(), 100);
+    // the sample is reproducible
+    EXPECT_EQ(plssvm::detail::io::sample_uniform(100, 10), sample);
+}
+TEST(SampleUniform, sample_all) {
+    // too many or zero samples keep all data points
+    EXPECT_EQ(plssvm::detail::io::sample_uniform(4, 0), (std::vector<std::size_t>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(plssvm::detail::io::sample_uniform(4, 4), (std::vector<std::size_t>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(plssvm::detail::io::sample_uniform(4, 10), (std::vector<std::size_t>{ 0, 1, 2, 3 }));
+}
+
+TEST(SampleStratified, sample) {
+    // 80 data points of class 1 and 20 data points of class -1
+    std::vector<int> labels(100, 1);
+    for (std::size_t i = 0; i < labels.size(); i += 5) {
+        labels[i] = -1;
+    }
+    const std::vector<std::size_t> sample = plssvm::detail::io::sample_stratified(labels, 10);
+    ASSERT_EQ(sample.size(), 10);
+    EXPECT_TRUE(std::is_sorted(sample.cbegin(), sample.cend()));
+    EXPECT_EQ(std::adjacent_find(sample.cbegin(), sample.cend()), sample.cend());
+    // the class distribution is the same as in the whole data set
+    const auto num_negative = std::count_if(sample.cbegin(), sample.cend(), [&](const std::size_t i) { return labels[i] == -1; });
+    EXPECT_EQ(num_negative, 2);
+    // the sample is reproducible
+    EXPECT_EQ(plssvm::detail::io::sample_stratified(labels, 10), sample);
+}
+TEST(SampleStratified, sample_small_class) {
+    // the small class would get no data point proportionally, but must be part of the sample
+    std::vector<std::string> labels(50, "cat");
+    labels[17] = "dog";
+    const std::vector<std::size_t> sample = plssvm::detail::io::sample_stratified(labels, 5);
+    ASSERT_EQ(sample.size(), 5);
+    EXPECT_EQ(std::count(sample.cbegin(), sample.cend(), 17), 1);
+}
+TEST(SampleStratified, sample_all) {
+    // too many or zero samples keep all data points
+    EXPECT_EQ(plssvm::detail::io::sample_stratified(std::vector<int>{ 1, -1, 1 }, 0), (std::vector<std::size_t>{ 0, 1, 2 }));
+    EXPECT_EQ(plssvm::detail::io::sample_stratified(std::vector<int>{ 1, -1, 1 }, 5), (std::vector<std::size_t>{ 0, 1, 2 }));
+}
+
+TEST(SelectSubset, features) {
+    std::vector<std::vector<double>> data{ { 1.0, 2.0, 3.0, 4.0 }, { 5.0, 6.0, 7.0, 8.0 } };
+    std::vector<int> label{ 1, -1 };
+    plssvm::detail::io::select_subset(data, label, plssvm::subset_options{ { 3, 1 }, 0, plssvm::sampling_type::uniform });
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 2.0, 4.0 }, { 6.0, 8.0 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1 }));
+}
+TEST(SelectSubset, features_out_of_range) {
+    std::vector<std::vector<double>> data{ { 1.0, 2.0 } };
+    std::vector<int> label{};
+    EXPECT_THROW_WHAT(plssvm::detail::io::select_subset(data, label, plssvm::subset_options{ { 0, 2 }, 0, plssvm::sampling_type::uniform }),
+                      plssvm::invalid_file_format_exception,
+                      "Can't keep the feature with index 2 since the data points only have 2 features!");
+}
+TEST(SelectSubset, samples) {
+    std::vector<std::vector<double>> data{};
+    std::vector<int> label{};
+    for (int i = 0; i < 20; ++i) {
+        data.push_back({ static_cast<double>(i) });
+        label.push_back(i % 4 == 0 ? -1 : 1);
+    }
+    plssvm::detail::io::select_subset(data, label, plssvm::subset_options{ {}, 8, plssvm::sampling_type::stratified });
+    ASSERT_EQ(data.size(), 8);
+    ASSERT_EQ(label.size(), 8);
+    // the labels still belong to their data points
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(label[i], static_cast<int>(data[i][0]) % 4 == 0 ? -1 : 1);
+    }
+    EXPECT_EQ(std::count(label.cbegin(), label.cend(), -1), 2);
+}
+TEST(SelectSubset, stratified_without_label) {
+    std::vector<std::vector<double>> data{ { 1.0 }, { 2.0 } };
+    std::vector<int> label{};
+    EXPECT_THROW_WHAT(plssvm::detail::io::select_subset(data, label, plssvm::subset_options{ {}, 1, plssvm::sampling_type::stratified }),
+                      plssvm::invalid_file_format_exception,
+                      "Can't draw a stratified sample since the data points have no labels!");
+}
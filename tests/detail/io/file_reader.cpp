@@ -10,20 +10,30 @@
 
 #include "plssvm/detail/io/file_reader.hpp"
 
+#include "plssvm/detail/io/compression.hpp"  // plssvm::detail::io::{determine_compression_type, is_compression_type_supported}
 #include "plssvm/detail/string_utility.hpp"  // plssvm::detail::starts_with
 #include "plssvm/exceptions/exceptions.hpp"  // plssvm::file_not_found_exception, plssvm::file_reader_exception
 
 #include "../../custom_test_macros.hpp"      // EXPECT_THROW_WHAT
 #include "../../naming.hpp"                  // naming::{open_parameter_types_to_name, pretty_print_escaped_string}
+#include "../../utility.hpp"                 // util::{redirect_input, temporary_file}
 
 #include "fmt/core.h"                        // fmt::format
-#include "gtest/gtest.h"                     // TEST, TEST_P, TYPED_TEST, EXPECT_EQ, EXPECT_NE, EXPECT_TRUE, EXPECT_FALSE, ASSERT_TRUE, ASSERT_FALSE, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P
-                                             // ::testing::{Test, Types, TestWithParam, ValuesIn}
+#include "gtest/gtest.h"                     // TEST, TEST_P, TYPED_TEST, EXPECT_EQ, EXPECT_NE, EXPECT_TRUE, EXPECT_FALSE, ASSERT_EQ, ASSERT_TRUE, ASSERT_FALSE, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P
+                                             // ::testing::{Test, Types, TestWithParam, Values, ValuesIn}
+
+#ifdef __unix__
+    #include <sys/stat.h>  // mkfifo
+#endif
 
 #include <cstddef>                           // std::size_t
-#include <filesystem>                        // std::filesystem::path
+#include <filesystem>                        // std::filesystem::{path, file_size, remove}
+#include <fstream>                           // std::ifstream, std::ofstream
+#include <ios>                               // std::streamsize, std::ios
+#include <iterator>                          // std::istreambuf_iterator
 #include <string>                            // std::string
 #include <string_view>                       // std::string_view
+#include <thread>                            // std::thread
 #include <tuple>                             // std::tuple, std::make_tuple
 #include <utility>                           // std::move, std::swap
 #include <vector>                            // std::vector
@@ -38,6 +48,7 @@ TEST(FileReader, default_construct) {
     EXPECT_EQ(reader.num_lines(), 0);
     EXPECT_TRUE(reader.lines().empty());
     EXPECT_EQ(reader.buffer(), nullptr);
+    EXPECT_EQ(reader.num_bytes(), 0);
 }
 
 TEST(FileReader, move_construct) {
@@ -101,6 +112,7 @@ TYPED_TEST(FileReaderConstructWithOpen, non_empty_file) {
     EXPECT_EQ(reader.num_lines(), 0);
     EXPECT_TRUE(reader.lines().empty());
     EXPECT_NE(reader.buffer(), nullptr);
+    EXPECT_EQ(reader.num_bytes(), static_cast<std::streamsize>(std::filesystem::file_size(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm")));
 }
 TYPED_TEST(FileReaderConstructWithOpen, empty_file) {
     // create file name depending on the current test type
@@ -113,6 +125,7 @@ TYPED_TEST(FileReaderConstructWithOpen, empty_file) {
     EXPECT_EQ(reader.num_lines(), 0);
     EXPECT_TRUE(reader.lines().empty());
     EXPECT_EQ(reader.buffer(), nullptr);
+    EXPECT_EQ(reader.num_bytes(), 0);
 }
 TYPED_TEST(FileReaderConstructWithOpen, file_not_found) {
     // create file name depending on the current test type
@@ -201,6 +214,7 @@ TEST(FileReader, close) {
     EXPECT_EQ(reader.num_lines(), 0);
     EXPECT_TRUE(reader.lines().empty());
     EXPECT_EQ(reader.buffer(), nullptr);
+    EXPECT_EQ(reader.num_bytes(), 0);
 }
 TEST(FileReader, close_twice) {
     // create a new file_reader and associate it to a file
@@ -365,6 +379,119 @@ TEST(FileReaderLines, parse_lines_without_associated_file) {
                       "This file_reader is currently not associated to a file!");
 }
 
+// the compressed file and the uncompressed original file
+class FileReaderCompressed : public ::testing::TestWithParam<std::tuple<std::string, std::string>> {
+  protected:
+    void SetUp() override {
+        // skip the test if the compression type isn't supported in this build
+        if (!plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::determine_compression_type(std::get<0>(GetParam())))) {
+            GTEST_SKIP() << "The compression type isn't supported!";
+        }
+    }
+};
+TEST_P(FileReaderCompressed, read_lines) {
+    const auto &[compressed_filename, filename] = GetParam();
+    // read the compressed and uncompressed file
+    plssvm::detail::io::file_reader compressed_reader{ compressed_filename };
+    compressed_reader.read_lines('#');
+    plssvm::detail::io::file_reader reader{ filename };
+    reader.read_lines('#');
+
+    // the compressed file must be transparently decompressed
+    EXPECT_EQ(compressed_reader.num_bytes(), reader.num_bytes());
+    EXPECT_EQ(compressed_reader.lines(), reader.lines());
+}
+TEST_P(FileReaderCompressed, close) {
+    const auto &[compressed_filename, filename] = GetParam();
+    plssvm::detail::io::file_reader reader{ compressed_filename };
+    reader.read_lines('#');
+
+    // closing must also release the decompressed content
+    reader.close();
+    EXPECT_FALSE(reader.is_open());
+    EXPECT_EQ(reader.num_bytes(), 0);
+    EXPECT_EQ(reader.buffer(), nullptr);
+}
+INSTANTIATE_TEST_SUITE_P(FileReader, FileReaderCompressed, ::testing::Values(
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_bgzf.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_multi_frame.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm")));
+
+TEST(FileReaderCompressed, file_not_found) {
+    plssvm::detail::io::file_reader reader{};
+    EXPECT_THROW_WHAT(reader.open(PLSSVM_TEST_PATH "/data/file_not_found.gz"),
+                      plssvm::file_not_found_exception,
+                      "Couldn't find file: '" PLSSVM_TEST_PATH "/data/file_not_found.gz'!");
+}
+
+TEST(FileReaderStream, is_standard_input) {
+    EXPECT_TRUE(plssvm::detail::io::is_standard_input("-"));
+    EXPECT_TRUE(plssvm::detail::io::is_standard_input("/dev/stdin"));
+    EXPECT_FALSE(plssvm::detail::io::is_standard_input(""));
+    EXPECT_FALSE(plssvm::detail::io::is_standard_input("--"));
+    EXPECT_FALSE(plssvm::detail::io::is_standard_input("data.libsvm"));
+}
+
+class FileReaderStream : public ::testing::TestWithParam<std::string> {};
+TEST_P(FileReaderStream, read_standard_input) {
+    const std::string &filename = GetParam();
+    std::ifstream in{ filename, std::ios::binary };
+    const std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+
+    // read the file content from the standard input
+    const util::redirect_input redirect{ content };
+    plssvm::detail::io::file_reader stream_reader{ "-" };
+    stream_reader.read_lines('#');
+    plssvm::detail::io::file_reader reader{ filename };
+    reader.read_lines('#');
+
+    // the content read from the standard input must be identical to the file content
+    EXPECT_TRUE(stream_reader.is_open());
+    EXPECT_EQ(stream_reader.num_bytes(), reader.num_bytes());
+    EXPECT_EQ(stream_reader.lines(), reader.lines());
+}
+#ifdef __unix__
+TEST_P(FileReaderStream, read_named_pipe) {
+    const std::string &filename = GetParam();
+    std::ifstream in{ filename, std::ios::binary };
+    const std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+
+    // create a named pipe (the temporary file must be removed first)
+    const util::temporary_file fifo{};
+    std::filesystem::remove(fifo.filename);
+    ASSERT_EQ(mkfifo(fifo.filename.c_str(), 0600), 0);
+
+    // write the file content to the named pipe while reading it; the content may be larger than the pipe buffer, i.e., the writer blocks until the reader consumed the data
+    std::thread writer{ [&]() {
+        std::ofstream out{ fifo.filename, std::ios::binary };
+        out << content;
+    } };
+    plssvm::detail::io::file_reader stream_reader{ fifo.filename };
+    writer.join();
+    stream_reader.read_lines('#');
+    plssvm::detail::io::file_reader reader{ filename };
+    reader.read_lines('#');
+
+    // the content read from the named pipe must be identical to the file content
+    ASSERT_EQ(stream_reader.num_bytes(), static_cast<std::streamsize>(content.size()));
+    EXPECT_EQ((std::string_view{ stream_reader.buffer(), content.size() }), content);
+    EXPECT_EQ(stream_reader.num_bytes(), reader.num_bytes());
+    EXPECT_EQ(stream_reader.lines(), reader.lines());
+}
+#endif
+INSTANTIATE_TEST_SUITE_P(FileReader, FileReaderStream, ::testing::Values(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm", PLSSVM_TEST_PATH "/data/arff/5x4.arff", PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm"));
+
+TEST(FileReaderStream, empty_standard_input) {
+    const util::redirect_input redirect{ "" };
+    plssvm::detail::io::file_reader reader{ "/dev/stdin" };
+    reader.read_lines('#');
+
+    EXPECT_TRUE(reader.is_open());
+    EXPECT_EQ(reader.num_bytes(), 0);
+    EXPECT_EQ(reader.num_lines(), 0);
+}
+
 class FileReaderLinesDeathTest : public ::testing::TestWithParam<std::tuple<std::string, char, std::vector<std::string_view>>> {};
 TEST_P(FileReaderLinesDeathTest, line_out_of_bounce) {
     const auto &[filename, comment, lines] = GetParam();
@@ -0,0 +1,266 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for reading a LIBSVM file chunk by chunk.
+ */
+
+#include "plssvm/detail/io/libsvm_chunk_reader.hpp"
+
+#include "plssvm/detail/io/compression.hpp"     // plssvm::detail::io::{determine_compression_type, is_compression_type_supported}
+#include "plssvm/detail/io/file_reader.hpp"     // plssvm::detail::io::file_reader
+#include "plssvm/detail/io/libsvm_parsing.hpp"  // plssvm::detail::io::parse_libsvm_data
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::file_not_found_exception, plssvm::invalid_file_format_exception
+
+#include "../../custom_test_macros.hpp"         // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                     // naming::real_type_label_type_combination_to_name
+#include "../../types_to_test.hpp"              // util::real_type_label_type_combination_gtest
+#include "../../utility.hpp"                    // util::{redirect_input, temporary_file, instantiate_template_file, get_distinct_label}
+
+#include "gtest/gtest.h"                        // TEST, TEST_P, TYPED_TEST, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, EXPECT_LE, EXPECT_TRUE, EXPECT_FALSE, ASSERT_EQ, GTEST_SKIP
+                                                // ::testing::{Test, TestWithParam, Values}
+
+#include <cstddef>                              // std::size_t
+#include <fstream>                              // std::ifstream, std::ofstream
+#include <ios>                                  // std::ios
+#include <iterator>                             // std::istreambuf_iterator
+#include <string>                               // std::string
+#include <tuple>                                // std::ignore, std::tuple, std::make_tuple, std::get
+#include <vector>                               // std::vector
+
+template <typename T>
+class LIBSVMChunkReader : public ::testing::Test, protected util::temporary_file {
+  protected:
+    void SetUp() override {
+        // create file used in this test fixture by instantiating the template file
+        util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+        // create a vector with the correct labels
+        const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+        correct_label = std::vector<label_type>{ first_label, first_label, second_label, second_label, second_label };
+    }
+
+    using real_type = typename T::real_type;
+    using label_type = typename T::label_type;
+
+    const std::vector<std::vector<real_type>> correct_data{
+        { real_type{ -1.117827500607882 }, real_type{ -2.9087188881250993 }, real_type{ 0.66638344270039144 }, real_type{ 1.0978832703949288 } },
+        { real_type{ -0.5282118298909262 }, real_type{ -0.335880984968183973 }, real_type{ 0.51687296029754564 }, real_type{ 0.54604461446026 } },
+        { real_type{ 0.57650218263054642 }, real_type{ 1.01405596624706053 }, real_type{ 0.13009428079760464 }, real_type{ 0.7261913886869387 } },
+        { real_type{ -0.20981208921241892 }, real_type{ 0.60276937379453293 }, real_type{ -0.13086851759108944 }, real_type{ 0.10805254527169827 } },
+        { real_type{ 1.88494043717792 }, real_type{ 1.00518564317278263 }, real_type{ 0.298499933047586044 }, real_type{ 1.6464627048813514 } }
+    };
+    std::vector<label_type> correct_label{};
+};
+TYPED_TEST_SUITE(LIBSVMChunkReader, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(LIBSVMChunkReader, read_chunks) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    plssvm::detail::io::libsvm_chunk_reader<current_real_type, current_label_type> reader{ this->filename, 4 };
+    EXPECT_EQ(reader.num_features(), 4);
+
+    // read the first two chunks with two data points each
+    for (std::size_t chunk = 0; chunk < 2; ++chunk) {
+        const auto [data, label] = reader.read_chunk(2);
+        ASSERT_EQ(data.size(), 2);
+        ASSERT_EQ(label.size(), 2);
+        for (std::size_t i = 0; i < 2; ++i) {
+            EXPECT_FLOATING_POINT_VECTOR_NEAR(data[i], this->correct_data[2 * chunk + i]);
+            EXPECT_EQ(label[i], this->correct_label[2 * chunk + i]);
+        }
+    }
+    // the last chunk contains only the remaining data point
+    const auto [data, label] = reader.read_chunk(2);
+    ASSERT_EQ(data.size(), 1);
+    ASSERT_EQ(label.size(), 1);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(data.front(), this->correct_data.back());
+    EXPECT_EQ(label.front(), this->correct_label.back());
+
+    // the end of the file has been reached
+    const auto [empty_data, empty_label] = reader.read_chunk(2);
+    EXPECT_TRUE(empty_data.empty());
+    EXPECT_TRUE(empty_label.empty());
+    EXPECT_EQ(reader.num_data_points(), 5);
+    EXPECT_TRUE(reader.has_labels());
+}
+TYPED_TEST(LIBSVMChunkReader, read_single_chunk) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // a chunk larger than the file must return all data points
+    plssvm::detail::io::libsvm_chunk_reader<current_real_type, current_label_type> reader{ this->filename, 4 };
+    const auto [data, label] = reader.read_chunk(42);
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, this->correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(LIBSVMChunkReader, pad_features) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // data points with fewer features than requested are padded with zeros
+    plssvm::detail::io::libsvm_chunk_reader<current_real_type, current_label_type> reader{ this->filename, 6 };
+    const auto [data, label] = reader.read_chunk(5);
+    ASSERT_EQ(data.size(), 5);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        std::vector<current_real_type> correct_data_point = this->correct_data[i];
+        correct_data_point.resize(6);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR(data[i], correct_data_point);
+    }
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(LIBSVMChunkReader, too_few_features) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    plssvm::detail::io::libsvm_chunk_reader<current_real_type, current_label_type> reader{ this->filename, 3 };
+    EXPECT_THROW_WHAT(std::ignore = reader.read_chunk(2),
+                      plssvm::invalid_file_format_exception,
+                      "The feature index 4 is larger than the number of features 3!");
+}
+
+class LIBSVMChunkReaderChunkSize : public ::testing::TestWithParam<std::size_t> {};
+TEST_P(LIBSVMChunkReaderChunkSize, same_as_parse_libsvm_data) {
+    const std::string filename = PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm";
+
+    // parse the whole LIBSVM file at once
+    plssvm::detail::io::file_reader file_reader{ filename };
+    file_reader.read_lines('#');
+    const auto [correct_num_data_points, num_features, correct_data, correct_label] = plssvm::detail::io::parse_libsvm_data<double, int>(file_reader);
+
+    // read the LIBSVM file in chunks
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ filename, num_features };
+    std::vector<std::vector<double>> data;
+    std::vector<int> label;
+    while (true) {
+        auto [chunk_data, chunk_label] = reader.read_chunk(GetParam());
+        if (chunk_data.empty()) {
+            break;
+        }
+        EXPECT_LE(chunk_data.size(), GetParam());
+        data.insert(data.end(), chunk_data.begin(), chunk_data.end());
+        label.insert(label.end(), chunk_label.begin(), chunk_label.end());
+    }
+
+    // the data points must be identical
+    EXPECT_EQ(reader.num_data_points(), correct_num_data_points);
+    EXPECT_EQ(data, correct_data);
+    EXPECT_EQ(label, correct_label);
+}
+INSTANTIATE_TEST_SUITE_P(LIBSVMChunkReader, LIBSVMChunkReaderChunkSize, ::testing::Values(1, 7, 250, 500, 1000));
+
+class LIBSVMChunkReaderContent : public ::testing::Test, protected util::temporary_file {
+  protected:
+    /**
+     * @brief Write the @p content to the temporary file.
+     * @param[in] content the file content
+     */
+    void write_content(const std::string &content) const {
+        std::ofstream out{ this->filename };
+        out << content;
+    }
+};
+TEST_F(LIBSVMChunkReaderContent, without_label) {
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm", 2 };
+    const auto [data, label] = reader.read_chunk(3);
+
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 1.5, -2.9 }, { 0.0, -0.3 }, { 5.5, 0.0 } }));
+    EXPECT_TRUE(label.empty());
+    EXPECT_FALSE(reader.has_labels());
+}
+TEST_F(LIBSVMChunkReaderContent, comments_and_empty_lines) {
+    // comments and empty lines don't count towards the chunk size
+    this->write_content("# comment\r\n1 2:1.5\r\n\r\n  -1 1:0.5 3:2.5\n\n# 4:1.0\n1\n");
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ this->filename, 3 };
+
+    const auto [data, label] = reader.read_chunk(2);
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 0.0, 1.5, 0.0 }, { 0.5, 0.0, 2.5 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1 }));
+    const auto [last_data, last_label] = reader.read_chunk(2);
+    EXPECT_EQ(last_data, (std::vector<std::vector<double>>{ { 0.0, 0.0, 0.0 } }));
+    EXPECT_EQ(last_label, (std::vector<int>{ 1 }));
+}
+TEST_F(LIBSVMChunkReaderContent, inconsistent_label_specification_over_chunks) {
+    // each chunk on its own is consistent
+    this->write_content("1 1:1.5\n-1 1:2.5\n1:3.5\n");
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ this->filename, 1 };
+
+    std::ignore = reader.read_chunk(2);
+    EXPECT_THROW_WHAT(std::ignore = reader.read_chunk(2),
+                      plssvm::invalid_file_format_exception,
+                      "Inconsistent label specification found (some data points are labeled, others are not)!");
+}
+TEST_F(LIBSVMChunkReaderContent, invalid_data_point) {
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ PLSSVM_TEST_PATH "/data/libsvm/invalid/zero_based_features.libsvm", 4 };
+    EXPECT_THROW_WHAT(std::ignore = reader.read_chunk(5),
+                      plssvm::invalid_file_format_exception,
+                      "LIBSVM assumes a 1-based feature indexing scheme, but 0 was given!");
+}
+TEST(LIBSVMChunkReader, file_not_found) {
+    EXPECT_THROW_WHAT((plssvm::detail::io::libsvm_chunk_reader<double, int>{ "foo.libsvm", 2 }),
+                      plssvm::file_not_found_exception,
+                      "Couldn't find file: 'foo.libsvm'!");
+}
+
+TEST(LIBSVMChunkReader, read_standard_input) {
+    const std::string filename = PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm";
+    std::ifstream in{ filename, std::ios::binary };
+    const std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+
+    // read the file and the same content from the standard input chunk by chunk
+    const util::redirect_input redirect{ content };
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ filename, 4 };
+    plssvm::detail::io::libsvm_chunk_reader<double, int> stream_reader{ "-", 4 };
+    for (std::size_t chunk = 0; chunk < 3; ++chunk) {
+        const auto [data, label] = reader.read_chunk(2);
+        const auto [stream_data, stream_label] = stream_reader.read_chunk(2);
+        EXPECT_EQ(stream_data, data);
+        EXPECT_EQ(stream_label, label);
+    }
+    EXPECT_EQ(stream_reader.num_data_points(), 5);
+}
+
+// the compressed file and the uncompressed original file
+class LIBSVMChunkReaderCompressed : public ::testing::TestWithParam<std::tuple<std::string, std::string>> {
+  protected:
+    void SetUp() override {
+        // skip the test if the compression type isn't supported in this build
+        if (!plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::determine_compression_type(std::get<0>(GetParam())))) {
+            GTEST_SKIP() << "The compression type isn't supported!";
+        }
+    }
+};
+TEST_P(LIBSVMChunkReaderCompressed, read_chunks) {
+    const auto &[compressed_filename, filename] = GetParam();
+
+    // read the uncompressed and the compressed file chunk by chunk
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ filename, 4 };
+    plssvm::detail::io::libsvm_chunk_reader<double, int> compressed_reader{ compressed_filename, 4 };
+    for (std::size_t chunk = 0; chunk < 3; ++chunk) {
+        const auto [data, label] = reader.read_chunk(2);
+        const auto [compressed_data, compressed_label] = compressed_reader.read_chunk(2);
+        EXPECT_EQ(compressed_data, data);
+        EXPECT_EQ(compressed_label, label);
+    }
+    EXPECT_EQ(compressed_reader.num_data_points(), 5);
+}
+INSTANTIATE_TEST_SUITE_P(LIBSVMChunkReader, LIBSVMChunkReaderCompressed, ::testing::Values(
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_multi_member.libsvm.gz", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm"),
+                         std::make_tuple(PLSSVM_TEST_PATH "/data/compressed/5x4_multi_frame.libsvm.zst", PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm")));
+
+TEST(LIBSVMChunkReaderCompressed, truncated_file) {
+#if defined(PLSSVM_HAS_ZLIB)
+    // the decompression error must be reported while reading the chunks
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ PLSSVM_TEST_PATH "/data/compressed/truncated.libsvm.gz", 4 };
+    EXPECT_THROW_WHAT(std::ignore = reader.read_chunk(5),
+                      plssvm::invalid_file_format_exception,
+                      "The gzip compressed file '" PLSSVM_TEST_PATH "/data/compressed/truncated.libsvm.gz' is truncated!");
+#else
+    GTEST_SKIP() << "The gzip compression type isn't supported!";
+#endif
+}
@@ -10,24 +10,30 @@
 
 #include "plssvm/detail/io/libsvm_parsing.hpp"
 
-#include "plssvm/detail/io/file_reader.hpp"  // plssvm::detail::io::file_reader
-#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_file_format_exception
-
-#include "../../custom_test_macros.hpp"      // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_THROW_WHAT
-#include "../../naming.hpp"                  // naming::real_type_label_type_combination_to_name
-#include "../../types_to_test.hpp"           // util::{instantiate_template_file, real_type_label_type_combination_gtest}
-#include "../../utility.hpp"                 // util::temporary_file
-
-#include "fmt/core.h"                        // fmt::format
-#include "gmock/gmock-matchers.h"            // ::testing::HasSubstr
-#include "gtest/gtest.h"                     // TEST, TEST_P, TYPED_TEST, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_DEATH, ASSERT_EQ, GTEST_FAIL
-                                             // ::testing::{Test, Types, TestWithParam, Values}
-
-#include <cstddef>                           // std::size_t
-#include <string>                            // std::string
-#include <tuple>                             // std::ignore
-#include <utility>                           // std::pair, std::make_pair
-#include <vector>                            // std::vector
+#include "plssvm/detail/io/data_set_subset.hpp"  // plssvm::detail::io::select_subset
+#include "plssvm/detail/io/file_reader.hpp"      // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"      // plssvm::invalid_file_format_exception
+#include "plssvm/file_format_types.hpp"          // plssvm::subset_options
+#include "plssvm/sampling_types.hpp"             // plssvm::sampling_type
+
+#include "../../custom_test_macros.hpp"          // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                      // naming::real_type_label_type_combination_to_name
+#include "../../types_to_test.hpp"               // util::{instantiate_template_file, real_type_label_type_combination_gtest}
+#include "../../utility.hpp"                     // util::temporary_file
+
+#include "fmt/core.h"                            // fmt::format
+#include "gmock/gmock-matchers.h"                // ::testing::HasSubstr
+#include "gtest/gtest.h"                         // TEST, TEST_P, TYPED_TEST, TYPED_TEST_SUITE, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_DEATH, ASSERT_EQ, GTEST_FAIL
+                                                 // ::testing::{Test, Types, TestWithParam, Values, Combine}
+
+#include <cstddef>                               // std::size_t
+#include <fstream>                               // std::ifstream, std::ofstream
+#include <ios>                                   // std::ios
+#include <sstream>                               // std::istringstream
+#include <string>                                // std::string
+#include <tuple>                                 // std::tuple, std::ignore
+#include <utility>                               // std::pair, std::make_pair
+#include <vector>                                // std::vector
 
 class LIBSVMParseNumFeatures : public ::testing::TestWithParam<std::pair<std::string, std::size_t>> {};
 TEST_P(LIBSVMParseNumFeatures, num_features) {
@@ -361,6 +367,358 @@ TYPED_TEST(LIBSVMParse, non_strictly_increasing_indices) {
                       "The features indices must be strictly increasing, but 2 is smaller or equal than 3!");
 }
 
+class LIBSVMParseChunked : public ::testing::TestWithParam<std::tuple<std::string, std::size_t>> {};
+TEST_P(LIBSVMParseChunked, same_as_line_based) {
+    const auto &[filename_part, num_chunks] = GetParam();
+    const std::string filename = fmt::format("{}{}", PLSSVM_TEST_PATH, filename_part);
+
+    // parse the LIBSVM file using the line based parser
+    plssvm::detail::io::file_reader line_reader{ filename };
+    line_reader.read_lines('#');
+    const auto [correct_num_data_points, correct_num_features, correct_data, correct_label] = plssvm::detail::io::parse_libsvm_data<double, int>(line_reader);
+
+    // parse the LIBSVM file using the chunked parser
+    const plssvm::detail::io::file_reader reader{ filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, num_chunks);
+
+    // the results must be identical regardless of the number of byte ranges
+    EXPECT_EQ(num_data_points, correct_num_data_points);
+    EXPECT_EQ(num_features, correct_num_features);
+    EXPECT_EQ(data, correct_data);
+    EXPECT_EQ(label, correct_label);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(LIBSVMParse, LIBSVMParseChunked, ::testing::Combine(
+                                                      ::testing::Values("/data/libsvm/5x4.libsvm", "/data/libsvm/5x4_sparse.libsvm",
+                                                                        "/data/libsvm/3x2_without_label.libsvm", "/data/libsvm/500x200.libsvm"),
+                                                      ::testing::Values(0, 1, 2, 3, 7, 1024)));
+// clang-format on
+
+TYPED_TEST(LIBSVMParseDense, read_chunked) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // parse the LIBSVM file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<current_real_type, current_label_type>(reader, 3);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, this->correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(LIBSVMParseSparse, read_chunked) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // parse the LIBSVM file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<current_real_type, current_label_type>(reader, 3);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, this->correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+
+class LIBSVMParseChunkedContent : public ::testing::TestWithParam<std::size_t>, protected util::temporary_file {
+  protected:
+    /**
+     * @brief Write the @p content to the temporary file.
+     * @param[in] content the file content
+     */
+    void write_content(const std::string &content) const {
+        std::ofstream out{ this->filename, std::ios::binary | std::ios::trunc };
+        out << content;
+    }
+};
+TEST_P(LIBSVMParseChunkedContent, comments_and_empty_lines) {
+    // comments, empty lines, leading whitespaces, and different line endings must be handled as in plssvm::detail::io::file_reader::read_lines
+    this->write_content("# comment\r\n1 2:1.5\r\n\r\n  -1 1:0.5 3:2.5\n\n# 4:1.0\n1\n");
+
+    // parse the LIBSVM file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam());
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 3);
+    ASSERT_EQ(num_features, 3);
+
+    // check for correct data
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 0.0, 1.5, 0.0 }, { 0.5, 0.0, 2.5 }, { 0.0, 0.0, 0.0 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1, 1 }));
+}
+TEST_P(LIBSVMParseChunkedContent, no_trailing_newline) {
+    this->write_content("1 1:1.5\n-1 2:2.5");
+
+    // parse the LIBSVM file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam());
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 2);
+    ASSERT_EQ(num_features, 2);
+
+    // check for correct data
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 1.5, 0.0 }, { 0.0, 2.5 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1 }));
+}
+TEST_P(LIBSVMParseChunkedContent, first_error_in_file_order) {
+    // both, the first and the last data point are invalid
+    this->write_content("1 0:1.5\n-1 1:0.5\n1 1:0.5\n-1 2:0.5 1:0.5\n");
+
+    // parse the LIBSVM file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam())),
+                      plssvm::invalid_file_format_exception,
+                      "LIBSVM assumes a 1-based feature indexing scheme, but 0 was given!");
+}
+TEST_P(LIBSVMParseChunkedContent, only_comments) {
+    this->write_content("# 1 1:1.5\n\n# -1 2:2.5\n");
+
+    // parse the LIBSVM file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam())),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no data points are given!");
+}
+INSTANTIATE_TEST_SUITE_P(LIBSVMParse, LIBSVMParseChunkedContent, ::testing::Values(0, 1, 2, 5, 64));
+
+class LIBSVMParseSubset : public ::testing::TestWithParam<std::tuple<plssvm::subset_options, std::size_t>> {};
+TEST_P(LIBSVMParseSubset, same_as_post_hoc_selection) {
+    const auto &[subset, num_chunks] = GetParam();
+    const std::string filename = PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm";
+
+    // parse the whole LIBSVM file and select the subset afterward
+    const plssvm::detail::io::file_reader full_reader{ filename };
+    auto [correct_num_data_points, correct_num_features, correct_data, correct_label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(full_reader, num_chunks);
+    plssvm::detail::io::select_subset(correct_data, correct_label, subset);
+
+    // select the subset while parsing the LIBSVM file
+    const plssvm::detail::io::file_reader reader{ filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, num_chunks, subset);
+
+    // the results must be identical
+    EXPECT_EQ(num_data_points, correct_data.size());
+    EXPECT_EQ(num_features, correct_data.front().size());
+    EXPECT_EQ(data, correct_data);
+    EXPECT_EQ(label, correct_label);
+
+    // the same must be true for the stream parser
+    std::ifstream in{ filename, std::ios::binary };
+    const auto [stream_num_data_points, stream_num_features, stream_data, stream_label] = plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, 4096, subset);
+    EXPECT_EQ(stream_num_data_points, correct_data.size());
+    EXPECT_EQ(stream_num_features, correct_data.front().size());
+    EXPECT_EQ(stream_data, correct_data);
+    EXPECT_EQ(stream_label, correct_label);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(LIBSVMParse, LIBSVMParseSubset, ::testing::Combine(
+                                                     ::testing::Values(plssvm::subset_options{ { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 150 }, 0, plssvm::sampling_type::uniform },
+                                                                       plssvm::subset_options{ {}, 42, plssvm::sampling_type::uniform },
+                                                                       plssvm::subset_options{ {}, 42, plssvm::sampling_type::stratified },
+                                                                       plssvm::subset_options{ { 5, 199 }, 100, plssvm::sampling_type::stratified },
+                                                                       plssvm::subset_options{ {}, 1000, plssvm::sampling_type::uniform }),
+                                                     ::testing::Values(0, 1, 3)));
+// clang-format on
+
+class LIBSVMParseSubsetContent : public LIBSVMParseChunkedContent {};
+TEST_P(LIBSVMParseSubsetContent, skip_unwanted_features) {
+    // the invalid feature values are never converted since they aren't part of the projection
+    this->write_content("1 1:1.5 2:foo 3:2.5\n-1 2:bar 4:3.5 5:baz\n");
+
+    // parse the LIBSVM file keeping only the first and fourth feature (zero-based)
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam(), plssvm::subset_options{ { 0, 3 }, 0, plssvm::sampling_type::uniform });
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 2);
+    ASSERT_EQ(num_features, 2);
+
+    // check for correct data
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 1.5, 0.0 }, { 0.0, 3.5 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1 }));
+}
+TEST_P(LIBSVMParseSubsetContent, feature_not_in_file) {
+    // a selected feature that is larger than the largest feature index of the sparse file is rejected like for all other file formats
+    this->write_content("1 1:1.5\n-1 2:2.5\n");
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam(), plssvm::subset_options{ { 1, 5 }, 0, plssvm::sampling_type::uniform })),
+                      plssvm::invalid_file_format_exception,
+                      "Can't keep the feature with index 5 since the data points only have 2 features!");
+    // the features of the data points that aren't sampled are considered as well
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam(), plssvm::subset_options{ { 2 }, 1, plssvm::sampling_type::uniform })),
+                      plssvm::invalid_file_format_exception,
+                      "Can't keep the feature with index 2 since the data points only have 2 features!");
+
+    // the same must be true for the stream parser
+    std::ifstream in{ this->filename, std::ios::binary };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, 4, plssvm::subset_options{ { 1, 5 }, 0, plssvm::sampling_type::uniform })),
+                      plssvm::invalid_file_format_exception,
+                      "Can't keep the feature with index 5 since the data points only have 2 features!");
+}
+TEST_P(LIBSVMParseSubsetContent, feature_in_other_data_point) {
+    // a selected feature only has to be present in a single data point of the sparse file
+    this->write_content("1 1:1.5\n-1 2:2.5\n");
+
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam(), plssvm::subset_options{ { 1 }, 0, plssvm::sampling_type::uniform });
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 2);
+    ASSERT_EQ(num_features, 1);
+
+    // check for correct data
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 0.0 }, { 2.5 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1 }));
+
+    // the same must be true for the sampled data points: the second data point has the selected feature
+    const auto [sample_num_data_points, sample_num_features, sample_data, sample_label] = plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam(), plssvm::subset_options{ { 1 }, 1, plssvm::sampling_type::uniform });
+    EXPECT_EQ(sample_num_data_points, 1);
+    EXPECT_EQ(sample_num_features, 1);
+}
+TEST_P(LIBSVMParseSubsetContent, stratified_without_label) {
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, GetParam(), plssvm::subset_options{ {}, 2, plssvm::sampling_type::stratified })),
+                      plssvm::invalid_file_format_exception,
+                      "Can't draw a stratified sample since the data points have no labels!");
+}
+INSTANTIATE_TEST_SUITE_P(LIBSVMParse, LIBSVMParseSubsetContent, ::testing::Values(0, 1, 2, 5));
+
+class LIBSVMParseChunkedInvalid : public ::testing::TestWithParam<std::tuple<std::string, std::size_t>> {};
+TEST_P(LIBSVMParseChunkedInvalid, same_error_as_line_based) {
+    const auto &[filename_part, num_chunks] = GetParam();
+    const std::string filename = fmt::format("{}{}", PLSSVM_TEST_PATH, filename_part);
+
+    // get the error message of the line based parser
+    plssvm::detail::io::file_reader line_reader{ filename };
+    line_reader.read_lines('#');
+    std::string correct_what{};
+    try {
+        std::ignore = plssvm::detail::io::parse_libsvm_data<double, int>(line_reader);
+        GTEST_FAIL() << "The line based parser didn't throw!";
+    } catch (const plssvm::invalid_file_format_exception &e) {
+        correct_what = e.what();
+    }
+
+    // the chunked parser must report the same error
+    const plssvm::detail::io::file_reader reader{ filename };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_chunked<double, int>(reader, num_chunks)),
+                      plssvm::invalid_file_format_exception,
+                      correct_what);
+
+    // the stream parser must report the same error (using the number of chunks as tiny block size)
+    std::ifstream in{ filename, std::ios::binary };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, num_chunks)),
+                      plssvm::invalid_file_format_exception,
+                      correct_what);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(LIBSVMParse, LIBSVMParseChunkedInvalid, ::testing::Combine(
+                                                      ::testing::Values("/data/empty.txt",
+                                                                        "/data/libsvm/invalid/feature_with_alpha_char_at_the_beginning.libsvm",
+                                                                        "/data/libsvm/invalid/inconsistent_label_specification.libsvm",
+                                                                        "/data/libsvm/invalid/index_with_alpha_char_at_the_beginning.libsvm",
+                                                                        "/data/libsvm/invalid/invalid_colon_at_the_beginning.libsvm",
+                                                                        "/data/libsvm/invalid/invalid_colon_in_the_middle.libsvm",
+                                                                        "/data/libsvm/invalid/missing_feature_value.libsvm",
+                                                                        "/data/libsvm/invalid/missing_index_value.libsvm",
+                                                                        "/data/libsvm/invalid/non_increasing_indices.libsvm",
+                                                                        "/data/libsvm/invalid/non_strictly_increasing_indices.libsvm",
+                                                                        "/data/libsvm/invalid/zero_based_features.libsvm"),
+                                                      ::testing::Values(1, 2, 3)));
+// clang-format on
+
+class LIBSVMParseStream : public ::testing::TestWithParam<std::tuple<std::string, std::size_t>> {};
+TEST_P(LIBSVMParseStream, same_as_line_based) {
+    const auto &[filename_part, block_size] = GetParam();
+    const std::string filename = fmt::format("{}{}", PLSSVM_TEST_PATH, filename_part);
+
+    // parse the LIBSVM file using the line based parser
+    plssvm::detail::io::file_reader line_reader{ filename };
+    line_reader.read_lines('#');
+    const auto [correct_num_data_points, correct_num_features, correct_data, correct_label] = plssvm::detail::io::parse_libsvm_data<double, int>(line_reader);
+
+    // parse the LIBSVM file using the stream parser
+    std::ifstream in{ filename, std::ios::binary };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, block_size);
+
+    // the results must be identical regardless of the block size
+    EXPECT_EQ(num_data_points, correct_num_data_points);
+    EXPECT_EQ(num_features, correct_num_features);
+    EXPECT_EQ(data, correct_data);
+    EXPECT_EQ(label, correct_label);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(LIBSVMParse, LIBSVMParseStream, ::testing::Combine(
+                                                     ::testing::Values("/data/libsvm/5x4.libsvm", "/data/libsvm/5x4_sparse.libsvm",
+                                                                       "/data/libsvm/3x2_without_label.libsvm", "/data/libsvm/500x200.libsvm"),
+                                                     ::testing::Values(1, 7, 100, 4096, plssvm::detail::io::libsvm_stream_block_size)));
+// clang-format on
+
+class LIBSVMParseStreamContent : public ::testing::TestWithParam<std::size_t> {};
+TEST_P(LIBSVMParseStreamContent, comments_and_empty_lines) {
+    // comments, empty lines, leading whitespaces, and different line endings must be handled as in plssvm::detail::io::file_reader::read_lines
+    std::istringstream in{ "# comment\r\n1 2:1.5\r\n\r\n  -1 1:0.5 3:2.5\n\n# 4:1.0\n1\n" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, GetParam());
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 3);
+    ASSERT_EQ(num_features, 3);
+
+    // check for correct data
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 0.0, 1.5, 0.0 }, { 0.5, 0.0, 2.5 }, { 0.0, 0.0, 0.0 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1, 1 }));
+}
+TEST_P(LIBSVMParseStreamContent, no_trailing_newline) {
+    std::istringstream in{ "1 1:1.5\n-1 2:2.5" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, GetParam());
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 2);
+    ASSERT_EQ(num_features, 2);
+
+    // check for correct data
+    EXPECT_EQ(data, (std::vector<std::vector<double>>{ { 1.5, 0.0 }, { 0.0, 2.5 } }));
+    EXPECT_EQ(label, (std::vector<int>{ 1, -1 }));
+}
+TEST_P(LIBSVMParseStreamContent, first_error_in_stream_order) {
+    // both, the first and the last data point are invalid
+    std::istringstream in{ "1 0:1.5\n-1 1:0.5\n1 1:0.5\n-1 2:0.5 1:0.5\n" };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, GetParam())),
+                      plssvm::invalid_file_format_exception,
+                      "LIBSVM assumes a 1-based feature indexing scheme, but 0 was given!");
+}
+TEST_P(LIBSVMParseStreamContent, only_comments) {
+    std::istringstream in{ "# 1 1:1.5\n\n# -1 2:2.5\n" };
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, GetParam())),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no data points are given!");
+}
+TEST_P(LIBSVMParseStreamContent, empty_stream) {
+    std::istringstream in{};
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_stream<double, int>(in, GetParam())),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no data points are given!");
+}
+INSTANTIATE_TEST_SUITE_P(LIBSVMParse, LIBSVMParseStreamContent, ::testing::Values(1, 2, 5, 64, plssvm::detail::io::libsvm_stream_block_size));
+
+TEST(LIBSVMParseStream, bad_stream) {
+    // a stream whose underlying device failed
+    std::istringstream in{ "1 1:1.5\n" };
+    in.setstate(std::ios::badbit);
+    EXPECT_THROW_WHAT(std::ignore = (plssvm::detail::io::parse_libsvm_data_stream<double, int>(in)),
+                      plssvm::invalid_file_format_exception,
+                      "Error while reading the LIBSVM data from the input stream!");
+}
+
 template <typename T>
 class LIBSVMParseDeathTest : public ::testing::Test {};
 TYPED_TEST_SUITE(LIBSVMParseDeathTest, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
@@ -386,6 +744,23 @@ TYPED_TEST(LIBSVMParseDeathTest, skip_too_many_lines) {
     EXPECT_DEATH(std::ignore = (plssvm::detail::io::parse_libsvm_data<current_real_type, current_label_type>(reader, 6)),
                  "Tried to skipp 6 lines, but only 5 are present!");
 }
+TYPED_TEST(LIBSVMParseDeathTest, chunked_invalid_file_reader) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    // open file_reader without associating it to a file
+    const plssvm::detail::io::file_reader reader{};
+    EXPECT_DEATH(std::ignore = (plssvm::detail::io::parse_libsvm_data_chunked<current_real_type, current_label_type>(reader)),
+                 "The file_reader is currently not associated with a file!");
+}
+TYPED_TEST(LIBSVMParseDeathTest, stream_zero_block_size) {
+    using current_real_type = typename TypeParam::real_type;
+    using current_label_type = typename TypeParam::label_type;
+
+    std::istringstream in{ "1 1:1.5\n" };
+    EXPECT_DEATH(std::ignore = (plssvm::detail::io::parse_libsvm_data_stream<current_real_type, current_label_type>(in, 0)),
+                 "The block size must be greater than 0!");
+}
 
 template <typename T>
 class LIBSVMWriteBase : public ::testing::Test, protected util::temporary_file {};
@@ -423,15 +798,8 @@ TYPED_TEST(LIBSVMWrite, write_dense_with_label) {
     // check the lines
     for (std::size_t i = 0; i < data.size(); ++i) {
         const std::string line = fmt::format("{} 1:{:.10e} 2:{:.10e} 3:{:.10e} ", label[i], data[i][0], data[i][1], data[i][2]);
-        bool line_found = false;
-        for (std::size_t j = 0; j < reader.num_lines(); ++j) {
-            if (reader.line(j) == line) {
-                line_found = true;
-            }
-        }
-        if (!line_found) {
-            GTEST_FAIL() << fmt::format("Couldn't find line '{}' in the output file.", line);
-        }
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(i), line);
     }
 }
 TYPED_TEST(LIBSVMWrite, write_dense_without_label) {
@@ -456,15 +824,8 @@ TYPED_TEST(LIBSVMWrite, write_dense_without_label) {
     // check the lines
     for (std::size_t i = 0; i < data.size(); ++i) {
         const std::string line = fmt::format("1:{:.10e} 2:{:.10e} 3:{:.10e} ", data[i][0], data[i][1], data[i][2]);
-        bool line_found = false;
-        for (std::size_t j = 0; j < reader.num_lines(); ++j) {
-            if (reader.line(j) == line) {
-                line_found = true;
-            }
-        }
-        if (!line_found) {
-            GTEST_FAIL() << fmt::format("Couldn't find line '{}' in the output file.", line);
-        }
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(i), line);
     }
 }
 
@@ -500,15 +861,8 @@ TYPED_TEST(LIBSVMWrite, write_sparse_with_label) {
             }
         }
 
-        bool line_found = false;
-        for (std::size_t j = 0; j < reader.num_lines(); ++j) {
-            if (reader.line(j) == line) {
-                line_found = true;
-            }
-        }
-        if (!line_found) {
-            GTEST_FAIL() << fmt::format("Couldn't find line '{}' in the output file.", line);
-        }
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(i), line);
     }
 }
 TYPED_TEST(LIBSVMWrite, write_sparse_without_label) {
@@ -540,15 +894,8 @@ TYPED_TEST(LIBSVMWrite, write_sparse_without_label) {
             }
         }
 
-        bool line_found = false;
-        for (std::size_t j = 0; j < reader.num_lines(); ++j) {
-            if (reader.line(j) == line) {
-                line_found = true;
-            }
-        }
-        if (!line_found) {
-            GTEST_FAIL() << fmt::format("Couldn't find line '{}' in the output file.", line);
-        }
+        // the data points must have been written in order
+        EXPECT_EQ(reader.line(i), line);
     }
 }
 
@@ -0,0 +1,326 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to parsing and writing the data points from and to a NumPy .npy file.
+ */
+
+#include "plssvm/detail/io/npy_parsing.hpp"
+
+#include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
+#include "plssvm/detail/io/file_reader.hpp"        // plssvm::detail::io::file_reader
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_file_format_exception
+
+#include "../../custom_test_macros.hpp"            // EXPECT_FLOATING_POINT_2D_VECTOR_NEAR, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                        // naming::{real_type_to_name, real_type_label_type_combination_to_name}
+#include "../../types_to_test.hpp"                 // util::{real_type_gtest, real_type_label_type_combination_gtest}
+#include "../../utility.hpp"                       // util::{temporary_file, get_distinct_label}
+
+#include "fmt/core.h"                              // fmt::format
+#include "gtest/gtest.h"                           // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_DEATH, ASSERT_EQ, ::testing::Test
+
+#include <cstddef>                                 // std::size_t
+#include <fstream>                                 // std::ifstream, std::ofstream
+#include <ios>                                     // std::ios, std::streamsize
+#include <iterator>                                // std::istreambuf_iterator
+#include <optional>                                // std::nullopt
+#include <string>                                  // std::string
+#include <tuple>                                   // std::ignore
+#include <type_traits>                             // std::is_same_v
+#include <vector>                                  // std::vector
+
+template <typename T>
+class NPYParse : public ::testing::Test, protected util::temporary_file {
+  protected:
+    using real_type = T;
+
+    /**
+     * @brief Copy the NumPy file @p npy_filename to the temporary file and replace the bytes in [@p pos, @p pos + @p replacement.size()) with @p replacement.
+     * @param[in] npy_filename the NumPy file to copy
+     * @param[in] pos the position of the bytes to replace
+     * @param[in] replacement the new bytes
+     */
+    void write_modified(const std::string &npy_filename, const std::size_t pos, const std::string &replacement) {
+        std::ifstream in{ npy_filename, std::ios::binary };
+        std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+        content.replace(pos, replacement.size(), replacement);
+        std::ofstream out{ this->filename, std::ios::binary };
+        out.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    const std::vector<std::vector<real_type>> correct_data{
+        { real_type{ -1.117827500607882 }, real_type{ -2.9087188881250993 }, real_type{ 0.66638344270039144 }, real_type{ 1.0978832703949288 } },
+        { real_type{ -0.5282118298909262 }, real_type{ -0.335880984968183973 }, real_type{ 0.51687296029754564 }, real_type{ 0.54604461446026 } },
+        { real_type{ 0.57650218263054642 }, real_type{ 1.01405596624706053 }, real_type{ 0.13009428079760464 }, real_type{ 0.7261913886869387 } },
+        { real_type{ -0.20981208921241892 }, real_type{ 0.60276937379453293 }, real_type{ -0.13086851759108944 }, real_type{ 0.10805254527169827 } },
+        { real_type{ 1.88494043717792 }, real_type{ 1.00518564317278263 }, real_type{ 0.298499933047586044 }, real_type{ 1.6464627048813514 } }
+    };
+    const std::vector<int> correct_label{ 1, 1, -1, -1, -1 };
+};
+TYPED_TEST_SUITE(NPYParse, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(NPYParse, read) {
+    using real_type = TypeParam;
+
+    // parse the NumPy file, the last column contains the labels
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/5x4.npy" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_npy_data<real_type, int>(reader);
+
+    // check for correct sizes
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+
+    // check for correct data
+    if constexpr (std::is_same_v<real_type, double>) {
+        // the values must be bitwise identical
+        EXPECT_EQ(data, this->correct_data);
+    } else {
+        EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, this->correct_data);
+    }
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(NPYParse, read_float) {
+    using real_type = TypeParam;
+
+    // parse the NumPy file storing single precision values
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/5x4_float.npy" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_npy_data<real_type, int>(reader);
+
+    // check for correct data
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+    for (std::size_t i = 0; i < num_data_points; ++i) {
+        for (std::size_t j = 0; j < num_features; ++j) {
+            EXPECT_EQ(data[i][j], static_cast<real_type>(static_cast<float>(this->correct_data[i][j])));
+        }
+    }
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(NPYParse, read_fortran_order) {
+    using real_type = TypeParam;
+
+    // parse the NumPy file storing the array in column-major order
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/5x4_fortran_order.npy" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_npy_data<real_type, int>(reader);
+
+    // check for correct data
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, this->correct_data);
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(NPYParse, read_int_first_label_column) {
+    using real_type = TypeParam;
+
+    // parse the NumPy file storing integer values with the labels in the first column
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/5x4_int.npy" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_npy_data<real_type, int>(reader, 0);
+
+    // check for correct data
+    ASSERT_EQ(num_data_points, 5);
+    ASSERT_EQ(num_features, 4);
+    const std::vector<real_type> correct_data_point{ real_type{ 1 }, real_type{ 2 }, real_type{ 3 }, real_type{ 4 } };
+    EXPECT_EQ(data, (std::vector<std::vector<real_type>>(5, correct_data_point)));
+    EXPECT_EQ(label, this->correct_label);
+}
+TYPED_TEST(NPYParse, read_without_label) {
+    using real_type = TypeParam;
+
+    // parse the NumPy file without labels
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/3x2_without_label.npy" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_npy_data<real_type, int>(reader, std::nullopt);
+
+    // check for correct data
+    ASSERT_EQ(num_data_points, 3);
+    ASSERT_EQ(num_features, 2);
+    const std::vector<std::vector<real_type>> correct_data{
+        { real_type{ 1.5 }, real_type{ -2.9 } },
+        { real_type{ 0.0 }, real_type{ -0.3 } },
+        { real_type{ 5.5 }, real_type{ 0.0 } }
+    };
+    EXPECT_FLOATING_POINT_2D_VECTOR_NEAR(data, correct_data);
+    EXPECT_TRUE(label.empty());
+}
+TYPED_TEST(NPYParse, read_string_label) {
+    using real_type = TypeParam;
+
+    // numeric labels are converted to strings
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/5x4.npy" };
+    const auto [num_data_points, num_features, data, label] = plssvm::detail::io::parse_npy_data<real_type, std::string>(reader);
+
+    // check for correct labels
+    ASSERT_EQ(num_data_points, 5);
+    EXPECT_EQ(label, (std::vector<std::string>{ "1", "1", "-1", "-1", "-1" }));
+}
+TYPED_TEST(NPYParse, label_column_out_of_range) {
+    using real_type = TypeParam;
+
+    // the NumPy array only has 5 columns
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/5x4.npy" };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader, 5)),
+                      plssvm::invalid_file_format_exception,
+                      "The label column 5 is out of range for a NumPy array with 5 columns!");
+}
+TYPED_TEST(NPYParse, non_integral_label) {
+    using real_type = TypeParam;
+
+    // the second column contains non-integral values
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/npy/5x4.npy" };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader, 1)),
+                      plssvm::invalid_file_format_exception,
+                      "Can't convert the non-integral label -2.908718888125099 to a value of type int!");
+}
+TYPED_TEST(NPYParse, invalid_magic_bytes) {
+    using real_type = TypeParam;
+
+    // overwrite the magic bytes
+    this->write_modified(PLSSVM_TEST_PATH "/data/npy/5x4.npy", 1, "FOOBAR");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The NumPy file must start with \"\\x93NUMPY\"!");
+}
+TYPED_TEST(NPYParse, unsupported_version) {
+    using real_type = TypeParam;
+
+    // overwrite the major version
+    this->write_modified(PLSSVM_TEST_PATH "/data/npy/5x4.npy", 6, std::string(1, '\x04'));
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unsupported NumPy file format version 4 (supported: 1, 2, and 3)!");
+}
+TYPED_TEST(NPYParse, unsupported_data_type) {
+    using real_type = TypeParam;
+
+    // replace '<f8' by '>f8' (big-endian)
+    this->write_modified(PLSSVM_TEST_PATH "/data/npy/5x4.npy", 21, ">");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unsupported NumPy data type '>f8' (supported: '<f4', '<f8', '<i4', and '<i8')!");
+}
+TYPED_TEST(NPYParse, truncated_file) {
+    using real_type = TypeParam;
+
+    // remove the last data point
+    std::ifstream in{ PLSSVM_TEST_PATH "/data/npy/5x4.npy", std::ios::binary };
+    const std::string content{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+    {
+        std::ofstream out{ this->filename, std::ios::binary };
+        out.write(content.data(), static_cast<std::streamsize>(content.size() - 5 * sizeof(double)));
+    }
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unexpected end of the NumPy file: need 328 bytes, but only 288 are present!");
+}
+TYPED_TEST(NPYParse, huge_shape) {
+    using real_type = TypeParam;
+
+    // the shape (5, 5) starts at byte 60; the header is padded with spaces, i.e., the shape can be made longer
+    this->write_modified(PLSSVM_TEST_PATH "/data/npy/5x4.npy", 60, "(100000000000, 5), }");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "Unexpected end of the NumPy file: need 4000000000128 bytes, but only 328 are present!");
+}
+TYPED_TEST(NPYParse, overflowing_shape) {
+    using real_type = TypeParam;
+
+    // the number of needed bytes (2^62 * 5 * 8) isn't representable
+    this->write_modified(PLSSVM_TEST_PATH "/data/npy/5x4.npy", 60, "(4611686018427387904, 5), }");
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The NumPy array with the shape (4611686018427387904, 5) is too large!");
+}
+TYPED_TEST(NPYParse, libsvm_file) {
+    using real_type = TypeParam;
+
+    // a LIBSVM file isn't a NumPy file
+    const plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::parse_npy_data<real_type, int>(reader)),
+                      plssvm::invalid_file_format_exception,
+                      "The NumPy file must start with \"\\x93NUMPY\"!");
+}
+
+template <typename T>
+class NPYParseDeathTest : public ::testing::Test {};
+TYPED_TEST_SUITE(NPYParseDeathTest, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(NPYParseDeathTest, invalid_file_reader) {
+    // open file_reader without associating it to a file
+    const plssvm::detail::io::file_reader reader{};
+    // try to parse the NumPy file
+    EXPECT_DEATH((std::ignore = plssvm::detail::io::parse_npy_data<TypeParam, int>(reader)),
+                 "The file_reader is currently not associated with a file!");
+}
+
+template <typename T>
+class NPYWrite : public ::testing::Test, protected util::temporary_file {};
+TYPED_TEST_SUITE(NPYWrite, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(NPYWrite, write_with_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // define data to write
+    const std::vector<std::vector<real_type>> data{
+        { real_type{ 1.1 }, real_type{ 1.2 }, real_type{ 1.3 } },
+        { real_type{ 2.1 }, real_type{ 2.2 }, real_type{ 2.3 } },
+        { real_type{ 3.1 }, real_type{ 3.2 }, real_type{ 3.3 } }
+    };
+    const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+    const std::vector<label_type> label = { first_label, second_label, first_label };
+
+    if constexpr (std::is_same_v<label_type, std::string>) {
+        // the NumPy file format only supports numeric labels
+        EXPECT_THROW_WHAT(plssvm::detail::io::write_npy_data(this->filename, data, label),
+                          plssvm::invalid_file_format_exception,
+                          fmt::format("Can't convert 'cat' to a value of type {}!", plssvm::detail::arithmetic_type_name<real_type>()));
+    } else {
+        // write the necessary data to the file
+        plssvm::detail::io::write_npy_data(this->filename, data, label);
+
+        // read the previously written file: the header is padded such that the array is aligned
+        const plssvm::detail::io::file_reader reader{ this->filename };
+        const plssvm::detail::io::npy_header header = plssvm::detail::io::parse_npy_header(reader);
+        EXPECT_EQ(header.data_offset % plssvm::detail::io::npy_alignment, 0);
+        EXPECT_EQ(header.item_size, sizeof(real_type));
+        EXPECT_FALSE(header.fortran_order);
+        EXPECT_EQ(header.num_rows, 3);
+        EXPECT_EQ(header.num_cols, 4);
+
+        // the data points must be bitwise identical
+        const auto [num_data_points, num_features, parsed_data, parsed_label] = plssvm::detail::io::parse_npy_data<real_type, label_type>(reader);
+        ASSERT_EQ(num_data_points, 3);
+        ASSERT_EQ(num_features, 3);
+        EXPECT_EQ(parsed_data, data);
+        EXPECT_EQ(parsed_label, label);
+    }
+}
+TYPED_TEST(NPYWrite, write_without_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // define data to write
+    const std::vector<std::vector<real_type>> data{
+        { real_type{ 1.1 }, real_type{ 1.2 }, real_type{ 1.3 } },
+        { real_type{ 2.1 }, real_type{ 2.2 }, real_type{ 2.3 } }
+    };
+
+    // write the necessary data to the file
+    plssvm::detail::io::write_npy_data(this->filename, data);
+
+    // read the previously written file
+    const plssvm::detail::io::file_reader reader{ this->filename };
+    const auto [num_data_points, num_features, parsed_data, parsed_label] = plssvm::detail::io::parse_npy_data<real_type, label_type>(reader, std::nullopt);
+    ASSERT_EQ(num_data_points, 2);
+    ASSERT_EQ(num_features, 3);
+    EXPECT_EQ(parsed_data, data);
+    EXPECT_TRUE(parsed_label.empty());
+}
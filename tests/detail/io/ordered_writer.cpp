@@ -0,0 +1,120 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the parallel writer retaining the order of the written rows.
+ */
+
+#include "plssvm/detail/io/ordered_writer.hpp"
+
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::exception
+
+#include "../../custom_test_macros.hpp"      // EXPECT_THROW_WHAT
+#include "../../utility.hpp"                 // util::temporary_file
+
+#include "fmt/format.h"                      // fmt::format, fmt::format_to
+#include "fmt/os.h"                          // fmt::ostream, fmt::output_file
+#include "gtest/gtest.h"                     // TEST, TEST_P, TEST_F, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, EXPECT_DEATH
+                                             // ::testing::{Test, TestWithParam, Values}
+
+#include <cstddef>                           // std::size_t
+#include <fstream>                           // std::ifstream
+#include <iterator>                          // std::istreambuf_iterator, std::back_inserter
+#include <string>                            // std::string
+
+TEST(OrderedWriterRowsPerBlock, rows_per_block) {
+    // a block should contain roughly 1 MiB
+    EXPECT_EQ(plssvm::detail::io::ordered_writer_rows_per_block(1024), 1024);
+    EXPECT_EQ(plssvm::detail::io::ordered_writer_rows_per_block(plssvm::detail::io::ordered_writer_block_bytes), 1);
+}
+TEST(OrderedWriterRowsPerBlock, at_least_one_row) {
+    // at least one row is always used
+    EXPECT_EQ(plssvm::detail::io::ordered_writer_rows_per_block(4 * plssvm::detail::io::ordered_writer_block_bytes), 1);
+    // rows without any content are treated as one byte
+    EXPECT_EQ(plssvm::detail::io::ordered_writer_rows_per_block(0), plssvm::detail::io::ordered_writer_block_bytes);
+}
+
+class OrderedWriterBase : protected util::temporary_file {
+  protected:
+    /**
+     * @brief Write @p num_rows rows, each containing its row index, to the temporary file using @p rows_per_block rows per block.
+     * @param[in] num_rows the number of rows to write
+     * @param[in] rows_per_block the number of rows per block
+     */
+    void write_rows(const std::size_t num_rows, const std::size_t rows_per_block) const {
+        fmt::ostream out = fmt::output_file(this->filename);
+        plssvm::detail::io::write_ordered(out, num_rows, rows_per_block, [](std::string &output, const std::size_t row) {
+            fmt::format_to(std::back_inserter(output), "{}\n", row);
+        });
+    }
+    /**
+     * @brief Read the whole content of the temporary file.
+     * @return the file content (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::string read_content() const {
+        std::ifstream in{ this->filename };
+        return std::string{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+    }
+};
+
+class OrderedWriter : public ::testing::TestWithParam<std::size_t>, protected OrderedWriterBase {};
+TEST_P(OrderedWriter, write_in_order) {
+    constexpr std::size_t num_rows = 10'000;
+
+    // write the rows using the current block size
+    this->write_rows(num_rows, GetParam());
+
+    // the rows must be written in ascending order
+    std::string correct_content;
+    for (std::size_t row = 0; row < num_rows; ++row) {
+        correct_content += fmt::format("{}\n", row);
+    }
+    EXPECT_EQ(this->read_content(), correct_content);
+}
+TEST_P(OrderedWriter, deterministic) {
+    // writing the same rows multiple times must always result in the same file
+    this->write_rows(5'000, GetParam());
+    const std::string first_content = this->read_content();
+    for (std::size_t i = 0; i < 5; ++i) {
+        this->write_rows(5'000, GetParam());
+        EXPECT_EQ(this->read_content(), first_content);
+    }
+}
+INSTANTIATE_TEST_SUITE_P(OrderedWriter, OrderedWriter, ::testing::Values(1, 3, 64, 10'000, 20'000));
+
+class OrderedWriterContent : public ::testing::Test, protected OrderedWriterBase {};
+TEST_F(OrderedWriterContent, no_rows) {
+    // nothing should be written
+    this->write_rows(0, 8);
+    EXPECT_EQ(this->read_content(), "");
+}
+TEST_F(OrderedWriterContent, first_exception_in_row_order) {
+    {
+        fmt::ostream out = fmt::output_file(this->filename);
+        EXPECT_THROW_WHAT(plssvm::detail::io::write_ordered(out, 1'000, 1, [](std::string &output, const std::size_t row) {
+                              if (row == 10 || row == 500) {
+                                  throw plssvm::exception{ fmt::format("invalid row {}", row) };
+                              }
+                              fmt::format_to(std::back_inserter(output), "{}\n", row);
+                          }),
+                          plssvm::exception,
+                          "invalid row 10");
+    }
+
+    // only the rows before the first failing row have been written
+    std::string correct_content;
+    for (std::size_t row = 0; row < 10; ++row) {
+        correct_content += fmt::format("{}\n", row);
+    }
+    EXPECT_EQ(this->read_content(), correct_content);
+}
+
+TEST(OrderedWriterDeathTest, zero_rows_per_block) {
+    util::temporary_file tmp_file{};
+    fmt::ostream out = fmt::output_file(tmp_file.filename);
+    EXPECT_DEATH(plssvm::detail::io::write_ordered(out, 1, 0, [](std::string &, std::size_t) {}),
+                 "The number of rows per block must be greater than 0!");
+}
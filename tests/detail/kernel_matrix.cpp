@@ -0,0 +1,156 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the functions explicitly computing kernel matrices on the host and solving the reduced LS-SVM system using them.
+ */
+
+#include "plssvm/detail/kernel_matrix.hpp"
+
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type, plssvm::kernel_function
+#include "plssvm/parameter.hpp"              // plssvm::parameter, plssvm::detail::parameter
+
+#include "../custom_test_macros.hpp"         // EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_NEAR, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_FLOATING_POINT_NEAR_EPS
+#include "../naming.hpp"                     // naming::real_type_to_name
+#include "../types_to_test.hpp"              // util::real_type_gtest
+
+#include "gtest/gtest.h"                     // TYPED_TEST_SUITE, TYPED_TEST, ASSERT_EQ, EXPECT_GE, EXPECT_LE, ::testing::Test
+
+#include <cstddef>                           // std::size_t
+#include <tuple>                             // std::ignore
+#include <vector>                            // std::vector
+
+template <typename T>
+class KernelMatrix : public ::testing::Test {
+  protected:
+    using real_type = T;
+
+    std::vector<std::vector<real_type>> lhs{ { 1.0, 2.0, 3.0 }, { -1.0, 0.5, 2.0 } };
+    std::vector<std::vector<real_type>> rhs{ { 0.0, 1.0, -1.0 }, { 2.0, 2.0, 2.0 }, { 1.5, -0.5, 1.0 } };
+
+    /**
+     * @brief Calculate the `lhs.size()` x `rhs.size()` kernel matrix using the plssvm::kernel_function.
+     * @param[in] params the kernel function parameter
+     * @return the kernel matrix
+     */
+    [[nodiscard]] std::vector<real_type> ground_truth(const plssvm::detail::parameter<real_type> &params) const {
+        std::vector<real_type> kernel_matrix;
+        for (const std::vector<real_type> &x : lhs) {
+            for (const std::vector<real_type> &y : rhs) {
+                kernel_matrix.push_back(plssvm::kernel_function(x, y, params));
+            }
+        }
+        return kernel_matrix;
+    }
+};
+TYPED_TEST_SUITE(KernelMatrix, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(KernelMatrix, compute_base_matrix_linear) {
+    using real_type = TypeParam;
+
+    // the base values for the linear kernel are the inner products
+    const std::vector<real_type> base = plssvm::detail::compute_base_matrix(plssvm::kernel_function_type::linear, this->lhs, this->rhs);
+    const std::vector<real_type> correct{ -1.0, 12.0, 3.5, -1.5, 3.0, 0.25 };
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(base, correct);
+}
+TYPED_TEST(KernelMatrix, compute_base_matrix_rbf) {
+    using real_type = TypeParam;
+
+    // the base values for the rbf kernel are the squared euclidean distances
+    const std::vector<real_type> base = plssvm::detail::compute_base_matrix(plssvm::kernel_function_type::rbf, this->lhs, this->rhs);
+    const std::vector<real_type> correct{ 18.0, 2.0, 10.5, 10.25, 11.25, 8.25 };
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(base, correct);
+}
+TYPED_TEST(KernelMatrix, compute_base_matrix_symmetric) {
+    using real_type = TypeParam;
+
+    // the base matrix of the same data points must be symmetric with a zero diagonal for the rbf kernel
+    const std::vector<real_type> base = plssvm::detail::compute_base_matrix(plssvm::kernel_function_type::rbf, this->rhs, this->rhs);
+    ASSERT_EQ(base.size(), 9);
+    for (std::size_t row = 0; row < 3; ++row) {
+        EXPECT_FLOATING_POINT_EQ(base[row * 3 + row], real_type{ 0.0 });
+        for (std::size_t col = 0; col < 3; ++col) {
+            EXPECT_FLOATING_POINT_EQ(base[row * 3 + col], base[col * 3 + row]);
+        }
+    }
+}
+TYPED_TEST(KernelMatrix, apply_kernel_function) {
+    using real_type = TypeParam;
+
+    for (const plssvm::kernel_function_type kernel : { plssvm::kernel_function_type::linear, plssvm::kernel_function_type::polynomial, plssvm::kernel_function_type::rbf }) {
+        const auto params = static_cast<plssvm::detail::parameter<real_type>>(plssvm::parameter{ plssvm::kernel_type = kernel, plssvm::gamma = 0.1, plssvm::degree = 2, plssvm::coef0 = 0.5 });
+
+        const std::vector<real_type> base = plssvm::detail::compute_base_matrix(kernel, this->lhs, this->rhs);
+        std::vector<real_type> kernel_matrix(base.size());
+        plssvm::detail::apply_kernel_function(params, base, kernel_matrix);
+
+        // the kernel matrix must match the plssvm::kernel_function
+        EXPECT_FLOATING_POINT_VECTOR_NEAR(kernel_matrix, this->ground_truth(params));
+    }
+}
+TYPED_TEST(KernelMatrix, apply_kernel_function_in_place) {
+    using real_type = TypeParam;
+
+    const auto params = static_cast<plssvm::detail::parameter<real_type>>(plssvm::parameter{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::gamma = 0.1 });
+
+    // the base values may be transformed in-place
+    std::vector<real_type> kernel_matrix = plssvm::detail::compute_base_matrix(plssvm::kernel_function_type::rbf, this->lhs, this->rhs);
+    plssvm::detail::apply_kernel_function(params, kernel_matrix, kernel_matrix);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(kernel_matrix, this->ground_truth(params));
+}
+TYPED_TEST(KernelMatrix, solve_reduced_system_of_linear_equations) {
+    using real_type = TypeParam;
+
+    const auto params = static_cast<plssvm::detail::parameter<real_type>>(plssvm::parameter{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::gamma = 0.1 });
+    std::vector<real_type> kernel_matrix = plssvm::detail::compute_base_matrix(plssvm::kernel_function_type::rbf, this->rhs, this->rhs);
+    plssvm::detail::apply_kernel_function(params, kernel_matrix, kernel_matrix);
+    const std::vector<real_type> y{ 1.0, -1.0, 1.0 };
+
+    // solve the reduced system using all data points
+    std::vector<real_type> alpha(2, real_type{ 1.0 });
+    const unsigned long long num_iterations = plssvm::detail::solve_reduced_system_of_linear_equations(kernel_matrix, y, std::vector<std::size_t>{}, real_type{ 1.0 }, real_type{ 1e-10 }, 2, alpha);
+    EXPECT_GE(num_iterations, 1);
+    EXPECT_LE(num_iterations, 2);
+    const real_type rho = plssvm::detail::calculate_reduced_rho(kernel_matrix, y, std::vector<std::size_t>{}, real_type{ 1.0 }, alpha);
+
+    // the solution must fulfill the full LS-SVM system: (K + I / cost) * alpha_full - rho = y with sum(alpha_full) = 0
+    const std::vector<real_type> alpha_full{ alpha[0], alpha[1], -(alpha[0] + alpha[1]) };
+    for (std::size_t row = 0; row < 3; ++row) {
+        real_type temp{ -rho };
+        for (std::size_t col = 0; col < 3; ++col) {
+            temp += (kernel_matrix[row * 3 + col] + (row == col ? real_type{ 1.0 } : real_type{ 0.0 })) * alpha_full[col];
+        }
+        EXPECT_FLOATING_POINT_NEAR_EPS(temp, y[row], 1e4);
+    }
+
+    // the same system spanned by (permuted) indices must yield the same solution
+    std::vector<real_type> alpha_indices(2, real_type{ 1.0 });
+    std::ignore = plssvm::detail::solve_reduced_system_of_linear_equations(kernel_matrix, y, std::vector<std::size_t>{ 0, 1, 2 }, real_type{ 1.0 }, real_type{ 1e-10 }, 2, alpha_indices);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(alpha_indices, alpha);
+    EXPECT_FLOATING_POINT_NEAR(plssvm::detail::calculate_reduced_rho(kernel_matrix, y, std::vector<std::size_t>{ 0, 1, 2 }, real_type{ 1.0 }, alpha_indices), rho);
+}
+TYPED_TEST(KernelMatrix, solve_reduced_system_of_linear_equations_subset) {
+    using real_type = TypeParam;
+
+    const auto params = static_cast<plssvm::detail::parameter<real_type>>(plssvm::parameter{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::gamma = 0.1 });
+    std::vector<real_type> kernel_matrix = plssvm::detail::compute_base_matrix(plssvm::kernel_function_type::rbf, this->rhs, this->rhs);
+    plssvm::detail::apply_kernel_function(params, kernel_matrix, kernel_matrix);
+    const std::vector<real_type> y{ 1.0, -1.0, 1.0 };
+
+    // the system spanned by a subset of the data points must be identical to the system of the explicitly extracted sub-matrix
+    const std::vector<std::size_t> indices{ 2, 1 };
+    std::vector<real_type> alpha(1, real_type{ 1.0 });
+    std::ignore = plssvm::detail::solve_reduced_system_of_linear_equations(kernel_matrix, y, indices, real_type{ 1.0 }, real_type{ 1e-10 }, 1, alpha);
+
+    const std::vector<real_type> sub_kernel_matrix{ kernel_matrix[2 * 3 + 2], kernel_matrix[2 * 3 + 1], kernel_matrix[1 * 3 + 2], kernel_matrix[1 * 3 + 1] };
+    const std::vector<real_type> sub_y{ y[2], y[1] };
+    std::vector<real_type> sub_alpha(1, real_type{ 1.0 });
+    std::ignore = plssvm::detail::solve_reduced_system_of_linear_equations(sub_kernel_matrix, sub_y, std::vector<std::size_t>{}, real_type{ 1.0 }, real_type{ 1e-10 }, 1, sub_alpha);
+
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(alpha, sub_alpha);
+    EXPECT_FLOATING_POINT_NEAR(plssvm::detail::calculate_reduced_rho(kernel_matrix, y, indices, real_type{ 1.0 }, alpha),
+                               plssvm::detail::calculate_reduced_rho(sub_kernel_matrix, sub_y, std::vector<std::size_t>{}, real_type{ 1.0 }, sub_alpha));
+}
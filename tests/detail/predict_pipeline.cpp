@@ -0,0 +1,131 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the pipeline predicting a LIBSVM file chunk by chunk.
+ */
+
+#include "plssvm/detail/predict_pipeline.hpp"
+
+#include "plssvm/data_set.hpp"                       // plssvm::data_set
+#include "plssvm/detail/io/libsvm_chunk_reader.hpp"  // plssvm::detail::io::libsvm_chunk_reader
+#include "plssvm/exceptions/exceptions.hpp"          // plssvm::invalid_file_format_exception, plssvm::exception
+
+#include "../custom_test_macros.hpp"                 // EXPECT_THROW_WHAT
+#include "../utility.hpp"                            // util::{temporary_file, redirect_output}
+
+#include "fmt/format.h"                              // fmt::format, fmt::join
+#include "gtest/gtest.h"                             // TEST, TEST_F, TEST_P, INSTANTIATE_TEST_SUITE_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW, EXPECT_DEATH
+                                                     // ::testing::{Test, TestWithParam, Values}
+
+#include <cstddef>                                   // std::size_t
+#include <fstream>                                   // std::ifstream
+#include <iterator>                                  // std::istreambuf_iterator
+#include <string>                                    // std::string
+#include <tuple>                                     // std::ignore
+#include <vector>                                    // std::vector
+
+TEST(PredictPipelineChunkSize, without_memory_limit) {
+    // without a memory limit, the chunk size is used as is
+    EXPECT_EQ(plssvm::detail::predict_pipeline_chunk_size(42, 0, 4, sizeof(double)), 42);
+}
+TEST(PredictPipelineChunkSize, memory_limit) {
+    // two chunks of data points must fit into the memory limit
+    const std::size_t bytes_per_data_point = 4 * sizeof(double) + sizeof(std::vector<double>);
+    EXPECT_EQ(plssvm::detail::predict_pipeline_chunk_size(0, 20 * bytes_per_data_point, 4, sizeof(double)), 10);
+    EXPECT_EQ(plssvm::detail::predict_pipeline_chunk_size(5, 20 * bytes_per_data_point, 4, sizeof(double)), 5);
+    EXPECT_EQ(plssvm::detail::predict_pipeline_chunk_size(42, 20 * bytes_per_data_point, 4, sizeof(double)), 10);
+}
+TEST(PredictPipelineChunkSize, memory_limit_too_small) {
+    // at least one data point is always used
+    EXPECT_EQ(plssvm::detail::predict_pipeline_chunk_size(0, 1, 4, sizeof(double)), 1);
+}
+TEST(PredictPipelineChunkSizeDeathTest, neither_chunk_size_nor_memory_limit) {
+    EXPECT_DEATH(std::ignore = plssvm::detail::predict_pipeline_chunk_size(0, 0, 4, sizeof(double)),
+                 "Either the chunk size or the memory limit must be provided!");
+}
+
+class PredictPipeline : public ::testing::TestWithParam<std::size_t>, private util::redirect_output<>, protected util::temporary_file {
+  protected:
+    /**
+     * @brief Predict the label based on the sign of the first feature.
+     * @param[in] data the data points to predict
+     * @return the predicted labels (`[[nodiscard]]`)
+     */
+    [[nodiscard]] static std::vector<int> predict(const plssvm::data_set<double, int> &data) {
+        std::vector<int> predicted_labels;
+        for (const std::vector<double> &data_point : data.data()) {
+            predicted_labels.push_back(data_point.front() > 0.0 ? 1 : -1);
+        }
+        return predicted_labels;
+    }
+    /**
+     * @brief Read the whole content of the temporary file.
+     * @return the file content (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::string read_content() const {
+        std::ifstream in{ this->filename };
+        return std::string{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+    }
+};
+TEST_P(PredictPipeline, predict) {
+    const std::string input_filename = PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm";
+
+    // predict the data set at once
+    const plssvm::data_set<double, int> data{ input_filename };
+    const std::vector<int> correct_predicted_labels = PredictPipeline::predict(data);
+    const std::vector<int> &correct_labels = data.labels().value();
+    std::size_t correct{ 0 };
+    for (std::size_t i = 0; i < correct_predicted_labels.size(); ++i) {
+        if (correct_predicted_labels[i] == correct_labels[i]) {
+            ++correct;
+        }
+    }
+
+    // predict the data set in chunks
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ input_filename, data.num_features() };
+    const plssvm::detail::predict_pipeline_result result = plssvm::detail::run_predict_pipeline(reader, this->filename, GetParam(), &PredictPipeline::predict);
+
+    // check the statistics
+    EXPECT_EQ(result.num_data_points, 500);
+    EXPECT_EQ(result.num_chunks, (500 + GetParam() - 1) / GetParam());
+    EXPECT_TRUE(result.has_labels);
+    EXPECT_EQ(result.num_correct, correct);
+    // the written file must be identical to the one written after predicting the whole data set at once
+    EXPECT_EQ(this->read_content(), fmt::format("{}", fmt::join(correct_predicted_labels, "\n")));
+}
+INSTANTIATE_TEST_SUITE_P(PredictPipeline, PredictPipeline, ::testing::Values(1, 3, 64, 500, 1000));
+
+class PredictPipelineFile : public ::testing::Test, private util::redirect_output<>, protected util::temporary_file {};
+TEST_F(PredictPipelineFile, without_label) {
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm", 2 };
+    const plssvm::detail::predict_pipeline_result result = plssvm::detail::run_predict_pipeline(reader, this->filename, 2, [](const plssvm::data_set<double, int> &data) {
+        return std::vector<int>(data.num_data_points(), 1);
+    });
+
+    EXPECT_EQ(result.num_data_points, 3);
+    EXPECT_EQ(result.num_chunks, 2);
+    EXPECT_FALSE(result.has_labels);
+    EXPECT_EQ(result.num_correct, 0);
+}
+TEST_F(PredictPipelineFile, empty) {
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ PLSSVM_TEST_PATH "/data/empty.txt", 2 };
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::run_predict_pipeline(reader, this->filename, 2, [](const plssvm::data_set<double, int> &data) { return std::vector<int>(data.num_data_points(), 1); }),
+                      plssvm::invalid_file_format_exception,
+                      "Can't parse file: no data points are given!");
+}
+TEST_F(PredictPipelineFile, invalid_data_point) {
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ PLSSVM_TEST_PATH "/data/libsvm/invalid/zero_based_features.libsvm", 4 };
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::run_predict_pipeline(reader, this->filename, 2, [](const plssvm::data_set<double, int> &data) { return std::vector<int>(data.num_data_points(), 1); }),
+                      plssvm::invalid_file_format_exception,
+                      "LIBSVM assumes a 1-based feature indexing scheme, but 0 was given!");
+}
+TEST_F(PredictPipelineFile, predict_throws) {
+    plssvm::detail::io::libsvm_chunk_reader<double, int> reader{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm", 4 };
+    EXPECT_THROW_WHAT(std::ignore = plssvm::detail::run_predict_pipeline(reader, this->filename, 2, [](const plssvm::data_set<double, int> &) -> std::vector<int> { throw plssvm::exception{ "predict failed" }; }),
+                      plssvm::exception,
+                      "predict failed");
+}
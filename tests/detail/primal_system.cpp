@@ -0,0 +1,71 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the function assembling the low-dimensional primal LS-SVM system.
+ */
+
+#include "plssvm/detail/primal_system.hpp"
+
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type, plssvm::kernel_function
+#include "plssvm/parameter.hpp"              // plssvm::parameter, plssvm::detail::parameter
+
+#include "../custom_test_macros.hpp"         // EXPECT_FLOATING_POINT_VECTOR_NEAR
+#include "../naming.hpp"                     // naming::real_type_to_name
+#include "../types_to_test.hpp"              // util::real_type_gtest
+
+#include "gtest/gtest.h"                     // TYPED_TEST_SUITE, TYPED_TEST, ASSERT_EQ, ::testing::Test
+
+#include <cstddef>                           // std::size_t
+#include <vector>                            // std::vector
+
+template <typename T>
+class PrimalSystem : public ::testing::Test {};
+TYPED_TEST_SUITE(PrimalSystem, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(PrimalSystem, assemble_primal_system) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> X{ { 1.0, 2.0 }, { -1.0, 0.5 }, { 0.0, 1.0 }, { 2.0, 2.0 } };
+    const std::vector<real_type> targets{ 1.0, -1.0, -1.0, 1.0 };
+    const std::vector<std::size_t> basis{ 3, 1 };
+    const auto params = static_cast<plssvm::detail::parameter<real_type>>(plssvm::parameter{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::gamma = 0.1 });
+    const double cost = 2.0;
+
+    std::vector<double> A;
+    std::vector<double> b;
+    plssvm::detail::assemble_primal_system(X, basis, targets, params, cost, A, b);
+
+    // explicitly build the system [K_mm / C + K_mn * K_nm, K_mn * 1; 1^T * K_nm, n] * [beta; b] = [K_mn * t; 1^T * t]
+    const std::size_t n = X.size();
+    const std::size_t m = basis.size();
+    const std::size_t dim = m + 1;
+    std::vector<double> correct_A(dim * dim, 0.0);
+    std::vector<double> correct_b(dim, 0.0);
+    const auto kernel = [&](const std::size_t lhs, const std::size_t rhs) { return static_cast<double>(plssvm::kernel_function(X[lhs], X[rhs], params)); };
+    for (std::size_t j = 0; j < m; ++j) {
+        for (std::size_t l = 0; l < m; ++l) {
+            for (std::size_t i = 0; i < n; ++i) {
+                correct_A[j * dim + l] += kernel(i, basis[j]) * kernel(i, basis[l]);
+            }
+            correct_A[j * dim + l] += kernel(basis[j], basis[l]) / cost;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            correct_A[j * dim + m] += kernel(i, basis[j]);
+            correct_b[j] += kernel(i, basis[j]) * static_cast<double>(targets[i]);
+        }
+        correct_A[m * dim + j] = correct_A[j * dim + m];
+    }
+    correct_A[m * dim + m] = static_cast<double>(n);
+    for (const real_type t : targets) {
+        correct_b[m] += static_cast<double>(t);
+    }
+
+    ASSERT_EQ(A.size(), dim * dim);
+    ASSERT_EQ(b.size(), dim);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(A, correct_A);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(b, correct_b);
+}
@@ -43,12 +43,14 @@ template <typename T>
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(invalid_parameter_exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(file_reader_exception)
+PLSSVM_CREATE_EXCEPTION_TYPE_NAME(file_exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(data_set_exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(file_not_found_exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(invalid_file_format_exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(unsupported_backend_exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(unsupported_kernel_type_exception)
 PLSSVM_CREATE_EXCEPTION_TYPE_NAME(gpu_device_ptr_exception)
+PLSSVM_CREATE_EXCEPTION_TYPE_NAME(operation_cancelled_exception)
 
 }  // namespace util
 
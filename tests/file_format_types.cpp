@@ -10,21 +10,26 @@
 
 #include "plssvm/file_format_types.hpp"
 
-#include "custom_test_macros.hpp"  // EXPECT_CONVERSION_TO_STRING, EXPECT_CONVERSION_FROM_STRING
+#include "plssvm/sampling_types.hpp"  // plssvm::sampling_type
 
-#include "gtest/gtest.h"           // TEST, EXPECT_EQ, EXPECT_TRUE
+#include "custom_test_macros.hpp"     // EXPECT_CONVERSION_TO_STRING, EXPECT_CONVERSION_FROM_STRING
 
-#include <sstream>                 // std::istringstream
+#include "gtest/gtest.h"              // TEST, EXPECT_EQ, EXPECT_TRUE
+
+#include <sstream>                    // std::istringstream
 
 // check whether the plssvm::file_format_type -> std::string conversions are correct
 TEST(FileFormatType, to_string) {
     // check conversions to std::string
     EXPECT_CONVERSION_TO_STRING(plssvm::file_format_type::libsvm, "libsvm");
     EXPECT_CONVERSION_TO_STRING(plssvm::file_format_type::arff, "arff");
+    EXPECT_CONVERSION_TO_STRING(plssvm::file_format_type::binary, "binary");
+    EXPECT_CONVERSION_TO_STRING(plssvm::file_format_type::csv, "csv");
+    EXPECT_CONVERSION_TO_STRING(plssvm::file_format_type::npy, "npy");
 }
 TEST(FileFormatType, to_string_unknown) {
     // check conversions to std::string from unknown file_format_type
-    EXPECT_CONVERSION_TO_STRING(static_cast<plssvm::file_format_type>(2), "unknown");
+    EXPECT_CONVERSION_TO_STRING(static_cast<plssvm::file_format_type>(5), "unknown");
 }
 
 // check whether the std::string -> plssvm::file_format_type conversions are correct
@@ -34,6 +39,12 @@ TEST(FileFormatType, from_string) {
     EXPECT_CONVERSION_FROM_STRING("libsvm", plssvm::file_format_type::libsvm);
     EXPECT_CONVERSION_FROM_STRING("ARFF", plssvm::file_format_type::arff);
     EXPECT_CONVERSION_FROM_STRING("arff", plssvm::file_format_type::arff);
+    EXPECT_CONVERSION_FROM_STRING("BINARY", plssvm::file_format_type::binary);
+    EXPECT_CONVERSION_FROM_STRING("binary", plssvm::file_format_type::binary);
+    EXPECT_CONVERSION_FROM_STRING("CSV", plssvm::file_format_type::csv);
+    EXPECT_CONVERSION_FROM_STRING("csv", plssvm::file_format_type::csv);
+    EXPECT_CONVERSION_FROM_STRING("NPY", plssvm::file_format_type::npy);
+    EXPECT_CONVERSION_FROM_STRING("npy", plssvm::file_format_type::npy);
 }
 TEST(FileFormatType, from_string_unknown) {
     // foo isn't a valid file_format_type
@@ -42,3 +53,18 @@ TEST(FileFormatType, from_string_unknown) {
     input >> file_format;
     EXPECT_TRUE(input.fail());
 }
+
+TEST(SubsetOptions, default_construct) {
+    // a default constructed subset keeps everything
+    const plssvm::subset_options subset{};
+    EXPECT_TRUE(subset.features.empty());
+    EXPECT_EQ(subset.num_samples, 0);
+    EXPECT_EQ(subset.sampling, plssvm::sampling_type::uniform);
+}
+// check whether the plssvm::subset_options -> std::string conversions are correct
+TEST(SubsetOptions, to_string) {
+    // check conversions to std::string
+    EXPECT_CONVERSION_TO_STRING(plssvm::subset_options{}, "features: all, samples: all");
+    EXPECT_CONVERSION_TO_STRING((plssvm::subset_options{ { 5, 0, 1, 2, 7 }, 0, plssvm::sampling_type::uniform }), "features: 0-2,5,7, samples: all");
+    EXPECT_CONVERSION_TO_STRING((plssvm::subset_options{ {}, 10, plssvm::sampling_type::stratified }), "features: all, samples: 10 (stratified)");
+}
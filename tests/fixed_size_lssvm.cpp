@@ -0,0 +1,170 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the fixed-size LS-SVM using the Nyström method.
+ */
+
+#include "plssvm/fixed_size_lssvm.hpp"
+
+#include "plssvm/data_set.hpp"                    // plssvm::data_set
+#include "plssvm/exceptions/exceptions.hpp"       // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type, plssvm::kernel_function
+#include "plssvm/landmark_selection_types.hpp"    // plssvm::landmark_selection_type
+#include "plssvm/model.hpp"                       // plssvm::model
+#include "plssvm/parameter.hpp"                   // plssvm::parameter
+
+#include "custom_test_macros.hpp"                 // EXPECT_THROW_WHAT
+#include "naming.hpp"                             // naming::real_type_label_type_combination_to_name
+#include "types_to_test.hpp"                      // util::real_type_label_type_combination_gtest
+#include "utility.hpp"                            // util::{temporary_file, redirect_output, instantiate_template_file}
+
+#include "gtest/gtest.h"                          // TEST, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_NE, EXPECT_TRUE, ASSERT_EQ, ::testing::Test
+
+#include <algorithm>                              // std::find
+#include <cmath>                                  // std::isfinite
+#include <cstddef>                                // std::size_t
+#include <tuple>                                  // std::ignore
+#include <vector>                                 // std::vector
+
+TEST(FixedSizeLSSVM, construct) {
+    const plssvm::parameter params{ plssvm::kernel_type = plssvm::kernel_function_type::rbf };
+    const plssvm::fixed_size_lssvm approx{ params, 42, plssvm::landmark_selection_type::kmeans_pp };
+
+    EXPECT_EQ(approx.get_params(), params);
+    EXPECT_EQ(approx.num_landmarks(), 42);
+    EXPECT_EQ(approx.landmark_selection(), plssvm::landmark_selection_type::kmeans_pp);
+}
+TEST(FixedSizeLSSVM, construct_default) {
+    const plssvm::fixed_size_lssvm approx{};
+
+    EXPECT_EQ(approx.get_params(), plssvm::parameter{});
+    EXPECT_EQ(approx.num_landmarks(), 1000);
+    EXPECT_EQ(approx.landmark_selection(), plssvm::landmark_selection_type::uniform);
+}
+TEST(FixedSizeLSSVM, construct_invalid_num_landmarks) {
+    EXPECT_THROW_WHAT((plssvm::fixed_size_lssvm{ plssvm::parameter{}, 1 }),
+                      plssvm::invalid_parameter_exception,
+                      "The number of landmarks must be at least 2, but is 1!");
+}
+TEST(FixedSizeLSSVM, construct_invalid_kernel) {
+    const plssvm::parameter params{ plssvm::kernel_type = static_cast<plssvm::kernel_function_type>(3) };
+    EXPECT_THROW_WHAT(plssvm::fixed_size_lssvm{ params },
+                      plssvm::invalid_parameter_exception,
+                      "Invalid kernel function 3 given!");
+}
+TEST(FixedSizeLSSVM, construct_invalid_landmark_selection) {
+    EXPECT_THROW_WHAT((plssvm::fixed_size_lssvm{ plssvm::parameter{}, 2, static_cast<plssvm::landmark_selection_type>(3) }),
+                      plssvm::invalid_parameter_exception,
+                      "Invalid landmark selection type 3 given!");
+}
+
+template <typename T>
+class FixedSizeLSSVM : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(FixedSizeLSSVM, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(FixedSizeLSSVM, fit) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    for (const plssvm::landmark_selection_type selection : { plssvm::landmark_selection_type::uniform, plssvm::landmark_selection_type::kmeans_pp, plssvm::landmark_selection_type::entropy }) {
+        for (std::size_t num_landmarks = 2; num_landmarks <= data.num_data_points(); ++num_landmarks) {
+            const plssvm::fixed_size_lssvm approx{ plssvm::parameter{ plssvm::kernel_type = plssvm::kernel_function_type::rbf }, num_landmarks, selection };
+            const plssvm::model<real_type, label_type> model = approx.fit(data);
+
+            // the landmarks are the only support vectors
+            ASSERT_EQ(model.num_support_vectors(), num_landmarks);
+            EXPECT_EQ(model.num_features(), data.num_features());
+            ASSERT_EQ(model.weights().size(), num_landmarks);
+            EXPECT_EQ(model.different_labels(), data.different_labels().value());
+            // each landmark must be one of the original data points
+            for (std::size_t i = 0; i < num_landmarks; ++i) {
+                const auto pos = std::find(data.data().cbegin(), data.data().cend(), model.support_vectors()[i]);
+                ASSERT_NE(pos, data.data().cend());
+                EXPECT_EQ(model.labels()[i], data.labels()->get()[static_cast<std::size_t>(pos - data.data().cbegin())]);
+                EXPECT_TRUE(std::isfinite(model.weights()[i]));
+            }
+            // at least one landmark of each class must be selected
+            EXPECT_NE(std::find(model.labels().cbegin(), model.labels().cend(), model.different_labels()[0]), model.labels().cend());
+            EXPECT_NE(std::find(model.labels().cbegin(), model.labels().cend(), model.different_labels()[1]), model.labels().cend());
+            EXPECT_TRUE(std::isfinite(model.rho()));
+        }
+    }
+}
+TYPED_TEST(FixedSizeLSSVM, fit_all_landmarks) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    // using all data points as landmarks and a large cost value, the training data must be classified correctly
+    const plssvm::parameter params{ plssvm::kernel_type = plssvm::kernel_function_type::rbf, plssvm::cost = 1000.0 };
+    const plssvm::fixed_size_lssvm approx{ params, data.num_data_points() };
+    const plssvm::model<real_type, label_type> model = approx.fit(data);
+
+    const plssvm::detail::parameter<real_type> kernel_params = static_cast<plssvm::detail::parameter<real_type>>(model.get_params());
+    for (std::size_t i = 0; i < data.num_data_points(); ++i) {
+        real_type decision_value = -model.rho();
+        for (std::size_t j = 0; j < model.num_support_vectors(); ++j) {
+            decision_value += model.weights()[j] * plssvm::kernel_function(model.support_vectors()[j], data.data()[i], kernel_params);
+        }
+        // the first label is mapped to -1, the second one to +1
+        const label_type predicted_label = model.different_labels()[decision_value > real_type{ 0.0 } ? 1 : 0];
+        EXPECT_EQ(predicted_label, data.labels()->get()[i]) << "data point: " << i;
+    }
+}
+TYPED_TEST(FixedSizeLSSVM, fit_deterministic) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    // the landmarks are selected using a fixed seed, i.e., two runs must yield the same model
+    const plssvm::fixed_size_lssvm approx{ plssvm::parameter{}, 3, plssvm::landmark_selection_type::kmeans_pp };
+    const plssvm::model<real_type, label_type> model = approx.fit(data);
+    const plssvm::model<real_type, label_type> model_second = approx.fit(data);
+
+    EXPECT_EQ(model.support_vectors(), model_second.support_vectors());
+    EXPECT_EQ(model.weights(), model_second.weights());
+    EXPECT_EQ(model.rho(), model_second.rho());
+}
+TYPED_TEST(FixedSizeLSSVM, fit_too_many_landmarks) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    const plssvm::fixed_size_lssvm approx{ plssvm::parameter{}, 6 };
+    EXPECT_THROW_WHAT(std::ignore = approx.fit(data),
+                      plssvm::invalid_parameter_exception,
+                      "The number of landmarks (6) must not be greater than the number of data points (5)!");
+}
+TYPED_TEST(FixedSizeLSSVM, fit_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> data{ std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } } };
+
+    const plssvm::fixed_size_lssvm approx{ plssvm::parameter{}, 2 };
+    EXPECT_THROW_WHAT(std::ignore = approx.fit(data),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for training! Maybe the data is only usable for prediction?");
+}
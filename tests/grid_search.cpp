@@ -0,0 +1,175 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the grid search over the gamma and cost SVM parameters.
+ */
+
+#include "plssvm/grid_search.hpp"
+
+#include "plssvm/data_set.hpp"                 // plssvm::data_set
+#include "plssvm/exceptions/exceptions.hpp"    // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"    // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                // plssvm::parameter, plssvm::epsilon, plssvm::max_iter
+
+#include "custom_test_macros.hpp"              // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_VECTOR_EQ
+#include "naming.hpp"                          // naming::real_type_label_type_combination_to_name
+#include "types_to_test.hpp"                   // util::real_type_label_type_combination_gtest
+#include "utility.hpp"                         // util::{temporary_file, redirect_output, instantiate_template_file, get_distinct_label}
+
+#include "gtest/gtest.h"                       // TEST, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_TRUE, EXPECT_GE, EXPECT_LE, ASSERT_EQ, ::testing::Test
+
+#include <algorithm>                           // std::is_sorted
+#include <cstddef>                             // std::size_t
+#include <tuple>                               // std::ignore
+#include <vector>                              // std::vector
+
+TEST(GridSearch, construct) {
+    const plssvm::parameter params{ plssvm::kernel_type = plssvm::kernel_function_type::rbf };
+    const plssvm::grid_search grid{ params, { 1.0, 0.01, 0.1, 0.01 }, { 10.0, 1.0, 10.0 } };
+
+    // the provided values must be sorted ascending and without duplicates
+    EXPECT_EQ(grid.get_params(), params);
+    EXPECT_EQ(grid.gamma_values(), (std::vector<double>{ 0.01, 0.1, 1.0 }));
+    EXPECT_EQ(grid.cost_values(), (std::vector<double>{ 1.0, 10.0 }));
+}
+TEST(GridSearch, construct_invalid_gamma) {
+    const plssvm::parameter params{ plssvm::kernel_type = plssvm::kernel_function_type::rbf };
+    EXPECT_THROW_WHAT((plssvm::grid_search{ params, { 0.1, -0.1 } }),
+                      plssvm::invalid_parameter_exception,
+                      "All gamma values must be greater than 0.0, but -0.1 is not!");
+}
+TEST(GridSearch, construct_invalid_cost) {
+    EXPECT_THROW_WHAT((plssvm::grid_search{ plssvm::parameter{}, {}, { 0.0 } }),
+                      plssvm::invalid_parameter_exception,
+                      "All cost values must be greater than 0.0, but 0 is not!");
+}
+TEST(GridSearch, construct_linear_multiple_gamma) {
+    EXPECT_THROW_WHAT((plssvm::grid_search{ plssvm::parameter{}, { 0.1, 1.0 } }),
+                      plssvm::invalid_parameter_exception,
+                      "The linear kernel doesn't use gamma, but 2 gamma values were provided!");
+}
+TEST(GridSearch, construct_invalid_kernel) {
+    const plssvm::parameter params{ plssvm::kernel_type = static_cast<plssvm::kernel_function_type>(3) };
+    EXPECT_THROW_WHAT(plssvm::grid_search{ params },
+                      plssvm::invalid_parameter_exception,
+                      "Invalid kernel function 3 given!");
+}
+
+template <typename T>
+class GridSearch : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(GridSearch, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(GridSearch, fit) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    // perform the grid search
+    const plssvm::parameter params{ plssvm::kernel_type = plssvm::kernel_function_type::rbf };
+    const plssvm::grid_search grid{ params, { 0.01, 0.1, 1.0 }, { 0.1, 1.0, 10.0 } };
+    const plssvm::grid_search_result<real_type, label_type> result = grid.fit(data, plssvm::epsilon = 1e-10);
+
+    // all grid points must be ranked by their accuracy
+    const auto &ranking = result.ranking();
+    ASSERT_EQ(ranking.size(), 9);
+    EXPECT_TRUE(std::is_sorted(ranking.cbegin(), ranking.cend(), [](const auto &lhs, const auto &rhs) { return lhs.accuracy > rhs.accuracy; }));
+    for (const auto &entry : ranking) {
+        EXPECT_EQ(entry.params.kernel_type, plssvm::kernel_function_type::rbf);
+        EXPECT_GE(entry.accuracy, real_type{ 0.0 });
+        EXPECT_LE(entry.accuracy, real_type{ 1.0 });
+    }
+
+    // the best model must correspond to the first grid point in the ranking
+    EXPECT_EQ(result.best().params, ranking.front().params);
+    EXPECT_EQ(result.best_model().get_params(), ranking.front().params);
+    EXPECT_EQ(result.best_model().num_support_vectors(), data.num_data_points());
+    EXPECT_EQ(result.best_model().num_features(), data.num_features());
+}
+TYPED_TEST(GridSearch, fit_validation) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    // perform the grid search; scoring on the training data must yield the same ranking
+    const plssvm::grid_search grid{ plssvm::parameter{}, {}, { 0.5, 2.0 } };
+    const plssvm::grid_search_result<real_type, label_type> result = grid.fit(data, plssvm::epsilon = 1e-10, plssvm::max_iter = 10);
+    const plssvm::grid_search_result<real_type, label_type> result_validation = grid.fit(data, data, plssvm::epsilon = 1e-10, plssvm::max_iter = 10);
+
+    ASSERT_EQ(result.ranking().size(), 2);
+    ASSERT_EQ(result_validation.ranking().size(), 2);
+    for (std::size_t i = 0; i < result.ranking().size(); ++i) {
+        EXPECT_EQ(result.ranking()[i].params, result_validation.ranking()[i].params);
+        EXPECT_FLOATING_POINT_EQ(result.ranking()[i].accuracy, result_validation.ranking()[i].accuracy);
+    }
+    EXPECT_FLOATING_POINT_VECTOR_EQ(result.best_model().weights(), result_validation.best_model().weights());
+    EXPECT_FLOATING_POINT_EQ(result.best_model().rho(), result_validation.best_model().rho());
+}
+TYPED_TEST(GridSearch, fit_invalid_epsilon) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    const plssvm::grid_search grid{};
+    EXPECT_THROW_WHAT((std::ignore = grid.fit(data, plssvm::epsilon = 0.0)),
+                      plssvm::invalid_parameter_exception,
+                      "epsilon must be greater than 0.0, but is 0!");
+}
+TYPED_TEST(GridSearch, fit_invalid_max_iter) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+
+    const plssvm::grid_search grid{};
+    EXPECT_THROW_WHAT((std::ignore = grid.fit(data, plssvm::max_iter = 0)),
+                      plssvm::invalid_parameter_exception,
+                      "max_iter must be greater than 0, but is 0!");
+}
+TYPED_TEST(GridSearch, fit_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> data{ std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } } };
+
+    const plssvm::grid_search grid{};
+    EXPECT_THROW_WHAT(std::ignore = grid.fit(data),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for training! Maybe the data is only usable for prediction?");
+}
+TYPED_TEST(GridSearch, fit_validation_num_features_mismatch) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create data set
+    const util::temporary_file data_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_file.filename);
+    const plssvm::data_set<real_type, label_type> data{ data_file.filename };
+    const auto [first_label, second_label] = util::get_distinct_label<label_type>();
+    const plssvm::data_set<real_type, label_type> validation_data{ std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } },
+                                                                   std::vector<label_type>{ first_label, second_label } };
+
+    const plssvm::grid_search grid{};
+    EXPECT_THROW_WHAT(std::ignore = grid.fit(data, validation_data),
+                      plssvm::invalid_parameter_exception,
+                      "Number of features per data point (2) must match the number of features per training data point (4)!");
+}
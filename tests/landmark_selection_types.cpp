@@ -0,0 +1,48 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to the different landmark selection types.
+ */
+
+#include "plssvm/landmark_selection_types.hpp"
+
+#include "custom_test_macros.hpp"  // EXPECT_CONVERSION_TO_STRING, EXPECT_CONVERSION_FROM_STRING
+
+#include "gtest/gtest.h"           // TEST, EXPECT_TRUE
+
+#include <sstream>                 // std::istringstream
+
+// check whether the plssvm::landmark_selection_type -> std::string conversions are correct
+TEST(LandmarkSelectionType, to_string) {
+    // check conversions to std::string
+    EXPECT_CONVERSION_TO_STRING(plssvm::landmark_selection_type::uniform, "uniform");
+    EXPECT_CONVERSION_TO_STRING(plssvm::landmark_selection_type::kmeans_pp, "kmeans++");
+    EXPECT_CONVERSION_TO_STRING(plssvm::landmark_selection_type::entropy, "entropy");
+}
+TEST(LandmarkSelectionType, to_string_unknown) {
+    // check conversions to std::string from unknown landmark_selection_type
+    EXPECT_CONVERSION_TO_STRING(static_cast<plssvm::landmark_selection_type>(3), "unknown");
+}
+
+// check whether the std::string -> plssvm::landmark_selection_type conversions are correct
+TEST(LandmarkSelectionType, from_string) {
+    // check conversion from std::string
+    EXPECT_CONVERSION_FROM_STRING("UNIFORM", plssvm::landmark_selection_type::uniform);
+    EXPECT_CONVERSION_FROM_STRING("uniform", plssvm::landmark_selection_type::uniform);
+    EXPECT_CONVERSION_FROM_STRING("KMEANS++", plssvm::landmark_selection_type::kmeans_pp);
+    EXPECT_CONVERSION_FROM_STRING("kmeans++", plssvm::landmark_selection_type::kmeans_pp);
+    EXPECT_CONVERSION_FROM_STRING("kmeans_pp", plssvm::landmark_selection_type::kmeans_pp);
+    EXPECT_CONVERSION_FROM_STRING("Entropy", plssvm::landmark_selection_type::entropy);
+    EXPECT_CONVERSION_FROM_STRING("entropy", plssvm::landmark_selection_type::entropy);
+}
+TEST(LandmarkSelectionType, from_string_unknown) {
+    // foo isn't a valid landmark_selection_type
+    std::istringstream input{ "foo" };
+    plssvm::landmark_selection_type selection{};
+    input >> selection;
+    EXPECT_TRUE(input.fail());
+}
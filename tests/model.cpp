@@ -10,21 +10,23 @@
 
 #include "plssvm/model.hpp"
 
-#include "plssvm/parameter.hpp"    // plssvm::parameter
+#include "plssvm/detail/io/compression.hpp"  // plssvm::detail::io::{determine_compression_type, is_compression_type_supported}
+#include "plssvm/parameter.hpp"              // plssvm::parameter
 
-#include "custom_test_macros.hpp"  // EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_FLOATING_POINT_2D_VECTOR_EQ
-#include "naming.hpp"              // naming::real_type_label_type_combination_to_name
-#include "types_to_test.hpp"       // util::real_type_label_type_combination_gtest
-#include "utility.hpp"             // util::{temporary_file, redirect_output, instantiate_template_file, get_distinct_label}
+#include "custom_test_macros.hpp"            // EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_FLOATING_POINT_2D_VECTOR_EQ
+#include "naming.hpp"                        // naming::real_type_label_type_combination_to_name
+#include "types_to_test.hpp"                 // util::real_type_label_type_combination_gtest
+#include "utility.hpp"                       // util::{temporary_file, redirect_output, instantiate_template_file, get_distinct_label}
 
-#include "gtest/gtest.h"           // EXPECT_EQ, EXPECT_TRUE, ASSERT_GT, GTEST_FAIL, TYPED_TEST, TYPED_TEST_SUITE, TEST_P, INSTANTIATE_TEST_SUITE_P
-                                   // ::testing::{StaticAssertTypeEq, Test, TestWithParam, Values}
+#include "gtest/gtest.h"                     // EXPECT_EQ, EXPECT_TRUE, ASSERT_GT, GTEST_FAIL, GTEST_SKIP, TYPED_TEST, TYPED_TEST_SUITE, TEST_P, INSTANTIATE_TEST_SUITE_P
+                                             // ::testing::{StaticAssertTypeEq, Test, TestWithParam, Values}
 
-#include <cstddef>                 // std::size_t
-#include <regex>                   // std::regex, std::regex_match, std::regex::extended
-#include <string>                  // std::string
-#include <string_view>             // std::string_view
-#include <vector>                  // std::vector
+#include <cstddef>                           // std::size_t
+#include <filesystem>                        // std::filesystem::remove
+#include <regex>                             // std::regex, std::regex_match, std::regex::extended
+#include <string>                            // std::string
+#include <string_view>                       // std::string_view
+#include <vector>                            // std::vector
 
 template <typename T>
 class Model : public ::testing::Test, private util::redirect_output<> {};
@@ -201,6 +203,58 @@ TYPED_TEST(Model, rho) {
     EXPECT_FLOATING_POINT_EQ(model.rho(), real_type{ 0.37330625882191915 });
 }
 
+TYPED_TEST(Model, save_binary) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // instantiate a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> model{ model_file.filename };
+
+    // write the model to a binary model file and read it again
+    const util::temporary_file binary_model_file;
+    const std::string binary_model_filename = binary_model_file.filename + ".bin";
+    model.save(binary_model_filename);
+    const plssvm::model<real_type, label_type> binary_model{ binary_model_filename };
+    std::filesystem::remove(binary_model_filename);
+
+    // the binary model must be exactly the same
+    EXPECT_EQ(binary_model.num_support_vectors(), model.num_support_vectors());
+    EXPECT_EQ(binary_model.num_features(), model.num_features());
+    EXPECT_EQ(binary_model.get_params(), model.get_params());
+    EXPECT_EQ(binary_model.support_vectors(), model.support_vectors());
+    EXPECT_EQ(binary_model.labels(), model.labels());
+    EXPECT_EQ(binary_model.different_labels(), model.different_labels());
+    EXPECT_EQ(binary_model.weights(), model.weights());
+    EXPECT_EQ(binary_model.rho(), model.rho());
+}
+
+class ModelCompressed : public ::testing::TestWithParam<std::string>, private util::redirect_output<> {
+  protected:
+    void SetUp() override {
+        // skip the test if the compression type isn't supported in this build
+        if (!plssvm::detail::io::is_compression_type_supported(plssvm::detail::io::determine_compression_type(GetParam()))) {
+            GTEST_SKIP() << "The compression type isn't supported!";
+        }
+    }
+};
+TEST_P(ModelCompressed, construct_from_compressed_file) {
+    // read the compressed and uncompressed model file
+    const plssvm::model<double, int> compressed_model{ PLSSVM_TEST_PATH + GetParam() };
+    const plssvm::model<double, int> model{ PLSSVM_TEST_PATH "/data/model/5x4_linear.libsvm.model" };
+
+    // the compressed model must be transparently decompressed
+    EXPECT_EQ(compressed_model.num_support_vectors(), model.num_support_vectors());
+    EXPECT_EQ(compressed_model.num_features(), model.num_features());
+    EXPECT_EQ(compressed_model.get_params(), model.get_params());
+    EXPECT_EQ(compressed_model.support_vectors(), model.support_vectors());
+    EXPECT_EQ(compressed_model.labels(), model.labels());
+    EXPECT_EQ(compressed_model.weights(), model.weights());
+    EXPECT_EQ(compressed_model.rho(), model.rho());
+}
+INSTANTIATE_TEST_SUITE_P(Model, ModelCompressed, ::testing::Values("/data/compressed/5x4_linear.libsvm.model.gz"));
+
 class ModelSave : public ::testing::TestWithParam<std::string>, private util::redirect_output<>, protected util::temporary_file {};
 TEST_P(ModelSave, save) {
     // create a model using an existing LIBSVM model file
@@ -273,4 +327,42 @@ INSTANTIATE_TEST_SUITE_P(Model, ModelSave, ::testing::Values(
                 "/data/model/5x4_linear.libsvm.model",
                 "/data/model/5x4_polynomial.libsvm.model",
                 "/data/model/5x4_rbf.libsvm.model"));
-// clang-format on
\ No newline at end of file
+// clang-format on
+
+class ModelSaveBinary : public ::testing::TestWithParam<std::string>, private util::redirect_output<>, protected util::temporary_file {};
+TEST_P(ModelSaveBinary, save) {
+    // create a model using an existing LIBSVM model file
+    const plssvm::model<double, int> model{ fmt::format("{}{}", PLSSVM_TEST_PATH, GetParam()) };
+
+    // write model to a binary model file and read it again
+    const std::string binary_filename = filename + ".bin";
+    model.save(binary_filename);
+    const plssvm::model<double, int> binary_model{ binary_filename };
+    std::filesystem::remove(binary_filename);
+
+    // the SVM parameters must be restored including their default state
+    const plssvm::parameter &params = model.get_params();
+    const plssvm::parameter &binary_params = binary_model.get_params();
+    EXPECT_EQ(binary_params.kernel_type, params.kernel_type);
+    EXPECT_EQ(binary_params.kernel_type.is_default(), params.kernel_type.is_default());
+    EXPECT_EQ(binary_params.degree, params.degree);
+    EXPECT_EQ(binary_params.degree.is_default(), params.degree.is_default());
+    EXPECT_EQ(binary_params.gamma, params.gamma);
+    EXPECT_EQ(binary_params.gamma.is_default(), params.gamma.is_default());
+    EXPECT_EQ(binary_params.coef0, params.coef0);
+    EXPECT_EQ(binary_params.coef0.is_default(), params.coef0.is_default());
+    EXPECT_EQ(binary_params.cost, params.cost);
+    EXPECT_EQ(binary_params.cost.is_default(), params.cost.is_default());
+
+    // the support vectors and weights must be restored bitwise identical
+    EXPECT_EQ(binary_model.support_vectors(), model.support_vectors());
+    EXPECT_EQ(binary_model.labels(), model.labels());
+    EXPECT_EQ(binary_model.weights(), model.weights());
+    EXPECT_EQ(binary_model.rho(), model.rho());
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(Model, ModelSaveBinary, ::testing::Values(
+                "/data/model/5x4_linear.libsvm.model",
+                "/data/model/5x4_polynomial.libsvm.model",
+                "/data/model/5x4_rbf.libsvm.model"));
+// clang-format on
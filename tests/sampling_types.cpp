@@ -0,0 +1,44 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to the different sampling types.
+ */
+
+#include "plssvm/sampling_types.hpp"
+
+#include "custom_test_macros.hpp"  // EXPECT_CONVERSION_TO_STRING, EXPECT_CONVERSION_FROM_STRING
+
+#include "gtest/gtest.h"           // TEST, EXPECT_TRUE
+
+#include <sstream>                 // std::istringstream
+
+// check whether the plssvm::sampling_type -> std::string conversions are correct
+TEST(SamplingType, to_string) {
+    // check conversions to std::string
+    EXPECT_CONVERSION_TO_STRING(plssvm::sampling_type::uniform, "uniform");
+    EXPECT_CONVERSION_TO_STRING(plssvm::sampling_type::stratified, "stratified");
+}
+TEST(SamplingType, to_string_unknown) {
+    // check conversions to std::string from unknown sampling_type
+    EXPECT_CONVERSION_TO_STRING(static_cast<plssvm::sampling_type>(2), "unknown");
+}
+
+// check whether the std::string -> plssvm::sampling_type conversions are correct
+TEST(SamplingType, from_string) {
+    // check conversion from std::string
+    EXPECT_CONVERSION_FROM_STRING("UNIFORM", plssvm::sampling_type::uniform);
+    EXPECT_CONVERSION_FROM_STRING("uniform", plssvm::sampling_type::uniform);
+    EXPECT_CONVERSION_FROM_STRING("Stratified", plssvm::sampling_type::stratified);
+    EXPECT_CONVERSION_FROM_STRING("stratified", plssvm::sampling_type::stratified);
+}
+TEST(SamplingType, from_string_unknown) {
+    // foo isn't a valid sampling_type
+    std::istringstream input{ "foo" };
+    plssvm::sampling_type sampling{};
+    input >> sampling;
+    EXPECT_TRUE(input.fail());
+}
@@ -0,0 +1,155 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the solver state used to recycle the Krylov subspace information across related solves.
+ */
+
+#include "plssvm/solver_state.hpp"
+
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_parameter_exception, plssvm::invalid_file_format_exception
+
+#include "custom_test_macros.hpp"            // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_2D_VECTOR_EQ
+#include "naming.hpp"                        // naming::real_type_to_name
+#include "types_to_test.hpp"                 // util::real_type_gtest
+#include "utility.hpp"                       // util::temporary_file
+
+#include "gtest/gtest.h"                     // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_THROW, ::testing::Test
+
+#include <stdexcept>                         // std::runtime_error
+#include <vector>                            // std::vector
+
+template <typename T>
+class SolverState : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(SolverState, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(SolverState, construct) {
+    using real_type = TypeParam;
+
+    // create solver state
+    const plssvm::solver_state<real_type> state{ 4 };
+
+    // check whether the solver state is empty
+    EXPECT_EQ(state.max_vectors(), 4);
+    EXPECT_EQ(state.num_vectors(), 0);
+    EXPECT_EQ(state.num_rows(), 0);
+    EXPECT_TRUE(state.empty());
+    EXPECT_TRUE(state.deflation_vectors().empty());
+    EXPECT_EQ(state.last_num_iterations(), 0);
+}
+TYPED_TEST(SolverState, construct_default) {
+    using real_type = TypeParam;
+
+    // create default solver state
+    const plssvm::solver_state<real_type> state{};
+
+    // check the default maximum number of deflation vectors
+    EXPECT_EQ(state.max_vectors(), 8);
+    EXPECT_TRUE(state.empty());
+}
+TYPED_TEST(SolverState, construct_invalid_max_vectors) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW_WHAT(plssvm::solver_state<real_type>{ 0 },
+                      plssvm::invalid_parameter_exception,
+                      "The maximum number of deflation vectors must be greater than 0!");
+}
+TYPED_TEST(SolverState, construct_from_file) {
+    using real_type = TypeParam;
+
+    // read solver state from file
+    const plssvm::solver_state<real_type> state{ PLSSVM_TEST_PATH "/data/solver_state/solver_state.txt" };
+
+    // check for correctness
+    EXPECT_EQ(state.max_vectors(), 3);
+    EXPECT_EQ(state.num_vectors(), 2);
+    EXPECT_EQ(state.num_rows(), 4);
+    EXPECT_FALSE(state.empty());
+    const std::vector<std::vector<real_type>> correct_vectors{
+        { real_type{ 0.5 }, real_type{ 0.5 }, real_type{ 0.5 }, real_type{ 0.5 } },
+        { real_type{ 0.5 }, real_type{ -0.5 }, real_type{ 0.5 }, real_type{ -0.5 } }
+    };
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(state.deflation_vectors(), correct_vectors);
+}
+TYPED_TEST(SolverState, save) {
+    using real_type = TypeParam;
+
+    // read solver state from file
+    const plssvm::solver_state<real_type> state{ PLSSVM_TEST_PATH "/data/solver_state/solver_state.txt" };
+
+    // save the solver state and read it again
+    const util::temporary_file tmp_file;
+    state.save(tmp_file.filename);
+    const plssvm::solver_state<real_type> read_state{ tmp_file.filename };
+
+    // the read solver state must be equal to the saved one
+    EXPECT_EQ(read_state.max_vectors(), state.max_vectors());
+    EXPECT_EQ(read_state.num_rows(), state.num_rows());
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(read_state.deflation_vectors(), state.deflation_vectors());
+}
+TYPED_TEST(SolverState, save_empty) {
+    using real_type = TypeParam;
+
+    // save an empty solver state and read it again
+    const util::temporary_file tmp_file;
+    plssvm::solver_state<real_type>{ 2 }.save(tmp_file.filename);
+    const plssvm::solver_state<real_type> read_state{ tmp_file.filename };
+
+    EXPECT_EQ(read_state.max_vectors(), 2);
+    EXPECT_TRUE(read_state.empty());
+}
+TYPED_TEST(SolverState, clear) {
+    using real_type = TypeParam;
+
+    // read solver state from file
+    plssvm::solver_state<real_type> state{ PLSSVM_TEST_PATH "/data/solver_state/solver_state.txt" };
+    ASSERT_FALSE(state.empty());
+
+    // remove all deflation vectors
+    state.clear();
+    EXPECT_TRUE(state.empty());
+    EXPECT_EQ(state.max_vectors(), 3);
+}
+TYPED_TEST(SolverState, construct_from_file_too_few_lines) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW_WHAT(plssvm::solver_state<real_type>{ PLSSVM_TEST_PATH "/data/solver_state/invalid/too_few_lines.txt" },
+                      plssvm::invalid_file_format_exception,
+                      "At least two lines must be present, but only 1 were given!");
+}
+TYPED_TEST(SolverState, construct_from_file_wrong_header_order) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW_WHAT(plssvm::solver_state<real_type>{ PLSSVM_TEST_PATH "/data/solver_state/invalid/wrong_header_order.txt" },
+                      plssvm::invalid_file_format_exception,
+                      "Expected the header entry \"max_vectors\", but got \"num_rows 4\"!");
+}
+TYPED_TEST(SolverState, construct_from_file_zero_max_vectors) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW_WHAT(plssvm::solver_state<real_type>{ PLSSVM_TEST_PATH "/data/solver_state/invalid/zero_max_vectors.txt" },
+                      plssvm::invalid_file_format_exception,
+                      "The maximum number of deflation vectors must be greater than 0!");
+}
+TYPED_TEST(SolverState, construct_from_file_too_many_vectors) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW_WHAT(plssvm::solver_state<real_type>{ PLSSVM_TEST_PATH "/data/solver_state/invalid/too_many_vectors.txt" },
+                      plssvm::invalid_file_format_exception,
+                      "At most 1 deflation vectors may be given, but 2 were given!");
+}
+TYPED_TEST(SolverState, construct_from_file_too_few_values) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW_WHAT(plssvm::solver_state<real_type>{ PLSSVM_TEST_PATH "/data/solver_state/invalid/too_few_values.txt" },
+                      plssvm::invalid_file_format_exception,
+                      "Each deflation vector must contain exactly 4 values, but deflation vector 0 contains 3!");
+}
+TYPED_TEST(SolverState, construct_from_file_invalid_number) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW(plssvm::solver_state<real_type>{ PLSSVM_TEST_PATH "/data/solver_state/invalid/invalid_number.txt" }, std::runtime_error);
+}
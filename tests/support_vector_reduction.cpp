@@ -0,0 +1,148 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the post-training reduction of the number of support vectors.
+ */
+
+#include "plssvm/support_vector_reduction.hpp"
+
+#include "plssvm/data_set.hpp"                  // plssvm::data_set
+#include "plssvm/exceptions/exceptions.hpp"     // plssvm::invalid_parameter_exception
+#include "plssvm/fixed_size_lssvm.hpp"          // plssvm::fixed_size_lssvm
+#include "plssvm/kernel_function_types.hpp"     // plssvm::kernel_function_type, plssvm::kernel_function
+#include "plssvm/model.hpp"                     // plssvm::model
+#include "plssvm/parameter.hpp"                 // plssvm::parameter, plssvm::detail::parameter
+
+#include "custom_test_macros.hpp"               // EXPECT_THROW_WHAT
+#include "naming.hpp"                           // naming::{real_type_label_type_combination_to_name, real_type_to_name}
+#include "types_to_test.hpp"                    // util::{real_type_label_type_combination_gtest, real_type_gtest}
+#include "utility.hpp"                          // util::{temporary_file, redirect_output, instantiate_template_file}
+
+#include "gtest/gtest.h"                        // TEST, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_NE, EXPECT_LE, EXPECT_TRUE, ASSERT_EQ, ::testing::Test
+
+#include <algorithm>                            // std::find
+#include <cmath>                                // std::isfinite
+#include <cstddef>                              // std::size_t
+#include <vector>                               // std::vector
+
+TEST(SupportVectorReduction, construct) {
+    const plssvm::support_vector_reduction reduction{ 42, 0.05 };
+
+    EXPECT_EQ(reduction.num_support_vectors(), 42);
+    EXPECT_EQ(reduction.tolerance(), 0.05);
+}
+TEST(SupportVectorReduction, construct_default_tolerance) {
+    const plssvm::support_vector_reduction reduction{ 42 };
+
+    EXPECT_EQ(reduction.num_support_vectors(), 42);
+    EXPECT_EQ(reduction.tolerance(), 1.0);
+}
+TEST(SupportVectorReduction, construct_invalid_num_support_vectors) {
+    EXPECT_THROW_WHAT(plssvm::support_vector_reduction{ 1 },
+                      plssvm::invalid_parameter_exception,
+                      "The number of support vectors must be at least 2, but is 1!");
+}
+TEST(SupportVectorReduction, construct_invalid_tolerance) {
+    EXPECT_THROW_WHAT((plssvm::support_vector_reduction{ 2, -0.1 }),
+                      plssvm::invalid_parameter_exception,
+                      "The tolerance must be in the range [0.0, 1.0], but is -0.1!");
+    EXPECT_THROW_WHAT((plssvm::support_vector_reduction{ 2, 1.5 }),
+                      plssvm::invalid_parameter_exception,
+                      "The tolerance must be in the range [0.0, 1.0], but is 1.5!");
+}
+
+template <typename T>
+class SupportVectorReduction : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(SupportVectorReduction, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(SupportVectorReduction, reduce) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // read the model to reduce
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> full_model{ model_file.filename };
+
+    for (std::size_t num_support_vectors = 2; num_support_vectors < full_model.num_support_vectors(); ++num_support_vectors) {
+        const plssvm::model<real_type, label_type> reduced_model = plssvm::support_vector_reduction{ num_support_vectors }.reduce(full_model);
+
+        // the reduced model must use the requested number of support vectors
+        ASSERT_EQ(reduced_model.num_support_vectors(), num_support_vectors);
+        EXPECT_EQ(reduced_model.num_features(), full_model.num_features());
+        ASSERT_EQ(reduced_model.weights().size(), num_support_vectors);
+        EXPECT_EQ(reduced_model.get_params(), full_model.get_params());
+        EXPECT_EQ(reduced_model.different_labels(), full_model.different_labels());
+        // each support vector must be one of the original support vectors
+        for (std::size_t i = 0; i < num_support_vectors; ++i) {
+            const auto pos = std::find(full_model.support_vectors().cbegin(), full_model.support_vectors().cend(), reduced_model.support_vectors()[i]);
+            ASSERT_NE(pos, full_model.support_vectors().cend());
+            EXPECT_EQ(reduced_model.labels()[i], full_model.labels()[static_cast<std::size_t>(pos - full_model.support_vectors().cbegin())]);
+            EXPECT_TRUE(std::isfinite(reduced_model.weights()[i]));
+        }
+        EXPECT_TRUE(std::isfinite(reduced_model.rho()));
+    }
+}
+TYPED_TEST(SupportVectorReduction, reduce_nothing_to_reduce) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // read the model to reduce
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> full_model{ model_file.filename };
+
+    // the model already contains at most the requested number of support vectors -> the model is returned unchanged
+    for (const std::size_t num_support_vectors : { full_model.num_support_vectors(), full_model.num_support_vectors() + 1 }) {
+        const plssvm::model<real_type, label_type> reduced_model = plssvm::support_vector_reduction{ num_support_vectors }.reduce(full_model);
+
+        EXPECT_EQ(reduced_model.support_vectors(), full_model.support_vectors());
+        EXPECT_EQ(reduced_model.labels(), full_model.labels());
+        EXPECT_EQ(reduced_model.weights(), full_model.weights());
+        EXPECT_EQ(reduced_model.rho(), full_model.rho());
+    }
+}
+
+template <typename T>
+class SupportVectorReductionTolerance : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(SupportVectorReductionTolerance, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(SupportVectorReductionTolerance, reduce) {
+    using real_type = TypeParam;
+
+    // learn a model with 200 support vectors
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+    const plssvm::model<real_type> full_model = plssvm::fixed_size_lssvm{ plssvm::parameter{ plssvm::kernel_type = plssvm::kernel_function_type::rbf }, 200 }.fit(data);
+
+    // calculate the fraction of support vectors whose predicted label changed due to the reduction
+    const auto changed_fraction = [&](const plssvm::model<real_type> &reduced_model) {
+        const auto decision_value = [](const plssvm::model<real_type> &model, const std::vector<real_type> &point) {
+            const auto params = static_cast<plssvm::detail::parameter<real_type>>(model.get_params());
+            real_type value = -model.rho();
+            for (std::size_t j = 0; j < model.num_support_vectors(); ++j) {
+                value += model.weights()[j] * plssvm::kernel_function(model.support_vectors()[j], point, params);
+            }
+            return value;
+        };
+        std::size_t num_changed_labels = 0;
+        for (const std::vector<real_type> &point : full_model.support_vectors()) {
+            if ((decision_value(full_model, point) > real_type{ 0.0 }) != (decision_value(reduced_model, point) > real_type{ 0.0 })) {
+                ++num_changed_labels;
+            }
+        }
+        return static_cast<double>(num_changed_labels) / static_cast<double>(full_model.num_support_vectors());
+    };
+
+    for (const double tolerance : { 0.0, 0.05, 0.2 }) {
+        const plssvm::model<real_type> reduced_model = plssvm::support_vector_reduction{ 10, tolerance }.reduce(full_model);
+
+        // the tolerance must be met using at least the requested number of support vectors
+        EXPECT_GE(reduced_model.num_support_vectors(), 10);
+        EXPECT_LE(reduced_model.num_support_vectors(), full_model.num_support_vectors());
+        EXPECT_LE(changed_fraction(reduced_model), tolerance) << "tolerance: " << tolerance;
+    }
+}
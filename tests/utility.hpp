@@ -28,7 +28,7 @@
 #include <cstddef>      // std::size_t
 #include <filesystem>   // std::filesystem::{temp_directory_path, exists, remove}
 #include <fstream>      // std::ifstream, std::ofstream
-#include <iostream>     // std::ostream, std::cout
+#include <iostream>     // std::ostream, std::cout, std::cin
 #include <iterator>     // std::istreambuf_iterator
 #include <limits>       // std::numeric_limits{max, lowest}
 #include <random>       // std::random_device, std::mt19937, std::uniform_real_distribution
@@ -95,6 +95,53 @@ class redirect_output {
     std::streambuf *sbuf_{ nullptr };
 };
 
+/**
+ * @brief Class used to redirect the standard input inside test cases such that it reads from the provided content.
+ */
+class redirect_input {
+  public:
+    /**
+     * @brief Redirect the standard input to read from @p content and store the original input location of std::cin.
+     * @param[in] content the content that should be read from std::cin
+     */
+    explicit redirect_input(const std::string &content) :
+        buffer_{ content },
+        sbuf_{ std::cin.rdbuf() } {
+        // read std::cin from the buffer
+        std::cin.rdbuf(buffer_.rdbuf());
+        std::cin.clear();
+    }
+    /**
+     * @brief Copy-construction is unnecessary.
+     */
+    redirect_input(const redirect_input &) = delete;
+    /**
+     * @brief Move-construction is unnecessary.
+     */
+    redirect_input(redirect_input &&) = delete;
+    /**
+     * @brief Copy-assignment is unnecessary.
+     */
+    redirect_input &operator=(const redirect_input &) = delete;
+    /**
+     * @brief Move-assignment is unnecessary.
+     */
+    redirect_input &operator=(redirect_input &&) = delete;
+    /**
+     * @brief Restore the original input location of std::cin.
+     */
+    ~redirect_input() {
+        // end reading std::cin from the buffer
+        std::cin.rdbuf(sbuf_);
+        std::cin.clear();
+        sbuf_ = nullptr;
+    }
+
+  private:
+    std::istringstream buffer_{};
+    std::streambuf *sbuf_{ nullptr };
+};
+
 /**
  * @brief A class encapsulating an unique temporary file's name.
  * @details On UNIX systems use `mkstemp` to create a unique file in the temporary directory. On non-UNIX system create